@@ -80,7 +80,7 @@ int main(int argc, char* argv[]) {
   size_t iterations = 0;
   size_t generated_chars = 0;
   do {
-    decoder.Decode(start, end);
+    decoder.DecodeBatch(start, end);
     generated_chars += disasm.GetGeneratedCharCount();
 
     iterations++;
@@ -0,0 +1,208 @@
+// Copyright 2026, VIXL authors
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//   * Redistributions of source code must retain the above copyright notice,
+//     this list of conditions and the following disclaimer.
+//   * Redistributions in binary form must reproduce the above copyright notice,
+//     this list of conditions and the following disclaimer in the documentation
+//     and/or other materials provided with the distribution.
+//   * Neither the name of ARM Limited nor the names of its contributors may be
+//     used to endorse or promote products derived from this software without
+//     specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS CONTRIBUTORS "AS IS" AND
+// ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+// WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include <vector>
+
+#include "globals-vixl.h"
+
+#include "aarch64/instructions-aarch64.h"
+#include "aarch64/macro-assembler-aarch64.h"
+
+#include "bench-memory.h"
+#include "bench-utils.h"
+
+using namespace vixl;
+using namespace vixl::aarch64;
+
+// This program measures how code generation scales with the state tracked by
+// the MacroAssembler: the number of live labels, the number of unresolved
+// branches to each label, the number of pending literals, and the distance the
+// literal pool has to cover. It reports the time per macro-instruction, the
+// size of the generated code, and the peak heap usage (pools, label link sets,
+// etc.) for each configuration.
+//
+// For the time per instruction to be meaningful, it should stay roughly
+// constant within each sweep. Growth with the size of a configuration points
+// to an asymptotic regression.
+
+// Configurations with more instructions than this are skipped, so that the
+// code stays within the range of every branch type's veneers.
+static const size_t kMaxInstructions = 1 * MBytes;
+
+// Emit one configuration with `emit` repeatedly, for at least
+// `time_per_config` seconds, and add the results to the current row of
+// `report`.
+//
+// The peak heap usage is measured separately, with a fresh MacroAssembler, so
+// that it does not depend on capacity left over from previous configurations.
+template <typename F>
+static void Measure(BenchReport* report, double time_per_config, F emit) {
+  size_t peak_bytes;
+  {
+    BenchMemory::StartMeasurement();
+    MacroAssembler masm;
+    masm.GetArena()->SetChunkAllocator(BenchMemory::GetArenaChunkAllocator());
+    emit(&masm);
+    masm.FinalizeCode();
+    peak_bytes = BenchMemory::GetPeakBytes();
+  }
+
+  MacroAssembler masm;
+  uint64_t iterations = 0;
+  uint64_t instructions = 0;
+  BenchTimer timer;
+  do {
+    masm.Reset();
+    instructions += emit(&masm);
+    masm.FinalizeCode();
+    iterations++;
+  } while (timer.GetElapsedSeconds() < time_per_config);
+  double elapsed = timer.GetElapsedSeconds();
+
+  report->AddColumn("iterations", iterations);
+  report->AddColumn("ns_per_instruction", (elapsed * 1e9) / instructions);
+  report->AddColumn("code_bytes",
+                    static_cast<uint64_t>(masm.GetSizeOfCodeGenerated()));
+  report->AddColumn("peak_heap_bytes", static_cast<uint64_t>(peak_bytes));
+  report->EndRow();
+}
+
+// Emit `branches_per_label` rounds of forward branches to each of the labels,
+// then bind the labels in reverse order. The branch types are mixed so that
+// every veneer pool queue is exercised; the short-range ones (`tbz`, `cbz`)
+// need veneers once the code grows large enough.
+static size_t EmitLabelConfiguration(MacroAssembler* masm,
+                                     std::vector<Label>* labels,
+                                     size_t branches_per_label) {
+  size_t instructions = 0;
+  for (size_t round = 0; round < branches_per_label; round++) {
+    for (size_t i = 0; i < labels->size(); i++) {
+      Label* label = &(*labels)[i];
+      switch (instructions % 4) {
+        case 0:
+          masm->B(ne, label);
+          break;
+        case 1:
+          masm->Cbz(x0, label);
+          break;
+        case 2:
+          masm->Tbz(x1, 7, label);
+          break;
+        case 3:
+          masm->B(label);
+          break;
+      }
+      instructions++;
+    }
+  }
+  for (size_t i = labels->size(); i > 0; i--) {
+    masm->Bind(&(*labels)[i - 1]);
+  }
+  return instructions;
+}
+
+// Load `literals` distinct 64-bit values, separated by `pressure` nops each,
+// so that the literal pool is emitted more often as the pressure increases.
+static size_t EmitLiteralConfiguration(MacroAssembler* masm,
+                                       size_t literals,
+                                       size_t pressure) {
+  size_t instructions = 0;
+  for (size_t i = 0; i < literals; i++) {
+    masm->Ldr(x0, UINT64_C(0x0123456789abcdef) + i);
+    for (size_t j = 0; j < pressure; j++) {
+      masm->Nop();
+    }
+    instructions += 1 + pressure;
+  }
+  return instructions;
+}
+
+// A single configuration of one of the sweeps. The label sweep sets `labels`
+// and `branches_per_label`, and the literal sweep sets `literals` and
+// `pressure`; the other fields are zero, and are still reported so that every
+// row has the same columns.
+struct Configuration {
+  const char* sweep;
+  size_t labels;
+  size_t branches_per_label;
+  size_t literals;
+  size_t pressure;
+};
+
+static std::vector<Configuration> GetConfigurations() {
+  static const size_t kLabelCounts[] = {16, 256, 4096};
+  static const size_t kBranchesPerLabel[] = {1, 16, 256};
+  static const size_t kLiteralCounts[] = {64, 1024, 16384};
+  static const size_t kPressures[] = {0, 64, 1024};
+
+  std::vector<Configuration> configurations;
+  for (size_t label_count : kLabelCounts) {
+    for (size_t branches_per_label : kBranchesPerLabel) {
+      if ((label_count * branches_per_label) > kMaxInstructions) continue;
+      Configuration config = {"labels", label_count, branches_per_label, 0, 0};
+      configurations.push_back(config);
+    }
+  }
+  for (size_t literal_count : kLiteralCounts) {
+    for (size_t pressure : kPressures) {
+      if ((literal_count * pressure) > kMaxInstructions) continue;
+      Configuration config = {"literals", 0, 0, literal_count, pressure};
+      configurations.push_back(config);
+    }
+  }
+  return configurations;
+}
+
+int main(int argc, char* argv[]) {
+  BenchCLI cli(argc, argv);
+  if (cli.ShouldExitEarly()) return cli.GetExitCode();
+
+  // Share the run time between the configurations. Each configuration runs at
+  // least once, so the total run time may be exceeded for small run times.
+  std::vector<Configuration> configurations = GetConfigurations();
+  double time_per_config = static_cast<double>(cli.GetRunTimeInSeconds()) /
+                           configurations.size();
+
+  BenchReport report(&cli, "aarch64-pools");
+  for (const Configuration& config : configurations) {
+    report.AddColumn("sweep", config.sweep);
+    report.AddColumn("labels", static_cast<uint64_t>(config.labels));
+    report.AddColumn("branches_per_label",
+                     static_cast<uint64_t>(config.branches_per_label));
+    report.AddColumn("literals", static_cast<uint64_t>(config.literals));
+    report.AddColumn("pressure", static_cast<uint64_t>(config.pressure));
+    Measure(&report, time_per_config, [=](MacroAssembler* masm) {
+      if (config.labels > 0) {
+        std::vector<Label> labels(config.labels);
+        return EmitLabelConfiguration(masm, &labels, config.branches_per_label);
+      }
+      return EmitLiteralConfiguration(masm, config.literals, config.pressure);
+    });
+  }
+  report.Finish();
+
+  return cli.GetExitCode();
+}
@@ -27,142 +27,13 @@
 #ifndef VIXL_AARCH64_BENCH_UTILS_H_
 #define VIXL_AARCH64_BENCH_UTILS_H_
 
-#include <stdio.h>
-#include <stdlib.h>
-#include <sys/time.h>
-
 #include <list>
 #include <vector>
 
 #include "globals-vixl.h"
 #include "aarch64/macro-assembler-aarch64.h"
 
-class BenchTimer {
- public:
-  BenchTimer() { gettimeofday(&start_, NULL); }
-
-  double GetElapsedSeconds() const {
-    timeval elapsed = GetElapsed();
-    double sec = elapsed.tv_sec;
-    double usec = elapsed.tv_usec;
-    return sec + (usec / 1000000.0);
-  }
-
-  bool HasRunFor(uint32_t seconds) {
-    timeval elapsed = GetElapsed();
-    VIXL_ASSERT(elapsed.tv_sec >= 0);
-    return static_cast<uint64_t>(elapsed.tv_sec) >= seconds;
-  }
-
- private:
-  timeval GetElapsed() const {
-    VIXL_ASSERT(timerisset(&start_));
-    timeval now, elapsed;
-    gettimeofday(&now, NULL);
-    timersub(&now, &start_, &elapsed);
-    return elapsed;
-  }
-
-  timeval start_;
-};
-
-// Provide a standard command-line interface for all benchmarks.
-class BenchCLI {
- public:
-  // Set default values.
-  BenchCLI(int argc, char* argv[])
-      : run_time_(kDefaultRunTime), status_(kRunBenchmark) {
-    for (int i = 1; i < argc; i++) {
-      if ((strcmp(argv[i], "-h") == 0) || (strcmp(argv[i], "--help") == 0)) {
-        PrintUsage(argv[0]);
-        status_ = kExitSuccess;
-        return;
-      }
-    }
-
-    // Use the default run time.
-    if (argc == 1) return;
-
-    if (argc != 2) {
-      if (argc > 0) PrintUsage(argv[0]);
-      status_ = kExitFailure;
-      return;
-    }
-
-    char* end;
-    unsigned long run_time = strtoul(argv[1], &end, 0);  // NOLINT(runtime/int)
-    if ((end == argv[1]) || (run_time > UINT32_MAX)) {
-      PrintUsage(argv[0]);
-      status_ = kExitFailure;
-      return;
-    }
-    run_time_ = static_cast<uint32_t>(run_time);
-  }
-
-  void PrintUsage(char* name) {
-    printf("USAGE: %s [OPTIONS]... [RUN_TIME]\n", name);
-    printf("\n");
-    printf("Run a single VIXL benchmark for approximately RUN_TIME seconds,\n");
-    printf("or %" PRIu32 " seconds if unspecified.\n", kDefaultRunTime);
-    printf("\n");
-#ifdef VIXL_DEBUG
-    printf("This is a DEBUG build. VIXL's assertions will be enabled, and\n");
-    printf("extra debug information may be printed. The benchmark results\n");
-    printf("are not representative of expected VIXL deployments.\n");
-    printf("\n");
-#endif
-    printf("OPTIONS:\n");
-    printf("\n");
-    printf("    -h, --help\n");
-    printf("        Print this help message.\n");
-  }
-
-  void PrintResults(uint64_t iterations, double elapsed_seconds) {
-    double score = iterations / elapsed_seconds;
-    printf("%g iteration%s per second (%" PRIu64 " / %g)",
-           score,
-           (score == 1.0) ? "" : "s",
-           iterations,
-           elapsed_seconds);
-#ifdef VIXL_DEBUG
-    printf(" [Warning: DEBUG build]");
-#endif
-    printf("\n");
-  }
-
-  bool ShouldExitEarly() const {
-    switch (status_) {
-      case kRunBenchmark:
-        return false;
-      case kExitFailure:
-      case kExitSuccess:
-        return true;
-    }
-    VIXL_UNREACHABLE();
-    return true;
-  }
-
-  int GetExitCode() const {
-    switch (status_) {
-      case kExitFailure:
-        return EXIT_FAILURE;
-      case kExitSuccess:
-      case kRunBenchmark:
-        return EXIT_SUCCESS;
-    }
-    VIXL_UNREACHABLE();
-    return EXIT_FAILURE;
-  }
-
-  uint32_t GetRunTimeInSeconds() const { return run_time_; }
-
- private:
-  static const uint32_t kDefaultRunTime = 5;
-
-  uint32_t run_time_;
-
-  enum { kRunBenchmark, kExitSuccess, kExitFailure } status_;
-};
+#include "bench-cli.h"
 
 // Generate random, but valid (and simulatable) instruction sequences.
 //
@@ -0,0 +1,96 @@
+// Copyright 2026, VIXL authors
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//   * Redistributions of source code must retain the above copyright notice,
+//     this list of conditions and the following disclaimer.
+//   * Redistributions in binary form must reproduce the above copyright notice,
+//     this list of conditions and the following disclaimer in the documentation
+//     and/or other materials provided with the distribution.
+//   * Neither the name of ARM Limited nor the names of its contributors may be
+//     used to endorse or promote products derived from this software without
+//     specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS CONTRIBUTORS "AS IS" AND
+// ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+// WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include <vector>
+
+#include "globals-vixl.h"
+
+#include "aarch64/instructions-aarch64.h"
+#include "aarch64/macro-assembler-aarch64.h"
+
+#include "bench-utils.h"
+
+using namespace vixl;
+using namespace vixl::aarch64;
+
+// This program measures how the cost of tracking unresolved branches in the
+// veneer pool scales with the number of branches. For each size, it emits that
+// many forward branches, each to its own label, and then binds the labels in
+// reverse order. The time per branch should stay roughly constant as the
+// number of branches grows.
+//
+// Conditional branches are used because their range is large enough that no
+// veneers are needed, so only the tracking cost is measured.
+static void EmitBranches(MacroAssembler* masm, std::vector<Label>* labels) {
+  masm->Reset();
+  for (size_t i = 0; i < labels->size(); i++) {
+    masm->B(eq, &(*labels)[i]);
+  }
+  for (size_t i = labels->size(); i > 0; i--) {
+    masm->Bind(&(*labels)[i - 1]);
+  }
+  masm->FinalizeCode();
+}
+
+int main(int argc, char* argv[]) {
+  BenchCLI cli(argc, argv);
+  if (cli.ShouldExitEarly()) return cli.GetExitCode();
+
+  static const size_t kBranchCounts[] = {1 * KBytes,
+                                         4 * KBytes,
+                                         16 * KBytes,
+                                         64 * KBytes};
+  static const size_t kNumberOfSizes =
+      sizeof(kBranchCounts) / sizeof(kBranchCounts[0]);
+
+  // Share the run time between the sizes.
+  uint32_t run_time = cli.GetRunTimeInSeconds() / kNumberOfSizes;
+  if (run_time == 0) run_time = 1;
+
+  BenchReport report(&cli, "aarch64-veneer-pool");
+  MacroAssembler masm;
+  for (size_t i = 0; i < kNumberOfSizes; i++) {
+    size_t branch_count = kBranchCounts[i];
+
+    BenchTimer timer;
+    size_t iterations = 0;
+    do {
+      std::vector<Label> labels(branch_count);
+      EmitBranches(&masm, &labels);
+      iterations++;
+    } while (!timer.HasRunFor(run_time));
+
+    double elapsed = timer.GetElapsedSeconds();
+    report.AddColumn("branches", static_cast<uint64_t>(branch_count));
+    report.AddColumn("iterations", static_cast<uint64_t>(iterations));
+    report.AddColumn("ns_per_branch",
+                     (elapsed * 1e9) / (iterations * branch_count));
+    report.EndRow();
+  }
+  report.Finish();
+
+  return cli.GetExitCode();
+}
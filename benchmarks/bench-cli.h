@@ -0,0 +1,309 @@
+// Copyright 2019, VIXL authors
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//   * Redistributions of source code must retain the above copyright notice,
+//     this list of conditions and the following disclaimer.
+//   * Redistributions in binary form must reproduce the above copyright notice,
+//     this list of conditions and the following disclaimer in the documentation
+//     and/or other materials provided with the distribution.
+//   * Neither the name of ARM Limited nor the names of its contributors may be
+//     used to endorse or promote products derived from this software without
+//     specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS CONTRIBUTORS "AS IS" AND
+// ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+// WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef VIXL_BENCH_CLI_H_
+#define VIXL_BENCH_CLI_H_
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/time.h>
+
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "globals-vixl.h"
+
+class BenchTimer {
+ public:
+  BenchTimer() { gettimeofday(&start_, NULL); }
+
+  double GetElapsedSeconds() const {
+    timeval elapsed = GetElapsed();
+    double sec = elapsed.tv_sec;
+    double usec = elapsed.tv_usec;
+    return sec + (usec / 1000000.0);
+  }
+
+  bool HasRunFor(uint32_t seconds) {
+    timeval elapsed = GetElapsed();
+    VIXL_ASSERT(elapsed.tv_sec >= 0);
+    return static_cast<uint64_t>(elapsed.tv_sec) >= seconds;
+  }
+
+ private:
+  timeval GetElapsed() const {
+    VIXL_ASSERT(timerisset(&start_));
+    timeval now, elapsed;
+    gettimeofday(&now, NULL);
+    timersub(&now, &start_, &elapsed);
+    return elapsed;
+  }
+
+  timeval start_;
+};
+
+// Provide a standard command-line interface for all benchmarks.
+class BenchCLI {
+ public:
+  enum OutputFormat { kText, kCSV, kJSON };
+
+  // Set default values.
+  BenchCLI(int argc, char* argv[])
+      : run_time_(kDefaultRunTime),
+        format_(kText),
+        status_(kRunBenchmark) {
+    const char* run_time_arg = NULL;
+    for (int i = 1; i < argc; i++) {
+      if ((strcmp(argv[i], "-h") == 0) || (strcmp(argv[i], "--help") == 0)) {
+        PrintUsage(argv[0]);
+        status_ = kExitSuccess;
+        return;
+      }
+    }
+
+    for (int i = 1; i < argc; i++) {
+      if (strcmp(argv[i], "--csv") == 0) {
+        format_ = kCSV;
+      } else if (strcmp(argv[i], "--json") == 0) {
+        format_ = kJSON;
+      } else if (run_time_arg == NULL) {
+        run_time_arg = argv[i];
+      } else {
+        PrintUsage(argv[0]);
+        status_ = kExitFailure;
+        return;
+      }
+    }
+
+    // Use the default run time.
+    if (run_time_arg == NULL) return;
+
+    char* end;
+    unsigned long run_time =  // NOLINT(runtime/int)
+        strtoul(run_time_arg, &end, 0);
+    if ((end == run_time_arg) || (run_time > UINT32_MAX)) {
+      PrintUsage(argv[0]);
+      status_ = kExitFailure;
+      return;
+    }
+    run_time_ = static_cast<uint32_t>(run_time);
+  }
+
+  void PrintUsage(char* name) {
+    printf("USAGE: %s [OPTIONS]... [RUN_TIME]\n", name);
+    printf("\n");
+    printf("Run a single VIXL benchmark for approximately RUN_TIME seconds,\n");
+    printf("or %" PRIu32 " seconds if unspecified.\n", kDefaultRunTime);
+    printf("\n");
+#ifdef VIXL_DEBUG
+    printf("This is a DEBUG build. VIXL's assertions will be enabled, and\n");
+    printf("extra debug information may be printed. The benchmark results\n");
+    printf("are not representative of expected VIXL deployments.\n");
+    printf("\n");
+#endif
+    printf("OPTIONS:\n");
+    printf("\n");
+    printf("    -h, --help\n");
+    printf("        Print this help message.\n");
+    printf("    --csv\n");
+    printf("        Print the results as comma-separated values.\n");
+    printf("    --json\n");
+    printf("        Print the results as a JSON object.\n");
+  }
+
+  void PrintResults(uint64_t iterations, double elapsed_seconds) {
+    double score = iterations / elapsed_seconds;
+    switch (format_) {
+      case kText:
+        printf("%g iteration%s per second (%" PRIu64 " / %g)",
+               score,
+               (score == 1.0) ? "" : "s",
+               iterations,
+               elapsed_seconds);
+#ifdef VIXL_DEBUG
+        printf(" [Warning: DEBUG build]");
+#endif
+        printf("\n");
+        break;
+      case kCSV:
+        printf("iterations,seconds,iterations_per_second\n");
+        printf("%" PRIu64 ",%g,%g\n", iterations, elapsed_seconds, score);
+        break;
+      case kJSON:
+        printf("{\"iterations\": %" PRIu64
+               ", \"seconds\": %g, \"iterations_per_second\": %g, "
+               "\"debug\": %s}\n",
+               iterations,
+               elapsed_seconds,
+               score,
+               IsDebugBuild() ? "true" : "false");
+        break;
+    }
+  }
+
+  bool ShouldExitEarly() const {
+    switch (status_) {
+      case kRunBenchmark:
+        return false;
+      case kExitFailure:
+      case kExitSuccess:
+        return true;
+    }
+    VIXL_UNREACHABLE();
+    return true;
+  }
+
+  int GetExitCode() const {
+    switch (status_) {
+      case kExitFailure:
+        return EXIT_FAILURE;
+      case kExitSuccess:
+      case kRunBenchmark:
+        return EXIT_SUCCESS;
+    }
+    VIXL_UNREACHABLE();
+    return EXIT_FAILURE;
+  }
+
+  uint32_t GetRunTimeInSeconds() const { return run_time_; }
+  OutputFormat GetOutputFormat() const { return format_; }
+
+  static bool IsDebugBuild() {
+#ifdef VIXL_DEBUG
+    return true;
+#else
+    return false;
+#endif
+  }
+
+ private:
+  static const uint32_t kDefaultRunTime = 5;
+
+  uint32_t run_time_;
+  OutputFormat format_;
+
+  enum { kRunBenchmark, kExitSuccess, kExitFailure } status_;
+};
+
+// Print a table of results, one row per benchmark configuration, in the format
+// selected on the command line. Every row must have the same columns, in the
+// same order.
+//
+//   BenchReport report(&cli, "literal-pool");
+//   report.AddColumn("literals", 1024);
+//   report.AddColumn("ns_per_instruction", 12.5);
+//   report.EndRow();
+//   ...
+//   report.Finish();
+class BenchReport {
+ public:
+  BenchReport(const BenchCLI* cli, const char* name)
+      : format_(cli->GetOutputFormat()), name_(name), rows_(0) {}
+  ~BenchReport() { VIXL_ASSERT(rows_ == 0); }
+
+  void AddColumn(const char* key, uint64_t value) {
+    char buffer[32];
+    snprintf(buffer, sizeof(buffer), "%" PRIu64, value);
+    columns_.push_back(std::make_pair(std::string(key), std::string(buffer)));
+  }
+  void AddColumn(const char* key, double value) {
+    char buffer[32];
+    snprintf(buffer, sizeof(buffer), "%g", value);
+    columns_.push_back(std::make_pair(std::string(key), std::string(buffer)));
+  }
+  void AddColumn(const char* key, const char* value) {
+    std::string quoted = (format_ == BenchCLI::kJSON)
+                             ? ("\"" + std::string(value) + "\"")
+                             : std::string(value);
+    columns_.push_back(std::make_pair(std::string(key), quoted));
+  }
+
+  void EndRow() {
+    VIXL_ASSERT(!columns_.empty());
+    switch (format_) {
+      case BenchCLI::kText:
+        for (size_t i = 0; i < columns_.size(); i++) {
+          printf("%s%s=%s",
+                 (i == 0) ? "" : " ",
+                 columns_[i].first.c_str(),
+                 columns_[i].second.c_str());
+        }
+        printf("\n");
+        break;
+      case BenchCLI::kCSV:
+        if (rows_ == 0) {
+          printf("benchmark");
+          for (size_t i = 0; i < columns_.size(); i++) {
+            printf(",%s", columns_[i].first.c_str());
+          }
+          printf("\n");
+        }
+        printf("%s", name_);
+        for (size_t i = 0; i < columns_.size(); i++) {
+          printf(",%s", columns_[i].second.c_str());
+        }
+        printf("\n");
+        break;
+      case BenchCLI::kJSON:
+        printf((rows_ == 0) ? "{\"benchmark\": \"%s\", \"debug\": %s, "
+                              "\"results\": [\n"
+                            : ",\n",
+               name_,
+               BenchCLI::IsDebugBuild() ? "true" : "false");
+        printf("  {");
+        for (size_t i = 0; i < columns_.size(); i++) {
+          printf("%s\"%s\": %s",
+                 (i == 0) ? "" : ", ",
+                 columns_[i].first.c_str(),
+                 columns_[i].second.c_str());
+        }
+        printf("}");
+        break;
+    }
+    fflush(stdout);
+    columns_.clear();
+    rows_++;
+  }
+
+  void Finish() {
+    VIXL_ASSERT(columns_.empty());
+    if ((format_ == BenchCLI::kJSON) && (rows_ > 0)) printf("\n]}\n");
+#ifdef VIXL_DEBUG
+    if (format_ == BenchCLI::kText) printf("[Warning: DEBUG build]\n");
+#endif
+    rows_ = 0;
+  }
+
+ private:
+  BenchCLI::OutputFormat format_;
+  const char* name_;
+  std::vector<std::pair<std::string, std::string> > columns_;
+  size_t rows_;
+};
+
+#endif  // VIXL_BENCH_CLI_H_
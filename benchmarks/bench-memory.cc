@@ -0,0 +1,111 @@
+// Copyright 2026, VIXL authors
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//   * Redistributions of source code must retain the above copyright notice,
+//     this list of conditions and the following disclaimer.
+//   * Redistributions in binary form must reproduce the above copyright notice,
+//     this list of conditions and the following disclaimer in the documentation
+//     and/or other materials provided with the distribution.
+//   * Neither the name of ARM Limited nor the names of its contributors may be
+//     used to endorse or promote products derived from this software without
+//     specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS CONTRIBUTORS "AS IS" AND
+// ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+// WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include <stdlib.h>
+
+#include <new>
+
+#include "globals-vixl.h"
+
+#include "bench-memory.h"
+
+// Store the size in front of each allocation, keeping the result suitably
+// aligned for any type.
+static const size_t kHeaderSize = 2 * sizeof(void*);
+
+size_t BenchMemory::current_bytes_ = 0;
+size_t BenchMemory::peak_bytes_ = 0;
+size_t BenchMemory::base_bytes_ = 0;
+
+
+void* BenchMemory::Allocate(size_t size) {
+  void* block = malloc(size + kHeaderSize);
+  if (block == NULL) return NULL;
+  *static_cast<size_t*>(block) = size;
+  current_bytes_ += size;
+  if (current_bytes_ > peak_bytes_) peak_bytes_ = current_bytes_;
+  return static_cast<char*>(block) + kHeaderSize;
+}
+
+
+void BenchMemory::Free(void* pointer) {
+  if (pointer == NULL) return;
+  // Use integer arithmetic, since the compiler cannot see that `pointer` was
+  // derived from a larger block.
+  void* block = reinterpret_cast<void*>(reinterpret_cast<uintptr_t>(pointer) -
+                                        kHeaderSize);
+  current_bytes_ -= *static_cast<size_t*>(block);
+  free(block);
+}
+
+
+class BenchArenaChunkAllocator : public vixl::ArenaChunkAllocator {
+ public:
+  virtual void* AllocateChunk(size_t size) VIXL_OVERRIDE {
+    return BenchMemory::Allocate(size);
+  }
+  virtual void FreeChunk(void* chunk, size_t) VIXL_OVERRIDE {
+    BenchMemory::Free(chunk);
+  }
+};
+
+
+vixl::ArenaChunkAllocator* BenchMemory::GetArenaChunkAllocator() {
+  static BenchArenaChunkAllocator allocator;
+  return &allocator;
+}
+
+
+void* operator new(size_t size) {
+  void* result = BenchMemory::Allocate(size);
+  VIXL_CHECK(result != NULL);
+  return result;
+}
+void* operator new[](size_t size) {
+  void* result = BenchMemory::Allocate(size);
+  VIXL_CHECK(result != NULL);
+  return result;
+}
+void* operator new(size_t size, const std::nothrow_t&) noexcept {
+  return BenchMemory::Allocate(size);
+}
+void* operator new[](size_t size, const std::nothrow_t&) noexcept {
+  return BenchMemory::Allocate(size);
+}
+void operator delete(void* pointer) noexcept { BenchMemory::Free(pointer); }
+void operator delete[](void* pointer) noexcept { BenchMemory::Free(pointer); }
+void operator delete(void* pointer, size_t) noexcept {
+  BenchMemory::Free(pointer);
+}
+void operator delete[](void* pointer, size_t) noexcept {
+  BenchMemory::Free(pointer);
+}
+void operator delete(void* pointer, const std::nothrow_t&) noexcept {
+  BenchMemory::Free(pointer);
+}
+void operator delete[](void* pointer, const std::nothrow_t&) noexcept {
+  BenchMemory::Free(pointer);
+}
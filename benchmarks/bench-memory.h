@@ -0,0 +1,69 @@
+// Copyright 2026, VIXL authors
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//   * Redistributions of source code must retain the above copyright notice,
+//     this list of conditions and the following disclaimer.
+//   * Redistributions in binary form must reproduce the above copyright notice,
+//     this list of conditions and the following disclaimer in the documentation
+//     and/or other materials provided with the distribution.
+//   * Neither the name of ARM Limited nor the names of its contributors may be
+//     used to endorse or promote products derived from this software without
+//     specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS CONTRIBUTORS "AS IS" AND
+// ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+// WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef VIXL_BENCH_MEMORY_H_
+#define VIXL_BENCH_MEMORY_H_
+
+#include <cstddef>
+
+#include "arena-vixl.h"
+
+// Track the heap memory allocated through `operator new`, so that benchmarks
+// can report the peak memory used by VIXL's bookkeeping structures (pools,
+// label link sets, etc.). Code buffers are allocated with mmap (or malloc) and
+// are not included.
+//
+// Arenas allocate their chunks with malloc, so they are only counted if they
+// use GetArenaChunkAllocator(), for example through
+// `masm.GetArena()->SetChunkAllocator(...)`.
+//
+// bench-memory.cc replaces the global allocation functions, so it is only
+// linked into the benchmarks that use this class.
+class BenchMemory {
+ public:
+  // Start a new measurement. The peak is reset, and subsequent peaks are
+  // reported relative to the current usage.
+  static void StartMeasurement() {
+    base_bytes_ = current_bytes_;
+    peak_bytes_ = current_bytes_;
+  }
+
+  // The peak usage since the last StartMeasurement().
+  static size_t GetPeakBytes() { return peak_bytes_ - base_bytes_; }
+
+  static void* Allocate(size_t size);
+  static void Free(void* pointer);
+
+  // An arena chunk allocator that allocates through Allocate() and Free().
+  static vixl::ArenaChunkAllocator* GetArenaChunkAllocator();
+
+ private:
+  static size_t current_bytes_;
+  static size_t peak_bytes_;
+  static size_t base_bytes_;
+};
+
+#endif  // VIXL_BENCH_MEMORY_H_
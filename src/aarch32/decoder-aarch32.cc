@@ -0,0 +1,74 @@
+// Copyright 2026, VIXL authors
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//   * Redistributions of source code must retain the above copyright notice,
+//     this list of conditions and the following disclaimer.
+//   * Redistributions in binary form must reproduce the above copyright notice,
+//     this list of conditions and the following disclaimer in the documentation
+//     and/or other materials provided with the distribution.
+//   * Neither the name of ARM Limited nor the names of its contributors may be
+//     used to endorse or promote products derived from this software without
+//     specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS CONTRIBUTORS "AS IS" AND
+// ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+// WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+extern "C" {
+#include <stdint.h>
+}
+
+#include "utils-vixl.h"
+#include "aarch32/decoder-aarch32.h"
+#include "aarch32/decoder-tables-aarch32.h"
+
+namespace vixl {
+namespace aarch32 {
+
+A32Encoding IdentifyA32Encoding(uint32_t instr) {
+  uint32_t encoding = LookUpDecodeTable(kA32DecodeTable,
+                                        ArrayLength(kA32DecodeTable),
+                                        kA32DecodeTableTests,
+                                        ArrayLength(kA32DecodeTableTests),
+                                        instr);
+  VIXL_ASSERT(encoding < kA32EncodingCount);
+  return static_cast<A32Encoding>(encoding);
+}
+
+
+T32Encoding IdentifyT32Encoding(uint32_t instr) {
+  uint32_t encoding = LookUpDecodeTable(kT32DecodeTable,
+                                        ArrayLength(kT32DecodeTable),
+                                        kT32DecodeTableTests,
+                                        ArrayLength(kT32DecodeTableTests),
+                                        instr);
+  VIXL_ASSERT(encoding < kT32EncodingCount);
+  return static_cast<T32Encoding>(encoding);
+}
+
+
+const char* GetA32EncodingName(A32Encoding encoding) {
+  VIXL_STATIC_ASSERT(ArrayLength(kA32EncodingNames) == kA32EncodingCount);
+  VIXL_ASSERT(encoding < kA32EncodingCount);
+  return kA32EncodingNames[encoding];
+}
+
+
+const char* GetT32EncodingName(T32Encoding encoding) {
+  VIXL_STATIC_ASSERT(ArrayLength(kT32EncodingNames) == kT32EncodingCount);
+  VIXL_ASSERT(encoding < kT32EncodingCount);
+  return kT32EncodingNames[encoding];
+}
+
+}  // namespace aarch32
+}  // namespace vixl
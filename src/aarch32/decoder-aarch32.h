@@ -0,0 +1,64 @@
+// Copyright 2026, VIXL authors
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//   * Redistributions of source code must retain the above copyright notice,
+//     this list of conditions and the following disclaimer.
+//   * Redistributions in binary form must reproduce the above copyright notice,
+//     this list of conditions and the following disclaimer in the documentation
+//     and/or other materials provided with the distribution.
+//   * Neither the name of ARM Limited nor the names of its contributors may be
+//     used to endorse or promote products derived from this software without
+//     specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS CONTRIBUTORS "AS IS" AND
+// ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+// WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef VIXL_AARCH32_DECODER_AARCH32_H_
+#define VIXL_AARCH32_DECODER_AARCH32_H_
+
+extern "C" {
+#include <stdint.h>
+}
+
+#include "decode-table-vixl.h"
+#include "globals-vixl.h"
+#include "aarch32/decoder-encodings-aarch32.h"
+
+namespace vixl {
+namespace aarch32 {
+
+// The A32 and T32 instruction sets are described by decode graphs,
+// kA32DecodeMapping and kT32DecodeMapping, in the same form as the AArch64
+// decode graph. tools/generate_decoder_tables.py compiles each graph into a
+// static table of DecodeTableEntry values, and gives every encoding that the
+// graph names a compact ID, listed in the A32Encoding and T32Encoding enums.
+// The disassembler uses these IDs to choose how to print an instruction, and
+// they are meant to be shared by any other AArch32 instruction consumer.
+
+// Identify the encoding of an A32 instruction.
+A32Encoding IdentifyA32Encoding(uint32_t instr);
+
+// Identify the encoding of a T32 instruction. 16-bit instructions must be in
+// the top half of `instr`, as passed to Disassembler::DecodeT32().
+T32Encoding IdentifyT32Encoding(uint32_t instr);
+
+// Return the name of an encoding, as used in the decode graphs. For example,
+// "add_a1".
+const char* GetA32EncodingName(A32Encoding encoding);
+const char* GetT32EncodingName(T32Encoding encoding);
+
+}  // namespace aarch32
+}  // namespace vixl
+
+#endif  // VIXL_AARCH32_DECODER_AARCH32_H_
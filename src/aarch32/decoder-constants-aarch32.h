@@ -0,0 +1,21735 @@
+// Copyright 2026, VIXL authors
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//   * Redistributions of source code must retain the above copyright notice,
+//     this list of conditions and the following disclaimer.
+//   * Redistributions in binary form must reproduce the above copyright notice,
+//     this list of conditions and the following disclaimer in the documentation
+//     and/or other materials provided with the distribution.
+//   * Neither the name of ARM Limited nor the names of its contributors may be
+//     used to endorse or promote products derived from this software without
+//     specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS CONTRIBUTORS "AS IS" AND
+// ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+// WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+namespace vixl {
+namespace aarch32 {
+
+// Construct a uint32_t encoded bit pattern from a string literal, as for
+// AArch64. See src/aarch64/decoder-constants-aarch64.h for the encoding.
+constexpr uint32_t str_to_two_bit_pattern(const char* x, size_t s, uint32_t a) {
+  if (s == 0) return a;
+  uint32_t r = (x[0] == 'x') ? 2 : (x[0] - '0');
+  return str_to_two_bit_pattern(x + 1, s - 1, (a << 2) | r);
+}
+
+constexpr uint32_t operator"" _b(const char* x, size_t s) {
+  return str_to_two_bit_pattern(x, s, DecodePattern::kEndOfPattern);
+}
+
+// These decode graphs describe the A32 and T32 instruction sets. They were
+// derived from the decision trees that the AArch32 disassembler used before
+// it became table-driven.
+//
+// Each node samples some bits of the instruction, and the first pattern that
+// matches names the next node. Node names start with '_', and other names are
+// encodings. The encoding names end in the encoding tag used by the
+// architecture reference manual (for example "vadd_a1"), with a numeric suffix
+// where several variants of an encoding need different handling. Instructions
+// that match no pattern are unallocated.
+//
+// For T32, 16-bit instructions are placed in the top half of the sampled word.
+
+// clang-format off
+static const DecodeMapping kA32DecodeMapping[] = {
+  { "Root",
+    {31, 30, 29, 28},
+    { {"1111"_b, "_f0000000"},
+      {"xxxx"_b, "_f0000000_577"},
+    },
+  },
+
+  { "_f0000000",
+    {27, 26, 25},
+    { {"000"_b, "_f0000000_1"},
+      {"001"_b, "_f0000000_7"},
+      {"010"_b, "_f0000000_404"},
+      {"011"_b, "_f0000000_558"},
+      {"100"_b, "_f0000000_565"},
+      {"101"_b, "blx_a2"},
+      {"111"_b, "_f0000000_566"},
+      {"xxx"_b, "unallocated"},
+    },
+  },
+
+  { "_f0000000_1",
+    {24, 23, 22, 21, 20, 16, 5},
+    { {"1000000"_b, "_f0000000_2"},
+      {"1000010"_b, "_f0000000_6"},
+      {"xxxxxxx"_b, "unallocated"},
+    },
+  },
+
+  { "_f0000000_2",
+    {19, 18, 17},
+    { {"001"_b, "_f0000000_3"},
+      {"100"_b, "_f0000000_4"},
+      {"101"_b, "cpsie_a1"},
+      {"110"_b, "_f0000000_5"},
+      {"111"_b, "cpsid_a1"},
+      {"xxx"_b, "unallocated"},
+    },
+  },
+
+  { "_f0000000_3",
+    {8, 7, 6},
+    { {"000"_b, "cps_a1"},
+      {"xxx"_b, "unallocated"},
+    },
+  },
+
+  { "_f0000000_4",
+    {4, 3, 2, 1, 0},
+    { {"00000"_b, "cpsie_a1"},
+      {"xxxxx"_b, "unallocated"},
+    },
+  },
+
+  { "_f0000000_5",
+    {4, 3, 2, 1, 0},
+    { {"00000"_b, "cpsid_a1"},
+      {"xxxxx"_b, "unallocated"},
+    },
+  },
+
+  { "_f0000000_6",
+    {7, 6, 4},
+    { {"000"_b, "setend_a1"},
+      {"xxx"_b, "unallocated"},
+    },
+  },
+
+  { "_f0000000_7",
+    {23, 4},
+    { {"00"_b, "_f0000000_8"},
+      {"01"_b, "_f0000000_33"},
+      {"10"_b, "_f0000000_65"},
+      {"11"_b, "_f0000000_166"},
+    },
+  },
+
+  { "_f0000000_8",
+    {11, 10, 9, 8, 6},
+    { {"00000"_b, "vhadd_d_a1"},
+      {"00001"_b, "_f0000000_1439"},
+      {"00010"_b, "vrhadd_d_a1"},
+      {"00011"_b, "_f0000000_1440"},
+      {"00100"_b, "vhsub_d_a1"},
+      {"00101"_b, "_f0000000_1441"},
+      {"00110"_b, "vcgt_d_a1"},
+      {"00111"_b, "_f0000000_1442"},
+      {"01000"_b, "vshl_d_a1"},
+      {"01001"_b, "_f0000000_1443"},
+      {"01010"_b, "vrshl_d_a1"},
+      {"01011"_b, "_f0000000_1444"},
+      {"01100"_b, "vmax_d_a1"},
+      {"01101"_b, "_f0000000_1445"},
+      {"01110"_b, "vabd_d_a1"},
+      {"01111"_b, "_f0000000_1446"},
+      {"10000"_b, "_f0000000_9"},
+      {"10001"_b, "_f0000000_10"},
+      {"10010"_b, "_f0000000_11"},
+      {"10011"_b, "_f0000000_12"},
+      {"10100"_b, "vpmax_a1"},
+      {"10110"_b, "_f0000000_13"},
+      {"10111"_b, "_f0000000_14"},
+      {"11001"_b, "_f0000000_15"},
+      {"11010"_b, "_f0000000_16"},
+      {"11011"_b, "_f0000000_17"},
+      {"11100"_b, "_f0000000_21"},
+      {"11101"_b, "_f0000000_24"},
+      {"11110"_b, "_f0000000_29"},
+      {"11111"_b, "_f0000000_30"},
+      {"xxxxx"_b, "unallocated"},
+    },
+  },
+
+  { "_f0000000_1439",
+    {16, 12, 0},
+    { {"000"_b, "vhadd_q_a1"},
+    },
+  },
+
+  { "_f0000000_1440",
+    {16, 12, 0},
+    { {"000"_b, "vrhadd_q_a1"},
+    },
+  },
+
+  { "_f0000000_1441",
+    {16, 12, 0},
+    { {"000"_b, "vhsub_q_a1"},
+    },
+  },
+
+  { "_f0000000_1442",
+    {16, 12, 0},
+    { {"000"_b, "vcgt_q_a1"},
+    },
+  },
+
+  { "_f0000000_1443",
+    {16, 12, 0},
+    { {"000"_b, "vshl_q_a1"},
+    },
+  },
+
+  { "_f0000000_1444",
+    {16, 12, 0},
+    { {"000"_b, "vrshl_q_a1"},
+    },
+  },
+
+  { "_f0000000_1445",
+    {16, 12, 0},
+    { {"000"_b, "vmax_q_a1"},
+    },
+  },
+
+  { "_f0000000_1446",
+    {16, 12, 0},
+    { {"000"_b, "vabd_q_a1"},
+    },
+  },
+
+  { "_f0000000_9",
+    {24},
+    { {"0"_b, "vadd_d_a1"},
+      {"1"_b, "vsub_d_a1"},
+    },
+  },
+
+  { "_f0000000_10",
+    {24},
+    { {"0"_b, "_f0000000_1447"},
+      {"1"_b, "_f0000000_1448"},
+    },
+  },
+
+  { "_f0000000_1447",
+    {16, 12, 0},
+    { {"000"_b, "vadd_q_a1"},
+    },
+  },
+
+  { "_f0000000_1448",
+    {16, 12, 0},
+    { {"000"_b, "vsub_q_a1"},
+    },
+  },
+
+  { "_f0000000_11",
+    {24},
+    { {"0"_b, "vmla_d_a1"},
+      {"1"_b, "vmls_d_a1"},
+    },
+  },
+
+  { "_f0000000_12",
+    {24},
+    { {"0"_b, "_f0000000_1449"},
+      {"1"_b, "_f0000000_1450"},
+    },
+  },
+
+  { "_f0000000_1449",
+    {16, 12, 0},
+    { {"000"_b, "vmla_q_a1"},
+    },
+  },
+
+  { "_f0000000_1450",
+    {16, 12, 0},
+    { {"000"_b, "vmls_q_a1"},
+    },
+  },
+
+  { "_f0000000_13",
+    {24},
+    { {"0"_b, "vqdmulh_d_a1"},
+      {"1"_b, "vqrdmulh_d_a1"},
+    },
+  },
+
+  { "_f0000000_14",
+    {24},
+    { {"0"_b, "_f0000000_1451"},
+      {"1"_b, "_f0000000_1452"},
+    },
+  },
+
+  { "_f0000000_1451",
+    {16, 12, 0},
+    { {"000"_b, "vqdmulh_q_a1"},
+    },
+  },
+
+  { "_f0000000_1452",
+    {16, 12, 0},
+    { {"000"_b, "vqrdmulh_q_a1"},
+    },
+  },
+
+  { "_f0000000_15",
+    {24, 21, 20},
+    { {"000"_b, "sha1c_a1"},
+      {"001"_b, "sha1p_a1"},
+      {"010"_b, "sha1m_a1"},
+      {"011"_b, "sha1su0_a1"},
+      {"100"_b, "sha256h_a1"},
+      {"101"_b, "sha256h2_a1"},
+      {"110"_b, "sha256su1_a1"},
+      {"xxx"_b, "unallocated"},
+    },
+  },
+
+  { "_f0000000_16",
+    {24, 21, 20},
+    { {"000"_b, "vadd_f32_d_a1"},
+      {"010"_b, "vsub_f32_d_a1"},
+      {"100"_b, "vpadd_f32_a1"},
+      {"110"_b, "vabd_f32_d_a1"},
+      {"xxx"_b, "unallocated"},
+    },
+  },
+
+  { "_f0000000_17",
+    {24, 21, 20},
+    { {"000"_b, "_f0000000_18"},
+      {"010"_b, "_f0000000_19"},
+      {"110"_b, "_f0000000_20"},
+      {"xxx"_b, "unallocated"},
+    },
+  },
+
+  { "_f0000000_18",
+    {12},
+    { {"0"_b, "_f0000000_1453"},
+      {"x"_b, "unallocated"},
+    },
+  },
+
+  { "_f0000000_1453",
+    {16, 0},
+    { {"00"_b, "vadd_f32_q_a1"},
+    },
+  },
+
+  { "_f0000000_19",
+    {12},
+    { {"0"_b, "_f0000000_1454"},
+      {"x"_b, "unallocated"},
+    },
+  },
+
+  { "_f0000000_1454",
+    {16, 0},
+    { {"00"_b, "vsub_f32_q_a1"},
+    },
+  },
+
+  { "_f0000000_20",
+    {12},
+    { {"0"_b, "_f0000000_1455"},
+      {"x"_b, "unallocated"},
+    },
+  },
+
+  { "_f0000000_1455",
+    {16, 0},
+    { {"00"_b, "vabd_f32_q_a1"},
+    },
+  },
+
+  { "_f0000000_21",
+    {24, 21},
+    { {"00"_b, "vceq_d_a2"},
+      {"10"_b, "_f0000000_22"},
+      {"11"_b, "_f0000000_23"},
+      {"xx"_b, "unallocated"},
+    },
+  },
+
+  { "_f0000000_22",
+    {20},
+    { {"0"_b, "vcge_d_a2"},
+      {"x"_b, "unallocated"},
+    },
+  },
+
+  { "_f0000000_23",
+    {20},
+    { {"0"_b, "vcgt_d_a2"},
+      {"x"_b, "unallocated"},
+    },
+  },
+
+  { "_f0000000_24",
+    {24, 21},
+    { {"00"_b, "_f0000000_1456"},
+      {"10"_b, "_f0000000_25"},
+      {"11"_b, "_f0000000_27"},
+      {"xx"_b, "unallocated"},
+    },
+  },
+
+  { "_f0000000_1456",
+    {16, 12, 0},
+    { {"000"_b, "vceq_q_a2"},
+    },
+  },
+
+  { "_f0000000_25",
+    {20},
+    { {"0"_b, "_f0000000_26"},
+      {"x"_b, "unallocated"},
+    },
+  },
+
+  { "_f0000000_26",
+    {12},
+    { {"0"_b, "_f0000000_1457"},
+      {"x"_b, "unallocated"},
+    },
+  },
+
+  { "_f0000000_1457",
+    {16, 0},
+    { {"00"_b, "vcge_q_a2"},
+    },
+  },
+
+  { "_f0000000_27",
+    {20},
+    { {"0"_b, "_f0000000_28"},
+      {"x"_b, "unallocated"},
+    },
+  },
+
+  { "_f0000000_28",
+    {12},
+    { {"0"_b, "_f0000000_1458"},
+      {"x"_b, "unallocated"},
+    },
+  },
+
+  { "_f0000000_1458",
+    {16, 0},
+    { {"00"_b, "vcgt_q_a2"},
+    },
+  },
+
+  { "_f0000000_29",
+    {24, 21, 20},
+    { {"000"_b, "vmax_f32_d_a1"},
+      {"010"_b, "vmin_f32_d_a1"},
+      {"100"_b, "vpmax_f32_a1"},
+      {"110"_b, "vpmin_f32_a1"},
+      {"xxx"_b, "unallocated"},
+    },
+  },
+
+  { "_f0000000_30",
+    {24, 21, 20},
+    { {"000"_b, "_f0000000_31"},
+      {"010"_b, "_f0000000_32"},
+      {"xxx"_b, "unallocated"},
+    },
+  },
+
+  { "_f0000000_31",
+    {12},
+    { {"0"_b, "_f0000000_1459"},
+      {"x"_b, "unallocated"},
+    },
+  },
+
+  { "_f0000000_1459",
+    {16, 0},
+    { {"00"_b, "vmax_f32_q_a1"},
+    },
+  },
+
+  { "_f0000000_32",
+    {12},
+    { {"0"_b, "_f0000000_1460"},
+      {"x"_b, "unallocated"},
+    },
+  },
+
+  { "_f0000000_1460",
+    {16, 0},
+    { {"00"_b, "vmin_f32_q_a1"},
+    },
+  },
+
+  { "_f0000000_33",
+    {11, 10, 9, 8, 6},
+    { {"00000"_b, "vqadd_d_a1"},
+      {"00001"_b, "_f0000000_1461"},
+      {"00010"_b, "_f0000000_34"},
+      {"00011"_b, "_f0000000_35"},
+      {"00100"_b, "vqsub_d_a1"},
+      {"00101"_b, "_f0000000_1462"},
+      {"00110"_b, "vcge_d_a1"},
+      {"00111"_b, "_f0000000_1463"},
+      {"01000"_b, "vqshl_d_a1"},
+      {"01001"_b, "_f0000000_1464"},
+      {"01010"_b, "vqrshl_d_a1"},
+      {"01011"_b, "_f0000000_1465"},
+      {"01100"_b, "vmin_d_a1"},
+      {"01101"_b, "_f0000000_1466"},
+      {"01110"_b, "vaba_d_a1"},
+      {"01111"_b, "_f0000000_1467"},
+      {"10000"_b, "_f0000000_43"},
+      {"10001"_b, "_f0000000_44"},
+      {"10010"_b, "vmul_d_a1"},
+      {"10011"_b, "_f0000000_1468"},
+      {"10100"_b, "vpmin_a1"},
+      {"10110"_b, "_f0000000_45"},
+      {"11000"_b, "_f0000000_46"},
+      {"11001"_b, "_f0000000_47"},
+      {"11010"_b, "_f0000000_50"},
+      {"11011"_b, "_f0000000_51"},
+      {"11100"_b, "_f0000000_55"},
+      {"11101"_b, "_f0000000_56"},
+      {"11110"_b, "_f0000000_59"},
+      {"11111"_b, "_f0000000_60"},
+      {"xxxxx"_b, "unallocated"},
+    },
+  },
+
+  { "_f0000000_1461",
+    {16, 12, 0},
+    { {"000"_b, "vqadd_q_a1"},
+    },
+  },
+
+  { "_f0000000_1462",
+    {16, 12, 0},
+    { {"000"_b, "vqsub_q_a1"},
+    },
+  },
+
+  { "_f0000000_1463",
+    {16, 12, 0},
+    { {"000"_b, "vcge_q_a1"},
+    },
+  },
+
+  { "_f0000000_1464",
+    {16, 12, 0},
+    { {"000"_b, "vqshl_q_a1"},
+    },
+  },
+
+  { "_f0000000_1465",
+    {16, 12, 0},
+    { {"000"_b, "vqrshl_q_a1"},
+    },
+  },
+
+  { "_f0000000_1466",
+    {16, 12, 0},
+    { {"000"_b, "vmin_q_a1"},
+    },
+  },
+
+  { "_f0000000_1467",
+    {16, 12, 0},
+    { {"000"_b, "vaba_q_a1"},
+    },
+  },
+
+  { "_f0000000_1468",
+    {16, 12, 0},
+    { {"000"_b, "vmul_q_a1"},
+    },
+  },
+
+  { "_f0000000_34",
+    {24, 21, 20},
+    { {"000"_b, "vand_d_a1"},
+      {"001"_b, "vbic_d_a1"},
+      {"010"_b, "vmov_d_a1"},
+      {"011"_b, "vorn_d_a1"},
+      {"100"_b, "veor_d_a1"},
+      {"101"_b, "vbsl_d_a1"},
+      {"110"_b, "vbit_d_a1"},
+      {"111"_b, "vbif_d_a1"},
+    },
+  },
+
+  { "_f0000000_35",
+    {24, 21, 20},
+    { {"000"_b, "_f0000000_36"},
+      {"001"_b, "_f0000000_37"},
+      {"010"_b, "_f0000000_1469"},
+      {"011"_b, "_f0000000_38"},
+      {"100"_b, "_f0000000_39"},
+      {"101"_b, "_f0000000_40"},
+      {"110"_b, "_f0000000_41"},
+      {"111"_b, "_f0000000_42"},
+    },
+  },
+
+  { "_f0000000_1469",
+    {16, 12, 0},
+    { {"000"_b, "vmov_q_a1"},
+    },
+  },
+
+  { "_f0000000_36",
+    {12},
+    { {"0"_b, "_f0000000_1470"},
+      {"x"_b, "unallocated"},
+    },
+  },
+
+  { "_f0000000_1470",
+    {16, 0},
+    { {"00"_b, "vand_q_a1"},
+    },
+  },
+
+  { "_f0000000_37",
+    {12},
+    { {"0"_b, "_f0000000_1471"},
+      {"x"_b, "unallocated"},
+    },
+  },
+
+  { "_f0000000_1471",
+    {16, 0},
+    { {"00"_b, "vbic_q_a1"},
+    },
+  },
+
+  { "_f0000000_38",
+    {12},
+    { {"0"_b, "_f0000000_1472"},
+      {"x"_b, "unallocated"},
+    },
+  },
+
+  { "_f0000000_1472",
+    {16, 0},
+    { {"00"_b, "vorn_q_a1"},
+    },
+  },
+
+  { "_f0000000_39",
+    {12},
+    { {"0"_b, "_f0000000_1473"},
+      {"x"_b, "unallocated"},
+    },
+  },
+
+  { "_f0000000_1473",
+    {16, 0},
+    { {"00"_b, "veor_q_a1"},
+    },
+  },
+
+  { "_f0000000_40",
+    {12},
+    { {"0"_b, "_f0000000_1474"},
+      {"x"_b, "unallocated"},
+    },
+  },
+
+  { "_f0000000_1474",
+    {16, 0},
+    { {"00"_b, "vbsl_q_a1"},
+    },
+  },
+
+  { "_f0000000_41",
+    {12},
+    { {"0"_b, "_f0000000_1475"},
+      {"x"_b, "unallocated"},
+    },
+  },
+
+  { "_f0000000_1475",
+    {16, 0},
+    { {"00"_b, "vbit_q_a1"},
+    },
+  },
+
+  { "_f0000000_42",
+    {12},
+    { {"0"_b, "_f0000000_1476"},
+      {"x"_b, "unallocated"},
+    },
+  },
+
+  { "_f0000000_1476",
+    {16, 0},
+    { {"00"_b, "vbif_q_a1"},
+    },
+  },
+
+  { "_f0000000_43",
+    {24},
+    { {"0"_b, "vtst_d_a1"},
+      {"1"_b, "vceq_d_a1"},
+    },
+  },
+
+  { "_f0000000_44",
+    {24},
+    { {"0"_b, "_f0000000_1477"},
+      {"1"_b, "_f0000000_1478"},
+    },
+  },
+
+  { "_f0000000_1477",
+    {16, 12, 0},
+    { {"000"_b, "vtst_q_a1"},
+    },
+  },
+
+  { "_f0000000_1478",
+    {16, 12, 0},
+    { {"000"_b, "vceq_q_a1"},
+    },
+  },
+
+  { "_f0000000_45",
+    {24},
+    { {"0"_b, "vpadd_a1"},
+      {"x"_b, "unallocated"},
+    },
+  },
+
+  { "_f0000000_46",
+    {24, 21, 20},
+    { {"000"_b, "vfma_d_a1"},
+      {"010"_b, "vfms_d_a1"},
+      {"xxx"_b, "unallocated"},
+    },
+  },
+
+  { "_f0000000_47",
+    {24, 21, 20},
+    { {"000"_b, "_f0000000_48"},
+      {"010"_b, "_f0000000_49"},
+      {"xxx"_b, "unallocated"},
+    },
+  },
+
+  { "_f0000000_48",
+    {12},
+    { {"0"_b, "_f0000000_1479"},
+      {"x"_b, "unallocated"},
+    },
+  },
+
+  { "_f0000000_1479",
+    {16, 0},
+    { {"00"_b, "vfma_q_a1"},
+    },
+  },
+
+  { "_f0000000_49",
+    {12},
+    { {"0"_b, "_f0000000_1480"},
+      {"x"_b, "unallocated"},
+    },
+  },
+
+  { "_f0000000_1480",
+    {16, 0},
+    { {"00"_b, "vfms_q_a1"},
+    },
+  },
+
+  { "_f0000000_50",
+    {24, 21, 20},
+    { {"000"_b, "vmla_f32_d_a1"},
+      {"010"_b, "vmls_f32_d_a1"},
+      {"100"_b, "vmul_f32_d_a1"},
+      {"xxx"_b, "unallocated"},
+    },
+  },
+
+  { "_f0000000_51",
+    {24, 21, 20},
+    { {"000"_b, "_f0000000_52"},
+      {"010"_b, "_f0000000_53"},
+      {"100"_b, "_f0000000_54"},
+      {"xxx"_b, "unallocated"},
+    },
+  },
+
+  { "_f0000000_52",
+    {12},
+    { {"0"_b, "_f0000000_1481"},
+      {"x"_b, "unallocated"},
+    },
+  },
+
+  { "_f0000000_1481",
+    {16, 0},
+    { {"00"_b, "vmla_f32_q_a1"},
+    },
+  },
+
+  { "_f0000000_53",
+    {12},
+    { {"0"_b, "_f0000000_1482"},
+      {"x"_b, "unallocated"},
+    },
+  },
+
+  { "_f0000000_1482",
+    {16, 0},
+    { {"00"_b, "vmls_f32_q_a1"},
+    },
+  },
+
+  { "_f0000000_54",
+    {12},
+    { {"0"_b, "_f0000000_1483"},
+      {"x"_b, "unallocated"},
+    },
+  },
+
+  { "_f0000000_1483",
+    {16, 0},
+    { {"00"_b, "vmul_f32_q_a1"},
+    },
+  },
+
+  { "_f0000000_55",
+    {24, 21, 20},
+    { {"100"_b, "vacge_d_a1"},
+      {"110"_b, "vacgt_d_a1"},
+      {"xxx"_b, "unallocated"},
+    },
+  },
+
+  { "_f0000000_56",
+    {24, 21, 20},
+    { {"100"_b, "_f0000000_57"},
+      {"110"_b, "_f0000000_58"},
+      {"xxx"_b, "unallocated"},
+    },
+  },
+
+  { "_f0000000_57",
+    {12},
+    { {"0"_b, "_f0000000_1484"},
+      {"x"_b, "unallocated"},
+    },
+  },
+
+  { "_f0000000_1484",
+    {16, 0},
+    { {"00"_b, "vacge_q_a1"},
+    },
+  },
+
+  { "_f0000000_58",
+    {12},
+    { {"0"_b, "_f0000000_1485"},
+      {"x"_b, "unallocated"},
+    },
+  },
+
+  { "_f0000000_1485",
+    {16, 0},
+    { {"00"_b, "vacgt_q_a1"},
+    },
+  },
+
+  { "_f0000000_59",
+    {24, 21, 20},
+    { {"000"_b, "vrecps_d_a1"},
+      {"010"_b, "vrsqrts_d_a1"},
+      {"100"_b, "vmaxnm_d_a1"},
+      {"110"_b, "vminnm_d_a1"},
+      {"xxx"_b, "unallocated"},
+    },
+  },
+
+  { "_f0000000_60",
+    {24, 21, 20},
+    { {"000"_b, "_f0000000_61"},
+      {"010"_b, "_f0000000_62"},
+      {"100"_b, "_f0000000_63"},
+      {"110"_b, "_f0000000_64"},
+      {"xxx"_b, "unallocated"},
+    },
+  },
+
+  { "_f0000000_61",
+    {12},
+    { {"0"_b, "_f0000000_1486"},
+      {"x"_b, "unallocated"},
+    },
+  },
+
+  { "_f0000000_1486",
+    {16, 0},
+    { {"00"_b, "vrecps_q_a1"},
+    },
+  },
+
+  { "_f0000000_62",
+    {12},
+    { {"0"_b, "_f0000000_1487"},
+      {"x"_b, "unallocated"},
+    },
+  },
+
+  { "_f0000000_1487",
+    {16, 0},
+    { {"00"_b, "vrsqrts_q_a1"},
+    },
+  },
+
+  { "_f0000000_63",
+    {12},
+    { {"0"_b, "_f0000000_1488"},
+      {"x"_b, "unallocated"},
+    },
+  },
+
+  { "_f0000000_1488",
+    {16, 0},
+    { {"00"_b, "vmaxnm_q_a1"},
+    },
+  },
+
+  { "_f0000000_64",
+    {12},
+    { {"0"_b, "_f0000000_1489"},
+      {"x"_b, "unallocated"},
+    },
+  },
+
+  { "_f0000000_1489",
+    {16, 0},
+    { {"00"_b, "vminnm_q_a1"},
+    },
+  },
+
+  { "_f0000000_65",
+    {21, 20},
+    { {"11"_b, "_f0000000_66"},
+      {"xx"_b, "_f0000000_111"},
+    },
+  },
+
+  { "_f0000000_66",
+    {24},
+    { {"0"_b, "_f0000000_67"},
+      {"1"_b, "_f0000000_70"},
+    },
+  },
+
+  { "_f0000000_67",
+    {6},
+    { {"0"_b, "_f0000000_68"},
+      {"1"_b, "_f0000000_69"},
+    },
+  },
+
+  { "_f0000000_68",
+    {11},
+    { {"1"_b, "unallocated"},
+      {"x"_b, "vext_d_a1"},
+    },
+  },
+
+  { "_f0000000_69",
+    {12},
+    { {"0"_b, "_f0000000_1490"},
+      {"x"_b, "unallocated"},
+    },
+  },
+
+  { "_f0000000_1490",
+    {16, 0},
+    { {"00"_b, "vext_q_a1"},
+    },
+  },
+
+  { "_f0000000_70",
+    {11},
+    { {"0"_b, "_f0000000_71"},
+      {"1"_b, "_f0000000_108"},
+    },
+  },
+
+  { "_f0000000_71",
+    {17, 16, 9},
+    { {"000"_b, "_f0000000_72"},
+      {"001"_b, "_f0000000_79"},
+      {"010"_b, "_f0000000_84"},
+      {"011"_b, "_f0000000_85"},
+      {"100"_b, "_f0000000_87"},
+      {"101"_b, "_f0000000_91"},
+      {"110"_b, "_f0000000_100"},
+      {"111"_b, "_f0000000_105"},
+    },
+  },
+
+  { "_f0000000_72",
+    {10, 8, 7, 6},
+    { {"0000"_b, "vrev64_d_a1"},
+      {"0001"_b, "_f0000000_1491"},
+      {"0010"_b, "vrev32_d_a1"},
+      {"0011"_b, "_f0000000_1492"},
+      {"0100"_b, "vrev16_d_a1"},
+      {"0101"_b, "_f0000000_1493"},
+      {"1000"_b, "vcls_d_a1"},
+      {"1001"_b, "_f0000000_1494"},
+      {"1010"_b, "vclz_d_a1"},
+      {"1011"_b, "_f0000000_1495"},
+      {"1100"_b, "_f0000000_73"},
+      {"1101"_b, "_f0000000_74"},
+      {"1110"_b, "_f0000000_76"},
+      {"1111"_b, "_f0000000_77"},
+      {"xxxx"_b, "unallocated"},
+    },
+  },
+
+  { "_f0000000_1491",
+    {12, 0},
+    { {"00"_b, "vrev64_q_a1"},
+    },
+  },
+
+  { "_f0000000_1492",
+    {12, 0},
+    { {"00"_b, "vrev32_q_a1"},
+    },
+  },
+
+  { "_f0000000_1493",
+    {12, 0},
+    { {"00"_b, "vrev16_q_a1"},
+    },
+  },
+
+  { "_f0000000_1494",
+    {12, 0},
+    { {"00"_b, "vcls_q_a1"},
+    },
+  },
+
+  { "_f0000000_1495",
+    {12, 0},
+    { {"00"_b, "vclz_q_a1"},
+    },
+  },
+
+  { "_f0000000_73",
+    {19, 18},
+    { {"00"_b, "vcnt_d_a1"},
+      {"xx"_b, "unallocated"},
+    },
+  },
+
+  { "_f0000000_74",
+    {19, 18},
+    { {"00"_b, "_f0000000_75"},
+      {"xx"_b, "unallocated"},
+    },
+  },
+
+  { "_f0000000_75",
+    {12},
+    { {"0"_b, "_f0000000_1496"},
+      {"x"_b, "unallocated"},
+    },
+  },
+
+  { "_f0000000_1496",
+    {0},
+    { {"0"_b, "vcnt_q_a1"},
+    },
+  },
+
+  { "_f0000000_76",
+    {19, 18},
+    { {"00"_b, "vmvn_d_a1"},
+      {"xx"_b, "unallocated"},
+    },
+  },
+
+  { "_f0000000_77",
+    {19, 18},
+    { {"00"_b, "_f0000000_78"},
+      {"xx"_b, "unallocated"},
+    },
+  },
+
+  { "_f0000000_78",
+    {12},
+    { {"0"_b, "_f0000000_1497"},
+      {"x"_b, "unallocated"},
+    },
+  },
+
+  { "_f0000000_1497",
+    {0},
+    { {"0"_b, "vmvn_q_a1"},
+    },
+  },
+
+  { "_f0000000_79",
+    {10, 8, 6},
+    { {"000"_b, "vpaddl_d_a1"},
+      {"001"_b, "_f0000000_1498"},
+      {"010"_b, "_f0000000_80"},
+      {"011"_b, "_f0000000_81"},
+      {"100"_b, "vpadal_d_a1"},
+      {"101"_b, "_f0000000_1499"},
+      {"110"_b, "_f0000000_82"},
+      {"111"_b, "_f0000000_83"},
+    },
+  },
+
+  { "_f0000000_1498",
+    {12, 0},
+    { {"00"_b, "vpaddl_q_a1"},
+    },
+  },
+
+  { "_f0000000_1499",
+    {12, 0},
+    { {"00"_b, "vpadal_q_a1"},
+    },
+  },
+
+  { "_f0000000_80",
+    {7},
+    { {"0"_b, "aese_a1"},
+      {"1"_b, "aesmc_a1"},
+    },
+  },
+
+  { "_f0000000_81",
+    {7},
+    { {"0"_b, "aesd_a1"},
+      {"1"_b, "aesimc_a1"},
+    },
+  },
+
+  { "_f0000000_82",
+    {7},
+    { {"0"_b, "vqabs_d_a1"},
+      {"1"_b, "vqneg_d_a1"},
+    },
+  },
+
+  { "_f0000000_83",
+    {7},
+    { {"0"_b, "_f0000000_1500"},
+      {"1"_b, "_f0000000_1501"},
+    },
+  },
+
+  { "_f0000000_1500",
+    {12, 0},
+    { {"00"_b, "vqabs_q_a1"},
+    },
+  },
+
+  { "_f0000000_1501",
+    {12, 0},
+    { {"00"_b, "vqneg_q_a1"},
+    },
+  },
+
+  { "_f0000000_84",
+    {8, 7, 6},
+    { {"000"_b, "vcgt_imm_d_a1"},
+      {"001"_b, "_f0000000_1502"},
+      {"010"_b, "vcge_imm_d_a1"},
+      {"011"_b, "_f0000000_1503"},
+      {"100"_b, "vceq_imm_d_a1"},
+      {"101"_b, "_f0000000_1504"},
+      {"110"_b, "vcle_d_a1"},
+      {"111"_b, "_f0000000_1505"},
+    },
+  },
+
+  { "_f0000000_1502",
+    {12, 0},
+    { {"00"_b, "vcgt_imm_q_a1"},
+    },
+  },
+
+  { "_f0000000_1503",
+    {12, 0},
+    { {"00"_b, "vcge_imm_q_a1"},
+    },
+  },
+
+  { "_f0000000_1504",
+    {12, 0},
+    { {"00"_b, "vceq_imm_q_a1"},
+    },
+  },
+
+  { "_f0000000_1505",
+    {12, 0},
+    { {"00"_b, "vcle_q_a1"},
+    },
+  },
+
+  { "_f0000000_85",
+    {8, 7, 6},
+    { {"000"_b, "vclt_d_a1"},
+      {"001"_b, "_f0000000_1506"},
+      {"011"_b, "_f0000000_86"},
+      {"100"_b, "vabs_d_a1"},
+      {"101"_b, "_f0000000_1507"},
+      {"110"_b, "vneg_d_a1"},
+      {"111"_b, "_f0000000_1508"},
+      {"xxx"_b, "unallocated"},
+    },
+  },
+
+  { "_f0000000_1506",
+    {12, 0},
+    { {"00"_b, "vclt_q_a1"},
+    },
+  },
+
+  { "_f0000000_1507",
+    {12, 0},
+    { {"00"_b, "vabs_q_a1"},
+    },
+  },
+
+  { "_f0000000_1508",
+    {12, 0},
+    { {"00"_b, "vneg_q_a1"},
+    },
+  },
+
+  { "_f0000000_86",
+    {19, 18, 10},
+    { {"100"_b, "sha1h_a1"},
+      {"xxx"_b, "unallocated"},
+    },
+  },
+
+  { "_f0000000_87",
+    {10, 8, 7, 6},
+    { {"0000"_b, "_f0000000_88"},
+      {"0001"_b, "_f0000000_89"},
+      {"0010"_b, "vtrn_d_a1"},
+      {"0011"_b, "_f0000000_1509"},
+      {"0100"_b, "vuzp_d_a1"},
+      {"0101"_b, "_f0000000_1510"},
+      {"0110"_b, "vzip_d_a1"},
+      {"0111"_b, "_f0000000_1511"},
+      {"1000"_b, "vrintn_d_a1"},
+      {"1001"_b, "_f0000000_1512"},
+      {"1010"_b, "vrintx_d_a1"},
+      {"1011"_b, "_f0000000_1513"},
+      {"1100"_b, "vrinta_d_a1"},
+      {"1101"_b, "_f0000000_1514"},
+      {"1110"_b, "vrintz_d_a1"},
+      {"1111"_b, "_f0000000_1515"},
+    },
+  },
+
+  { "_f0000000_1509",
+    {12, 0},
+    { {"00"_b, "vtrn_q_a1"},
+    },
+  },
+
+  { "_f0000000_1510",
+    {12, 0},
+    { {"00"_b, "vuzp_q_a1"},
+    },
+  },
+
+  { "_f0000000_1511",
+    {12, 0},
+    { {"00"_b, "vzip_q_a1"},
+    },
+  },
+
+  { "_f0000000_1512",
+    {12, 0},
+    { {"00"_b, "vrintn_q_a1"},
+    },
+  },
+
+  { "_f0000000_1513",
+    {12, 0},
+    { {"00"_b, "vrintx_q_a1"},
+    },
+  },
+
+  { "_f0000000_1514",
+    {12, 0},
+    { {"00"_b, "vrinta_q_a1"},
+    },
+  },
+
+  { "_f0000000_1515",
+    {12, 0},
+    { {"00"_b, "vrintz_q_a1"},
+    },
+  },
+
+  { "_f0000000_88",
+    {19, 18},
+    { {"00"_b, "vswp_d_a1"},
+      {"xx"_b, "unallocated"},
+    },
+  },
+
+  { "_f0000000_89",
+    {19, 18},
+    { {"00"_b, "_f0000000_90"},
+      {"xx"_b, "unallocated"},
+    },
+  },
+
+  { "_f0000000_90",
+    {12},
+    { {"0"_b, "_f0000000_1516"},
+      {"x"_b, "unallocated"},
+    },
+  },
+
+  { "_f0000000_1516",
+    {0},
+    { {"0"_b, "vswp_q_a1"},
+    },
+  },
+
+  { "_f0000000_91",
+    {10, 8, 7},
+    { {"000"_b, "_f0000000_92"},
+      {"001"_b, "_f0000000_1517"},
+      {"010"_b, "_f0000000_93"},
+      {"011"_b, "_f0000000_94"},
+      {"100"_b, "_f0000000_95"},
+      {"101"_b, "_f0000000_96"},
+      {"110"_b, "_f0000000_97"},
+      {"111"_b, "_f0000000_99"},
+    },
+  },
+
+  { "_f0000000_1517",
+    {0},
+    { {"0"_b, "vqmovn_a1"},
+    },
+  },
+
+  { "_f0000000_92",
+    {6},
+    { {"0"_b, "_f0000000_1518"},
+      {"1"_b, "_f0000000_1519"},
+    },
+  },
+
+  { "_f0000000_1518",
+    {0},
+    { {"0"_b, "vmovn_a1"},
+    },
+  },
+
+  { "_f0000000_1519",
+    {0},
+    { {"0"_b, "vqmovun_a1"},
+    },
+  },
+
+  { "_f0000000_93",
+    {6},
+    { {"0"_b, "_f0000000_1520"},
+      {"x"_b, "unallocated"},
+    },
+  },
+
+  { "_f0000000_1520",
+    {12},
+    { {"0"_b, "vshll_a2"},
+    },
+  },
+
+  { "_f0000000_94",
+    {19, 18, 6},
+    { {"100"_b, "sha1su1_a1"},
+      {"101"_b, "sha256su0_a1"},
+      {"xxx"_b, "unallocated"},
+    },
+  },
+
+  { "_f0000000_95",
+    {19, 18, 6},
+    { {"010"_b, "_f0000000_1521"},
+      {"xxx"_b, "unallocated"},
+    },
+  },
+
+  { "_f0000000_1521",
+    {0},
+    { {"0"_b, "vcvt_f16_f32_a1"},
+    },
+  },
+
+  { "_f0000000_96",
+    {6},
+    { {"0"_b, "vrintm_d_a1"},
+      {"1"_b, "_f0000000_1522"},
+    },
+  },
+
+  { "_f0000000_1522",
+    {12, 0},
+    { {"00"_b, "vrintm_q_a1"},
+    },
+  },
+
+  { "_f0000000_97",
+    {19, 18, 6},
+    { {"010"_b, "_f0000000_98"},
+      {"xxx"_b, "unallocated"},
+    },
+  },
+
+  { "_f0000000_98",
+    {12},
+    { {"0"_b, "vcvt_f32_f16_a1"},
+      {"x"_b, "unallocated"},
+    },
+  },
+
+  { "_f0000000_99",
+    {6},
+    { {"0"_b, "vrintp_d_a1"},
+      {"1"_b, "_f0000000_1523"},
+    },
+  },
+
+  { "_f0000000_1523",
+    {12, 0},
+    { {"00"_b, "vrintp_q_a1"},
+    },
+  },
+
+  { "_f0000000_100",
+    {10, 6},
+    { {"00"_b, "_f0000000_101"},
+      {"01"_b, "_f0000000_102"},
+      {"10"_b, "_f0000000_103"},
+      {"11"_b, "_f0000000_104"},
+    },
+  },
+
+  { "_f0000000_101",
+    {19, 18, 8},
+    { {"100"_b, "vcvta_int_f32_d_a1"},
+      {"101"_b, "vcvtn_int_f32_d_a1"},
+      {"xxx"_b, "unallocated"},
+    },
+  },
+
+  { "_f0000000_102",
+    {19, 18, 8},
+    { {"100"_b, "_f0000000_1524"},
+      {"101"_b, "_f0000000_1525"},
+      {"xxx"_b, "unallocated"},
+    },
+  },
+
+  { "_f0000000_1524",
+    {12, 0},
+    { {"00"_b, "vcvta_int_f32_q_a1"},
+    },
+  },
+
+  { "_f0000000_1525",
+    {12, 0},
+    { {"00"_b, "vcvtn_int_f32_q_a1"},
+    },
+  },
+
+  { "_f0000000_103",
+    {7},
+    { {"0"_b, "vrecpe_d_a1"},
+      {"1"_b, "vrsqrte_d_a1"},
+    },
+  },
+
+  { "_f0000000_104",
+    {7},
+    { {"0"_b, "_f0000000_1526"},
+      {"1"_b, "_f0000000_1527"},
+    },
+  },
+
+  { "_f0000000_1526",
+    {12, 0},
+    { {"00"_b, "vrecpe_q_a1"},
+    },
+  },
+
+  { "_f0000000_1527",
+    {12, 0},
+    { {"00"_b, "vrsqrte_q_a1"},
+    },
+  },
+
+  { "_f0000000_105",
+    {19, 18, 10, 6},
+    { {"1000"_b, "_f0000000_106"},
+      {"1001"_b, "_f0000000_107"},
+      {"1010"_b, "vcvt_d_a1"},
+      {"1011"_b, "_f0000000_1528"},
+      {"xxxx"_b, "unallocated"},
+    },
+  },
+
+  { "_f0000000_1528",
+    {12, 0},
+    { {"00"_b, "vcvt_q_a1"},
+    },
+  },
+
+  { "_f0000000_106",
+    {8},
+    { {"0"_b, "vcvtp_int_f32_d_a1"},
+      {"1"_b, "vcvtm_int_f32_d_a1"},
+    },
+  },
+
+  { "_f0000000_107",
+    {8},
+    { {"0"_b, "_f0000000_1529"},
+      {"1"_b, "_f0000000_1530"},
+    },
+  },
+
+  { "_f0000000_1529",
+    {12, 0},
+    { {"00"_b, "vcvtp_int_f32_q_a1"},
+    },
+  },
+
+  { "_f0000000_1530",
+    {12, 0},
+    { {"00"_b, "vcvtm_int_f32_q_a1"},
+    },
+  },
+
+  { "_f0000000_108",
+    {10, 6},
+    { {"00"_b, "vtbl_a1"},
+      {"01"_b, "vtbx_a1"},
+      {"10"_b, "_f0000000_109"},
+      {"11"_b, "_f0000000_110"},
+    },
+  },
+
+  { "_f0000000_109",
+    {9, 8, 7},
+    { {"000"_b, "vdup_scalar_d_a1"},
+      {"xxx"_b, "unallocated"},
+    },
+  },
+
+  { "_f0000000_110",
+    {9, 8, 7},
+    { {"000"_b, "_f0000000_1531"},
+      {"xxx"_b, "unallocated"},
+    },
+  },
+
+  { "_f0000000_1531",
+    {12},
+    { {"0"_b, "vdup_scalar_q_a1"},
+    },
+  },
+
+  { "_f0000000_111",
+    {11, 10, 6},
+    { {"000"_b, "_f0000000_112"},
+      {"001"_b, "_f0000000_117"},
+      {"010"_b, "_f0000000_125"},
+      {"011"_b, "_f0000000_134"},
+      {"100"_b, "_f0000000_142"},
+      {"101"_b, "_f0000000_149"},
+      {"110"_b, "_f0000000_157"},
+      {"111"_b, "_f0000000_161"},
+    },
+  },
+
+  { "_f0000000_112",
+    {9, 8},
+    { {"00"_b, "_f0000000_113"},
+      {"01"_b, "_f0000000_114"},
+      {"10"_b, "_f0000000_115"},
+      {"11"_b, "_f0000000_116"},
+    },
+  },
+
+  { "_f0000000_113",
+    {21, 20},
+    { {"11"_b, "unallocated"},
+      {"xx"_b, "_f0000000_1532"},
+    },
+  },
+
+  { "_f0000000_1532",
+    {12},
+    { {"0"_b, "vaddl_a1"},
+    },
+  },
+
+  { "_f0000000_114",
+    {21, 20},
+    { {"11"_b, "unallocated"},
+      {"xx"_b, "_f0000000_1533"},
+    },
+  },
+
+  { "_f0000000_1533",
+    {16, 12},
+    { {"00"_b, "vaddw_a1"},
+    },
+  },
+
+  { "_f0000000_115",
+    {21, 20},
+    { {"11"_b, "unallocated"},
+      {"xx"_b, "_f0000000_1534"},
+    },
+  },
+
+  { "_f0000000_1534",
+    {12},
+    { {"0"_b, "vsubl_a1"},
+    },
+  },
+
+  { "_f0000000_116",
+    {21, 20},
+    { {"11"_b, "unallocated"},
+      {"xx"_b, "_f0000000_1535"},
+    },
+  },
+
+  { "_f0000000_1535",
+    {16, 12},
+    { {"00"_b, "vsubw_a1"},
+    },
+  },
+
+  { "_f0000000_117",
+    {9},
+    { {"0"_b, "_f0000000_118"},
+      {"1"_b, "_f0000000_121"},
+    },
+  },
+
+  { "_f0000000_118",
+    {24},
+    { {"0"_b, "_f0000000_119"},
+      {"1"_b, "_f0000000_120"},
+    },
+  },
+
+  { "_f0000000_119",
+    {21, 20},
+    { {"11"_b, "unallocated"},
+      {"xx"_b, "vmla_scalar_d_a1"},
+    },
+  },
+
+  { "_f0000000_120",
+    {21, 20},
+    { {"11"_b, "unallocated"},
+      {"xx"_b, "_f0000000_1536"},
+    },
+  },
+
+  { "_f0000000_1536",
+    {16, 12},
+    { {"00"_b, "vmla_scalar_q_a1"},
+    },
+  },
+
+  { "_f0000000_121",
+    {8},
+    { {"0"_b, "_f0000000_122"},
+      {"1"_b, "_f0000000_123"},
+    },
+  },
+
+  { "_f0000000_122",
+    {21, 20},
+    { {"11"_b, "unallocated"},
+      {"xx"_b, "_f0000000_1537"},
+    },
+  },
+
+  { "_f0000000_1537",
+    {12},
+    { {"0"_b, "vmlal_scalar_a1"},
+    },
+  },
+
+  { "_f0000000_123",
+    {24},
+    { {"0"_b, "_f0000000_124"},
+      {"x"_b, "unallocated"},
+    },
+  },
+
+  { "_f0000000_124",
+    {21, 20},
+    { {"11"_b, "unallocated"},
+      {"xx"_b, "_f0000000_1538"},
+    },
+  },
+
+  { "_f0000000_1538",
+    {12},
+    { {"0"_b, "vqdmlal_a2"},
+    },
+  },
+
+  { "_f0000000_125",
+    {9, 8},
+    { {"00"_b, "_f0000000_126"},
+      {"01"_b, "_f0000000_129"},
+      {"10"_b, "_f0000000_130"},
+      {"11"_b, "_f0000000_133"},
+    },
+  },
+
+  { "_f0000000_126",
+    {24},
+    { {"0"_b, "_f0000000_127"},
+      {"1"_b, "_f0000000_128"},
+    },
+  },
+
+  { "_f0000000_127",
+    {21, 20},
+    { {"11"_b, "unallocated"},
+      {"xx"_b, "_f0000000_1539"},
+    },
+  },
+
+  { "_f0000000_1539",
+    {16, 0},
+    { {"00"_b, "vaddhn_a1"},
+    },
+  },
+
+  { "_f0000000_128",
+    {21, 20},
+    { {"11"_b, "unallocated"},
+      {"xx"_b, "_f0000000_1540"},
+    },
+  },
+
+  { "_f0000000_1540",
+    {16, 0},
+    { {"00"_b, "vraddhn_a1"},
+    },
+  },
+
+  { "_f0000000_129",
+    {21, 20},
+    { {"11"_b, "unallocated"},
+      {"xx"_b, "_f0000000_1541"},
+    },
+  },
+
+  { "_f0000000_1541",
+    {12},
+    { {"0"_b, "vabal_a1"},
+    },
+  },
+
+  { "_f0000000_130",
+    {24},
+    { {"0"_b, "_f0000000_131"},
+      {"1"_b, "_f0000000_132"},
+    },
+  },
+
+  { "_f0000000_131",
+    {21, 20},
+    { {"11"_b, "unallocated"},
+      {"xx"_b, "_f0000000_1542"},
+    },
+  },
+
+  { "_f0000000_1542",
+    {16, 0},
+    { {"00"_b, "vsubhn_a1"},
+    },
+  },
+
+  { "_f0000000_132",
+    {21, 20},
+    { {"11"_b, "unallocated"},
+      {"xx"_b, "_f0000000_1543"},
+    },
+  },
+
+  { "_f0000000_1543",
+    {16, 0},
+    { {"00"_b, "vrsubhn_a1"},
+    },
+  },
+
+  { "_f0000000_133",
+    {21, 20},
+    { {"11"_b, "unallocated"},
+      {"xx"_b, "_f0000000_1544"},
+    },
+  },
+
+  { "_f0000000_1544",
+    {12},
+    { {"0"_b, "vabdl_a1"},
+    },
+  },
+
+  { "_f0000000_134",
+    {9},
+    { {"0"_b, "_f0000000_135"},
+      {"1"_b, "_f0000000_138"},
+    },
+  },
+
+  { "_f0000000_135",
+    {24},
+    { {"0"_b, "_f0000000_136"},
+      {"1"_b, "_f0000000_137"},
+    },
+  },
+
+  { "_f0000000_136",
+    {21, 20},
+    { {"11"_b, "unallocated"},
+      {"xx"_b, "vmls_scalar_d_a1"},
+    },
+  },
+
+  { "_f0000000_137",
+    {21, 20},
+    { {"11"_b, "unallocated"},
+      {"xx"_b, "_f0000000_1545"},
+    },
+  },
+
+  { "_f0000000_1545",
+    {16, 12},
+    { {"00"_b, "vmls_scalar_q_a1"},
+    },
+  },
+
+  { "_f0000000_138",
+    {8},
+    { {"0"_b, "_f0000000_139"},
+      {"1"_b, "_f0000000_140"},
+    },
+  },
+
+  { "_f0000000_139",
+    {21, 20},
+    { {"11"_b, "unallocated"},
+      {"xx"_b, "_f0000000_1546"},
+    },
+  },
+
+  { "_f0000000_1546",
+    {12},
+    { {"0"_b, "vmlsl_scalar_a1"},
+    },
+  },
+
+  { "_f0000000_140",
+    {24},
+    { {"0"_b, "_f0000000_141"},
+      {"x"_b, "unallocated"},
+    },
+  },
+
+  { "_f0000000_141",
+    {21, 20},
+    { {"11"_b, "unallocated"},
+      {"xx"_b, "_f0000000_1547"},
+    },
+  },
+
+  { "_f0000000_1547",
+    {12},
+    { {"0"_b, "vqdmlsl_a2"},
+    },
+  },
+
+  { "_f0000000_142",
+    {9, 8},
+    { {"00"_b, "_f0000000_143"},
+      {"01"_b, "_f0000000_144"},
+      {"10"_b, "_f0000000_146"},
+      {"11"_b, "_f0000000_147"},
+    },
+  },
+
+  { "_f0000000_143",
+    {21, 20},
+    { {"11"_b, "unallocated"},
+      {"xx"_b, "_f0000000_1548"},
+    },
+  },
+
+  { "_f0000000_1548",
+    {12},
+    { {"0"_b, "vmlal_a1"},
+    },
+  },
+
+  { "_f0000000_144",
+    {24},
+    { {"0"_b, "_f0000000_145"},
+      {"x"_b, "unallocated"},
+    },
+  },
+
+  { "_f0000000_145",
+    {21, 20},
+    { {"11"_b, "unallocated"},
+      {"xx"_b, "_f0000000_1549"},
+    },
+  },
+
+  { "_f0000000_1549",
+    {12},
+    { {"0"_b, "vqdmlal_a1"},
+    },
+  },
+
+  { "_f0000000_146",
+    {21, 20},
+    { {"11"_b, "unallocated"},
+      {"xx"_b, "_f0000000_1550"},
+    },
+  },
+
+  { "_f0000000_1550",
+    {12},
+    { {"0"_b, "vmlsl_a1"},
+    },
+  },
+
+  { "_f0000000_147",
+    {24},
+    { {"0"_b, "_f0000000_148"},
+      {"x"_b, "unallocated"},
+    },
+  },
+
+  { "_f0000000_148",
+    {21, 20},
+    { {"11"_b, "unallocated"},
+      {"xx"_b, "_f0000000_1551"},
+    },
+  },
+
+  { "_f0000000_1551",
+    {12},
+    { {"0"_b, "vqdmlsl_a1"},
+    },
+  },
+
+  { "_f0000000_149",
+    {9},
+    { {"0"_b, "_f0000000_150"},
+      {"1"_b, "_f0000000_153"},
+    },
+  },
+
+  { "_f0000000_150",
+    {24},
+    { {"0"_b, "_f0000000_151"},
+      {"1"_b, "_f0000000_152"},
+    },
+  },
+
+  { "_f0000000_151",
+    {21, 20},
+    { {"11"_b, "unallocated"},
+      {"xx"_b, "vmul_scalar_d_a1"},
+    },
+  },
+
+  { "_f0000000_152",
+    {21, 20},
+    { {"11"_b, "unallocated"},
+      {"xx"_b, "_f0000000_1552"},
+    },
+  },
+
+  { "_f0000000_1552",
+    {16, 12},
+    { {"00"_b, "vmul_scalar_q_a1"},
+    },
+  },
+
+  { "_f0000000_153",
+    {8},
+    { {"0"_b, "_f0000000_154"},
+      {"1"_b, "_f0000000_155"},
+    },
+  },
+
+  { "_f0000000_154",
+    {21, 20},
+    { {"11"_b, "unallocated"},
+      {"xx"_b, "_f0000000_1553"},
+    },
+  },
+
+  { "_f0000000_1553",
+    {12},
+    { {"0"_b, "vmull_scalar_a1"},
+    },
+  },
+
+  { "_f0000000_155",
+    {24},
+    { {"0"_b, "_f0000000_156"},
+      {"x"_b, "unallocated"},
+    },
+  },
+
+  { "_f0000000_156",
+    {21, 20},
+    { {"11"_b, "unallocated"},
+      {"xx"_b, "_f0000000_1554"},
+    },
+  },
+
+  { "_f0000000_1554",
+    {12},
+    { {"0"_b, "vqdmull_a2"},
+    },
+  },
+
+  { "_f0000000_157",
+    {8},
+    { {"0"_b, "_f0000000_158"},
+      {"1"_b, "_f0000000_159"},
+    },
+  },
+
+  { "_f0000000_158",
+    {21, 20},
+    { {"11"_b, "unallocated"},
+      {"xx"_b, "_f0000000_1555"},
+    },
+  },
+
+  { "_f0000000_1555",
+    {12},
+    { {"0"_b, "vmull_a1"},
+    },
+  },
+
+  { "_f0000000_159",
+    {24, 9},
+    { {"00"_b, "_f0000000_160"},
+      {"xx"_b, "unallocated"},
+    },
+  },
+
+  { "_f0000000_160",
+    {21, 20},
+    { {"11"_b, "unallocated"},
+      {"xx"_b, "_f0000000_1556"},
+    },
+  },
+
+  { "_f0000000_1556",
+    {12},
+    { {"0"_b, "vqdmull_a1"},
+    },
+  },
+
+  { "_f0000000_161",
+    {24, 9, 8},
+    { {"000"_b, "_f0000000_162"},
+      {"001"_b, "_f0000000_163"},
+      {"100"_b, "_f0000000_164"},
+      {"101"_b, "_f0000000_165"},
+      {"xxx"_b, "unallocated"},
+    },
+  },
+
+  { "_f0000000_162",
+    {21, 20},
+    { {"11"_b, "unallocated"},
+      {"xx"_b, "vqdmulh_d_a2"},
+    },
+  },
+
+  { "_f0000000_163",
+    {21, 20},
+    { {"11"_b, "unallocated"},
+      {"xx"_b, "vqrdmulh_d_a2"},
+    },
+  },
+
+  { "_f0000000_164",
+    {21, 20},
+    { {"11"_b, "unallocated"},
+      {"xx"_b, "_f0000000_1557"},
+    },
+  },
+
+  { "_f0000000_1557",
+    {16, 12},
+    { {"00"_b, "vqdmulh_q_a2"},
+    },
+  },
+
+  { "_f0000000_165",
+    {21, 20},
+    { {"11"_b, "unallocated"},
+      {"xx"_b, "_f0000000_1558"},
+    },
+  },
+
+  { "_f0000000_1558",
+    {16, 12},
+    { {"00"_b, "vqrdmulh_q_a2"},
+    },
+  },
+
+  { "_f0000000_166",
+    {6},
+    { {"0"_b, "_f0000000_167"},
+      {"1"_b, "_f0000000_327"},
+    },
+  },
+
+  { "_f0000000_167",
+    {11, 10},
+    { {"00"_b, "_f0000000_168"},
+      {"01"_b, "_f0000000_182"},
+      {"10"_b, "_f0000000_199"},
+      {"11"_b, "_f0000000_297"},
+    },
+  },
+
+  { "_f0000000_168",
+    {21, 20, 19, 7},
+    { {"0000"_b, "_f0000000_169"},
+      {"xxxx"_b, "_f0000000_177"},
+    },
+  },
+
+  { "_f0000000_169",
+    {8},
+    { {"0"_b, "_f0000000_170"},
+      {"1"_b, "_f0000000_174"},
+    },
+  },
+
+  { "_f0000000_170",
+    {9},
+    { {"x"_b, "_f0000000_171"},
+    },
+  },
+
+  { "_f0000000_171",
+    {5},
+    { {"1"_b, "_f0000000_172"},
+      {"x"_b, "_f0000000_173"},
+    },
+  },
+
+  { "_f0000000_172",
+    {11, 10, 9, 8},
+    { {"00x1"_b, "unallocated"},
+      {"01x1"_b, "unallocated"},
+      {"10x1"_b, "unallocated"},
+      {"111x"_b, "unallocated"},
+      {"xxxx"_b, "vmvn_imm_d_a1"},
+    },
+  },
+
+  { "_f0000000_173",
+    {11, 10, 9, 8, 5},
+    { {"0xx10"_b, "unallocated"},
+      {"x0x10"_b, "unallocated"},
+      {"0xxx1"_b, "unallocated"},
+      {"x0xx1"_b, "unallocated"},
+      {"xx0x1"_b, "unallocated"},
+      {"xxx11"_b, "unallocated"},
+      {"xxxxx"_b, "vmov_imm_d_a1"},
+    },
+  },
+
+  { "_f0000000_174",
+    {5},
+    { {"0"_b, "_f0000000_175"},
+      {"1"_b, "_f0000000_176"},
+    },
+  },
+
+  { "_f0000000_175",
+    {11, 10, 8},
+    { {"xx0"_b, "unallocated"},
+      {"11x"_b, "unallocated"},
+      {"xxx"_b, "vorr_d_a1"},
+    },
+  },
+
+  { "_f0000000_176",
+    {11, 10, 8},
+    { {"xx0"_b, "unallocated"},
+      {"11x"_b, "unallocated"},
+      {"xxx"_b, "vbic_imm_d_a1"},
+    },
+  },
+
+  { "_f0000000_177",
+    {9, 8},
+    { {"00"_b, "_f0000000_178"},
+      {"01"_b, "_f0000000_179"},
+      {"10"_b, "_f0000000_180"},
+      {"11"_b, "_f0000000_181"},
+    },
+  },
+
+  { "_f0000000_178",
+    {21, 20, 19, 7},
+    { {"0000"_b, "unallocated"},
+      {"xxxx"_b, "vshr_d_a1"},
+    },
+  },
+
+  { "_f0000000_179",
+    {21, 20, 19, 7},
+    { {"0000"_b, "unallocated"},
+      {"xxxx"_b, "vsra_d_a1"},
+    },
+  },
+
+  { "_f0000000_180",
+    {21, 20, 19, 7},
+    { {"0000"_b, "unallocated"},
+      {"xxxx"_b, "vrshr_d_a1"},
+    },
+  },
+
+  { "_f0000000_181",
+    {21, 20, 19, 7},
+    { {"0000"_b, "unallocated"},
+      {"xxxx"_b, "vrsra_d_a1"},
+    },
+  },
+
+  { "_f0000000_182",
+    {21, 20, 19, 7},
+    { {"0000"_b, "_f0000000_183"},
+      {"xxxx"_b, "_f0000000_191"},
+    },
+  },
+
+  { "_f0000000_183",
+    {8},
+    { {"0"_b, "_f0000000_184"},
+      {"1"_b, "_f0000000_188"},
+    },
+  },
+
+  { "_f0000000_184",
+    {9},
+    { {"x"_b, "_f0000000_185"},
+    },
+  },
+
+  { "_f0000000_185",
+    {5},
+    { {"1"_b, "_f0000000_186"},
+      {"x"_b, "_f0000000_187"},
+    },
+  },
+
+  { "_f0000000_186",
+    {11, 10, 9, 8},
+    { {"00x1"_b, "unallocated"},
+      {"01x1"_b, "unallocated"},
+      {"10x1"_b, "unallocated"},
+      {"111x"_b, "unallocated"},
+      {"xxxx"_b, "vmvn_imm_d_a1"},
+    },
+  },
+
+  { "_f0000000_187",
+    {11, 10, 9, 8, 5},
+    { {"0xx10"_b, "unallocated"},
+      {"x0x10"_b, "unallocated"},
+      {"0xxx1"_b, "unallocated"},
+      {"x0xx1"_b, "unallocated"},
+      {"xx0x1"_b, "unallocated"},
+      {"xxx11"_b, "unallocated"},
+      {"xxxxx"_b, "vmov_imm_d_a1"},
+    },
+  },
+
+  { "_f0000000_188",
+    {5},
+    { {"0"_b, "_f0000000_189"},
+      {"1"_b, "_f0000000_190"},
+    },
+  },
+
+  { "_f0000000_189",
+    {11, 10, 8},
+    { {"xx0"_b, "unallocated"},
+      {"11x"_b, "unallocated"},
+      {"xxx"_b, "vorr_d_a1"},
+    },
+  },
+
+  { "_f0000000_190",
+    {11, 10, 8},
+    { {"xx0"_b, "unallocated"},
+      {"11x"_b, "unallocated"},
+      {"xxx"_b, "vbic_imm_d_a1"},
+    },
+  },
+
+  { "_f0000000_191",
+    {9, 8},
+    { {"00"_b, "_f0000000_192"},
+      {"01"_b, "_f0000000_194"},
+      {"10"_b, "_f0000000_197"},
+      {"11"_b, "_f0000000_198"},
+    },
+  },
+
+  { "_f0000000_192",
+    {24},
+    { {"1"_b, "_f0000000_193"},
+      {"x"_b, "unallocated"},
+    },
+  },
+
+  { "_f0000000_193",
+    {21, 20, 19, 7},
+    { {"0000"_b, "unallocated"},
+      {"xxxx"_b, "vsri_d_a1"},
+    },
+  },
+
+  { "_f0000000_194",
+    {24},
+    { {"0"_b, "_f0000000_195"},
+      {"1"_b, "_f0000000_196"},
+    },
+  },
+
+  { "_f0000000_195",
+    {21, 20, 19, 7},
+    { {"0000"_b, "unallocated"},
+      {"xxxx"_b, "vshl_imm_d_a1"},
+    },
+  },
+
+  { "_f0000000_196",
+    {21, 20, 19, 7},
+    { {"0000"_b, "unallocated"},
+      {"xxxx"_b, "vsli_d_a1"},
+    },
+  },
+
+  { "_f0000000_197",
+    {21, 20, 19, 7},
+    { {"0000"_b, "unallocated"},
+      {"xxxx"_b, "vqshlu_d_a1"},
+    },
+  },
+
+  { "_f0000000_198",
+    {21, 20, 19, 7},
+    { {"0000"_b, "unallocated"},
+      {"xxxx"_b, "vqshl_imm_d_a1"},
+    },
+  },
+
+  { "_f0000000_199",
+    {7},
+    { {"0"_b, "_f0000000_200"},
+      {"x"_b, "unallocated"},
+    },
+  },
+
+  { "_f0000000_200",
+    {21, 20, 19},
+    { {"000"_b, "_f0000000_201"},
+      {"011"_b, "_f0000000_209"},
+      {"101"_b, "_f0000000_215"},
+      {"110"_b, "_f0000000_221"},
+      {"111"_b, "_f0000000_227"},
+      {"xxx"_b, "_f0000000_233"},
+    },
+  },
+
+  { "_f0000000_201",
+    {8},
+    { {"0"_b, "_f0000000_202"},
+      {"1"_b, "_f0000000_206"},
+    },
+  },
+
+  { "_f0000000_202",
+    {9},
+    { {"x"_b, "_f0000000_203"},
+    },
+  },
+
+  { "_f0000000_203",
+    {5},
+    { {"1"_b, "_f0000000_204"},
+      {"x"_b, "_f0000000_205"},
+    },
+  },
+
+  { "_f0000000_204",
+    {11, 10, 9, 8},
+    { {"00x1"_b, "unallocated"},
+      {"01x1"_b, "unallocated"},
+      {"10x1"_b, "unallocated"},
+      {"111x"_b, "unallocated"},
+      {"xxxx"_b, "vmvn_imm_d_a1"},
+    },
+  },
+
+  { "_f0000000_205",
+    {11, 10, 9, 8, 5},
+    { {"0xx10"_b, "unallocated"},
+      {"x0x10"_b, "unallocated"},
+      {"0xxx1"_b, "unallocated"},
+      {"x0xx1"_b, "unallocated"},
+      {"xx0x1"_b, "unallocated"},
+      {"xxx11"_b, "unallocated"},
+      {"xxxxx"_b, "vmov_imm_d_a1"},
+    },
+  },
+
+  { "_f0000000_206",
+    {5},
+    { {"0"_b, "_f0000000_207"},
+      {"1"_b, "_f0000000_208"},
+    },
+  },
+
+  { "_f0000000_207",
+    {11, 10, 8},
+    { {"xx0"_b, "unallocated"},
+      {"11x"_b, "unallocated"},
+      {"xxx"_b, "vorr_d_a1"},
+    },
+  },
+
+  { "_f0000000_208",
+    {11, 10, 8},
+    { {"xx0"_b, "unallocated"},
+      {"11x"_b, "unallocated"},
+      {"xxx"_b, "vbic_imm_d_a1"},
+    },
+  },
+
+  { "_f0000000_209",
+    {9, 8},
+    { {"00"_b, "_f0000000_210"},
+      {"01"_b, "_f0000000_213"},
+      {"10"_b, "_f0000000_214"},
+      {"xx"_b, "unallocated"},
+    },
+  },
+
+  { "_f0000000_210",
+    {24},
+    { {"0"_b, "_f0000000_211"},
+      {"1"_b, "_f0000000_212"},
+    },
+  },
+
+  { "_f0000000_211",
+    {21, 20, 19},
+    { {"000"_b, "unallocated"},
+      {"xxx"_b, "_f0000000_1559"},
+    },
+  },
+
+  { "_f0000000_1559",
+    {0},
+    { {"0"_b, "vshrn_a1"},
+    },
+  },
+
+  { "_f0000000_212",
+    {21, 20, 19},
+    { {"000"_b, "unallocated"},
+      {"xxx"_b, "_f0000000_1560"},
+    },
+  },
+
+  { "_f0000000_1560",
+    {0},
+    { {"0"_b, "vqshrun_a1"},
+    },
+  },
+
+  { "_f0000000_213",
+    {21, 20, 19},
+    { {"000"_b, "unallocated"},
+      {"xxx"_b, "_f0000000_1561"},
+    },
+  },
+
+  { "_f0000000_1561",
+    {0},
+    { {"0"_b, "vqshrn_a1"},
+    },
+  },
+
+  { "_f0000000_214",
+    {21, 20, 19, 18, 17, 16},
+    { {"000xxx"_b, "unallocated"},
+      {"001000"_b, "unallocated"},
+      {"010000"_b, "unallocated"},
+      {"100000"_b, "unallocated"},
+      {"xxxxxx"_b, "_f0000000_1562"},
+    },
+  },
+
+  { "_f0000000_1562",
+    {12},
+    { {"0"_b, "vshll_a1"},
+    },
+  },
+
+  { "_f0000000_215",
+    {9, 8},
+    { {"00"_b, "_f0000000_216"},
+      {"01"_b, "_f0000000_219"},
+      {"10"_b, "_f0000000_220"},
+      {"xx"_b, "unallocated"},
+    },
+  },
+
+  { "_f0000000_216",
+    {24},
+    { {"0"_b, "_f0000000_217"},
+      {"1"_b, "_f0000000_218"},
+    },
+  },
+
+  { "_f0000000_217",
+    {21, 20, 19},
+    { {"000"_b, "unallocated"},
+      {"xxx"_b, "_f0000000_1559"},
+    },
+  },
+
+  { "_f0000000_218",
+    {21, 20, 19},
+    { {"000"_b, "unallocated"},
+      {"xxx"_b, "_f0000000_1560"},
+    },
+  },
+
+  { "_f0000000_219",
+    {21, 20, 19},
+    { {"000"_b, "unallocated"},
+      {"xxx"_b, "_f0000000_1561"},
+    },
+  },
+
+  { "_f0000000_220",
+    {21, 20, 19, 18, 17, 16},
+    { {"000xxx"_b, "unallocated"},
+      {"001000"_b, "unallocated"},
+      {"010000"_b, "unallocated"},
+      {"100000"_b, "unallocated"},
+      {"xxxxxx"_b, "_f0000000_1562"},
+    },
+  },
+
+  { "_f0000000_221",
+    {9, 8},
+    { {"00"_b, "_f0000000_222"},
+      {"01"_b, "_f0000000_225"},
+      {"10"_b, "_f0000000_226"},
+      {"xx"_b, "unallocated"},
+    },
+  },
+
+  { "_f0000000_222",
+    {24},
+    { {"0"_b, "_f0000000_223"},
+      {"1"_b, "_f0000000_224"},
+    },
+  },
+
+  { "_f0000000_223",
+    {21, 20, 19},
+    { {"000"_b, "unallocated"},
+      {"xxx"_b, "_f0000000_1559"},
+    },
+  },
+
+  { "_f0000000_224",
+    {21, 20, 19},
+    { {"000"_b, "unallocated"},
+      {"xxx"_b, "_f0000000_1560"},
+    },
+  },
+
+  { "_f0000000_225",
+    {21, 20, 19},
+    { {"000"_b, "unallocated"},
+      {"xxx"_b, "_f0000000_1561"},
+    },
+  },
+
+  { "_f0000000_226",
+    {21, 20, 19, 18, 17, 16},
+    { {"000xxx"_b, "unallocated"},
+      {"001000"_b, "unallocated"},
+      {"010000"_b, "unallocated"},
+      {"100000"_b, "unallocated"},
+      {"xxxxxx"_b, "_f0000000_1562"},
+    },
+  },
+
+  { "_f0000000_227",
+    {9, 8},
+    { {"00"_b, "_f0000000_228"},
+      {"01"_b, "_f0000000_231"},
+      {"10"_b, "_f0000000_232"},
+      {"xx"_b, "unallocated"},
+    },
+  },
+
+  { "_f0000000_228",
+    {24},
+    { {"0"_b, "_f0000000_229"},
+      {"1"_b, "_f0000000_230"},
+    },
+  },
+
+  { "_f0000000_229",
+    {21, 20, 19},
+    { {"000"_b, "unallocated"},
+      {"xxx"_b, "_f0000000_1559"},
+    },
+  },
+
+  { "_f0000000_230",
+    {21, 20, 19},
+    { {"000"_b, "unallocated"},
+      {"xxx"_b, "_f0000000_1560"},
+    },
+  },
+
+  { "_f0000000_231",
+    {21, 20, 19},
+    { {"000"_b, "unallocated"},
+      {"xxx"_b, "_f0000000_1561"},
+    },
+  },
+
+  { "_f0000000_232",
+    {21, 20, 19, 18, 17, 16},
+    { {"000xxx"_b, "unallocated"},
+      {"001000"_b, "unallocated"},
+      {"010000"_b, "unallocated"},
+      {"100000"_b, "unallocated"},
+      {"xxxxxx"_b, "_f0000000_1562"},
+    },
+  },
+
+  { "_f0000000_233",
+    {9, 8},
+    { {"00"_b, "_f0000000_234"},
+      {"01"_b, "_f0000000_237"},
+      {"10"_b, "_f0000000_238"},
+      {"xx"_b, "unallocated"},
+    },
+  },
+
+  { "_f0000000_234",
+    {24},
+    { {"0"_b, "_f0000000_235"},
+      {"1"_b, "_f0000000_236"},
+    },
+  },
+
+  { "_f0000000_235",
+    {21, 20, 19},
+    { {"000"_b, "unallocated"},
+      {"xxx"_b, "_f0000000_1559"},
+    },
+  },
+
+  { "_f0000000_236",
+    {21, 20, 19},
+    { {"000"_b, "unallocated"},
+      {"xxx"_b, "_f0000000_1560"},
+    },
+  },
+
+  { "_f0000000_237",
+    {21, 20, 19},
+    { {"000"_b, "unallocated"},
+      {"xxx"_b, "_f0000000_1561"},
+    },
+  },
+
+  { "_f0000000_238",
+    {18, 17, 16},
+    { {"000"_b, "_f0000000_239"},
+      {"xxx"_b, "_f0000000_296"},
+    },
+  },
+
+  { "_f0000000_239",
+    {21, 20, 19, 18, 17, 16},
+    { {"001000"_b, "_f0000000_240"},
+      {"001001"_b, "_f0000000_241"},
+      {"001010"_b, "_f0000000_242"},
+      {"001011"_b, "_f0000000_243"},
+      {"001100"_b, "_f0000000_244"},
+      {"001101"_b, "_f0000000_245"},
+      {"001110"_b, "_f0000000_246"},
+      {"001111"_b, "_f0000000_247"},
+      {"010000"_b, "_f0000000_248"},
+      {"010001"_b, "_f0000000_249"},
+      {"010010"_b, "_f0000000_250"},
+      {"010011"_b, "_f0000000_251"},
+      {"010100"_b, "_f0000000_252"},
+      {"010101"_b, "_f0000000_253"},
+      {"010110"_b, "_f0000000_254"},
+      {"010111"_b, "_f0000000_255"},
+      {"011000"_b, "_f0000000_256"},
+      {"011001"_b, "_f0000000_257"},
+      {"011010"_b, "_f0000000_258"},
+      {"011011"_b, "_f0000000_259"},
+      {"011100"_b, "_f0000000_260"},
+      {"011101"_b, "_f0000000_261"},
+      {"011110"_b, "_f0000000_262"},
+      {"011111"_b, "_f0000000_263"},
+      {"100000"_b, "_f0000000_264"},
+      {"100001"_b, "_f0000000_265"},
+      {"100010"_b, "_f0000000_266"},
+      {"100011"_b, "_f0000000_267"},
+      {"100100"_b, "_f0000000_268"},
+      {"100101"_b, "_f0000000_269"},
+      {"100110"_b, "_f0000000_270"},
+      {"100111"_b, "_f0000000_271"},
+      {"101000"_b, "_f0000000_272"},
+      {"101001"_b, "_f0000000_273"},
+      {"101010"_b, "_f0000000_274"},
+      {"101011"_b, "_f0000000_275"},
+      {"101100"_b, "_f0000000_276"},
+      {"101101"_b, "_f0000000_277"},
+      {"101110"_b, "_f0000000_278"},
+      {"101111"_b, "_f0000000_279"},
+      {"110000"_b, "_f0000000_280"},
+      {"110001"_b, "_f0000000_281"},
+      {"110010"_b, "_f0000000_282"},
+      {"110011"_b, "_f0000000_283"},
+      {"110100"_b, "_f0000000_284"},
+      {"110101"_b, "_f0000000_285"},
+      {"110110"_b, "_f0000000_286"},
+      {"110111"_b, "_f0000000_287"},
+      {"111000"_b, "_f0000000_288"},
+      {"111001"_b, "_f0000000_289"},
+      {"111010"_b, "_f0000000_290"},
+      {"111011"_b, "_f0000000_291"},
+      {"111100"_b, "_f0000000_292"},
+      {"111101"_b, "_f0000000_293"},
+      {"111110"_b, "_f0000000_294"},
+      {"111111"_b, "_f0000000_295"},
+      {"xxxxxx"_b, "unallocated"},
+    },
+  },
+
+  { "_f0000000_240",
+    {21, 20, 19},
+    { {"000"_b, "unallocated"},
+      {"011"_b, "unallocated"},
+      {"101"_b, "unallocated"},
+      {"110"_b, "unallocated"},
+      {"111"_b, "unallocated"},
+      {"xxx"_b, "_f0000000_1563"},
+    },
+  },
+
+  { "_f0000000_1563",
+    {12},
+    { {"0"_b, "vmovl_a1"},
+    },
+  },
+
+  { "_f0000000_241",
+    {21, 20, 19, 18, 17, 16},
+    { {"000xxx"_b, "unallocated"},
+      {"001000"_b, "unallocated"},
+      {"010000"_b, "unallocated"},
+      {"100000"_b, "unallocated"},
+      {"xxxxxx"_b, "_f0000000_1562"},
+    },
+  },
+
+  { "_f0000000_242",
+    {21, 20, 19, 18, 17, 16},
+    { {"000xxx"_b, "unallocated"},
+      {"001000"_b, "unallocated"},
+      {"010000"_b, "unallocated"},
+      {"100000"_b, "unallocated"},
+      {"xxxxxx"_b, "_f0000000_1562"},
+    },
+  },
+
+  { "_f0000000_243",
+    {21, 20, 19, 18, 17, 16},
+    { {"000xxx"_b, "unallocated"},
+      {"001000"_b, "unallocated"},
+      {"010000"_b, "unallocated"},
+      {"100000"_b, "unallocated"},
+      {"xxxxxx"_b, "_f0000000_1562"},
+    },
+  },
+
+  { "_f0000000_244",
+    {21, 20, 19, 18, 17, 16},
+    { {"000xxx"_b, "unallocated"},
+      {"001000"_b, "unallocated"},
+      {"010000"_b, "unallocated"},
+      {"100000"_b, "unallocated"},
+      {"xxxxxx"_b, "_f0000000_1562"},
+    },
+  },
+
+  { "_f0000000_245",
+    {21, 20, 19, 18, 17, 16},
+    { {"000xxx"_b, "unallocated"},
+      {"001000"_b, "unallocated"},
+      {"010000"_b, "unallocated"},
+      {"100000"_b, "unallocated"},
+      {"xxxxxx"_b, "_f0000000_1562"},
+    },
+  },
+
+  { "_f0000000_246",
+    {21, 20, 19, 18, 17, 16},
+    { {"000xxx"_b, "unallocated"},
+      {"001000"_b, "unallocated"},
+      {"010000"_b, "unallocated"},
+      {"100000"_b, "unallocated"},
+      {"xxxxxx"_b, "_f0000000_1562"},
+    },
+  },
+
+  { "_f0000000_247",
+    {21, 20, 19, 18, 17, 16},
+    { {"000xxx"_b, "unallocated"},
+      {"001000"_b, "unallocated"},
+      {"010000"_b, "unallocated"},
+      {"100000"_b, "unallocated"},
+      {"xxxxxx"_b, "_f0000000_1562"},
+    },
+  },
+
+  { "_f0000000_248",
+    {21, 20, 19},
+    { {"000"_b, "unallocated"},
+      {"011"_b, "unallocated"},
+      {"101"_b, "unallocated"},
+      {"110"_b, "unallocated"},
+      {"111"_b, "unallocated"},
+      {"xxx"_b, "_f0000000_1563"},
+    },
+  },
+
+  { "_f0000000_249",
+    {21, 20, 19, 18, 17, 16},
+    { {"000xxx"_b, "unallocated"},
+      {"001000"_b, "unallocated"},
+      {"010000"_b, "unallocated"},
+      {"100000"_b, "unallocated"},
+      {"xxxxxx"_b, "_f0000000_1562"},
+    },
+  },
+
+  { "_f0000000_250",
+    {21, 20, 19, 18, 17, 16},
+    { {"000xxx"_b, "unallocated"},
+      {"001000"_b, "unallocated"},
+      {"010000"_b, "unallocated"},
+      {"100000"_b, "unallocated"},
+      {"xxxxxx"_b, "_f0000000_1562"},
+    },
+  },
+
+  { "_f0000000_251",
+    {21, 20, 19, 18, 17, 16},
+    { {"000xxx"_b, "unallocated"},
+      {"001000"_b, "unallocated"},
+      {"010000"_b, "unallocated"},
+      {"100000"_b, "unallocated"},
+      {"xxxxxx"_b, "_f0000000_1562"},
+    },
+  },
+
+  { "_f0000000_252",
+    {21, 20, 19, 18, 17, 16},
+    { {"000xxx"_b, "unallocated"},
+      {"001000"_b, "unallocated"},
+      {"010000"_b, "unallocated"},
+      {"100000"_b, "unallocated"},
+      {"xxxxxx"_b, "_f0000000_1562"},
+    },
+  },
+
+  { "_f0000000_253",
+    {21, 20, 19, 18, 17, 16},
+    { {"000xxx"_b, "unallocated"},
+      {"001000"_b, "unallocated"},
+      {"010000"_b, "unallocated"},
+      {"100000"_b, "unallocated"},
+      {"xxxxxx"_b, "_f0000000_1562"},
+    },
+  },
+
+  { "_f0000000_254",
+    {21, 20, 19, 18, 17, 16},
+    { {"000xxx"_b, "unallocated"},
+      {"001000"_b, "unallocated"},
+      {"010000"_b, "unallocated"},
+      {"100000"_b, "unallocated"},
+      {"xxxxxx"_b, "_f0000000_1562"},
+    },
+  },
+
+  { "_f0000000_255",
+    {21, 20, 19, 18, 17, 16},
+    { {"000xxx"_b, "unallocated"},
+      {"001000"_b, "unallocated"},
+      {"010000"_b, "unallocated"},
+      {"100000"_b, "unallocated"},
+      {"xxxxxx"_b, "_f0000000_1562"},
+    },
+  },
+
+  { "_f0000000_256",
+    {21, 20, 19, 18, 17, 16},
+    { {"000xxx"_b, "unallocated"},
+      {"001000"_b, "unallocated"},
+      {"010000"_b, "unallocated"},
+      {"100000"_b, "unallocated"},
+      {"xxxxxx"_b, "_f0000000_1562"},
+    },
+  },
+
+  { "_f0000000_257",
+    {21, 20, 19, 18, 17, 16},
+    { {"000xxx"_b, "unallocated"},
+      {"001000"_b, "unallocated"},
+      {"010000"_b, "unallocated"},
+      {"100000"_b, "unallocated"},
+      {"xxxxxx"_b, "_f0000000_1562"},
+    },
+  },
+
+  { "_f0000000_258",
+    {21, 20, 19, 18, 17, 16},
+    { {"000xxx"_b, "unallocated"},
+      {"001000"_b, "unallocated"},
+      {"010000"_b, "unallocated"},
+      {"100000"_b, "unallocated"},
+      {"xxxxxx"_b, "_f0000000_1562"},
+    },
+  },
+
+  { "_f0000000_259",
+    {21, 20, 19, 18, 17, 16},
+    { {"000xxx"_b, "unallocated"},
+      {"001000"_b, "unallocated"},
+      {"010000"_b, "unallocated"},
+      {"100000"_b, "unallocated"},
+      {"xxxxxx"_b, "_f0000000_1562"},
+    },
+  },
+
+  { "_f0000000_260",
+    {21, 20, 19, 18, 17, 16},
+    { {"000xxx"_b, "unallocated"},
+      {"001000"_b, "unallocated"},
+      {"010000"_b, "unallocated"},
+      {"100000"_b, "unallocated"},
+      {"xxxxxx"_b, "_f0000000_1562"},
+    },
+  },
+
+  { "_f0000000_261",
+    {21, 20, 19, 18, 17, 16},
+    { {"000xxx"_b, "unallocated"},
+      {"001000"_b, "unallocated"},
+      {"010000"_b, "unallocated"},
+      {"100000"_b, "unallocated"},
+      {"xxxxxx"_b, "_f0000000_1562"},
+    },
+  },
+
+  { "_f0000000_262",
+    {21, 20, 19, 18, 17, 16},
+    { {"000xxx"_b, "unallocated"},
+      {"001000"_b, "unallocated"},
+      {"010000"_b, "unallocated"},
+      {"100000"_b, "unallocated"},
+      {"xxxxxx"_b, "_f0000000_1562"},
+    },
+  },
+
+  { "_f0000000_263",
+    {21, 20, 19, 18, 17, 16},
+    { {"000xxx"_b, "unallocated"},
+      {"001000"_b, "unallocated"},
+      {"010000"_b, "unallocated"},
+      {"100000"_b, "unallocated"},
+      {"xxxxxx"_b, "_f0000000_1562"},
+    },
+  },
+
+  { "_f0000000_264",
+    {21, 20, 19},
+    { {"000"_b, "unallocated"},
+      {"011"_b, "unallocated"},
+      {"101"_b, "unallocated"},
+      {"110"_b, "unallocated"},
+      {"111"_b, "unallocated"},
+      {"xxx"_b, "_f0000000_1563"},
+    },
+  },
+
+  { "_f0000000_265",
+    {21, 20, 19, 18, 17, 16},
+    { {"000xxx"_b, "unallocated"},
+      {"001000"_b, "unallocated"},
+      {"010000"_b, "unallocated"},
+      {"100000"_b, "unallocated"},
+      {"xxxxxx"_b, "_f0000000_1562"},
+    },
+  },
+
+  { "_f0000000_266",
+    {21, 20, 19, 18, 17, 16},
+    { {"000xxx"_b, "unallocated"},
+      {"001000"_b, "unallocated"},
+      {"010000"_b, "unallocated"},
+      {"100000"_b, "unallocated"},
+      {"xxxxxx"_b, "_f0000000_1562"},
+    },
+  },
+
+  { "_f0000000_267",
+    {21, 20, 19, 18, 17, 16},
+    { {"000xxx"_b, "unallocated"},
+      {"001000"_b, "unallocated"},
+      {"010000"_b, "unallocated"},
+      {"100000"_b, "unallocated"},
+      {"xxxxxx"_b, "_f0000000_1562"},
+    },
+  },
+
+  { "_f0000000_268",
+    {21, 20, 19, 18, 17, 16},
+    { {"000xxx"_b, "unallocated"},
+      {"001000"_b, "unallocated"},
+      {"010000"_b, "unallocated"},
+      {"100000"_b, "unallocated"},
+      {"xxxxxx"_b, "_f0000000_1562"},
+    },
+  },
+
+  { "_f0000000_269",
+    {21, 20, 19, 18, 17, 16},
+    { {"000xxx"_b, "unallocated"},
+      {"001000"_b, "unallocated"},
+      {"010000"_b, "unallocated"},
+      {"100000"_b, "unallocated"},
+      {"xxxxxx"_b, "_f0000000_1562"},
+    },
+  },
+
+  { "_f0000000_270",
+    {21, 20, 19, 18, 17, 16},
+    { {"000xxx"_b, "unallocated"},
+      {"001000"_b, "unallocated"},
+      {"010000"_b, "unallocated"},
+      {"100000"_b, "unallocated"},
+      {"xxxxxx"_b, "_f0000000_1562"},
+    },
+  },
+
+  { "_f0000000_271",
+    {21, 20, 19, 18, 17, 16},
+    { {"000xxx"_b, "unallocated"},
+      {"001000"_b, "unallocated"},
+      {"010000"_b, "unallocated"},
+      {"100000"_b, "unallocated"},
+      {"xxxxxx"_b, "_f0000000_1562"},
+    },
+  },
+
+  { "_f0000000_272",
+    {21, 20, 19, 18, 17, 16},
+    { {"000xxx"_b, "unallocated"},
+      {"001000"_b, "unallocated"},
+      {"010000"_b, "unallocated"},
+      {"100000"_b, "unallocated"},
+      {"xxxxxx"_b, "_f0000000_1562"},
+    },
+  },
+
+  { "_f0000000_273",
+    {21, 20, 19, 18, 17, 16},
+    { {"000xxx"_b, "unallocated"},
+      {"001000"_b, "unallocated"},
+      {"010000"_b, "unallocated"},
+      {"100000"_b, "unallocated"},
+      {"xxxxxx"_b, "_f0000000_1562"},
+    },
+  },
+
+  { "_f0000000_274",
+    {21, 20, 19, 18, 17, 16},
+    { {"000xxx"_b, "unallocated"},
+      {"001000"_b, "unallocated"},
+      {"010000"_b, "unallocated"},
+      {"100000"_b, "unallocated"},
+      {"xxxxxx"_b, "_f0000000_1562"},
+    },
+  },
+
+  { "_f0000000_275",
+    {21, 20, 19, 18, 17, 16},
+    { {"000xxx"_b, "unallocated"},
+      {"001000"_b, "unallocated"},
+      {"010000"_b, "unallocated"},
+      {"100000"_b, "unallocated"},
+      {"xxxxxx"_b, "_f0000000_1562"},
+    },
+  },
+
+  { "_f0000000_276",
+    {21, 20, 19, 18, 17, 16},
+    { {"000xxx"_b, "unallocated"},
+      {"001000"_b, "unallocated"},
+      {"010000"_b, "unallocated"},
+      {"100000"_b, "unallocated"},
+      {"xxxxxx"_b, "_f0000000_1562"},
+    },
+  },
+
+  { "_f0000000_277",
+    {21, 20, 19, 18, 17, 16},
+    { {"000xxx"_b, "unallocated"},
+      {"001000"_b, "unallocated"},
+      {"010000"_b, "unallocated"},
+      {"100000"_b, "unallocated"},
+      {"xxxxxx"_b, "_f0000000_1562"},
+    },
+  },
+
+  { "_f0000000_278",
+    {21, 20, 19, 18, 17, 16},
+    { {"000xxx"_b, "unallocated"},
+      {"001000"_b, "unallocated"},
+      {"010000"_b, "unallocated"},
+      {"100000"_b, "unallocated"},
+      {"xxxxxx"_b, "_f0000000_1562"},
+    },
+  },
+
+  { "_f0000000_279",
+    {21, 20, 19, 18, 17, 16},
+    { {"000xxx"_b, "unallocated"},
+      {"001000"_b, "unallocated"},
+      {"010000"_b, "unallocated"},
+      {"100000"_b, "unallocated"},
+      {"xxxxxx"_b, "_f0000000_1562"},
+    },
+  },
+
+  { "_f0000000_280",
+    {21, 20, 19, 18, 17, 16},
+    { {"000xxx"_b, "unallocated"},
+      {"001000"_b, "unallocated"},
+      {"010000"_b, "unallocated"},
+      {"100000"_b, "unallocated"},
+      {"xxxxxx"_b, "_f0000000_1562"},
+    },
+  },
+
+  { "_f0000000_281",
+    {21, 20, 19, 18, 17, 16},
+    { {"000xxx"_b, "unallocated"},
+      {"001000"_b, "unallocated"},
+      {"010000"_b, "unallocated"},
+      {"100000"_b, "unallocated"},
+      {"xxxxxx"_b, "_f0000000_1562"},
+    },
+  },
+
+  { "_f0000000_282",
+    {21, 20, 19, 18, 17, 16},
+    { {"000xxx"_b, "unallocated"},
+      {"001000"_b, "unallocated"},
+      {"010000"_b, "unallocated"},
+      {"100000"_b, "unallocated"},
+      {"xxxxxx"_b, "_f0000000_1562"},
+    },
+  },
+
+  { "_f0000000_283",
+    {21, 20, 19, 18, 17, 16},
+    { {"000xxx"_b, "unallocated"},
+      {"001000"_b, "unallocated"},
+      {"010000"_b, "unallocated"},
+      {"100000"_b, "unallocated"},
+      {"xxxxxx"_b, "_f0000000_1562"},
+    },
+  },
+
+  { "_f0000000_284",
+    {21, 20, 19, 18, 17, 16},
+    { {"000xxx"_b, "unallocated"},
+      {"001000"_b, "unallocated"},
+      {"010000"_b, "unallocated"},
+      {"100000"_b, "unallocated"},
+      {"xxxxxx"_b, "_f0000000_1562"},
+    },
+  },
+
+  { "_f0000000_285",
+    {21, 20, 19, 18, 17, 16},
+    { {"000xxx"_b, "unallocated"},
+      {"001000"_b, "unallocated"},
+      {"010000"_b, "unallocated"},
+      {"100000"_b, "unallocated"},
+      {"xxxxxx"_b, "_f0000000_1562"},
+    },
+  },
+
+  { "_f0000000_286",
+    {21, 20, 19, 18, 17, 16},
+    { {"000xxx"_b, "unallocated"},
+      {"001000"_b, "unallocated"},
+      {"010000"_b, "unallocated"},
+      {"100000"_b, "unallocated"},
+      {"xxxxxx"_b, "_f0000000_1562"},
+    },
+  },
+
+  { "_f0000000_287",
+    {21, 20, 19, 18, 17, 16},
+    { {"000xxx"_b, "unallocated"},
+      {"001000"_b, "unallocated"},
+      {"010000"_b, "unallocated"},
+      {"100000"_b, "unallocated"},
+      {"xxxxxx"_b, "_f0000000_1562"},
+    },
+  },
+
+  { "_f0000000_288",
+    {21, 20, 19, 18, 17, 16},
+    { {"000xxx"_b, "unallocated"},
+      {"001000"_b, "unallocated"},
+      {"010000"_b, "unallocated"},
+      {"100000"_b, "unallocated"},
+      {"xxxxxx"_b, "_f0000000_1562"},
+    },
+  },
+
+  { "_f0000000_289",
+    {21, 20, 19, 18, 17, 16},
+    { {"000xxx"_b, "unallocated"},
+      {"001000"_b, "unallocated"},
+      {"010000"_b, "unallocated"},
+      {"100000"_b, "unallocated"},
+      {"xxxxxx"_b, "_f0000000_1562"},
+    },
+  },
+
+  { "_f0000000_290",
+    {21, 20, 19, 18, 17, 16},
+    { {"000xxx"_b, "unallocated"},
+      {"001000"_b, "unallocated"},
+      {"010000"_b, "unallocated"},
+      {"100000"_b, "unallocated"},
+      {"xxxxxx"_b, "_f0000000_1562"},
+    },
+  },
+
+  { "_f0000000_291",
+    {21, 20, 19, 18, 17, 16},
+    { {"000xxx"_b, "unallocated"},
+      {"001000"_b, "unallocated"},
+      {"010000"_b, "unallocated"},
+      {"100000"_b, "unallocated"},
+      {"xxxxxx"_b, "_f0000000_1562"},
+    },
+  },
+
+  { "_f0000000_292",
+    {21, 20, 19, 18, 17, 16},
+    { {"000xxx"_b, "unallocated"},
+      {"001000"_b, "unallocated"},
+      {"010000"_b, "unallocated"},
+      {"100000"_b, "unallocated"},
+      {"xxxxxx"_b, "_f0000000_1562"},
+    },
+  },
+
+  { "_f0000000_293",
+    {21, 20, 19, 18, 17, 16},
+    { {"000xxx"_b, "unallocated"},
+      {"001000"_b, "unallocated"},
+      {"010000"_b, "unallocated"},
+      {"100000"_b, "unallocated"},
+      {"xxxxxx"_b, "_f0000000_1562"},
+    },
+  },
+
+  { "_f0000000_294",
+    {21, 20, 19, 18, 17, 16},
+    { {"000xxx"_b, "unallocated"},
+      {"001000"_b, "unallocated"},
+      {"010000"_b, "unallocated"},
+      {"100000"_b, "unallocated"},
+      {"xxxxxx"_b, "_f0000000_1562"},
+    },
+  },
+
+  { "_f0000000_295",
+    {21, 20, 19, 18, 17, 16},
+    { {"000xxx"_b, "unallocated"},
+      {"001000"_b, "unallocated"},
+      {"010000"_b, "unallocated"},
+      {"100000"_b, "unallocated"},
+      {"xxxxxx"_b, "_f0000000_1562"},
+    },
+  },
+
+  { "_f0000000_296",
+    {21, 20, 19, 18, 17, 16},
+    { {"000xxx"_b, "unallocated"},
+      {"001000"_b, "unallocated"},
+      {"010000"_b, "unallocated"},
+      {"100000"_b, "unallocated"},
+      {"xxxxxx"_b, "_f0000000_1562"},
+    },
+  },
+
+  { "_f0000000_297",
+    {7},
+    { {"0"_b, "_f0000000_298"},
+      {"x"_b, "unallocated"},
+    },
+  },
+
+  { "_f0000000_298",
+    {21},
+    { {"0"_b, "_f0000000_299"},
+      {"x"_b, "_f0000000_325"},
+    },
+  },
+
+  { "_f0000000_299",
+    {20, 19},
+    { {"00"_b, "_f0000000_300"},
+      {"xx"_b, "unallocated"},
+    },
+  },
+
+  { "_f0000000_300",
+    {9, 8},
+    { {"10"_b, "_f0000000_301"},
+      {"11"_b, "_f0000000_302"},
+      {"xx"_b, "_f0000000_303"},
+    },
+  },
+
+  { "_f0000000_301",
+    {11, 10, 9, 8, 5},
+    { {"0xx10"_b, "unallocated"},
+      {"x0x10"_b, "unallocated"},
+      {"0xxx1"_b, "unallocated"},
+      {"x0xx1"_b, "unallocated"},
+      {"xx0x1"_b, "unallocated"},
+      {"xxx11"_b, "unallocated"},
+      {"xxxxx"_b, "vmov_imm_d_a1"},
+    },
+  },
+
+  { "_f0000000_302",
+    {11, 10, 9, 8, 5},
+    { {"0xx10"_b, "unallocated"},
+      {"x0x10"_b, "unallocated"},
+      {"0xxx1"_b, "unallocated"},
+      {"x0xx1"_b, "unallocated"},
+      {"xx0x1"_b, "unallocated"},
+      {"xxx11"_b, "unallocated"},
+      {"xxxxx"_b, "vmov_imm_d_a1"},
+    },
+  },
+
+  { "_f0000000_303",
+    {5},
+    { {"1"_b, "_f0000000_304"},
+      {"x"_b, "_f0000000_324"},
+    },
+  },
+
+  { "_f0000000_304",
+    {11, 10, 9, 8, 5},
+    { {"00000"_b, "_f0000000_305"},
+      {"00001"_b, "_f0000000_306"},
+      {"00100"_b, "_f0000000_307"},
+      {"00101"_b, "_f0000000_308"},
+      {"01000"_b, "_f0000000_309"},
+      {"01001"_b, "_f0000000_310"},
+      {"01100"_b, "_f0000000_311"},
+      {"01101"_b, "_f0000000_312"},
+      {"10000"_b, "_f0000000_313"},
+      {"10001"_b, "_f0000000_314"},
+      {"10100"_b, "_f0000000_315"},
+      {"10101"_b, "_f0000000_316"},
+      {"11000"_b, "_f0000000_317"},
+      {"11001"_b, "_f0000000_318"},
+      {"11010"_b, "_f0000000_319"},
+      {"11011"_b, "_f0000000_320"},
+      {"11100"_b, "_f0000000_321"},
+      {"11101"_b, "_f0000000_322"},
+      {"11110"_b, "_f0000000_323"},
+      {"xxxxx"_b, "unallocated"},
+    },
+  },
+
+  { "_f0000000_305",
+    {11, 10, 9, 8, 5},
+    { {"0xx10"_b, "unallocated"},
+      {"x0x10"_b, "unallocated"},
+      {"0xxx1"_b, "unallocated"},
+      {"x0xx1"_b, "unallocated"},
+      {"xx0x1"_b, "unallocated"},
+      {"xxx11"_b, "unallocated"},
+      {"xxxxx"_b, "vmov_imm_d_a1"},
+    },
+  },
+
+  { "_f0000000_306",
+    {11, 10, 9, 8},
+    { {"00x1"_b, "unallocated"},
+      {"01x1"_b, "unallocated"},
+      {"10x1"_b, "unallocated"},
+      {"111x"_b, "unallocated"},
+      {"xxxx"_b, "vmvn_imm_d_a1"},
+    },
+  },
+
+  { "_f0000000_307",
+    {11, 10, 9, 8, 5},
+    { {"0xx10"_b, "unallocated"},
+      {"x0x10"_b, "unallocated"},
+      {"0xxx1"_b, "unallocated"},
+      {"x0xx1"_b, "unallocated"},
+      {"xx0x1"_b, "unallocated"},
+      {"xxx11"_b, "unallocated"},
+      {"xxxxx"_b, "vmov_imm_d_a1"},
+    },
+  },
+
+  { "_f0000000_308",
+    {11, 10, 9, 8},
+    { {"00x1"_b, "unallocated"},
+      {"01x1"_b, "unallocated"},
+      {"10x1"_b, "unallocated"},
+      {"111x"_b, "unallocated"},
+      {"xxxx"_b, "vmvn_imm_d_a1"},
+    },
+  },
+
+  { "_f0000000_309",
+    {11, 10, 9, 8, 5},
+    { {"0xx10"_b, "unallocated"},
+      {"x0x10"_b, "unallocated"},
+      {"0xxx1"_b, "unallocated"},
+      {"x0xx1"_b, "unallocated"},
+      {"xx0x1"_b, "unallocated"},
+      {"xxx11"_b, "unallocated"},
+      {"xxxxx"_b, "vmov_imm_d_a1"},
+    },
+  },
+
+  { "_f0000000_310",
+    {11, 10, 9, 8},
+    { {"00x1"_b, "unallocated"},
+      {"01x1"_b, "unallocated"},
+      {"10x1"_b, "unallocated"},
+      {"111x"_b, "unallocated"},
+      {"xxxx"_b, "vmvn_imm_d_a1"},
+    },
+  },
+
+  { "_f0000000_311",
+    {11, 10, 9, 8, 5},
+    { {"0xx10"_b, "unallocated"},
+      {"x0x10"_b, "unallocated"},
+      {"0xxx1"_b, "unallocated"},
+      {"x0xx1"_b, "unallocated"},
+      {"xx0x1"_b, "unallocated"},
+      {"xxx11"_b, "unallocated"},
+      {"xxxxx"_b, "vmov_imm_d_a1"},
+    },
+  },
+
+  { "_f0000000_312",
+    {11, 10, 9, 8},
+    { {"00x1"_b, "unallocated"},
+      {"01x1"_b, "unallocated"},
+      {"10x1"_b, "unallocated"},
+      {"111x"_b, "unallocated"},
+      {"xxxx"_b, "vmvn_imm_d_a1"},
+    },
+  },
+
+  { "_f0000000_313",
+    {11, 10, 9, 8, 5},
+    { {"0xx10"_b, "unallocated"},
+      {"x0x10"_b, "unallocated"},
+      {"0xxx1"_b, "unallocated"},
+      {"x0xx1"_b, "unallocated"},
+      {"xx0x1"_b, "unallocated"},
+      {"xxx11"_b, "unallocated"},
+      {"xxxxx"_b, "vmov_imm_d_a1"},
+    },
+  },
+
+  { "_f0000000_314",
+    {11, 10, 9, 8},
+    { {"00x1"_b, "unallocated"},
+      {"01x1"_b, "unallocated"},
+      {"10x1"_b, "unallocated"},
+      {"111x"_b, "unallocated"},
+      {"xxxx"_b, "vmvn_imm_d_a1"},
+    },
+  },
+
+  { "_f0000000_315",
+    {11, 10, 9, 8, 5},
+    { {"0xx10"_b, "unallocated"},
+      {"x0x10"_b, "unallocated"},
+      {"0xxx1"_b, "unallocated"},
+      {"x0xx1"_b, "unallocated"},
+      {"xx0x1"_b, "unallocated"},
+      {"xxx11"_b, "unallocated"},
+      {"xxxxx"_b, "vmov_imm_d_a1"},
+    },
+  },
+
+  { "_f0000000_316",
+    {11, 10, 9, 8},
+    { {"00x1"_b, "unallocated"},
+      {"01x1"_b, "unallocated"},
+      {"10x1"_b, "unallocated"},
+      {"111x"_b, "unallocated"},
+      {"xxxx"_b, "vmvn_imm_d_a1"},
+    },
+  },
+
+  { "_f0000000_317",
+    {11, 10, 9, 8, 5},
+    { {"0xx10"_b, "unallocated"},
+      {"x0x10"_b, "unallocated"},
+      {"0xxx1"_b, "unallocated"},
+      {"x0xx1"_b, "unallocated"},
+      {"xx0x1"_b, "unallocated"},
+      {"xxx11"_b, "unallocated"},
+      {"xxxxx"_b, "vmov_imm_d_a1"},
+    },
+  },
+
+  { "_f0000000_318",
+    {11, 10, 9, 8},
+    { {"00x1"_b, "unallocated"},
+      {"01x1"_b, "unallocated"},
+      {"10x1"_b, "unallocated"},
+      {"111x"_b, "unallocated"},
+      {"xxxx"_b, "vmvn_imm_d_a1"},
+    },
+  },
+
+  { "_f0000000_319",
+    {11, 10, 9, 8, 5},
+    { {"0xx10"_b, "unallocated"},
+      {"x0x10"_b, "unallocated"},
+      {"0xxx1"_b, "unallocated"},
+      {"x0xx1"_b, "unallocated"},
+      {"xx0x1"_b, "unallocated"},
+      {"xxx11"_b, "unallocated"},
+      {"xxxxx"_b, "vmov_imm_d_a1"},
+    },
+  },
+
+  { "_f0000000_320",
+    {11, 10, 9, 8},
+    { {"00x1"_b, "unallocated"},
+      {"01x1"_b, "unallocated"},
+      {"10x1"_b, "unallocated"},
+      {"111x"_b, "unallocated"},
+      {"xxxx"_b, "vmvn_imm_d_a1"},
+    },
+  },
+
+  { "_f0000000_321",
+    {11, 10, 9, 8, 5},
+    { {"0xx10"_b, "unallocated"},
+      {"x0x10"_b, "unallocated"},
+      {"0xxx1"_b, "unallocated"},
+      {"x0xx1"_b, "unallocated"},
+      {"xx0x1"_b, "unallocated"},
+      {"xxx11"_b, "unallocated"},
+      {"xxxxx"_b, "vmov_imm_d_a1"},
+    },
+  },
+
+  { "_f0000000_322",
+    {11, 10, 9, 8, 5},
+    { {"0xx10"_b, "unallocated"},
+      {"x0x10"_b, "unallocated"},
+      {"0xxx1"_b, "unallocated"},
+      {"x0xx1"_b, "unallocated"},
+      {"xx0x1"_b, "unallocated"},
+      {"xxx11"_b, "unallocated"},
+      {"xxxxx"_b, "vmov_imm_d_a1"},
+    },
+  },
+
+  { "_f0000000_323",
+    {11, 10, 9, 8, 5},
+    { {"0xx10"_b, "unallocated"},
+      {"x0x10"_b, "unallocated"},
+      {"0xxx1"_b, "unallocated"},
+      {"x0xx1"_b, "unallocated"},
+      {"xx0x1"_b, "unallocated"},
+      {"xxx11"_b, "unallocated"},
+      {"xxxxx"_b, "vmov_imm_d_a1"},
+    },
+  },
+
+  { "_f0000000_324",
+    {11, 10, 9, 8, 5},
+    { {"0xx10"_b, "unallocated"},
+      {"x0x10"_b, "unallocated"},
+      {"0xxx1"_b, "unallocated"},
+      {"x0xx1"_b, "unallocated"},
+      {"xx0x1"_b, "unallocated"},
+      {"xxx11"_b, "unallocated"},
+      {"xxxxx"_b, "vmov_imm_d_a1"},
+    },
+  },
+
+  { "_f0000000_325",
+    {9},
+    { {"1"_b, "_f0000000_326"},
+      {"x"_b, "unallocated"},
+    },
+  },
+
+  { "_f0000000_326",
+    {21},
+    { {"0"_b, "unallocated"},
+      {"x"_b, "vcvt_fx_d_a1"},
+    },
+  },
+
+  { "_f0000000_327",
+    {11, 10},
+    { {"00"_b, "_f0000000_328"},
+      {"01"_b, "_f0000000_342"},
+      {"10"_b, "_f0000000_359"},
+      {"11"_b, "_f0000000_374"},
+    },
+  },
+
+  { "_f0000000_328",
+    {21, 20, 19, 7},
+    { {"0000"_b, "_f0000000_329"},
+      {"xxxx"_b, "_f0000000_337"},
+    },
+  },
+
+  { "_f0000000_329",
+    {8},
+    { {"0"_b, "_f0000000_330"},
+      {"1"_b, "_f0000000_334"},
+    },
+  },
+
+  { "_f0000000_330",
+    {9},
+    { {"x"_b, "_f0000000_331"},
+    },
+  },
+
+  { "_f0000000_331",
+    {5},
+    { {"1"_b, "_f0000000_332"},
+      {"x"_b, "_f0000000_333"},
+    },
+  },
+
+  { "_f0000000_332",
+    {11, 10, 9, 8},
+    { {"00x1"_b, "unallocated"},
+      {"01x1"_b, "unallocated"},
+      {"10x1"_b, "unallocated"},
+      {"111x"_b, "unallocated"},
+      {"xxxx"_b, "_f0000000_1564"},
+    },
+  },
+
+  { "_f0000000_1564",
+    {12},
+    { {"0"_b, "vmvn_imm_q_a1"},
+    },
+  },
+
+  { "_f0000000_333",
+    {11, 10, 9, 8, 5},
+    { {"0xx10"_b, "unallocated"},
+      {"x0x10"_b, "unallocated"},
+      {"0xxx1"_b, "unallocated"},
+      {"x0xx1"_b, "unallocated"},
+      {"xx0x1"_b, "unallocated"},
+      {"xxx11"_b, "unallocated"},
+      {"xxxxx"_b, "_f0000000_1565"},
+    },
+  },
+
+  { "_f0000000_1565",
+    {12},
+    { {"0"_b, "vmov_imm_q_a1"},
+    },
+  },
+
+  { "_f0000000_334",
+    {5},
+    { {"0"_b, "_f0000000_335"},
+      {"1"_b, "_f0000000_336"},
+    },
+  },
+
+  { "_f0000000_335",
+    {11, 10, 8},
+    { {"xx0"_b, "unallocated"},
+      {"11x"_b, "unallocated"},
+      {"xxx"_b, "_f0000000_1566"},
+    },
+  },
+
+  { "_f0000000_1566",
+    {12},
+    { {"0"_b, "vorr_q_a1"},
+    },
+  },
+
+  { "_f0000000_336",
+    {11, 10, 8},
+    { {"xx0"_b, "unallocated"},
+      {"11x"_b, "unallocated"},
+      {"xxx"_b, "_f0000000_1567"},
+    },
+  },
+
+  { "_f0000000_1567",
+    {12},
+    { {"0"_b, "vbic_imm_q_a1"},
+    },
+  },
+
+  { "_f0000000_337",
+    {9, 8},
+    { {"00"_b, "_f0000000_338"},
+      {"01"_b, "_f0000000_339"},
+      {"10"_b, "_f0000000_340"},
+      {"11"_b, "_f0000000_341"},
+    },
+  },
+
+  { "_f0000000_338",
+    {21, 20, 19, 7},
+    { {"0000"_b, "unallocated"},
+      {"xxxx"_b, "_f0000000_1568"},
+    },
+  },
+
+  { "_f0000000_1568",
+    {12, 0},
+    { {"00"_b, "vshr_q_a1"},
+    },
+  },
+
+  { "_f0000000_339",
+    {21, 20, 19, 7},
+    { {"0000"_b, "unallocated"},
+      {"xxxx"_b, "_f0000000_1569"},
+    },
+  },
+
+  { "_f0000000_1569",
+    {12, 0},
+    { {"00"_b, "vsra_q_a1"},
+    },
+  },
+
+  { "_f0000000_340",
+    {21, 20, 19, 7},
+    { {"0000"_b, "unallocated"},
+      {"xxxx"_b, "_f0000000_1570"},
+    },
+  },
+
+  { "_f0000000_1570",
+    {12, 0},
+    { {"00"_b, "vrshr_q_a1"},
+    },
+  },
+
+  { "_f0000000_341",
+    {21, 20, 19, 7},
+    { {"0000"_b, "unallocated"},
+      {"xxxx"_b, "_f0000000_1571"},
+    },
+  },
+
+  { "_f0000000_1571",
+    {12, 0},
+    { {"00"_b, "vrsra_q_a1"},
+    },
+  },
+
+  { "_f0000000_342",
+    {21, 20, 19, 7},
+    { {"0000"_b, "_f0000000_343"},
+      {"xxxx"_b, "_f0000000_351"},
+    },
+  },
+
+  { "_f0000000_343",
+    {8},
+    { {"0"_b, "_f0000000_344"},
+      {"1"_b, "_f0000000_348"},
+    },
+  },
+
+  { "_f0000000_344",
+    {9},
+    { {"x"_b, "_f0000000_345"},
+    },
+  },
+
+  { "_f0000000_345",
+    {5},
+    { {"1"_b, "_f0000000_346"},
+      {"x"_b, "_f0000000_347"},
+    },
+  },
+
+  { "_f0000000_346",
+    {11, 10, 9, 8},
+    { {"00x1"_b, "unallocated"},
+      {"01x1"_b, "unallocated"},
+      {"10x1"_b, "unallocated"},
+      {"111x"_b, "unallocated"},
+      {"xxxx"_b, "_f0000000_1564"},
+    },
+  },
+
+  { "_f0000000_347",
+    {11, 10, 9, 8, 5},
+    { {"0xx10"_b, "unallocated"},
+      {"x0x10"_b, "unallocated"},
+      {"0xxx1"_b, "unallocated"},
+      {"x0xx1"_b, "unallocated"},
+      {"xx0x1"_b, "unallocated"},
+      {"xxx11"_b, "unallocated"},
+      {"xxxxx"_b, "_f0000000_1565"},
+    },
+  },
+
+  { "_f0000000_348",
+    {5},
+    { {"0"_b, "_f0000000_349"},
+      {"1"_b, "_f0000000_350"},
+    },
+  },
+
+  { "_f0000000_349",
+    {11, 10, 8},
+    { {"xx0"_b, "unallocated"},
+      {"11x"_b, "unallocated"},
+      {"xxx"_b, "_f0000000_1566"},
+    },
+  },
+
+  { "_f0000000_350",
+    {11, 10, 8},
+    { {"xx0"_b, "unallocated"},
+      {"11x"_b, "unallocated"},
+      {"xxx"_b, "_f0000000_1567"},
+    },
+  },
+
+  { "_f0000000_351",
+    {9, 8},
+    { {"00"_b, "_f0000000_352"},
+      {"01"_b, "_f0000000_354"},
+      {"10"_b, "_f0000000_357"},
+      {"11"_b, "_f0000000_358"},
+    },
+  },
+
+  { "_f0000000_352",
+    {24},
+    { {"1"_b, "_f0000000_353"},
+      {"x"_b, "unallocated"},
+    },
+  },
+
+  { "_f0000000_353",
+    {21, 20, 19, 7},
+    { {"0000"_b, "unallocated"},
+      {"xxxx"_b, "_f0000000_1572"},
+    },
+  },
+
+  { "_f0000000_1572",
+    {12, 0},
+    { {"00"_b, "vsri_q_a1"},
+    },
+  },
+
+  { "_f0000000_354",
+    {24},
+    { {"0"_b, "_f0000000_355"},
+      {"1"_b, "_f0000000_356"},
+    },
+  },
+
+  { "_f0000000_355",
+    {21, 20, 19, 7},
+    { {"0000"_b, "unallocated"},
+      {"xxxx"_b, "_f0000000_1573"},
+    },
+  },
+
+  { "_f0000000_1573",
+    {12, 0},
+    { {"00"_b, "vshl_imm_q_a1"},
+    },
+  },
+
+  { "_f0000000_356",
+    {21, 20, 19, 7},
+    { {"0000"_b, "unallocated"},
+      {"xxxx"_b, "_f0000000_1574"},
+    },
+  },
+
+  { "_f0000000_1574",
+    {12, 0},
+    { {"00"_b, "vsli_q_a1"},
+    },
+  },
+
+  { "_f0000000_357",
+    {21, 20, 19, 7},
+    { {"0000"_b, "unallocated"},
+      {"xxxx"_b, "_f0000000_1575"},
+    },
+  },
+
+  { "_f0000000_1575",
+    {12, 0},
+    { {"00"_b, "vqshlu_q_a1"},
+    },
+  },
+
+  { "_f0000000_358",
+    {21, 20, 19, 7},
+    { {"0000"_b, "unallocated"},
+      {"xxxx"_b, "_f0000000_1576"},
+    },
+  },
+
+  { "_f0000000_1576",
+    {12, 0},
+    { {"00"_b, "vqshl_imm_q_a1"},
+    },
+  },
+
+  { "_f0000000_359",
+    {7},
+    { {"0"_b, "_f0000000_360"},
+      {"x"_b, "unallocated"},
+    },
+  },
+
+  { "_f0000000_360",
+    {21, 20, 19},
+    { {"000"_b, "_f0000000_361"},
+      {"xxx"_b, "_f0000000_369"},
+    },
+  },
+
+  { "_f0000000_361",
+    {8},
+    { {"0"_b, "_f0000000_362"},
+      {"1"_b, "_f0000000_366"},
+    },
+  },
+
+  { "_f0000000_362",
+    {9},
+    { {"x"_b, "_f0000000_363"},
+    },
+  },
+
+  { "_f0000000_363",
+    {5},
+    { {"1"_b, "_f0000000_364"},
+      {"x"_b, "_f0000000_365"},
+    },
+  },
+
+  { "_f0000000_364",
+    {11, 10, 9, 8},
+    { {"00x1"_b, "unallocated"},
+      {"01x1"_b, "unallocated"},
+      {"10x1"_b, "unallocated"},
+      {"111x"_b, "unallocated"},
+      {"xxxx"_b, "_f0000000_1564"},
+    },
+  },
+
+  { "_f0000000_365",
+    {11, 10, 9, 8, 5},
+    { {"0xx10"_b, "unallocated"},
+      {"x0x10"_b, "unallocated"},
+      {"0xxx1"_b, "unallocated"},
+      {"x0xx1"_b, "unallocated"},
+      {"xx0x1"_b, "unallocated"},
+      {"xxx11"_b, "unallocated"},
+      {"xxxxx"_b, "_f0000000_1565"},
+    },
+  },
+
+  { "_f0000000_366",
+    {5},
+    { {"0"_b, "_f0000000_367"},
+      {"1"_b, "_f0000000_368"},
+    },
+  },
+
+  { "_f0000000_367",
+    {11, 10, 8},
+    { {"xx0"_b, "unallocated"},
+      {"11x"_b, "unallocated"},
+      {"xxx"_b, "_f0000000_1566"},
+    },
+  },
+
+  { "_f0000000_368",
+    {11, 10, 8},
+    { {"xx0"_b, "unallocated"},
+      {"11x"_b, "unallocated"},
+      {"xxx"_b, "_f0000000_1567"},
+    },
+  },
+
+  { "_f0000000_369",
+    {9, 8},
+    { {"00"_b, "_f0000000_370"},
+      {"01"_b, "_f0000000_373"},
+      {"xx"_b, "unallocated"},
+    },
+  },
+
+  { "_f0000000_370",
+    {24},
+    { {"0"_b, "_f0000000_371"},
+      {"1"_b, "_f0000000_372"},
+    },
+  },
+
+  { "_f0000000_371",
+    {21, 20, 19},
+    { {"000"_b, "unallocated"},
+      {"xxx"_b, "_f0000000_1577"},
+    },
+  },
+
+  { "_f0000000_1577",
+    {0},
+    { {"0"_b, "vrshrn_a1"},
+    },
+  },
+
+  { "_f0000000_372",
+    {21, 20, 19},
+    { {"000"_b, "unallocated"},
+      {"xxx"_b, "_f0000000_1578"},
+    },
+  },
+
+  { "_f0000000_1578",
+    {0},
+    { {"0"_b, "vqrshrun_a1"},
+    },
+  },
+
+  { "_f0000000_373",
+    {21, 20, 19},
+    { {"000"_b, "unallocated"},
+      {"xxx"_b, "_f0000000_1579"},
+    },
+  },
+
+  { "_f0000000_1579",
+    {0},
+    { {"0"_b, "vqrshrn_a1"},
+    },
+  },
+
+  { "_f0000000_374",
+    {7},
+    { {"0"_b, "_f0000000_375"},
+      {"x"_b, "unallocated"},
+    },
+  },
+
+  { "_f0000000_375",
+    {21},
+    { {"0"_b, "_f0000000_376"},
+      {"x"_b, "_f0000000_402"},
+    },
+  },
+
+  { "_f0000000_376",
+    {20, 19},
+    { {"00"_b, "_f0000000_377"},
+      {"xx"_b, "unallocated"},
+    },
+  },
+
+  { "_f0000000_377",
+    {9, 8},
+    { {"10"_b, "_f0000000_378"},
+      {"11"_b, "_f0000000_379"},
+      {"xx"_b, "_f0000000_380"},
+    },
+  },
+
+  { "_f0000000_378",
+    {11, 10, 9, 8, 5},
+    { {"0xx10"_b, "unallocated"},
+      {"x0x10"_b, "unallocated"},
+      {"0xxx1"_b, "unallocated"},
+      {"x0xx1"_b, "unallocated"},
+      {"xx0x1"_b, "unallocated"},
+      {"xxx11"_b, "unallocated"},
+      {"xxxxx"_b, "_f0000000_1565"},
+    },
+  },
+
+  { "_f0000000_379",
+    {11, 10, 9, 8, 5},
+    { {"0xx10"_b, "unallocated"},
+      {"x0x10"_b, "unallocated"},
+      {"0xxx1"_b, "unallocated"},
+      {"x0xx1"_b, "unallocated"},
+      {"xx0x1"_b, "unallocated"},
+      {"xxx11"_b, "unallocated"},
+      {"xxxxx"_b, "_f0000000_1565"},
+    },
+  },
+
+  { "_f0000000_380",
+    {5},
+    { {"1"_b, "_f0000000_381"},
+      {"x"_b, "_f0000000_401"},
+    },
+  },
+
+  { "_f0000000_381",
+    {11, 10, 9, 8, 5},
+    { {"00000"_b, "_f0000000_382"},
+      {"00001"_b, "_f0000000_383"},
+      {"00100"_b, "_f0000000_384"},
+      {"00101"_b, "_f0000000_385"},
+      {"01000"_b, "_f0000000_386"},
+      {"01001"_b, "_f0000000_387"},
+      {"01100"_b, "_f0000000_388"},
+      {"01101"_b, "_f0000000_389"},
+      {"10000"_b, "_f0000000_390"},
+      {"10001"_b, "_f0000000_391"},
+      {"10100"_b, "_f0000000_392"},
+      {"10101"_b, "_f0000000_393"},
+      {"11000"_b, "_f0000000_394"},
+      {"11001"_b, "_f0000000_395"},
+      {"11010"_b, "_f0000000_396"},
+      {"11011"_b, "_f0000000_397"},
+      {"11100"_b, "_f0000000_398"},
+      {"11101"_b, "_f0000000_399"},
+      {"11110"_b, "_f0000000_400"},
+      {"xxxxx"_b, "unallocated"},
+    },
+  },
+
+  { "_f0000000_382",
+    {11, 10, 9, 8, 5},
+    { {"0xx10"_b, "unallocated"},
+      {"x0x10"_b, "unallocated"},
+      {"0xxx1"_b, "unallocated"},
+      {"x0xx1"_b, "unallocated"},
+      {"xx0x1"_b, "unallocated"},
+      {"xxx11"_b, "unallocated"},
+      {"xxxxx"_b, "_f0000000_1565"},
+    },
+  },
+
+  { "_f0000000_383",
+    {11, 10, 9, 8},
+    { {"00x1"_b, "unallocated"},
+      {"01x1"_b, "unallocated"},
+      {"10x1"_b, "unallocated"},
+      {"111x"_b, "unallocated"},
+      {"xxxx"_b, "_f0000000_1564"},
+    },
+  },
+
+  { "_f0000000_384",
+    {11, 10, 9, 8, 5},
+    { {"0xx10"_b, "unallocated"},
+      {"x0x10"_b, "unallocated"},
+      {"0xxx1"_b, "unallocated"},
+      {"x0xx1"_b, "unallocated"},
+      {"xx0x1"_b, "unallocated"},
+      {"xxx11"_b, "unallocated"},
+      {"xxxxx"_b, "_f0000000_1565"},
+    },
+  },
+
+  { "_f0000000_385",
+    {11, 10, 9, 8},
+    { {"00x1"_b, "unallocated"},
+      {"01x1"_b, "unallocated"},
+      {"10x1"_b, "unallocated"},
+      {"111x"_b, "unallocated"},
+      {"xxxx"_b, "_f0000000_1564"},
+    },
+  },
+
+  { "_f0000000_386",
+    {11, 10, 9, 8, 5},
+    { {"0xx10"_b, "unallocated"},
+      {"x0x10"_b, "unallocated"},
+      {"0xxx1"_b, "unallocated"},
+      {"x0xx1"_b, "unallocated"},
+      {"xx0x1"_b, "unallocated"},
+      {"xxx11"_b, "unallocated"},
+      {"xxxxx"_b, "_f0000000_1565"},
+    },
+  },
+
+  { "_f0000000_387",
+    {11, 10, 9, 8},
+    { {"00x1"_b, "unallocated"},
+      {"01x1"_b, "unallocated"},
+      {"10x1"_b, "unallocated"},
+      {"111x"_b, "unallocated"},
+      {"xxxx"_b, "_f0000000_1564"},
+    },
+  },
+
+  { "_f0000000_388",
+    {11, 10, 9, 8, 5},
+    { {"0xx10"_b, "unallocated"},
+      {"x0x10"_b, "unallocated"},
+      {"0xxx1"_b, "unallocated"},
+      {"x0xx1"_b, "unallocated"},
+      {"xx0x1"_b, "unallocated"},
+      {"xxx11"_b, "unallocated"},
+      {"xxxxx"_b, "_f0000000_1565"},
+    },
+  },
+
+  { "_f0000000_389",
+    {11, 10, 9, 8},
+    { {"00x1"_b, "unallocated"},
+      {"01x1"_b, "unallocated"},
+      {"10x1"_b, "unallocated"},
+      {"111x"_b, "unallocated"},
+      {"xxxx"_b, "_f0000000_1564"},
+    },
+  },
+
+  { "_f0000000_390",
+    {11, 10, 9, 8, 5},
+    { {"0xx10"_b, "unallocated"},
+      {"x0x10"_b, "unallocated"},
+      {"0xxx1"_b, "unallocated"},
+      {"x0xx1"_b, "unallocated"},
+      {"xx0x1"_b, "unallocated"},
+      {"xxx11"_b, "unallocated"},
+      {"xxxxx"_b, "_f0000000_1565"},
+    },
+  },
+
+  { "_f0000000_391",
+    {11, 10, 9, 8},
+    { {"00x1"_b, "unallocated"},
+      {"01x1"_b, "unallocated"},
+      {"10x1"_b, "unallocated"},
+      {"111x"_b, "unallocated"},
+      {"xxxx"_b, "_f0000000_1564"},
+    },
+  },
+
+  { "_f0000000_392",
+    {11, 10, 9, 8, 5},
+    { {"0xx10"_b, "unallocated"},
+      {"x0x10"_b, "unallocated"},
+      {"0xxx1"_b, "unallocated"},
+      {"x0xx1"_b, "unallocated"},
+      {"xx0x1"_b, "unallocated"},
+      {"xxx11"_b, "unallocated"},
+      {"xxxxx"_b, "_f0000000_1565"},
+    },
+  },
+
+  { "_f0000000_393",
+    {11, 10, 9, 8},
+    { {"00x1"_b, "unallocated"},
+      {"01x1"_b, "unallocated"},
+      {"10x1"_b, "unallocated"},
+      {"111x"_b, "unallocated"},
+      {"xxxx"_b, "_f0000000_1564"},
+    },
+  },
+
+  { "_f0000000_394",
+    {11, 10, 9, 8, 5},
+    { {"0xx10"_b, "unallocated"},
+      {"x0x10"_b, "unallocated"},
+      {"0xxx1"_b, "unallocated"},
+      {"x0xx1"_b, "unallocated"},
+      {"xx0x1"_b, "unallocated"},
+      {"xxx11"_b, "unallocated"},
+      {"xxxxx"_b, "_f0000000_1565"},
+    },
+  },
+
+  { "_f0000000_395",
+    {11, 10, 9, 8},
+    { {"00x1"_b, "unallocated"},
+      {"01x1"_b, "unallocated"},
+      {"10x1"_b, "unallocated"},
+      {"111x"_b, "unallocated"},
+      {"xxxx"_b, "_f0000000_1564"},
+    },
+  },
+
+  { "_f0000000_396",
+    {11, 10, 9, 8, 5},
+    { {"0xx10"_b, "unallocated"},
+      {"x0x10"_b, "unallocated"},
+      {"0xxx1"_b, "unallocated"},
+      {"x0xx1"_b, "unallocated"},
+      {"xx0x1"_b, "unallocated"},
+      {"xxx11"_b, "unallocated"},
+      {"xxxxx"_b, "_f0000000_1565"},
+    },
+  },
+
+  { "_f0000000_397",
+    {11, 10, 9, 8},
+    { {"00x1"_b, "unallocated"},
+      {"01x1"_b, "unallocated"},
+      {"10x1"_b, "unallocated"},
+      {"111x"_b, "unallocated"},
+      {"xxxx"_b, "_f0000000_1564"},
+    },
+  },
+
+  { "_f0000000_398",
+    {11, 10, 9, 8, 5},
+    { {"0xx10"_b, "unallocated"},
+      {"x0x10"_b, "unallocated"},
+      {"0xxx1"_b, "unallocated"},
+      {"x0xx1"_b, "unallocated"},
+      {"xx0x1"_b, "unallocated"},
+      {"xxx11"_b, "unallocated"},
+      {"xxxxx"_b, "_f0000000_1565"},
+    },
+  },
+
+  { "_f0000000_399",
+    {11, 10, 9, 8, 5},
+    { {"0xx10"_b, "unallocated"},
+      {"x0x10"_b, "unallocated"},
+      {"0xxx1"_b, "unallocated"},
+      {"x0xx1"_b, "unallocated"},
+      {"xx0x1"_b, "unallocated"},
+      {"xxx11"_b, "unallocated"},
+      {"xxxxx"_b, "_f0000000_1565"},
+    },
+  },
+
+  { "_f0000000_400",
+    {11, 10, 9, 8, 5},
+    { {"0xx10"_b, "unallocated"},
+      {"x0x10"_b, "unallocated"},
+      {"0xxx1"_b, "unallocated"},
+      {"x0xx1"_b, "unallocated"},
+      {"xx0x1"_b, "unallocated"},
+      {"xxx11"_b, "unallocated"},
+      {"xxxxx"_b, "_f0000000_1565"},
+    },
+  },
+
+  { "_f0000000_401",
+    {11, 10, 9, 8, 5},
+    { {"0xx10"_b, "unallocated"},
+      {"x0x10"_b, "unallocated"},
+      {"0xxx1"_b, "unallocated"},
+      {"x0xx1"_b, "unallocated"},
+      {"xx0x1"_b, "unallocated"},
+      {"xxx11"_b, "unallocated"},
+      {"xxxxx"_b, "_f0000000_1565"},
+    },
+  },
+
+  { "_f0000000_402",
+    {9},
+    { {"1"_b, "_f0000000_403"},
+      {"x"_b, "unallocated"},
+    },
+  },
+
+  { "_f0000000_403",
+    {21},
+    { {"0"_b, "unallocated"},
+      {"x"_b, "_f0000000_1580"},
+    },
+  },
+
+  { "_f0000000_1580",
+    {12, 0},
+    { {"00"_b, "vcvt_fx_q_a1"},
+    },
+  },
+
+  { "_f0000000_404",
+    {24, 21, 20},
+    { {"000"_b, "_f0000000_405"},
+      {"001"_b, "_f0000000_473"},
+      {"010"_b, "_f0000000_476"},
+      {"101"_b, "_f0000000_553"},
+      {"111"_b, "_f0000000_557"},
+      {"xxx"_b, "unallocated"},
+    },
+  },
+
+  { "_f0000000_405",
+    {23},
+    { {"0"_b, "_f0000000_406"},
+      {"1"_b, "_f0000000_448"},
+    },
+  },
+
+  { "_f0000000_406",
+    {3, 2, 0},
+    { {"111"_b, "_f0000000_407"},
+      {"xxx"_b, "_f0000000_428"},
+    },
+  },
+
+  { "_f0000000_407",
+    {1},
+    { {"0"_b, "_f0000000_408"},
+      {"1"_b, "_f0000000_418"},
+    },
+  },
+
+  { "_f0000000_408",
+    {11, 10, 9, 8},
+    { {"0000"_b, "vst4_multi_wb_a1"},
+      {"0001"_b, "vst4_multi_wb_a1"},
+      {"0010"_b, "_f0000000_409"},
+      {"0011"_b, "_f0000000_410"},
+      {"0100"_b, "_f0000000_411"},
+      {"0101"_b, "_f0000000_412"},
+      {"0110"_b, "_f0000000_413"},
+      {"0111"_b, "_f0000000_414"},
+      {"1000"_b, "_f0000000_415"},
+      {"1001"_b, "_f0000000_416"},
+      {"1010"_b, "_f0000000_417"},
+      {"xxxx"_b, "unallocated"},
+    },
+  },
+
+  { "_f0000000_409",
+    {11, 10, 9, 8, 5, 4},
+    { {"011x1x"_b, "unallocated"},
+      {"101011"_b, "unallocated"},
+      {"xxxxxx"_b, "vst1_multi_wb_a1"},
+    },
+  },
+
+  { "_f0000000_410",
+    {11, 10, 9, 5, 4},
+    { {"10011"_b, "unallocated"},
+      {"xxxxx"_b, "vst2_multi_wb_a1"},
+    },
+  },
+
+  { "_f0000000_411",
+    {5},
+    { {"1"_b, "unallocated"},
+      {"x"_b, "vst3_multi_wb_a1"},
+    },
+  },
+
+  { "_f0000000_412",
+    {5},
+    { {"1"_b, "unallocated"},
+      {"x"_b, "vst3_multi_wb_a1"},
+    },
+  },
+
+  { "_f0000000_413",
+    {11, 10, 9, 8, 5, 4},
+    { {"011x1x"_b, "unallocated"},
+      {"101011"_b, "unallocated"},
+      {"xxxxxx"_b, "vst1_multi_wb_a1"},
+    },
+  },
+
+  { "_f0000000_414",
+    {11, 10, 9, 8, 5, 4},
+    { {"011x1x"_b, "unallocated"},
+      {"101011"_b, "unallocated"},
+      {"xxxxxx"_b, "vst1_multi_wb_a1"},
+    },
+  },
+
+  { "_f0000000_415",
+    {11, 10, 9, 5, 4},
+    { {"10011"_b, "unallocated"},
+      {"xxxxx"_b, "vst2_multi_wb_a1"},
+    },
+  },
+
+  { "_f0000000_416",
+    {11, 10, 9, 5, 4},
+    { {"10011"_b, "unallocated"},
+      {"xxxxx"_b, "vst2_multi_wb_a1"},
+    },
+  },
+
+  { "_f0000000_417",
+    {11, 10, 9, 8, 5, 4},
+    { {"011x1x"_b, "unallocated"},
+      {"101011"_b, "unallocated"},
+      {"xxxxxx"_b, "vst1_multi_wb_a1"},
+    },
+  },
+
+  { "_f0000000_418",
+    {11, 10, 9, 8},
+    { {"0000"_b, "vst4_multi_off_a1"},
+      {"0001"_b, "vst4_multi_off_a1"},
+      {"0010"_b, "_f0000000_419"},
+      {"0011"_b, "_f0000000_420"},
+      {"0100"_b, "_f0000000_421"},
+      {"0101"_b, "_f0000000_422"},
+      {"0110"_b, "_f0000000_423"},
+      {"0111"_b, "_f0000000_424"},
+      {"1000"_b, "_f0000000_425"},
+      {"1001"_b, "_f0000000_426"},
+      {"1010"_b, "_f0000000_427"},
+      {"xxxx"_b, "unallocated"},
+    },
+  },
+
+  { "_f0000000_419",
+    {11, 10, 9, 8, 5, 4},
+    { {"011x1x"_b, "unallocated"},
+      {"101011"_b, "unallocated"},
+      {"xxxxxx"_b, "vst1_multi_off_a1"},
+    },
+  },
+
+  { "_f0000000_420",
+    {11, 10, 9, 5, 4},
+    { {"10011"_b, "unallocated"},
+      {"xxxxx"_b, "vst2_multi_off_a1"},
+    },
+  },
+
+  { "_f0000000_421",
+    {5},
+    { {"1"_b, "unallocated"},
+      {"x"_b, "vst3_multi_off_a1"},
+    },
+  },
+
+  { "_f0000000_422",
+    {5},
+    { {"1"_b, "unallocated"},
+      {"x"_b, "vst3_multi_off_a1"},
+    },
+  },
+
+  { "_f0000000_423",
+    {11, 10, 9, 8, 5, 4},
+    { {"011x1x"_b, "unallocated"},
+      {"101011"_b, "unallocated"},
+      {"xxxxxx"_b, "vst1_multi_off_a1"},
+    },
+  },
+
+  { "_f0000000_424",
+    {11, 10, 9, 8, 5, 4},
+    { {"011x1x"_b, "unallocated"},
+      {"101011"_b, "unallocated"},
+      {"xxxxxx"_b, "vst1_multi_off_a1"},
+    },
+  },
+
+  { "_f0000000_425",
+    {11, 10, 9, 5, 4},
+    { {"10011"_b, "unallocated"},
+      {"xxxxx"_b, "vst2_multi_off_a1"},
+    },
+  },
+
+  { "_f0000000_426",
+    {11, 10, 9, 5, 4},
+    { {"10011"_b, "unallocated"},
+      {"xxxxx"_b, "vst2_multi_off_a1"},
+    },
+  },
+
+  { "_f0000000_427",
+    {11, 10, 9, 8, 5, 4},
+    { {"011x1x"_b, "unallocated"},
+      {"101011"_b, "unallocated"},
+      {"xxxxxx"_b, "vst1_multi_off_a1"},
+    },
+  },
+
+  { "_f0000000_428",
+    {11, 10, 9, 8},
+    { {"0000"_b, "_f0000000_429"},
+      {"0001"_b, "_f0000000_430"},
+      {"0010"_b, "_f0000000_431"},
+      {"0011"_b, "_f0000000_434"},
+      {"0100"_b, "_f0000000_435"},
+      {"0101"_b, "_f0000000_436"},
+      {"0110"_b, "_f0000000_437"},
+      {"0111"_b, "_f0000000_440"},
+      {"1000"_b, "_f0000000_443"},
+      {"1001"_b, "_f0000000_444"},
+      {"1010"_b, "_f0000000_445"},
+      {"xxxx"_b, "unallocated"},
+    },
+  },
+
+  { "_f0000000_429",
+    {3, 2, 0},
+    { {"111"_b, "unallocated"},
+      {"xxx"_b, "vst4_multi_post_a1"},
+    },
+  },
+
+  { "_f0000000_430",
+    {3, 2, 0},
+    { {"111"_b, "unallocated"},
+      {"xxx"_b, "vst4_multi_post_a1"},
+    },
+  },
+
+  { "_f0000000_431",
+    {3, 2, 0},
+    { {"111"_b, "unallocated"},
+      {"xxx"_b, "_f0000000_432"},
+    },
+  },
+
+  { "_f0000000_432",
+    {11, 10, 9, 5},
+    { {"0111"_b, "unallocated"},
+      {"xxxx"_b, "_f0000000_433"},
+    },
+  },
+
+  { "_f0000000_433",
+    {11, 10, 9, 8, 5, 4},
+    { {"101011"_b, "unallocated"},
+      {"xxxxxx"_b, "vst1_multi_post_a1"},
+    },
+  },
+
+  { "_f0000000_434",
+    {11, 10, 9, 5, 4, 3, 2, 0},
+    { {"xxxxx111"_b, "unallocated"},
+      {"10011xxx"_b, "unallocated"},
+      {"xxxxxxxx"_b, "vst2_multi_post_a1"},
+    },
+  },
+
+  { "_f0000000_435",
+    {5, 3, 2, 0},
+    { {"x111"_b, "unallocated"},
+      {"1xxx"_b, "unallocated"},
+      {"xxxx"_b, "vst3_multi_post_a1"},
+    },
+  },
+
+  { "_f0000000_436",
+    {5, 3, 2, 0},
+    { {"x111"_b, "unallocated"},
+      {"1xxx"_b, "unallocated"},
+      {"xxxx"_b, "vst3_multi_post_a1"},
+    },
+  },
+
+  { "_f0000000_437",
+    {3, 2, 0},
+    { {"111"_b, "unallocated"},
+      {"xxx"_b, "_f0000000_438"},
+    },
+  },
+
+  { "_f0000000_438",
+    {11, 10, 9, 5},
+    { {"0111"_b, "unallocated"},
+      {"xxxx"_b, "_f0000000_439"},
+    },
+  },
+
+  { "_f0000000_439",
+    {11, 10, 9, 8, 5, 4},
+    { {"101011"_b, "unallocated"},
+      {"xxxxxx"_b, "vst1_multi_post_a1"},
+    },
+  },
+
+  { "_f0000000_440",
+    {3, 2, 0},
+    { {"111"_b, "unallocated"},
+      {"xxx"_b, "_f0000000_441"},
+    },
+  },
+
+  { "_f0000000_441",
+    {11, 10, 9, 5},
+    { {"0111"_b, "unallocated"},
+      {"xxxx"_b, "_f0000000_442"},
+    },
+  },
+
+  { "_f0000000_442",
+    {11, 10, 9, 8, 5, 4},
+    { {"101011"_b, "unallocated"},
+      {"xxxxxx"_b, "vst1_multi_post_a1"},
+    },
+  },
+
+  { "_f0000000_443",
+    {11, 10, 9, 5, 4, 3, 2, 0},
+    { {"xxxxx111"_b, "unallocated"},
+      {"10011xxx"_b, "unallocated"},
+      {"xxxxxxxx"_b, "vst2_multi_post_a1"},
+    },
+  },
+
+  { "_f0000000_444",
+    {11, 10, 9, 5, 4, 3, 2, 0},
+    { {"xxxxx111"_b, "unallocated"},
+      {"10011xxx"_b, "unallocated"},
+      {"xxxxxxxx"_b, "vst2_multi_post_a1"},
+    },
+  },
+
+  { "_f0000000_445",
+    {3, 2, 0},
+    { {"111"_b, "unallocated"},
+      {"xxx"_b, "_f0000000_446"},
+    },
+  },
+
+  { "_f0000000_446",
+    {11, 10, 9, 5},
+    { {"0111"_b, "unallocated"},
+      {"xxxx"_b, "_f0000000_447"},
+    },
+  },
+
+  { "_f0000000_447",
+    {11, 10, 9, 8, 5, 4},
+    { {"101011"_b, "unallocated"},
+      {"xxxxxx"_b, "vst1_multi_post_a1"},
+    },
+  },
+
+  { "_f0000000_448",
+    {9, 8},
+    { {"00"_b, "_f0000000_449"},
+      {"01"_b, "_f0000000_455"},
+      {"10"_b, "_f0000000_461"},
+      {"11"_b, "_f0000000_467"},
+    },
+  },
+
+  { "_f0000000_449",
+    {11, 10},
+    { {"11"_b, "unallocated"},
+      {"xx"_b, "_f0000000_450"},
+    },
+  },
+
+  { "_f0000000_450",
+    {3, 2, 0},
+    { {"111"_b, "_f0000000_451"},
+      {"xxx"_b, "_f0000000_454"},
+    },
+  },
+
+  { "_f0000000_451",
+    {1},
+    { {"0"_b, "_f0000000_452"},
+      {"1"_b, "_f0000000_453"},
+    },
+  },
+
+  { "_f0000000_452",
+    {11, 10},
+    { {"11"_b, "unallocated"},
+      {"xx"_b, "vst1_lane_wb_a1"},
+    },
+  },
+
+  { "_f0000000_453",
+    {11, 10},
+    { {"11"_b, "unallocated"},
+      {"xx"_b, "vst1_lane_off_a1"},
+    },
+  },
+
+  { "_f0000000_454",
+    {11, 10, 3, 2, 0},
+    { {"11xxx"_b, "unallocated"},
+      {"xx111"_b, "unallocated"},
+      {"xxxxx"_b, "vst1_lane_post_a1"},
+    },
+  },
+
+  { "_f0000000_455",
+    {11, 10},
+    { {"11"_b, "unallocated"},
+      {"xx"_b, "_f0000000_456"},
+    },
+  },
+
+  { "_f0000000_456",
+    {3, 2, 0},
+    { {"111"_b, "_f0000000_457"},
+      {"xxx"_b, "_f0000000_460"},
+    },
+  },
+
+  { "_f0000000_457",
+    {1},
+    { {"0"_b, "_f0000000_458"},
+      {"1"_b, "_f0000000_459"},
+    },
+  },
+
+  { "_f0000000_458",
+    {11, 10},
+    { {"11"_b, "unallocated"},
+      {"xx"_b, "vst2_lane_wb_a1"},
+    },
+  },
+
+  { "_f0000000_459",
+    {11, 10},
+    { {"11"_b, "unallocated"},
+      {"xx"_b, "vst2_lane_off_a1"},
+    },
+  },
+
+  { "_f0000000_460",
+    {11, 10, 3, 2, 0},
+    { {"11xxx"_b, "unallocated"},
+      {"xx111"_b, "unallocated"},
+      {"xxxxx"_b, "vst2_lane_post_a1"},
+    },
+  },
+
+  { "_f0000000_461",
+    {11, 10, 5, 4},
+    { {"0001"_b, "unallocated"},
+      {"0011"_b, "unallocated"},
+      {"0101"_b, "unallocated"},
+      {"0111"_b, "unallocated"},
+      {"1001"_b, "unallocated"},
+      {"1010"_b, "unallocated"},
+      {"1011"_b, "unallocated"},
+      {"1100"_b, "unallocated"},
+      {"1101"_b, "unallocated"},
+      {"1110"_b, "unallocated"},
+      {"1111"_b, "unallocated"},
+      {"xxxx"_b, "_f0000000_462"},
+    },
+  },
+
+  { "_f0000000_462",
+    {3, 2, 0},
+    { {"111"_b, "_f0000000_463"},
+      {"xxx"_b, "_f0000000_466"},
+    },
+  },
+
+  { "_f0000000_463",
+    {1},
+    { {"0"_b, "_f0000000_464"},
+      {"1"_b, "_f0000000_465"},
+    },
+  },
+
+  { "_f0000000_464",
+    {11, 10, 5, 4},
+    { {"11xx"_b, "unallocated"},
+      {"0xx1"_b, "unallocated"},
+      {"1001"_b, "unallocated"},
+      {"1010"_b, "unallocated"},
+      {"1011"_b, "unallocated"},
+      {"xxxx"_b, "vst3_lane_wb_a1"},
+    },
+  },
+
+  { "_f0000000_465",
+    {11, 10, 5, 4},
+    { {"11xx"_b, "unallocated"},
+      {"0xx1"_b, "unallocated"},
+      {"1001"_b, "unallocated"},
+      {"1010"_b, "unallocated"},
+      {"1011"_b, "unallocated"},
+      {"xxxx"_b, "vst3_lane_off_a1"},
+    },
+  },
+
+  { "_f0000000_466",
+    {11, 10, 5, 4, 3, 2, 0},
+    { {"11xxxxx"_b, "unallocated"},
+      {"xxxx111"_b, "unallocated"},
+      {"0xx1xxx"_b, "unallocated"},
+      {"1001xxx"_b, "unallocated"},
+      {"1010xxx"_b, "unallocated"},
+      {"1011xxx"_b, "unallocated"},
+      {"xxxxxxx"_b, "vst3_lane_post_a1"},
+    },
+  },
+
+  { "_f0000000_467",
+    {11, 10},
+    { {"11"_b, "unallocated"},
+      {"xx"_b, "_f0000000_468"},
+    },
+  },
+
+  { "_f0000000_468",
+    {3, 2, 0},
+    { {"111"_b, "_f0000000_469"},
+      {"xxx"_b, "_f0000000_472"},
+    },
+  },
+
+  { "_f0000000_469",
+    {1},
+    { {"0"_b, "_f0000000_470"},
+      {"1"_b, "_f0000000_471"},
+    },
+  },
+
+  { "_f0000000_470",
+    {11, 10},
+    { {"11"_b, "unallocated"},
+      {"xx"_b, "vst4_lane_wb_a1"},
+    },
+  },
+
+  { "_f0000000_471",
+    {11, 10},
+    { {"11"_b, "unallocated"},
+      {"xx"_b, "vst4_lane_off_a1"},
+    },
+  },
+
+  { "_f0000000_472",
+    {11, 10, 3, 2, 0},
+    { {"11xxx"_b, "unallocated"},
+      {"xx111"_b, "unallocated"},
+      {"xxxxx"_b, "vst4_lane_post_a1"},
+    },
+  },
+
+  { "_f0000000_473",
+    {22},
+    { {"1"_b, "_f0000000_474"},
+      {"x"_b, "unallocated"},
+    },
+  },
+
+  { "_f0000000_474",
+    {19, 18, 17, 16},
+    { {"1111"_b, "pli_lit_a1"},
+      {"xxxx"_b, "_f0000000_475"},
+    },
+  },
+
+  { "_f0000000_475",
+    {19, 18, 17, 16},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "pli_imm_a1"},
+    },
+  },
+
+  { "_f0000000_476",
+    {23},
+    { {"0"_b, "_f0000000_477"},
+      {"1"_b, "_f0000000_515"},
+    },
+  },
+
+  { "_f0000000_477",
+    {3, 2, 0},
+    { {"111"_b, "_f0000000_478"},
+      {"xxx"_b, "_f0000000_495"},
+    },
+  },
+
+  { "_f0000000_478",
+    {1},
+    { {"0"_b, "_f0000000_479"},
+      {"1"_b, "_f0000000_487"},
+    },
+  },
+
+  { "_f0000000_479",
+    {11, 10, 9, 8},
+    { {"0000"_b, "vld4_multi_wb_a1"},
+      {"0001"_b, "vld4_multi_wb_a1"},
+      {"0010"_b, "_f0000000_480"},
+      {"0011"_b, "_f0000000_481"},
+      {"0100"_b, "vld3_multi_wb_a1"},
+      {"0101"_b, "vld3_multi_wb_a1"},
+      {"0110"_b, "_f0000000_482"},
+      {"0111"_b, "_f0000000_483"},
+      {"1000"_b, "_f0000000_484"},
+      {"1001"_b, "_f0000000_485"},
+      {"1010"_b, "_f0000000_486"},
+      {"xxxx"_b, "unallocated"},
+    },
+  },
+
+  { "_f0000000_480",
+    {11, 10, 9, 8, 5, 4},
+    { {"011x1x"_b, "unallocated"},
+      {"101011"_b, "unallocated"},
+      {"xxxxxx"_b, "vld1_multi_wb_a1"},
+    },
+  },
+
+  { "_f0000000_481",
+    {11, 10, 9, 5, 4},
+    { {"10011"_b, "unallocated"},
+      {"xxxxx"_b, "vld2_multi_wb_a1"},
+    },
+  },
+
+  { "_f0000000_482",
+    {11, 10, 9, 8, 5, 4},
+    { {"011x1x"_b, "unallocated"},
+      {"101011"_b, "unallocated"},
+      {"xxxxxx"_b, "vld1_multi_wb_a1"},
+    },
+  },
+
+  { "_f0000000_483",
+    {11, 10, 9, 8, 5, 4},
+    { {"011x1x"_b, "unallocated"},
+      {"101011"_b, "unallocated"},
+      {"xxxxxx"_b, "vld1_multi_wb_a1"},
+    },
+  },
+
+  { "_f0000000_484",
+    {11, 10, 9, 5, 4},
+    { {"10011"_b, "unallocated"},
+      {"xxxxx"_b, "vld2_multi_wb_a1"},
+    },
+  },
+
+  { "_f0000000_485",
+    {11, 10, 9, 5, 4},
+    { {"10011"_b, "unallocated"},
+      {"xxxxx"_b, "vld2_multi_wb_a1"},
+    },
+  },
+
+  { "_f0000000_486",
+    {11, 10, 9, 8, 5, 4},
+    { {"011x1x"_b, "unallocated"},
+      {"101011"_b, "unallocated"},
+      {"xxxxxx"_b, "vld1_multi_wb_a1"},
+    },
+  },
+
+  { "_f0000000_487",
+    {11, 10, 9, 8},
+    { {"0000"_b, "vld4_multi_off_a1"},
+      {"0001"_b, "vld4_multi_off_a1"},
+      {"0010"_b, "_f0000000_488"},
+      {"0011"_b, "_f0000000_489"},
+      {"0100"_b, "vld3_multi_off_a1"},
+      {"0101"_b, "vld3_multi_off_a1"},
+      {"0110"_b, "_f0000000_490"},
+      {"0111"_b, "_f0000000_491"},
+      {"1000"_b, "_f0000000_492"},
+      {"1001"_b, "_f0000000_493"},
+      {"1010"_b, "_f0000000_494"},
+      {"xxxx"_b, "unallocated"},
+    },
+  },
+
+  { "_f0000000_488",
+    {11, 10, 9, 8, 5, 4},
+    { {"011x1x"_b, "unallocated"},
+      {"101011"_b, "unallocated"},
+      {"xxxxxx"_b, "vld1_multi_off_a1"},
+    },
+  },
+
+  { "_f0000000_489",
+    {11, 10, 9, 5, 4},
+    { {"10011"_b, "unallocated"},
+      {"xxxxx"_b, "vld2_multi_off_a1"},
+    },
+  },
+
+  { "_f0000000_490",
+    {11, 10, 9, 8, 5, 4},
+    { {"011x1x"_b, "unallocated"},
+      {"101011"_b, "unallocated"},
+      {"xxxxxx"_b, "vld1_multi_off_a1"},
+    },
+  },
+
+  { "_f0000000_491",
+    {11, 10, 9, 8, 5, 4},
+    { {"011x1x"_b, "unallocated"},
+      {"101011"_b, "unallocated"},
+      {"xxxxxx"_b, "vld1_multi_off_a1"},
+    },
+  },
+
+  { "_f0000000_492",
+    {11, 10, 9, 5, 4},
+    { {"10011"_b, "unallocated"},
+      {"xxxxx"_b, "vld2_multi_off_a1"},
+    },
+  },
+
+  { "_f0000000_493",
+    {11, 10, 9, 5, 4},
+    { {"10011"_b, "unallocated"},
+      {"xxxxx"_b, "vld2_multi_off_a1"},
+    },
+  },
+
+  { "_f0000000_494",
+    {11, 10, 9, 8, 5, 4},
+    { {"011x1x"_b, "unallocated"},
+      {"101011"_b, "unallocated"},
+      {"xxxxxx"_b, "vld1_multi_off_a1"},
+    },
+  },
+
+  { "_f0000000_495",
+    {11, 10, 9, 8},
+    { {"0000"_b, "_f0000000_496"},
+      {"0001"_b, "_f0000000_497"},
+      {"0010"_b, "_f0000000_498"},
+      {"0011"_b, "_f0000000_501"},
+      {"0100"_b, "_f0000000_502"},
+      {"0101"_b, "_f0000000_503"},
+      {"0110"_b, "_f0000000_504"},
+      {"0111"_b, "_f0000000_507"},
+      {"1000"_b, "_f0000000_510"},
+      {"1001"_b, "_f0000000_511"},
+      {"1010"_b, "_f0000000_512"},
+      {"xxxx"_b, "unallocated"},
+    },
+  },
+
+  { "_f0000000_496",
+    {3, 2, 0},
+    { {"111"_b, "unallocated"},
+      {"xxx"_b, "vld4_multi_post_a1"},
+    },
+  },
+
+  { "_f0000000_497",
+    {3, 2, 0},
+    { {"111"_b, "unallocated"},
+      {"xxx"_b, "vld4_multi_post_a1"},
+    },
+  },
+
+  { "_f0000000_498",
+    {3, 2, 0},
+    { {"111"_b, "unallocated"},
+      {"xxx"_b, "_f0000000_499"},
+    },
+  },
+
+  { "_f0000000_499",
+    {11, 10, 9, 5},
+    { {"0111"_b, "unallocated"},
+      {"xxxx"_b, "_f0000000_500"},
+    },
+  },
+
+  { "_f0000000_500",
+    {11, 10, 9, 8, 5, 4},
+    { {"101011"_b, "unallocated"},
+      {"xxxxxx"_b, "vld1_multi_post_a1"},
+    },
+  },
+
+  { "_f0000000_501",
+    {11, 10, 9, 5, 4, 3, 2, 0},
+    { {"xxxxx111"_b, "unallocated"},
+      {"10011xxx"_b, "unallocated"},
+      {"xxxxxxxx"_b, "vld2_multi_post_a1"},
+    },
+  },
+
+  { "_f0000000_502",
+    {3, 2, 0},
+    { {"111"_b, "unallocated"},
+      {"xxx"_b, "vld3_multi_post_a1"},
+    },
+  },
+
+  { "_f0000000_503",
+    {3, 2, 0},
+    { {"111"_b, "unallocated"},
+      {"xxx"_b, "vld3_multi_post_a1"},
+    },
+  },
+
+  { "_f0000000_504",
+    {3, 2, 0},
+    { {"111"_b, "unallocated"},
+      {"xxx"_b, "_f0000000_505"},
+    },
+  },
+
+  { "_f0000000_505",
+    {11, 10, 9, 5},
+    { {"0111"_b, "unallocated"},
+      {"xxxx"_b, "_f0000000_506"},
+    },
+  },
+
+  { "_f0000000_506",
+    {11, 10, 9, 8, 5, 4},
+    { {"101011"_b, "unallocated"},
+      {"xxxxxx"_b, "vld1_multi_post_a1"},
+    },
+  },
+
+  { "_f0000000_507",
+    {3, 2, 0},
+    { {"111"_b, "unallocated"},
+      {"xxx"_b, "_f0000000_508"},
+    },
+  },
+
+  { "_f0000000_508",
+    {11, 10, 9, 5},
+    { {"0111"_b, "unallocated"},
+      {"xxxx"_b, "_f0000000_509"},
+    },
+  },
+
+  { "_f0000000_509",
+    {11, 10, 9, 8, 5, 4},
+    { {"101011"_b, "unallocated"},
+      {"xxxxxx"_b, "vld1_multi_post_a1"},
+    },
+  },
+
+  { "_f0000000_510",
+    {11, 10, 9, 5, 4, 3, 2, 0},
+    { {"xxxxx111"_b, "unallocated"},
+      {"10011xxx"_b, "unallocated"},
+      {"xxxxxxxx"_b, "vld2_multi_post_a1"},
+    },
+  },
+
+  { "_f0000000_511",
+    {11, 10, 9, 5, 4, 3, 2, 0},
+    { {"xxxxx111"_b, "unallocated"},
+      {"10011xxx"_b, "unallocated"},
+      {"xxxxxxxx"_b, "vld2_multi_post_a1"},
+    },
+  },
+
+  { "_f0000000_512",
+    {3, 2, 0},
+    { {"111"_b, "unallocated"},
+      {"xxx"_b, "_f0000000_513"},
+    },
+  },
+
+  { "_f0000000_513",
+    {11, 10, 9, 5},
+    { {"0111"_b, "unallocated"},
+      {"xxxx"_b, "_f0000000_514"},
+    },
+  },
+
+  { "_f0000000_514",
+    {11, 10, 9, 8, 5, 4},
+    { {"101011"_b, "unallocated"},
+      {"xxxxxx"_b, "vld1_multi_post_a1"},
+    },
+  },
+
+  { "_f0000000_515",
+    {9, 8},
+    { {"00"_b, "_f0000000_516"},
+      {"01"_b, "_f0000000_525"},
+      {"10"_b, "_f0000000_534"},
+      {"11"_b, "_f0000000_544"},
+    },
+  },
+
+  { "_f0000000_516",
+    {11, 10},
+    { {"11"_b, "_f0000000_517"},
+      {"xx"_b, "_f0000000_520"},
+    },
+  },
+
+  { "_f0000000_517",
+    {3, 2, 0},
+    { {"111"_b, "_f0000000_518"},
+      {"xxx"_b, "_f0000000_519"},
+    },
+  },
+
+  { "_f0000000_518",
+    {1},
+    { {"0"_b, "vld1_all_wb_a1"},
+      {"1"_b, "vld1_all_off_a1"},
+    },
+  },
+
+  { "_f0000000_519",
+    {3, 2, 0},
+    { {"111"_b, "unallocated"},
+      {"xxx"_b, "vld1_all_post_a1"},
+    },
+  },
+
+  { "_f0000000_520",
+    {3, 2, 0},
+    { {"111"_b, "_f0000000_521"},
+      {"xxx"_b, "_f0000000_524"},
+    },
+  },
+
+  { "_f0000000_521",
+    {1},
+    { {"0"_b, "_f0000000_522"},
+      {"1"_b, "_f0000000_523"},
+    },
+  },
+
+  { "_f0000000_522",
+    {11, 10},
+    { {"11"_b, "unallocated"},
+      {"xx"_b, "vld1_lane_wb_a1"},
+    },
+  },
+
+  { "_f0000000_523",
+    {11, 10},
+    { {"11"_b, "unallocated"},
+      {"xx"_b, "vld1_lane_off_a1"},
+    },
+  },
+
+  { "_f0000000_524",
+    {11, 10, 3, 2, 0},
+    { {"11xxx"_b, "unallocated"},
+      {"xx111"_b, "unallocated"},
+      {"xxxxx"_b, "vld1_lane_post_a1"},
+    },
+  },
+
+  { "_f0000000_525",
+    {11, 10},
+    { {"11"_b, "_f0000000_526"},
+      {"xx"_b, "_f0000000_529"},
+    },
+  },
+
+  { "_f0000000_526",
+    {3, 2, 0},
+    { {"111"_b, "_f0000000_527"},
+      {"xxx"_b, "_f0000000_528"},
+    },
+  },
+
+  { "_f0000000_527",
+    {1},
+    { {"0"_b, "vld2_all_wb_a1"},
+      {"1"_b, "vld2_all_off_a1"},
+    },
+  },
+
+  { "_f0000000_528",
+    {3, 2, 0},
+    { {"111"_b, "unallocated"},
+      {"xxx"_b, "vld2_all_post_a1"},
+    },
+  },
+
+  { "_f0000000_529",
+    {3, 2, 0},
+    { {"111"_b, "_f0000000_530"},
+      {"xxx"_b, "_f0000000_533"},
+    },
+  },
+
+  { "_f0000000_530",
+    {1},
+    { {"0"_b, "_f0000000_531"},
+      {"1"_b, "_f0000000_532"},
+    },
+  },
+
+  { "_f0000000_531",
+    {11, 10},
+    { {"11"_b, "unallocated"},
+      {"xx"_b, "vld2_lane_wb_a1"},
+    },
+  },
+
+  { "_f0000000_532",
+    {11, 10},
+    { {"11"_b, "unallocated"},
+      {"xx"_b, "vld2_lane_off_a1"},
+    },
+  },
+
+  { "_f0000000_533",
+    {11, 10, 3, 2, 0},
+    { {"11xxx"_b, "unallocated"},
+      {"xx111"_b, "unallocated"},
+      {"xxxxx"_b, "vld2_lane_post_a1"},
+    },
+  },
+
+  { "_f0000000_534",
+    {11, 10},
+    { {"11"_b, "_f0000000_535"},
+      {"xx"_b, "_f0000000_539"},
+    },
+  },
+
+  { "_f0000000_535",
+    {4},
+    { {"0"_b, "_f0000000_536"},
+      {"x"_b, "unallocated"},
+    },
+  },
+
+  { "_f0000000_536",
+    {3, 2, 0},
+    { {"111"_b, "_f0000000_537"},
+      {"xxx"_b, "_f0000000_538"},
+    },
+  },
+
+  { "_f0000000_537",
+    {1},
+    { {"0"_b, "vld3_all_wb_a1"},
+      {"1"_b, "vld3_all_off_a1"},
+    },
+  },
+
+  { "_f0000000_538",
+    {3, 2, 0},
+    { {"111"_b, "unallocated"},
+      {"xxx"_b, "vld3_all_post_a1"},
+    },
+  },
+
+  { "_f0000000_539",
+    {3, 2, 0},
+    { {"111"_b, "_f0000000_540"},
+      {"xxx"_b, "_f0000000_543"},
+    },
+  },
+
+  { "_f0000000_540",
+    {1},
+    { {"0"_b, "_f0000000_541"},
+      {"1"_b, "_f0000000_542"},
+    },
+  },
+
+  { "_f0000000_541",
+    {11, 10},
+    { {"11"_b, "unallocated"},
+      {"xx"_b, "vld3_lane_wb_a1"},
+    },
+  },
+
+  { "_f0000000_542",
+    {11, 10},
+    { {"11"_b, "unallocated"},
+      {"xx"_b, "vld3_lane_off_a1"},
+    },
+  },
+
+  { "_f0000000_543",
+    {11, 10, 3, 2, 0},
+    { {"11xxx"_b, "unallocated"},
+      {"xx111"_b, "unallocated"},
+      {"xxxxx"_b, "vld3_lane_post_a1"},
+    },
+  },
+
+  { "_f0000000_544",
+    {11, 10},
+    { {"11"_b, "_f0000000_545"},
+      {"xx"_b, "_f0000000_548"},
+    },
+  },
+
+  { "_f0000000_545",
+    {3, 2, 0},
+    { {"111"_b, "_f0000000_546"},
+      {"xxx"_b, "_f0000000_547"},
+    },
+  },
+
+  { "_f0000000_546",
+    {1},
+    { {"0"_b, "vld4_all_wb_a1"},
+      {"1"_b, "vld4_all_off_a1"},
+    },
+  },
+
+  { "_f0000000_547",
+    {3, 2, 0},
+    { {"111"_b, "unallocated"},
+      {"xxx"_b, "vld4_all_post_a1"},
+    },
+  },
+
+  { "_f0000000_548",
+    {3, 2, 0},
+    { {"111"_b, "_f0000000_549"},
+      {"xxx"_b, "_f0000000_552"},
+    },
+  },
+
+  { "_f0000000_549",
+    {1},
+    { {"0"_b, "_f0000000_550"},
+      {"1"_b, "_f0000000_551"},
+    },
+  },
+
+  { "_f0000000_550",
+    {11, 10},
+    { {"11"_b, "unallocated"},
+      {"xx"_b, "vld4_lane_wb_a1"},
+    },
+  },
+
+  { "_f0000000_551",
+    {11, 10},
+    { {"11"_b, "unallocated"},
+      {"xx"_b, "vld4_lane_off_a1"},
+    },
+  },
+
+  { "_f0000000_552",
+    {11, 10, 3, 2, 0},
+    { {"11xxx"_b, "unallocated"},
+      {"xx111"_b, "unallocated"},
+      {"xxxxx"_b, "vld4_lane_post_a1"},
+    },
+  },
+
+  { "_f0000000_553",
+    {19, 18, 17, 16},
+    { {"1111"_b, "pld_lit_a1"},
+      {"xxxx"_b, "_f0000000_554"},
+    },
+  },
+
+  { "_f0000000_554",
+    {22},
+    { {"0"_b, "_f0000000_555"},
+      {"1"_b, "_f0000000_556"},
+    },
+  },
+
+  { "_f0000000_555",
+    {19, 18, 17, 16},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "pldw_imm_a1"},
+    },
+  },
+
+  { "_f0000000_556",
+    {19, 18, 17, 16},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "pld_imm_a1"},
+    },
+  },
+
+  { "_f0000000_557",
+    {23, 22, 7, 6, 5, 4},
+    { {"010001"_b, "clrex_a1"},
+      {"010100"_b, "dsb_a1"},
+      {"010101"_b, "dmb_a1"},
+      {"010110"_b, "isb_a1"},
+      {"xxxxxx"_b, "unallocated"},
+    },
+  },
+
+  { "_f0000000_558",
+    {24, 22, 21, 20, 4},
+    { {"01010"_b, "_f0000000_559"},
+      {"10010"_b, "_f0000000_561"},
+      {"11010"_b, "_f0000000_563"},
+      {"xxxxx"_b, "unallocated"},
+    },
+  },
+
+  { "_f0000000_559",
+    {11, 10, 9, 8, 7, 6, 5},
+    { {"0000011"_b, "pli_rrx_a1"},
+      {"xxxxxxx"_b, "_f0000000_560"},
+    },
+  },
+
+  { "_f0000000_560",
+    {11, 10, 9, 8, 7, 6, 5},
+    { {"0000011"_b, "unallocated"},
+      {"xxxxxxx"_b, "pli_reg_a1"},
+    },
+  },
+
+  { "_f0000000_561",
+    {11, 10, 9, 8, 7, 6, 5},
+    { {"0000011"_b, "pldw_rrx_a1"},
+      {"xxxxxxx"_b, "_f0000000_562"},
+    },
+  },
+
+  { "_f0000000_562",
+    {11, 10, 9, 8, 7, 6, 5},
+    { {"0000011"_b, "unallocated"},
+      {"xxxxxxx"_b, "pldw_reg_a1"},
+    },
+  },
+
+  { "_f0000000_563",
+    {11, 10, 9, 8, 7, 6, 5},
+    { {"0000011"_b, "pld_rrx_a1"},
+      {"xxxxxxx"_b, "_f0000000_564"},
+    },
+  },
+
+  { "_f0000000_564",
+    {11, 10, 9, 8, 7, 6, 5},
+    { {"0000011"_b, "unallocated"},
+      {"xxxxxxx"_b, "pld_reg_a1"},
+    },
+  },
+
+  { "_f0000000_565",
+    {24, 23, 22, 20},
+    { {"0001"_b, "rfeda_a1"},
+      {"0010"_b, "srsda_a1"},
+      {"0101"_b, "rfeia_a1"},
+      {"0110"_b, "srsia_a1"},
+      {"1001"_b, "rfedb_a1"},
+      {"1010"_b, "srsdb_a1"},
+      {"1101"_b, "rfeib_a1"},
+      {"1110"_b, "srsib_a1"},
+      {"xxxx"_b, "unallocated"},
+    },
+  },
+
+  { "_f0000000_566",
+    {24, 23, 21, 20, 11, 10, 9, 8, 6, 4},
+    { {"0000101000"_b, "vseleq_f32_a1"},
+      {"0000101100"_b, "vseleq_f64_a1"},
+      {"0001101000"_b, "vselvs_f32_a1"},
+      {"0001101100"_b, "vselvs_f64_a1"},
+      {"0010101000"_b, "vselge_f32_a1"},
+      {"0010101100"_b, "vselge_f64_a1"},
+      {"0011101000"_b, "vselgt_f32_a1"},
+      {"0011101100"_b, "vselgt_f64_a1"},
+      {"0100101000"_b, "vmaxnm_f32_a2"},
+      {"0100101010"_b, "vminnm_f32_a2"},
+      {"0100101100"_b, "vmaxnm_f64_a2"},
+      {"0100101110"_b, "vminnm_f64_a2"},
+      {"0111101010"_b, "_f0000000_567"},
+      {"0111101110"_b, "_f0000000_572"},
+      {"xxxxxxxxxx"_b, "unallocated"},
+    },
+  },
+
+  { "_f0000000_567",
+    {19, 18, 17, 16},
+    { {"1000"_b, "_f0000000_568"},
+      {"1001"_b, "_f0000000_569"},
+      {"1010"_b, "_f0000000_570"},
+      {"1011"_b, "_f0000000_571"},
+      {"1100"_b, "vcvta_int_f32_s_a1"},
+      {"1101"_b, "vcvtn_int_f32_s_a1"},
+      {"1110"_b, "vcvtp_int_f32_s_a1"},
+      {"1111"_b, "vcvtm_int_f32_s_a1"},
+      {"xxxx"_b, "unallocated"},
+    },
+  },
+
+  { "_f0000000_568",
+    {7},
+    { {"0"_b, "vrinta_f32_a1"},
+      {"x"_b, "unallocated"},
+    },
+  },
+
+  { "_f0000000_569",
+    {7},
+    { {"0"_b, "vrintn_f32_a1"},
+      {"x"_b, "unallocated"},
+    },
+  },
+
+  { "_f0000000_570",
+    {7},
+    { {"0"_b, "vrintp_f32_a1"},
+      {"x"_b, "unallocated"},
+    },
+  },
+
+  { "_f0000000_571",
+    {7},
+    { {"0"_b, "vrintm_f32_a1"},
+      {"x"_b, "unallocated"},
+    },
+  },
+
+  { "_f0000000_572",
+    {19, 18, 17, 16},
+    { {"1000"_b, "_f0000000_573"},
+      {"1001"_b, "_f0000000_574"},
+      {"1010"_b, "_f0000000_575"},
+      {"1011"_b, "_f0000000_576"},
+      {"1100"_b, "vcvta_int_f64_a1"},
+      {"1101"_b, "vcvtn_int_f64_a1"},
+      {"1110"_b, "vcvtp_int_f64_a1"},
+      {"1111"_b, "vcvtm_int_f64_a1"},
+      {"xxxx"_b, "unallocated"},
+    },
+  },
+
+  { "_f0000000_573",
+    {7},
+    { {"0"_b, "vrinta_f64_a1"},
+      {"x"_b, "unallocated"},
+    },
+  },
+
+  { "_f0000000_574",
+    {7},
+    { {"0"_b, "vrintn_f64_a1"},
+      {"x"_b, "unallocated"},
+    },
+  },
+
+  { "_f0000000_575",
+    {7},
+    { {"0"_b, "vrintp_f64_a1"},
+      {"x"_b, "unallocated"},
+    },
+  },
+
+  { "_f0000000_576",
+    {7},
+    { {"0"_b, "vrintm_f64_a1"},
+      {"x"_b, "unallocated"},
+    },
+  },
+
+  { "_f0000000_577",
+    {27, 26, 25},
+    { {"000"_b, "_f0000000_578"},
+      {"001"_b, "_f0000000_978"},
+      {"010"_b, "_f0000000_1048"},
+      {"011"_b, "_f0000000_1081"},
+      {"100"_b, "_f0000000_1239"},
+      {"101"_b, "_f0000000_1254"},
+      {"110"_b, "_f0000000_1257"},
+      {"111"_b, "_f0000000_1330"},
+    },
+  },
+
+  { "_f0000000_578",
+    {20, 4},
+    { {"00"_b, "_f0000000_579"},
+      {"01"_b, "_f0000000_701"},
+      {"10"_b, "_f0000000_792"},
+      {"11"_b, "_f0000000_880"},
+    },
+  },
+
+  { "_f0000000_579",
+    {24, 23, 21},
+    { {"000"_b, "_f0000000_580"},
+      {"001"_b, "_f0000000_595"},
+      {"010"_b, "_f0000000_604"},
+      {"011"_b, "_f0000000_619"},
+      {"100"_b, "_f0000000_628"},
+      {"101"_b, "_f0000000_649"},
+      {"110"_b, "_f0000000_672"},
+      {"111"_b, "_f0000000_681"},
+    },
+  },
+
+  { "_f0000000_580",
+    {22},
+    { {"0"_b, "_f0000000_581"},
+      {"1"_b, "_f0000000_585"},
+    },
+  },
+
+  { "_f0000000_581",
+    {11, 10, 9, 8, 7, 6, 5},
+    { {"0000011"_b, "_f0000000_582"},
+      {"xxxxxxx"_b, "_f0000000_583"},
+    },
+  },
+
+  { "_f0000000_582",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "and_rrx_a1"},
+    },
+  },
+
+  { "_f0000000_583",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "_f0000000_584"},
+    },
+  },
+
+  { "_f0000000_584",
+    {11, 10, 9, 8, 7, 6, 5},
+    { {"0000011"_b, "unallocated"},
+      {"xxxxxxx"_b, "and_reg_a1"},
+    },
+  },
+
+  { "_f0000000_585",
+    {19, 18, 17, 16},
+    { {"1101"_b, "_f0000000_586"},
+      {"xxxx"_b, "_f0000000_590"},
+    },
+  },
+
+  { "_f0000000_586",
+    {11, 10, 9, 8, 7, 6, 5},
+    { {"0000011"_b, "_f0000000_587"},
+      {"xxxxxxx"_b, "_f0000000_588"},
+    },
+  },
+
+  { "_f0000000_587",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "sub_sp_rrx_a1"},
+    },
+  },
+
+  { "_f0000000_588",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "_f0000000_589"},
+    },
+  },
+
+  { "_f0000000_589",
+    {11, 10, 9, 8, 7, 6, 5},
+    { {"0000011"_b, "unallocated"},
+      {"xxxxxxx"_b, "sub_sp_reg_a1"},
+    },
+  },
+
+  { "_f0000000_590",
+    {11, 10, 9, 8, 7, 6, 5},
+    { {"0000011"_b, "_f0000000_591"},
+      {"xxxxxxx"_b, "_f0000000_592"},
+    },
+  },
+
+  { "_f0000000_591",
+    {31, 30, 29, 28, 19, 18, 17, 16},
+    { {"1111xxxx"_b, "unallocated"},
+      {"xxxx1101"_b, "unallocated"},
+      {"xxxxxxxx"_b, "sub_rrx_a1"},
+    },
+  },
+
+  { "_f0000000_592",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "_f0000000_593"},
+    },
+  },
+
+  { "_f0000000_593",
+    {19, 18, 17, 16},
+    { {"1101"_b, "unallocated"},
+      {"xxxx"_b, "_f0000000_594"},
+    },
+  },
+
+  { "_f0000000_594",
+    {11, 10, 9, 8, 7, 6, 5},
+    { {"0000011"_b, "unallocated"},
+      {"xxxxxxx"_b, "sub_reg_a1"},
+    },
+  },
+
+  { "_f0000000_595",
+    {22},
+    { {"0"_b, "_f0000000_596"},
+      {"1"_b, "_f0000000_600"},
+    },
+  },
+
+  { "_f0000000_596",
+    {11, 10, 9, 8, 7, 6, 5},
+    { {"0000011"_b, "_f0000000_597"},
+      {"xxxxxxx"_b, "_f0000000_598"},
+    },
+  },
+
+  { "_f0000000_597",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "eor_rrx_a1"},
+    },
+  },
+
+  { "_f0000000_598",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "_f0000000_599"},
+    },
+  },
+
+  { "_f0000000_599",
+    {11, 10, 9, 8, 7, 6, 5},
+    { {"0000011"_b, "unallocated"},
+      {"xxxxxxx"_b, "eor_reg_a1"},
+    },
+  },
+
+  { "_f0000000_600",
+    {11, 10, 9, 8, 7, 6, 5},
+    { {"0000011"_b, "_f0000000_601"},
+      {"xxxxxxx"_b, "_f0000000_602"},
+    },
+  },
+
+  { "_f0000000_601",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "rsb_rrx_a1"},
+    },
+  },
+
+  { "_f0000000_602",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "_f0000000_603"},
+    },
+  },
+
+  { "_f0000000_603",
+    {11, 10, 9, 8, 7, 6, 5},
+    { {"0000011"_b, "unallocated"},
+      {"xxxxxxx"_b, "rsb_reg_a1"},
+    },
+  },
+
+  { "_f0000000_604",
+    {22},
+    { {"0"_b, "_f0000000_605"},
+      {"1"_b, "_f0000000_615"},
+    },
+  },
+
+  { "_f0000000_605",
+    {19, 18, 17, 16},
+    { {"1101"_b, "_f0000000_606"},
+      {"xxxx"_b, "_f0000000_610"},
+    },
+  },
+
+  { "_f0000000_606",
+    {11, 10, 9, 8, 7, 6, 5},
+    { {"0000011"_b, "_f0000000_607"},
+      {"xxxxxxx"_b, "_f0000000_608"},
+    },
+  },
+
+  { "_f0000000_607",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "add_sp_rrx_a1"},
+    },
+  },
+
+  { "_f0000000_608",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "_f0000000_609"},
+    },
+  },
+
+  { "_f0000000_609",
+    {11, 10, 9, 8, 7, 6, 5},
+    { {"0000011"_b, "unallocated"},
+      {"xxxxxxx"_b, "add_sp_reg_a1"},
+    },
+  },
+
+  { "_f0000000_610",
+    {11, 10, 9, 8, 7, 6, 5},
+    { {"0000011"_b, "_f0000000_611"},
+      {"xxxxxxx"_b, "_f0000000_612"},
+    },
+  },
+
+  { "_f0000000_611",
+    {31, 30, 29, 28, 19, 18, 17, 16},
+    { {"1111xxxx"_b, "unallocated"},
+      {"xxxx1101"_b, "unallocated"},
+      {"xxxxxxxx"_b, "add_rrx_a1"},
+    },
+  },
+
+  { "_f0000000_612",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "_f0000000_613"},
+    },
+  },
+
+  { "_f0000000_613",
+    {19, 18, 17, 16},
+    { {"1101"_b, "unallocated"},
+      {"xxxx"_b, "_f0000000_614"},
+    },
+  },
+
+  { "_f0000000_614",
+    {11, 10, 9, 8, 7, 6, 5},
+    { {"0000011"_b, "unallocated"},
+      {"xxxxxxx"_b, "add_reg_a1"},
+    },
+  },
+
+  { "_f0000000_615",
+    {11, 10, 9, 8, 7, 6, 5},
+    { {"0000011"_b, "_f0000000_616"},
+      {"xxxxxxx"_b, "_f0000000_617"},
+    },
+  },
+
+  { "_f0000000_616",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "sbc_rrx_a1"},
+    },
+  },
+
+  { "_f0000000_617",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "_f0000000_618"},
+    },
+  },
+
+  { "_f0000000_618",
+    {11, 10, 9, 8, 7, 6, 5},
+    { {"0000011"_b, "unallocated"},
+      {"xxxxxxx"_b, "sbc_reg_a1"},
+    },
+  },
+
+  { "_f0000000_619",
+    {22},
+    { {"0"_b, "_f0000000_620"},
+      {"1"_b, "_f0000000_624"},
+    },
+  },
+
+  { "_f0000000_620",
+    {11, 10, 9, 8, 7, 6, 5},
+    { {"0000011"_b, "_f0000000_621"},
+      {"xxxxxxx"_b, "_f0000000_622"},
+    },
+  },
+
+  { "_f0000000_621",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "adc_rrx_a1"},
+    },
+  },
+
+  { "_f0000000_622",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "_f0000000_623"},
+    },
+  },
+
+  { "_f0000000_623",
+    {11, 10, 9, 8, 7, 6, 5},
+    { {"0000011"_b, "unallocated"},
+      {"xxxxxxx"_b, "adc_reg_a1"},
+    },
+  },
+
+  { "_f0000000_624",
+    {11, 10, 9, 8, 7, 6, 5},
+    { {"0000011"_b, "_f0000000_625"},
+      {"xxxxxxx"_b, "_f0000000_626"},
+    },
+  },
+
+  { "_f0000000_625",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "rsc_rrx_a1"},
+    },
+  },
+
+  { "_f0000000_626",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "_f0000000_627"},
+    },
+  },
+
+  { "_f0000000_627",
+    {11, 10, 9, 8, 7, 6, 5},
+    { {"0000011"_b, "unallocated"},
+      {"xxxxxxx"_b, "rsc_reg_a1"},
+    },
+  },
+
+  { "_f0000000_628",
+    {7, 6, 5},
+    { {"000"_b, "_f0000000_629"},
+      {"010"_b, "_f0000000_632"},
+      {"100"_b, "_f0000000_637"},
+      {"101"_b, "_f0000000_640"},
+      {"110"_b, "_f0000000_643"},
+      {"111"_b, "_f0000000_646"},
+      {"xxx"_b, "unallocated"},
+    },
+  },
+
+  { "_f0000000_629",
+    {9},
+    { {"0"_b, "_f0000000_630"},
+      {"1"_b, "_f0000000_631"},
+    },
+  },
+
+  { "_f0000000_630",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "mrs_a1"},
+    },
+  },
+
+  { "_f0000000_631",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "mrs_banked_a1"},
+    },
+  },
+
+  { "_f0000000_632",
+    {22, 9},
+    { {"00"_b, "_f0000000_633"},
+      {"01"_b, "_f0000000_634"},
+      {"10"_b, "_f0000000_635"},
+      {"11"_b, "_f0000000_636"},
+    },
+  },
+
+  { "_f0000000_633",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "crc32b_a1"},
+    },
+  },
+
+  { "_f0000000_634",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "crc32cb_a1"},
+    },
+  },
+
+  { "_f0000000_635",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "crc32w_a1"},
+    },
+  },
+
+  { "_f0000000_636",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "crc32cw_a1"},
+    },
+  },
+
+  { "_f0000000_637",
+    {22},
+    { {"0"_b, "_f0000000_638"},
+      {"1"_b, "_f0000000_639"},
+    },
+  },
+
+  { "_f0000000_638",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "smlabb_a1"},
+    },
+  },
+
+  { "_f0000000_639",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "smlalbb_a1"},
+    },
+  },
+
+  { "_f0000000_640",
+    {22},
+    { {"0"_b, "_f0000000_641"},
+      {"1"_b, "_f0000000_642"},
+    },
+  },
+
+  { "_f0000000_641",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "smlatb_a1"},
+    },
+  },
+
+  { "_f0000000_642",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "smlaltb_a1"},
+    },
+  },
+
+  { "_f0000000_643",
+    {22},
+    { {"0"_b, "_f0000000_644"},
+      {"1"_b, "_f0000000_645"},
+    },
+  },
+
+  { "_f0000000_644",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "smlabt_a1"},
+    },
+  },
+
+  { "_f0000000_645",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "smlalbt_a1"},
+    },
+  },
+
+  { "_f0000000_646",
+    {22},
+    { {"0"_b, "_f0000000_647"},
+      {"1"_b, "_f0000000_648"},
+    },
+  },
+
+  { "_f0000000_647",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "smlatt_a1"},
+    },
+  },
+
+  { "_f0000000_648",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "smlaltt_a1"},
+    },
+  },
+
+  { "_f0000000_649",
+    {7, 6, 5},
+    { {"000"_b, "_f0000000_650"},
+      {"001"_b, "_f0000000_653"},
+      {"010"_b, "_f0000000_655"},
+      {"011"_b, "_f0000000_658"},
+      {"100"_b, "_f0000000_660"},
+      {"101"_b, "_f0000000_663"},
+      {"110"_b, "_f0000000_666"},
+      {"111"_b, "_f0000000_669"},
+    },
+  },
+
+  { "_f0000000_650",
+    {9},
+    { {"0"_b, "_f0000000_651"},
+      {"1"_b, "_f0000000_652"},
+    },
+  },
+
+  { "_f0000000_651",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "msr_reg_a1"},
+    },
+  },
+
+  { "_f0000000_652",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "msr_banked_a1"},
+    },
+  },
+
+  { "_f0000000_653",
+    {22},
+    { {"0"_b, "_f0000000_654"},
+      {"x"_b, "unallocated"},
+    },
+  },
+
+  { "_f0000000_654",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "bxj_a1"},
+    },
+  },
+
+  { "_f0000000_655",
+    {22, 9},
+    { {"00"_b, "_f0000000_656"},
+      {"01"_b, "_f0000000_657"},
+      {"xx"_b, "unallocated"},
+    },
+  },
+
+  { "_f0000000_656",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "crc32h_a1"},
+    },
+  },
+
+  { "_f0000000_657",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "crc32ch_a1"},
+    },
+  },
+
+  { "_f0000000_658",
+    {22},
+    { {"1"_b, "_f0000000_659"},
+      {"x"_b, "unallocated"},
+    },
+  },
+
+  { "_f0000000_659",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "eret_a1"},
+    },
+  },
+
+  { "_f0000000_660",
+    {22},
+    { {"0"_b, "_f0000000_661"},
+      {"1"_b, "_f0000000_662"},
+    },
+  },
+
+  { "_f0000000_661",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "smlawb_a1"},
+    },
+  },
+
+  { "_f0000000_662",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "smulbb_a1"},
+    },
+  },
+
+  { "_f0000000_663",
+    {22},
+    { {"0"_b, "_f0000000_664"},
+      {"1"_b, "_f0000000_665"},
+    },
+  },
+
+  { "_f0000000_664",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "smulwb_a1"},
+    },
+  },
+
+  { "_f0000000_665",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "smultb_a1"},
+    },
+  },
+
+  { "_f0000000_666",
+    {22},
+    { {"0"_b, "_f0000000_667"},
+      {"1"_b, "_f0000000_668"},
+    },
+  },
+
+  { "_f0000000_667",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "smlawt_a1"},
+    },
+  },
+
+  { "_f0000000_668",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "smulbt_a1"},
+    },
+  },
+
+  { "_f0000000_669",
+    {22},
+    { {"0"_b, "_f0000000_670"},
+      {"1"_b, "_f0000000_671"},
+    },
+  },
+
+  { "_f0000000_670",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "smulwt_a1"},
+    },
+  },
+
+  { "_f0000000_671",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "smultt_a1"},
+    },
+  },
+
+  { "_f0000000_672",
+    {22},
+    { {"0"_b, "_f0000000_673"},
+      {"1"_b, "_f0000000_677"},
+    },
+  },
+
+  { "_f0000000_673",
+    {11, 10, 9, 8, 7, 6, 5},
+    { {"0000011"_b, "_f0000000_674"},
+      {"xxxxxxx"_b, "_f0000000_675"},
+    },
+  },
+
+  { "_f0000000_674",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "orr_rrx_a1"},
+    },
+  },
+
+  { "_f0000000_675",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "_f0000000_676"},
+    },
+  },
+
+  { "_f0000000_676",
+    {11, 10, 9, 8, 7, 6, 5},
+    { {"0000011"_b, "unallocated"},
+      {"xxxxxxx"_b, "orr_reg_a1"},
+    },
+  },
+
+  { "_f0000000_677",
+    {11, 10, 9, 8, 7, 6, 5},
+    { {"0000011"_b, "_f0000000_678"},
+      {"xxxxxxx"_b, "_f0000000_679"},
+    },
+  },
+
+  { "_f0000000_678",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "bic_rrx_a1"},
+    },
+  },
+
+  { "_f0000000_679",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "_f0000000_680"},
+    },
+  },
+
+  { "_f0000000_680",
+    {11, 10, 9, 8, 7, 6, 5},
+    { {"0000011"_b, "unallocated"},
+      {"xxxxxxx"_b, "bic_reg_a1"},
+    },
+  },
+
+  { "_f0000000_681",
+    {22},
+    { {"0"_b, "_f0000000_682"},
+      {"1"_b, "_f0000000_697"},
+    },
+  },
+
+  { "_f0000000_682",
+    {11, 10, 9, 8, 7, 6, 5},
+    { {"0000011"_b, "_f0000000_683"},
+      {"xxxxxxx"_b, "_f0000000_685"},
+    },
+  },
+
+  { "_f0000000_683",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "_f0000000_684"},
+    },
+  },
+
+  { "_f0000000_684",
+    {31, 30, 29, 28},
+    { {"1111"_b, "mov_rrx_a1"},
+      {"xxxx"_b, "rrx_a1"},
+    },
+  },
+
+  { "_f0000000_685",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "_f0000000_686"},
+    },
+  },
+
+  { "_f0000000_686",
+    {11, 10, 9, 8, 7, 6, 5},
+    { {"0000011"_b, "unallocated"},
+      {"xxxxxxx"_b, "_f0000000_687"},
+    },
+  },
+
+  { "_f0000000_687",
+    {6, 5},
+    { {"10"_b, "_f0000000_688"},
+      {"xx"_b, "_f0000000_689"},
+    },
+  },
+
+  { "_f0000000_688",
+    {31, 30, 29, 28},
+    { {"1111"_b, "_f0000000_689"},
+      {"xxxx"_b, "asr_imm_a1"},
+    },
+  },
+
+  { "_f0000000_689",
+    {6, 5},
+    { {"00"_b, "_f0000000_690"},
+      {"xx"_b, "_f0000000_691"},
+    },
+  },
+
+  { "_f0000000_690",
+    {31, 30, 29, 28},
+    { {"1111"_b, "_f0000000_691"},
+      {"xxxx"_b, "_f0000000_696"},
+    },
+  },
+
+  { "_f0000000_691",
+    {6, 5},
+    { {"01"_b, "_f0000000_692"},
+      {"xx"_b, "_f0000000_693"},
+    },
+  },
+
+  { "_f0000000_692",
+    {31, 30, 29, 28},
+    { {"1111"_b, "_f0000000_693"},
+      {"xxxx"_b, "lsr_imm_a1"},
+    },
+  },
+
+  { "_f0000000_693",
+    {6, 5},
+    { {"11"_b, "_f0000000_694"},
+      {"xx"_b, "mov_reg_a1"},
+    },
+  },
+
+  { "_f0000000_694",
+    {31, 30, 29, 28},
+    { {"1111"_b, "mov_reg_a1"},
+      {"xxxx"_b, "_f0000000_695"},
+    },
+  },
+
+  { "_f0000000_695",
+    {11, 10, 9, 8, 7},
+    { {"00000"_b, "mov_reg_a1"},
+      {"xxxxx"_b, "ror_imm_a1"},
+    },
+  },
+
+  { "_f0000000_696",
+    {11, 10, 9, 8, 7},
+    { {"00000"_b, "_f0000000_691"},
+      {"xxxxx"_b, "lsl_imm_a1"},
+    },
+  },
+
+  { "_f0000000_697",
+    {11, 10, 9, 8, 7, 6, 5},
+    { {"0000011"_b, "_f0000000_698"},
+      {"xxxxxxx"_b, "_f0000000_699"},
+    },
+  },
+
+  { "_f0000000_698",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "mvn_rrx_a1"},
+    },
+  },
+
+  { "_f0000000_699",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "_f0000000_700"},
+    },
+  },
+
+  { "_f0000000_700",
+    {11, 10, 9, 8, 7, 6, 5},
+    { {"0000011"_b, "unallocated"},
+      {"xxxxxxx"_b, "mvn_reg_a1"},
+    },
+  },
+
+  { "_f0000000_701",
+    {22, 7},
+    { {"00"_b, "_f0000000_702"},
+      {"01"_b, "_f0000000_725"},
+      {"10"_b, "_f0000000_749"},
+      {"11"_b, "_f0000000_763"},
+    },
+  },
+
+  { "_f0000000_702",
+    {24, 23, 21},
+    { {"000"_b, "_f0000000_703"},
+      {"001"_b, "_f0000000_704"},
+      {"010"_b, "_f0000000_705"},
+      {"011"_b, "_f0000000_706"},
+      {"100"_b, "_f0000000_707"},
+      {"101"_b, "_f0000000_710"},
+      {"110"_b, "_f0000000_715"},
+      {"111"_b, "_f0000000_716"},
+    },
+  },
+
+  { "_f0000000_703",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "and_rsr_a1"},
+    },
+  },
+
+  { "_f0000000_704",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "eor_rsr_a1"},
+    },
+  },
+
+  { "_f0000000_705",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "add_rsr_a1"},
+    },
+  },
+
+  { "_f0000000_706",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "adc_rsr_a1"},
+    },
+  },
+
+  { "_f0000000_707",
+    {6, 5},
+    { {"10"_b, "_f0000000_708"},
+      {"11"_b, "_f0000000_709"},
+      {"xx"_b, "unallocated"},
+    },
+  },
+
+  { "_f0000000_708",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "qadd_a1"},
+    },
+  },
+
+  { "_f0000000_709",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "hlt_a1"},
+    },
+  },
+
+  { "_f0000000_710",
+    {6, 5},
+    { {"00"_b, "_f0000000_711"},
+      {"01"_b, "_f0000000_712"},
+      {"10"_b, "_f0000000_713"},
+      {"11"_b, "_f0000000_714"},
+    },
+  },
+
+  { "_f0000000_711",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "bx_a1"},
+    },
+  },
+
+  { "_f0000000_712",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "blx_a1"},
+    },
+  },
+
+  { "_f0000000_713",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "qsub_a1"},
+    },
+  },
+
+  { "_f0000000_714",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "bkpt_a1"},
+    },
+  },
+
+  { "_f0000000_715",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "orr_rsr_a1"},
+    },
+  },
+
+  { "_f0000000_716",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "_f0000000_717"},
+    },
+  },
+
+  { "_f0000000_717",
+    {6, 5},
+    { {"10"_b, "_f0000000_718"},
+      {"xx"_b, "_f0000000_719"},
+    },
+  },
+
+  { "_f0000000_718",
+    {31, 30, 29, 28},
+    { {"1111"_b, "_f0000000_719"},
+      {"xxxx"_b, "asr_reg_a1"},
+    },
+  },
+
+  { "_f0000000_719",
+    {6, 5},
+    { {"00"_b, "_f0000000_720"},
+      {"xx"_b, "_f0000000_721"},
+    },
+  },
+
+  { "_f0000000_720",
+    {31, 30, 29, 28},
+    { {"1111"_b, "_f0000000_721"},
+      {"xxxx"_b, "lsl_reg_a1"},
+    },
+  },
+
+  { "_f0000000_721",
+    {6, 5},
+    { {"01"_b, "_f0000000_722"},
+      {"xx"_b, "_f0000000_723"},
+    },
+  },
+
+  { "_f0000000_722",
+    {31, 30, 29, 28},
+    { {"1111"_b, "_f0000000_723"},
+      {"xxxx"_b, "lsr_reg_a1"},
+    },
+  },
+
+  { "_f0000000_723",
+    {6, 5},
+    { {"11"_b, "_f0000000_724"},
+      {"xx"_b, "mov_rsr_a1"},
+    },
+  },
+
+  { "_f0000000_724",
+    {31, 30, 29, 28},
+    { {"1111"_b, "mov_rsr_a1"},
+      {"xxxx"_b, "ror_reg_a1"},
+    },
+  },
+
+  { "_f0000000_725",
+    {24, 21, 6, 5},
+    { {"0000"_b, "_f0000000_726"},
+      {"0001"_b, "_f0000000_729"},
+      {"0010"_b, "_f0000000_730"},
+      {"0011"_b, "_f0000000_731"},
+      {"0100"_b, "_f0000000_732"},
+      {"0101"_b, "_f0000000_735"},
+      {"1000"_b, "_f0000000_736"},
+      {"1001"_b, "_f0000000_740"},
+      {"1010"_b, "_f0000000_741"},
+      {"1011"_b, "_f0000000_742"},
+      {"1100"_b, "_f0000000_743"},
+      {"1101"_b, "_f0000000_746"},
+      {"1110"_b, "_f0000000_747"},
+      {"1111"_b, "_f0000000_748"},
+      {"xxxx"_b, "unallocated"},
+    },
+  },
+
+  { "_f0000000_726",
+    {23},
+    { {"0"_b, "_f0000000_727"},
+      {"1"_b, "_f0000000_728"},
+    },
+  },
+
+  { "_f0000000_727",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "mul_a1"},
+    },
+  },
+
+  { "_f0000000_728",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "umull_a1"},
+    },
+  },
+
+  { "_f0000000_729",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "strh_reg_post_a1"},
+    },
+  },
+
+  { "_f0000000_730",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "ldrd_reg_post_a1"},
+    },
+  },
+
+  { "_f0000000_731",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "strd_reg_post_a1"},
+    },
+  },
+
+  { "_f0000000_732",
+    {23},
+    { {"0"_b, "_f0000000_733"},
+      {"1"_b, "_f0000000_734"},
+    },
+  },
+
+  { "_f0000000_733",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "mla_a1"},
+    },
+  },
+
+  { "_f0000000_734",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "umlal_a1"},
+    },
+  },
+
+  { "_f0000000_735",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "strht_a2"},
+    },
+  },
+
+  { "_f0000000_736",
+    {23, 9, 8},
+    { {"100"_b, "_f0000000_737"},
+      {"110"_b, "_f0000000_738"},
+      {"111"_b, "_f0000000_739"},
+      {"xxx"_b, "unallocated"},
+    },
+  },
+
+  { "_f0000000_737",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "stl_a1"},
+    },
+  },
+
+  { "_f0000000_738",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "stlex_a1"},
+    },
+  },
+
+  { "_f0000000_739",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "strex_a1"},
+    },
+  },
+
+  { "_f0000000_740",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "strh_reg_off_a1"},
+    },
+  },
+
+  { "_f0000000_741",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "ldrd_reg_off_a1"},
+    },
+  },
+
+  { "_f0000000_742",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "strd_reg_off_a1"},
+    },
+  },
+
+  { "_f0000000_743",
+    {23, 9, 8},
+    { {"110"_b, "_f0000000_744"},
+      {"111"_b, "_f0000000_745"},
+      {"xxx"_b, "unallocated"},
+    },
+  },
+
+  { "_f0000000_744",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "stlexd_a1"},
+    },
+  },
+
+  { "_f0000000_745",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "strexd_a1"},
+    },
+  },
+
+  { "_f0000000_746",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "strh_reg_pre_a1"},
+    },
+  },
+
+  { "_f0000000_747",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "ldrd_reg_pre_a1"},
+    },
+  },
+
+  { "_f0000000_748",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "strd_reg_pre_a1"},
+    },
+  },
+
+  { "_f0000000_749",
+    {24, 23, 21},
+    { {"000"_b, "_f0000000_750"},
+      {"001"_b, "_f0000000_751"},
+      {"010"_b, "_f0000000_752"},
+      {"011"_b, "_f0000000_753"},
+      {"100"_b, "_f0000000_754"},
+      {"101"_b, "_f0000000_757"},
+      {"110"_b, "_f0000000_761"},
+      {"111"_b, "_f0000000_762"},
+    },
+  },
+
+  { "_f0000000_750",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "sub_rsr_a1"},
+    },
+  },
+
+  { "_f0000000_751",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "rsb_rsr_a1"},
+    },
+  },
+
+  { "_f0000000_752",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "sbc_rsr_a1"},
+    },
+  },
+
+  { "_f0000000_753",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "rsc_rsr_a1"},
+    },
+  },
+
+  { "_f0000000_754",
+    {6, 5},
+    { {"10"_b, "_f0000000_755"},
+      {"11"_b, "_f0000000_756"},
+      {"xx"_b, "unallocated"},
+    },
+  },
+
+  { "_f0000000_755",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "qdadd_a1"},
+    },
+  },
+
+  { "_f0000000_756",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "hvc_a1"},
+    },
+  },
+
+  { "_f0000000_757",
+    {6, 5},
+    { {"00"_b, "_f0000000_758"},
+      {"10"_b, "_f0000000_759"},
+      {"11"_b, "_f0000000_760"},
+      {"xx"_b, "unallocated"},
+    },
+  },
+
+  { "_f0000000_758",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "clz_a1"},
+    },
+  },
+
+  { "_f0000000_759",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "qdsub_a1"},
+    },
+  },
+
+  { "_f0000000_760",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "smc_a1"},
+    },
+  },
+
+  { "_f0000000_761",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "bic_rsr_a1"},
+    },
+  },
+
+  { "_f0000000_762",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "mvn_rsr_a1"},
+    },
+  },
+
+  { "_f0000000_763",
+    {6, 5},
+    { {"00"_b, "_f0000000_764"},
+      {"01"_b, "_f0000000_777"},
+      {"10"_b, "_f0000000_782"},
+      {"11"_b, "_f0000000_788"},
+    },
+  },
+
+  { "_f0000000_764",
+    {24, 23, 21},
+    { {"000"_b, "_f0000000_765"},
+      {"001"_b, "_f0000000_766"},
+      {"010"_b, "_f0000000_767"},
+      {"011"_b, "_f0000000_768"},
+      {"110"_b, "_f0000000_769"},
+      {"111"_b, "_f0000000_773"},
+      {"xxx"_b, "unallocated"},
+    },
+  },
+
+  { "_f0000000_765",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "umaal_a1"},
+    },
+  },
+
+  { "_f0000000_766",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "mls_a1"},
+    },
+  },
+
+  { "_f0000000_767",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "smull_a1"},
+    },
+  },
+
+  { "_f0000000_768",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "smlal_a1"},
+    },
+  },
+
+  { "_f0000000_769",
+    {9, 8},
+    { {"00"_b, "_f0000000_770"},
+      {"10"_b, "_f0000000_771"},
+      {"11"_b, "_f0000000_772"},
+      {"xx"_b, "unallocated"},
+    },
+  },
+
+  { "_f0000000_770",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "stlb_a1"},
+    },
+  },
+
+  { "_f0000000_771",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "stlexb_a1"},
+    },
+  },
+
+  { "_f0000000_772",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "strexb_a1"},
+    },
+  },
+
+  { "_f0000000_773",
+    {9, 8},
+    { {"00"_b, "_f0000000_774"},
+      {"10"_b, "_f0000000_775"},
+      {"11"_b, "_f0000000_776"},
+      {"xx"_b, "unallocated"},
+    },
+  },
+
+  { "_f0000000_774",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "stlh_a1"},
+    },
+  },
+
+  { "_f0000000_775",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "stlexh_a1"},
+    },
+  },
+
+  { "_f0000000_776",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "strexh_a1"},
+    },
+  },
+
+  { "_f0000000_777",
+    {24, 21},
+    { {"00"_b, "_f0000000_778"},
+      {"01"_b, "_f0000000_779"},
+      {"10"_b, "_f0000000_780"},
+      {"11"_b, "_f0000000_781"},
+    },
+  },
+
+  { "_f0000000_778",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "strh_imm_post_a1"},
+    },
+  },
+
+  { "_f0000000_779",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "strht_a1"},
+    },
+  },
+
+  { "_f0000000_780",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "strh_imm_off_a1"},
+    },
+  },
+
+  { "_f0000000_781",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "strh_imm_pre_a1"},
+    },
+  },
+
+  { "_f0000000_782",
+    {19, 18, 17, 16},
+    { {"1111"_b, "_f0000000_783"},
+      {"xxxx"_b, "_f0000000_784"},
+    },
+  },
+
+  { "_f0000000_783",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "ldrd_lit_a1"},
+    },
+  },
+
+  { "_f0000000_784",
+    {24, 21},
+    { {"00"_b, "_f0000000_785"},
+      {"10"_b, "_f0000000_786"},
+      {"11"_b, "_f0000000_787"},
+      {"xx"_b, "unallocated"},
+    },
+  },
+
+  { "_f0000000_785",
+    {31, 30, 29, 28, 19, 18, 17, 16},
+    { {"1111xxxx"_b, "unallocated"},
+      {"xxxx1111"_b, "unallocated"},
+      {"xxxxxxxx"_b, "ldrd_imm_post_a1"},
+    },
+  },
+
+  { "_f0000000_786",
+    {31, 30, 29, 28, 19, 18, 17, 16},
+    { {"1111xxxx"_b, "unallocated"},
+      {"xxxx1111"_b, "unallocated"},
+      {"xxxxxxxx"_b, "ldrd_imm_off_a1"},
+    },
+  },
+
+  { "_f0000000_787",
+    {31, 30, 29, 28, 19, 18, 17, 16},
+    { {"1111xxxx"_b, "unallocated"},
+      {"xxxx1111"_b, "unallocated"},
+      {"xxxxxxxx"_b, "ldrd_imm_pre_a1"},
+    },
+  },
+
+  { "_f0000000_788",
+    {24, 21},
+    { {"00"_b, "_f0000000_789"},
+      {"10"_b, "_f0000000_790"},
+      {"11"_b, "_f0000000_791"},
+      {"xx"_b, "unallocated"},
+    },
+  },
+
+  { "_f0000000_789",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "strd_imm_post_a1"},
+    },
+  },
+
+  { "_f0000000_790",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "strd_imm_off_a1"},
+    },
+  },
+
+  { "_f0000000_791",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "strd_imm_pre_a1"},
+    },
+  },
+
+  { "_f0000000_792",
+    {24, 23, 22, 21},
+    { {"0000"_b, "_f0000000_793"},
+      {"0001"_b, "_f0000000_797"},
+      {"0010"_b, "_f0000000_801"},
+      {"0011"_b, "_f0000000_811"},
+      {"0100"_b, "_f0000000_815"},
+      {"0101"_b, "_f0000000_825"},
+      {"0110"_b, "_f0000000_829"},
+      {"0111"_b, "_f0000000_833"},
+      {"1000"_b, "_f0000000_837"},
+      {"1001"_b, "_f0000000_841"},
+      {"1010"_b, "_f0000000_845"},
+      {"1011"_b, "_f0000000_849"},
+      {"1100"_b, "_f0000000_853"},
+      {"1101"_b, "_f0000000_857"},
+      {"1110"_b, "_f0000000_872"},
+      {"1111"_b, "_f0000000_876"},
+    },
+  },
+
+  { "_f0000000_793",
+    {11, 10, 9, 8, 7, 6, 5},
+    { {"0000011"_b, "_f0000000_794"},
+      {"xxxxxxx"_b, "_f0000000_795"},
+    },
+  },
+
+  { "_f0000000_794",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "ands_rrx_a1"},
+    },
+  },
+
+  { "_f0000000_795",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "_f0000000_796"},
+    },
+  },
+
+  { "_f0000000_796",
+    {11, 10, 9, 8, 7, 6, 5},
+    { {"0000011"_b, "unallocated"},
+      {"xxxxxxx"_b, "ands_reg_a1"},
+    },
+  },
+
+  { "_f0000000_797",
+    {11, 10, 9, 8, 7, 6, 5},
+    { {"0000011"_b, "_f0000000_798"},
+      {"xxxxxxx"_b, "_f0000000_799"},
+    },
+  },
+
+  { "_f0000000_798",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "eors_rrx_a1"},
+    },
+  },
+
+  { "_f0000000_799",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "_f0000000_800"},
+    },
+  },
+
+  { "_f0000000_800",
+    {11, 10, 9, 8, 7, 6, 5},
+    { {"0000011"_b, "unallocated"},
+      {"xxxxxxx"_b, "eors_reg_a1"},
+    },
+  },
+
+  { "_f0000000_801",
+    {19, 18, 17, 16},
+    { {"1101"_b, "_f0000000_802"},
+      {"xxxx"_b, "_f0000000_806"},
+    },
+  },
+
+  { "_f0000000_802",
+    {11, 10, 9, 8, 7, 6, 5},
+    { {"0000011"_b, "_f0000000_803"},
+      {"xxxxxxx"_b, "_f0000000_804"},
+    },
+  },
+
+  { "_f0000000_803",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "subs_sp_rrx_a1"},
+    },
+  },
+
+  { "_f0000000_804",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "_f0000000_805"},
+    },
+  },
+
+  { "_f0000000_805",
+    {11, 10, 9, 8, 7, 6, 5},
+    { {"0000011"_b, "unallocated"},
+      {"xxxxxxx"_b, "subs_sp_reg_a1"},
+    },
+  },
+
+  { "_f0000000_806",
+    {11, 10, 9, 8, 7, 6, 5},
+    { {"0000011"_b, "_f0000000_807"},
+      {"xxxxxxx"_b, "_f0000000_808"},
+    },
+  },
+
+  { "_f0000000_807",
+    {31, 30, 29, 28, 19, 18, 17, 16},
+    { {"1111xxxx"_b, "unallocated"},
+      {"xxxx1101"_b, "unallocated"},
+      {"xxxxxxxx"_b, "subs_rrx_a1"},
+    },
+  },
+
+  { "_f0000000_808",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "_f0000000_809"},
+    },
+  },
+
+  { "_f0000000_809",
+    {19, 18, 17, 16},
+    { {"1101"_b, "unallocated"},
+      {"xxxx"_b, "_f0000000_810"},
+    },
+  },
+
+  { "_f0000000_810",
+    {11, 10, 9, 8, 7, 6, 5},
+    { {"0000011"_b, "unallocated"},
+      {"xxxxxxx"_b, "subs_reg_a1"},
+    },
+  },
+
+  { "_f0000000_811",
+    {11, 10, 9, 8, 7, 6, 5},
+    { {"0000011"_b, "_f0000000_812"},
+      {"xxxxxxx"_b, "_f0000000_813"},
+    },
+  },
+
+  { "_f0000000_812",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "rsbs_rrx_a1"},
+    },
+  },
+
+  { "_f0000000_813",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "_f0000000_814"},
+    },
+  },
+
+  { "_f0000000_814",
+    {11, 10, 9, 8, 7, 6, 5},
+    { {"0000011"_b, "unallocated"},
+      {"xxxxxxx"_b, "rsbs_reg_a1"},
+    },
+  },
+
+  { "_f0000000_815",
+    {19, 18, 17, 16},
+    { {"1101"_b, "_f0000000_816"},
+      {"xxxx"_b, "_f0000000_820"},
+    },
+  },
+
+  { "_f0000000_816",
+    {11, 10, 9, 8, 7, 6, 5},
+    { {"0000011"_b, "_f0000000_817"},
+      {"xxxxxxx"_b, "_f0000000_818"},
+    },
+  },
+
+  { "_f0000000_817",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "adds_sp_rrx_a1"},
+    },
+  },
+
+  { "_f0000000_818",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "_f0000000_819"},
+    },
+  },
+
+  { "_f0000000_819",
+    {11, 10, 9, 8, 7, 6, 5},
+    { {"0000011"_b, "unallocated"},
+      {"xxxxxxx"_b, "adds_sp_reg_a1"},
+    },
+  },
+
+  { "_f0000000_820",
+    {11, 10, 9, 8, 7, 6, 5},
+    { {"0000011"_b, "_f0000000_821"},
+      {"xxxxxxx"_b, "_f0000000_822"},
+    },
+  },
+
+  { "_f0000000_821",
+    {31, 30, 29, 28, 19, 18, 17, 16},
+    { {"1111xxxx"_b, "unallocated"},
+      {"xxxx1101"_b, "unallocated"},
+      {"xxxxxxxx"_b, "adds_rrx_a1"},
+    },
+  },
+
+  { "_f0000000_822",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "_f0000000_823"},
+    },
+  },
+
+  { "_f0000000_823",
+    {19, 18, 17, 16},
+    { {"1101"_b, "unallocated"},
+      {"xxxx"_b, "_f0000000_824"},
+    },
+  },
+
+  { "_f0000000_824",
+    {11, 10, 9, 8, 7, 6, 5},
+    { {"0000011"_b, "unallocated"},
+      {"xxxxxxx"_b, "adds_reg_a1"},
+    },
+  },
+
+  { "_f0000000_825",
+    {11, 10, 9, 8, 7, 6, 5},
+    { {"0000011"_b, "_f0000000_826"},
+      {"xxxxxxx"_b, "_f0000000_827"},
+    },
+  },
+
+  { "_f0000000_826",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "adcs_rrx_a1"},
+    },
+  },
+
+  { "_f0000000_827",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "_f0000000_828"},
+    },
+  },
+
+  { "_f0000000_828",
+    {11, 10, 9, 8, 7, 6, 5},
+    { {"0000011"_b, "unallocated"},
+      {"xxxxxxx"_b, "adcs_reg_a1"},
+    },
+  },
+
+  { "_f0000000_829",
+    {11, 10, 9, 8, 7, 6, 5},
+    { {"0000011"_b, "_f0000000_830"},
+      {"xxxxxxx"_b, "_f0000000_831"},
+    },
+  },
+
+  { "_f0000000_830",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "sbcs_rrx_a1"},
+    },
+  },
+
+  { "_f0000000_831",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "_f0000000_832"},
+    },
+  },
+
+  { "_f0000000_832",
+    {11, 10, 9, 8, 7, 6, 5},
+    { {"0000011"_b, "unallocated"},
+      {"xxxxxxx"_b, "sbcs_reg_a1"},
+    },
+  },
+
+  { "_f0000000_833",
+    {11, 10, 9, 8, 7, 6, 5},
+    { {"0000011"_b, "_f0000000_834"},
+      {"xxxxxxx"_b, "_f0000000_835"},
+    },
+  },
+
+  { "_f0000000_834",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "rscs_rrx_a1"},
+    },
+  },
+
+  { "_f0000000_835",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "_f0000000_836"},
+    },
+  },
+
+  { "_f0000000_836",
+    {11, 10, 9, 8, 7, 6, 5},
+    { {"0000011"_b, "unallocated"},
+      {"xxxxxxx"_b, "rscs_reg_a1"},
+    },
+  },
+
+  { "_f0000000_837",
+    {11, 10, 9, 8, 7, 6, 5},
+    { {"0000011"_b, "_f0000000_838"},
+      {"xxxxxxx"_b, "_f0000000_839"},
+    },
+  },
+
+  { "_f0000000_838",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "tst_rrx_a1"},
+    },
+  },
+
+  { "_f0000000_839",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "_f0000000_840"},
+    },
+  },
+
+  { "_f0000000_840",
+    {11, 10, 9, 8, 7, 6, 5},
+    { {"0000011"_b, "unallocated"},
+      {"xxxxxxx"_b, "tst_reg_a1"},
+    },
+  },
+
+  { "_f0000000_841",
+    {11, 10, 9, 8, 7, 6, 5},
+    { {"0000011"_b, "_f0000000_842"},
+      {"xxxxxxx"_b, "_f0000000_843"},
+    },
+  },
+
+  { "_f0000000_842",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "teq_rrx_a1"},
+    },
+  },
+
+  { "_f0000000_843",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "_f0000000_844"},
+    },
+  },
+
+  { "_f0000000_844",
+    {11, 10, 9, 8, 7, 6, 5},
+    { {"0000011"_b, "unallocated"},
+      {"xxxxxxx"_b, "teq_reg_a1"},
+    },
+  },
+
+  { "_f0000000_845",
+    {11, 10, 9, 8, 7, 6, 5},
+    { {"0000011"_b, "_f0000000_846"},
+      {"xxxxxxx"_b, "_f0000000_847"},
+    },
+  },
+
+  { "_f0000000_846",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "cmp_rrx_a1"},
+    },
+  },
+
+  { "_f0000000_847",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "_f0000000_848"},
+    },
+  },
+
+  { "_f0000000_848",
+    {11, 10, 9, 8, 7, 6, 5},
+    { {"0000011"_b, "unallocated"},
+      {"xxxxxxx"_b, "cmp_reg_a1"},
+    },
+  },
+
+  { "_f0000000_849",
+    {11, 10, 9, 8, 7, 6, 5},
+    { {"0000011"_b, "_f0000000_850"},
+      {"xxxxxxx"_b, "_f0000000_851"},
+    },
+  },
+
+  { "_f0000000_850",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "cmn_rrx_a1"},
+    },
+  },
+
+  { "_f0000000_851",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "_f0000000_852"},
+    },
+  },
+
+  { "_f0000000_852",
+    {11, 10, 9, 8, 7, 6, 5},
+    { {"0000011"_b, "unallocated"},
+      {"xxxxxxx"_b, "cmn_reg_a1"},
+    },
+  },
+
+  { "_f0000000_853",
+    {11, 10, 9, 8, 7, 6, 5},
+    { {"0000011"_b, "_f0000000_854"},
+      {"xxxxxxx"_b, "_f0000000_855"},
+    },
+  },
+
+  { "_f0000000_854",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "orrs_rrx_a1"},
+    },
+  },
+
+  { "_f0000000_855",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "_f0000000_856"},
+    },
+  },
+
+  { "_f0000000_856",
+    {11, 10, 9, 8, 7, 6, 5},
+    { {"0000011"_b, "unallocated"},
+      {"xxxxxxx"_b, "orrs_reg_a1"},
+    },
+  },
+
+  { "_f0000000_857",
+    {11, 10, 9, 8, 7, 6, 5},
+    { {"0000011"_b, "_f0000000_858"},
+      {"xxxxxxx"_b, "_f0000000_860"},
+    },
+  },
+
+  { "_f0000000_858",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "_f0000000_859"},
+    },
+  },
+
+  { "_f0000000_859",
+    {31, 30, 29, 28},
+    { {"1111"_b, "movs_rrx_a1"},
+      {"xxxx"_b, "rrxs_a1"},
+    },
+  },
+
+  { "_f0000000_860",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "_f0000000_861"},
+    },
+  },
+
+  { "_f0000000_861",
+    {11, 10, 9, 8, 7, 6, 5},
+    { {"0000011"_b, "unallocated"},
+      {"xxxxxxx"_b, "_f0000000_862"},
+    },
+  },
+
+  { "_f0000000_862",
+    {6, 5},
+    { {"10"_b, "_f0000000_863"},
+      {"xx"_b, "_f0000000_864"},
+    },
+  },
+
+  { "_f0000000_863",
+    {31, 30, 29, 28},
+    { {"1111"_b, "_f0000000_864"},
+      {"xxxx"_b, "asrs_imm_a1"},
+    },
+  },
+
+  { "_f0000000_864",
+    {6, 5},
+    { {"00"_b, "_f0000000_865"},
+      {"xx"_b, "_f0000000_866"},
+    },
+  },
+
+  { "_f0000000_865",
+    {31, 30, 29, 28},
+    { {"1111"_b, "_f0000000_866"},
+      {"xxxx"_b, "_f0000000_871"},
+    },
+  },
+
+  { "_f0000000_866",
+    {6, 5},
+    { {"01"_b, "_f0000000_867"},
+      {"xx"_b, "_f0000000_868"},
+    },
+  },
+
+  { "_f0000000_867",
+    {31, 30, 29, 28},
+    { {"1111"_b, "_f0000000_868"},
+      {"xxxx"_b, "lsrs_imm_a1"},
+    },
+  },
+
+  { "_f0000000_868",
+    {6, 5},
+    { {"11"_b, "_f0000000_869"},
+      {"xx"_b, "movs_reg_a1"},
+    },
+  },
+
+  { "_f0000000_869",
+    {31, 30, 29, 28},
+    { {"1111"_b, "movs_reg_a1"},
+      {"xxxx"_b, "_f0000000_870"},
+    },
+  },
+
+  { "_f0000000_870",
+    {11, 10, 9, 8, 7},
+    { {"00000"_b, "movs_reg_a1"},
+      {"xxxxx"_b, "rors_imm_a1"},
+    },
+  },
+
+  { "_f0000000_871",
+    {11, 10, 9, 8, 7},
+    { {"00000"_b, "_f0000000_866"},
+      {"xxxxx"_b, "lsls_imm_a1"},
+    },
+  },
+
+  { "_f0000000_872",
+    {11, 10, 9, 8, 7, 6, 5},
+    { {"0000011"_b, "_f0000000_873"},
+      {"xxxxxxx"_b, "_f0000000_874"},
+    },
+  },
+
+  { "_f0000000_873",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "bics_rrx_a1"},
+    },
+  },
+
+  { "_f0000000_874",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "_f0000000_875"},
+    },
+  },
+
+  { "_f0000000_875",
+    {11, 10, 9, 8, 7, 6, 5},
+    { {"0000011"_b, "unallocated"},
+      {"xxxxxxx"_b, "bics_reg_a1"},
+    },
+  },
+
+  { "_f0000000_876",
+    {11, 10, 9, 8, 7, 6, 5},
+    { {"0000011"_b, "_f0000000_877"},
+      {"xxxxxxx"_b, "_f0000000_878"},
+    },
+  },
+
+  { "_f0000000_877",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "mvns_rrx_a1"},
+    },
+  },
+
+  { "_f0000000_878",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "_f0000000_879"},
+    },
+  },
+
+  { "_f0000000_879",
+    {11, 10, 9, 8, 7, 6, 5},
+    { {"0000011"_b, "unallocated"},
+      {"xxxxxxx"_b, "mvns_reg_a1"},
+    },
+  },
+
+  { "_f0000000_880",
+    {22, 7},
+    { {"00"_b, "_f0000000_881"},
+      {"01"_b, "_f0000000_898"},
+      {"10"_b, "_f0000000_924"},
+      {"11"_b, "_f0000000_933"},
+    },
+  },
+
+  { "_f0000000_881",
+    {24, 23, 21},
+    { {"000"_b, "_f0000000_882"},
+      {"001"_b, "_f0000000_883"},
+      {"010"_b, "_f0000000_884"},
+      {"011"_b, "_f0000000_885"},
+      {"100"_b, "_f0000000_886"},
+      {"101"_b, "_f0000000_887"},
+      {"110"_b, "_f0000000_888"},
+      {"111"_b, "_f0000000_889"},
+    },
+  },
+
+  { "_f0000000_882",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "ands_rsr_a1"},
+    },
+  },
+
+  { "_f0000000_883",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "eors_rsr_a1"},
+    },
+  },
+
+  { "_f0000000_884",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "adds_rsr_a1"},
+    },
+  },
+
+  { "_f0000000_885",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "adcs_rsr_a1"},
+    },
+  },
+
+  { "_f0000000_886",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "tst_rsr_a1"},
+    },
+  },
+
+  { "_f0000000_887",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "teq_rsr_a1"},
+    },
+  },
+
+  { "_f0000000_888",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "orrs_rsr_a1"},
+    },
+  },
+
+  { "_f0000000_889",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "_f0000000_890"},
+    },
+  },
+
+  { "_f0000000_890",
+    {6, 5},
+    { {"10"_b, "_f0000000_891"},
+      {"xx"_b, "_f0000000_892"},
+    },
+  },
+
+  { "_f0000000_891",
+    {31, 30, 29, 28},
+    { {"1111"_b, "_f0000000_892"},
+      {"xxxx"_b, "asrs_reg_a1"},
+    },
+  },
+
+  { "_f0000000_892",
+    {6, 5},
+    { {"00"_b, "_f0000000_893"},
+      {"xx"_b, "_f0000000_894"},
+    },
+  },
+
+  { "_f0000000_893",
+    {31, 30, 29, 28},
+    { {"1111"_b, "_f0000000_894"},
+      {"xxxx"_b, "lsls_reg_a1"},
+    },
+  },
+
+  { "_f0000000_894",
+    {6, 5},
+    { {"01"_b, "_f0000000_895"},
+      {"xx"_b, "_f0000000_896"},
+    },
+  },
+
+  { "_f0000000_895",
+    {31, 30, 29, 28},
+    { {"1111"_b, "_f0000000_896"},
+      {"xxxx"_b, "lsrs_reg_a1"},
+    },
+  },
+
+  { "_f0000000_896",
+    {6, 5},
+    { {"11"_b, "_f0000000_897"},
+      {"xx"_b, "movs_rsr_a1"},
+    },
+  },
+
+  { "_f0000000_897",
+    {31, 30, 29, 28},
+    { {"1111"_b, "movs_rsr_a1"},
+      {"xxxx"_b, "rors_reg_a1"},
+    },
+  },
+
+  { "_f0000000_898",
+    {24, 21, 6, 5},
+    { {"0000"_b, "_f0000000_899"},
+      {"0001"_b, "_f0000000_902"},
+      {"0010"_b, "_f0000000_903"},
+      {"0011"_b, "_f0000000_904"},
+      {"0100"_b, "_f0000000_905"},
+      {"0101"_b, "_f0000000_908"},
+      {"0110"_b, "_f0000000_909"},
+      {"0111"_b, "_f0000000_910"},
+      {"1000"_b, "_f0000000_911"},
+      {"1001"_b, "_f0000000_915"},
+      {"1010"_b, "_f0000000_916"},
+      {"1011"_b, "_f0000000_917"},
+      {"1100"_b, "_f0000000_918"},
+      {"1101"_b, "_f0000000_921"},
+      {"1110"_b, "_f0000000_922"},
+      {"1111"_b, "_f0000000_923"},
+    },
+  },
+
+  { "_f0000000_899",
+    {23},
+    { {"0"_b, "_f0000000_900"},
+      {"1"_b, "_f0000000_901"},
+    },
+  },
+
+  { "_f0000000_900",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "muls_a1"},
+    },
+  },
+
+  { "_f0000000_901",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "umulls_a1"},
+    },
+  },
+
+  { "_f0000000_902",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "ldrh_reg_post_a1"},
+    },
+  },
+
+  { "_f0000000_903",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "ldrsb_reg_post_a1"},
+    },
+  },
+
+  { "_f0000000_904",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "ldrsh_reg_post_a1"},
+    },
+  },
+
+  { "_f0000000_905",
+    {23},
+    { {"0"_b, "_f0000000_906"},
+      {"1"_b, "_f0000000_907"},
+    },
+  },
+
+  { "_f0000000_906",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "mlas_a1"},
+    },
+  },
+
+  { "_f0000000_907",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "umlals_a1"},
+    },
+  },
+
+  { "_f0000000_908",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "ldrht_a2"},
+    },
+  },
+
+  { "_f0000000_909",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "ldrsbt_a2"},
+    },
+  },
+
+  { "_f0000000_910",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "ldrsht_a2"},
+    },
+  },
+
+  { "_f0000000_911",
+    {23, 9, 8},
+    { {"100"_b, "_f0000000_912"},
+      {"110"_b, "_f0000000_913"},
+      {"111"_b, "_f0000000_914"},
+      {"xxx"_b, "unallocated"},
+    },
+  },
+
+  { "_f0000000_912",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "lda_a1"},
+    },
+  },
+
+  { "_f0000000_913",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "ldaex_a1"},
+    },
+  },
+
+  { "_f0000000_914",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "ldrex_a1"},
+    },
+  },
+
+  { "_f0000000_915",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "ldrh_reg_off_a1"},
+    },
+  },
+
+  { "_f0000000_916",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "ldrsb_reg_off_a1"},
+    },
+  },
+
+  { "_f0000000_917",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "ldrsh_reg_off_a1"},
+    },
+  },
+
+  { "_f0000000_918",
+    {23, 9, 8},
+    { {"110"_b, "_f0000000_919"},
+      {"111"_b, "_f0000000_920"},
+      {"xxx"_b, "unallocated"},
+    },
+  },
+
+  { "_f0000000_919",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "ldaexd_a1"},
+    },
+  },
+
+  { "_f0000000_920",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "ldrexd_a1"},
+    },
+  },
+
+  { "_f0000000_921",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "ldrh_reg_pre_a1"},
+    },
+  },
+
+  { "_f0000000_922",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "ldrsb_reg_pre_a1"},
+    },
+  },
+
+  { "_f0000000_923",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "ldrsh_reg_pre_a1"},
+    },
+  },
+
+  { "_f0000000_924",
+    {24, 23, 21},
+    { {"000"_b, "_f0000000_925"},
+      {"001"_b, "_f0000000_926"},
+      {"010"_b, "_f0000000_927"},
+      {"011"_b, "_f0000000_928"},
+      {"100"_b, "_f0000000_929"},
+      {"101"_b, "_f0000000_930"},
+      {"110"_b, "_f0000000_931"},
+      {"111"_b, "_f0000000_932"},
+    },
+  },
+
+  { "_f0000000_925",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "subs_rsr_a1"},
+    },
+  },
+
+  { "_f0000000_926",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "rsbs_rsr_a1"},
+    },
+  },
+
+  { "_f0000000_927",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "sbcs_rsr_a1"},
+    },
+  },
+
+  { "_f0000000_928",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "rscs_rsr_a1"},
+    },
+  },
+
+  { "_f0000000_929",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "cmp_rsr_a1"},
+    },
+  },
+
+  { "_f0000000_930",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "cmn_rsr_a1"},
+    },
+  },
+
+  { "_f0000000_931",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "bics_rsr_a1"},
+    },
+  },
+
+  { "_f0000000_932",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "mvns_rsr_a1"},
+    },
+  },
+
+  { "_f0000000_933",
+    {6, 5},
+    { {"00"_b, "_f0000000_934"},
+      {"01"_b, "_f0000000_945"},
+      {"10"_b, "_f0000000_956"},
+      {"11"_b, "_f0000000_967"},
+    },
+  },
+
+  { "_f0000000_934",
+    {24, 23, 21},
+    { {"010"_b, "_f0000000_935"},
+      {"011"_b, "_f0000000_936"},
+      {"110"_b, "_f0000000_937"},
+      {"111"_b, "_f0000000_941"},
+      {"xxx"_b, "unallocated"},
+    },
+  },
+
+  { "_f0000000_935",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "smulls_a1"},
+    },
+  },
+
+  { "_f0000000_936",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "smlals_a1"},
+    },
+  },
+
+  { "_f0000000_937",
+    {9, 8},
+    { {"00"_b, "_f0000000_938"},
+      {"10"_b, "_f0000000_939"},
+      {"11"_b, "_f0000000_940"},
+      {"xx"_b, "unallocated"},
+    },
+  },
+
+  { "_f0000000_938",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "ldab_a1"},
+    },
+  },
+
+  { "_f0000000_939",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "ldaexb_a1"},
+    },
+  },
+
+  { "_f0000000_940",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "ldrexb_a1"},
+    },
+  },
+
+  { "_f0000000_941",
+    {9, 8},
+    { {"00"_b, "_f0000000_942"},
+      {"10"_b, "_f0000000_943"},
+      {"11"_b, "_f0000000_944"},
+      {"xx"_b, "unallocated"},
+    },
+  },
+
+  { "_f0000000_942",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "ldah_a1"},
+    },
+  },
+
+  { "_f0000000_943",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "ldaexh_a1"},
+    },
+  },
+
+  { "_f0000000_944",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "ldrexh_a1"},
+    },
+  },
+
+  { "_f0000000_945",
+    {24, 21},
+    { {"00"_b, "_f0000000_946"},
+      {"01"_b, "_f0000000_949"},
+      {"10"_b, "_f0000000_950"},
+      {"11"_b, "_f0000000_953"},
+    },
+  },
+
+  { "_f0000000_946",
+    {19, 18, 17, 16},
+    { {"1111"_b, "_f0000000_947"},
+      {"xxxx"_b, "_f0000000_948"},
+    },
+  },
+
+  { "_f0000000_947",
+    {31, 30, 29, 28, 24, 21},
+    { {"1111xx"_b, "unallocated"},
+      {"xxxx01"_b, "unallocated"},
+      {"xxxxxx"_b, "ldrh_lit_a1"},
+    },
+  },
+
+  { "_f0000000_948",
+    {31, 30, 29, 28, 19, 18, 17, 16},
+    { {"1111xxxx"_b, "unallocated"},
+      {"xxxx1111"_b, "unallocated"},
+      {"xxxxxxxx"_b, "ldrh_imm_post_a1"},
+    },
+  },
+
+  { "_f0000000_949",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "ldrht_a1"},
+    },
+  },
+
+  { "_f0000000_950",
+    {19, 18, 17, 16},
+    { {"1111"_b, "_f0000000_951"},
+      {"xxxx"_b, "_f0000000_952"},
+    },
+  },
+
+  { "_f0000000_951",
+    {31, 30, 29, 28, 24, 21},
+    { {"1111xx"_b, "unallocated"},
+      {"xxxx01"_b, "unallocated"},
+      {"xxxxxx"_b, "ldrh_lit_a1"},
+    },
+  },
+
+  { "_f0000000_952",
+    {31, 30, 29, 28, 19, 18, 17, 16},
+    { {"1111xxxx"_b, "unallocated"},
+      {"xxxx1111"_b, "unallocated"},
+      {"xxxxxxxx"_b, "ldrh_imm_off_a1"},
+    },
+  },
+
+  { "_f0000000_953",
+    {19, 18, 17, 16},
+    { {"1111"_b, "_f0000000_954"},
+      {"xxxx"_b, "_f0000000_955"},
+    },
+  },
+
+  { "_f0000000_954",
+    {31, 30, 29, 28, 24, 21},
+    { {"1111xx"_b, "unallocated"},
+      {"xxxx01"_b, "unallocated"},
+      {"xxxxxx"_b, "ldrh_lit_a1"},
+    },
+  },
+
+  { "_f0000000_955",
+    {31, 30, 29, 28, 19, 18, 17, 16},
+    { {"1111xxxx"_b, "unallocated"},
+      {"xxxx1111"_b, "unallocated"},
+      {"xxxxxxxx"_b, "ldrh_imm_pre_a1"},
+    },
+  },
+
+  { "_f0000000_956",
+    {24, 21},
+    { {"00"_b, "_f0000000_957"},
+      {"01"_b, "_f0000000_960"},
+      {"10"_b, "_f0000000_961"},
+      {"11"_b, "_f0000000_964"},
+    },
+  },
+
+  { "_f0000000_957",
+    {19, 18, 17, 16},
+    { {"1111"_b, "_f0000000_958"},
+      {"xxxx"_b, "_f0000000_959"},
+    },
+  },
+
+  { "_f0000000_958",
+    {31, 30, 29, 28, 24, 21},
+    { {"1111xx"_b, "unallocated"},
+      {"xxxx01"_b, "unallocated"},
+      {"xxxxxx"_b, "ldrsb_lit_a1"},
+    },
+  },
+
+  { "_f0000000_959",
+    {31, 30, 29, 28, 19, 18, 17, 16},
+    { {"1111xxxx"_b, "unallocated"},
+      {"xxxx1111"_b, "unallocated"},
+      {"xxxxxxxx"_b, "ldrsb_imm_post_a1"},
+    },
+  },
+
+  { "_f0000000_960",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "ldrsbt_a1"},
+    },
+  },
+
+  { "_f0000000_961",
+    {19, 18, 17, 16},
+    { {"1111"_b, "_f0000000_962"},
+      {"xxxx"_b, "_f0000000_963"},
+    },
+  },
+
+  { "_f0000000_962",
+    {31, 30, 29, 28, 24, 21},
+    { {"1111xx"_b, "unallocated"},
+      {"xxxx01"_b, "unallocated"},
+      {"xxxxxx"_b, "ldrsb_lit_a1"},
+    },
+  },
+
+  { "_f0000000_963",
+    {31, 30, 29, 28, 19, 18, 17, 16},
+    { {"1111xxxx"_b, "unallocated"},
+      {"xxxx1111"_b, "unallocated"},
+      {"xxxxxxxx"_b, "ldrsb_imm_off_a1"},
+    },
+  },
+
+  { "_f0000000_964",
+    {19, 18, 17, 16},
+    { {"1111"_b, "_f0000000_965"},
+      {"xxxx"_b, "_f0000000_966"},
+    },
+  },
+
+  { "_f0000000_965",
+    {31, 30, 29, 28, 24, 21},
+    { {"1111xx"_b, "unallocated"},
+      {"xxxx01"_b, "unallocated"},
+      {"xxxxxx"_b, "ldrsb_lit_a1"},
+    },
+  },
+
+  { "_f0000000_966",
+    {31, 30, 29, 28, 19, 18, 17, 16},
+    { {"1111xxxx"_b, "unallocated"},
+      {"xxxx1111"_b, "unallocated"},
+      {"xxxxxxxx"_b, "ldrsb_imm_pre_a1"},
+    },
+  },
+
+  { "_f0000000_967",
+    {24, 21},
+    { {"00"_b, "_f0000000_968"},
+      {"01"_b, "_f0000000_971"},
+      {"10"_b, "_f0000000_972"},
+      {"11"_b, "_f0000000_975"},
+    },
+  },
+
+  { "_f0000000_968",
+    {19, 18, 17, 16},
+    { {"1111"_b, "_f0000000_969"},
+      {"xxxx"_b, "_f0000000_970"},
+    },
+  },
+
+  { "_f0000000_969",
+    {31, 30, 29, 28, 24, 21},
+    { {"1111xx"_b, "unallocated"},
+      {"xxxx01"_b, "unallocated"},
+      {"xxxxxx"_b, "ldrsh_lit_a1"},
+    },
+  },
+
+  { "_f0000000_970",
+    {31, 30, 29, 28, 19, 18, 17, 16},
+    { {"1111xxxx"_b, "unallocated"},
+      {"xxxx1111"_b, "unallocated"},
+      {"xxxxxxxx"_b, "ldrsh_imm_post_a1"},
+    },
+  },
+
+  { "_f0000000_971",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "ldrsht_a1"},
+    },
+  },
+
+  { "_f0000000_972",
+    {19, 18, 17, 16},
+    { {"1111"_b, "_f0000000_973"},
+      {"xxxx"_b, "_f0000000_974"},
+    },
+  },
+
+  { "_f0000000_973",
+    {31, 30, 29, 28, 24, 21},
+    { {"1111xx"_b, "unallocated"},
+      {"xxxx01"_b, "unallocated"},
+      {"xxxxxx"_b, "ldrsh_lit_a1"},
+    },
+  },
+
+  { "_f0000000_974",
+    {31, 30, 29, 28, 19, 18, 17, 16},
+    { {"1111xxxx"_b, "unallocated"},
+      {"xxxx1111"_b, "unallocated"},
+      {"xxxxxxxx"_b, "ldrsh_imm_off_a1"},
+    },
+  },
+
+  { "_f0000000_975",
+    {19, 18, 17, 16},
+    { {"1111"_b, "_f0000000_976"},
+      {"xxxx"_b, "_f0000000_977"},
+    },
+  },
+
+  { "_f0000000_976",
+    {31, 30, 29, 28, 24, 21},
+    { {"1111xx"_b, "unallocated"},
+      {"xxxx01"_b, "unallocated"},
+      {"xxxxxx"_b, "ldrsh_lit_a1"},
+    },
+  },
+
+  { "_f0000000_977",
+    {31, 30, 29, 28, 19, 18, 17, 16},
+    { {"1111xxxx"_b, "unallocated"},
+      {"xxxx1111"_b, "unallocated"},
+      {"xxxxxxxx"_b, "ldrsh_imm_pre_a1"},
+    },
+  },
+
+  { "_f0000000_978",
+    {24, 23, 21, 20},
+    { {"0000"_b, "_f0000000_979"},
+      {"0001"_b, "_f0000000_986"},
+      {"0010"_b, "_f0000000_991"},
+      {"0011"_b, "_f0000000_994"},
+      {"0100"_b, "_f0000000_997"},
+      {"0101"_b, "_f0000000_1004"},
+      {"0110"_b, "_f0000000_1009"},
+      {"0111"_b, "_f0000000_1012"},
+      {"1000"_b, "_f0000000_1015"},
+      {"1001"_b, "_f0000000_1018"},
+      {"1010"_b, "_f0000000_1021"},
+      {"1011"_b, "_f0000000_1033"},
+      {"1100"_b, "_f0000000_1036"},
+      {"1101"_b, "_f0000000_1039"},
+      {"1110"_b, "_f0000000_1042"},
+      {"1111"_b, "_f0000000_1045"},
+    },
+  },
+
+  { "_f0000000_979",
+    {22},
+    { {"0"_b, "_f0000000_980"},
+      {"1"_b, "_f0000000_981"},
+    },
+  },
+
+  { "_f0000000_980",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "and_imm_a1"},
+    },
+  },
+
+  { "_f0000000_981",
+    {19, 18, 16},
+    { {"111"_b, "_f0000000_982"},
+      {"xxx"_b, "_f0000000_985"},
+    },
+  },
+
+  { "_f0000000_982",
+    {17},
+    { {"0"_b, "_f0000000_983"},
+      {"1"_b, "_f0000000_984"},
+    },
+  },
+
+  { "_f0000000_983",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "sub_sp_imm_a1"},
+    },
+  },
+
+  { "_f0000000_984",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "_f0000000_1581"},
+    },
+  },
+
+  { "_f0000000_1581",
+    {11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0},
+    { {"000000000000"_b, "sub_a2"},
+      {"xxxxxxxxxxxx"_b, "adr_a2"},
+    },
+  },
+
+  { "_f0000000_985",
+    {31, 30, 29, 28, 19, 18, 16},
+    { {"1111xxx"_b, "unallocated"},
+      {"xxxx111"_b, "unallocated"},
+      {"xxxxxxx"_b, "sub_imm_a1"},
+    },
+  },
+
+  { "_f0000000_986",
+    {22},
+    { {"0"_b, "_f0000000_987"},
+      {"1"_b, "_f0000000_988"},
+    },
+  },
+
+  { "_f0000000_987",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "ands_imm_a1"},
+    },
+  },
+
+  { "_f0000000_988",
+    {19, 18, 17, 16},
+    { {"1101"_b, "_f0000000_989"},
+      {"xxxx"_b, "_f0000000_990"},
+    },
+  },
+
+  { "_f0000000_989",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "subs_sp_imm_a1"},
+    },
+  },
+
+  { "_f0000000_990",
+    {31, 30, 29, 28, 19, 18, 17, 16},
+    { {"1111xxxx"_b, "unallocated"},
+      {"xxxx1101"_b, "unallocated"},
+      {"xxxxxxxx"_b, "subs_imm_a1"},
+    },
+  },
+
+  { "_f0000000_991",
+    {22},
+    { {"0"_b, "_f0000000_992"},
+      {"1"_b, "_f0000000_993"},
+    },
+  },
+
+  { "_f0000000_992",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "eor_imm_a1"},
+    },
+  },
+
+  { "_f0000000_993",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "rsb_imm_a1"},
+    },
+  },
+
+  { "_f0000000_994",
+    {22},
+    { {"0"_b, "_f0000000_995"},
+      {"1"_b, "_f0000000_996"},
+    },
+  },
+
+  { "_f0000000_995",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "eors_imm_a1"},
+    },
+  },
+
+  { "_f0000000_996",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "rsbs_imm_a1"},
+    },
+  },
+
+  { "_f0000000_997",
+    {22},
+    { {"0"_b, "_f0000000_998"},
+      {"1"_b, "_f0000000_1003"},
+    },
+  },
+
+  { "_f0000000_998",
+    {19, 18, 16},
+    { {"111"_b, "_f0000000_999"},
+      {"xxx"_b, "_f0000000_1002"},
+    },
+  },
+
+  { "_f0000000_999",
+    {17},
+    { {"0"_b, "_f0000000_1000"},
+      {"1"_b, "_f0000000_1001"},
+    },
+  },
+
+  { "_f0000000_1000",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "add_sp_imm_a1"},
+    },
+  },
+
+  { "_f0000000_1001",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "adr_a1"},
+    },
+  },
+
+  { "_f0000000_1002",
+    {31, 30, 29, 28, 19, 18, 16},
+    { {"1111xxx"_b, "unallocated"},
+      {"xxxx111"_b, "unallocated"},
+      {"xxxxxxx"_b, "add_imm_a1"},
+    },
+  },
+
+  { "_f0000000_1003",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "sbc_imm_a1"},
+    },
+  },
+
+  { "_f0000000_1004",
+    {22},
+    { {"0"_b, "_f0000000_1005"},
+      {"1"_b, "_f0000000_1008"},
+    },
+  },
+
+  { "_f0000000_1005",
+    {19, 18, 17, 16},
+    { {"1101"_b, "_f0000000_1006"},
+      {"xxxx"_b, "_f0000000_1007"},
+    },
+  },
+
+  { "_f0000000_1006",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "adds_sp_imm_a1"},
+    },
+  },
+
+  { "_f0000000_1007",
+    {31, 30, 29, 28, 19, 18, 17, 16},
+    { {"1111xxxx"_b, "unallocated"},
+      {"xxxx1101"_b, "unallocated"},
+      {"xxxxxxxx"_b, "adds_imm_a1"},
+    },
+  },
+
+  { "_f0000000_1008",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "sbcs_imm_a1"},
+    },
+  },
+
+  { "_f0000000_1009",
+    {22},
+    { {"0"_b, "_f0000000_1010"},
+      {"1"_b, "_f0000000_1011"},
+    },
+  },
+
+  { "_f0000000_1010",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "adc_imm_a1"},
+    },
+  },
+
+  { "_f0000000_1011",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "rsc_imm_a1"},
+    },
+  },
+
+  { "_f0000000_1012",
+    {22},
+    { {"0"_b, "_f0000000_1013"},
+      {"1"_b, "_f0000000_1014"},
+    },
+  },
+
+  { "_f0000000_1013",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "adcs_imm_a1"},
+    },
+  },
+
+  { "_f0000000_1014",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "rscs_imm_a1"},
+    },
+  },
+
+  { "_f0000000_1015",
+    {22},
+    { {"0"_b, "_f0000000_1016"},
+      {"1"_b, "_f0000000_1017"},
+    },
+  },
+
+  { "_f0000000_1016",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "mov_a2"},
+    },
+  },
+
+  { "_f0000000_1017",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "movt_a1"},
+    },
+  },
+
+  { "_f0000000_1018",
+    {22},
+    { {"0"_b, "_f0000000_1019"},
+      {"1"_b, "_f0000000_1020"},
+    },
+  },
+
+  { "_f0000000_1019",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "tst_imm_a1"},
+    },
+  },
+
+  { "_f0000000_1020",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "cmp_imm_a1"},
+    },
+  },
+
+  { "_f0000000_1021",
+    {22, 19, 18, 17, 16},
+    { {"00000"_b, "_f0000000_1022"},
+      {"xxxxx"_b, "_f0000000_1031"},
+    },
+  },
+
+  { "_f0000000_1022",
+    {7, 6, 5, 4},
+    { {"0000"_b, "_f0000000_1023"},
+      {"1111"_b, "_f0000000_1030"},
+      {"xxxx"_b, "unallocated"},
+    },
+  },
+
+  { "_f0000000_1023",
+    {3, 2, 1, 0},
+    { {"0000"_b, "_f0000000_1024"},
+      {"0001"_b, "_f0000000_1025"},
+      {"0010"_b, "_f0000000_1026"},
+      {"0011"_b, "_f0000000_1027"},
+      {"0100"_b, "_f0000000_1028"},
+      {"0101"_b, "_f0000000_1029"},
+      {"xxxx"_b, "unallocated"},
+    },
+  },
+
+  { "_f0000000_1024",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "nop_a1"},
+    },
+  },
+
+  { "_f0000000_1025",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "yield_a1"},
+    },
+  },
+
+  { "_f0000000_1026",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "wfe_a1"},
+    },
+  },
+
+  { "_f0000000_1027",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "wfi_a1"},
+    },
+  },
+
+  { "_f0000000_1028",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "sev_a1"},
+    },
+  },
+
+  { "_f0000000_1029",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "sevl_a1"},
+    },
+  },
+
+  { "_f0000000_1030",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "dbg_a1"},
+    },
+  },
+
+  { "_f0000000_1031",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "_f0000000_1032"},
+    },
+  },
+
+  { "_f0000000_1032",
+    {22, 19, 18, 17, 16},
+    { {"00000"_b, "unallocated"},
+      {"xxxxx"_b, "msr_imm_a1"},
+    },
+  },
+
+  { "_f0000000_1033",
+    {22},
+    { {"0"_b, "_f0000000_1034"},
+      {"1"_b, "_f0000000_1035"},
+    },
+  },
+
+  { "_f0000000_1034",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "teq_imm_a1"},
+    },
+  },
+
+  { "_f0000000_1035",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "cmn_imm_a1"},
+    },
+  },
+
+  { "_f0000000_1036",
+    {22},
+    { {"0"_b, "_f0000000_1037"},
+      {"1"_b, "_f0000000_1038"},
+    },
+  },
+
+  { "_f0000000_1037",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "orr_imm_a1"},
+    },
+  },
+
+  { "_f0000000_1038",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "bic_imm_a1"},
+    },
+  },
+
+  { "_f0000000_1039",
+    {22},
+    { {"0"_b, "_f0000000_1040"},
+      {"1"_b, "_f0000000_1041"},
+    },
+  },
+
+  { "_f0000000_1040",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "orrs_imm_a1"},
+    },
+  },
+
+  { "_f0000000_1041",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "bics_imm_a1"},
+    },
+  },
+
+  { "_f0000000_1042",
+    {22},
+    { {"0"_b, "_f0000000_1043"},
+      {"1"_b, "_f0000000_1044"},
+    },
+  },
+
+  { "_f0000000_1043",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "mov_imm_a1"},
+    },
+  },
+
+  { "_f0000000_1044",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "mvn_imm_a1"},
+    },
+  },
+
+  { "_f0000000_1045",
+    {22},
+    { {"0"_b, "_f0000000_1046"},
+      {"1"_b, "_f0000000_1047"},
+    },
+  },
+
+  { "_f0000000_1046",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "movs_imm_a1"},
+    },
+  },
+
+  { "_f0000000_1047",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "mvns_imm_a1"},
+    },
+  },
+
+  { "_f0000000_1048",
+    {22, 20},
+    { {"00"_b, "_f0000000_1049"},
+      {"01"_b, "_f0000000_1054"},
+      {"10"_b, "_f0000000_1065"},
+      {"11"_b, "_f0000000_1070"},
+    },
+  },
+
+  { "_f0000000_1049",
+    {24, 21},
+    { {"00"_b, "_f0000000_1050"},
+      {"01"_b, "_f0000000_1051"},
+      {"10"_b, "_f0000000_1052"},
+      {"11"_b, "_f0000000_1053"},
+    },
+  },
+
+  { "_f0000000_1050",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "str_imm_post_a1"},
+    },
+  },
+
+  { "_f0000000_1051",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "strt_a1"},
+    },
+  },
+
+  { "_f0000000_1052",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "str_imm_off_a1"},
+    },
+  },
+
+  { "_f0000000_1053",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "_f0000000_1582"},
+    },
+  },
+
+  { "_f0000000_1582",
+    {23, 19, 18, 17, 16, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0},
+    { {"01101000000000100"_b, "push_single_a1"},
+      {"xxxxxxxxxxxxxxxxx"_b, "str_imm_pre_a1"},
+    },
+  },
+
+  { "_f0000000_1054",
+    {24, 21},
+    { {"00"_b, "_f0000000_1055"},
+      {"01"_b, "_f0000000_1058"},
+      {"10"_b, "_f0000000_1059"},
+      {"11"_b, "_f0000000_1062"},
+    },
+  },
+
+  { "_f0000000_1055",
+    {19, 18, 17, 16},
+    { {"1111"_b, "_f0000000_1056"},
+      {"xxxx"_b, "_f0000000_1057"},
+    },
+  },
+
+  { "_f0000000_1056",
+    {31, 30, 29, 28, 24, 21},
+    { {"1111xx"_b, "unallocated"},
+      {"xxxx01"_b, "unallocated"},
+      {"xxxxxx"_b, "ldr_lit_a1"},
+    },
+  },
+
+  { "_f0000000_1057",
+    {31, 30, 29, 28, 19, 18, 17, 16},
+    { {"1111xxxx"_b, "unallocated"},
+      {"xxxx1111"_b, "unallocated"},
+      {"xxxxxxxx"_b, "_f0000000_1583"},
+    },
+  },
+
+  { "_f0000000_1583",
+    {23, 19, 18, 17, 16, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0},
+    { {"11101000000000100"_b, "pop_single_a1"},
+      {"xxxxxxxxxxxxxxxxx"_b, "ldr_imm_post_a1"},
+    },
+  },
+
+  { "_f0000000_1058",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "ldrt_a1"},
+    },
+  },
+
+  { "_f0000000_1059",
+    {19, 18, 17, 16},
+    { {"1111"_b, "_f0000000_1060"},
+      {"xxxx"_b, "_f0000000_1061"},
+    },
+  },
+
+  { "_f0000000_1060",
+    {31, 30, 29, 28, 24, 21},
+    { {"1111xx"_b, "unallocated"},
+      {"xxxx01"_b, "unallocated"},
+      {"xxxxxx"_b, "ldr_lit_a1"},
+    },
+  },
+
+  { "_f0000000_1061",
+    {31, 30, 29, 28, 19, 18, 17, 16},
+    { {"1111xxxx"_b, "unallocated"},
+      {"xxxx1111"_b, "unallocated"},
+      {"xxxxxxxx"_b, "ldr_imm_off_a1"},
+    },
+  },
+
+  { "_f0000000_1062",
+    {19, 18, 17, 16},
+    { {"1111"_b, "_f0000000_1063"},
+      {"xxxx"_b, "_f0000000_1064"},
+    },
+  },
+
+  { "_f0000000_1063",
+    {31, 30, 29, 28, 24, 21},
+    { {"1111xx"_b, "unallocated"},
+      {"xxxx01"_b, "unallocated"},
+      {"xxxxxx"_b, "ldr_lit_a1"},
+    },
+  },
+
+  { "_f0000000_1064",
+    {31, 30, 29, 28, 19, 18, 17, 16},
+    { {"1111xxxx"_b, "unallocated"},
+      {"xxxx1111"_b, "unallocated"},
+      {"xxxxxxxx"_b, "ldr_imm_pre_a1"},
+    },
+  },
+
+  { "_f0000000_1065",
+    {24, 21},
+    { {"00"_b, "_f0000000_1066"},
+      {"01"_b, "_f0000000_1067"},
+      {"10"_b, "_f0000000_1068"},
+      {"11"_b, "_f0000000_1069"},
+    },
+  },
+
+  { "_f0000000_1066",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "strb_imm_post_a1"},
+    },
+  },
+
+  { "_f0000000_1067",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "strbt_a1"},
+    },
+  },
+
+  { "_f0000000_1068",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "strb_imm_off_a1"},
+    },
+  },
+
+  { "_f0000000_1069",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "strb_imm_pre_a1"},
+    },
+  },
+
+  { "_f0000000_1070",
+    {24, 21},
+    { {"00"_b, "_f0000000_1071"},
+      {"01"_b, "_f0000000_1074"},
+      {"10"_b, "_f0000000_1075"},
+      {"11"_b, "_f0000000_1078"},
+    },
+  },
+
+  { "_f0000000_1071",
+    {19, 18, 17, 16},
+    { {"1111"_b, "_f0000000_1072"},
+      {"xxxx"_b, "_f0000000_1073"},
+    },
+  },
+
+  { "_f0000000_1072",
+    {31, 30, 29, 28, 24, 21},
+    { {"1111xx"_b, "unallocated"},
+      {"xxxx01"_b, "unallocated"},
+      {"xxxxxx"_b, "ldrb_lit_a1"},
+    },
+  },
+
+  { "_f0000000_1073",
+    {31, 30, 29, 28, 19, 18, 17, 16},
+    { {"1111xxxx"_b, "unallocated"},
+      {"xxxx1111"_b, "unallocated"},
+      {"xxxxxxxx"_b, "ldrb_imm_post_a1"},
+    },
+  },
+
+  { "_f0000000_1074",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "ldrbt_a1"},
+    },
+  },
+
+  { "_f0000000_1075",
+    {19, 18, 17, 16},
+    { {"1111"_b, "_f0000000_1076"},
+      {"xxxx"_b, "_f0000000_1077"},
+    },
+  },
+
+  { "_f0000000_1076",
+    {31, 30, 29, 28, 24, 21},
+    { {"1111xx"_b, "unallocated"},
+      {"xxxx01"_b, "unallocated"},
+      {"xxxxxx"_b, "ldrb_lit_a1"},
+    },
+  },
+
+  { "_f0000000_1077",
+    {31, 30, 29, 28, 19, 18, 17, 16},
+    { {"1111xxxx"_b, "unallocated"},
+      {"xxxx1111"_b, "unallocated"},
+      {"xxxxxxxx"_b, "ldrb_imm_off_a1"},
+    },
+  },
+
+  { "_f0000000_1078",
+    {19, 18, 17, 16},
+    { {"1111"_b, "_f0000000_1079"},
+      {"xxxx"_b, "_f0000000_1080"},
+    },
+  },
+
+  { "_f0000000_1079",
+    {31, 30, 29, 28, 24, 21},
+    { {"1111xx"_b, "unallocated"},
+      {"xxxx01"_b, "unallocated"},
+      {"xxxxxx"_b, "ldrb_lit_a1"},
+    },
+  },
+
+  { "_f0000000_1080",
+    {31, 30, 29, 28, 19, 18, 17, 16},
+    { {"1111xxxx"_b, "unallocated"},
+      {"xxxx1111"_b, "unallocated"},
+      {"xxxxxxxx"_b, "ldrb_imm_pre_a1"},
+    },
+  },
+
+  { "_f0000000_1081",
+    {24, 22, 21, 4},
+    { {"0000"_b, "_f0000000_1082"},
+      {"0001"_b, "_f0000000_1085"},
+      {"0010"_b, "_f0000000_1104"},
+      {"0011"_b, "_f0000000_1107"},
+      {"0100"_b, "_f0000000_1137"},
+      {"0101"_b, "_f0000000_1140"},
+      {"0110"_b, "_f0000000_1150"},
+      {"0111"_b, "_f0000000_1153"},
+      {"1000"_b, "_f0000000_1183"},
+      {"1001"_b, "_f0000000_1186"},
+      {"1010"_b, "_f0000000_1203"},
+      {"1011"_b, "_f0000000_1206"},
+      {"1100"_b, "_f0000000_1210"},
+      {"1101"_b, "_f0000000_1213"},
+      {"1110"_b, "_f0000000_1233"},
+      {"1111"_b, "_f0000000_1236"},
+    },
+  },
+
+  { "_f0000000_1082",
+    {20},
+    { {"0"_b, "_f0000000_1083"},
+      {"1"_b, "_f0000000_1084"},
+    },
+  },
+
+  { "_f0000000_1083",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "str_reg_post_a1"},
+    },
+  },
+
+  { "_f0000000_1084",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "ldr_reg_post_a1"},
+    },
+  },
+
+  { "_f0000000_1085",
+    {23, 20, 6, 5},
+    { {"0100"_b, "_f0000000_1086"},
+      {"0101"_b, "_f0000000_1089"},
+      {"0110"_b, "_f0000000_1091"},
+      {"0111"_b, "_f0000000_1093"},
+      {"1000"_b, "_f0000000_1096"},
+      {"1001"_b, "_f0000000_1097"},
+      {"1010"_b, "_f0000000_1099"},
+      {"1011"_b, "_f0000000_1100"},
+      {"xxxx"_b, "unallocated"},
+    },
+  },
+
+  { "_f0000000_1086",
+    {7},
+    { {"0"_b, "_f0000000_1087"},
+      {"1"_b, "_f0000000_1088"},
+    },
+  },
+
+  { "_f0000000_1087",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "sadd16_a1"},
+    },
+  },
+
+  { "_f0000000_1088",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "sadd8_a1"},
+    },
+  },
+
+  { "_f0000000_1089",
+    {7},
+    { {"0"_b, "_f0000000_1090"},
+      {"x"_b, "unallocated"},
+    },
+  },
+
+  { "_f0000000_1090",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "sasx_a1"},
+    },
+  },
+
+  { "_f0000000_1091",
+    {7},
+    { {"0"_b, "_f0000000_1092"},
+      {"x"_b, "unallocated"},
+    },
+  },
+
+  { "_f0000000_1092",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "ssax_a1"},
+    },
+  },
+
+  { "_f0000000_1093",
+    {7},
+    { {"0"_b, "_f0000000_1094"},
+      {"1"_b, "_f0000000_1095"},
+    },
+  },
+
+  { "_f0000000_1094",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "ssub16_a1"},
+    },
+  },
+
+  { "_f0000000_1095",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "ssub8_a1"},
+    },
+  },
+
+  { "_f0000000_1096",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "pkhbt_a1"},
+    },
+  },
+
+  { "_f0000000_1097",
+    {7},
+    { {"1"_b, "_f0000000_1098"},
+      {"x"_b, "unallocated"},
+    },
+  },
+
+  { "_f0000000_1098",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "sel_a1"},
+    },
+  },
+
+  { "_f0000000_1099",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "pkhtb_a1"},
+    },
+  },
+
+  { "_f0000000_1100",
+    {7},
+    { {"0"_b, "_f0000000_1101"},
+      {"x"_b, "unallocated"},
+    },
+  },
+
+  { "_f0000000_1101",
+    {19, 18, 17, 16},
+    { {"1111"_b, "_f0000000_1102"},
+      {"xxxx"_b, "_f0000000_1103"},
+    },
+  },
+
+  { "_f0000000_1102",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "sxtb16_a1"},
+    },
+  },
+
+  { "_f0000000_1103",
+    {31, 30, 29, 28, 19, 18, 17, 16},
+    { {"1111xxxx"_b, "unallocated"},
+      {"xxxx1111"_b, "unallocated"},
+      {"xxxxxxxx"_b, "sxtab16_a1"},
+    },
+  },
+
+  { "_f0000000_1104",
+    {20},
+    { {"0"_b, "_f0000000_1105"},
+      {"1"_b, "_f0000000_1106"},
+    },
+  },
+
+  { "_f0000000_1105",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "strt_a2"},
+    },
+  },
+
+  { "_f0000000_1106",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "ldrt_a2"},
+    },
+  },
+
+  { "_f0000000_1107",
+    {23, 6, 5},
+    { {"000"_b, "_f0000000_1108"},
+      {"001"_b, "_f0000000_1113"},
+      {"010"_b, "_f0000000_1116"},
+      {"011"_b, "_f0000000_1119"},
+      {"100"_b, "_f0000000_1124"},
+      {"101"_b, "_f0000000_1125"},
+      {"110"_b, "_f0000000_1129"},
+      {"111"_b, "_f0000000_1130"},
+    },
+  },
+
+  { "_f0000000_1108",
+    {20, 7},
+    { {"00"_b, "_f0000000_1109"},
+      {"01"_b, "_f0000000_1110"},
+      {"10"_b, "_f0000000_1111"},
+      {"11"_b, "_f0000000_1112"},
+    },
+  },
+
+  { "_f0000000_1109",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "qadd16_a1"},
+    },
+  },
+
+  { "_f0000000_1110",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "qadd8_a1"},
+    },
+  },
+
+  { "_f0000000_1111",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "shadd16_a1"},
+    },
+  },
+
+  { "_f0000000_1112",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "shadd8_a1"},
+    },
+  },
+
+  { "_f0000000_1113",
+    {20, 7},
+    { {"00"_b, "_f0000000_1114"},
+      {"10"_b, "_f0000000_1115"},
+      {"xx"_b, "unallocated"},
+    },
+  },
+
+  { "_f0000000_1114",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "qasx_a1"},
+    },
+  },
+
+  { "_f0000000_1115",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "shasx_a1"},
+    },
+  },
+
+  { "_f0000000_1116",
+    {20, 7},
+    { {"00"_b, "_f0000000_1117"},
+      {"10"_b, "_f0000000_1118"},
+      {"xx"_b, "unallocated"},
+    },
+  },
+
+  { "_f0000000_1117",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "qsax_a1"},
+    },
+  },
+
+  { "_f0000000_1118",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "shsax_a1"},
+    },
+  },
+
+  { "_f0000000_1119",
+    {20, 7},
+    { {"00"_b, "_f0000000_1120"},
+      {"01"_b, "_f0000000_1121"},
+      {"10"_b, "_f0000000_1122"},
+      {"11"_b, "_f0000000_1123"},
+    },
+  },
+
+  { "_f0000000_1120",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "qsub16_a1"},
+    },
+  },
+
+  { "_f0000000_1121",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "qsub8_a1"},
+    },
+  },
+
+  { "_f0000000_1122",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "shsub16_a1"},
+    },
+  },
+
+  { "_f0000000_1123",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "shsub8_a1"},
+    },
+  },
+
+  { "_f0000000_1124",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "ssat_lsl_a1"},
+    },
+  },
+
+  { "_f0000000_1125",
+    {20, 7},
+    { {"00"_b, "_f0000000_1126"},
+      {"10"_b, "_f0000000_1127"},
+      {"11"_b, "_f0000000_1128"},
+      {"xx"_b, "unallocated"},
+    },
+  },
+
+  { "_f0000000_1126",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "ssat16_a1"},
+    },
+  },
+
+  { "_f0000000_1127",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "rev_a1"},
+    },
+  },
+
+  { "_f0000000_1128",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "rev16_a1"},
+    },
+  },
+
+  { "_f0000000_1129",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "ssat_asr_a1"},
+    },
+  },
+
+  { "_f0000000_1130",
+    {20, 7},
+    { {"00"_b, "_f0000000_1131"},
+      {"10"_b, "_f0000000_1134"},
+      {"xx"_b, "unallocated"},
+    },
+  },
+
+  { "_f0000000_1131",
+    {19, 18, 17, 16},
+    { {"1111"_b, "_f0000000_1132"},
+      {"xxxx"_b, "_f0000000_1133"},
+    },
+  },
+
+  { "_f0000000_1132",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "sxtb_a1"},
+    },
+  },
+
+  { "_f0000000_1133",
+    {31, 30, 29, 28, 19, 18, 17, 16},
+    { {"1111xxxx"_b, "unallocated"},
+      {"xxxx1111"_b, "unallocated"},
+      {"xxxxxxxx"_b, "sxtab_a1"},
+    },
+  },
+
+  { "_f0000000_1134",
+    {19, 18, 17, 16},
+    { {"1111"_b, "_f0000000_1135"},
+      {"xxxx"_b, "_f0000000_1136"},
+    },
+  },
+
+  { "_f0000000_1135",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "sxth_a1"},
+    },
+  },
+
+  { "_f0000000_1136",
+    {31, 30, 29, 28, 19, 18, 17, 16},
+    { {"1111xxxx"_b, "unallocated"},
+      {"xxxx1111"_b, "unallocated"},
+      {"xxxxxxxx"_b, "sxtah_a1"},
+    },
+  },
+
+  { "_f0000000_1137",
+    {20},
+    { {"0"_b, "_f0000000_1138"},
+      {"1"_b, "_f0000000_1139"},
+    },
+  },
+
+  { "_f0000000_1138",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "strb_reg_post_a1"},
+    },
+  },
+
+  { "_f0000000_1139",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "ldrb_reg_post_a1"},
+    },
+  },
+
+  { "_f0000000_1140",
+    {23, 20, 7, 6, 5},
+    { {"01000"_b, "_f0000000_1141"},
+      {"01001"_b, "_f0000000_1142"},
+      {"01010"_b, "_f0000000_1143"},
+      {"01011"_b, "_f0000000_1144"},
+      {"01100"_b, "_f0000000_1145"},
+      {"01111"_b, "_f0000000_1146"},
+      {"10011"_b, "_f0000000_1147"},
+      {"xxxxx"_b, "unallocated"},
+    },
+  },
+
+  { "_f0000000_1141",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "uadd16_a1"},
+    },
+  },
+
+  { "_f0000000_1142",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "uasx_a1"},
+    },
+  },
+
+  { "_f0000000_1143",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "usax_a1"},
+    },
+  },
+
+  { "_f0000000_1144",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "usub16_a1"},
+    },
+  },
+
+  { "_f0000000_1145",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "uadd8_a1"},
+    },
+  },
+
+  { "_f0000000_1146",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "usub8_a1"},
+    },
+  },
+
+  { "_f0000000_1147",
+    {19, 18, 17, 16},
+    { {"1111"_b, "_f0000000_1148"},
+      {"xxxx"_b, "_f0000000_1149"},
+    },
+  },
+
+  { "_f0000000_1148",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "uxtb16_a1"},
+    },
+  },
+
+  { "_f0000000_1149",
+    {31, 30, 29, 28, 19, 18, 17, 16},
+    { {"1111xxxx"_b, "unallocated"},
+      {"xxxx1111"_b, "unallocated"},
+      {"xxxxxxxx"_b, "uxtab16_a1"},
+    },
+  },
+
+  { "_f0000000_1150",
+    {20},
+    { {"0"_b, "_f0000000_1151"},
+      {"1"_b, "_f0000000_1152"},
+    },
+  },
+
+  { "_f0000000_1151",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "strbt_a2"},
+    },
+  },
+
+  { "_f0000000_1152",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "ldrbt_a2"},
+    },
+  },
+
+  { "_f0000000_1153",
+    {23, 6, 5},
+    { {"000"_b, "_f0000000_1154"},
+      {"001"_b, "_f0000000_1159"},
+      {"010"_b, "_f0000000_1162"},
+      {"011"_b, "_f0000000_1165"},
+      {"100"_b, "_f0000000_1170"},
+      {"101"_b, "_f0000000_1171"},
+      {"110"_b, "_f0000000_1175"},
+      {"111"_b, "_f0000000_1176"},
+    },
+  },
+
+  { "_f0000000_1154",
+    {20, 7},
+    { {"00"_b, "_f0000000_1155"},
+      {"01"_b, "_f0000000_1156"},
+      {"10"_b, "_f0000000_1157"},
+      {"11"_b, "_f0000000_1158"},
+    },
+  },
+
+  { "_f0000000_1155",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "uqadd16_a1"},
+    },
+  },
+
+  { "_f0000000_1156",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "uqadd8_a1"},
+    },
+  },
+
+  { "_f0000000_1157",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "uhadd16_a1"},
+    },
+  },
+
+  { "_f0000000_1158",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "uhadd8_a1"},
+    },
+  },
+
+  { "_f0000000_1159",
+    {20, 7},
+    { {"00"_b, "_f0000000_1160"},
+      {"10"_b, "_f0000000_1161"},
+      {"xx"_b, "unallocated"},
+    },
+  },
+
+  { "_f0000000_1160",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "uqasx_a1"},
+    },
+  },
+
+  { "_f0000000_1161",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "uhasx_a1"},
+    },
+  },
+
+  { "_f0000000_1162",
+    {20, 7},
+    { {"00"_b, "_f0000000_1163"},
+      {"10"_b, "_f0000000_1164"},
+      {"xx"_b, "unallocated"},
+    },
+  },
+
+  { "_f0000000_1163",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "uqsax_a1"},
+    },
+  },
+
+  { "_f0000000_1164",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "uhsax_a1"},
+    },
+  },
+
+  { "_f0000000_1165",
+    {20, 7},
+    { {"00"_b, "_f0000000_1166"},
+      {"01"_b, "_f0000000_1167"},
+      {"10"_b, "_f0000000_1168"},
+      {"11"_b, "_f0000000_1169"},
+    },
+  },
+
+  { "_f0000000_1166",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "uqsub16_a1"},
+    },
+  },
+
+  { "_f0000000_1167",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "uqsub8_a1"},
+    },
+  },
+
+  { "_f0000000_1168",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "uhsub16_a1"},
+    },
+  },
+
+  { "_f0000000_1169",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "uhsub8_a1"},
+    },
+  },
+
+  { "_f0000000_1170",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "usat_lsl_a1"},
+    },
+  },
+
+  { "_f0000000_1171",
+    {20, 7},
+    { {"00"_b, "_f0000000_1172"},
+      {"10"_b, "_f0000000_1173"},
+      {"11"_b, "_f0000000_1174"},
+      {"xx"_b, "unallocated"},
+    },
+  },
+
+  { "_f0000000_1172",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "usat16_a1"},
+    },
+  },
+
+  { "_f0000000_1173",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "rbit_a1"},
+    },
+  },
+
+  { "_f0000000_1174",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "revsh_a1"},
+    },
+  },
+
+  { "_f0000000_1175",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "usat_asr_a1"},
+    },
+  },
+
+  { "_f0000000_1176",
+    {20, 7},
+    { {"00"_b, "_f0000000_1177"},
+      {"10"_b, "_f0000000_1180"},
+      {"xx"_b, "unallocated"},
+    },
+  },
+
+  { "_f0000000_1177",
+    {19, 18, 17, 16},
+    { {"1111"_b, "_f0000000_1178"},
+      {"xxxx"_b, "_f0000000_1179"},
+    },
+  },
+
+  { "_f0000000_1178",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "uxtb_a1"},
+    },
+  },
+
+  { "_f0000000_1179",
+    {31, 30, 29, 28, 19, 18, 17, 16},
+    { {"1111xxxx"_b, "unallocated"},
+      {"xxxx1111"_b, "unallocated"},
+      {"xxxxxxxx"_b, "uxtab_a1"},
+    },
+  },
+
+  { "_f0000000_1180",
+    {19, 18, 17, 16},
+    { {"1111"_b, "_f0000000_1181"},
+      {"xxxx"_b, "_f0000000_1182"},
+    },
+  },
+
+  { "_f0000000_1181",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "uxth_a1"},
+    },
+  },
+
+  { "_f0000000_1182",
+    {31, 30, 29, 28, 19, 18, 17, 16},
+    { {"1111xxxx"_b, "unallocated"},
+      {"xxxx1111"_b, "unallocated"},
+      {"xxxxxxxx"_b, "uxtah_a1"},
+    },
+  },
+
+  { "_f0000000_1183",
+    {20},
+    { {"0"_b, "_f0000000_1184"},
+      {"1"_b, "_f0000000_1185"},
+    },
+  },
+
+  { "_f0000000_1184",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "str_reg_off_a1"},
+    },
+  },
+
+  { "_f0000000_1185",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "ldr_reg_off_a1"},
+    },
+  },
+
+  { "_f0000000_1186",
+    {23, 20, 7, 6, 5},
+    { {"00000"_b, "_f0000000_1187"},
+      {"00001"_b, "_f0000000_1190"},
+      {"00010"_b, "_f0000000_1193"},
+      {"00011"_b, "_f0000000_1196"},
+      {"01000"_b, "_f0000000_1199"},
+      {"10000"_b, "_f0000000_1200"},
+      {"xxxxx"_b, "unallocated"},
+    },
+  },
+
+  { "_f0000000_1187",
+    {15, 14, 13, 12},
+    { {"1111"_b, "_f0000000_1188"},
+      {"xxxx"_b, "_f0000000_1189"},
+    },
+  },
+
+  { "_f0000000_1188",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "smuad_a1"},
+    },
+  },
+
+  { "_f0000000_1189",
+    {31, 30, 29, 28, 15, 14, 13, 12},
+    { {"1111xxxx"_b, "unallocated"},
+      {"xxxx1111"_b, "unallocated"},
+      {"xxxxxxxx"_b, "smlad_a1"},
+    },
+  },
+
+  { "_f0000000_1190",
+    {15, 14, 13, 12},
+    { {"1111"_b, "_f0000000_1191"},
+      {"xxxx"_b, "_f0000000_1192"},
+    },
+  },
+
+  { "_f0000000_1191",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "smuadx_a1"},
+    },
+  },
+
+  { "_f0000000_1192",
+    {31, 30, 29, 28, 15, 14, 13, 12},
+    { {"1111xxxx"_b, "unallocated"},
+      {"xxxx1111"_b, "unallocated"},
+      {"xxxxxxxx"_b, "smladx_a1"},
+    },
+  },
+
+  { "_f0000000_1193",
+    {15, 14, 13, 12},
+    { {"1111"_b, "_f0000000_1194"},
+      {"xxxx"_b, "_f0000000_1195"},
+    },
+  },
+
+  { "_f0000000_1194",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "smusd_a1"},
+    },
+  },
+
+  { "_f0000000_1195",
+    {31, 30, 29, 28, 15, 14, 13, 12},
+    { {"1111xxxx"_b, "unallocated"},
+      {"xxxx1111"_b, "unallocated"},
+      {"xxxxxxxx"_b, "smlsd_a1"},
+    },
+  },
+
+  { "_f0000000_1196",
+    {15, 14, 13, 12},
+    { {"1111"_b, "_f0000000_1197"},
+      {"xxxx"_b, "_f0000000_1198"},
+    },
+  },
+
+  { "_f0000000_1197",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "smusdx_a1"},
+    },
+  },
+
+  { "_f0000000_1198",
+    {31, 30, 29, 28, 15, 14, 13, 12},
+    { {"1111xxxx"_b, "unallocated"},
+      {"xxxx1111"_b, "unallocated"},
+      {"xxxxxxxx"_b, "smlsdx_a1"},
+    },
+  },
+
+  { "_f0000000_1199",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "sdiv_a1"},
+    },
+  },
+
+  { "_f0000000_1200",
+    {15, 14, 13, 12},
+    { {"1111"_b, "_f0000000_1201"},
+      {"xxxx"_b, "_f0000000_1202"},
+    },
+  },
+
+  { "_f0000000_1201",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "usad8_a1"},
+    },
+  },
+
+  { "_f0000000_1202",
+    {31, 30, 29, 28, 15, 14, 13, 12},
+    { {"1111xxxx"_b, "unallocated"},
+      {"xxxx1111"_b, "unallocated"},
+      {"xxxxxxxx"_b, "usada8_a1"},
+    },
+  },
+
+  { "_f0000000_1203",
+    {20},
+    { {"0"_b, "_f0000000_1204"},
+      {"1"_b, "_f0000000_1205"},
+    },
+  },
+
+  { "_f0000000_1204",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "str_reg_pre_a1"},
+    },
+  },
+
+  { "_f0000000_1205",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "ldr_reg_pre_a1"},
+    },
+  },
+
+  { "_f0000000_1206",
+    {23, 6, 5},
+    { {"000"_b, "_f0000000_1207"},
+      {"110"_b, "_f0000000_1209"},
+      {"xxx"_b, "unallocated"},
+    },
+  },
+
+  { "_f0000000_1207",
+    {20, 7},
+    { {"10"_b, "_f0000000_1208"},
+      {"xx"_b, "unallocated"},
+    },
+  },
+
+  { "_f0000000_1208",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "udiv_a1"},
+    },
+  },
+
+  { "_f0000000_1209",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "sbfx_a1"},
+    },
+  },
+
+  { "_f0000000_1210",
+    {20},
+    { {"0"_b, "_f0000000_1211"},
+      {"1"_b, "_f0000000_1212"},
+    },
+  },
+
+  { "_f0000000_1211",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "strb_reg_off_a1"},
+    },
+  },
+
+  { "_f0000000_1212",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "ldrb_reg_off_a1"},
+    },
+  },
+
+  { "_f0000000_1213",
+    {23, 6, 5},
+    { {"000"_b, "_f0000000_1214"},
+      {"001"_b, "_f0000000_1219"},
+      {"010"_b, "_f0000000_1224"},
+      {"011"_b, "_f0000000_1227"},
+      {"100"_b, "_f0000000_1230"},
+      {"xxx"_b, "unallocated"},
+    },
+  },
+
+  { "_f0000000_1214",
+    {20, 7},
+    { {"00"_b, "_f0000000_1215"},
+      {"10"_b, "_f0000000_1216"},
+      {"xx"_b, "unallocated"},
+    },
+  },
+
+  { "_f0000000_1215",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "smlald_a1"},
+    },
+  },
+
+  { "_f0000000_1216",
+    {15, 14, 13, 12},
+    { {"1111"_b, "_f0000000_1217"},
+      {"xxxx"_b, "_f0000000_1218"},
+    },
+  },
+
+  { "_f0000000_1217",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "smmul_a1"},
+    },
+  },
+
+  { "_f0000000_1218",
+    {31, 30, 29, 28, 15, 14, 13, 12},
+    { {"1111xxxx"_b, "unallocated"},
+      {"xxxx1111"_b, "unallocated"},
+      {"xxxxxxxx"_b, "smmla_a1"},
+    },
+  },
+
+  { "_f0000000_1219",
+    {20, 7},
+    { {"00"_b, "_f0000000_1220"},
+      {"10"_b, "_f0000000_1221"},
+      {"xx"_b, "unallocated"},
+    },
+  },
+
+  { "_f0000000_1220",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "smlaldx_a1"},
+    },
+  },
+
+  { "_f0000000_1221",
+    {15, 14, 13, 12},
+    { {"1111"_b, "_f0000000_1222"},
+      {"xxxx"_b, "_f0000000_1223"},
+    },
+  },
+
+  { "_f0000000_1222",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "smmulr_a1"},
+    },
+  },
+
+  { "_f0000000_1223",
+    {31, 30, 29, 28, 15, 14, 13, 12},
+    { {"1111xxxx"_b, "unallocated"},
+      {"xxxx1111"_b, "unallocated"},
+      {"xxxxxxxx"_b, "smmlar_a1"},
+    },
+  },
+
+  { "_f0000000_1224",
+    {20, 7},
+    { {"00"_b, "_f0000000_1225"},
+      {"11"_b, "_f0000000_1226"},
+      {"xx"_b, "unallocated"},
+    },
+  },
+
+  { "_f0000000_1225",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "smlsld_a1"},
+    },
+  },
+
+  { "_f0000000_1226",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "smmls_a1"},
+    },
+  },
+
+  { "_f0000000_1227",
+    {20, 7},
+    { {"00"_b, "_f0000000_1228"},
+      {"11"_b, "_f0000000_1229"},
+      {"xx"_b, "unallocated"},
+    },
+  },
+
+  { "_f0000000_1228",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "smlsldx_a1"},
+    },
+  },
+
+  { "_f0000000_1229",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "smmlsr_a1"},
+    },
+  },
+
+  { "_f0000000_1230",
+    {3, 2, 1, 0},
+    { {"1111"_b, "_f0000000_1231"},
+      {"xxxx"_b, "_f0000000_1232"},
+    },
+  },
+
+  { "_f0000000_1231",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "bfc_a1"},
+    },
+  },
+
+  { "_f0000000_1232",
+    {31, 30, 29, 28, 3, 2, 1, 0},
+    { {"1111xxxx"_b, "unallocated"},
+      {"xxxx1111"_b, "unallocated"},
+      {"xxxxxxxx"_b, "bfi_a1"},
+    },
+  },
+
+  { "_f0000000_1233",
+    {20},
+    { {"0"_b, "_f0000000_1234"},
+      {"1"_b, "_f0000000_1235"},
+    },
+  },
+
+  { "_f0000000_1234",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "strb_reg_pre_a1"},
+    },
+  },
+
+  { "_f0000000_1235",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "ldrb_reg_pre_a1"},
+    },
+  },
+
+  { "_f0000000_1236",
+    {23, 6, 5},
+    { {"110"_b, "_f0000000_1237"},
+      {"111"_b, "_f0000000_1238"},
+      {"xxx"_b, "unallocated"},
+    },
+  },
+
+  { "_f0000000_1237",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "ubfx_a1"},
+    },
+  },
+
+  { "_f0000000_1238",
+    {31, 30, 29, 28, 20, 7},
+    { {"111011"_b, "udf_a1"},
+      {"xxxxxx"_b, "unallocated"},
+    },
+  },
+
+  { "_f0000000_1239",
+    {22, 20},
+    { {"00"_b, "_f0000000_1240"},
+      {"01"_b, "_f0000000_1245"},
+      {"10"_b, "_f0000000_1250"},
+      {"11"_b, "_f0000000_1251"},
+    },
+  },
+
+  { "_f0000000_1240",
+    {24, 23},
+    { {"00"_b, "_f0000000_1241"},
+      {"01"_b, "_f0000000_1242"},
+      {"10"_b, "_f0000000_1243"},
+      {"11"_b, "_f0000000_1244"},
+    },
+  },
+
+  { "_f0000000_1241",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "stmda_a1"},
+    },
+  },
+
+  { "_f0000000_1242",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "stm_a1"},
+    },
+  },
+
+  { "_f0000000_1243",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "push_list_a1"},
+    },
+  },
+
+  { "_f0000000_1244",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "stmib_a1"},
+    },
+  },
+
+  { "_f0000000_1245",
+    {24, 23},
+    { {"00"_b, "_f0000000_1246"},
+      {"01"_b, "_f0000000_1247"},
+      {"10"_b, "_f0000000_1248"},
+      {"11"_b, "_f0000000_1249"},
+    },
+  },
+
+  { "_f0000000_1246",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "ldmda_a1"},
+    },
+  },
+
+  { "_f0000000_1247",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "pop_list_a1"},
+    },
+  },
+
+  { "_f0000000_1248",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "ldmdb_a1"},
+    },
+  },
+
+  { "_f0000000_1249",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "ldmib_a1"},
+    },
+  },
+
+  { "_f0000000_1250",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "stm_usr_a1"},
+    },
+  },
+
+  { "_f0000000_1251",
+    {15},
+    { {"0"_b, "_f0000000_1252"},
+      {"1"_b, "_f0000000_1253"},
+    },
+  },
+
+  { "_f0000000_1252",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "ldm_usr_a1"},
+    },
+  },
+
+  { "_f0000000_1253",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "ldm_eret_a1"},
+    },
+  },
+
+  { "_f0000000_1254",
+    {24},
+    { {"0"_b, "_f0000000_1255"},
+      {"1"_b, "_f0000000_1256"},
+    },
+  },
+
+  { "_f0000000_1255",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "b_a1"},
+    },
+  },
+
+  { "_f0000000_1256",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "bl_a1"},
+    },
+  },
+
+  { "_f0000000_1257",
+    {24, 20, 11, 10, 9},
+    { {"00101"_b, "_f0000000_1258"},
+      {"00111"_b, "_f0000000_1267"},
+      {"01101"_b, "_f0000000_1274"},
+      {"01111"_b, "_f0000000_1289"},
+      {"10101"_b, "_f0000000_1298"},
+      {"10111"_b, "_f0000000_1310"},
+      {"11101"_b, "_f0000000_1313"},
+      {"11111"_b, "_f0000000_1325"},
+      {"xxxxx"_b, "unallocated"},
+    },
+  },
+
+  { "_f0000000_1258",
+    {23, 8},
+    { {"00"_b, "_f0000000_1259"},
+      {"01"_b, "_f0000000_1261"},
+      {"10"_b, "_f0000000_1263"},
+      {"11"_b, "_f0000000_1264"},
+    },
+  },
+
+  { "_f0000000_1259",
+    {22, 21, 7, 6, 4},
+    { {"10001"_b, "_f0000000_1260"},
+      {"xxxxx"_b, "unallocated"},
+    },
+  },
+
+  { "_f0000000_1260",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "vmov_ss_rr_a1"},
+    },
+  },
+
+  { "_f0000000_1261",
+    {22, 21, 7, 6, 4},
+    { {"10001"_b, "_f0000000_1262"},
+      {"xxxxx"_b, "unallocated"},
+    },
+  },
+
+  { "_f0000000_1262",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "vmov_d_rr_a1"},
+    },
+  },
+
+  { "_f0000000_1263",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "vstm_a2"},
+    },
+  },
+
+  { "_f0000000_1264",
+    {0},
+    { {"0"_b, "_f0000000_1265"},
+      {"1"_b, "_f0000000_1266"},
+    },
+  },
+
+  { "_f0000000_1265",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "vstm_a1"},
+    },
+  },
+
+  { "_f0000000_1266",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "fstmiax_a1"},
+    },
+  },
+
+  { "_f0000000_1267",
+    {22, 21},
+    { {"00"_b, "_f0000000_1268"},
+      {"01"_b, "_f0000000_1270"},
+      {"10"_b, "_f0000000_1272"},
+      {"xx"_b, "unallocated"},
+    },
+  },
+
+  { "_f0000000_1268",
+    {23, 15, 14, 13, 12, 8},
+    { {"101010"_b, "_f0000000_1269"},
+      {"xxxxxx"_b, "unallocated"},
+    },
+  },
+
+  { "_f0000000_1269",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "stc_a1"},
+    },
+  },
+
+  { "_f0000000_1270",
+    {15, 14, 13, 12, 8},
+    { {"01010"_b, "_f0000000_1271"},
+      {"xxxxx"_b, "unallocated"},
+    },
+  },
+
+  { "_f0000000_1271",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "stc_a1"},
+    },
+  },
+
+  { "_f0000000_1272",
+    {23},
+    { {"0"_b, "_f0000000_1273"},
+      {"x"_b, "unallocated"},
+    },
+  },
+
+  { "_f0000000_1273",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "mcrr_a1"},
+    },
+  },
+
+  { "_f0000000_1274",
+    {23, 8},
+    { {"00"_b, "_f0000000_1275"},
+      {"01"_b, "_f0000000_1277"},
+      {"10"_b, "_f0000000_1279"},
+      {"11"_b, "_f0000000_1283"},
+    },
+  },
+
+  { "_f0000000_1275",
+    {22, 21, 7, 6, 4},
+    { {"10001"_b, "_f0000000_1276"},
+      {"xxxxx"_b, "unallocated"},
+    },
+  },
+
+  { "_f0000000_1276",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "vmov_rr_ss_a1"},
+    },
+  },
+
+  { "_f0000000_1277",
+    {22, 21, 7, 6, 4},
+    { {"10001"_b, "_f0000000_1278"},
+      {"xxxxx"_b, "unallocated"},
+    },
+  },
+
+  { "_f0000000_1278",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "vmov_rr_d_a1"},
+    },
+  },
+
+  { "_f0000000_1279",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "_f0000000_1280"},
+    },
+  },
+
+  { "_f0000000_1280",
+    {21},
+    { {"1"_b, "_f0000000_1281"},
+      {"x"_b, "vldm_a2"},
+    },
+  },
+
+  { "_f0000000_1281",
+    {19, 18, 17, 16},
+    { {"1101"_b, "_f0000000_1282"},
+      {"xxxx"_b, "vldm_a2"},
+    },
+  },
+
+  { "_f0000000_1282",
+    {31, 30, 29, 28},
+    { {"1111"_b, "vldm_a2"},
+      {"xxxx"_b, "vpop_a2"},
+    },
+  },
+
+  { "_f0000000_1283",
+    {0},
+    { {"0"_b, "_f0000000_1284"},
+      {"1"_b, "_f0000000_1288"},
+    },
+  },
+
+  { "_f0000000_1284",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "_f0000000_1285"},
+    },
+  },
+
+  { "_f0000000_1285",
+    {21},
+    { {"1"_b, "_f0000000_1286"},
+      {"x"_b, "vldm_a1"},
+    },
+  },
+
+  { "_f0000000_1286",
+    {19, 18, 17, 16},
+    { {"1101"_b, "_f0000000_1287"},
+      {"xxxx"_b, "vldm_a1"},
+    },
+  },
+
+  { "_f0000000_1287",
+    {31, 30, 29, 28},
+    { {"1111"_b, "vldm_a1"},
+      {"xxxx"_b, "vpop_a1"},
+    },
+  },
+
+  { "_f0000000_1288",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "fldmiax_a1"},
+    },
+  },
+
+  { "_f0000000_1289",
+    {22, 21},
+    { {"00"_b, "_f0000000_1290"},
+      {"01"_b, "_f0000000_1294"},
+      {"10"_b, "_f0000000_1296"},
+      {"xx"_b, "unallocated"},
+    },
+  },
+
+  { "_f0000000_1290",
+    {23, 15, 14, 13, 12, 8},
+    { {"101010"_b, "_f0000000_1291"},
+      {"xxxxxx"_b, "unallocated"},
+    },
+  },
+
+  { "_f0000000_1291",
+    {19, 18, 17, 16},
+    { {"1111"_b, "_f0000000_1292"},
+      {"xxxx"_b, "_f0000000_1293"},
+    },
+  },
+
+  { "_f0000000_1292",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "ldc_lit_a1"},
+    },
+  },
+
+  { "_f0000000_1293",
+    {31, 30, 29, 28, 19, 18, 17, 16},
+    { {"1111xxxx"_b, "unallocated"},
+      {"xxxx1111"_b, "unallocated"},
+      {"xxxxxxxx"_b, "ldc_imm_a1"},
+    },
+  },
+
+  { "_f0000000_1294",
+    {15, 14, 13, 12, 8},
+    { {"01010"_b, "_f0000000_1295"},
+      {"xxxxx"_b, "unallocated"},
+    },
+  },
+
+  { "_f0000000_1295",
+    {31, 30, 29, 28, 19, 18, 17, 16},
+    { {"1111xxxx"_b, "unallocated"},
+      {"xxxx1111"_b, "unallocated"},
+      {"xxxxxxxx"_b, "ldc_imm_a1"},
+    },
+  },
+
+  { "_f0000000_1296",
+    {23},
+    { {"0"_b, "_f0000000_1297"},
+      {"x"_b, "unallocated"},
+    },
+  },
+
+  { "_f0000000_1297",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "mrrc_a1"},
+    },
+  },
+
+  { "_f0000000_1298",
+    {21, 8},
+    { {"00"_b, "_f0000000_1299"},
+      {"01"_b, "_f0000000_1300"},
+      {"10"_b, "_f0000000_1301"},
+      {"11"_b, "_f0000000_1305"},
+    },
+  },
+
+  { "_f0000000_1299",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "vstr_a2"},
+    },
+  },
+
+  { "_f0000000_1300",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "vstr_a1"},
+    },
+  },
+
+  { "_f0000000_1301",
+    {23},
+    { {"0"_b, "_f0000000_1302"},
+      {"x"_b, "unallocated"},
+    },
+  },
+
+  { "_f0000000_1302",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "_f0000000_1303"},
+    },
+  },
+
+  { "_f0000000_1303",
+    {19, 18, 17, 16},
+    { {"1101"_b, "_f0000000_1304"},
+      {"xxxx"_b, "vstmdb_a2"},
+    },
+  },
+
+  { "_f0000000_1304",
+    {31, 30, 29, 28},
+    { {"1111"_b, "vstmdb_a2"},
+      {"xxxx"_b, "vpush_a2"},
+    },
+  },
+
+  { "_f0000000_1305",
+    {23, 0},
+    { {"00"_b, "_f0000000_1306"},
+      {"01"_b, "_f0000000_1309"},
+      {"xx"_b, "unallocated"},
+    },
+  },
+
+  { "_f0000000_1306",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "_f0000000_1307"},
+    },
+  },
+
+  { "_f0000000_1307",
+    {19, 18, 17, 16},
+    { {"1101"_b, "_f0000000_1308"},
+      {"xxxx"_b, "vstmdb_a1"},
+    },
+  },
+
+  { "_f0000000_1308",
+    {31, 30, 29, 28},
+    { {"1111"_b, "vstmdb_a1"},
+      {"xxxx"_b, "vpush_a1"},
+    },
+  },
+
+  { "_f0000000_1309",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "fstmdbx_a1"},
+    },
+  },
+
+  { "_f0000000_1310",
+    {22, 21, 15, 14, 13, 12, 8},
+    { {"0001010"_b, "_f0000000_1311"},
+      {"0101010"_b, "_f0000000_1312"},
+      {"xxxxxxx"_b, "unallocated"},
+    },
+  },
+
+  { "_f0000000_1311",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "stc_a1"},
+    },
+  },
+
+  { "_f0000000_1312",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "stc_a1"},
+    },
+  },
+
+  { "_f0000000_1313",
+    {21, 8},
+    { {"00"_b, "_f0000000_1314"},
+      {"01"_b, "_f0000000_1317"},
+      {"10"_b, "_f0000000_1320"},
+      {"11"_b, "_f0000000_1322"},
+    },
+  },
+
+  { "_f0000000_1314",
+    {19, 18, 17, 16},
+    { {"1111"_b, "_f0000000_1315"},
+      {"xxxx"_b, "_f0000000_1316"},
+    },
+  },
+
+  { "_f0000000_1315",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "vldr_lit_a2"},
+    },
+  },
+
+  { "_f0000000_1316",
+    {31, 30, 29, 28, 19, 18, 17, 16},
+    { {"1111xxxx"_b, "unallocated"},
+      {"xxxx1111"_b, "unallocated"},
+      {"xxxxxxxx"_b, "vldr_imm_a2"},
+    },
+  },
+
+  { "_f0000000_1317",
+    {19, 18, 17, 16},
+    { {"1111"_b, "_f0000000_1318"},
+      {"xxxx"_b, "_f0000000_1319"},
+    },
+  },
+
+  { "_f0000000_1318",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "vldr_lit_a1"},
+    },
+  },
+
+  { "_f0000000_1319",
+    {31, 30, 29, 28, 19, 18, 17, 16},
+    { {"1111xxxx"_b, "unallocated"},
+      {"xxxx1111"_b, "unallocated"},
+      {"xxxxxxxx"_b, "vldr_imm_a1"},
+    },
+  },
+
+  { "_f0000000_1320",
+    {23},
+    { {"0"_b, "_f0000000_1321"},
+      {"x"_b, "unallocated"},
+    },
+  },
+
+  { "_f0000000_1321",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "vldmdb_a2"},
+    },
+  },
+
+  { "_f0000000_1322",
+    {23, 0},
+    { {"00"_b, "_f0000000_1323"},
+      {"01"_b, "_f0000000_1324"},
+      {"xx"_b, "unallocated"},
+    },
+  },
+
+  { "_f0000000_1323",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "vldmdb_a1"},
+    },
+  },
+
+  { "_f0000000_1324",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "fldmdbx_a1"},
+    },
+  },
+
+  { "_f0000000_1325",
+    {22, 21, 15, 14, 13, 12, 8},
+    { {"0001010"_b, "_f0000000_1326"},
+      {"0101010"_b, "_f0000000_1329"},
+      {"xxxxxxx"_b, "unallocated"},
+    },
+  },
+
+  { "_f0000000_1326",
+    {19, 18, 17, 16},
+    { {"1111"_b, "_f0000000_1327"},
+      {"xxxx"_b, "_f0000000_1328"},
+    },
+  },
+
+  { "_f0000000_1327",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "ldc_lit_a1"},
+    },
+  },
+
+  { "_f0000000_1328",
+    {31, 30, 29, 28, 19, 18, 17, 16},
+    { {"1111xxxx"_b, "unallocated"},
+      {"xxxx1111"_b, "unallocated"},
+      {"xxxxxxxx"_b, "ldc_imm_a1"},
+    },
+  },
+
+  { "_f0000000_1329",
+    {31, 30, 29, 28, 19, 18, 17, 16},
+    { {"1111xxxx"_b, "unallocated"},
+      {"xxxx1111"_b, "unallocated"},
+      {"xxxxxxxx"_b, "ldc_imm_a1"},
+    },
+  },
+
+  { "_f0000000_1330",
+    {24},
+    { {"0"_b, "_f0000000_1331"},
+      {"1"_b, "_f0000000_1438"},
+    },
+  },
+
+  { "_f0000000_1331",
+    {20, 11, 10, 9, 4},
+    { {"01010"_b, "_f0000000_1332"},
+      {"01011"_b, "_f0000000_1347"},
+      {"01111"_b, "_f0000000_1356"},
+      {"11010"_b, "_f0000000_1357"},
+      {"11011"_b, "_f0000000_1432"},
+      {"11111"_b, "_f0000000_1437"},
+      {"xxxxx"_b, "unallocated"},
+    },
+  },
+
+  { "_f0000000_1332",
+    {23, 21, 8, 6},
+    { {"0000"_b, "_f0000000_1333"},
+      {"0001"_b, "_f0000000_1334"},
+      {"0010"_b, "_f0000000_1335"},
+      {"0011"_b, "_f0000000_1336"},
+      {"0100"_b, "_f0000000_1337"},
+      {"0101"_b, "_f0000000_1338"},
+      {"0110"_b, "_f0000000_1339"},
+      {"0111"_b, "_f0000000_1340"},
+      {"1000"_b, "_f0000000_1341"},
+      {"1010"_b, "_f0000000_1342"},
+      {"1100"_b, "_f0000000_1343"},
+      {"1101"_b, "_f0000000_1344"},
+      {"1110"_b, "_f0000000_1345"},
+      {"1111"_b, "_f0000000_1346"},
+      {"xxxx"_b, "unallocated"},
+    },
+  },
+
+  { "_f0000000_1333",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "vmla_f32_a2"},
+    },
+  },
+
+  { "_f0000000_1334",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "vmls_f32_a2"},
+    },
+  },
+
+  { "_f0000000_1335",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "vmla_f64_a2"},
+    },
+  },
+
+  { "_f0000000_1336",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "vmls_f64_a2"},
+    },
+  },
+
+  { "_f0000000_1337",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "vmul_f32_a2"},
+    },
+  },
+
+  { "_f0000000_1338",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "vnmul_f32_a1"},
+    },
+  },
+
+  { "_f0000000_1339",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "vmul_f64_a2"},
+    },
+  },
+
+  { "_f0000000_1340",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "vnmul_f64_a1"},
+    },
+  },
+
+  { "_f0000000_1341",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "vdiv_f32_a1"},
+    },
+  },
+
+  { "_f0000000_1342",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "vdiv_f64_a1"},
+    },
+  },
+
+  { "_f0000000_1343",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "vfma_f32_a2"},
+    },
+  },
+
+  { "_f0000000_1344",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "vfms_f32_a2"},
+    },
+  },
+
+  { "_f0000000_1345",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "vfma_f64_a2"},
+    },
+  },
+
+  { "_f0000000_1346",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "vfms_f64_a2"},
+    },
+  },
+
+  { "_f0000000_1347",
+    {23, 8},
+    { {"00"_b, "_f0000000_1348"},
+      {"01"_b, "_f0000000_1350"},
+      {"10"_b, "_f0000000_1351"},
+      {"11"_b, "_f0000000_1353"},
+    },
+  },
+
+  { "_f0000000_1348",
+    {22, 21},
+    { {"00"_b, "_f0000000_1349"},
+      {"xx"_b, "unallocated"},
+    },
+  },
+
+  { "_f0000000_1349",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "vmov_s_r_a1"},
+    },
+  },
+
+  { "_f0000000_1350",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "vmov_scalar_r_a1"},
+    },
+  },
+
+  { "_f0000000_1351",
+    {22, 21},
+    { {"11"_b, "_f0000000_1352"},
+      {"xx"_b, "unallocated"},
+    },
+  },
+
+  { "_f0000000_1352",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "vmsr_a1"},
+    },
+  },
+
+  { "_f0000000_1353",
+    {21, 6},
+    { {"00"_b, "_f0000000_1354"},
+      {"10"_b, "_f0000000_1355"},
+      {"xx"_b, "unallocated"},
+    },
+  },
+
+  { "_f0000000_1354",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "vdup_d_a1"},
+    },
+  },
+
+  { "_f0000000_1355",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "_f0000000_1584"},
+    },
+  },
+
+  { "_f0000000_1584",
+    {16},
+    { {"0"_b, "vdup_q_a1"},
+    },
+  },
+
+  { "_f0000000_1356",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "mcr_a1"},
+    },
+  },
+
+  { "_f0000000_1357",
+    {23, 21, 8, 6},
+    { {"0000"_b, "_f0000000_1358"},
+      {"0001"_b, "_f0000000_1359"},
+      {"0010"_b, "_f0000000_1360"},
+      {"0011"_b, "_f0000000_1361"},
+      {"0100"_b, "_f0000000_1362"},
+      {"0101"_b, "_f0000000_1363"},
+      {"0110"_b, "_f0000000_1364"},
+      {"0111"_b, "_f0000000_1365"},
+      {"1000"_b, "_f0000000_1366"},
+      {"1001"_b, "_f0000000_1367"},
+      {"1010"_b, "_f0000000_1368"},
+      {"1011"_b, "_f0000000_1369"},
+      {"1100"_b, "_f0000000_1370"},
+      {"1101"_b, "_f0000000_1371"},
+      {"1110"_b, "_f0000000_1401"},
+      {"1111"_b, "_f0000000_1402"},
+    },
+  },
+
+  { "_f0000000_1358",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "vnmls_f32_a1"},
+    },
+  },
+
+  { "_f0000000_1359",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "vnmla_f32_a1"},
+    },
+  },
+
+  { "_f0000000_1360",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "vnmls_f64_a1"},
+    },
+  },
+
+  { "_f0000000_1361",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "vnmla_f64_a1"},
+    },
+  },
+
+  { "_f0000000_1362",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "vadd_f32_a2"},
+    },
+  },
+
+  { "_f0000000_1363",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "vsub_f32_a2"},
+    },
+  },
+
+  { "_f0000000_1364",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "vadd_f64_a2"},
+    },
+  },
+
+  { "_f0000000_1365",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "vsub_f64_a2"},
+    },
+  },
+
+  { "_f0000000_1366",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "vfnms_f32_a1"},
+    },
+  },
+
+  { "_f0000000_1367",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "vfnma_f32_a1"},
+    },
+  },
+
+  { "_f0000000_1368",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "vfnms_f64_a1"},
+    },
+  },
+
+  { "_f0000000_1369",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "vfnma_f64_a1"},
+    },
+  },
+
+  { "_f0000000_1370",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "vmov_imm_f32_a2"},
+    },
+  },
+
+  { "_f0000000_1371",
+    {19, 18, 17},
+    { {"000"_b, "_f0000000_1372"},
+      {"001"_b, "_f0000000_1377"},
+      {"010"_b, "_f0000000_1382"},
+      {"011"_b, "_f0000000_1387"},
+      {"100"_b, "_f0000000_1392"},
+      {"101"_b, "_f0000000_1394"},
+      {"110"_b, "_f0000000_1395"},
+      {"111"_b, "_f0000000_1400"},
+    },
+  },
+
+  { "_f0000000_1372",
+    {16, 7},
+    { {"00"_b, "_f0000000_1373"},
+      {"01"_b, "_f0000000_1374"},
+      {"10"_b, "_f0000000_1375"},
+      {"11"_b, "_f0000000_1376"},
+    },
+  },
+
+  { "_f0000000_1373",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "vmov_f32_a2"},
+    },
+  },
+
+  { "_f0000000_1374",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "vabs_f32_a2"},
+    },
+  },
+
+  { "_f0000000_1375",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "vneg_f32_a2"},
+    },
+  },
+
+  { "_f0000000_1376",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "vsqrt_f32_a1"},
+    },
+  },
+
+  { "_f0000000_1377",
+    {16, 7},
+    { {"00"_b, "_f0000000_1378"},
+      {"01"_b, "_f0000000_1379"},
+      {"10"_b, "_f0000000_1380"},
+      {"11"_b, "_f0000000_1381"},
+    },
+  },
+
+  { "_f0000000_1378",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "vcvtb_f32_f16_a1"},
+    },
+  },
+
+  { "_f0000000_1379",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "vcvtt_f32_f16_a1"},
+    },
+  },
+
+  { "_f0000000_1380",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "vcvtb_f16_f32_a1"},
+    },
+  },
+
+  { "_f0000000_1381",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "vcvtt_f16_f32_a1"},
+    },
+  },
+
+  { "_f0000000_1382",
+    {16, 7},
+    { {"00"_b, "_f0000000_1383"},
+      {"01"_b, "_f0000000_1384"},
+      {"10"_b, "_f0000000_1385"},
+      {"11"_b, "_f0000000_1386"},
+    },
+  },
+
+  { "_f0000000_1383",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "vcmp_f32_a1"},
+    },
+  },
+
+  { "_f0000000_1384",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "vcmpe_f32_a1"},
+    },
+  },
+
+  { "_f0000000_1385",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "vcmp_f32_a2"},
+    },
+  },
+
+  { "_f0000000_1386",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "vcmpe_f32_a2"},
+    },
+  },
+
+  { "_f0000000_1387",
+    {16, 7},
+    { {"00"_b, "_f0000000_1388"},
+      {"01"_b, "_f0000000_1389"},
+      {"10"_b, "_f0000000_1390"},
+      {"11"_b, "_f0000000_1391"},
+    },
+  },
+
+  { "_f0000000_1388",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "vrintr_f32_a1"},
+    },
+  },
+
+  { "_f0000000_1389",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "vrintz_f32_a1"},
+    },
+  },
+
+  { "_f0000000_1390",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "vrintx_f32_a1"},
+    },
+  },
+
+  { "_f0000000_1391",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "vcvt_f64_f32_a1"},
+    },
+  },
+
+  { "_f0000000_1392",
+    {16},
+    { {"0"_b, "_f0000000_1393"},
+      {"x"_b, "unallocated"},
+    },
+  },
+
+  { "_f0000000_1393",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "vcvt_f32_int_a1"},
+    },
+  },
+
+  { "_f0000000_1394",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "vcvt_f32_fx_a1"},
+    },
+  },
+
+  { "_f0000000_1395",
+    {16, 7},
+    { {"00"_b, "_f0000000_1396"},
+      {"01"_b, "_f0000000_1397"},
+      {"10"_b, "_f0000000_1398"},
+      {"11"_b, "_f0000000_1399"},
+    },
+  },
+
+  { "_f0000000_1396",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "vcvtr_u32_f32_a1"},
+    },
+  },
+
+  { "_f0000000_1397",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "vcvt_u32_f32_a1"},
+    },
+  },
+
+  { "_f0000000_1398",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "vcvtr_s32_f32_a1"},
+    },
+  },
+
+  { "_f0000000_1399",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "vcvt_s32_f32_a1"},
+    },
+  },
+
+  { "_f0000000_1400",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "vcvt_fx_f32_a1"},
+    },
+  },
+
+  { "_f0000000_1401",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "vmov_imm_f64_a2"},
+    },
+  },
+
+  { "_f0000000_1402",
+    {19, 18, 17},
+    { {"000"_b, "_f0000000_1403"},
+      {"001"_b, "_f0000000_1408"},
+      {"010"_b, "_f0000000_1413"},
+      {"011"_b, "_f0000000_1418"},
+      {"100"_b, "_f0000000_1423"},
+      {"101"_b, "_f0000000_1425"},
+      {"110"_b, "_f0000000_1426"},
+      {"111"_b, "_f0000000_1431"},
+    },
+  },
+
+  { "_f0000000_1403",
+    {16, 7},
+    { {"00"_b, "_f0000000_1404"},
+      {"01"_b, "_f0000000_1405"},
+      {"10"_b, "_f0000000_1406"},
+      {"11"_b, "_f0000000_1407"},
+    },
+  },
+
+  { "_f0000000_1404",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "vmov_f64_a2"},
+    },
+  },
+
+  { "_f0000000_1405",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "vabs_f64_a2"},
+    },
+  },
+
+  { "_f0000000_1406",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "vneg_f64_a2"},
+    },
+  },
+
+  { "_f0000000_1407",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "vsqrt_f64_a1"},
+    },
+  },
+
+  { "_f0000000_1408",
+    {16, 7},
+    { {"00"_b, "_f0000000_1409"},
+      {"01"_b, "_f0000000_1410"},
+      {"10"_b, "_f0000000_1411"},
+      {"11"_b, "_f0000000_1412"},
+    },
+  },
+
+  { "_f0000000_1409",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "vcvtb_f64_f16_a1"},
+    },
+  },
+
+  { "_f0000000_1410",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "vcvtt_f64_f16_a1"},
+    },
+  },
+
+  { "_f0000000_1411",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "vcvtb_f16_f64_a1"},
+    },
+  },
+
+  { "_f0000000_1412",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "vcvtt_f16_f64_a1"},
+    },
+  },
+
+  { "_f0000000_1413",
+    {16, 7},
+    { {"00"_b, "_f0000000_1414"},
+      {"01"_b, "_f0000000_1415"},
+      {"10"_b, "_f0000000_1416"},
+      {"11"_b, "_f0000000_1417"},
+    },
+  },
+
+  { "_f0000000_1414",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "vcmp_f64_a1"},
+    },
+  },
+
+  { "_f0000000_1415",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "vcmpe_f64_a1"},
+    },
+  },
+
+  { "_f0000000_1416",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "vcmp_f64_a2"},
+    },
+  },
+
+  { "_f0000000_1417",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "vcmpe_f64_a2"},
+    },
+  },
+
+  { "_f0000000_1418",
+    {16, 7},
+    { {"00"_b, "_f0000000_1419"},
+      {"01"_b, "_f0000000_1420"},
+      {"10"_b, "_f0000000_1421"},
+      {"11"_b, "_f0000000_1422"},
+    },
+  },
+
+  { "_f0000000_1419",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "vrintr_f64_a1"},
+    },
+  },
+
+  { "_f0000000_1420",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "vrintz_f64_a1"},
+    },
+  },
+
+  { "_f0000000_1421",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "vrintx_f64_a1"},
+    },
+  },
+
+  { "_f0000000_1422",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "vcvt_f32_f64_a1"},
+    },
+  },
+
+  { "_f0000000_1423",
+    {16},
+    { {"0"_b, "_f0000000_1424"},
+      {"x"_b, "unallocated"},
+    },
+  },
+
+  { "_f0000000_1424",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "vcvt_f64_int_a1"},
+    },
+  },
+
+  { "_f0000000_1425",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "vcvt_f64_fx_a1"},
+    },
+  },
+
+  { "_f0000000_1426",
+    {16, 7},
+    { {"00"_b, "_f0000000_1427"},
+      {"01"_b, "_f0000000_1428"},
+      {"10"_b, "_f0000000_1429"},
+      {"11"_b, "_f0000000_1430"},
+    },
+  },
+
+  { "_f0000000_1427",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "vcvtr_u32_f64_a1"},
+    },
+  },
+
+  { "_f0000000_1428",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "vcvt_u32_f64_a1"},
+    },
+  },
+
+  { "_f0000000_1429",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "vcvtr_s32_f64_a1"},
+    },
+  },
+
+  { "_f0000000_1430",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "vcvt_s32_f64_a1"},
+    },
+  },
+
+  { "_f0000000_1431",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "vcvt_fx_f64_a1"},
+    },
+  },
+
+  { "_f0000000_1432",
+    {8},
+    { {"0"_b, "_f0000000_1433"},
+      {"1"_b, "_f0000000_1436"},
+    },
+  },
+
+  { "_f0000000_1433",
+    {23, 22, 21},
+    { {"000"_b, "_f0000000_1434"},
+      {"111"_b, "_f0000000_1435"},
+      {"xxx"_b, "unallocated"},
+    },
+  },
+
+  { "_f0000000_1434",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "vmov_r_s_a1"},
+    },
+  },
+
+  { "_f0000000_1435",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "vmrs_a1"},
+    },
+  },
+
+  { "_f0000000_1436",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "vmov_r_scalar_a1"},
+    },
+  },
+
+  { "_f0000000_1437",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "mrc_a1"},
+    },
+  },
+
+  { "_f0000000_1438",
+    {31, 30, 29, 28},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "svc_a1"},
+    },
+  },
+};
+
+static const DecodeMapping kT32DecodeMapping[] = {
+  { "Root",
+    {31, 30, 29},
+    { {"000"_b, "_00000000"},
+      {"001"_b, "_00000000_3"},
+      {"010"_b, "_00000000_4"},
+      {"011"_b, "_00000000_17"},
+      {"100"_b, "_00000000_18"},
+      {"101"_b, "_00000000_19"},
+      {"110"_b, "_00000000_36"},
+      {"111"_b, "_00000000_41"},
+    },
+  },
+
+  { "_00000000",
+    {28, 27},
+    { {"11"_b, "_00000000_1"},
+      {"xx"_b, "_00000000_2"},
+    },
+  },
+
+  { "_00000000_1",
+    {26, 25},
+    { {"00"_b, "add_reg_t1"},
+      {"01"_b, "sub_reg_t1"},
+      {"10"_b, "add_imm_t1"},
+      {"11"_b, "sub_imm_t1"},
+    },
+  },
+
+  { "_00000000_2",
+    {28, 27},
+    { {"11"_b, "unallocated"},
+      {"xx"_b, "_00000000_1035"},
+    },
+  },
+
+  { "_00000000_1035",
+    {28, 27, 26, 25, 24, 23, 22},
+    { {"10xxxxx"_b, "asr_imm_t2"},
+      {"01xxxxx"_b, "lsr_imm_t2"},
+      {"0000000"_b, "mov_reg_t2"},
+      {"00xxxxx"_b, "lsl_imm_t2"},
+    },
+  },
+
+  { "_00000000_3",
+    {28, 27},
+    { {"00"_b, "mov_imm_t1"},
+      {"01"_b, "cmp_imm_t1"},
+      {"10"_b, "add_imm_t2"},
+      {"11"_b, "sub_imm_t2"},
+    },
+  },
+
+  { "_00000000_4",
+    {28, 27},
+    { {"00"_b, "_00000000_5"},
+      {"01"_b, "ldr_lit_t1"},
+      {"10"_b, "_00000000_15"},
+      {"11"_b, "_00000000_16"},
+    },
+  },
+
+  { "_00000000_5",
+    {26, 25, 24},
+    { {"000"_b, "_00000000_6"},
+      {"001"_b, "_00000000_7"},
+      {"010"_b, "_00000000_8"},
+      {"011"_b, "_00000000_9"},
+      {"100"_b, "_00000000_10"},
+      {"101"_b, "cmp_reg_t2"},
+      {"110"_b, "mov_reg_t1"},
+      {"111"_b, "_00000000_14"},
+    },
+  },
+
+  { "_00000000_6",
+    {23, 22},
+    { {"00"_b, "and_reg_t1"},
+      {"01"_b, "eor_reg_t1"},
+      {"10"_b, "lsl_t1"},
+      {"11"_b, "lsr_t1"},
+    },
+  },
+
+  { "_00000000_7",
+    {23, 22},
+    { {"00"_b, "asr_t1"},
+      {"01"_b, "adc_reg_t1"},
+      {"10"_b, "sbc_reg_t1"},
+      {"11"_b, "ror_t1"},
+    },
+  },
+
+  { "_00000000_8",
+    {23, 22},
+    { {"00"_b, "tst_reg_t1"},
+      {"01"_b, "rsb_imm_t1"},
+      {"10"_b, "cmp_reg_t1"},
+      {"11"_b, "cmn_reg_t1"},
+    },
+  },
+
+  { "_00000000_9",
+    {23, 22},
+    { {"00"_b, "orr_reg_t1"},
+      {"01"_b, "mul_t1"},
+      {"10"_b, "bic_reg_t1"},
+      {"11"_b, "mvn_reg_t1"},
+    },
+  },
+
+  { "_00000000_10",
+    {22, 21, 20, 19},
+    { {"1101"_b, "add_sp_t1"},
+      {"xxxx"_b, "_00000000_11"},
+    },
+  },
+
+  { "_00000000_11",
+    {23, 18, 17, 16},
+    { {"1101"_b, "_00000000_12"},
+      {"xxxx"_b, "_00000000_13"},
+    },
+  },
+
+  { "_00000000_12",
+    {22, 21, 20, 19},
+    { {"1101"_b, "unallocated"},
+      {"xxxx"_b, "add_sp_reg_t2"},
+    },
+  },
+
+  { "_00000000_13",
+    {23, 22, 21, 20, 19, 18, 17, 16},
+    { {"x1101xxx"_b, "unallocated"},
+      {"1xxxx101"_b, "unallocated"},
+      {"xxxxxxxx"_b, "add_reg_t2"},
+    },
+  },
+
+  { "_00000000_14",
+    {23},
+    { {"0"_b, "bx_t1"},
+      {"1"_b, "blx_t1"},
+    },
+  },
+
+  { "_00000000_15",
+    {26, 25},
+    { {"00"_b, "str_reg_t1"},
+      {"01"_b, "strh_reg_t1"},
+      {"10"_b, "strb_reg_t1"},
+      {"11"_b, "ldrsb_reg_t1"},
+    },
+  },
+
+  { "_00000000_16",
+    {26, 25},
+    { {"00"_b, "ldr_reg_t1"},
+      {"01"_b, "ldrh_reg_t1"},
+      {"10"_b, "ldrb_reg_t1"},
+      {"11"_b, "ldrsh_reg_t1"},
+    },
+  },
+
+  { "_00000000_17",
+    {28, 27},
+    { {"00"_b, "str_imm_t1"},
+      {"01"_b, "ldr_imm_t1"},
+      {"10"_b, "strb_imm_t1"},
+      {"11"_b, "ldrb_imm_t1"},
+    },
+  },
+
+  { "_00000000_18",
+    {28, 27},
+    { {"00"_b, "strh_imm_t1"},
+      {"01"_b, "ldrh_imm_t1"},
+      {"10"_b, "str_sp_t2"},
+      {"11"_b, "ldr_sp_t2"},
+    },
+  },
+
+  { "_00000000_19",
+    {28, 27},
+    { {"00"_b, "adr_t1"},
+      {"01"_b, "add_sp_imm_t1"},
+      {"10"_b, "_00000000_20"},
+      {"11"_b, "_00000000_28"},
+    },
+  },
+
+  { "_00000000_20",
+    {26},
+    { {"0"_b, "_00000000_21"},
+      {"1"_b, "_00000000_25"},
+    },
+  },
+
+  { "_00000000_21",
+    {24},
+    { {"0"_b, "_00000000_22"},
+      {"1"_b, "cbz_t1"},
+    },
+  },
+
+  { "_00000000_22",
+    {25, 23},
+    { {"00"_b, "add_sp_imm_t2"},
+      {"01"_b, "sub_sp_imm_t1"},
+      {"10"_b, "_00000000_23"},
+      {"11"_b, "_00000000_24"},
+    },
+  },
+
+  { "_00000000_23",
+    {22},
+    { {"0"_b, "sxth_t1"},
+      {"1"_b, "sxtb_t1"},
+    },
+  },
+
+  { "_00000000_24",
+    {22},
+    { {"0"_b, "uxth_t1"},
+      {"1"_b, "uxtb_t1"},
+    },
+  },
+
+  { "_00000000_25",
+    {25},
+    { {"0"_b, "push_t1"},
+      {"1"_b, "_00000000_26"},
+    },
+  },
+
+  { "_00000000_26",
+    {24, 23, 22, 21},
+    { {"0010"_b, "setend_t1"},
+      {"0011"_b, "_00000000_27"},
+      {"xxxx"_b, "unallocated"},
+    },
+  },
+
+  { "_00000000_27",
+    {20},
+    { {"0"_b, "cpsie_t1"},
+      {"1"_b, "cpsid_t1"},
+    },
+  },
+
+  { "_00000000_28",
+    {26},
+    { {"0"_b, "_00000000_29"},
+      {"1"_b, "_00000000_31"},
+    },
+  },
+
+  { "_00000000_29",
+    {24},
+    { {"0"_b, "_00000000_30"},
+      {"1"_b, "cbnz_t1"},
+    },
+  },
+
+  { "_00000000_30",
+    {25, 23, 22},
+    { {"100"_b, "rev_t1"},
+      {"101"_b, "rev16_t1"},
+      {"110"_b, "hlt_t1"},
+      {"111"_b, "revsh_t1"},
+      {"xxx"_b, "unallocated"},
+    },
+  },
+
+  { "_00000000_31",
+    {25},
+    { {"0"_b, "pop_t1"},
+      {"1"_b, "_00000000_32"},
+    },
+  },
+
+  { "_00000000_32",
+    {24},
+    { {"0"_b, "bkpt_t1"},
+      {"1"_b, "_00000000_33"},
+    },
+  },
+
+  { "_00000000_33",
+    {19, 18, 17, 16},
+    { {"0000"_b, "_00000000_34"},
+      {"xxxx"_b, "_00000000_35"},
+    },
+  },
+
+  { "_00000000_34",
+    {23, 22, 21, 20},
+    { {"0000"_b, "nop_t1"},
+      {"0001"_b, "yield_t1"},
+      {"0010"_b, "wfe_t1"},
+      {"0011"_b, "wfi_t1"},
+      {"0100"_b, "sev_t1"},
+      {"0101"_b, "sevl_t1"},
+      {"xxxx"_b, "unallocated"},
+    },
+  },
+
+  { "_00000000_35",
+    {19, 18, 17, 16},
+    { {"0000"_b, "unallocated"},
+      {"xxxx"_b, "it_t1"},
+    },
+  },
+
+  { "_00000000_36",
+    {28},
+    { {"0"_b, "_00000000_37"},
+      {"1"_b, "_00000000_38"},
+    },
+  },
+
+  { "_00000000_37",
+    {27},
+    { {"0"_b, "stm_t1"},
+      {"1"_b, "ldm_t1"},
+    },
+  },
+
+  { "_00000000_38",
+    {27, 26, 25},
+    { {"111"_b, "_00000000_39"},
+      {"xxx"_b, "_00000000_40"},
+    },
+  },
+
+  { "_00000000_39",
+    {24},
+    { {"0"_b, "udf_t1"},
+      {"1"_b, "svc_t1"},
+    },
+  },
+
+  { "_00000000_40",
+    {27, 26, 25},
+    { {"111"_b, "unallocated"},
+      {"xxx"_b, "b_t1"},
+    },
+  },
+
+  { "_00000000_41",
+    {27},
+    { {"0"_b, "_00000000_42"},
+      {"1"_b, "_00000000_103"},
+    },
+  },
+
+  { "_00000000_42",
+    {28},
+    { {"0"_b, "b_t2"},
+      {"1"_b, "_00000000_43"},
+    },
+  },
+
+  { "_00000000_43",
+    {15},
+    { {"0"_b, "_00000000_44"},
+      {"1"_b, "_00000000_81"},
+    },
+  },
+
+  { "_00000000_44",
+    {25, 24, 23, 22, 21, 20},
+    { {"000000"_b, "and_imm_t1"},
+      {"000001"_b, "_00000000_45"},
+      {"000010"_b, "bic_imm_t1"},
+      {"000011"_b, "bics_t1"},
+      {"000100"_b, "_00000000_47"},
+      {"000101"_b, "_00000000_49"},
+      {"000110"_b, "_00000000_51"},
+      {"000111"_b, "_00000000_53"},
+      {"001000"_b, "eor_imm_t1"},
+      {"001001"_b, "_00000000_55"},
+      {"010000"_b, "_00000000_57"},
+      {"010001"_b, "_00000000_59"},
+      {"010100"_b, "adc_imm_t1"},
+      {"010101"_b, "adcs_t1"},
+      {"010110"_b, "sbc_imm_t1"},
+      {"010111"_b, "sbcs_t1"},
+      {"011010"_b, "_00000000_63"},
+      {"011011"_b, "_00000000_65"},
+      {"011100"_b, "rsb_t2"},
+      {"011101"_b, "rsbs_t2"},
+      {"100000"_b, "_00000000_69"},
+      {"100100"_b, "mov_imm_t3"},
+      {"101010"_b, "_00000000_72"},
+      {"101100"_b, "movt_t1"},
+      {"110000"_b, "ssat_lsl_t1"},
+      {"110010"_b, "_00000000_75"},
+      {"110100"_b, "sbfx_t1"},
+      {"110110"_b, "_00000000_77"},
+      {"111000"_b, "usat_lsl_t1"},
+      {"111010"_b, "_00000000_79"},
+      {"111100"_b, "ubfx_t1"},
+      {"xxxxxx"_b, "unallocated"},
+    },
+  },
+
+  { "_00000000_45",
+    {11, 10, 9, 8},
+    { {"1111"_b, "tst_imm_t1"},
+      {"xxxx"_b, "_00000000_46"},
+    },
+  },
+
+  { "_00000000_46",
+    {11, 10, 9, 8},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "ands_t1"},
+    },
+  },
+
+  { "_00000000_47",
+    {19, 18, 17, 16},
+    { {"1111"_b, "mov_imm_t2"},
+      {"xxxx"_b, "_00000000_48"},
+    },
+  },
+
+  { "_00000000_48",
+    {19, 18, 17, 16},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "orr_imm_t1"},
+    },
+  },
+
+  { "_00000000_49",
+    {19, 18, 17, 16},
+    { {"1111"_b, "movs_imm_t2"},
+      {"xxxx"_b, "_00000000_50"},
+    },
+  },
+
+  { "_00000000_50",
+    {19, 18, 17, 16},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "orrs_t1"},
+    },
+  },
+
+  { "_00000000_51",
+    {19, 18, 17, 16},
+    { {"1111"_b, "mvn_imm_t1"},
+      {"xxxx"_b, "_00000000_52"},
+    },
+  },
+
+  { "_00000000_52",
+    {19, 18, 17, 16},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "orn_imm_t1"},
+    },
+  },
+
+  { "_00000000_53",
+    {19, 18, 17, 16},
+    { {"1111"_b, "mvns_t1"},
+      {"xxxx"_b, "_00000000_54"},
+    },
+  },
+
+  { "_00000000_54",
+    {19, 18, 17, 16},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "orns_imm_t1"},
+    },
+  },
+
+  { "_00000000_55",
+    {11, 10, 9, 8},
+    { {"1111"_b, "teq_imm_t1"},
+      {"xxxx"_b, "_00000000_56"},
+    },
+  },
+
+  { "_00000000_56",
+    {11, 10, 9, 8},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "eors_t1"},
+    },
+  },
+
+  { "_00000000_57",
+    {19, 18, 17, 16},
+    { {"1101"_b, "add_sp_imm_t3"},
+      {"xxxx"_b, "_00000000_58"},
+    },
+  },
+
+  { "_00000000_58",
+    {19, 18, 17, 16},
+    { {"1101"_b, "unallocated"},
+      {"xxxx"_b, "add_imm_t3"},
+    },
+  },
+
+  { "_00000000_59",
+    {11, 10, 9, 8},
+    { {"1111"_b, "cmn_imm_t1"},
+      {"xxxx"_b, "_00000000_60"},
+    },
+  },
+
+  { "_00000000_60",
+    {19, 18, 17, 16},
+    { {"1101"_b, "_00000000_61"},
+      {"xxxx"_b, "_00000000_62"},
+    },
+  },
+
+  { "_00000000_61",
+    {11, 10, 9, 8},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "adds_sp_imm_t3"},
+    },
+  },
+
+  { "_00000000_62",
+    {19, 18, 17, 16, 11, 10, 9, 8},
+    { {"1101xxxx"_b, "unallocated"},
+      {"xxxx1111"_b, "unallocated"},
+      {"xxxxxxxx"_b, "adds_imm_t3"},
+    },
+  },
+
+  { "_00000000_63",
+    {19, 18, 17, 16},
+    { {"1101"_b, "sub_sp_t2"},
+      {"xxxx"_b, "_00000000_64"},
+    },
+  },
+
+  { "_00000000_64",
+    {19, 18, 17, 16},
+    { {"1101"_b, "unallocated"},
+      {"xxxx"_b, "sub_t3"},
+    },
+  },
+
+  { "_00000000_65",
+    {11, 10, 9, 8},
+    { {"1111"_b, "cmp_imm_t2"},
+      {"xxxx"_b, "_00000000_66"},
+    },
+  },
+
+  { "_00000000_66",
+    {19, 18, 17, 16},
+    { {"1101"_b, "_00000000_67"},
+      {"xxxx"_b, "_00000000_68"},
+    },
+  },
+
+  { "_00000000_67",
+    {11, 10, 9, 8},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "subs_sp_t2"},
+    },
+  },
+
+  { "_00000000_68",
+    {19, 18, 17, 16, 11, 10, 9, 8},
+    { {"1101xxxx"_b, "unallocated"},
+      {"xxxx1111"_b, "unallocated"},
+      {"xxxxxxxx"_b, "subs_t3"},
+    },
+  },
+
+  { "_00000000_69",
+    {19, 18, 16},
+    { {"111"_b, "_00000000_70"},
+      {"xxx"_b, "_00000000_71"},
+    },
+  },
+
+  { "_00000000_70",
+    {17},
+    { {"0"_b, "add_sp_t4"},
+      {"1"_b, "adr_t3"},
+    },
+  },
+
+  { "_00000000_71",
+    {19, 18, 16},
+    { {"111"_b, "unallocated"},
+      {"xxx"_b, "add_t4"},
+    },
+  },
+
+  { "_00000000_72",
+    {19, 18, 16},
+    { {"111"_b, "_00000000_73"},
+      {"xxx"_b, "_00000000_74"},
+    },
+  },
+
+  { "_00000000_73",
+    {17},
+    { {"0"_b, "sub_sp_t3"},
+      {"1"_b, "_00000000_1036"},
+    },
+  },
+
+  { "_00000000_1036",
+    {26, 14, 13, 12, 7, 6, 5, 4, 3, 2, 1, 0},
+    { {"000000000000"_b, "sub_pc_t2"},
+      {"xxxxxxxxxxxx"_b, "adr_t2"},
+    },
+  },
+
+  { "_00000000_74",
+    {19, 18, 16},
+    { {"111"_b, "unallocated"},
+      {"xxx"_b, "sub_t4"},
+    },
+  },
+
+  { "_00000000_75",
+    {14, 13, 12, 7, 6},
+    { {"00000"_b, "ssat16_t1"},
+      {"xxxxx"_b, "_00000000_76"},
+    },
+  },
+
+  { "_00000000_76",
+    {14, 13, 12, 7, 6},
+    { {"00000"_b, "unallocated"},
+      {"xxxxx"_b, "ssat_asr_t1"},
+    },
+  },
+
+  { "_00000000_77",
+    {19, 18, 17, 16},
+    { {"1111"_b, "bfc_t1"},
+      {"xxxx"_b, "_00000000_78"},
+    },
+  },
+
+  { "_00000000_78",
+    {19, 18, 17, 16},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "bfi_t1"},
+    },
+  },
+
+  { "_00000000_79",
+    {14, 13, 12, 7, 6},
+    { {"00000"_b, "usat16_t1"},
+      {"xxxxx"_b, "_00000000_80"},
+    },
+  },
+
+  { "_00000000_80",
+    {14, 13, 12, 7, 6},
+    { {"00000"_b, "unallocated"},
+      {"xxxxx"_b, "usat_asr_t1"},
+    },
+  },
+
+  { "_00000000_81",
+    {14, 12},
+    { {"00"_b, "_00000000_82"},
+      {"01"_b, "b_t4"},
+      {"10"_b, "_00000000_102"},
+      {"11"_b, "bl_t1"},
+    },
+  },
+
+  { "_00000000_82",
+    {25, 24, 23},
+    { {"111"_b, "_00000000_83"},
+      {"xxx"_b, "_00000000_101"},
+    },
+  },
+
+  { "_00000000_83",
+    {26, 22, 21},
+    { {"000"_b, "_00000000_84"},
+      {"001"_b, "_00000000_85"},
+      {"010"_b, "_00000000_93"},
+      {"011"_b, "_00000000_97"},
+      {"100"_b, "_00000000_98"},
+      {"111"_b, "_00000000_100"},
+      {"xxx"_b, "unallocated"},
+    },
+  },
+
+  { "_00000000_84",
+    {5},
+    { {"0"_b, "msr_t1"},
+      {"1"_b, "msr_banked_t1"},
+    },
+  },
+
+  { "_00000000_85",
+    {20},
+    { {"0"_b, "_00000000_86"},
+      {"1"_b, "_00000000_92"},
+    },
+  },
+
+  { "_00000000_86",
+    {10, 9, 8},
+    { {"000"_b, "_00000000_87"},
+      {"001"_b, "_00000000_89"},
+      {"100"_b, "_00000000_90"},
+      {"101"_b, "cpsie_t2"},
+      {"110"_b, "_00000000_91"},
+      {"111"_b, "cpsid_t2"},
+      {"xxx"_b, "unallocated"},
+    },
+  },
+
+  { "_00000000_87",
+    {7, 6, 5, 4},
+    { {"0000"_b, "_00000000_88"},
+      {"1111"_b, "dbg_t1"},
+      {"xxxx"_b, "unallocated"},
+    },
+  },
+
+  { "_00000000_88",
+    {3, 2, 1, 0},
+    { {"0000"_b, "nop_t2"},
+      {"0001"_b, "yield_t2"},
+      {"0010"_b, "wfe_t2"},
+      {"0011"_b, "wfi_t2"},
+      {"0100"_b, "sev_t2"},
+      {"0101"_b, "sevl_t2"},
+      {"xxxx"_b, "unallocated"},
+    },
+  },
+
+  { "_00000000_89",
+    {7, 6, 5},
+    { {"000"_b, "cps_t2"},
+      {"xxx"_b, "unallocated"},
+    },
+  },
+
+  { "_00000000_90",
+    {4, 3, 2, 1, 0},
+    { {"00000"_b, "cpsie_t2"},
+      {"xxxxx"_b, "unallocated"},
+    },
+  },
+
+  { "_00000000_91",
+    {4, 3, 2, 1, 0},
+    { {"00000"_b, "cpsid_t2"},
+      {"xxxxx"_b, "unallocated"},
+    },
+  },
+
+  { "_00000000_92",
+    {7, 6, 5, 4},
+    { {"0010"_b, "clrex_t1"},
+      {"0100"_b, "dsb_t1"},
+      {"0101"_b, "dmb_t1"},
+      {"0110"_b, "isb_t1"},
+      {"xxxx"_b, "unallocated"},
+    },
+  },
+
+  { "_00000000_93",
+    {20},
+    { {"0"_b, "bxj_t1"},
+      {"1"_b, "_00000000_94"},
+    },
+  },
+
+  { "_00000000_94",
+    {7, 6, 5, 4, 3, 2, 1, 0},
+    { {"00000000"_b, "_00000000_95"},
+      {"xxxxxxxx"_b, "_00000000_96"},
+    },
+  },
+
+  { "_00000000_95",
+    {19, 18, 17, 16},
+    { {"1110"_b, "eret_t1"},
+      {"xxxx"_b, "unallocated"},
+    },
+  },
+
+  { "_00000000_96",
+    {7, 6, 5, 4, 3, 2, 1, 0},
+    { {"00000000"_b, "unallocated"},
+      {"xxxxxxxx"_b, "subs_t5"},
+    },
+  },
+
+  { "_00000000_97",
+    {5},
+    { {"0"_b, "mrs_t1"},
+      {"1"_b, "mrs_banked_t1"},
+    },
+  },
+
+  { "_00000000_98",
+    {20, 19, 18},
+    { {"011"_b, "_00000000_99"},
+      {"xxx"_b, "unallocated"},
+    },
+  },
+
+  { "_00000000_99",
+    {17, 16, 13, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0},
+    { {"110000000000001"_b, "dcps1_t1"},
+      {"110000000000010"_b, "dcps2_t1"},
+      {"110000000000011"_b, "dcps3_t1"},
+      {"xxxxxxxxxxxxxxx"_b, "unallocated"},
+    },
+  },
+
+  { "_00000000_100",
+    {20, 13},
+    { {"00"_b, "hvc_t1"},
+      {"10"_b, "smc_t1"},
+      {"11"_b, "udf_t2"},
+      {"xx"_b, "unallocated"},
+    },
+  },
+
+  { "_00000000_101",
+    {25, 24, 23},
+    { {"111"_b, "unallocated"},
+      {"xxx"_b, "b_t3"},
+    },
+  },
+
+  { "_00000000_102",
+    {0},
+    { {"0"_b, "blx_t2"},
+      {"x"_b, "unallocated"},
+    },
+  },
+
+  { "_00000000_103",
+    {26, 25},
+    { {"00"_b, "_00000000_104"},
+      {"01"_b, "_00000000_382"},
+      {"10"_b, "_00000000_566"},
+      {"11"_b, "_00000000_604"},
+    },
+  },
+
+  { "_00000000_104",
+    {28, 20},
+    { {"00"_b, "_00000000_105"},
+      {"01"_b, "_00000000_115"},
+      {"10"_b, "_00000000_129"},
+      {"11"_b, "_00000000_301"},
+    },
+  },
+
+  { "_00000000_105",
+    {24, 22},
+    { {"00"_b, "_00000000_106"},
+      {"01"_b, "_00000000_107"},
+      {"10"_b, "_00000000_111"},
+      {"11"_b, "_00000000_112"},
+    },
+  },
+
+  { "_00000000_106",
+    {23},
+    { {"0"_b, "srsdb_t1"},
+      {"1"_b, "stm_t2"},
+    },
+  },
+
+  { "_00000000_107",
+    {21},
+    { {"0"_b, "_00000000_108"},
+      {"1"_b, "_00000000_110"},
+    },
+  },
+
+  { "_00000000_108",
+    {23},
+    { {"0"_b, "strex_t1"},
+      {"1"_b, "_00000000_109"},
+    },
+  },
+
+  { "_00000000_109",
+    {7, 6, 5, 4},
+    { {"0100"_b, "strexb_t1"},
+      {"0101"_b, "strexh_t1"},
+      {"0111"_b, "strexd_t1"},
+      {"1000"_b, "stlb_t1"},
+      {"1001"_b, "stlh_t1"},
+      {"1010"_b, "stl_t1"},
+      {"1100"_b, "stlexb_t1"},
+      {"1101"_b, "stlexh_t1"},
+      {"1110"_b, "stlex_t1"},
+      {"1111"_b, "stlexd_t1"},
+      {"xxxx"_b, "unallocated"},
+    },
+  },
+
+  { "_00000000_110",
+    {19, 18, 17, 16},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "strd_post_t1"},
+    },
+  },
+
+  { "_00000000_111",
+    {23},
+    { {"0"_b, "push_t2"},
+      {"1"_b, "srsia_t2"},
+    },
+  },
+
+  { "_00000000_112",
+    {21},
+    { {"0"_b, "_00000000_113"},
+      {"1"_b, "_00000000_114"},
+    },
+  },
+
+  { "_00000000_113",
+    {19, 18, 17, 16},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "strd_off_t1"},
+    },
+  },
+
+  { "_00000000_114",
+    {19, 18, 17, 16},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "strd_pre_t1"},
+    },
+  },
+
+  { "_00000000_115",
+    {22},
+    { {"0"_b, "_00000000_116"},
+      {"1"_b, "_00000000_117"},
+    },
+  },
+
+  { "_00000000_116",
+    {24, 23},
+    { {"00"_b, "rfedb_t1"},
+      {"01"_b, "pop_t2"},
+      {"10"_b, "ldmdb_t1"},
+      {"11"_b, "rfeia_t2"},
+    },
+  },
+
+  { "_00000000_117",
+    {24, 21},
+    { {"00"_b, "_00000000_118"},
+      {"01"_b, "_00000000_120"},
+      {"10"_b, "_00000000_123"},
+      {"11"_b, "_00000000_126"},
+    },
+  },
+
+  { "_00000000_118",
+    {23},
+    { {"0"_b, "ldrex_t1"},
+      {"1"_b, "_00000000_119"},
+    },
+  },
+
+  { "_00000000_119",
+    {7, 6, 5, 4},
+    { {"0000"_b, "tbb_t1"},
+      {"0001"_b, "tbh_t1"},
+      {"0100"_b, "ldrexb_t1"},
+      {"0101"_b, "ldrexh_t1"},
+      {"0111"_b, "ldrexd_t1"},
+      {"1000"_b, "ldab_t1"},
+      {"1001"_b, "ldah_t1"},
+      {"1010"_b, "lda_t1"},
+      {"1100"_b, "ldaexb_t1"},
+      {"1101"_b, "ldaexh_t1"},
+      {"1110"_b, "ldaex_t1"},
+      {"1111"_b, "ldaexd_t1"},
+      {"xxxx"_b, "unallocated"},
+    },
+  },
+
+  { "_00000000_120",
+    {19, 18, 17, 16},
+    { {"1111"_b, "_00000000_121"},
+      {"xxxx"_b, "_00000000_122"},
+    },
+  },
+
+  { "_00000000_121",
+    {24, 21},
+    { {"00"_b, "unallocated"},
+      {"xx"_b, "ldrd_lit_t1"},
+    },
+  },
+
+  { "_00000000_122",
+    {19, 18, 17, 16},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "ldrd_imm_post_t1"},
+    },
+  },
+
+  { "_00000000_123",
+    {19, 18, 17, 16},
+    { {"1111"_b, "_00000000_124"},
+      {"xxxx"_b, "_00000000_125"},
+    },
+  },
+
+  { "_00000000_124",
+    {24, 21},
+    { {"00"_b, "unallocated"},
+      {"xx"_b, "ldrd_lit_t1"},
+    },
+  },
+
+  { "_00000000_125",
+    {19, 18, 17, 16},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "ldrd_imm_off_t1"},
+    },
+  },
+
+  { "_00000000_126",
+    {19, 18, 17, 16},
+    { {"1111"_b, "_00000000_127"},
+      {"xxxx"_b, "_00000000_128"},
+    },
+  },
+
+  { "_00000000_127",
+    {24, 21},
+    { {"00"_b, "unallocated"},
+      {"xx"_b, "ldrd_lit_t1"},
+    },
+  },
+
+  { "_00000000_128",
+    {19, 18, 17, 16},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "ldrd_imm_pre_t1"},
+    },
+  },
+
+  { "_00000000_129",
+    {24, 23, 21},
+    { {"000"_b, "_00000000_130"},
+      {"001"_b, "_00000000_145"},
+      {"010"_b, "_00000000_153"},
+      {"011"_b, "_00000000_156"},
+      {"100"_b, "_00000000_158"},
+      {"101"_b, "_00000000_200"},
+      {"110"_b, "_00000000_238"},
+      {"111"_b, "_00000000_263"},
+    },
+  },
+
+  { "_00000000_130",
+    {22, 11, 10, 8},
+    { {"0000"_b, "_00000000_131"},
+      {"0101"_b, "_00000000_133"},
+      {"0110"_b, "_00000000_134"},
+      {"0111"_b, "_00000000_137"},
+      {"1000"_b, "_00000000_138"},
+      {"1101"_b, "_00000000_140"},
+      {"1110"_b, "_00000000_141"},
+      {"1111"_b, "_00000000_144"},
+      {"xxxx"_b, "unallocated"},
+    },
+  },
+
+  { "_00000000_131",
+    {9, 7, 6},
+    { {"000"_b, "_00000000_132"},
+      {"xxx"_b, "unallocated"},
+    },
+  },
+
+  { "_00000000_132",
+    {19, 18, 17, 16},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "strb_reg_t2"},
+    },
+  },
+
+  { "_00000000_133",
+    {19, 18, 17, 16},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "strb_post_t3"},
+    },
+  },
+
+  { "_00000000_134",
+    {9},
+    { {"0"_b, "_00000000_135"},
+      {"1"_b, "_00000000_136"},
+    },
+  },
+
+  { "_00000000_135",
+    {19, 18, 17, 16},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "strb_off_t3"},
+    },
+  },
+
+  { "_00000000_136",
+    {19, 18, 17, 16},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "strbt_t1"},
+    },
+  },
+
+  { "_00000000_137",
+    {19, 18, 17, 16},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "strb_pre_t3"},
+    },
+  },
+
+  { "_00000000_138",
+    {9, 7, 6},
+    { {"000"_b, "_00000000_139"},
+      {"xxx"_b, "unallocated"},
+    },
+  },
+
+  { "_00000000_139",
+    {19, 18, 17, 16},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "str_t2"},
+    },
+  },
+
+  { "_00000000_140",
+    {19, 18, 17, 16},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "str_post_t4"},
+    },
+  },
+
+  { "_00000000_141",
+    {9},
+    { {"0"_b, "_00000000_142"},
+      {"1"_b, "_00000000_143"},
+    },
+  },
+
+  { "_00000000_142",
+    {19, 18, 17, 16},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "str_off_t4"},
+    },
+  },
+
+  { "_00000000_143",
+    {19, 18, 17, 16},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "strt_t1"},
+    },
+  },
+
+  { "_00000000_144",
+    {19, 18, 17, 16},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "_00000000_1037"},
+    },
+  },
+
+  { "_00000000_1037",
+    {19, 18, 17, 16, 9, 7, 6, 5, 4, 3, 2, 1, 0},
+    { {"1101000000100"_b, "push_t4"},
+      {"xxxxxxxxxxxxx"_b, "str_pre_t4"},
+    },
+  },
+
+  { "_00000000_145",
+    {22, 11, 10, 8},
+    { {"0000"_b, "_00000000_146"},
+      {"0101"_b, "_00000000_148"},
+      {"0110"_b, "_00000000_149"},
+      {"0111"_b, "_00000000_152"},
+      {"xxxx"_b, "unallocated"},
+    },
+  },
+
+  { "_00000000_146",
+    {9, 7, 6},
+    { {"000"_b, "_00000000_147"},
+      {"xxx"_b, "unallocated"},
+    },
+  },
+
+  { "_00000000_147",
+    {19, 18, 17, 16},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "strh_reg_t2"},
+    },
+  },
+
+  { "_00000000_148",
+    {19, 18, 17, 16},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "strh_post_t3"},
+    },
+  },
+
+  { "_00000000_149",
+    {9},
+    { {"0"_b, "_00000000_150"},
+      {"1"_b, "_00000000_151"},
+    },
+  },
+
+  { "_00000000_150",
+    {19, 18, 17, 16},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "strh_off_t3"},
+    },
+  },
+
+  { "_00000000_151",
+    {19, 18, 17, 16},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "strht_t1"},
+    },
+  },
+
+  { "_00000000_152",
+    {19, 18, 17, 16},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "strh_pre_t3"},
+    },
+  },
+
+  { "_00000000_153",
+    {22},
+    { {"0"_b, "_00000000_154"},
+      {"1"_b, "_00000000_155"},
+    },
+  },
+
+  { "_00000000_154",
+    {19, 18, 17, 16},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "strb_imm_t2"},
+    },
+  },
+
+  { "_00000000_155",
+    {19, 18, 17, 16},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "str_t3"},
+    },
+  },
+
+  { "_00000000_156",
+    {22},
+    { {"0"_b, "_00000000_157"},
+      {"x"_b, "unallocated"},
+    },
+  },
+
+  { "_00000000_157",
+    {19, 18, 17, 16},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "strh_imm_t2"},
+    },
+  },
+
+  { "_00000000_158",
+    {3, 2, 0},
+    { {"111"_b, "_00000000_159"},
+      {"xxx"_b, "_00000000_180"},
+    },
+  },
+
+  { "_00000000_159",
+    {1},
+    { {"0"_b, "_00000000_160"},
+      {"1"_b, "_00000000_170"},
+    },
+  },
+
+  { "_00000000_160",
+    {11, 10, 9, 8},
+    { {"0000"_b, "vst4_multi_wb_t1"},
+      {"0001"_b, "vst4_multi_wb_t1"},
+      {"0010"_b, "_00000000_161"},
+      {"0011"_b, "_00000000_162"},
+      {"0100"_b, "_00000000_163"},
+      {"0101"_b, "_00000000_164"},
+      {"0110"_b, "_00000000_165"},
+      {"0111"_b, "_00000000_166"},
+      {"1000"_b, "_00000000_167"},
+      {"1001"_b, "_00000000_168"},
+      {"1010"_b, "_00000000_169"},
+      {"xxxx"_b, "unallocated"},
+    },
+  },
+
+  { "_00000000_161",
+    {11, 10, 9, 8, 5, 4},
+    { {"011x1x"_b, "unallocated"},
+      {"101011"_b, "unallocated"},
+      {"xxxxxx"_b, "vst1_multi_wb_t1"},
+    },
+  },
+
+  { "_00000000_162",
+    {11, 10, 9, 5, 4},
+    { {"10011"_b, "unallocated"},
+      {"xxxxx"_b, "vst2_multi_wb_t1"},
+    },
+  },
+
+  { "_00000000_163",
+    {5},
+    { {"1"_b, "unallocated"},
+      {"x"_b, "vst3_multi_wb_t1"},
+    },
+  },
+
+  { "_00000000_164",
+    {5},
+    { {"1"_b, "unallocated"},
+      {"x"_b, "vst3_multi_wb_t1"},
+    },
+  },
+
+  { "_00000000_165",
+    {11, 10, 9, 8, 5, 4},
+    { {"011x1x"_b, "unallocated"},
+      {"101011"_b, "unallocated"},
+      {"xxxxxx"_b, "vst1_multi_wb_t1"},
+    },
+  },
+
+  { "_00000000_166",
+    {11, 10, 9, 8, 5, 4},
+    { {"011x1x"_b, "unallocated"},
+      {"101011"_b, "unallocated"},
+      {"xxxxxx"_b, "vst1_multi_wb_t1"},
+    },
+  },
+
+  { "_00000000_167",
+    {11, 10, 9, 5, 4},
+    { {"10011"_b, "unallocated"},
+      {"xxxxx"_b, "vst2_multi_wb_t1"},
+    },
+  },
+
+  { "_00000000_168",
+    {11, 10, 9, 5, 4},
+    { {"10011"_b, "unallocated"},
+      {"xxxxx"_b, "vst2_multi_wb_t1"},
+    },
+  },
+
+  { "_00000000_169",
+    {11, 10, 9, 8, 5, 4},
+    { {"011x1x"_b, "unallocated"},
+      {"101011"_b, "unallocated"},
+      {"xxxxxx"_b, "vst1_multi_wb_t1"},
+    },
+  },
+
+  { "_00000000_170",
+    {11, 10, 9, 8},
+    { {"0000"_b, "vst4_multi_off_t1"},
+      {"0001"_b, "vst4_multi_off_t1"},
+      {"0010"_b, "_00000000_171"},
+      {"0011"_b, "_00000000_172"},
+      {"0100"_b, "_00000000_173"},
+      {"0101"_b, "_00000000_174"},
+      {"0110"_b, "_00000000_175"},
+      {"0111"_b, "_00000000_176"},
+      {"1000"_b, "_00000000_177"},
+      {"1001"_b, "_00000000_178"},
+      {"1010"_b, "_00000000_179"},
+      {"xxxx"_b, "unallocated"},
+    },
+  },
+
+  { "_00000000_171",
+    {11, 10, 9, 8, 5, 4},
+    { {"011x1x"_b, "unallocated"},
+      {"101011"_b, "unallocated"},
+      {"xxxxxx"_b, "vst1_multi_off_t1"},
+    },
+  },
+
+  { "_00000000_172",
+    {11, 10, 9, 5, 4},
+    { {"10011"_b, "unallocated"},
+      {"xxxxx"_b, "vst2_multi_off_t1"},
+    },
+  },
+
+  { "_00000000_173",
+    {5},
+    { {"1"_b, "unallocated"},
+      {"x"_b, "vst3_multi_off_t1"},
+    },
+  },
+
+  { "_00000000_174",
+    {5},
+    { {"1"_b, "unallocated"},
+      {"x"_b, "vst3_multi_off_t1"},
+    },
+  },
+
+  { "_00000000_175",
+    {11, 10, 9, 8, 5, 4},
+    { {"011x1x"_b, "unallocated"},
+      {"101011"_b, "unallocated"},
+      {"xxxxxx"_b, "vst1_multi_off_t1"},
+    },
+  },
+
+  { "_00000000_176",
+    {11, 10, 9, 8, 5, 4},
+    { {"011x1x"_b, "unallocated"},
+      {"101011"_b, "unallocated"},
+      {"xxxxxx"_b, "vst1_multi_off_t1"},
+    },
+  },
+
+  { "_00000000_177",
+    {11, 10, 9, 5, 4},
+    { {"10011"_b, "unallocated"},
+      {"xxxxx"_b, "vst2_multi_off_t1"},
+    },
+  },
+
+  { "_00000000_178",
+    {11, 10, 9, 5, 4},
+    { {"10011"_b, "unallocated"},
+      {"xxxxx"_b, "vst2_multi_off_t1"},
+    },
+  },
+
+  { "_00000000_179",
+    {11, 10, 9, 8, 5, 4},
+    { {"011x1x"_b, "unallocated"},
+      {"101011"_b, "unallocated"},
+      {"xxxxxx"_b, "vst1_multi_off_t1"},
+    },
+  },
+
+  { "_00000000_180",
+    {11, 10, 9, 8},
+    { {"0000"_b, "_00000000_181"},
+      {"0001"_b, "_00000000_182"},
+      {"0010"_b, "_00000000_183"},
+      {"0011"_b, "_00000000_186"},
+      {"0100"_b, "_00000000_187"},
+      {"0101"_b, "_00000000_188"},
+      {"0110"_b, "_00000000_189"},
+      {"0111"_b, "_00000000_192"},
+      {"1000"_b, "_00000000_195"},
+      {"1001"_b, "_00000000_196"},
+      {"1010"_b, "_00000000_197"},
+      {"xxxx"_b, "unallocated"},
+    },
+  },
+
+  { "_00000000_181",
+    {3, 2, 0},
+    { {"111"_b, "unallocated"},
+      {"xxx"_b, "vst4_multi_post_t1"},
+    },
+  },
+
+  { "_00000000_182",
+    {3, 2, 0},
+    { {"111"_b, "unallocated"},
+      {"xxx"_b, "vst4_multi_post_t1"},
+    },
+  },
+
+  { "_00000000_183",
+    {3, 2, 0},
+    { {"111"_b, "unallocated"},
+      {"xxx"_b, "_00000000_184"},
+    },
+  },
+
+  { "_00000000_184",
+    {11, 10, 9, 5},
+    { {"0111"_b, "unallocated"},
+      {"xxxx"_b, "_00000000_185"},
+    },
+  },
+
+  { "_00000000_185",
+    {11, 10, 9, 8, 5, 4},
+    { {"101011"_b, "unallocated"},
+      {"xxxxxx"_b, "vst1_multi_post_t1"},
+    },
+  },
+
+  { "_00000000_186",
+    {11, 10, 9, 5, 4, 3, 2, 0},
+    { {"xxxxx111"_b, "unallocated"},
+      {"10011xxx"_b, "unallocated"},
+      {"xxxxxxxx"_b, "vst2_multi_post_t1"},
+    },
+  },
+
+  { "_00000000_187",
+    {5, 3, 2, 0},
+    { {"x111"_b, "unallocated"},
+      {"1xxx"_b, "unallocated"},
+      {"xxxx"_b, "vst3_multi_post_t1"},
+    },
+  },
+
+  { "_00000000_188",
+    {5, 3, 2, 0},
+    { {"x111"_b, "unallocated"},
+      {"1xxx"_b, "unallocated"},
+      {"xxxx"_b, "vst3_multi_post_t1"},
+    },
+  },
+
+  { "_00000000_189",
+    {3, 2, 0},
+    { {"111"_b, "unallocated"},
+      {"xxx"_b, "_00000000_190"},
+    },
+  },
+
+  { "_00000000_190",
+    {11, 10, 9, 5},
+    { {"0111"_b, "unallocated"},
+      {"xxxx"_b, "_00000000_191"},
+    },
+  },
+
+  { "_00000000_191",
+    {11, 10, 9, 8, 5, 4},
+    { {"101011"_b, "unallocated"},
+      {"xxxxxx"_b, "vst1_multi_post_t1"},
+    },
+  },
+
+  { "_00000000_192",
+    {3, 2, 0},
+    { {"111"_b, "unallocated"},
+      {"xxx"_b, "_00000000_193"},
+    },
+  },
+
+  { "_00000000_193",
+    {11, 10, 9, 5},
+    { {"0111"_b, "unallocated"},
+      {"xxxx"_b, "_00000000_194"},
+    },
+  },
+
+  { "_00000000_194",
+    {11, 10, 9, 8, 5, 4},
+    { {"101011"_b, "unallocated"},
+      {"xxxxxx"_b, "vst1_multi_post_t1"},
+    },
+  },
+
+  { "_00000000_195",
+    {11, 10, 9, 5, 4, 3, 2, 0},
+    { {"xxxxx111"_b, "unallocated"},
+      {"10011xxx"_b, "unallocated"},
+      {"xxxxxxxx"_b, "vst2_multi_post_t1"},
+    },
+  },
+
+  { "_00000000_196",
+    {11, 10, 9, 5, 4, 3, 2, 0},
+    { {"xxxxx111"_b, "unallocated"},
+      {"10011xxx"_b, "unallocated"},
+      {"xxxxxxxx"_b, "vst2_multi_post_t1"},
+    },
+  },
+
+  { "_00000000_197",
+    {3, 2, 0},
+    { {"111"_b, "unallocated"},
+      {"xxx"_b, "_00000000_198"},
+    },
+  },
+
+  { "_00000000_198",
+    {11, 10, 9, 5},
+    { {"0111"_b, "unallocated"},
+      {"xxxx"_b, "_00000000_199"},
+    },
+  },
+
+  { "_00000000_199",
+    {11, 10, 9, 8, 5, 4},
+    { {"101011"_b, "unallocated"},
+      {"xxxxxx"_b, "vst1_multi_post_t1"},
+    },
+  },
+
+  { "_00000000_200",
+    {3, 2, 0},
+    { {"111"_b, "_00000000_201"},
+      {"xxx"_b, "_00000000_218"},
+    },
+  },
+
+  { "_00000000_201",
+    {1},
+    { {"0"_b, "_00000000_202"},
+      {"1"_b, "_00000000_210"},
+    },
+  },
+
+  { "_00000000_202",
+    {11, 10, 9, 8},
+    { {"0000"_b, "vld4_multi_wb_t1"},
+      {"0001"_b, "vld4_multi_wb_t1"},
+      {"0010"_b, "_00000000_203"},
+      {"0011"_b, "_00000000_204"},
+      {"0100"_b, "vld3_multi_wb_t1"},
+      {"0101"_b, "vld3_multi_wb_t1"},
+      {"0110"_b, "_00000000_205"},
+      {"0111"_b, "_00000000_206"},
+      {"1000"_b, "_00000000_207"},
+      {"1001"_b, "_00000000_208"},
+      {"1010"_b, "_00000000_209"},
+      {"xxxx"_b, "unallocated"},
+    },
+  },
+
+  { "_00000000_203",
+    {11, 10, 9, 8, 5, 4},
+    { {"011x1x"_b, "unallocated"},
+      {"101011"_b, "unallocated"},
+      {"xxxxxx"_b, "vld1_multi_wb_t1"},
+    },
+  },
+
+  { "_00000000_204",
+    {11, 10, 9, 5, 4},
+    { {"10011"_b, "unallocated"},
+      {"xxxxx"_b, "vld2_multi_wb_t1"},
+    },
+  },
+
+  { "_00000000_205",
+    {11, 10, 9, 8, 5, 4},
+    { {"011x1x"_b, "unallocated"},
+      {"101011"_b, "unallocated"},
+      {"xxxxxx"_b, "vld1_multi_wb_t1"},
+    },
+  },
+
+  { "_00000000_206",
+    {11, 10, 9, 8, 5, 4},
+    { {"011x1x"_b, "unallocated"},
+      {"101011"_b, "unallocated"},
+      {"xxxxxx"_b, "vld1_multi_wb_t1"},
+    },
+  },
+
+  { "_00000000_207",
+    {11, 10, 9, 5, 4},
+    { {"10011"_b, "unallocated"},
+      {"xxxxx"_b, "vld2_multi_wb_t1"},
+    },
+  },
+
+  { "_00000000_208",
+    {11, 10, 9, 5, 4},
+    { {"10011"_b, "unallocated"},
+      {"xxxxx"_b, "vld2_multi_wb_t1"},
+    },
+  },
+
+  { "_00000000_209",
+    {11, 10, 9, 8, 5, 4},
+    { {"011x1x"_b, "unallocated"},
+      {"101011"_b, "unallocated"},
+      {"xxxxxx"_b, "vld1_multi_wb_t1"},
+    },
+  },
+
+  { "_00000000_210",
+    {11, 10, 9, 8},
+    { {"0000"_b, "vld4_multi_off_t1"},
+      {"0001"_b, "vld4_multi_off_t1"},
+      {"0010"_b, "_00000000_211"},
+      {"0011"_b, "_00000000_212"},
+      {"0100"_b, "vld3_multi_off_t1"},
+      {"0101"_b, "vld3_multi_off_t1"},
+      {"0110"_b, "_00000000_213"},
+      {"0111"_b, "_00000000_214"},
+      {"1000"_b, "_00000000_215"},
+      {"1001"_b, "_00000000_216"},
+      {"1010"_b, "_00000000_217"},
+      {"xxxx"_b, "unallocated"},
+    },
+  },
+
+  { "_00000000_211",
+    {11, 10, 9, 8, 5, 4},
+    { {"011x1x"_b, "unallocated"},
+      {"101011"_b, "unallocated"},
+      {"xxxxxx"_b, "vld1_multi_off_t1"},
+    },
+  },
+
+  { "_00000000_212",
+    {11, 10, 9, 5, 4},
+    { {"10011"_b, "unallocated"},
+      {"xxxxx"_b, "vld2_multi_off_t1"},
+    },
+  },
+
+  { "_00000000_213",
+    {11, 10, 9, 8, 5, 4},
+    { {"011x1x"_b, "unallocated"},
+      {"101011"_b, "unallocated"},
+      {"xxxxxx"_b, "vld1_multi_off_t1"},
+    },
+  },
+
+  { "_00000000_214",
+    {11, 10, 9, 8, 5, 4},
+    { {"011x1x"_b, "unallocated"},
+      {"101011"_b, "unallocated"},
+      {"xxxxxx"_b, "vld1_multi_off_t1"},
+    },
+  },
+
+  { "_00000000_215",
+    {11, 10, 9, 5, 4},
+    { {"10011"_b, "unallocated"},
+      {"xxxxx"_b, "vld2_multi_off_t1"},
+    },
+  },
+
+  { "_00000000_216",
+    {11, 10, 9, 5, 4},
+    { {"10011"_b, "unallocated"},
+      {"xxxxx"_b, "vld2_multi_off_t1"},
+    },
+  },
+
+  { "_00000000_217",
+    {11, 10, 9, 8, 5, 4},
+    { {"011x1x"_b, "unallocated"},
+      {"101011"_b, "unallocated"},
+      {"xxxxxx"_b, "vld1_multi_off_t1"},
+    },
+  },
+
+  { "_00000000_218",
+    {11, 10, 9, 8},
+    { {"0000"_b, "_00000000_219"},
+      {"0001"_b, "_00000000_220"},
+      {"0010"_b, "_00000000_221"},
+      {"0011"_b, "_00000000_224"},
+      {"0100"_b, "_00000000_225"},
+      {"0101"_b, "_00000000_226"},
+      {"0110"_b, "_00000000_227"},
+      {"0111"_b, "_00000000_230"},
+      {"1000"_b, "_00000000_233"},
+      {"1001"_b, "_00000000_234"},
+      {"1010"_b, "_00000000_235"},
+      {"xxxx"_b, "unallocated"},
+    },
+  },
+
+  { "_00000000_219",
+    {3, 2, 0},
+    { {"111"_b, "unallocated"},
+      {"xxx"_b, "vld4_multi_post_t1"},
+    },
+  },
+
+  { "_00000000_220",
+    {3, 2, 0},
+    { {"111"_b, "unallocated"},
+      {"xxx"_b, "vld4_multi_post_t1"},
+    },
+  },
+
+  { "_00000000_221",
+    {3, 2, 0},
+    { {"111"_b, "unallocated"},
+      {"xxx"_b, "_00000000_222"},
+    },
+  },
+
+  { "_00000000_222",
+    {11, 10, 9, 5},
+    { {"0111"_b, "unallocated"},
+      {"xxxx"_b, "_00000000_223"},
+    },
+  },
+
+  { "_00000000_223",
+    {11, 10, 9, 8, 5, 4},
+    { {"101011"_b, "unallocated"},
+      {"xxxxxx"_b, "vld1_multi_post_t1"},
+    },
+  },
+
+  { "_00000000_224",
+    {11, 10, 9, 5, 4, 3, 2, 0},
+    { {"xxxxx111"_b, "unallocated"},
+      {"10011xxx"_b, "unallocated"},
+      {"xxxxxxxx"_b, "vld2_multi_post_t1"},
+    },
+  },
+
+  { "_00000000_225",
+    {3, 2, 0},
+    { {"111"_b, "unallocated"},
+      {"xxx"_b, "vld3_multi_post_t1"},
+    },
+  },
+
+  { "_00000000_226",
+    {3, 2, 0},
+    { {"111"_b, "unallocated"},
+      {"xxx"_b, "vld3_multi_post_t1"},
+    },
+  },
+
+  { "_00000000_227",
+    {3, 2, 0},
+    { {"111"_b, "unallocated"},
+      {"xxx"_b, "_00000000_228"},
+    },
+  },
+
+  { "_00000000_228",
+    {11, 10, 9, 5},
+    { {"0111"_b, "unallocated"},
+      {"xxxx"_b, "_00000000_229"},
+    },
+  },
+
+  { "_00000000_229",
+    {11, 10, 9, 8, 5, 4},
+    { {"101011"_b, "unallocated"},
+      {"xxxxxx"_b, "vld1_multi_post_t1"},
+    },
+  },
+
+  { "_00000000_230",
+    {3, 2, 0},
+    { {"111"_b, "unallocated"},
+      {"xxx"_b, "_00000000_231"},
+    },
+  },
+
+  { "_00000000_231",
+    {11, 10, 9, 5},
+    { {"0111"_b, "unallocated"},
+      {"xxxx"_b, "_00000000_232"},
+    },
+  },
+
+  { "_00000000_232",
+    {11, 10, 9, 8, 5, 4},
+    { {"101011"_b, "unallocated"},
+      {"xxxxxx"_b, "vld1_multi_post_t1"},
+    },
+  },
+
+  { "_00000000_233",
+    {11, 10, 9, 5, 4, 3, 2, 0},
+    { {"xxxxx111"_b, "unallocated"},
+      {"10011xxx"_b, "unallocated"},
+      {"xxxxxxxx"_b, "vld2_multi_post_t1"},
+    },
+  },
+
+  { "_00000000_234",
+    {11, 10, 9, 5, 4, 3, 2, 0},
+    { {"xxxxx111"_b, "unallocated"},
+      {"10011xxx"_b, "unallocated"},
+      {"xxxxxxxx"_b, "vld2_multi_post_t1"},
+    },
+  },
+
+  { "_00000000_235",
+    {3, 2, 0},
+    { {"111"_b, "unallocated"},
+      {"xxx"_b, "_00000000_236"},
+    },
+  },
+
+  { "_00000000_236",
+    {11, 10, 9, 5},
+    { {"0111"_b, "unallocated"},
+      {"xxxx"_b, "_00000000_237"},
+    },
+  },
+
+  { "_00000000_237",
+    {11, 10, 9, 8, 5, 4},
+    { {"101011"_b, "unallocated"},
+      {"xxxxxx"_b, "vld1_multi_post_t1"},
+    },
+  },
+
+  { "_00000000_238",
+    {9, 8},
+    { {"00"_b, "_00000000_239"},
+      {"01"_b, "_00000000_245"},
+      {"10"_b, "_00000000_251"},
+      {"11"_b, "_00000000_257"},
+    },
+  },
+
+  { "_00000000_239",
+    {11, 10},
+    { {"11"_b, "unallocated"},
+      {"xx"_b, "_00000000_240"},
+    },
+  },
+
+  { "_00000000_240",
+    {3, 2, 0},
+    { {"111"_b, "_00000000_241"},
+      {"xxx"_b, "_00000000_244"},
+    },
+  },
+
+  { "_00000000_241",
+    {1},
+    { {"0"_b, "_00000000_242"},
+      {"1"_b, "_00000000_243"},
+    },
+  },
+
+  { "_00000000_242",
+    {11, 10},
+    { {"11"_b, "unallocated"},
+      {"xx"_b, "vst1_lane_wb_t1"},
+    },
+  },
+
+  { "_00000000_243",
+    {11, 10},
+    { {"11"_b, "unallocated"},
+      {"xx"_b, "vst1_lane_off_t1"},
+    },
+  },
+
+  { "_00000000_244",
+    {11, 10, 3, 2, 0},
+    { {"11xxx"_b, "unallocated"},
+      {"xx111"_b, "unallocated"},
+      {"xxxxx"_b, "vst1_lane_post_t1"},
+    },
+  },
+
+  { "_00000000_245",
+    {11, 10},
+    { {"11"_b, "unallocated"},
+      {"xx"_b, "_00000000_246"},
+    },
+  },
+
+  { "_00000000_246",
+    {3, 2, 0},
+    { {"111"_b, "_00000000_247"},
+      {"xxx"_b, "_00000000_250"},
+    },
+  },
+
+  { "_00000000_247",
+    {1},
+    { {"0"_b, "_00000000_248"},
+      {"1"_b, "_00000000_249"},
+    },
+  },
+
+  { "_00000000_248",
+    {11, 10},
+    { {"11"_b, "unallocated"},
+      {"xx"_b, "vst2_lane_wb_t1"},
+    },
+  },
+
+  { "_00000000_249",
+    {11, 10},
+    { {"11"_b, "unallocated"},
+      {"xx"_b, "vst2_lane_off_t1"},
+    },
+  },
+
+  { "_00000000_250",
+    {11, 10, 3, 2, 0},
+    { {"11xxx"_b, "unallocated"},
+      {"xx111"_b, "unallocated"},
+      {"xxxxx"_b, "vst2_lane_post_t1"},
+    },
+  },
+
+  { "_00000000_251",
+    {11, 10, 5, 4},
+    { {"0001"_b, "unallocated"},
+      {"0011"_b, "unallocated"},
+      {"0101"_b, "unallocated"},
+      {"0111"_b, "unallocated"},
+      {"1001"_b, "unallocated"},
+      {"1010"_b, "unallocated"},
+      {"1011"_b, "unallocated"},
+      {"1100"_b, "unallocated"},
+      {"1101"_b, "unallocated"},
+      {"1110"_b, "unallocated"},
+      {"1111"_b, "unallocated"},
+      {"xxxx"_b, "_00000000_252"},
+    },
+  },
+
+  { "_00000000_252",
+    {3, 2, 0},
+    { {"111"_b, "_00000000_253"},
+      {"xxx"_b, "_00000000_256"},
+    },
+  },
+
+  { "_00000000_253",
+    {1},
+    { {"0"_b, "_00000000_254"},
+      {"1"_b, "_00000000_255"},
+    },
+  },
+
+  { "_00000000_254",
+    {11, 10, 5, 4},
+    { {"11xx"_b, "unallocated"},
+      {"0xx1"_b, "unallocated"},
+      {"1001"_b, "unallocated"},
+      {"1010"_b, "unallocated"},
+      {"1011"_b, "unallocated"},
+      {"xxxx"_b, "vst3_lane_wb_t1"},
+    },
+  },
+
+  { "_00000000_255",
+    {11, 10, 5, 4},
+    { {"11xx"_b, "unallocated"},
+      {"0xx1"_b, "unallocated"},
+      {"1001"_b, "unallocated"},
+      {"1010"_b, "unallocated"},
+      {"1011"_b, "unallocated"},
+      {"xxxx"_b, "vst3_lane_off_t1"},
+    },
+  },
+
+  { "_00000000_256",
+    {11, 10, 5, 4, 3, 2, 0},
+    { {"11xxxxx"_b, "unallocated"},
+      {"xxxx111"_b, "unallocated"},
+      {"0xx1xxx"_b, "unallocated"},
+      {"1001xxx"_b, "unallocated"},
+      {"1010xxx"_b, "unallocated"},
+      {"1011xxx"_b, "unallocated"},
+      {"xxxxxxx"_b, "vst3_lane_post_t1"},
+    },
+  },
+
+  { "_00000000_257",
+    {11, 10},
+    { {"11"_b, "unallocated"},
+      {"xx"_b, "_00000000_258"},
+    },
+  },
+
+  { "_00000000_258",
+    {3, 2, 0},
+    { {"111"_b, "_00000000_259"},
+      {"xxx"_b, "_00000000_262"},
+    },
+  },
+
+  { "_00000000_259",
+    {1},
+    { {"0"_b, "_00000000_260"},
+      {"1"_b, "_00000000_261"},
+    },
+  },
+
+  { "_00000000_260",
+    {11, 10},
+    { {"11"_b, "unallocated"},
+      {"xx"_b, "vst4_lane_wb_t1"},
+    },
+  },
+
+  { "_00000000_261",
+    {11, 10},
+    { {"11"_b, "unallocated"},
+      {"xx"_b, "vst4_lane_off_t1"},
+    },
+  },
+
+  { "_00000000_262",
+    {11, 10, 3, 2, 0},
+    { {"11xxx"_b, "unallocated"},
+      {"xx111"_b, "unallocated"},
+      {"xxxxx"_b, "vst4_lane_post_t1"},
+    },
+  },
+
+  { "_00000000_263",
+    {9, 8},
+    { {"00"_b, "_00000000_264"},
+      {"01"_b, "_00000000_273"},
+      {"10"_b, "_00000000_282"},
+      {"11"_b, "_00000000_292"},
+    },
+  },
+
+  { "_00000000_264",
+    {11, 10},
+    { {"11"_b, "_00000000_265"},
+      {"xx"_b, "_00000000_268"},
+    },
+  },
+
+  { "_00000000_265",
+    {3, 2, 0},
+    { {"111"_b, "_00000000_266"},
+      {"xxx"_b, "_00000000_267"},
+    },
+  },
+
+  { "_00000000_266",
+    {1},
+    { {"0"_b, "vld1_all_wb_t1"},
+      {"1"_b, "vld1_all_off_t1"},
+    },
+  },
+
+  { "_00000000_267",
+    {3, 2, 0},
+    { {"111"_b, "unallocated"},
+      {"xxx"_b, "vld1_all_post_t1"},
+    },
+  },
+
+  { "_00000000_268",
+    {3, 2, 0},
+    { {"111"_b, "_00000000_269"},
+      {"xxx"_b, "_00000000_272"},
+    },
+  },
+
+  { "_00000000_269",
+    {1},
+    { {"0"_b, "_00000000_270"},
+      {"1"_b, "_00000000_271"},
+    },
+  },
+
+  { "_00000000_270",
+    {11, 10},
+    { {"11"_b, "unallocated"},
+      {"xx"_b, "vld1_lane_wb_t1"},
+    },
+  },
+
+  { "_00000000_271",
+    {11, 10},
+    { {"11"_b, "unallocated"},
+      {"xx"_b, "vld1_lane_off_t1"},
+    },
+  },
+
+  { "_00000000_272",
+    {11, 10, 3, 2, 0},
+    { {"11xxx"_b, "unallocated"},
+      {"xx111"_b, "unallocated"},
+      {"xxxxx"_b, "vld1_lane_post_t1"},
+    },
+  },
+
+  { "_00000000_273",
+    {11, 10},
+    { {"11"_b, "_00000000_274"},
+      {"xx"_b, "_00000000_277"},
+    },
+  },
+
+  { "_00000000_274",
+    {3, 2, 0},
+    { {"111"_b, "_00000000_275"},
+      {"xxx"_b, "_00000000_276"},
+    },
+  },
+
+  { "_00000000_275",
+    {1},
+    { {"0"_b, "vld2_all_wb_t1"},
+      {"1"_b, "vld2_all_off_t1"},
+    },
+  },
+
+  { "_00000000_276",
+    {3, 2, 0},
+    { {"111"_b, "unallocated"},
+      {"xxx"_b, "vld2_all_post_t1"},
+    },
+  },
+
+  { "_00000000_277",
+    {3, 2, 0},
+    { {"111"_b, "_00000000_278"},
+      {"xxx"_b, "_00000000_281"},
+    },
+  },
+
+  { "_00000000_278",
+    {1},
+    { {"0"_b, "_00000000_279"},
+      {"1"_b, "_00000000_280"},
+    },
+  },
+
+  { "_00000000_279",
+    {11, 10},
+    { {"11"_b, "unallocated"},
+      {"xx"_b, "vld2_lane_wb_t1"},
+    },
+  },
+
+  { "_00000000_280",
+    {11, 10},
+    { {"11"_b, "unallocated"},
+      {"xx"_b, "vld2_lane_off_t1"},
+    },
+  },
+
+  { "_00000000_281",
+    {11, 10, 3, 2, 0},
+    { {"11xxx"_b, "unallocated"},
+      {"xx111"_b, "unallocated"},
+      {"xxxxx"_b, "vld2_lane_post_t1"},
+    },
+  },
+
+  { "_00000000_282",
+    {11, 10},
+    { {"11"_b, "_00000000_283"},
+      {"xx"_b, "_00000000_287"},
+    },
+  },
+
+  { "_00000000_283",
+    {4},
+    { {"0"_b, "_00000000_284"},
+      {"x"_b, "unallocated"},
+    },
+  },
+
+  { "_00000000_284",
+    {3, 2, 0},
+    { {"111"_b, "_00000000_285"},
+      {"xxx"_b, "_00000000_286"},
+    },
+  },
+
+  { "_00000000_285",
+    {1},
+    { {"0"_b, "vld3_all_wb_t1"},
+      {"1"_b, "vld3_all_off_t1"},
+    },
+  },
+
+  { "_00000000_286",
+    {3, 2, 0},
+    { {"111"_b, "unallocated"},
+      {"xxx"_b, "vld3_all_post_t1"},
+    },
+  },
+
+  { "_00000000_287",
+    {3, 2, 0},
+    { {"111"_b, "_00000000_288"},
+      {"xxx"_b, "_00000000_291"},
+    },
+  },
+
+  { "_00000000_288",
+    {1},
+    { {"0"_b, "_00000000_289"},
+      {"1"_b, "_00000000_290"},
+    },
+  },
+
+  { "_00000000_289",
+    {11, 10},
+    { {"11"_b, "unallocated"},
+      {"xx"_b, "vld3_lane_wb_t1"},
+    },
+  },
+
+  { "_00000000_290",
+    {11, 10},
+    { {"11"_b, "unallocated"},
+      {"xx"_b, "vld3_lane_off_t1"},
+    },
+  },
+
+  { "_00000000_291",
+    {11, 10, 3, 2, 0},
+    { {"11xxx"_b, "unallocated"},
+      {"xx111"_b, "unallocated"},
+      {"xxxxx"_b, "vld3_lane_post_t1"},
+    },
+  },
+
+  { "_00000000_292",
+    {11, 10},
+    { {"11"_b, "_00000000_293"},
+      {"xx"_b, "_00000000_296"},
+    },
+  },
+
+  { "_00000000_293",
+    {3, 2, 0},
+    { {"111"_b, "_00000000_294"},
+      {"xxx"_b, "_00000000_295"},
+    },
+  },
+
+  { "_00000000_294",
+    {1},
+    { {"0"_b, "vld4_all_wb_t1"},
+      {"1"_b, "vld4_all_off_t1"},
+    },
+  },
+
+  { "_00000000_295",
+    {3, 2, 0},
+    { {"111"_b, "unallocated"},
+      {"xxx"_b, "vld4_all_post_t1"},
+    },
+  },
+
+  { "_00000000_296",
+    {3, 2, 0},
+    { {"111"_b, "_00000000_297"},
+      {"xxx"_b, "_00000000_300"},
+    },
+  },
+
+  { "_00000000_297",
+    {1},
+    { {"0"_b, "_00000000_298"},
+      {"1"_b, "_00000000_299"},
+    },
+  },
+
+  { "_00000000_298",
+    {11, 10},
+    { {"11"_b, "unallocated"},
+      {"xx"_b, "vld4_lane_wb_t1"},
+    },
+  },
+
+  { "_00000000_299",
+    {11, 10},
+    { {"11"_b, "unallocated"},
+      {"xx"_b, "vld4_lane_off_t1"},
+    },
+  },
+
+  { "_00000000_300",
+    {11, 10, 3, 2, 0},
+    { {"11xxx"_b, "unallocated"},
+      {"xx111"_b, "unallocated"},
+      {"xxxxx"_b, "vld4_lane_post_t1"},
+    },
+  },
+
+  { "_00000000_301",
+    {24, 22},
+    { {"00"_b, "_00000000_302"},
+      {"01"_b, "_00000000_338"},
+      {"10"_b, "_00000000_350"},
+      {"xx"_b, "unallocated"},
+    },
+  },
+
+  { "_00000000_302",
+    {19, 18, 17, 16},
+    { {"1111"_b, "_00000000_303"},
+      {"xxxx"_b, "_00000000_307"},
+    },
+  },
+
+  { "_00000000_303",
+    {15, 14, 13, 12},
+    { {"1111"_b, "pld_lit_t1"},
+      {"xxxx"_b, "_00000000_304"},
+    },
+  },
+
+  { "_00000000_304",
+    {21},
+    { {"0"_b, "_00000000_305"},
+      {"1"_b, "_00000000_306"},
+    },
+  },
+
+  { "_00000000_305",
+    {15, 14, 13, 12},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "ldrb_lit_t1"},
+    },
+  },
+
+  { "_00000000_306",
+    {15, 14, 13, 12},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "ldrh_lit_t1"},
+    },
+  },
+
+  { "_00000000_307",
+    {23, 21},
+    { {"00"_b, "_00000000_308"},
+      {"01"_b, "_00000000_320"},
+      {"10"_b, "_00000000_332"},
+      {"11"_b, "_00000000_335"},
+    },
+  },
+
+  { "_00000000_308",
+    {11, 10, 8},
+    { {"000"_b, "_00000000_309"},
+      {"101"_b, "_00000000_313"},
+      {"110"_b, "_00000000_314"},
+      {"111"_b, "_00000000_319"},
+      {"xxx"_b, "unallocated"},
+    },
+  },
+
+  { "_00000000_309",
+    {9, 7, 6},
+    { {"000"_b, "_00000000_310"},
+      {"xxx"_b, "unallocated"},
+    },
+  },
+
+  { "_00000000_310",
+    {15, 14, 13, 12},
+    { {"1111"_b, "_00000000_311"},
+      {"xxxx"_b, "_00000000_312"},
+    },
+  },
+
+  { "_00000000_311",
+    {19, 18, 17, 16},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "pld_reg_t1"},
+    },
+  },
+
+  { "_00000000_312",
+    {19, 18, 17, 16, 15, 14, 13, 12},
+    { {"1111xxxx"_b, "unallocated"},
+      {"xxxx1111"_b, "unallocated"},
+      {"xxxxxxxx"_b, "ldrb_reg_t2"},
+    },
+  },
+
+  { "_00000000_313",
+    {19, 18, 17, 16},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "ldrb_post_t3"},
+    },
+  },
+
+  { "_00000000_314",
+    {9},
+    { {"0"_b, "_00000000_315"},
+      {"1"_b, "_00000000_318"},
+    },
+  },
+
+  { "_00000000_315",
+    {15, 14, 13, 12},
+    { {"1111"_b, "_00000000_316"},
+      {"xxxx"_b, "_00000000_317"},
+    },
+  },
+
+  { "_00000000_316",
+    {19, 18, 17, 16},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "pld_t2"},
+    },
+  },
+
+  { "_00000000_317",
+    {19, 18, 17, 16, 15, 14, 13, 12},
+    { {"1111xxxx"_b, "unallocated"},
+      {"xxxx1111"_b, "unallocated"},
+      {"xxxxxxxx"_b, "ldrb_off_t3"},
+    },
+  },
+
+  { "_00000000_318",
+    {19, 18, 17, 16},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "ldrbt_t1"},
+    },
+  },
+
+  { "_00000000_319",
+    {19, 18, 17, 16},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "ldrb_pre_t3"},
+    },
+  },
+
+  { "_00000000_320",
+    {11, 10, 8},
+    { {"000"_b, "_00000000_321"},
+      {"101"_b, "_00000000_325"},
+      {"110"_b, "_00000000_326"},
+      {"111"_b, "_00000000_331"},
+      {"xxx"_b, "unallocated"},
+    },
+  },
+
+  { "_00000000_321",
+    {9, 7, 6},
+    { {"000"_b, "_00000000_322"},
+      {"xxx"_b, "unallocated"},
+    },
+  },
+
+  { "_00000000_322",
+    {15, 14, 13, 12},
+    { {"1111"_b, "_00000000_323"},
+      {"xxxx"_b, "_00000000_324"},
+    },
+  },
+
+  { "_00000000_323",
+    {19, 18, 17, 16},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "pldw_reg_t1"},
+    },
+  },
+
+  { "_00000000_324",
+    {19, 18, 17, 16, 15, 14, 13, 12},
+    { {"1111xxxx"_b, "unallocated"},
+      {"xxxx1111"_b, "unallocated"},
+      {"xxxxxxxx"_b, "ldrh_reg_t2"},
+    },
+  },
+
+  { "_00000000_325",
+    {19, 18, 17, 16},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "ldrh_post_t3"},
+    },
+  },
+
+  { "_00000000_326",
+    {9},
+    { {"0"_b, "_00000000_327"},
+      {"1"_b, "_00000000_330"},
+    },
+  },
+
+  { "_00000000_327",
+    {15, 14, 13, 12},
+    { {"1111"_b, "_00000000_328"},
+      {"xxxx"_b, "_00000000_329"},
+    },
+  },
+
+  { "_00000000_328",
+    {19, 18, 17, 16},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "pldw_t2"},
+    },
+  },
+
+  { "_00000000_329",
+    {19, 18, 17, 16, 15, 14, 13, 12},
+    { {"1111xxxx"_b, "unallocated"},
+      {"xxxx1111"_b, "unallocated"},
+      {"xxxxxxxx"_b, "ldrh_off_t3"},
+    },
+  },
+
+  { "_00000000_330",
+    {19, 18, 17, 16},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "ldrht_t1"},
+    },
+  },
+
+  { "_00000000_331",
+    {19, 18, 17, 16},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "ldrh_pre_t3"},
+    },
+  },
+
+  { "_00000000_332",
+    {15, 14, 13, 12},
+    { {"1111"_b, "_00000000_333"},
+      {"xxxx"_b, "_00000000_334"},
+    },
+  },
+
+  { "_00000000_333",
+    {19, 18, 17, 16},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "pld_imm_t1"},
+    },
+  },
+
+  { "_00000000_334",
+    {19, 18, 17, 16, 15, 14, 13, 12},
+    { {"1111xxxx"_b, "unallocated"},
+      {"xxxx1111"_b, "unallocated"},
+      {"xxxxxxxx"_b, "ldrb_imm_t2"},
+    },
+  },
+
+  { "_00000000_335",
+    {15, 14, 13, 12},
+    { {"1111"_b, "_00000000_336"},
+      {"xxxx"_b, "_00000000_337"},
+    },
+  },
+
+  { "_00000000_336",
+    {19, 18, 17, 16},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "pldw_imm_t1"},
+    },
+  },
+
+  { "_00000000_337",
+    {19, 18, 17, 16, 15, 14, 13, 12},
+    { {"1111xxxx"_b, "unallocated"},
+      {"xxxx1111"_b, "unallocated"},
+      {"xxxxxxxx"_b, "ldrh_imm_t2"},
+    },
+  },
+
+  { "_00000000_338",
+    {21},
+    { {"0"_b, "_00000000_339"},
+      {"x"_b, "unallocated"},
+    },
+  },
+
+  { "_00000000_339",
+    {19, 18, 17, 16},
+    { {"1111"_b, "ldr_lit_t2"},
+      {"xxxx"_b, "_00000000_340"},
+    },
+  },
+
+  { "_00000000_340",
+    {23},
+    { {"0"_b, "_00000000_341"},
+      {"1"_b, "_00000000_349"},
+    },
+  },
+
+  { "_00000000_341",
+    {11, 10, 8},
+    { {"000"_b, "_00000000_342"},
+      {"101"_b, "_00000000_344"},
+      {"110"_b, "_00000000_345"},
+      {"111"_b, "_00000000_348"},
+      {"xxx"_b, "unallocated"},
+    },
+  },
+
+  { "_00000000_342",
+    {9, 7, 6},
+    { {"000"_b, "_00000000_343"},
+      {"xxx"_b, "unallocated"},
+    },
+  },
+
+  { "_00000000_343",
+    {19, 18, 17, 16},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "ldr_reg_t2"},
+    },
+  },
+
+  { "_00000000_344",
+    {19, 18, 17, 16},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "_00000000_1038"},
+    },
+  },
+
+  { "_00000000_1038",
+    {19, 18, 17, 16, 9, 7, 6, 5, 4, 3, 2, 1, 0},
+    { {"1101100000100"_b, "pop_t4"},
+      {"xxxxxxxxxxxxx"_b, "ldr_post_t4"},
+    },
+  },
+
+  { "_00000000_345",
+    {9},
+    { {"0"_b, "_00000000_346"},
+      {"1"_b, "_00000000_347"},
+    },
+  },
+
+  { "_00000000_346",
+    {19, 18, 17, 16},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "ldr_off_t4"},
+    },
+  },
+
+  { "_00000000_347",
+    {19, 18, 17, 16},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "ldrt_t1"},
+    },
+  },
+
+  { "_00000000_348",
+    {19, 18, 17, 16},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "ldr_pre_t4"},
+    },
+  },
+
+  { "_00000000_349",
+    {19, 18, 17, 16},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "ldr_t3"},
+    },
+  },
+
+  { "_00000000_350",
+    {21},
+    { {"0"_b, "_00000000_351"},
+      {"1"_b, "_00000000_370"},
+    },
+  },
+
+  { "_00000000_351",
+    {19, 18, 17, 16},
+    { {"1111"_b, "_00000000_352"},
+      {"xxxx"_b, "_00000000_354"},
+    },
+  },
+
+  { "_00000000_352",
+    {15, 14, 13, 12},
+    { {"1111"_b, "pli_t3"},
+      {"xxxx"_b, "_00000000_353"},
+    },
+  },
+
+  { "_00000000_353",
+    {15, 14, 13, 12},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "ldrsb_lit_t1"},
+    },
+  },
+
+  { "_00000000_354",
+    {23},
+    { {"0"_b, "_00000000_355"},
+      {"1"_b, "_00000000_367"},
+    },
+  },
+
+  { "_00000000_355",
+    {11, 10, 8},
+    { {"000"_b, "_00000000_356"},
+      {"101"_b, "_00000000_360"},
+      {"110"_b, "_00000000_361"},
+      {"111"_b, "_00000000_366"},
+      {"xxx"_b, "unallocated"},
+    },
+  },
+
+  { "_00000000_356",
+    {9, 7, 6},
+    { {"000"_b, "_00000000_357"},
+      {"xxx"_b, "unallocated"},
+    },
+  },
+
+  { "_00000000_357",
+    {15, 14, 13, 12},
+    { {"1111"_b, "_00000000_358"},
+      {"xxxx"_b, "_00000000_359"},
+    },
+  },
+
+  { "_00000000_358",
+    {19, 18, 17, 16},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "pli_reg_t1"},
+    },
+  },
+
+  { "_00000000_359",
+    {19, 18, 17, 16, 15, 14, 13, 12},
+    { {"1111xxxx"_b, "unallocated"},
+      {"xxxx1111"_b, "unallocated"},
+      {"xxxxxxxx"_b, "ldrsb_reg_t2"},
+    },
+  },
+
+  { "_00000000_360",
+    {19, 18, 17, 16},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "ldrsb_imm_post_t2"},
+    },
+  },
+
+  { "_00000000_361",
+    {9},
+    { {"0"_b, "_00000000_362"},
+      {"1"_b, "_00000000_365"},
+    },
+  },
+
+  { "_00000000_362",
+    {15, 14, 13, 12},
+    { {"1111"_b, "_00000000_363"},
+      {"xxxx"_b, "_00000000_364"},
+    },
+  },
+
+  { "_00000000_363",
+    {19, 18, 17, 16},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "pli_t2"},
+    },
+  },
+
+  { "_00000000_364",
+    {19, 18, 17, 16, 15, 14, 13, 12},
+    { {"1111xxxx"_b, "unallocated"},
+      {"xxxx1111"_b, "unallocated"},
+      {"xxxxxxxx"_b, "ldrsb_imm_off_t2"},
+    },
+  },
+
+  { "_00000000_365",
+    {19, 18, 17, 16},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "ldrsbt_t1"},
+    },
+  },
+
+  { "_00000000_366",
+    {19, 18, 17, 16},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "ldrsb_imm_pre_t2"},
+    },
+  },
+
+  { "_00000000_367",
+    {15, 14, 13, 12},
+    { {"1111"_b, "_00000000_368"},
+      {"xxxx"_b, "_00000000_369"},
+    },
+  },
+
+  { "_00000000_368",
+    {19, 18, 17, 16},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "pli_imm_t1"},
+    },
+  },
+
+  { "_00000000_369",
+    {19, 18, 17, 16, 15, 14, 13, 12},
+    { {"1111xxxx"_b, "unallocated"},
+      {"xxxx1111"_b, "unallocated"},
+      {"xxxxxxxx"_b, "ldrsb_imm_t1"},
+    },
+  },
+
+  { "_00000000_370",
+    {19, 18, 17, 16},
+    { {"1111"_b, "_00000000_371"},
+      {"xxxx"_b, "_00000000_372"},
+    },
+  },
+
+  { "_00000000_371",
+    {15, 14, 13, 12},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "ldrsh_lit_t1"},
+    },
+  },
+
+  { "_00000000_372",
+    {23},
+    { {"0"_b, "_00000000_373"},
+      {"1"_b, "_00000000_381"},
+    },
+  },
+
+  { "_00000000_373",
+    {11, 10, 8},
+    { {"000"_b, "_00000000_374"},
+      {"101"_b, "_00000000_376"},
+      {"110"_b, "_00000000_377"},
+      {"111"_b, "_00000000_380"},
+      {"xxx"_b, "unallocated"},
+    },
+  },
+
+  { "_00000000_374",
+    {9, 7, 6},
+    { {"000"_b, "_00000000_375"},
+      {"xxx"_b, "unallocated"},
+    },
+  },
+
+  { "_00000000_375",
+    {19, 18, 17, 16, 15, 14, 13, 12},
+    { {"1111xxxx"_b, "unallocated"},
+      {"xxxx1111"_b, "unallocated"},
+      {"xxxxxxxx"_b, "ldrsh_reg_t2"},
+    },
+  },
+
+  { "_00000000_376",
+    {19, 18, 17, 16},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "ldrsh_imm_post_t2"},
+    },
+  },
+
+  { "_00000000_377",
+    {9},
+    { {"0"_b, "_00000000_378"},
+      {"1"_b, "_00000000_379"},
+    },
+  },
+
+  { "_00000000_378",
+    {19, 18, 17, 16, 15, 14, 13, 12},
+    { {"1111xxxx"_b, "unallocated"},
+      {"xxxx1111"_b, "unallocated"},
+      {"xxxxxxxx"_b, "ldrsh_imm_off_t2"},
+    },
+  },
+
+  { "_00000000_379",
+    {19, 18, 17, 16},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "ldrsht_t1"},
+    },
+  },
+
+  { "_00000000_380",
+    {19, 18, 17, 16},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "ldrsh_imm_pre_t2"},
+    },
+  },
+
+  { "_00000000_381",
+    {19, 18, 17, 16, 15, 14, 13, 12},
+    { {"1111xxxx"_b, "unallocated"},
+      {"xxxx1111"_b, "unallocated"},
+      {"xxxxxxxx"_b, "ldrsh_imm_t1"},
+    },
+  },
+
+  { "_00000000_382",
+    {28, 24, 23, 20},
+    { {"0000"_b, "_00000000_383"},
+      {"0001"_b, "_00000000_408"},
+      {"0010"_b, "_00000000_438"},
+      {"0011"_b, "_00000000_442"},
+      {"0100"_b, "_00000000_450"},
+      {"0101"_b, "_00000000_462"},
+      {"0110"_b, "_00000000_480"},
+      {"0111"_b, "_00000000_490"},
+      {"1000"_b, "_00000000_506"},
+      {"1001"_b, "_00000000_519"},
+      {"1010"_b, "_00000000_532"},
+      {"1011"_b, "_00000000_533"},
+      {"1100"_b, "_00000000_534"},
+      {"1101"_b, "_00000000_545"},
+      {"1110"_b, "_00000000_564"},
+      {"1111"_b, "_00000000_565"},
+    },
+  },
+
+  { "_00000000_383",
+    {22, 21},
+    { {"00"_b, "_00000000_384"},
+      {"01"_b, "_00000000_386"},
+      {"10"_b, "_00000000_388"},
+      {"11"_b, "_00000000_401"},
+    },
+  },
+
+  { "_00000000_384",
+    {14, 13, 12, 7, 6, 5, 4},
+    { {"0000011"_b, "and_rrx_t2"},
+      {"xxxxxxx"_b, "_00000000_385"},
+    },
+  },
+
+  { "_00000000_385",
+    {14, 13, 12, 7, 6, 5, 4},
+    { {"0000011"_b, "unallocated"},
+      {"xxxxxxx"_b, "and_reg_t2"},
+    },
+  },
+
+  { "_00000000_386",
+    {14, 13, 12, 7, 6, 5, 4},
+    { {"0000011"_b, "bic_rrx_t2"},
+      {"xxxxxxx"_b, "_00000000_387"},
+    },
+  },
+
+  { "_00000000_387",
+    {14, 13, 12, 7, 6, 5, 4},
+    { {"0000011"_b, "unallocated"},
+      {"xxxxxxx"_b, "bic_reg_t2"},
+    },
+  },
+
+  { "_00000000_388",
+    {19, 18, 17, 16},
+    { {"1111"_b, "_00000000_389"},
+      {"xxxx"_b, "_00000000_397"},
+    },
+  },
+
+  { "_00000000_389",
+    {14, 13, 12, 7, 6, 5, 4},
+    { {"0000011"_b, "rrx_t3"},
+      {"xxxxxxx"_b, "_00000000_390"},
+    },
+  },
+
+  { "_00000000_390",
+    {14, 13, 12, 7, 6, 5, 4},
+    { {"0000011"_b, "unallocated"},
+      {"xxxxxxx"_b, "_00000000_391"},
+    },
+  },
+
+  { "_00000000_391",
+    {5, 4},
+    { {"10"_b, "asr_t3"},
+      {"xx"_b, "_00000000_392"},
+    },
+  },
+
+  { "_00000000_392",
+    {5, 4},
+    { {"00"_b, "_00000000_393"},
+      {"xx"_b, "_00000000_394"},
+    },
+  },
+
+  { "_00000000_393",
+    {14, 13, 12, 7, 6},
+    { {"00000"_b, "_00000000_394"},
+      {"xxxxx"_b, "lsl_t3"},
+    },
+  },
+
+  { "_00000000_394",
+    {5, 4},
+    { {"01"_b, "lsr_t3"},
+      {"xx"_b, "_00000000_395"},
+    },
+  },
+
+  { "_00000000_395",
+    {5, 4},
+    { {"11"_b, "_00000000_396"},
+      {"xx"_b, "mov_reg_t3"},
+    },
+  },
+
+  { "_00000000_396",
+    {14, 13, 12, 7, 6},
+    { {"00000"_b, "mov_reg_t3"},
+      {"xxxxx"_b, "ror_t3"},
+    },
+  },
+
+  { "_00000000_397",
+    {14, 13, 12, 7, 6, 5, 4},
+    { {"0000011"_b, "_00000000_398"},
+      {"xxxxxxx"_b, "_00000000_399"},
+    },
+  },
+
+  { "_00000000_398",
+    {19, 18, 17, 16},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "orr_rrx_t2"},
+    },
+  },
+
+  { "_00000000_399",
+    {19, 18, 17, 16},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "_00000000_400"},
+    },
+  },
+
+  { "_00000000_400",
+    {14, 13, 12, 7, 6, 5, 4},
+    { {"0000011"_b, "unallocated"},
+      {"xxxxxxx"_b, "orr_reg_t2"},
+    },
+  },
+
+  { "_00000000_401",
+    {19, 18, 17, 16},
+    { {"1111"_b, "_00000000_402"},
+      {"xxxx"_b, "_00000000_404"},
+    },
+  },
+
+  { "_00000000_402",
+    {14, 13, 12, 7, 6, 5, 4},
+    { {"0000011"_b, "mvn_rrx_t2"},
+      {"xxxxxxx"_b, "_00000000_403"},
+    },
+  },
+
+  { "_00000000_403",
+    {14, 13, 12, 7, 6, 5, 4},
+    { {"0000011"_b, "unallocated"},
+      {"xxxxxxx"_b, "mvn_reg_t2"},
+    },
+  },
+
+  { "_00000000_404",
+    {14, 13, 12, 7, 6, 5, 4},
+    { {"0000011"_b, "_00000000_405"},
+      {"xxxxxxx"_b, "_00000000_406"},
+    },
+  },
+
+  { "_00000000_405",
+    {19, 18, 17, 16},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "orn_rrx_t1"},
+    },
+  },
+
+  { "_00000000_406",
+    {19, 18, 17, 16},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "_00000000_407"},
+    },
+  },
+
+  { "_00000000_407",
+    {14, 13, 12, 7, 6, 5, 4},
+    { {"0000011"_b, "unallocated"},
+      {"xxxxxxx"_b, "orn_reg_t1"},
+    },
+  },
+
+  { "_00000000_408",
+    {22, 21},
+    { {"00"_b, "_00000000_409"},
+      {"01"_b, "_00000000_416"},
+      {"10"_b, "_00000000_418"},
+      {"11"_b, "_00000000_431"},
+    },
+  },
+
+  { "_00000000_409",
+    {11, 10, 9, 8},
+    { {"1111"_b, "_00000000_410"},
+      {"xxxx"_b, "_00000000_412"},
+    },
+  },
+
+  { "_00000000_410",
+    {14, 13, 12, 7, 6, 5, 4},
+    { {"0000011"_b, "tst_rrx_t2"},
+      {"xxxxxxx"_b, "_00000000_411"},
+    },
+  },
+
+  { "_00000000_411",
+    {14, 13, 12, 7, 6, 5, 4},
+    { {"0000011"_b, "unallocated"},
+      {"xxxxxxx"_b, "tst_reg_t2"},
+    },
+  },
+
+  { "_00000000_412",
+    {14, 13, 12, 7, 6, 5, 4},
+    { {"0000011"_b, "_00000000_413"},
+      {"xxxxxxx"_b, "_00000000_414"},
+    },
+  },
+
+  { "_00000000_413",
+    {11, 10, 9, 8},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "ands_rrx_t2"},
+    },
+  },
+
+  { "_00000000_414",
+    {14, 13, 12, 7, 6, 5, 4},
+    { {"0000011"_b, "unallocated"},
+      {"xxxxxxx"_b, "_00000000_415"},
+    },
+  },
+
+  { "_00000000_415",
+    {11, 10, 9, 8},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "ands_reg_t2"},
+    },
+  },
+
+  { "_00000000_416",
+    {14, 13, 12, 7, 6, 5, 4},
+    { {"0000011"_b, "bics_rrx_t2"},
+      {"xxxxxxx"_b, "_00000000_417"},
+    },
+  },
+
+  { "_00000000_417",
+    {14, 13, 12, 7, 6, 5, 4},
+    { {"0000011"_b, "unallocated"},
+      {"xxxxxxx"_b, "bics_reg_t2"},
+    },
+  },
+
+  { "_00000000_418",
+    {19, 18, 17, 16},
+    { {"1111"_b, "_00000000_419"},
+      {"xxxx"_b, "_00000000_427"},
+    },
+  },
+
+  { "_00000000_419",
+    {14, 13, 12, 7, 6, 5, 4},
+    { {"0000011"_b, "rrxs_t3"},
+      {"xxxxxxx"_b, "_00000000_420"},
+    },
+  },
+
+  { "_00000000_420",
+    {14, 13, 12, 7, 6, 5, 4},
+    { {"0000011"_b, "unallocated"},
+      {"xxxxxxx"_b, "_00000000_421"},
+    },
+  },
+
+  { "_00000000_421",
+    {5, 4},
+    { {"10"_b, "asrs_t3"},
+      {"xx"_b, "_00000000_422"},
+    },
+  },
+
+  { "_00000000_422",
+    {5, 4},
+    { {"00"_b, "_00000000_423"},
+      {"xx"_b, "_00000000_424"},
+    },
+  },
+
+  { "_00000000_423",
+    {14, 13, 12, 7, 6},
+    { {"00000"_b, "_00000000_424"},
+      {"xxxxx"_b, "lsls_t3"},
+    },
+  },
+
+  { "_00000000_424",
+    {5, 4},
+    { {"01"_b, "lsrs_t3"},
+      {"xx"_b, "_00000000_425"},
+    },
+  },
+
+  { "_00000000_425",
+    {5, 4},
+    { {"11"_b, "_00000000_426"},
+      {"xx"_b, "movs_t3"},
+    },
+  },
+
+  { "_00000000_426",
+    {14, 13, 12, 7, 6},
+    { {"00000"_b, "movs_t3"},
+      {"xxxxx"_b, "rors_t3"},
+    },
+  },
+
+  { "_00000000_427",
+    {14, 13, 12, 7, 6, 5, 4},
+    { {"0000011"_b, "_00000000_428"},
+      {"xxxxxxx"_b, "_00000000_429"},
+    },
+  },
+
+  { "_00000000_428",
+    {19, 18, 17, 16},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "orrs_rrx_t2"},
+    },
+  },
+
+  { "_00000000_429",
+    {19, 18, 17, 16},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "_00000000_430"},
+    },
+  },
+
+  { "_00000000_430",
+    {14, 13, 12, 7, 6, 5, 4},
+    { {"0000011"_b, "unallocated"},
+      {"xxxxxxx"_b, "orrs_reg_t2"},
+    },
+  },
+
+  { "_00000000_431",
+    {19, 18, 17, 16},
+    { {"1111"_b, "_00000000_432"},
+      {"xxxx"_b, "_00000000_434"},
+    },
+  },
+
+  { "_00000000_432",
+    {14, 13, 12, 7, 6, 5, 4},
+    { {"0000011"_b, "mvns_rrx_t2"},
+      {"xxxxxxx"_b, "_00000000_433"},
+    },
+  },
+
+  { "_00000000_433",
+    {14, 13, 12, 7, 6, 5, 4},
+    { {"0000011"_b, "unallocated"},
+      {"xxxxxxx"_b, "mvns_reg_t2"},
+    },
+  },
+
+  { "_00000000_434",
+    {14, 13, 12, 7, 6, 5, 4},
+    { {"0000011"_b, "_00000000_435"},
+      {"xxxxxxx"_b, "_00000000_436"},
+    },
+  },
+
+  { "_00000000_435",
+    {19, 18, 17, 16},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "orns_rrx_t1"},
+    },
+  },
+
+  { "_00000000_436",
+    {19, 18, 17, 16},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "_00000000_437"},
+    },
+  },
+
+  { "_00000000_437",
+    {14, 13, 12, 7, 6, 5, 4},
+    { {"0000011"_b, "unallocated"},
+      {"xxxxxxx"_b, "orns_reg_t1"},
+    },
+  },
+
+  { "_00000000_438",
+    {22, 21},
+    { {"00"_b, "_00000000_439"},
+      {"10"_b, "_00000000_441"},
+      {"xx"_b, "unallocated"},
+    },
+  },
+
+  { "_00000000_439",
+    {14, 13, 12, 7, 6, 5, 4},
+    { {"0000011"_b, "eor_rrx_t2"},
+      {"xxxxxxx"_b, "_00000000_440"},
+    },
+  },
+
+  { "_00000000_440",
+    {14, 13, 12, 7, 6, 5, 4},
+    { {"0000011"_b, "unallocated"},
+      {"xxxxxxx"_b, "eor_reg_t2"},
+    },
+  },
+
+  { "_00000000_441",
+    {5, 4},
+    { {"00"_b, "pkhbt_t1"},
+      {"10"_b, "pkhtb_t1"},
+      {"xx"_b, "unallocated"},
+    },
+  },
+
+  { "_00000000_442",
+    {22, 21},
+    { {"00"_b, "_00000000_443"},
+      {"xx"_b, "unallocated"},
+    },
+  },
+
+  { "_00000000_443",
+    {11, 10, 9, 8},
+    { {"1111"_b, "_00000000_444"},
+      {"xxxx"_b, "_00000000_446"},
+    },
+  },
+
+  { "_00000000_444",
+    {14, 13, 12, 7, 6, 5, 4},
+    { {"0000011"_b, "teq_rrx_t1"},
+      {"xxxxxxx"_b, "_00000000_445"},
+    },
+  },
+
+  { "_00000000_445",
+    {14, 13, 12, 7, 6, 5, 4},
+    { {"0000011"_b, "unallocated"},
+      {"xxxxxxx"_b, "teq_reg_t1"},
+    },
+  },
+
+  { "_00000000_446",
+    {14, 13, 12, 7, 6, 5, 4},
+    { {"0000011"_b, "_00000000_447"},
+      {"xxxxxxx"_b, "_00000000_448"},
+    },
+  },
+
+  { "_00000000_447",
+    {11, 10, 9, 8},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "eors_rrx_t2"},
+    },
+  },
+
+  { "_00000000_448",
+    {14, 13, 12, 7, 6, 5, 4},
+    { {"0000011"_b, "unallocated"},
+      {"xxxxxxx"_b, "_00000000_449"},
+    },
+  },
+
+  { "_00000000_449",
+    {11, 10, 9, 8},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "eors_reg_t2"},
+    },
+  },
+
+  { "_00000000_450",
+    {22, 21},
+    { {"00"_b, "_00000000_451"},
+      {"10"_b, "_00000000_458"},
+      {"11"_b, "_00000000_460"},
+      {"xx"_b, "unallocated"},
+    },
+  },
+
+  { "_00000000_451",
+    {19, 18, 17, 16},
+    { {"1101"_b, "_00000000_452"},
+      {"xxxx"_b, "_00000000_454"},
+    },
+  },
+
+  { "_00000000_452",
+    {14, 13, 12, 7, 6, 5, 4},
+    { {"0000011"_b, "add_sp_rrx_t3"},
+      {"xxxxxxx"_b, "_00000000_453"},
+    },
+  },
+
+  { "_00000000_453",
+    {14, 13, 12, 7, 6, 5, 4},
+    { {"0000011"_b, "unallocated"},
+      {"xxxxxxx"_b, "add_sp_reg_t3"},
+    },
+  },
+
+  { "_00000000_454",
+    {14, 13, 12, 7, 6, 5, 4},
+    { {"0000011"_b, "_00000000_455"},
+      {"xxxxxxx"_b, "_00000000_456"},
+    },
+  },
+
+  { "_00000000_455",
+    {19, 18, 17, 16},
+    { {"1101"_b, "unallocated"},
+      {"xxxx"_b, "add_rrx_t3"},
+    },
+  },
+
+  { "_00000000_456",
+    {19, 18, 17, 16},
+    { {"1101"_b, "unallocated"},
+      {"xxxx"_b, "_00000000_457"},
+    },
+  },
+
+  { "_00000000_457",
+    {14, 13, 12, 7, 6, 5, 4},
+    { {"0000011"_b, "unallocated"},
+      {"xxxxxxx"_b, "add_reg_t3"},
+    },
+  },
+
+  { "_00000000_458",
+    {14, 13, 12, 7, 6, 5, 4},
+    { {"0000011"_b, "adc_rrx_t2"},
+      {"xxxxxxx"_b, "_00000000_459"},
+    },
+  },
+
+  { "_00000000_459",
+    {14, 13, 12, 7, 6, 5, 4},
+    { {"0000011"_b, "unallocated"},
+      {"xxxxxxx"_b, "adc_reg_t2"},
+    },
+  },
+
+  { "_00000000_460",
+    {14, 13, 12, 7, 6, 5, 4},
+    { {"0000011"_b, "sbc_rrx_t2"},
+      {"xxxxxxx"_b, "_00000000_461"},
+    },
+  },
+
+  { "_00000000_461",
+    {14, 13, 12, 7, 6, 5, 4},
+    { {"0000011"_b, "unallocated"},
+      {"xxxxxxx"_b, "sbc_reg_t2"},
+    },
+  },
+
+  { "_00000000_462",
+    {22, 21},
+    { {"00"_b, "_00000000_463"},
+      {"10"_b, "_00000000_476"},
+      {"11"_b, "_00000000_478"},
+      {"xx"_b, "unallocated"},
+    },
+  },
+
+  { "_00000000_463",
+    {11, 10, 9, 8},
+    { {"1111"_b, "_00000000_464"},
+      {"xxxx"_b, "_00000000_466"},
+    },
+  },
+
+  { "_00000000_464",
+    {14, 13, 12, 7, 6, 5, 4},
+    { {"0000011"_b, "cmn_rrx_t2"},
+      {"xxxxxxx"_b, "_00000000_465"},
+    },
+  },
+
+  { "_00000000_465",
+    {14, 13, 12, 7, 6, 5, 4},
+    { {"0000011"_b, "unallocated"},
+      {"xxxxxxx"_b, "cmn_reg_t2"},
+    },
+  },
+
+  { "_00000000_466",
+    {19, 18, 17, 16},
+    { {"1101"_b, "_00000000_467"},
+      {"xxxx"_b, "_00000000_471"},
+    },
+  },
+
+  { "_00000000_467",
+    {14, 13, 12, 7, 6, 5, 4},
+    { {"0000011"_b, "_00000000_468"},
+      {"xxxxxxx"_b, "_00000000_469"},
+    },
+  },
+
+  { "_00000000_468",
+    {11, 10, 9, 8},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "adds_sp_rrx_t3"},
+    },
+  },
+
+  { "_00000000_469",
+    {14, 13, 12, 7, 6, 5, 4},
+    { {"0000011"_b, "unallocated"},
+      {"xxxxxxx"_b, "_00000000_470"},
+    },
+  },
+
+  { "_00000000_470",
+    {11, 10, 9, 8},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "adds_sp_reg_t3"},
+    },
+  },
+
+  { "_00000000_471",
+    {14, 13, 12, 7, 6, 5, 4},
+    { {"0000011"_b, "_00000000_472"},
+      {"xxxxxxx"_b, "_00000000_473"},
+    },
+  },
+
+  { "_00000000_472",
+    {19, 18, 17, 16, 11, 10, 9, 8},
+    { {"1101xxxx"_b, "unallocated"},
+      {"xxxx1111"_b, "unallocated"},
+      {"xxxxxxxx"_b, "adds_rrx_t3"},
+    },
+  },
+
+  { "_00000000_473",
+    {19, 18, 17, 16},
+    { {"1101"_b, "unallocated"},
+      {"xxxx"_b, "_00000000_474"},
+    },
+  },
+
+  { "_00000000_474",
+    {14, 13, 12, 7, 6, 5, 4},
+    { {"0000011"_b, "unallocated"},
+      {"xxxxxxx"_b, "_00000000_475"},
+    },
+  },
+
+  { "_00000000_475",
+    {11, 10, 9, 8},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "adds_reg_t3"},
+    },
+  },
+
+  { "_00000000_476",
+    {14, 13, 12, 7, 6, 5, 4},
+    { {"0000011"_b, "adcs_rrx_t2"},
+      {"xxxxxxx"_b, "_00000000_477"},
+    },
+  },
+
+  { "_00000000_477",
+    {14, 13, 12, 7, 6, 5, 4},
+    { {"0000011"_b, "unallocated"},
+      {"xxxxxxx"_b, "adcs_reg_t2"},
+    },
+  },
+
+  { "_00000000_478",
+    {14, 13, 12, 7, 6, 5, 4},
+    { {"0000011"_b, "sbcs_rrx_t2"},
+      {"xxxxxxx"_b, "_00000000_479"},
+    },
+  },
+
+  { "_00000000_479",
+    {14, 13, 12, 7, 6, 5, 4},
+    { {"0000011"_b, "unallocated"},
+      {"xxxxxxx"_b, "sbcs_reg_t2"},
+    },
+  },
+
+  { "_00000000_480",
+    {22, 21},
+    { {"01"_b, "_00000000_481"},
+      {"10"_b, "_00000000_488"},
+      {"xx"_b, "unallocated"},
+    },
+  },
+
+  { "_00000000_481",
+    {19, 18, 17, 16},
+    { {"1101"_b, "_00000000_482"},
+      {"xxxx"_b, "_00000000_484"},
+    },
+  },
+
+  { "_00000000_482",
+    {14, 13, 12, 7, 6, 5, 4},
+    { {"0000011"_b, "sub_sp_rrx_t1"},
+      {"xxxxxxx"_b, "_00000000_483"},
+    },
+  },
+
+  { "_00000000_483",
+    {14, 13, 12, 7, 6, 5, 4},
+    { {"0000011"_b, "unallocated"},
+      {"xxxxxxx"_b, "sub_sp_reg_t1"},
+    },
+  },
+
+  { "_00000000_484",
+    {14, 13, 12, 7, 6, 5, 4},
+    { {"0000011"_b, "_00000000_485"},
+      {"xxxxxxx"_b, "_00000000_486"},
+    },
+  },
+
+  { "_00000000_485",
+    {19, 18, 17, 16},
+    { {"1101"_b, "unallocated"},
+      {"xxxx"_b, "sub_rrx_t2"},
+    },
+  },
+
+  { "_00000000_486",
+    {19, 18, 17, 16},
+    { {"1101"_b, "unallocated"},
+      {"xxxx"_b, "_00000000_487"},
+    },
+  },
+
+  { "_00000000_487",
+    {14, 13, 12, 7, 6, 5, 4},
+    { {"0000011"_b, "unallocated"},
+      {"xxxxxxx"_b, "sub_reg_t2"},
+    },
+  },
+
+  { "_00000000_488",
+    {14, 13, 12, 7, 6, 5, 4},
+    { {"0000011"_b, "rsb_rrx_t1"},
+      {"xxxxxxx"_b, "_00000000_489"},
+    },
+  },
+
+  { "_00000000_489",
+    {14, 13, 12, 7, 6, 5, 4},
+    { {"0000011"_b, "unallocated"},
+      {"xxxxxxx"_b, "rsb_reg_t1"},
+    },
+  },
+
+  { "_00000000_490",
+    {22, 21},
+    { {"01"_b, "_00000000_491"},
+      {"10"_b, "_00000000_504"},
+      {"xx"_b, "unallocated"},
+    },
+  },
+
+  { "_00000000_491",
+    {11, 10, 9, 8},
+    { {"1111"_b, "_00000000_492"},
+      {"xxxx"_b, "_00000000_494"},
+    },
+  },
+
+  { "_00000000_492",
+    {14, 13, 12, 7, 6, 5, 4},
+    { {"0000011"_b, "cmp_rrx_t3"},
+      {"xxxxxxx"_b, "_00000000_493"},
+    },
+  },
+
+  { "_00000000_493",
+    {14, 13, 12, 7, 6, 5, 4},
+    { {"0000011"_b, "unallocated"},
+      {"xxxxxxx"_b, "cmp_reg_t3"},
+    },
+  },
+
+  { "_00000000_494",
+    {19, 18, 17, 16},
+    { {"1101"_b, "_00000000_495"},
+      {"xxxx"_b, "_00000000_499"},
+    },
+  },
+
+  { "_00000000_495",
+    {14, 13, 12, 7, 6, 5, 4},
+    { {"0000011"_b, "_00000000_496"},
+      {"xxxxxxx"_b, "_00000000_497"},
+    },
+  },
+
+  { "_00000000_496",
+    {11, 10, 9, 8},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "subs_rrx_t1"},
+    },
+  },
+
+  { "_00000000_497",
+    {14, 13, 12, 7, 6, 5, 4},
+    { {"0000011"_b, "unallocated"},
+      {"xxxxxxx"_b, "_00000000_498"},
+    },
+  },
+
+  { "_00000000_498",
+    {11, 10, 9, 8},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "subs_reg_t1"},
+    },
+  },
+
+  { "_00000000_499",
+    {14, 13, 12, 7, 6, 5, 4},
+    { {"0000011"_b, "_00000000_500"},
+      {"xxxxxxx"_b, "_00000000_501"},
+    },
+  },
+
+  { "_00000000_500",
+    {19, 18, 17, 16, 11, 10, 9, 8},
+    { {"1101xxxx"_b, "unallocated"},
+      {"xxxx1111"_b, "unallocated"},
+      {"xxxxxxxx"_b, "subs_rrx_t2"},
+    },
+  },
+
+  { "_00000000_501",
+    {19, 18, 17, 16},
+    { {"1101"_b, "unallocated"},
+      {"xxxx"_b, "_00000000_502"},
+    },
+  },
+
+  { "_00000000_502",
+    {14, 13, 12, 7, 6, 5, 4},
+    { {"0000011"_b, "unallocated"},
+      {"xxxxxxx"_b, "_00000000_503"},
+    },
+  },
+
+  { "_00000000_503",
+    {11, 10, 9, 8},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "subs_reg_t2"},
+    },
+  },
+
+  { "_00000000_504",
+    {14, 13, 12, 7, 6, 5, 4},
+    { {"0000011"_b, "rsbs_rrx_t1"},
+      {"xxxxxxx"_b, "_00000000_505"},
+    },
+  },
+
+  { "_00000000_505",
+    {14, 13, 12, 7, 6, 5, 4},
+    { {"0000011"_b, "unallocated"},
+      {"xxxxxxx"_b, "rsbs_reg_t1"},
+    },
+  },
+
+  { "_00000000_506",
+    {15, 14, 13, 12, 7},
+    { {"11110"_b, "_00000000_507"},
+      {"11111"_b, "_00000000_512"},
+      {"xxxxx"_b, "unallocated"},
+    },
+  },
+
+  { "_00000000_507",
+    {6, 5, 4},
+    { {"000"_b, "_00000000_508"},
+      {"xxx"_b, "unallocated"},
+    },
+  },
+
+  { "_00000000_508",
+    {22, 21},
+    { {"10"_b, "asr_reg_t2"},
+      {"xx"_b, "_00000000_509"},
+    },
+  },
+
+  { "_00000000_509",
+    {22, 21},
+    { {"00"_b, "lsl_reg_t2"},
+      {"xx"_b, "_00000000_510"},
+    },
+  },
+
+  { "_00000000_510",
+    {22, 21},
+    { {"01"_b, "lsr_reg_t2"},
+      {"xx"_b, "_00000000_511"},
+    },
+  },
+
+  { "_00000000_511",
+    {22, 21},
+    { {"11"_b, "ror_t2"},
+      {"xx"_b, "mov_rsr_t2"},
+    },
+  },
+
+  { "_00000000_512",
+    {22, 21},
+    { {"00"_b, "_00000000_513"},
+      {"01"_b, "_00000000_515"},
+      {"10"_b, "_00000000_517"},
+      {"xx"_b, "unallocated"},
+    },
+  },
+
+  { "_00000000_513",
+    {19, 18, 17, 16},
+    { {"1111"_b, "sxth_t2"},
+      {"xxxx"_b, "_00000000_514"},
+    },
+  },
+
+  { "_00000000_514",
+    {19, 18, 17, 16},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "sxtah_t1"},
+    },
+  },
+
+  { "_00000000_515",
+    {19, 18, 17, 16},
+    { {"1111"_b, "sxtb16_t1"},
+      {"xxxx"_b, "_00000000_516"},
+    },
+  },
+
+  { "_00000000_516",
+    {19, 18, 17, 16},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "sxtab16_t1"},
+    },
+  },
+
+  { "_00000000_517",
+    {19, 18, 17, 16},
+    { {"1111"_b, "sxtb_t2"},
+      {"xxxx"_b, "_00000000_518"},
+    },
+  },
+
+  { "_00000000_518",
+    {19, 18, 17, 16},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "sxtab_t1"},
+    },
+  },
+
+  { "_00000000_519",
+    {15, 14, 13, 12, 7},
+    { {"11110"_b, "_00000000_520"},
+      {"11111"_b, "_00000000_525"},
+      {"xxxxx"_b, "unallocated"},
+    },
+  },
+
+  { "_00000000_520",
+    {6, 5, 4},
+    { {"000"_b, "_00000000_521"},
+      {"xxx"_b, "unallocated"},
+    },
+  },
+
+  { "_00000000_521",
+    {22, 21},
+    { {"10"_b, "asrs_t2"},
+      {"xx"_b, "_00000000_522"},
+    },
+  },
+
+  { "_00000000_522",
+    {22, 21},
+    { {"00"_b, "lsls_t2"},
+      {"xx"_b, "_00000000_523"},
+    },
+  },
+
+  { "_00000000_523",
+    {22, 21},
+    { {"01"_b, "lsrs_t2"},
+      {"xx"_b, "_00000000_524"},
+    },
+  },
+
+  { "_00000000_524",
+    {22, 21},
+    { {"11"_b, "rors_t2"},
+      {"xx"_b, "movs_rsr_t2"},
+    },
+  },
+
+  { "_00000000_525",
+    {22, 21},
+    { {"00"_b, "_00000000_526"},
+      {"01"_b, "_00000000_528"},
+      {"10"_b, "_00000000_530"},
+      {"xx"_b, "unallocated"},
+    },
+  },
+
+  { "_00000000_526",
+    {19, 18, 17, 16},
+    { {"1111"_b, "uxth_t2"},
+      {"xxxx"_b, "_00000000_527"},
+    },
+  },
+
+  { "_00000000_527",
+    {19, 18, 17, 16},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "uxtah_t1"},
+    },
+  },
+
+  { "_00000000_528",
+    {19, 18, 17, 16},
+    { {"1111"_b, "uxtb16_t1"},
+      {"xxxx"_b, "_00000000_529"},
+    },
+  },
+
+  { "_00000000_529",
+    {19, 18, 17, 16},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "uxtab16_t1"},
+    },
+  },
+
+  { "_00000000_530",
+    {19, 18, 17, 16},
+    { {"1111"_b, "uxtb_t2"},
+      {"xxxx"_b, "_00000000_531"},
+    },
+  },
+
+  { "_00000000_531",
+    {19, 18, 17, 16},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "uxtab_t1"},
+    },
+  },
+
+  { "_00000000_532",
+    {22, 21, 15, 14, 13, 12, 7, 6, 5, 4},
+    { {"0011110000"_b, "sadd8_t1"},
+      {"0011110001"_b, "qadd8_t1"},
+      {"0011110010"_b, "shadd8_t1"},
+      {"0011110100"_b, "uadd8_t1"},
+      {"0011110101"_b, "uqadd8_t1"},
+      {"0011110110"_b, "uhadd8_t1"},
+      {"0011111000"_b, "qadd_t1"},
+      {"0011111001"_b, "qdadd_t1"},
+      {"0011111010"_b, "qsub_t1"},
+      {"0011111011"_b, "qdsub_t1"},
+      {"0111110000"_b, "sasx_t1"},
+      {"0111110001"_b, "qasx_t1"},
+      {"0111110010"_b, "shasx_t1"},
+      {"0111110100"_b, "uasx_t1"},
+      {"0111110101"_b, "uqasx_t1"},
+      {"0111110110"_b, "uhasx_t1"},
+      {"0111111000"_b, "sel_t1"},
+      {"1011110000"_b, "ssub8_t1"},
+      {"1011110001"_b, "qsub8_t1"},
+      {"1011110010"_b, "shsub8_t1"},
+      {"1011110100"_b, "usub8_t1"},
+      {"1011110101"_b, "uqsub8_t1"},
+      {"1011110110"_b, "uhsub8_t1"},
+      {"1011111000"_b, "crc32b_t1"},
+      {"1011111001"_b, "crc32h_t1"},
+      {"1011111010"_b, "crc32w_t1"},
+      {"1111110000"_b, "ssax_t1"},
+      {"1111110001"_b, "qsax_t1"},
+      {"1111110010"_b, "shsax_t1"},
+      {"1111110100"_b, "usax_t1"},
+      {"1111110101"_b, "uqsax_t1"},
+      {"1111110110"_b, "uhsax_t1"},
+      {"xxxxxxxxxx"_b, "unallocated"},
+    },
+  },
+
+  { "_00000000_533",
+    {22, 21, 15, 14, 13, 12, 7, 6, 5, 4},
+    { {"0011110000"_b, "sadd16_t1"},
+      {"0011110001"_b, "qadd16_t1"},
+      {"0011110010"_b, "shadd16_t1"},
+      {"0011110100"_b, "uadd16_t1"},
+      {"0011110101"_b, "uqadd16_t1"},
+      {"0011110110"_b, "uhadd16_t1"},
+      {"0011111000"_b, "rev_t2"},
+      {"0011111001"_b, "rev16_t2"},
+      {"0011111010"_b, "rbit_t1"},
+      {"0011111011"_b, "revsh_t2"},
+      {"0111111000"_b, "clz_t1"},
+      {"1011110000"_b, "ssub16_t1"},
+      {"1011110001"_b, "qsub16_t1"},
+      {"1011110010"_b, "shsub16_t1"},
+      {"1011110100"_b, "usub16_t1"},
+      {"1011110101"_b, "uqsub16_t1"},
+      {"1011110110"_b, "uhsub16_t1"},
+      {"1011111000"_b, "crc32cb_t1"},
+      {"1011111001"_b, "crc32ch_t1"},
+      {"1011111010"_b, "crc32cw_t1"},
+      {"xxxxxxxxxx"_b, "unallocated"},
+    },
+  },
+
+  { "_00000000_534",
+    {22, 21, 7, 6, 5, 4},
+    { {"000000"_b, "_00000000_535"},
+      {"000001"_b, "mls_t1"},
+      {"010000"_b, "_00000000_537"},
+      {"010001"_b, "_00000000_539"},
+      {"100000"_b, "_00000000_541"},
+      {"100001"_b, "_00000000_543"},
+      {"110000"_b, "smmls_t1"},
+      {"110001"_b, "smmlsr_t1"},
+      {"xxxxxx"_b, "unallocated"},
+    },
+  },
+
+  { "_00000000_535",
+    {15, 14, 13, 12},
+    { {"1111"_b, "mul_t2"},
+      {"xxxx"_b, "_00000000_536"},
+    },
+  },
+
+  { "_00000000_536",
+    {15, 14, 13, 12},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "mla_t1"},
+    },
+  },
+
+  { "_00000000_537",
+    {15, 14, 13, 12},
+    { {"1111"_b, "smuad_t1"},
+      {"xxxx"_b, "_00000000_538"},
+    },
+  },
+
+  { "_00000000_538",
+    {15, 14, 13, 12},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "smlad_t1"},
+    },
+  },
+
+  { "_00000000_539",
+    {15, 14, 13, 12},
+    { {"1111"_b, "smuadx_t1"},
+      {"xxxx"_b, "_00000000_540"},
+    },
+  },
+
+  { "_00000000_540",
+    {15, 14, 13, 12},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "smladx_t1"},
+    },
+  },
+
+  { "_00000000_541",
+    {15, 14, 13, 12},
+    { {"1111"_b, "smusd_t1"},
+      {"xxxx"_b, "_00000000_542"},
+    },
+  },
+
+  { "_00000000_542",
+    {15, 14, 13, 12},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "smlsd_t1"},
+    },
+  },
+
+  { "_00000000_543",
+    {15, 14, 13, 12},
+    { {"1111"_b, "smusdx_t1"},
+      {"xxxx"_b, "_00000000_544"},
+    },
+  },
+
+  { "_00000000_544",
+    {15, 14, 13, 12},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "smlsdx_t1"},
+    },
+  },
+
+  { "_00000000_545",
+    {22, 21, 7, 6, 5, 4},
+    { {"000000"_b, "_00000000_546"},
+      {"000001"_b, "_00000000_548"},
+      {"000010"_b, "_00000000_550"},
+      {"000011"_b, "_00000000_552"},
+      {"010000"_b, "_00000000_554"},
+      {"010001"_b, "_00000000_556"},
+      {"100000"_b, "_00000000_558"},
+      {"100001"_b, "_00000000_560"},
+      {"110000"_b, "_00000000_562"},
+      {"xxxxxx"_b, "unallocated"},
+    },
+  },
+
+  { "_00000000_546",
+    {15, 14, 13, 12},
+    { {"1111"_b, "smulbb_t1"},
+      {"xxxx"_b, "_00000000_547"},
+    },
+  },
+
+  { "_00000000_547",
+    {15, 14, 13, 12},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "smlabb_t1"},
+    },
+  },
+
+  { "_00000000_548",
+    {15, 14, 13, 12},
+    { {"1111"_b, "smulbt_t1"},
+      {"xxxx"_b, "_00000000_549"},
+    },
+  },
+
+  { "_00000000_549",
+    {15, 14, 13, 12},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "smlabt_t1"},
+    },
+  },
+
+  { "_00000000_550",
+    {15, 14, 13, 12},
+    { {"1111"_b, "smultb_t1"},
+      {"xxxx"_b, "_00000000_551"},
+    },
+  },
+
+  { "_00000000_551",
+    {15, 14, 13, 12},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "smlatb_t1"},
+    },
+  },
+
+  { "_00000000_552",
+    {15, 14, 13, 12},
+    { {"1111"_b, "smultt_t1"},
+      {"xxxx"_b, "_00000000_553"},
+    },
+  },
+
+  { "_00000000_553",
+    {15, 14, 13, 12},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "smlatt_t1"},
+    },
+  },
+
+  { "_00000000_554",
+    {15, 14, 13, 12},
+    { {"1111"_b, "smulwb_t1"},
+      {"xxxx"_b, "_00000000_555"},
+    },
+  },
+
+  { "_00000000_555",
+    {15, 14, 13, 12},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "smlawb_t1"},
+    },
+  },
+
+  { "_00000000_556",
+    {15, 14, 13, 12},
+    { {"1111"_b, "smulwt_t1"},
+      {"xxxx"_b, "_00000000_557"},
+    },
+  },
+
+  { "_00000000_557",
+    {15, 14, 13, 12},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "smlawt_t1"},
+    },
+  },
+
+  { "_00000000_558",
+    {15, 14, 13, 12},
+    { {"1111"_b, "smmul_t1"},
+      {"xxxx"_b, "_00000000_559"},
+    },
+  },
+
+  { "_00000000_559",
+    {15, 14, 13, 12},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "smmla_t1"},
+    },
+  },
+
+  { "_00000000_560",
+    {15, 14, 13, 12},
+    { {"1111"_b, "smmulr_t1"},
+      {"xxxx"_b, "_00000000_561"},
+    },
+  },
+
+  { "_00000000_561",
+    {15, 14, 13, 12},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "smmlar_t1"},
+    },
+  },
+
+  { "_00000000_562",
+    {15, 14, 13, 12},
+    { {"1111"_b, "usad8_t1"},
+      {"xxxx"_b, "_00000000_563"},
+    },
+  },
+
+  { "_00000000_563",
+    {15, 14, 13, 12},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "usada8_t1"},
+    },
+  },
+
+  { "_00000000_564",
+    {22, 21, 7, 6, 5, 4},
+    { {"000000"_b, "smull_t1"},
+      {"010000"_b, "umull_t1"},
+      {"100000"_b, "smlal_t1"},
+      {"101000"_b, "smlalbb_t1"},
+      {"101001"_b, "smlalbt_t1"},
+      {"101010"_b, "smlaltb_t1"},
+      {"101011"_b, "smlaltt_t1"},
+      {"101100"_b, "smlald_t1"},
+      {"101101"_b, "smlaldx_t1"},
+      {"110000"_b, "umlal_t1"},
+      {"110110"_b, "umaal_t1"},
+      {"xxxxxx"_b, "unallocated"},
+    },
+  },
+
+  { "_00000000_565",
+    {22, 21, 7, 6, 5, 4},
+    { {"001111"_b, "sdiv_t1"},
+      {"011111"_b, "udiv_t1"},
+      {"101100"_b, "smlsld_t1"},
+      {"101101"_b, "smlsldx_t1"},
+      {"xxxxxx"_b, "unallocated"},
+    },
+  },
+
+  { "_00000000_566",
+    {28, 24, 20, 11, 10, 9},
+    { {"000101"_b, "_00000000_567"},
+      {"000111"_b, "_00000000_571"},
+      {"001101"_b, "_00000000_575"},
+      {"001111"_b, "_00000000_581"},
+      {"010101"_b, "_00000000_587"},
+      {"010111"_b, "_00000000_592"},
+      {"011101"_b, "_00000000_593"},
+      {"011111"_b, "_00000000_600"},
+      {"xxxxxx"_b, "unallocated"},
+    },
+  },
+
+  { "_00000000_567",
+    {23, 8},
+    { {"00"_b, "_00000000_568"},
+      {"01"_b, "_00000000_569"},
+      {"10"_b, "vstm_t2"},
+      {"11"_b, "_00000000_570"},
+    },
+  },
+
+  { "_00000000_568",
+    {22, 21, 7, 6, 4},
+    { {"10001"_b, "vmov_ss_rr_t1"},
+      {"xxxxx"_b, "unallocated"},
+    },
+  },
+
+  { "_00000000_569",
+    {22, 21, 7, 6, 4},
+    { {"10001"_b, "vmov_d_rr_t1"},
+      {"xxxxx"_b, "unallocated"},
+    },
+  },
+
+  { "_00000000_570",
+    {0},
+    { {"0"_b, "vstm_t1"},
+      {"1"_b, "fstmiax_t1"},
+    },
+  },
+
+  { "_00000000_571",
+    {22, 21},
+    { {"00"_b, "_00000000_572"},
+      {"01"_b, "_00000000_573"},
+      {"10"_b, "_00000000_574"},
+      {"xx"_b, "unallocated"},
+    },
+  },
+
+  { "_00000000_572",
+    {23, 15, 14, 13, 12, 8},
+    { {"101010"_b, "stc_t1"},
+      {"xxxxxx"_b, "unallocated"},
+    },
+  },
+
+  { "_00000000_573",
+    {15, 14, 13, 12, 8},
+    { {"01010"_b, "stc_t1"},
+      {"xxxxx"_b, "unallocated"},
+    },
+  },
+
+  { "_00000000_574",
+    {23},
+    { {"0"_b, "mcrr_t1"},
+      {"x"_b, "unallocated"},
+    },
+  },
+
+  { "_00000000_575",
+    {23, 8},
+    { {"00"_b, "_00000000_576"},
+      {"01"_b, "_00000000_577"},
+      {"10"_b, "_00000000_578"},
+      {"11"_b, "_00000000_579"},
+    },
+  },
+
+  { "_00000000_576",
+    {22, 21, 7, 6, 4},
+    { {"10001"_b, "vmov_rr_ss_t1"},
+      {"xxxxx"_b, "unallocated"},
+    },
+  },
+
+  { "_00000000_577",
+    {22, 21, 7, 6, 4},
+    { {"10001"_b, "vmov_rr_d_t1"},
+      {"xxxxx"_b, "unallocated"},
+    },
+  },
+
+  { "_00000000_578",
+    {21, 19, 18, 17, 16},
+    { {"11101"_b, "vpop_t2"},
+      {"xxxxx"_b, "vldm_t2"},
+    },
+  },
+
+  { "_00000000_579",
+    {0},
+    { {"0"_b, "_00000000_580"},
+      {"1"_b, "fldmiax_t1"},
+    },
+  },
+
+  { "_00000000_580",
+    {21, 19, 18, 17, 16},
+    { {"11101"_b, "vpop_t1"},
+      {"xxxxx"_b, "vldm_t1"},
+    },
+  },
+
+  { "_00000000_581",
+    {22, 21},
+    { {"00"_b, "_00000000_582"},
+      {"01"_b, "_00000000_584"},
+      {"10"_b, "_00000000_586"},
+      {"xx"_b, "unallocated"},
+    },
+  },
+
+  { "_00000000_582",
+    {23, 15, 14, 13, 12, 8},
+    { {"101010"_b, "_00000000_583"},
+      {"xxxxxx"_b, "unallocated"},
+    },
+  },
+
+  { "_00000000_583",
+    {19, 18, 17, 16},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "ldc_imm_t1"},
+    },
+  },
+
+  { "_00000000_584",
+    {15, 14, 13, 12, 8},
+    { {"01010"_b, "_00000000_585"},
+      {"xxxxx"_b, "unallocated"},
+    },
+  },
+
+  { "_00000000_585",
+    {19, 18, 17, 16},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "ldc_imm_t1"},
+    },
+  },
+
+  { "_00000000_586",
+    {23},
+    { {"0"_b, "mrrc_t1"},
+      {"x"_b, "unallocated"},
+    },
+  },
+
+  { "_00000000_587",
+    {21, 8},
+    { {"00"_b, "vstr_t2"},
+      {"01"_b, "vstr_t1"},
+      {"10"_b, "_00000000_588"},
+      {"11"_b, "_00000000_590"},
+    },
+  },
+
+  { "_00000000_588",
+    {23},
+    { {"0"_b, "_00000000_589"},
+      {"x"_b, "unallocated"},
+    },
+  },
+
+  { "_00000000_589",
+    {19, 18, 17, 16},
+    { {"1101"_b, "vpush_t2"},
+      {"xxxx"_b, "vstmdb_t2"},
+    },
+  },
+
+  { "_00000000_590",
+    {23, 0},
+    { {"00"_b, "_00000000_591"},
+      {"01"_b, "fstmdbx_t1"},
+      {"xx"_b, "unallocated"},
+    },
+  },
+
+  { "_00000000_591",
+    {19, 18, 17, 16},
+    { {"1101"_b, "vpush_t1"},
+      {"xxxx"_b, "vstmdb_t1"},
+    },
+  },
+
+  { "_00000000_592",
+    {22, 21, 15, 14, 13, 12, 8},
+    { {"0001010"_b, "stc_t1"},
+      {"0101010"_b, "stc_t1"},
+      {"xxxxxxx"_b, "unallocated"},
+    },
+  },
+
+  { "_00000000_593",
+    {21, 8},
+    { {"00"_b, "_00000000_594"},
+      {"01"_b, "_00000000_596"},
+      {"10"_b, "_00000000_598"},
+      {"11"_b, "_00000000_599"},
+    },
+  },
+
+  { "_00000000_594",
+    {19, 18, 17, 16},
+    { {"1111"_b, "vldr_lit_t2"},
+      {"xxxx"_b, "_00000000_595"},
+    },
+  },
+
+  { "_00000000_595",
+    {19, 18, 17, 16},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "vldr_imm_t2"},
+    },
+  },
+
+  { "_00000000_596",
+    {19, 18, 17, 16},
+    { {"1111"_b, "vldr_lit_t1"},
+      {"xxxx"_b, "_00000000_597"},
+    },
+  },
+
+  { "_00000000_597",
+    {19, 18, 17, 16},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "vldr_imm_t1"},
+    },
+  },
+
+  { "_00000000_598",
+    {23},
+    { {"0"_b, "vldmdb_t2"},
+      {"x"_b, "unallocated"},
+    },
+  },
+
+  { "_00000000_599",
+    {23, 0},
+    { {"00"_b, "vldmdb_t1"},
+      {"01"_b, "fldmdbx_t1"},
+      {"xx"_b, "unallocated"},
+    },
+  },
+
+  { "_00000000_600",
+    {22, 21, 15, 14, 13, 12, 8},
+    { {"0001010"_b, "_00000000_601"},
+      {"0101010"_b, "_00000000_603"},
+      {"xxxxxxx"_b, "unallocated"},
+    },
+  },
+
+  { "_00000000_601",
+    {19, 18, 17, 16},
+    { {"1111"_b, "ldc_lit_t1"},
+      {"xxxx"_b, "_00000000_602"},
+    },
+  },
+
+  { "_00000000_602",
+    {19, 18, 17, 16},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "ldc_imm_t1"},
+    },
+  },
+
+  { "_00000000_603",
+    {19, 18, 17, 16},
+    { {"1111"_b, "unallocated"},
+      {"xxxx"_b, "ldc_imm_t1"},
+    },
+  },
+
+  { "_00000000_604",
+    {24, 4},
+    { {"00"_b, "_00000000_605"},
+      {"01"_b, "_00000000_630"},
+      {"10"_b, "_00000000_637"},
+      {"11"_b, "_00000000_764"},
+    },
+  },
+
+  { "_00000000_605",
+    {28, 23, 21, 20, 11, 10, 9, 8, 6},
+    { {"000010100"_b, "vmla_f32_t2"},
+      {"000010101"_b, "vmls_f32_t2"},
+      {"000010110"_b, "vmla_f64_t2"},
+      {"000010111"_b, "vmls_f64_t2"},
+      {"000110100"_b, "vnmls_f32_t1"},
+      {"000110101"_b, "vnmla_f32_t1"},
+      {"000110110"_b, "vnmls_f64_t1"},
+      {"000110111"_b, "vnmla_f64_t1"},
+      {"001010100"_b, "vmul_f32_t2"},
+      {"001010101"_b, "vnmul_f32_t1"},
+      {"001010110"_b, "vmul_f64_t2"},
+      {"001010111"_b, "vnmul_f64_t1"},
+      {"001110100"_b, "vadd_f32_t2"},
+      {"001110101"_b, "vsub_f32_t2"},
+      {"001110110"_b, "vadd_f64_t2"},
+      {"001110111"_b, "vsub_f64_t2"},
+      {"010010100"_b, "vdiv_f32_t1"},
+      {"010010110"_b, "vdiv_f64_t1"},
+      {"010110100"_b, "vfnms_f32_t1"},
+      {"010110101"_b, "vfnma_f32_t1"},
+      {"010110110"_b, "vfnms_f64_t1"},
+      {"010110111"_b, "vfnma_f64_t1"},
+      {"011010100"_b, "vfma_f32_t2"},
+      {"011010101"_b, "vfms_f32_t2"},
+      {"011010110"_b, "vfma_f64_t2"},
+      {"011010111"_b, "vfms_f64_t2"},
+      {"011110100"_b, "vmov_imm_f32_t2"},
+      {"011110101"_b, "_00000000_606"},
+      {"011110110"_b, "vmov_imm_f64_t2"},
+      {"011110111"_b, "_00000000_613"},
+      {"100010100"_b, "vseleq_f32_t1"},
+      {"100010110"_b, "vseleq_f64_t1"},
+      {"100110100"_b, "vselvs_f32_t1"},
+      {"100110110"_b, "vselvs_f64_t1"},
+      {"101010100"_b, "vselge_f32_t1"},
+      {"101010110"_b, "vselge_f64_t1"},
+      {"101110100"_b, "vselgt_f32_t1"},
+      {"101110110"_b, "vselgt_f64_t1"},
+      {"110010100"_b, "vmaxnm_f32_t2"},
+      {"110010101"_b, "vminnm_f32_t2"},
+      {"110010110"_b, "vmaxnm_f64_t2"},
+      {"110010111"_b, "vminnm_f64_t2"},
+      {"111110101"_b, "_00000000_620"},
+      {"111110111"_b, "_00000000_625"},
+      {"xxxxxxxxx"_b, "unallocated"},
+    },
+  },
+
+  { "_00000000_606",
+    {19, 18, 17},
+    { {"000"_b, "_00000000_607"},
+      {"001"_b, "_00000000_608"},
+      {"010"_b, "_00000000_609"},
+      {"011"_b, "_00000000_610"},
+      {"100"_b, "_00000000_611"},
+      {"101"_b, "vcvt_f32_fx_t1"},
+      {"110"_b, "_00000000_612"},
+      {"111"_b, "vcvt_fx_f32_t1"},
+    },
+  },
+
+  { "_00000000_607",
+    {16, 7},
+    { {"00"_b, "vmov_f32_t2"},
+      {"01"_b, "vabs_f32_t2"},
+      {"10"_b, "vneg_f32_t2"},
+      {"11"_b, "vsqrt_f32_t1"},
+    },
+  },
+
+  { "_00000000_608",
+    {16, 7},
+    { {"00"_b, "vcvtb_f32_f16_t1"},
+      {"01"_b, "vcvtt_f32_f16_t1"},
+      {"10"_b, "vcvtb_f16_f32_t1"},
+      {"11"_b, "vcvtt_f16_f32_t1"},
+    },
+  },
+
+  { "_00000000_609",
+    {16, 7},
+    { {"00"_b, "vcmp_f32_t1"},
+      {"01"_b, "vcmpe_f32_t1"},
+      {"10"_b, "vcmp_f32_t2"},
+      {"11"_b, "vcmpe_f32_t2"},
+    },
+  },
+
+  { "_00000000_610",
+    {16, 7},
+    { {"00"_b, "vrintr_f32_t1"},
+      {"01"_b, "vrintz_f32_t1"},
+      {"10"_b, "vrintx_f32_t1"},
+      {"11"_b, "vcvt_f64_f32_t1"},
+    },
+  },
+
+  { "_00000000_611",
+    {16},
+    { {"0"_b, "vcvt_f32_int_t1"},
+      {"x"_b, "unallocated"},
+    },
+  },
+
+  { "_00000000_612",
+    {16, 7},
+    { {"00"_b, "vcvtr_u32_f32_t1"},
+      {"01"_b, "vcvt_u32_f32_t1"},
+      {"10"_b, "vcvtr_s32_f32_t1"},
+      {"11"_b, "vcvt_s32_f32_t1"},
+    },
+  },
+
+  { "_00000000_613",
+    {19, 18, 17},
+    { {"000"_b, "_00000000_614"},
+      {"001"_b, "_00000000_615"},
+      {"010"_b, "_00000000_616"},
+      {"011"_b, "_00000000_617"},
+      {"100"_b, "_00000000_618"},
+      {"101"_b, "vcvt_f64_fx_t1"},
+      {"110"_b, "_00000000_619"},
+      {"111"_b, "vcvt_fx_f64_t1"},
+    },
+  },
+
+  { "_00000000_614",
+    {16, 7},
+    { {"00"_b, "vmov_f64_t2"},
+      {"01"_b, "vabs_f64_t2"},
+      {"10"_b, "vneg_f64_t2"},
+      {"11"_b, "vsqrt_f64_t1"},
+    },
+  },
+
+  { "_00000000_615",
+    {16, 7},
+    { {"00"_b, "vcvtb_f64_f16_t1"},
+      {"01"_b, "vcvtt_f64_f16_t1"},
+      {"10"_b, "vcvtb_f16_f64_t1"},
+      {"11"_b, "vcvtt_f16_f64_t1"},
+    },
+  },
+
+  { "_00000000_616",
+    {16, 7},
+    { {"00"_b, "vcmp_f64_t1"},
+      {"01"_b, "vcmpe_f64_t1"},
+      {"10"_b, "vcmp_f64_t2"},
+      {"11"_b, "vcmpe_f64_t2"},
+    },
+  },
+
+  { "_00000000_617",
+    {16, 7},
+    { {"00"_b, "vrintr_f64_t1"},
+      {"01"_b, "vrintz_f64_t1"},
+      {"10"_b, "vrintx_f64_t1"},
+      {"11"_b, "vcvt_f32_f64_t1"},
+    },
+  },
+
+  { "_00000000_618",
+    {16},
+    { {"0"_b, "vcvt_f64_int_t1"},
+      {"x"_b, "unallocated"},
+    },
+  },
+
+  { "_00000000_619",
+    {16, 7},
+    { {"00"_b, "vcvtr_u32_f64_t1"},
+      {"01"_b, "vcvt_u32_f64_t1"},
+      {"10"_b, "vcvtr_s32_f64_t1"},
+      {"11"_b, "vcvt_s32_f64_t1"},
+    },
+  },
+
+  { "_00000000_620",
+    {19, 18, 17, 16},
+    { {"1000"_b, "_00000000_621"},
+      {"1001"_b, "_00000000_622"},
+      {"1010"_b, "_00000000_623"},
+      {"1011"_b, "_00000000_624"},
+      {"1100"_b, "vcvta_int_f32_s_t1"},
+      {"1101"_b, "vcvtn_int_f32_s_t1"},
+      {"1110"_b, "vcvtp_int_f32_s_t1"},
+      {"1111"_b, "vcvtm_int_f32_s_t1"},
+      {"xxxx"_b, "unallocated"},
+    },
+  },
+
+  { "_00000000_621",
+    {7},
+    { {"0"_b, "vrinta_f32_t1"},
+      {"x"_b, "unallocated"},
+    },
+  },
+
+  { "_00000000_622",
+    {7},
+    { {"0"_b, "vrintn_f32_t1"},
+      {"x"_b, "unallocated"},
+    },
+  },
+
+  { "_00000000_623",
+    {7},
+    { {"0"_b, "vrintp_f32_t1"},
+      {"x"_b, "unallocated"},
+    },
+  },
+
+  { "_00000000_624",
+    {7},
+    { {"0"_b, "vrintm_f32_t1"},
+      {"x"_b, "unallocated"},
+    },
+  },
+
+  { "_00000000_625",
+    {19, 18, 17, 16},
+    { {"1000"_b, "_00000000_626"},
+      {"1001"_b, "_00000000_627"},
+      {"1010"_b, "_00000000_628"},
+      {"1011"_b, "_00000000_629"},
+      {"1100"_b, "vcvta_int_f64_t1"},
+      {"1101"_b, "vcvtn_int_f64_t1"},
+      {"1110"_b, "vcvtp_int_f64_t1"},
+      {"1111"_b, "vcvtm_int_f64_t1"},
+      {"xxxx"_b, "unallocated"},
+    },
+  },
+
+  { "_00000000_626",
+    {7},
+    { {"0"_b, "vrinta_f64_t1"},
+      {"x"_b, "unallocated"},
+    },
+  },
+
+  { "_00000000_627",
+    {7},
+    { {"0"_b, "vrintn_f64_t1"},
+      {"x"_b, "unallocated"},
+    },
+  },
+
+  { "_00000000_628",
+    {7},
+    { {"0"_b, "vrintp_f64_t1"},
+      {"x"_b, "unallocated"},
+    },
+  },
+
+  { "_00000000_629",
+    {7},
+    { {"0"_b, "vrintm_f64_t1"},
+      {"x"_b, "unallocated"},
+    },
+  },
+
+  { "_00000000_630",
+    {28, 20, 11, 10, 9},
+    { {"00101"_b, "_00000000_631"},
+      {"00111"_b, "mcr_t1"},
+      {"01101"_b, "_00000000_635"},
+      {"01111"_b, "mrc_t1"},
+      {"xxxxx"_b, "unallocated"},
+    },
+  },
+
+  { "_00000000_631",
+    {23, 8},
+    { {"00"_b, "_00000000_632"},
+      {"01"_b, "vmov_scalar_r_t1"},
+      {"10"_b, "_00000000_633"},
+      {"11"_b, "_00000000_634"},
+    },
+  },
+
+  { "_00000000_632",
+    {22, 21},
+    { {"00"_b, "vmov_s_r_t1"},
+      {"xx"_b, "unallocated"},
+    },
+  },
+
+  { "_00000000_633",
+    {22, 21},
+    { {"11"_b, "vmsr_t1"},
+      {"xx"_b, "unallocated"},
+    },
+  },
+
+  { "_00000000_634",
+    {21, 6},
+    { {"00"_b, "vdup_d_t1"},
+      {"10"_b, "_00000000_1039"},
+      {"xx"_b, "unallocated"},
+    },
+  },
+
+  { "_00000000_1039",
+    {16},
+    { {"0"_b, "vdup_q_t1"},
+    },
+  },
+
+  { "_00000000_635",
+    {8},
+    { {"0"_b, "_00000000_636"},
+      {"1"_b, "vmov_r_scalar_t1"},
+    },
+  },
+
+  { "_00000000_636",
+    {23, 22, 21},
+    { {"000"_b, "vmov_r_s_t1"},
+      {"111"_b, "vmrs_t1"},
+      {"xxx"_b, "unallocated"},
+    },
+  },
+
+  { "_00000000_637",
+    {23},
+    { {"0"_b, "_00000000_638"},
+      {"1"_b, "_00000000_663"},
+    },
+  },
+
+  { "_00000000_638",
+    {11, 10, 9, 8, 6},
+    { {"00000"_b, "vhadd_d_t1"},
+      {"00001"_b, "_00000000_1040"},
+      {"00010"_b, "vrhadd_d_t1"},
+      {"00011"_b, "_00000000_1041"},
+      {"00100"_b, "vhsub_d_t1"},
+      {"00101"_b, "_00000000_1042"},
+      {"00110"_b, "vcgt_d_t1"},
+      {"00111"_b, "_00000000_1043"},
+      {"01000"_b, "vshl_d_t1"},
+      {"01001"_b, "_00000000_1044"},
+      {"01010"_b, "vrshl_d_t1"},
+      {"01011"_b, "_00000000_1045"},
+      {"01100"_b, "vmax_d_t1"},
+      {"01101"_b, "_00000000_1046"},
+      {"01110"_b, "vabd_d_t1"},
+      {"01111"_b, "_00000000_1047"},
+      {"10000"_b, "_00000000_639"},
+      {"10001"_b, "_00000000_640"},
+      {"10010"_b, "_00000000_641"},
+      {"10011"_b, "_00000000_642"},
+      {"10100"_b, "vpmax_t1"},
+      {"10110"_b, "_00000000_643"},
+      {"10111"_b, "_00000000_644"},
+      {"11001"_b, "_00000000_645"},
+      {"11010"_b, "_00000000_646"},
+      {"11011"_b, "_00000000_647"},
+      {"11100"_b, "_00000000_651"},
+      {"11101"_b, "_00000000_654"},
+      {"11110"_b, "_00000000_659"},
+      {"11111"_b, "_00000000_660"},
+      {"xxxxx"_b, "unallocated"},
+    },
+  },
+
+  { "_00000000_1040",
+    {16, 12, 0},
+    { {"000"_b, "vhadd_q_t1"},
+    },
+  },
+
+  { "_00000000_1041",
+    {16, 12, 0},
+    { {"000"_b, "vrhadd_q_t1"},
+    },
+  },
+
+  { "_00000000_1042",
+    {16, 12, 0},
+    { {"000"_b, "vhsub_q_t1"},
+    },
+  },
+
+  { "_00000000_1043",
+    {16, 12, 0},
+    { {"000"_b, "vcgt_q_t1"},
+    },
+  },
+
+  { "_00000000_1044",
+    {16, 12, 0},
+    { {"000"_b, "vshl_q_t1"},
+    },
+  },
+
+  { "_00000000_1045",
+    {16, 12, 0},
+    { {"000"_b, "vrshl_q_t1"},
+    },
+  },
+
+  { "_00000000_1046",
+    {16, 12, 0},
+    { {"000"_b, "vmax_q_t1"},
+    },
+  },
+
+  { "_00000000_1047",
+    {16, 12, 0},
+    { {"000"_b, "vabd_q_t1"},
+    },
+  },
+
+  { "_00000000_639",
+    {28},
+    { {"0"_b, "vadd_d_t1"},
+      {"1"_b, "vsub_d_t1"},
+    },
+  },
+
+  { "_00000000_640",
+    {28},
+    { {"0"_b, "_00000000_1048"},
+      {"1"_b, "_00000000_1049"},
+    },
+  },
+
+  { "_00000000_1048",
+    {16, 12, 0},
+    { {"000"_b, "vadd_q_t1"},
+    },
+  },
+
+  { "_00000000_1049",
+    {16, 12, 0},
+    { {"000"_b, "vsub_q_t1"},
+    },
+  },
+
+  { "_00000000_641",
+    {28},
+    { {"0"_b, "vmla_d_t1"},
+      {"1"_b, "vmls_d_t1"},
+    },
+  },
+
+  { "_00000000_642",
+    {28},
+    { {"0"_b, "_00000000_1050"},
+      {"1"_b, "_00000000_1051"},
+    },
+  },
+
+  { "_00000000_1050",
+    {16, 12, 0},
+    { {"000"_b, "vmla_q_t1"},
+    },
+  },
+
+  { "_00000000_1051",
+    {16, 12, 0},
+    { {"000"_b, "vmls_q_t1"},
+    },
+  },
+
+  { "_00000000_643",
+    {28},
+    { {"0"_b, "vqdmulh_d_t1"},
+      {"1"_b, "vqrdmulh_d_t1"},
+    },
+  },
+
+  { "_00000000_644",
+    {28},
+    { {"0"_b, "_00000000_1052"},
+      {"1"_b, "_00000000_1053"},
+    },
+  },
+
+  { "_00000000_1052",
+    {16, 12, 0},
+    { {"000"_b, "vqdmulh_q_t1"},
+    },
+  },
+
+  { "_00000000_1053",
+    {16, 12, 0},
+    { {"000"_b, "vqrdmulh_q_t1"},
+    },
+  },
+
+  { "_00000000_645",
+    {28, 21, 20},
+    { {"000"_b, "sha1c_t1"},
+      {"001"_b, "sha1p_t1"},
+      {"010"_b, "sha1m_t1"},
+      {"011"_b, "sha1su0_t1"},
+      {"100"_b, "sha256h_t1"},
+      {"101"_b, "sha256h2_t1"},
+      {"110"_b, "sha256su1_t1"},
+      {"xxx"_b, "unallocated"},
+    },
+  },
+
+  { "_00000000_646",
+    {28, 21, 20},
+    { {"000"_b, "vadd_f32_d_t1"},
+      {"010"_b, "vsub_f32_d_t1"},
+      {"100"_b, "vpadd_f32_t1"},
+      {"110"_b, "vabd_f32_d_t1"},
+      {"xxx"_b, "unallocated"},
+    },
+  },
+
+  { "_00000000_647",
+    {28, 21, 20},
+    { {"000"_b, "_00000000_648"},
+      {"010"_b, "_00000000_649"},
+      {"110"_b, "_00000000_650"},
+      {"xxx"_b, "unallocated"},
+    },
+  },
+
+  { "_00000000_648",
+    {12},
+    { {"0"_b, "_00000000_1054"},
+      {"x"_b, "unallocated"},
+    },
+  },
+
+  { "_00000000_1054",
+    {16, 0},
+    { {"00"_b, "vadd_f32_q_t1"},
+    },
+  },
+
+  { "_00000000_649",
+    {12},
+    { {"0"_b, "_00000000_1055"},
+      {"x"_b, "unallocated"},
+    },
+  },
+
+  { "_00000000_1055",
+    {16, 0},
+    { {"00"_b, "vsub_f32_q_t1"},
+    },
+  },
+
+  { "_00000000_650",
+    {12},
+    { {"0"_b, "_00000000_1056"},
+      {"x"_b, "unallocated"},
+    },
+  },
+
+  { "_00000000_1056",
+    {16, 0},
+    { {"00"_b, "vabd_f32_q_t1"},
+    },
+  },
+
+  { "_00000000_651",
+    {28, 21},
+    { {"00"_b, "vceq_d_t2"},
+      {"10"_b, "_00000000_652"},
+      {"11"_b, "_00000000_653"},
+      {"xx"_b, "unallocated"},
+    },
+  },
+
+  { "_00000000_652",
+    {20},
+    { {"0"_b, "vcge_d_t2"},
+      {"x"_b, "unallocated"},
+    },
+  },
+
+  { "_00000000_653",
+    {20},
+    { {"0"_b, "vcgt_d_t2"},
+      {"x"_b, "unallocated"},
+    },
+  },
+
+  { "_00000000_654",
+    {28, 21},
+    { {"00"_b, "_00000000_1057"},
+      {"10"_b, "_00000000_655"},
+      {"11"_b, "_00000000_657"},
+      {"xx"_b, "unallocated"},
+    },
+  },
+
+  { "_00000000_1057",
+    {16, 12, 0},
+    { {"000"_b, "vceq_q_t2"},
+    },
+  },
+
+  { "_00000000_655",
+    {20},
+    { {"0"_b, "_00000000_656"},
+      {"x"_b, "unallocated"},
+    },
+  },
+
+  { "_00000000_656",
+    {12},
+    { {"0"_b, "_00000000_1058"},
+      {"x"_b, "unallocated"},
+    },
+  },
+
+  { "_00000000_1058",
+    {16, 0},
+    { {"00"_b, "vcge_q_t2"},
+    },
+  },
+
+  { "_00000000_657",
+    {20},
+    { {"0"_b, "_00000000_658"},
+      {"x"_b, "unallocated"},
+    },
+  },
+
+  { "_00000000_658",
+    {12},
+    { {"0"_b, "_00000000_1059"},
+      {"x"_b, "unallocated"},
+    },
+  },
+
+  { "_00000000_1059",
+    {16, 0},
+    { {"00"_b, "vcgt_q_t2"},
+    },
+  },
+
+  { "_00000000_659",
+    {28, 21, 20},
+    { {"000"_b, "vmax_f32_d_t1"},
+      {"010"_b, "vmin_f32_d_t1"},
+      {"100"_b, "vpmax_f32_t1"},
+      {"110"_b, "vpmin_f32_t1"},
+      {"xxx"_b, "unallocated"},
+    },
+  },
+
+  { "_00000000_660",
+    {28, 21, 20},
+    { {"000"_b, "_00000000_661"},
+      {"010"_b, "_00000000_662"},
+      {"xxx"_b, "unallocated"},
+    },
+  },
+
+  { "_00000000_661",
+    {12},
+    { {"0"_b, "_00000000_1060"},
+      {"x"_b, "unallocated"},
+    },
+  },
+
+  { "_00000000_1060",
+    {16, 0},
+    { {"00"_b, "vmax_f32_q_t1"},
+    },
+  },
+
+  { "_00000000_662",
+    {12},
+    { {"0"_b, "_00000000_1061"},
+      {"x"_b, "unallocated"},
+    },
+  },
+
+  { "_00000000_1061",
+    {16, 0},
+    { {"00"_b, "vmin_f32_q_t1"},
+    },
+  },
+
+  { "_00000000_663",
+    {21, 20},
+    { {"11"_b, "_00000000_664"},
+      {"xx"_b, "_00000000_709"},
+    },
+  },
+
+  { "_00000000_664",
+    {28},
+    { {"0"_b, "_00000000_665"},
+      {"1"_b, "_00000000_668"},
+    },
+  },
+
+  { "_00000000_665",
+    {6},
+    { {"0"_b, "_00000000_666"},
+      {"1"_b, "_00000000_667"},
+    },
+  },
+
+  { "_00000000_666",
+    {11},
+    { {"1"_b, "unallocated"},
+      {"x"_b, "vext_d_t1"},
+    },
+  },
+
+  { "_00000000_667",
+    {12},
+    { {"0"_b, "_00000000_1062"},
+      {"x"_b, "unallocated"},
+    },
+  },
+
+  { "_00000000_1062",
+    {16, 0},
+    { {"00"_b, "vext_q_t1"},
+    },
+  },
+
+  { "_00000000_668",
+    {11},
+    { {"0"_b, "_00000000_669"},
+      {"1"_b, "_00000000_706"},
+    },
+  },
+
+  { "_00000000_669",
+    {17, 16, 9},
+    { {"000"_b, "_00000000_670"},
+      {"001"_b, "_00000000_677"},
+      {"010"_b, "_00000000_682"},
+      {"011"_b, "_00000000_683"},
+      {"100"_b, "_00000000_685"},
+      {"101"_b, "_00000000_689"},
+      {"110"_b, "_00000000_698"},
+      {"111"_b, "_00000000_703"},
+    },
+  },
+
+  { "_00000000_670",
+    {10, 8, 7, 6},
+    { {"0000"_b, "vrev64_d_t1"},
+      {"0001"_b, "_00000000_1063"},
+      {"0010"_b, "vrev32_d_t1"},
+      {"0011"_b, "_00000000_1064"},
+      {"0100"_b, "vrev16_d_t1"},
+      {"0101"_b, "_00000000_1065"},
+      {"1000"_b, "vcls_d_t1"},
+      {"1001"_b, "_00000000_1066"},
+      {"1010"_b, "vclz_d_t1"},
+      {"1011"_b, "_00000000_1067"},
+      {"1100"_b, "_00000000_671"},
+      {"1101"_b, "_00000000_672"},
+      {"1110"_b, "_00000000_674"},
+      {"1111"_b, "_00000000_675"},
+      {"xxxx"_b, "unallocated"},
+    },
+  },
+
+  { "_00000000_1063",
+    {12, 0},
+    { {"00"_b, "vrev64_q_t1"},
+    },
+  },
+
+  { "_00000000_1064",
+    {12, 0},
+    { {"00"_b, "vrev32_q_t1"},
+    },
+  },
+
+  { "_00000000_1065",
+    {12, 0},
+    { {"00"_b, "vrev16_q_t1"},
+    },
+  },
+
+  { "_00000000_1066",
+    {12, 0},
+    { {"00"_b, "vcls_q_t1"},
+    },
+  },
+
+  { "_00000000_1067",
+    {12, 0},
+    { {"00"_b, "vclz_q_t1"},
+    },
+  },
+
+  { "_00000000_671",
+    {19, 18},
+    { {"00"_b, "vcnt_d_t1"},
+      {"xx"_b, "unallocated"},
+    },
+  },
+
+  { "_00000000_672",
+    {19, 18},
+    { {"00"_b, "_00000000_673"},
+      {"xx"_b, "unallocated"},
+    },
+  },
+
+  { "_00000000_673",
+    {12},
+    { {"0"_b, "_00000000_1068"},
+      {"x"_b, "unallocated"},
+    },
+  },
+
+  { "_00000000_1068",
+    {0},
+    { {"0"_b, "vcnt_q_t1"},
+    },
+  },
+
+  { "_00000000_674",
+    {19, 18},
+    { {"00"_b, "vmvn_d_t1"},
+      {"xx"_b, "unallocated"},
+    },
+  },
+
+  { "_00000000_675",
+    {19, 18},
+    { {"00"_b, "_00000000_676"},
+      {"xx"_b, "unallocated"},
+    },
+  },
+
+  { "_00000000_676",
+    {12},
+    { {"0"_b, "_00000000_1069"},
+      {"x"_b, "unallocated"},
+    },
+  },
+
+  { "_00000000_1069",
+    {0},
+    { {"0"_b, "vmvn_q_t1"},
+    },
+  },
+
+  { "_00000000_677",
+    {10, 8, 6},
+    { {"000"_b, "vpaddl_d_t1"},
+      {"001"_b, "_00000000_1070"},
+      {"010"_b, "_00000000_678"},
+      {"011"_b, "_00000000_679"},
+      {"100"_b, "vpadal_d_t1"},
+      {"101"_b, "_00000000_1071"},
+      {"110"_b, "_00000000_680"},
+      {"111"_b, "_00000000_681"},
+    },
+  },
+
+  { "_00000000_1070",
+    {12, 0},
+    { {"00"_b, "vpaddl_q_t1"},
+    },
+  },
+
+  { "_00000000_1071",
+    {12, 0},
+    { {"00"_b, "vpadal_q_t1"},
+    },
+  },
+
+  { "_00000000_678",
+    {7},
+    { {"0"_b, "aese_t1"},
+      {"1"_b, "aesmc_t1"},
+    },
+  },
+
+  { "_00000000_679",
+    {7},
+    { {"0"_b, "aesd_t1"},
+      {"1"_b, "aesimc_t1"},
+    },
+  },
+
+  { "_00000000_680",
+    {7},
+    { {"0"_b, "vqabs_d_t1"},
+      {"1"_b, "vqneg_d_t1"},
+    },
+  },
+
+  { "_00000000_681",
+    {7},
+    { {"0"_b, "_00000000_1072"},
+      {"1"_b, "_00000000_1073"},
+    },
+  },
+
+  { "_00000000_1072",
+    {12, 0},
+    { {"00"_b, "vqabs_q_t1"},
+    },
+  },
+
+  { "_00000000_1073",
+    {12, 0},
+    { {"00"_b, "vqneg_q_t1"},
+    },
+  },
+
+  { "_00000000_682",
+    {8, 7, 6},
+    { {"000"_b, "vcgt_imm_d_t1"},
+      {"001"_b, "_00000000_1074"},
+      {"010"_b, "vcge_imm_d_t1"},
+      {"011"_b, "_00000000_1075"},
+      {"100"_b, "vceq_imm_d_t1"},
+      {"101"_b, "_00000000_1076"},
+      {"110"_b, "vcle_d_t1"},
+      {"111"_b, "_00000000_1077"},
+    },
+  },
+
+  { "_00000000_1074",
+    {12, 0},
+    { {"00"_b, "vcgt_imm_q_t1"},
+    },
+  },
+
+  { "_00000000_1075",
+    {12, 0},
+    { {"00"_b, "vcge_imm_q_t1"},
+    },
+  },
+
+  { "_00000000_1076",
+    {12, 0},
+    { {"00"_b, "vceq_imm_q_t1"},
+    },
+  },
+
+  { "_00000000_1077",
+    {12, 0},
+    { {"00"_b, "vcle_q_t1"},
+    },
+  },
+
+  { "_00000000_683",
+    {8, 7, 6},
+    { {"000"_b, "vclt_d_t1"},
+      {"001"_b, "_00000000_1078"},
+      {"011"_b, "_00000000_684"},
+      {"100"_b, "vabs_d_t1"},
+      {"101"_b, "_00000000_1079"},
+      {"110"_b, "vneg_d_t1"},
+      {"111"_b, "_00000000_1080"},
+      {"xxx"_b, "unallocated"},
+    },
+  },
+
+  { "_00000000_1078",
+    {12, 0},
+    { {"00"_b, "vclt_q_t1"},
+    },
+  },
+
+  { "_00000000_1079",
+    {12, 0},
+    { {"00"_b, "vabs_q_t1"},
+    },
+  },
+
+  { "_00000000_1080",
+    {12, 0},
+    { {"00"_b, "vneg_q_t1"},
+    },
+  },
+
+  { "_00000000_684",
+    {19, 18, 10},
+    { {"100"_b, "sha1h_t1"},
+      {"xxx"_b, "unallocated"},
+    },
+  },
+
+  { "_00000000_685",
+    {10, 8, 7, 6},
+    { {"0000"_b, "_00000000_686"},
+      {"0001"_b, "_00000000_687"},
+      {"0010"_b, "vtrn_d_t1"},
+      {"0011"_b, "_00000000_1081"},
+      {"0100"_b, "vuzp_d_t1"},
+      {"0101"_b, "_00000000_1082"},
+      {"0110"_b, "vzip_d_t1"},
+      {"0111"_b, "_00000000_1083"},
+      {"1000"_b, "vrintn_d_t1"},
+      {"1001"_b, "_00000000_1084"},
+      {"1010"_b, "vrintx_d_t1"},
+      {"1011"_b, "_00000000_1085"},
+      {"1100"_b, "vrinta_d_t1"},
+      {"1101"_b, "_00000000_1086"},
+      {"1110"_b, "vrintz_d_t1"},
+      {"1111"_b, "_00000000_1087"},
+    },
+  },
+
+  { "_00000000_1081",
+    {12, 0},
+    { {"00"_b, "vtrn_q_t1"},
+    },
+  },
+
+  { "_00000000_1082",
+    {12, 0},
+    { {"00"_b, "vuzp_q_t1"},
+    },
+  },
+
+  { "_00000000_1083",
+    {12, 0},
+    { {"00"_b, "vzip_q_t1"},
+    },
+  },
+
+  { "_00000000_1084",
+    {12, 0},
+    { {"00"_b, "vrintn_q_t1"},
+    },
+  },
+
+  { "_00000000_1085",
+    {12, 0},
+    { {"00"_b, "vrintx_q_t1"},
+    },
+  },
+
+  { "_00000000_1086",
+    {12, 0},
+    { {"00"_b, "vrinta_q_t1"},
+    },
+  },
+
+  { "_00000000_1087",
+    {12, 0},
+    { {"00"_b, "vrintz_q_t1"},
+    },
+  },
+
+  { "_00000000_686",
+    {19, 18},
+    { {"00"_b, "vswp_d_t1"},
+      {"xx"_b, "unallocated"},
+    },
+  },
+
+  { "_00000000_687",
+    {19, 18},
+    { {"00"_b, "_00000000_688"},
+      {"xx"_b, "unallocated"},
+    },
+  },
+
+  { "_00000000_688",
+    {12},
+    { {"0"_b, "_00000000_1088"},
+      {"x"_b, "unallocated"},
+    },
+  },
+
+  { "_00000000_1088",
+    {0},
+    { {"0"_b, "vswp_q_t1"},
+    },
+  },
+
+  { "_00000000_689",
+    {10, 8, 7},
+    { {"000"_b, "_00000000_690"},
+      {"001"_b, "_00000000_1089"},
+      {"010"_b, "_00000000_691"},
+      {"011"_b, "_00000000_692"},
+      {"100"_b, "_00000000_693"},
+      {"101"_b, "_00000000_694"},
+      {"110"_b, "_00000000_695"},
+      {"111"_b, "_00000000_697"},
+    },
+  },
+
+  { "_00000000_1089",
+    {0},
+    { {"0"_b, "vqmovn_t1"},
+    },
+  },
+
+  { "_00000000_690",
+    {6},
+    { {"0"_b, "_00000000_1090"},
+      {"1"_b, "_00000000_1091"},
+    },
+  },
+
+  { "_00000000_1090",
+    {0},
+    { {"0"_b, "vmovn_t1"},
+    },
+  },
+
+  { "_00000000_1091",
+    {0},
+    { {"0"_b, "vqmovun_t1"},
+    },
+  },
+
+  { "_00000000_691",
+    {6},
+    { {"0"_b, "_00000000_1092"},
+      {"x"_b, "unallocated"},
+    },
+  },
+
+  { "_00000000_1092",
+    {12},
+    { {"0"_b, "vshll_t2"},
+    },
+  },
+
+  { "_00000000_692",
+    {19, 18, 6},
+    { {"100"_b, "sha1su1_t1"},
+      {"101"_b, "sha256su0_t1"},
+      {"xxx"_b, "unallocated"},
+    },
+  },
+
+  { "_00000000_693",
+    {19, 18, 6},
+    { {"010"_b, "_00000000_1093"},
+      {"xxx"_b, "unallocated"},
+    },
+  },
+
+  { "_00000000_1093",
+    {0},
+    { {"0"_b, "vcvt_f16_f32_t1"},
+    },
+  },
+
+  { "_00000000_694",
+    {6},
+    { {"0"_b, "vrintm_d_t1"},
+      {"1"_b, "_00000000_1094"},
+    },
+  },
+
+  { "_00000000_1094",
+    {12, 0},
+    { {"00"_b, "vrintm_q_t1"},
+    },
+  },
+
+  { "_00000000_695",
+    {19, 18, 6},
+    { {"010"_b, "_00000000_696"},
+      {"xxx"_b, "unallocated"},
+    },
+  },
+
+  { "_00000000_696",
+    {12},
+    { {"0"_b, "vcvt_f32_f16_t1"},
+      {"x"_b, "unallocated"},
+    },
+  },
+
+  { "_00000000_697",
+    {6},
+    { {"0"_b, "vrintp_d_t1"},
+      {"1"_b, "_00000000_1095"},
+    },
+  },
+
+  { "_00000000_1095",
+    {12, 0},
+    { {"00"_b, "vrintp_q_t1"},
+    },
+  },
+
+  { "_00000000_698",
+    {10, 6},
+    { {"00"_b, "_00000000_699"},
+      {"01"_b, "_00000000_700"},
+      {"10"_b, "_00000000_701"},
+      {"11"_b, "_00000000_702"},
+    },
+  },
+
+  { "_00000000_699",
+    {19, 18, 8},
+    { {"100"_b, "vcvta_int_f32_d_t1"},
+      {"101"_b, "vcvtn_int_f32_d_t1"},
+      {"xxx"_b, "unallocated"},
+    },
+  },
+
+  { "_00000000_700",
+    {19, 18, 8},
+    { {"100"_b, "_00000000_1096"},
+      {"101"_b, "_00000000_1097"},
+      {"xxx"_b, "unallocated"},
+    },
+  },
+
+  { "_00000000_1096",
+    {12, 0},
+    { {"00"_b, "vcvta_int_f32_q_t1"},
+    },
+  },
+
+  { "_00000000_1097",
+    {12, 0},
+    { {"00"_b, "vcvtn_int_f32_q_t1"},
+    },
+  },
+
+  { "_00000000_701",
+    {7},
+    { {"0"_b, "vrecpe_d_t1"},
+      {"1"_b, "vrsqrte_d_t1"},
+    },
+  },
+
+  { "_00000000_702",
+    {7},
+    { {"0"_b, "_00000000_1098"},
+      {"1"_b, "_00000000_1099"},
+    },
+  },
+
+  { "_00000000_1098",
+    {12, 0},
+    { {"00"_b, "vrecpe_q_t1"},
+    },
+  },
+
+  { "_00000000_1099",
+    {12, 0},
+    { {"00"_b, "vrsqrte_q_t1"},
+    },
+  },
+
+  { "_00000000_703",
+    {19, 18, 10, 6},
+    { {"1000"_b, "_00000000_704"},
+      {"1001"_b, "_00000000_705"},
+      {"1010"_b, "vcvt_d_t1"},
+      {"1011"_b, "_00000000_1100"},
+      {"xxxx"_b, "unallocated"},
+    },
+  },
+
+  { "_00000000_1100",
+    {12, 0},
+    { {"00"_b, "vcvt_q_t1"},
+    },
+  },
+
+  { "_00000000_704",
+    {8},
+    { {"0"_b, "vcvtp_int_f32_d_t1"},
+      {"1"_b, "vcvtm_int_f32_d_t1"},
+    },
+  },
+
+  { "_00000000_705",
+    {8},
+    { {"0"_b, "_00000000_1101"},
+      {"1"_b, "_00000000_1102"},
+    },
+  },
+
+  { "_00000000_1101",
+    {12, 0},
+    { {"00"_b, "vcvtp_int_f32_q_t1"},
+    },
+  },
+
+  { "_00000000_1102",
+    {12, 0},
+    { {"00"_b, "vcvtm_int_f32_q_t1"},
+    },
+  },
+
+  { "_00000000_706",
+    {10, 6},
+    { {"00"_b, "vtbl_t1"},
+      {"01"_b, "vtbx_t1"},
+      {"10"_b, "_00000000_707"},
+      {"11"_b, "_00000000_708"},
+    },
+  },
+
+  { "_00000000_707",
+    {9, 8, 7},
+    { {"000"_b, "vdup_scalar_d_t1"},
+      {"xxx"_b, "unallocated"},
+    },
+  },
+
+  { "_00000000_708",
+    {9, 8, 7},
+    { {"000"_b, "_00000000_1103"},
+      {"xxx"_b, "unallocated"},
+    },
+  },
+
+  { "_00000000_1103",
+    {12},
+    { {"0"_b, "vdup_scalar_q_t1"},
+    },
+  },
+
+  { "_00000000_709",
+    {11, 10, 6},
+    { {"000"_b, "_00000000_710"},
+      {"001"_b, "_00000000_715"},
+      {"010"_b, "_00000000_723"},
+      {"011"_b, "_00000000_732"},
+      {"100"_b, "_00000000_740"},
+      {"101"_b, "_00000000_747"},
+      {"110"_b, "_00000000_755"},
+      {"111"_b, "_00000000_759"},
+    },
+  },
+
+  { "_00000000_710",
+    {9, 8},
+    { {"00"_b, "_00000000_711"},
+      {"01"_b, "_00000000_712"},
+      {"10"_b, "_00000000_713"},
+      {"11"_b, "_00000000_714"},
+    },
+  },
+
+  { "_00000000_711",
+    {21, 20},
+    { {"11"_b, "unallocated"},
+      {"xx"_b, "_00000000_1104"},
+    },
+  },
+
+  { "_00000000_1104",
+    {12},
+    { {"0"_b, "vaddl_t1"},
+    },
+  },
+
+  { "_00000000_712",
+    {21, 20},
+    { {"11"_b, "unallocated"},
+      {"xx"_b, "_00000000_1105"},
+    },
+  },
+
+  { "_00000000_1105",
+    {16, 12},
+    { {"00"_b, "vaddw_t1"},
+    },
+  },
+
+  { "_00000000_713",
+    {21, 20},
+    { {"11"_b, "unallocated"},
+      {"xx"_b, "_00000000_1106"},
+    },
+  },
+
+  { "_00000000_1106",
+    {12},
+    { {"0"_b, "vsubl_t1"},
+    },
+  },
+
+  { "_00000000_714",
+    {21, 20},
+    { {"11"_b, "unallocated"},
+      {"xx"_b, "_00000000_1107"},
+    },
+  },
+
+  { "_00000000_1107",
+    {16, 12},
+    { {"00"_b, "vsubw_t1"},
+    },
+  },
+
+  { "_00000000_715",
+    {9},
+    { {"0"_b, "_00000000_716"},
+      {"1"_b, "_00000000_719"},
+    },
+  },
+
+  { "_00000000_716",
+    {28},
+    { {"0"_b, "_00000000_717"},
+      {"1"_b, "_00000000_718"},
+    },
+  },
+
+  { "_00000000_717",
+    {21, 20},
+    { {"11"_b, "unallocated"},
+      {"xx"_b, "vmla_scalar_d_t1"},
+    },
+  },
+
+  { "_00000000_718",
+    {21, 20},
+    { {"11"_b, "unallocated"},
+      {"xx"_b, "_00000000_1108"},
+    },
+  },
+
+  { "_00000000_1108",
+    {16, 12},
+    { {"00"_b, "vmla_scalar_q_t1"},
+    },
+  },
+
+  { "_00000000_719",
+    {8},
+    { {"0"_b, "_00000000_720"},
+      {"1"_b, "_00000000_721"},
+    },
+  },
+
+  { "_00000000_720",
+    {21, 20},
+    { {"11"_b, "unallocated"},
+      {"xx"_b, "_00000000_1109"},
+    },
+  },
+
+  { "_00000000_1109",
+    {12},
+    { {"0"_b, "vmlal_scalar_t1"},
+    },
+  },
+
+  { "_00000000_721",
+    {28},
+    { {"0"_b, "_00000000_722"},
+      {"x"_b, "unallocated"},
+    },
+  },
+
+  { "_00000000_722",
+    {21, 20},
+    { {"11"_b, "unallocated"},
+      {"xx"_b, "_00000000_1110"},
+    },
+  },
+
+  { "_00000000_1110",
+    {12},
+    { {"0"_b, "vqdmlal_t2"},
+    },
+  },
+
+  { "_00000000_723",
+    {9, 8},
+    { {"00"_b, "_00000000_724"},
+      {"01"_b, "_00000000_727"},
+      {"10"_b, "_00000000_728"},
+      {"11"_b, "_00000000_731"},
+    },
+  },
+
+  { "_00000000_724",
+    {28},
+    { {"0"_b, "_00000000_725"},
+      {"1"_b, "_00000000_726"},
+    },
+  },
+
+  { "_00000000_725",
+    {21, 20},
+    { {"11"_b, "unallocated"},
+      {"xx"_b, "_00000000_1111"},
+    },
+  },
+
+  { "_00000000_1111",
+    {16, 0},
+    { {"00"_b, "vaddhn_t1"},
+    },
+  },
+
+  { "_00000000_726",
+    {21, 20},
+    { {"11"_b, "unallocated"},
+      {"xx"_b, "_00000000_1112"},
+    },
+  },
+
+  { "_00000000_1112",
+    {16, 0},
+    { {"00"_b, "vraddhn_t1"},
+    },
+  },
+
+  { "_00000000_727",
+    {21, 20},
+    { {"11"_b, "unallocated"},
+      {"xx"_b, "_00000000_1113"},
+    },
+  },
+
+  { "_00000000_1113",
+    {12},
+    { {"0"_b, "vabal_t1"},
+    },
+  },
+
+  { "_00000000_728",
+    {28},
+    { {"0"_b, "_00000000_729"},
+      {"1"_b, "_00000000_730"},
+    },
+  },
+
+  { "_00000000_729",
+    {21, 20},
+    { {"11"_b, "unallocated"},
+      {"xx"_b, "_00000000_1114"},
+    },
+  },
+
+  { "_00000000_1114",
+    {16, 0},
+    { {"00"_b, "vsubhn_t1"},
+    },
+  },
+
+  { "_00000000_730",
+    {21, 20},
+    { {"11"_b, "unallocated"},
+      {"xx"_b, "_00000000_1115"},
+    },
+  },
+
+  { "_00000000_1115",
+    {16, 0},
+    { {"00"_b, "vrsubhn_t1"},
+    },
+  },
+
+  { "_00000000_731",
+    {21, 20},
+    { {"11"_b, "unallocated"},
+      {"xx"_b, "_00000000_1116"},
+    },
+  },
+
+  { "_00000000_1116",
+    {12},
+    { {"0"_b, "vabdl_t1"},
+    },
+  },
+
+  { "_00000000_732",
+    {9},
+    { {"0"_b, "_00000000_733"},
+      {"1"_b, "_00000000_736"},
+    },
+  },
+
+  { "_00000000_733",
+    {28},
+    { {"0"_b, "_00000000_734"},
+      {"1"_b, "_00000000_735"},
+    },
+  },
+
+  { "_00000000_734",
+    {21, 20},
+    { {"11"_b, "unallocated"},
+      {"xx"_b, "vmls_scalar_d_t1"},
+    },
+  },
+
+  { "_00000000_735",
+    {21, 20},
+    { {"11"_b, "unallocated"},
+      {"xx"_b, "_00000000_1117"},
+    },
+  },
+
+  { "_00000000_1117",
+    {16, 12},
+    { {"00"_b, "vmls_scalar_q_t1"},
+    },
+  },
+
+  { "_00000000_736",
+    {8},
+    { {"0"_b, "_00000000_737"},
+      {"1"_b, "_00000000_738"},
+    },
+  },
+
+  { "_00000000_737",
+    {21, 20},
+    { {"11"_b, "unallocated"},
+      {"xx"_b, "_00000000_1118"},
+    },
+  },
+
+  { "_00000000_1118",
+    {12},
+    { {"0"_b, "vmlsl_scalar_t1"},
+    },
+  },
+
+  { "_00000000_738",
+    {28},
+    { {"0"_b, "_00000000_739"},
+      {"x"_b, "unallocated"},
+    },
+  },
+
+  { "_00000000_739",
+    {21, 20},
+    { {"11"_b, "unallocated"},
+      {"xx"_b, "_00000000_1119"},
+    },
+  },
+
+  { "_00000000_1119",
+    {12},
+    { {"0"_b, "vqdmlsl_t2"},
+    },
+  },
+
+  { "_00000000_740",
+    {9, 8},
+    { {"00"_b, "_00000000_741"},
+      {"01"_b, "_00000000_742"},
+      {"10"_b, "_00000000_744"},
+      {"11"_b, "_00000000_745"},
+    },
+  },
+
+  { "_00000000_741",
+    {21, 20},
+    { {"11"_b, "unallocated"},
+      {"xx"_b, "_00000000_1120"},
+    },
+  },
+
+  { "_00000000_1120",
+    {12},
+    { {"0"_b, "vmlal_t1"},
+    },
+  },
+
+  { "_00000000_742",
+    {28},
+    { {"0"_b, "_00000000_743"},
+      {"x"_b, "unallocated"},
+    },
+  },
+
+  { "_00000000_743",
+    {21, 20},
+    { {"11"_b, "unallocated"},
+      {"xx"_b, "_00000000_1121"},
+    },
+  },
+
+  { "_00000000_1121",
+    {12},
+    { {"0"_b, "vqdmlal_t1"},
+    },
+  },
+
+  { "_00000000_744",
+    {21, 20},
+    { {"11"_b, "unallocated"},
+      {"xx"_b, "_00000000_1122"},
+    },
+  },
+
+  { "_00000000_1122",
+    {12},
+    { {"0"_b, "vmlsl_t1"},
+    },
+  },
+
+  { "_00000000_745",
+    {28},
+    { {"0"_b, "_00000000_746"},
+      {"x"_b, "unallocated"},
+    },
+  },
+
+  { "_00000000_746",
+    {21, 20},
+    { {"11"_b, "unallocated"},
+      {"xx"_b, "_00000000_1123"},
+    },
+  },
+
+  { "_00000000_1123",
+    {12},
+    { {"0"_b, "vqdmlsl_t1"},
+    },
+  },
+
+  { "_00000000_747",
+    {9},
+    { {"0"_b, "_00000000_748"},
+      {"1"_b, "_00000000_751"},
+    },
+  },
+
+  { "_00000000_748",
+    {28},
+    { {"0"_b, "_00000000_749"},
+      {"1"_b, "_00000000_750"},
+    },
+  },
+
+  { "_00000000_749",
+    {21, 20},
+    { {"11"_b, "unallocated"},
+      {"xx"_b, "vmul_scalar_d_t1"},
+    },
+  },
+
+  { "_00000000_750",
+    {21, 20},
+    { {"11"_b, "unallocated"},
+      {"xx"_b, "_00000000_1124"},
+    },
+  },
+
+  { "_00000000_1124",
+    {16, 12},
+    { {"00"_b, "vmul_scalar_q_t1"},
+    },
+  },
+
+  { "_00000000_751",
+    {8},
+    { {"0"_b, "_00000000_752"},
+      {"1"_b, "_00000000_753"},
+    },
+  },
+
+  { "_00000000_752",
+    {21, 20},
+    { {"11"_b, "unallocated"},
+      {"xx"_b, "_00000000_1125"},
+    },
+  },
+
+  { "_00000000_1125",
+    {12},
+    { {"0"_b, "vmull_scalar_t1"},
+    },
+  },
+
+  { "_00000000_753",
+    {28},
+    { {"0"_b, "_00000000_754"},
+      {"x"_b, "unallocated"},
+    },
+  },
+
+  { "_00000000_754",
+    {21, 20},
+    { {"11"_b, "unallocated"},
+      {"xx"_b, "_00000000_1126"},
+    },
+  },
+
+  { "_00000000_1126",
+    {12},
+    { {"0"_b, "vqdmull_t2"},
+    },
+  },
+
+  { "_00000000_755",
+    {8},
+    { {"0"_b, "_00000000_756"},
+      {"1"_b, "_00000000_757"},
+    },
+  },
+
+  { "_00000000_756",
+    {21, 20},
+    { {"11"_b, "unallocated"},
+      {"xx"_b, "_00000000_1127"},
+    },
+  },
+
+  { "_00000000_1127",
+    {12},
+    { {"0"_b, "vmull_t1"},
+    },
+  },
+
+  { "_00000000_757",
+    {28, 9},
+    { {"00"_b, "_00000000_758"},
+      {"xx"_b, "unallocated"},
+    },
+  },
+
+  { "_00000000_758",
+    {21, 20},
+    { {"11"_b, "unallocated"},
+      {"xx"_b, "_00000000_1128"},
+    },
+  },
+
+  { "_00000000_1128",
+    {12},
+    { {"0"_b, "vqdmull_t1"},
+    },
+  },
+
+  { "_00000000_759",
+    {28, 9, 8},
+    { {"000"_b, "_00000000_760"},
+      {"001"_b, "_00000000_761"},
+      {"100"_b, "_00000000_762"},
+      {"101"_b, "_00000000_763"},
+      {"xxx"_b, "unallocated"},
+    },
+  },
+
+  { "_00000000_760",
+    {21, 20},
+    { {"11"_b, "unallocated"},
+      {"xx"_b, "vqdmulh_d_t2"},
+    },
+  },
+
+  { "_00000000_761",
+    {21, 20},
+    { {"11"_b, "unallocated"},
+      {"xx"_b, "vqrdmulh_d_t2"},
+    },
+  },
+
+  { "_00000000_762",
+    {21, 20},
+    { {"11"_b, "unallocated"},
+      {"xx"_b, "_00000000_1129"},
+    },
+  },
+
+  { "_00000000_1129",
+    {16, 12},
+    { {"00"_b, "vqdmulh_q_t2"},
+    },
+  },
+
+  { "_00000000_763",
+    {21, 20},
+    { {"11"_b, "unallocated"},
+      {"xx"_b, "_00000000_1130"},
+    },
+  },
+
+  { "_00000000_1130",
+    {16, 12},
+    { {"00"_b, "vqrdmulh_q_t2"},
+    },
+  },
+
+  { "_00000000_764",
+    {23, 6},
+    { {"00"_b, "_00000000_765"},
+      {"01"_b, "_00000000_773"},
+      {"10"_b, "_00000000_798"},
+      {"11"_b, "_00000000_958"},
+    },
+  },
+
+  { "_00000000_765",
+    {11, 10, 9, 8},
+    { {"0000"_b, "vqadd_d_t1"},
+      {"0001"_b, "_00000000_766"},
+      {"0010"_b, "vqsub_d_t1"},
+      {"0011"_b, "vcge_d_t1"},
+      {"0100"_b, "vqshl_d_t1"},
+      {"0101"_b, "vqrshl_d_t1"},
+      {"0110"_b, "vmin_d_t1"},
+      {"0111"_b, "vaba_d_t1"},
+      {"1000"_b, "_00000000_767"},
+      {"1001"_b, "vmul_d_t1"},
+      {"1010"_b, "vpmin_t1"},
+      {"1011"_b, "_00000000_768"},
+      {"1100"_b, "_00000000_769"},
+      {"1101"_b, "_00000000_770"},
+      {"1110"_b, "_00000000_771"},
+      {"1111"_b, "_00000000_772"},
+    },
+  },
+
+  { "_00000000_766",
+    {28, 21, 20},
+    { {"000"_b, "vand_d_t1"},
+      {"001"_b, "vbic_d_t1"},
+      {"010"_b, "vmov_d_t1"},
+      {"011"_b, "vorn_d_t1"},
+      {"100"_b, "veor_d_t1"},
+      {"101"_b, "vbsl_d_t1"},
+      {"110"_b, "vbit_d_t1"},
+      {"111"_b, "vbif_d_t1"},
+    },
+  },
+
+  { "_00000000_767",
+    {28},
+    { {"0"_b, "vtst_d_t1"},
+      {"1"_b, "vceq_d_t1"},
+    },
+  },
+
+  { "_00000000_768",
+    {28},
+    { {"0"_b, "vpadd_t1"},
+      {"x"_b, "unallocated"},
+    },
+  },
+
+  { "_00000000_769",
+    {28, 21, 20},
+    { {"000"_b, "vfma_d_t1"},
+      {"010"_b, "vfms_d_t1"},
+      {"xxx"_b, "unallocated"},
+    },
+  },
+
+  { "_00000000_770",
+    {28, 21, 20},
+    { {"000"_b, "vmla_f32_d_t1"},
+      {"010"_b, "vmls_f32_d_t1"},
+      {"100"_b, "vmul_f32_d_t1"},
+      {"xxx"_b, "unallocated"},
+    },
+  },
+
+  { "_00000000_771",
+    {28, 21, 20},
+    { {"100"_b, "vacge_d_t1"},
+      {"110"_b, "vacgt_d_t1"},
+      {"xxx"_b, "unallocated"},
+    },
+  },
+
+  { "_00000000_772",
+    {28, 21, 20},
+    { {"000"_b, "vrecps_d_t1"},
+      {"010"_b, "vrsqrts_d_t1"},
+      {"100"_b, "vmaxnm_d_t1"},
+      {"110"_b, "vminnm_d_t1"},
+      {"xxx"_b, "unallocated"},
+    },
+  },
+
+  { "_00000000_773",
+    {11, 10, 9, 8},
+    { {"0000"_b, "_00000000_1131"},
+      {"0001"_b, "_00000000_774"},
+      {"0010"_b, "_00000000_1132"},
+      {"0011"_b, "_00000000_1133"},
+      {"0100"_b, "_00000000_1134"},
+      {"0101"_b, "_00000000_1135"},
+      {"0110"_b, "_00000000_1136"},
+      {"0111"_b, "_00000000_1137"},
+      {"1000"_b, "_00000000_782"},
+      {"1001"_b, "_00000000_1138"},
+      {"1100"_b, "_00000000_783"},
+      {"1101"_b, "_00000000_786"},
+      {"1110"_b, "_00000000_790"},
+      {"1111"_b, "_00000000_793"},
+      {"xxxx"_b, "unallocated"},
+    },
+  },
+
+  { "_00000000_1131",
+    {16, 12, 0},
+    { {"000"_b, "vqadd_q_t1"},
+    },
+  },
+
+  { "_00000000_1132",
+    {16, 12, 0},
+    { {"000"_b, "vqsub_q_t1"},
+    },
+  },
+
+  { "_00000000_1133",
+    {16, 12, 0},
+    { {"000"_b, "vcge_q_t1"},
+    },
+  },
+
+  { "_00000000_1134",
+    {16, 12, 0},
+    { {"000"_b, "vqshl_q_t1"},
+    },
+  },
+
+  { "_00000000_1135",
+    {16, 12, 0},
+    { {"000"_b, "vqrshl_q_t1"},
+    },
+  },
+
+  { "_00000000_1136",
+    {16, 12, 0},
+    { {"000"_b, "vmin_q_t1"},
+    },
+  },
+
+  { "_00000000_1137",
+    {16, 12, 0},
+    { {"000"_b, "vaba_q_t1"},
+    },
+  },
+
+  { "_00000000_1138",
+    {16, 12, 0},
+    { {"000"_b, "vmul_q_t1"},
+    },
+  },
+
+  { "_00000000_774",
+    {28, 21, 20},
+    { {"000"_b, "_00000000_775"},
+      {"001"_b, "_00000000_776"},
+      {"010"_b, "_00000000_1139"},
+      {"011"_b, "_00000000_777"},
+      {"100"_b, "_00000000_778"},
+      {"101"_b, "_00000000_779"},
+      {"110"_b, "_00000000_780"},
+      {"111"_b, "_00000000_781"},
+    },
+  },
+
+  { "_00000000_1139",
+    {16, 12, 0},
+    { {"000"_b, "vmov_q_t1"},
+    },
+  },
+
+  { "_00000000_775",
+    {12},
+    { {"0"_b, "_00000000_1140"},
+      {"x"_b, "unallocated"},
+    },
+  },
+
+  { "_00000000_1140",
+    {16, 0},
+    { {"00"_b, "vand_q_t1"},
+    },
+  },
+
+  { "_00000000_776",
+    {12},
+    { {"0"_b, "_00000000_1141"},
+      {"x"_b, "unallocated"},
+    },
+  },
+
+  { "_00000000_1141",
+    {16, 0},
+    { {"00"_b, "vbic_q_t1"},
+    },
+  },
+
+  { "_00000000_777",
+    {12},
+    { {"0"_b, "_00000000_1142"},
+      {"x"_b, "unallocated"},
+    },
+  },
+
+  { "_00000000_1142",
+    {16, 0},
+    { {"00"_b, "vorn_q_t1"},
+    },
+  },
+
+  { "_00000000_778",
+    {12},
+    { {"0"_b, "_00000000_1143"},
+      {"x"_b, "unallocated"},
+    },
+  },
+
+  { "_00000000_1143",
+    {16, 0},
+    { {"00"_b, "veor_q_t1"},
+    },
+  },
+
+  { "_00000000_779",
+    {12},
+    { {"0"_b, "_00000000_1144"},
+      {"x"_b, "unallocated"},
+    },
+  },
+
+  { "_00000000_1144",
+    {16, 0},
+    { {"00"_b, "vbsl_q_t1"},
+    },
+  },
+
+  { "_00000000_780",
+    {12},
+    { {"0"_b, "_00000000_1145"},
+      {"x"_b, "unallocated"},
+    },
+  },
+
+  { "_00000000_1145",
+    {16, 0},
+    { {"00"_b, "vbit_q_t1"},
+    },
+  },
+
+  { "_00000000_781",
+    {12},
+    { {"0"_b, "_00000000_1146"},
+      {"x"_b, "unallocated"},
+    },
+  },
+
+  { "_00000000_1146",
+    {16, 0},
+    { {"00"_b, "vbif_q_t1"},
+    },
+  },
+
+  { "_00000000_782",
+    {28},
+    { {"0"_b, "_00000000_1147"},
+      {"1"_b, "_00000000_1148"},
+    },
+  },
+
+  { "_00000000_1147",
+    {16, 12, 0},
+    { {"000"_b, "vtst_q_t1"},
+    },
+  },
+
+  { "_00000000_1148",
+    {16, 12, 0},
+    { {"000"_b, "vceq_q_t1"},
+    },
+  },
+
+  { "_00000000_783",
+    {28, 21, 20},
+    { {"000"_b, "_00000000_784"},
+      {"010"_b, "_00000000_785"},
+      {"xxx"_b, "unallocated"},
+    },
+  },
+
+  { "_00000000_784",
+    {12},
+    { {"0"_b, "_00000000_1149"},
+      {"x"_b, "unallocated"},
+    },
+  },
+
+  { "_00000000_1149",
+    {16, 0},
+    { {"00"_b, "vfma_q_t1"},
+    },
+  },
+
+  { "_00000000_785",
+    {12},
+    { {"0"_b, "_00000000_1150"},
+      {"x"_b, "unallocated"},
+    },
+  },
+
+  { "_00000000_1150",
+    {16, 0},
+    { {"00"_b, "vfms_q_t1"},
+    },
+  },
+
+  { "_00000000_786",
+    {28, 21, 20},
+    { {"000"_b, "_00000000_787"},
+      {"010"_b, "_00000000_788"},
+      {"100"_b, "_00000000_789"},
+      {"xxx"_b, "unallocated"},
+    },
+  },
+
+  { "_00000000_787",
+    {12},
+    { {"0"_b, "_00000000_1151"},
+      {"x"_b, "unallocated"},
+    },
+  },
+
+  { "_00000000_1151",
+    {16, 0},
+    { {"00"_b, "vmla_f32_q_t1"},
+    },
+  },
+
+  { "_00000000_788",
+    {12},
+    { {"0"_b, "_00000000_1152"},
+      {"x"_b, "unallocated"},
+    },
+  },
+
+  { "_00000000_1152",
+    {16, 0},
+    { {"00"_b, "vmls_f32_q_t1"},
+    },
+  },
+
+  { "_00000000_789",
+    {12},
+    { {"0"_b, "_00000000_1153"},
+      {"x"_b, "unallocated"},
+    },
+  },
+
+  { "_00000000_1153",
+    {16, 0},
+    { {"00"_b, "vmul_f32_q_t1"},
+    },
+  },
+
+  { "_00000000_790",
+    {28, 21, 20},
+    { {"100"_b, "_00000000_791"},
+      {"110"_b, "_00000000_792"},
+      {"xxx"_b, "unallocated"},
+    },
+  },
+
+  { "_00000000_791",
+    {12},
+    { {"0"_b, "_00000000_1154"},
+      {"x"_b, "unallocated"},
+    },
+  },
+
+  { "_00000000_1154",
+    {16, 0},
+    { {"00"_b, "vacge_q_t1"},
+    },
+  },
+
+  { "_00000000_792",
+    {12},
+    { {"0"_b, "_00000000_1155"},
+      {"x"_b, "unallocated"},
+    },
+  },
+
+  { "_00000000_1155",
+    {16, 0},
+    { {"00"_b, "vacgt_q_t1"},
+    },
+  },
+
+  { "_00000000_793",
+    {28, 21, 20},
+    { {"000"_b, "_00000000_794"},
+      {"010"_b, "_00000000_795"},
+      {"100"_b, "_00000000_796"},
+      {"110"_b, "_00000000_797"},
+      {"xxx"_b, "unallocated"},
+    },
+  },
+
+  { "_00000000_794",
+    {12},
+    { {"0"_b, "_00000000_1156"},
+      {"x"_b, "unallocated"},
+    },
+  },
+
+  { "_00000000_1156",
+    {16, 0},
+    { {"00"_b, "vrecps_q_t1"},
+    },
+  },
+
+  { "_00000000_795",
+    {12},
+    { {"0"_b, "_00000000_1157"},
+      {"x"_b, "unallocated"},
+    },
+  },
+
+  { "_00000000_1157",
+    {16, 0},
+    { {"00"_b, "vrsqrts_q_t1"},
+    },
+  },
+
+  { "_00000000_796",
+    {12},
+    { {"0"_b, "_00000000_1158"},
+      {"x"_b, "unallocated"},
+    },
+  },
+
+  { "_00000000_1158",
+    {16, 0},
+    { {"00"_b, "vmaxnm_q_t1"},
+    },
+  },
+
+  { "_00000000_797",
+    {12},
+    { {"0"_b, "_00000000_1159"},
+      {"x"_b, "unallocated"},
+    },
+  },
+
+  { "_00000000_1159",
+    {16, 0},
+    { {"00"_b, "vminnm_q_t1"},
+    },
+  },
+
+  { "_00000000_798",
+    {11, 10},
+    { {"00"_b, "_00000000_799"},
+      {"01"_b, "_00000000_813"},
+      {"10"_b, "_00000000_830"},
+      {"11"_b, "_00000000_928"},
+    },
+  },
+
+  { "_00000000_799",
+    {21, 20, 19, 7},
+    { {"0000"_b, "_00000000_800"},
+      {"xxxx"_b, "_00000000_808"},
+    },
+  },
+
+  { "_00000000_800",
+    {8},
+    { {"0"_b, "_00000000_801"},
+      {"1"_b, "_00000000_805"},
+    },
+  },
+
+  { "_00000000_801",
+    {9},
+    { {"x"_b, "_00000000_802"},
+    },
+  },
+
+  { "_00000000_802",
+    {5},
+    { {"1"_b, "_00000000_803"},
+      {"x"_b, "_00000000_804"},
+    },
+  },
+
+  { "_00000000_803",
+    {11, 10, 9, 8},
+    { {"00x1"_b, "unallocated"},
+      {"01x1"_b, "unallocated"},
+      {"10x1"_b, "unallocated"},
+      {"111x"_b, "unallocated"},
+      {"xxxx"_b, "vmvn_imm_d_t1"},
+    },
+  },
+
+  { "_00000000_804",
+    {11, 10, 9, 8, 5},
+    { {"0xx10"_b, "unallocated"},
+      {"x0x10"_b, "unallocated"},
+      {"0xxx1"_b, "unallocated"},
+      {"x0xx1"_b, "unallocated"},
+      {"xx0x1"_b, "unallocated"},
+      {"xxx11"_b, "unallocated"},
+      {"xxxxx"_b, "vmov_imm_d_t1"},
+    },
+  },
+
+  { "_00000000_805",
+    {5},
+    { {"0"_b, "_00000000_806"},
+      {"1"_b, "_00000000_807"},
+    },
+  },
+
+  { "_00000000_806",
+    {11, 10, 8},
+    { {"xx0"_b, "unallocated"},
+      {"11x"_b, "unallocated"},
+      {"xxx"_b, "vorr_d_t1"},
+    },
+  },
+
+  { "_00000000_807",
+    {11, 10, 8},
+    { {"xx0"_b, "unallocated"},
+      {"11x"_b, "unallocated"},
+      {"xxx"_b, "vbic_imm_d_t1"},
+    },
+  },
+
+  { "_00000000_808",
+    {9, 8},
+    { {"00"_b, "_00000000_809"},
+      {"01"_b, "_00000000_810"},
+      {"10"_b, "_00000000_811"},
+      {"11"_b, "_00000000_812"},
+    },
+  },
+
+  { "_00000000_809",
+    {21, 20, 19, 7},
+    { {"0000"_b, "unallocated"},
+      {"xxxx"_b, "vshr_d_t1"},
+    },
+  },
+
+  { "_00000000_810",
+    {21, 20, 19, 7},
+    { {"0000"_b, "unallocated"},
+      {"xxxx"_b, "vsra_d_t1"},
+    },
+  },
+
+  { "_00000000_811",
+    {21, 20, 19, 7},
+    { {"0000"_b, "unallocated"},
+      {"xxxx"_b, "vrshr_d_t1"},
+    },
+  },
+
+  { "_00000000_812",
+    {21, 20, 19, 7},
+    { {"0000"_b, "unallocated"},
+      {"xxxx"_b, "vrsra_d_t1"},
+    },
+  },
+
+  { "_00000000_813",
+    {21, 20, 19, 7},
+    { {"0000"_b, "_00000000_814"},
+      {"xxxx"_b, "_00000000_822"},
+    },
+  },
+
+  { "_00000000_814",
+    {8},
+    { {"0"_b, "_00000000_815"},
+      {"1"_b, "_00000000_819"},
+    },
+  },
+
+  { "_00000000_815",
+    {9},
+    { {"x"_b, "_00000000_816"},
+    },
+  },
+
+  { "_00000000_816",
+    {5},
+    { {"1"_b, "_00000000_817"},
+      {"x"_b, "_00000000_818"},
+    },
+  },
+
+  { "_00000000_817",
+    {11, 10, 9, 8},
+    { {"00x1"_b, "unallocated"},
+      {"01x1"_b, "unallocated"},
+      {"10x1"_b, "unallocated"},
+      {"111x"_b, "unallocated"},
+      {"xxxx"_b, "vmvn_imm_d_t1"},
+    },
+  },
+
+  { "_00000000_818",
+    {11, 10, 9, 8, 5},
+    { {"0xx10"_b, "unallocated"},
+      {"x0x10"_b, "unallocated"},
+      {"0xxx1"_b, "unallocated"},
+      {"x0xx1"_b, "unallocated"},
+      {"xx0x1"_b, "unallocated"},
+      {"xxx11"_b, "unallocated"},
+      {"xxxxx"_b, "vmov_imm_d_t1"},
+    },
+  },
+
+  { "_00000000_819",
+    {5},
+    { {"0"_b, "_00000000_820"},
+      {"1"_b, "_00000000_821"},
+    },
+  },
+
+  { "_00000000_820",
+    {11, 10, 8},
+    { {"xx0"_b, "unallocated"},
+      {"11x"_b, "unallocated"},
+      {"xxx"_b, "vorr_d_t1"},
+    },
+  },
+
+  { "_00000000_821",
+    {11, 10, 8},
+    { {"xx0"_b, "unallocated"},
+      {"11x"_b, "unallocated"},
+      {"xxx"_b, "vbic_imm_d_t1"},
+    },
+  },
+
+  { "_00000000_822",
+    {9, 8},
+    { {"00"_b, "_00000000_823"},
+      {"01"_b, "_00000000_825"},
+      {"10"_b, "_00000000_828"},
+      {"11"_b, "_00000000_829"},
+    },
+  },
+
+  { "_00000000_823",
+    {28},
+    { {"1"_b, "_00000000_824"},
+      {"x"_b, "unallocated"},
+    },
+  },
+
+  { "_00000000_824",
+    {21, 20, 19, 7},
+    { {"0000"_b, "unallocated"},
+      {"xxxx"_b, "vsri_d_t1"},
+    },
+  },
+
+  { "_00000000_825",
+    {28},
+    { {"0"_b, "_00000000_826"},
+      {"1"_b, "_00000000_827"},
+    },
+  },
+
+  { "_00000000_826",
+    {21, 20, 19, 7},
+    { {"0000"_b, "unallocated"},
+      {"xxxx"_b, "vshl_imm_d_t1"},
+    },
+  },
+
+  { "_00000000_827",
+    {21, 20, 19, 7},
+    { {"0000"_b, "unallocated"},
+      {"xxxx"_b, "vsli_d_t1"},
+    },
+  },
+
+  { "_00000000_828",
+    {21, 20, 19, 7},
+    { {"0000"_b, "unallocated"},
+      {"xxxx"_b, "vqshlu_d_t1"},
+    },
+  },
+
+  { "_00000000_829",
+    {21, 20, 19, 7},
+    { {"0000"_b, "unallocated"},
+      {"xxxx"_b, "vqshl_imm_d_t1"},
+    },
+  },
+
+  { "_00000000_830",
+    {7},
+    { {"0"_b, "_00000000_831"},
+      {"x"_b, "unallocated"},
+    },
+  },
+
+  { "_00000000_831",
+    {21, 20, 19},
+    { {"000"_b, "_00000000_832"},
+      {"011"_b, "_00000000_840"},
+      {"101"_b, "_00000000_846"},
+      {"110"_b, "_00000000_852"},
+      {"111"_b, "_00000000_858"},
+      {"xxx"_b, "_00000000_864"},
+    },
+  },
+
+  { "_00000000_832",
+    {8},
+    { {"0"_b, "_00000000_833"},
+      {"1"_b, "_00000000_837"},
+    },
+  },
+
+  { "_00000000_833",
+    {9},
+    { {"x"_b, "_00000000_834"},
+    },
+  },
+
+  { "_00000000_834",
+    {5},
+    { {"1"_b, "_00000000_835"},
+      {"x"_b, "_00000000_836"},
+    },
+  },
+
+  { "_00000000_835",
+    {11, 10, 9, 8},
+    { {"00x1"_b, "unallocated"},
+      {"01x1"_b, "unallocated"},
+      {"10x1"_b, "unallocated"},
+      {"111x"_b, "unallocated"},
+      {"xxxx"_b, "vmvn_imm_d_t1"},
+    },
+  },
+
+  { "_00000000_836",
+    {11, 10, 9, 8, 5},
+    { {"0xx10"_b, "unallocated"},
+      {"x0x10"_b, "unallocated"},
+      {"0xxx1"_b, "unallocated"},
+      {"x0xx1"_b, "unallocated"},
+      {"xx0x1"_b, "unallocated"},
+      {"xxx11"_b, "unallocated"},
+      {"xxxxx"_b, "vmov_imm_d_t1"},
+    },
+  },
+
+  { "_00000000_837",
+    {5},
+    { {"0"_b, "_00000000_838"},
+      {"1"_b, "_00000000_839"},
+    },
+  },
+
+  { "_00000000_838",
+    {11, 10, 8},
+    { {"xx0"_b, "unallocated"},
+      {"11x"_b, "unallocated"},
+      {"xxx"_b, "vorr_d_t1"},
+    },
+  },
+
+  { "_00000000_839",
+    {11, 10, 8},
+    { {"xx0"_b, "unallocated"},
+      {"11x"_b, "unallocated"},
+      {"xxx"_b, "vbic_imm_d_t1"},
+    },
+  },
+
+  { "_00000000_840",
+    {9, 8},
+    { {"00"_b, "_00000000_841"},
+      {"01"_b, "_00000000_844"},
+      {"10"_b, "_00000000_845"},
+      {"xx"_b, "unallocated"},
+    },
+  },
+
+  { "_00000000_841",
+    {28},
+    { {"0"_b, "_00000000_842"},
+      {"1"_b, "_00000000_843"},
+    },
+  },
+
+  { "_00000000_842",
+    {21, 20, 19},
+    { {"000"_b, "unallocated"},
+      {"xxx"_b, "_00000000_1160"},
+    },
+  },
+
+  { "_00000000_1160",
+    {0},
+    { {"0"_b, "vshrn_t1"},
+    },
+  },
+
+  { "_00000000_843",
+    {21, 20, 19},
+    { {"000"_b, "unallocated"},
+      {"xxx"_b, "_00000000_1161"},
+    },
+  },
+
+  { "_00000000_1161",
+    {0},
+    { {"0"_b, "vqshrun_t1"},
+    },
+  },
+
+  { "_00000000_844",
+    {21, 20, 19},
+    { {"000"_b, "unallocated"},
+      {"xxx"_b, "_00000000_1162"},
+    },
+  },
+
+  { "_00000000_1162",
+    {0},
+    { {"0"_b, "vqshrn_t1"},
+    },
+  },
+
+  { "_00000000_845",
+    {21, 20, 19, 18, 17, 16},
+    { {"000xxx"_b, "unallocated"},
+      {"001000"_b, "unallocated"},
+      {"010000"_b, "unallocated"},
+      {"100000"_b, "unallocated"},
+      {"xxxxxx"_b, "_00000000_1163"},
+    },
+  },
+
+  { "_00000000_1163",
+    {12},
+    { {"0"_b, "vshll_t1"},
+    },
+  },
+
+  { "_00000000_846",
+    {9, 8},
+    { {"00"_b, "_00000000_847"},
+      {"01"_b, "_00000000_850"},
+      {"10"_b, "_00000000_851"},
+      {"xx"_b, "unallocated"},
+    },
+  },
+
+  { "_00000000_847",
+    {28},
+    { {"0"_b, "_00000000_848"},
+      {"1"_b, "_00000000_849"},
+    },
+  },
+
+  { "_00000000_848",
+    {21, 20, 19},
+    { {"000"_b, "unallocated"},
+      {"xxx"_b, "_00000000_1160"},
+    },
+  },
+
+  { "_00000000_849",
+    {21, 20, 19},
+    { {"000"_b, "unallocated"},
+      {"xxx"_b, "_00000000_1161"},
+    },
+  },
+
+  { "_00000000_850",
+    {21, 20, 19},
+    { {"000"_b, "unallocated"},
+      {"xxx"_b, "_00000000_1162"},
+    },
+  },
+
+  { "_00000000_851",
+    {21, 20, 19, 18, 17, 16},
+    { {"000xxx"_b, "unallocated"},
+      {"001000"_b, "unallocated"},
+      {"010000"_b, "unallocated"},
+      {"100000"_b, "unallocated"},
+      {"xxxxxx"_b, "_00000000_1163"},
+    },
+  },
+
+  { "_00000000_852",
+    {9, 8},
+    { {"00"_b, "_00000000_853"},
+      {"01"_b, "_00000000_856"},
+      {"10"_b, "_00000000_857"},
+      {"xx"_b, "unallocated"},
+    },
+  },
+
+  { "_00000000_853",
+    {28},
+    { {"0"_b, "_00000000_854"},
+      {"1"_b, "_00000000_855"},
+    },
+  },
+
+  { "_00000000_854",
+    {21, 20, 19},
+    { {"000"_b, "unallocated"},
+      {"xxx"_b, "_00000000_1160"},
+    },
+  },
+
+  { "_00000000_855",
+    {21, 20, 19},
+    { {"000"_b, "unallocated"},
+      {"xxx"_b, "_00000000_1161"},
+    },
+  },
+
+  { "_00000000_856",
+    {21, 20, 19},
+    { {"000"_b, "unallocated"},
+      {"xxx"_b, "_00000000_1162"},
+    },
+  },
+
+  { "_00000000_857",
+    {21, 20, 19, 18, 17, 16},
+    { {"000xxx"_b, "unallocated"},
+      {"001000"_b, "unallocated"},
+      {"010000"_b, "unallocated"},
+      {"100000"_b, "unallocated"},
+      {"xxxxxx"_b, "_00000000_1163"},
+    },
+  },
+
+  { "_00000000_858",
+    {9, 8},
+    { {"00"_b, "_00000000_859"},
+      {"01"_b, "_00000000_862"},
+      {"10"_b, "_00000000_863"},
+      {"xx"_b, "unallocated"},
+    },
+  },
+
+  { "_00000000_859",
+    {28},
+    { {"0"_b, "_00000000_860"},
+      {"1"_b, "_00000000_861"},
+    },
+  },
+
+  { "_00000000_860",
+    {21, 20, 19},
+    { {"000"_b, "unallocated"},
+      {"xxx"_b, "_00000000_1160"},
+    },
+  },
+
+  { "_00000000_861",
+    {21, 20, 19},
+    { {"000"_b, "unallocated"},
+      {"xxx"_b, "_00000000_1161"},
+    },
+  },
+
+  { "_00000000_862",
+    {21, 20, 19},
+    { {"000"_b, "unallocated"},
+      {"xxx"_b, "_00000000_1162"},
+    },
+  },
+
+  { "_00000000_863",
+    {21, 20, 19, 18, 17, 16},
+    { {"000xxx"_b, "unallocated"},
+      {"001000"_b, "unallocated"},
+      {"010000"_b, "unallocated"},
+      {"100000"_b, "unallocated"},
+      {"xxxxxx"_b, "_00000000_1163"},
+    },
+  },
+
+  { "_00000000_864",
+    {9, 8},
+    { {"00"_b, "_00000000_865"},
+      {"01"_b, "_00000000_868"},
+      {"10"_b, "_00000000_869"},
+      {"xx"_b, "unallocated"},
+    },
+  },
+
+  { "_00000000_865",
+    {28},
+    { {"0"_b, "_00000000_866"},
+      {"1"_b, "_00000000_867"},
+    },
+  },
+
+  { "_00000000_866",
+    {21, 20, 19},
+    { {"000"_b, "unallocated"},
+      {"xxx"_b, "_00000000_1160"},
+    },
+  },
+
+  { "_00000000_867",
+    {21, 20, 19},
+    { {"000"_b, "unallocated"},
+      {"xxx"_b, "_00000000_1161"},
+    },
+  },
+
+  { "_00000000_868",
+    {21, 20, 19},
+    { {"000"_b, "unallocated"},
+      {"xxx"_b, "_00000000_1162"},
+    },
+  },
+
+  { "_00000000_869",
+    {18, 17, 16},
+    { {"000"_b, "_00000000_870"},
+      {"xxx"_b, "_00000000_927"},
+    },
+  },
+
+  { "_00000000_870",
+    {21, 20, 19, 18, 17, 16},
+    { {"001000"_b, "_00000000_871"},
+      {"001001"_b, "_00000000_872"},
+      {"001010"_b, "_00000000_873"},
+      {"001011"_b, "_00000000_874"},
+      {"001100"_b, "_00000000_875"},
+      {"001101"_b, "_00000000_876"},
+      {"001110"_b, "_00000000_877"},
+      {"001111"_b, "_00000000_878"},
+      {"010000"_b, "_00000000_879"},
+      {"010001"_b, "_00000000_880"},
+      {"010010"_b, "_00000000_881"},
+      {"010011"_b, "_00000000_882"},
+      {"010100"_b, "_00000000_883"},
+      {"010101"_b, "_00000000_884"},
+      {"010110"_b, "_00000000_885"},
+      {"010111"_b, "_00000000_886"},
+      {"011000"_b, "_00000000_887"},
+      {"011001"_b, "_00000000_888"},
+      {"011010"_b, "_00000000_889"},
+      {"011011"_b, "_00000000_890"},
+      {"011100"_b, "_00000000_891"},
+      {"011101"_b, "_00000000_892"},
+      {"011110"_b, "_00000000_893"},
+      {"011111"_b, "_00000000_894"},
+      {"100000"_b, "_00000000_895"},
+      {"100001"_b, "_00000000_896"},
+      {"100010"_b, "_00000000_897"},
+      {"100011"_b, "_00000000_898"},
+      {"100100"_b, "_00000000_899"},
+      {"100101"_b, "_00000000_900"},
+      {"100110"_b, "_00000000_901"},
+      {"100111"_b, "_00000000_902"},
+      {"101000"_b, "_00000000_903"},
+      {"101001"_b, "_00000000_904"},
+      {"101010"_b, "_00000000_905"},
+      {"101011"_b, "_00000000_906"},
+      {"101100"_b, "_00000000_907"},
+      {"101101"_b, "_00000000_908"},
+      {"101110"_b, "_00000000_909"},
+      {"101111"_b, "_00000000_910"},
+      {"110000"_b, "_00000000_911"},
+      {"110001"_b, "_00000000_912"},
+      {"110010"_b, "_00000000_913"},
+      {"110011"_b, "_00000000_914"},
+      {"110100"_b, "_00000000_915"},
+      {"110101"_b, "_00000000_916"},
+      {"110110"_b, "_00000000_917"},
+      {"110111"_b, "_00000000_918"},
+      {"111000"_b, "_00000000_919"},
+      {"111001"_b, "_00000000_920"},
+      {"111010"_b, "_00000000_921"},
+      {"111011"_b, "_00000000_922"},
+      {"111100"_b, "_00000000_923"},
+      {"111101"_b, "_00000000_924"},
+      {"111110"_b, "_00000000_925"},
+      {"111111"_b, "_00000000_926"},
+      {"xxxxxx"_b, "unallocated"},
+    },
+  },
+
+  { "_00000000_871",
+    {21, 20, 19},
+    { {"000"_b, "unallocated"},
+      {"011"_b, "unallocated"},
+      {"101"_b, "unallocated"},
+      {"110"_b, "unallocated"},
+      {"111"_b, "unallocated"},
+      {"xxx"_b, "_00000000_1164"},
+    },
+  },
+
+  { "_00000000_1164",
+    {12},
+    { {"0"_b, "vmovl_t1"},
+    },
+  },
+
+  { "_00000000_872",
+    {21, 20, 19, 18, 17, 16},
+    { {"000xxx"_b, "unallocated"},
+      {"001000"_b, "unallocated"},
+      {"010000"_b, "unallocated"},
+      {"100000"_b, "unallocated"},
+      {"xxxxxx"_b, "_00000000_1163"},
+    },
+  },
+
+  { "_00000000_873",
+    {21, 20, 19, 18, 17, 16},
+    { {"000xxx"_b, "unallocated"},
+      {"001000"_b, "unallocated"},
+      {"010000"_b, "unallocated"},
+      {"100000"_b, "unallocated"},
+      {"xxxxxx"_b, "_00000000_1163"},
+    },
+  },
+
+  { "_00000000_874",
+    {21, 20, 19, 18, 17, 16},
+    { {"000xxx"_b, "unallocated"},
+      {"001000"_b, "unallocated"},
+      {"010000"_b, "unallocated"},
+      {"100000"_b, "unallocated"},
+      {"xxxxxx"_b, "_00000000_1163"},
+    },
+  },
+
+  { "_00000000_875",
+    {21, 20, 19, 18, 17, 16},
+    { {"000xxx"_b, "unallocated"},
+      {"001000"_b, "unallocated"},
+      {"010000"_b, "unallocated"},
+      {"100000"_b, "unallocated"},
+      {"xxxxxx"_b, "_00000000_1163"},
+    },
+  },
+
+  { "_00000000_876",
+    {21, 20, 19, 18, 17, 16},
+    { {"000xxx"_b, "unallocated"},
+      {"001000"_b, "unallocated"},
+      {"010000"_b, "unallocated"},
+      {"100000"_b, "unallocated"},
+      {"xxxxxx"_b, "_00000000_1163"},
+    },
+  },
+
+  { "_00000000_877",
+    {21, 20, 19, 18, 17, 16},
+    { {"000xxx"_b, "unallocated"},
+      {"001000"_b, "unallocated"},
+      {"010000"_b, "unallocated"},
+      {"100000"_b, "unallocated"},
+      {"xxxxxx"_b, "_00000000_1163"},
+    },
+  },
+
+  { "_00000000_878",
+    {21, 20, 19, 18, 17, 16},
+    { {"000xxx"_b, "unallocated"},
+      {"001000"_b, "unallocated"},
+      {"010000"_b, "unallocated"},
+      {"100000"_b, "unallocated"},
+      {"xxxxxx"_b, "_00000000_1163"},
+    },
+  },
+
+  { "_00000000_879",
+    {21, 20, 19},
+    { {"000"_b, "unallocated"},
+      {"011"_b, "unallocated"},
+      {"101"_b, "unallocated"},
+      {"110"_b, "unallocated"},
+      {"111"_b, "unallocated"},
+      {"xxx"_b, "_00000000_1164"},
+    },
+  },
+
+  { "_00000000_880",
+    {21, 20, 19, 18, 17, 16},
+    { {"000xxx"_b, "unallocated"},
+      {"001000"_b, "unallocated"},
+      {"010000"_b, "unallocated"},
+      {"100000"_b, "unallocated"},
+      {"xxxxxx"_b, "_00000000_1163"},
+    },
+  },
+
+  { "_00000000_881",
+    {21, 20, 19, 18, 17, 16},
+    { {"000xxx"_b, "unallocated"},
+      {"001000"_b, "unallocated"},
+      {"010000"_b, "unallocated"},
+      {"100000"_b, "unallocated"},
+      {"xxxxxx"_b, "_00000000_1163"},
+    },
+  },
+
+  { "_00000000_882",
+    {21, 20, 19, 18, 17, 16},
+    { {"000xxx"_b, "unallocated"},
+      {"001000"_b, "unallocated"},
+      {"010000"_b, "unallocated"},
+      {"100000"_b, "unallocated"},
+      {"xxxxxx"_b, "_00000000_1163"},
+    },
+  },
+
+  { "_00000000_883",
+    {21, 20, 19, 18, 17, 16},
+    { {"000xxx"_b, "unallocated"},
+      {"001000"_b, "unallocated"},
+      {"010000"_b, "unallocated"},
+      {"100000"_b, "unallocated"},
+      {"xxxxxx"_b, "_00000000_1163"},
+    },
+  },
+
+  { "_00000000_884",
+    {21, 20, 19, 18, 17, 16},
+    { {"000xxx"_b, "unallocated"},
+      {"001000"_b, "unallocated"},
+      {"010000"_b, "unallocated"},
+      {"100000"_b, "unallocated"},
+      {"xxxxxx"_b, "_00000000_1163"},
+    },
+  },
+
+  { "_00000000_885",
+    {21, 20, 19, 18, 17, 16},
+    { {"000xxx"_b, "unallocated"},
+      {"001000"_b, "unallocated"},
+      {"010000"_b, "unallocated"},
+      {"100000"_b, "unallocated"},
+      {"xxxxxx"_b, "_00000000_1163"},
+    },
+  },
+
+  { "_00000000_886",
+    {21, 20, 19, 18, 17, 16},
+    { {"000xxx"_b, "unallocated"},
+      {"001000"_b, "unallocated"},
+      {"010000"_b, "unallocated"},
+      {"100000"_b, "unallocated"},
+      {"xxxxxx"_b, "_00000000_1163"},
+    },
+  },
+
+  { "_00000000_887",
+    {21, 20, 19, 18, 17, 16},
+    { {"000xxx"_b, "unallocated"},
+      {"001000"_b, "unallocated"},
+      {"010000"_b, "unallocated"},
+      {"100000"_b, "unallocated"},
+      {"xxxxxx"_b, "_00000000_1163"},
+    },
+  },
+
+  { "_00000000_888",
+    {21, 20, 19, 18, 17, 16},
+    { {"000xxx"_b, "unallocated"},
+      {"001000"_b, "unallocated"},
+      {"010000"_b, "unallocated"},
+      {"100000"_b, "unallocated"},
+      {"xxxxxx"_b, "_00000000_1163"},
+    },
+  },
+
+  { "_00000000_889",
+    {21, 20, 19, 18, 17, 16},
+    { {"000xxx"_b, "unallocated"},
+      {"001000"_b, "unallocated"},
+      {"010000"_b, "unallocated"},
+      {"100000"_b, "unallocated"},
+      {"xxxxxx"_b, "_00000000_1163"},
+    },
+  },
+
+  { "_00000000_890",
+    {21, 20, 19, 18, 17, 16},
+    { {"000xxx"_b, "unallocated"},
+      {"001000"_b, "unallocated"},
+      {"010000"_b, "unallocated"},
+      {"100000"_b, "unallocated"},
+      {"xxxxxx"_b, "_00000000_1163"},
+    },
+  },
+
+  { "_00000000_891",
+    {21, 20, 19, 18, 17, 16},
+    { {"000xxx"_b, "unallocated"},
+      {"001000"_b, "unallocated"},
+      {"010000"_b, "unallocated"},
+      {"100000"_b, "unallocated"},
+      {"xxxxxx"_b, "_00000000_1163"},
+    },
+  },
+
+  { "_00000000_892",
+    {21, 20, 19, 18, 17, 16},
+    { {"000xxx"_b, "unallocated"},
+      {"001000"_b, "unallocated"},
+      {"010000"_b, "unallocated"},
+      {"100000"_b, "unallocated"},
+      {"xxxxxx"_b, "_00000000_1163"},
+    },
+  },
+
+  { "_00000000_893",
+    {21, 20, 19, 18, 17, 16},
+    { {"000xxx"_b, "unallocated"},
+      {"001000"_b, "unallocated"},
+      {"010000"_b, "unallocated"},
+      {"100000"_b, "unallocated"},
+      {"xxxxxx"_b, "_00000000_1163"},
+    },
+  },
+
+  { "_00000000_894",
+    {21, 20, 19, 18, 17, 16},
+    { {"000xxx"_b, "unallocated"},
+      {"001000"_b, "unallocated"},
+      {"010000"_b, "unallocated"},
+      {"100000"_b, "unallocated"},
+      {"xxxxxx"_b, "_00000000_1163"},
+    },
+  },
+
+  { "_00000000_895",
+    {21, 20, 19},
+    { {"000"_b, "unallocated"},
+      {"011"_b, "unallocated"},
+      {"101"_b, "unallocated"},
+      {"110"_b, "unallocated"},
+      {"111"_b, "unallocated"},
+      {"xxx"_b, "_00000000_1164"},
+    },
+  },
+
+  { "_00000000_896",
+    {21, 20, 19, 18, 17, 16},
+    { {"000xxx"_b, "unallocated"},
+      {"001000"_b, "unallocated"},
+      {"010000"_b, "unallocated"},
+      {"100000"_b, "unallocated"},
+      {"xxxxxx"_b, "_00000000_1163"},
+    },
+  },
+
+  { "_00000000_897",
+    {21, 20, 19, 18, 17, 16},
+    { {"000xxx"_b, "unallocated"},
+      {"001000"_b, "unallocated"},
+      {"010000"_b, "unallocated"},
+      {"100000"_b, "unallocated"},
+      {"xxxxxx"_b, "_00000000_1163"},
+    },
+  },
+
+  { "_00000000_898",
+    {21, 20, 19, 18, 17, 16},
+    { {"000xxx"_b, "unallocated"},
+      {"001000"_b, "unallocated"},
+      {"010000"_b, "unallocated"},
+      {"100000"_b, "unallocated"},
+      {"xxxxxx"_b, "_00000000_1163"},
+    },
+  },
+
+  { "_00000000_899",
+    {21, 20, 19, 18, 17, 16},
+    { {"000xxx"_b, "unallocated"},
+      {"001000"_b, "unallocated"},
+      {"010000"_b, "unallocated"},
+      {"100000"_b, "unallocated"},
+      {"xxxxxx"_b, "_00000000_1163"},
+    },
+  },
+
+  { "_00000000_900",
+    {21, 20, 19, 18, 17, 16},
+    { {"000xxx"_b, "unallocated"},
+      {"001000"_b, "unallocated"},
+      {"010000"_b, "unallocated"},
+      {"100000"_b, "unallocated"},
+      {"xxxxxx"_b, "_00000000_1163"},
+    },
+  },
+
+  { "_00000000_901",
+    {21, 20, 19, 18, 17, 16},
+    { {"000xxx"_b, "unallocated"},
+      {"001000"_b, "unallocated"},
+      {"010000"_b, "unallocated"},
+      {"100000"_b, "unallocated"},
+      {"xxxxxx"_b, "_00000000_1163"},
+    },
+  },
+
+  { "_00000000_902",
+    {21, 20, 19, 18, 17, 16},
+    { {"000xxx"_b, "unallocated"},
+      {"001000"_b, "unallocated"},
+      {"010000"_b, "unallocated"},
+      {"100000"_b, "unallocated"},
+      {"xxxxxx"_b, "_00000000_1163"},
+    },
+  },
+
+  { "_00000000_903",
+    {21, 20, 19, 18, 17, 16},
+    { {"000xxx"_b, "unallocated"},
+      {"001000"_b, "unallocated"},
+      {"010000"_b, "unallocated"},
+      {"100000"_b, "unallocated"},
+      {"xxxxxx"_b, "_00000000_1163"},
+    },
+  },
+
+  { "_00000000_904",
+    {21, 20, 19, 18, 17, 16},
+    { {"000xxx"_b, "unallocated"},
+      {"001000"_b, "unallocated"},
+      {"010000"_b, "unallocated"},
+      {"100000"_b, "unallocated"},
+      {"xxxxxx"_b, "_00000000_1163"},
+    },
+  },
+
+  { "_00000000_905",
+    {21, 20, 19, 18, 17, 16},
+    { {"000xxx"_b, "unallocated"},
+      {"001000"_b, "unallocated"},
+      {"010000"_b, "unallocated"},
+      {"100000"_b, "unallocated"},
+      {"xxxxxx"_b, "_00000000_1163"},
+    },
+  },
+
+  { "_00000000_906",
+    {21, 20, 19, 18, 17, 16},
+    { {"000xxx"_b, "unallocated"},
+      {"001000"_b, "unallocated"},
+      {"010000"_b, "unallocated"},
+      {"100000"_b, "unallocated"},
+      {"xxxxxx"_b, "_00000000_1163"},
+    },
+  },
+
+  { "_00000000_907",
+    {21, 20, 19, 18, 17, 16},
+    { {"000xxx"_b, "unallocated"},
+      {"001000"_b, "unallocated"},
+      {"010000"_b, "unallocated"},
+      {"100000"_b, "unallocated"},
+      {"xxxxxx"_b, "_00000000_1163"},
+    },
+  },
+
+  { "_00000000_908",
+    {21, 20, 19, 18, 17, 16},
+    { {"000xxx"_b, "unallocated"},
+      {"001000"_b, "unallocated"},
+      {"010000"_b, "unallocated"},
+      {"100000"_b, "unallocated"},
+      {"xxxxxx"_b, "_00000000_1163"},
+    },
+  },
+
+  { "_00000000_909",
+    {21, 20, 19, 18, 17, 16},
+    { {"000xxx"_b, "unallocated"},
+      {"001000"_b, "unallocated"},
+      {"010000"_b, "unallocated"},
+      {"100000"_b, "unallocated"},
+      {"xxxxxx"_b, "_00000000_1163"},
+    },
+  },
+
+  { "_00000000_910",
+    {21, 20, 19, 18, 17, 16},
+    { {"000xxx"_b, "unallocated"},
+      {"001000"_b, "unallocated"},
+      {"010000"_b, "unallocated"},
+      {"100000"_b, "unallocated"},
+      {"xxxxxx"_b, "_00000000_1163"},
+    },
+  },
+
+  { "_00000000_911",
+    {21, 20, 19, 18, 17, 16},
+    { {"000xxx"_b, "unallocated"},
+      {"001000"_b, "unallocated"},
+      {"010000"_b, "unallocated"},
+      {"100000"_b, "unallocated"},
+      {"xxxxxx"_b, "_00000000_1163"},
+    },
+  },
+
+  { "_00000000_912",
+    {21, 20, 19, 18, 17, 16},
+    { {"000xxx"_b, "unallocated"},
+      {"001000"_b, "unallocated"},
+      {"010000"_b, "unallocated"},
+      {"100000"_b, "unallocated"},
+      {"xxxxxx"_b, "_00000000_1163"},
+    },
+  },
+
+  { "_00000000_913",
+    {21, 20, 19, 18, 17, 16},
+    { {"000xxx"_b, "unallocated"},
+      {"001000"_b, "unallocated"},
+      {"010000"_b, "unallocated"},
+      {"100000"_b, "unallocated"},
+      {"xxxxxx"_b, "_00000000_1163"},
+    },
+  },
+
+  { "_00000000_914",
+    {21, 20, 19, 18, 17, 16},
+    { {"000xxx"_b, "unallocated"},
+      {"001000"_b, "unallocated"},
+      {"010000"_b, "unallocated"},
+      {"100000"_b, "unallocated"},
+      {"xxxxxx"_b, "_00000000_1163"},
+    },
+  },
+
+  { "_00000000_915",
+    {21, 20, 19, 18, 17, 16},
+    { {"000xxx"_b, "unallocated"},
+      {"001000"_b, "unallocated"},
+      {"010000"_b, "unallocated"},
+      {"100000"_b, "unallocated"},
+      {"xxxxxx"_b, "_00000000_1163"},
+    },
+  },
+
+  { "_00000000_916",
+    {21, 20, 19, 18, 17, 16},
+    { {"000xxx"_b, "unallocated"},
+      {"001000"_b, "unallocated"},
+      {"010000"_b, "unallocated"},
+      {"100000"_b, "unallocated"},
+      {"xxxxxx"_b, "_00000000_1163"},
+    },
+  },
+
+  { "_00000000_917",
+    {21, 20, 19, 18, 17, 16},
+    { {"000xxx"_b, "unallocated"},
+      {"001000"_b, "unallocated"},
+      {"010000"_b, "unallocated"},
+      {"100000"_b, "unallocated"},
+      {"xxxxxx"_b, "_00000000_1163"},
+    },
+  },
+
+  { "_00000000_918",
+    {21, 20, 19, 18, 17, 16},
+    { {"000xxx"_b, "unallocated"},
+      {"001000"_b, "unallocated"},
+      {"010000"_b, "unallocated"},
+      {"100000"_b, "unallocated"},
+      {"xxxxxx"_b, "_00000000_1163"},
+    },
+  },
+
+  { "_00000000_919",
+    {21, 20, 19, 18, 17, 16},
+    { {"000xxx"_b, "unallocated"},
+      {"001000"_b, "unallocated"},
+      {"010000"_b, "unallocated"},
+      {"100000"_b, "unallocated"},
+      {"xxxxxx"_b, "_00000000_1163"},
+    },
+  },
+
+  { "_00000000_920",
+    {21, 20, 19, 18, 17, 16},
+    { {"000xxx"_b, "unallocated"},
+      {"001000"_b, "unallocated"},
+      {"010000"_b, "unallocated"},
+      {"100000"_b, "unallocated"},
+      {"xxxxxx"_b, "_00000000_1163"},
+    },
+  },
+
+  { "_00000000_921",
+    {21, 20, 19, 18, 17, 16},
+    { {"000xxx"_b, "unallocated"},
+      {"001000"_b, "unallocated"},
+      {"010000"_b, "unallocated"},
+      {"100000"_b, "unallocated"},
+      {"xxxxxx"_b, "_00000000_1163"},
+    },
+  },
+
+  { "_00000000_922",
+    {21, 20, 19, 18, 17, 16},
+    { {"000xxx"_b, "unallocated"},
+      {"001000"_b, "unallocated"},
+      {"010000"_b, "unallocated"},
+      {"100000"_b, "unallocated"},
+      {"xxxxxx"_b, "_00000000_1163"},
+    },
+  },
+
+  { "_00000000_923",
+    {21, 20, 19, 18, 17, 16},
+    { {"000xxx"_b, "unallocated"},
+      {"001000"_b, "unallocated"},
+      {"010000"_b, "unallocated"},
+      {"100000"_b, "unallocated"},
+      {"xxxxxx"_b, "_00000000_1163"},
+    },
+  },
+
+  { "_00000000_924",
+    {21, 20, 19, 18, 17, 16},
+    { {"000xxx"_b, "unallocated"},
+      {"001000"_b, "unallocated"},
+      {"010000"_b, "unallocated"},
+      {"100000"_b, "unallocated"},
+      {"xxxxxx"_b, "_00000000_1163"},
+    },
+  },
+
+  { "_00000000_925",
+    {21, 20, 19, 18, 17, 16},
+    { {"000xxx"_b, "unallocated"},
+      {"001000"_b, "unallocated"},
+      {"010000"_b, "unallocated"},
+      {"100000"_b, "unallocated"},
+      {"xxxxxx"_b, "_00000000_1163"},
+    },
+  },
+
+  { "_00000000_926",
+    {21, 20, 19, 18, 17, 16},
+    { {"000xxx"_b, "unallocated"},
+      {"001000"_b, "unallocated"},
+      {"010000"_b, "unallocated"},
+      {"100000"_b, "unallocated"},
+      {"xxxxxx"_b, "_00000000_1163"},
+    },
+  },
+
+  { "_00000000_927",
+    {21, 20, 19, 18, 17, 16},
+    { {"000xxx"_b, "unallocated"},
+      {"001000"_b, "unallocated"},
+      {"010000"_b, "unallocated"},
+      {"100000"_b, "unallocated"},
+      {"xxxxxx"_b, "_00000000_1163"},
+    },
+  },
+
+  { "_00000000_928",
+    {7},
+    { {"0"_b, "_00000000_929"},
+      {"x"_b, "unallocated"},
+    },
+  },
+
+  { "_00000000_929",
+    {21},
+    { {"0"_b, "_00000000_930"},
+      {"x"_b, "_00000000_956"},
+    },
+  },
+
+  { "_00000000_930",
+    {20, 19},
+    { {"00"_b, "_00000000_931"},
+      {"xx"_b, "unallocated"},
+    },
+  },
+
+  { "_00000000_931",
+    {9, 8},
+    { {"10"_b, "_00000000_932"},
+      {"11"_b, "_00000000_933"},
+      {"xx"_b, "_00000000_934"},
+    },
+  },
+
+  { "_00000000_932",
+    {11, 10, 9, 8, 5},
+    { {"0xx10"_b, "unallocated"},
+      {"x0x10"_b, "unallocated"},
+      {"0xxx1"_b, "unallocated"},
+      {"x0xx1"_b, "unallocated"},
+      {"xx0x1"_b, "unallocated"},
+      {"xxx11"_b, "unallocated"},
+      {"xxxxx"_b, "vmov_imm_d_t1"},
+    },
+  },
+
+  { "_00000000_933",
+    {11, 10, 9, 8, 5},
+    { {"0xx10"_b, "unallocated"},
+      {"x0x10"_b, "unallocated"},
+      {"0xxx1"_b, "unallocated"},
+      {"x0xx1"_b, "unallocated"},
+      {"xx0x1"_b, "unallocated"},
+      {"xxx11"_b, "unallocated"},
+      {"xxxxx"_b, "vmov_imm_d_t1"},
+    },
+  },
+
+  { "_00000000_934",
+    {5},
+    { {"1"_b, "_00000000_935"},
+      {"x"_b, "_00000000_955"},
+    },
+  },
+
+  { "_00000000_935",
+    {11, 10, 9, 8, 5},
+    { {"00000"_b, "_00000000_936"},
+      {"00001"_b, "_00000000_937"},
+      {"00100"_b, "_00000000_938"},
+      {"00101"_b, "_00000000_939"},
+      {"01000"_b, "_00000000_940"},
+      {"01001"_b, "_00000000_941"},
+      {"01100"_b, "_00000000_942"},
+      {"01101"_b, "_00000000_943"},
+      {"10000"_b, "_00000000_944"},
+      {"10001"_b, "_00000000_945"},
+      {"10100"_b, "_00000000_946"},
+      {"10101"_b, "_00000000_947"},
+      {"11000"_b, "_00000000_948"},
+      {"11001"_b, "_00000000_949"},
+      {"11010"_b, "_00000000_950"},
+      {"11011"_b, "_00000000_951"},
+      {"11100"_b, "_00000000_952"},
+      {"11101"_b, "_00000000_953"},
+      {"11110"_b, "_00000000_954"},
+      {"xxxxx"_b, "unallocated"},
+    },
+  },
+
+  { "_00000000_936",
+    {11, 10, 9, 8, 5},
+    { {"0xx10"_b, "unallocated"},
+      {"x0x10"_b, "unallocated"},
+      {"0xxx1"_b, "unallocated"},
+      {"x0xx1"_b, "unallocated"},
+      {"xx0x1"_b, "unallocated"},
+      {"xxx11"_b, "unallocated"},
+      {"xxxxx"_b, "vmov_imm_d_t1"},
+    },
+  },
+
+  { "_00000000_937",
+    {11, 10, 9, 8},
+    { {"00x1"_b, "unallocated"},
+      {"01x1"_b, "unallocated"},
+      {"10x1"_b, "unallocated"},
+      {"111x"_b, "unallocated"},
+      {"xxxx"_b, "vmvn_imm_d_t1"},
+    },
+  },
+
+  { "_00000000_938",
+    {11, 10, 9, 8, 5},
+    { {"0xx10"_b, "unallocated"},
+      {"x0x10"_b, "unallocated"},
+      {"0xxx1"_b, "unallocated"},
+      {"x0xx1"_b, "unallocated"},
+      {"xx0x1"_b, "unallocated"},
+      {"xxx11"_b, "unallocated"},
+      {"xxxxx"_b, "vmov_imm_d_t1"},
+    },
+  },
+
+  { "_00000000_939",
+    {11, 10, 9, 8},
+    { {"00x1"_b, "unallocated"},
+      {"01x1"_b, "unallocated"},
+      {"10x1"_b, "unallocated"},
+      {"111x"_b, "unallocated"},
+      {"xxxx"_b, "vmvn_imm_d_t1"},
+    },
+  },
+
+  { "_00000000_940",
+    {11, 10, 9, 8, 5},
+    { {"0xx10"_b, "unallocated"},
+      {"x0x10"_b, "unallocated"},
+      {"0xxx1"_b, "unallocated"},
+      {"x0xx1"_b, "unallocated"},
+      {"xx0x1"_b, "unallocated"},
+      {"xxx11"_b, "unallocated"},
+      {"xxxxx"_b, "vmov_imm_d_t1"},
+    },
+  },
+
+  { "_00000000_941",
+    {11, 10, 9, 8},
+    { {"00x1"_b, "unallocated"},
+      {"01x1"_b, "unallocated"},
+      {"10x1"_b, "unallocated"},
+      {"111x"_b, "unallocated"},
+      {"xxxx"_b, "vmvn_imm_d_t1"},
+    },
+  },
+
+  { "_00000000_942",
+    {11, 10, 9, 8, 5},
+    { {"0xx10"_b, "unallocated"},
+      {"x0x10"_b, "unallocated"},
+      {"0xxx1"_b, "unallocated"},
+      {"x0xx1"_b, "unallocated"},
+      {"xx0x1"_b, "unallocated"},
+      {"xxx11"_b, "unallocated"},
+      {"xxxxx"_b, "vmov_imm_d_t1"},
+    },
+  },
+
+  { "_00000000_943",
+    {11, 10, 9, 8},
+    { {"00x1"_b, "unallocated"},
+      {"01x1"_b, "unallocated"},
+      {"10x1"_b, "unallocated"},
+      {"111x"_b, "unallocated"},
+      {"xxxx"_b, "vmvn_imm_d_t1"},
+    },
+  },
+
+  { "_00000000_944",
+    {11, 10, 9, 8, 5},
+    { {"0xx10"_b, "unallocated"},
+      {"x0x10"_b, "unallocated"},
+      {"0xxx1"_b, "unallocated"},
+      {"x0xx1"_b, "unallocated"},
+      {"xx0x1"_b, "unallocated"},
+      {"xxx11"_b, "unallocated"},
+      {"xxxxx"_b, "vmov_imm_d_t1"},
+    },
+  },
+
+  { "_00000000_945",
+    {11, 10, 9, 8},
+    { {"00x1"_b, "unallocated"},
+      {"01x1"_b, "unallocated"},
+      {"10x1"_b, "unallocated"},
+      {"111x"_b, "unallocated"},
+      {"xxxx"_b, "vmvn_imm_d_t1"},
+    },
+  },
+
+  { "_00000000_946",
+    {11, 10, 9, 8, 5},
+    { {"0xx10"_b, "unallocated"},
+      {"x0x10"_b, "unallocated"},
+      {"0xxx1"_b, "unallocated"},
+      {"x0xx1"_b, "unallocated"},
+      {"xx0x1"_b, "unallocated"},
+      {"xxx11"_b, "unallocated"},
+      {"xxxxx"_b, "vmov_imm_d_t1"},
+    },
+  },
+
+  { "_00000000_947",
+    {11, 10, 9, 8},
+    { {"00x1"_b, "unallocated"},
+      {"01x1"_b, "unallocated"},
+      {"10x1"_b, "unallocated"},
+      {"111x"_b, "unallocated"},
+      {"xxxx"_b, "vmvn_imm_d_t1"},
+    },
+  },
+
+  { "_00000000_948",
+    {11, 10, 9, 8, 5},
+    { {"0xx10"_b, "unallocated"},
+      {"x0x10"_b, "unallocated"},
+      {"0xxx1"_b, "unallocated"},
+      {"x0xx1"_b, "unallocated"},
+      {"xx0x1"_b, "unallocated"},
+      {"xxx11"_b, "unallocated"},
+      {"xxxxx"_b, "vmov_imm_d_t1"},
+    },
+  },
+
+  { "_00000000_949",
+    {11, 10, 9, 8},
+    { {"00x1"_b, "unallocated"},
+      {"01x1"_b, "unallocated"},
+      {"10x1"_b, "unallocated"},
+      {"111x"_b, "unallocated"},
+      {"xxxx"_b, "vmvn_imm_d_t1"},
+    },
+  },
+
+  { "_00000000_950",
+    {11, 10, 9, 8, 5},
+    { {"0xx10"_b, "unallocated"},
+      {"x0x10"_b, "unallocated"},
+      {"0xxx1"_b, "unallocated"},
+      {"x0xx1"_b, "unallocated"},
+      {"xx0x1"_b, "unallocated"},
+      {"xxx11"_b, "unallocated"},
+      {"xxxxx"_b, "vmov_imm_d_t1"},
+    },
+  },
+
+  { "_00000000_951",
+    {11, 10, 9, 8},
+    { {"00x1"_b, "unallocated"},
+      {"01x1"_b, "unallocated"},
+      {"10x1"_b, "unallocated"},
+      {"111x"_b, "unallocated"},
+      {"xxxx"_b, "vmvn_imm_d_t1"},
+    },
+  },
+
+  { "_00000000_952",
+    {11, 10, 9, 8, 5},
+    { {"0xx10"_b, "unallocated"},
+      {"x0x10"_b, "unallocated"},
+      {"0xxx1"_b, "unallocated"},
+      {"x0xx1"_b, "unallocated"},
+      {"xx0x1"_b, "unallocated"},
+      {"xxx11"_b, "unallocated"},
+      {"xxxxx"_b, "vmov_imm_d_t1"},
+    },
+  },
+
+  { "_00000000_953",
+    {11, 10, 9, 8, 5},
+    { {"0xx10"_b, "unallocated"},
+      {"x0x10"_b, "unallocated"},
+      {"0xxx1"_b, "unallocated"},
+      {"x0xx1"_b, "unallocated"},
+      {"xx0x1"_b, "unallocated"},
+      {"xxx11"_b, "unallocated"},
+      {"xxxxx"_b, "vmov_imm_d_t1"},
+    },
+  },
+
+  { "_00000000_954",
+    {11, 10, 9, 8, 5},
+    { {"0xx10"_b, "unallocated"},
+      {"x0x10"_b, "unallocated"},
+      {"0xxx1"_b, "unallocated"},
+      {"x0xx1"_b, "unallocated"},
+      {"xx0x1"_b, "unallocated"},
+      {"xxx11"_b, "unallocated"},
+      {"xxxxx"_b, "vmov_imm_d_t1"},
+    },
+  },
+
+  { "_00000000_955",
+    {11, 10, 9, 8, 5},
+    { {"0xx10"_b, "unallocated"},
+      {"x0x10"_b, "unallocated"},
+      {"0xxx1"_b, "unallocated"},
+      {"x0xx1"_b, "unallocated"},
+      {"xx0x1"_b, "unallocated"},
+      {"xxx11"_b, "unallocated"},
+      {"xxxxx"_b, "vmov_imm_d_t1"},
+    },
+  },
+
+  { "_00000000_956",
+    {9},
+    { {"1"_b, "_00000000_957"},
+      {"x"_b, "unallocated"},
+    },
+  },
+
+  { "_00000000_957",
+    {21},
+    { {"0"_b, "unallocated"},
+      {"x"_b, "vcvt_fx_d_t1"},
+    },
+  },
+
+  { "_00000000_958",
+    {11, 10},
+    { {"00"_b, "_00000000_959"},
+      {"01"_b, "_00000000_973"},
+      {"10"_b, "_00000000_990"},
+      {"11"_b, "_00000000_1005"},
+    },
+  },
+
+  { "_00000000_959",
+    {21, 20, 19, 7},
+    { {"0000"_b, "_00000000_960"},
+      {"xxxx"_b, "_00000000_968"},
+    },
+  },
+
+  { "_00000000_960",
+    {8},
+    { {"0"_b, "_00000000_961"},
+      {"1"_b, "_00000000_965"},
+    },
+  },
+
+  { "_00000000_961",
+    {9},
+    { {"x"_b, "_00000000_962"},
+    },
+  },
+
+  { "_00000000_962",
+    {5},
+    { {"1"_b, "_00000000_963"},
+      {"x"_b, "_00000000_964"},
+    },
+  },
+
+  { "_00000000_963",
+    {11, 10, 9, 8},
+    { {"00x1"_b, "unallocated"},
+      {"01x1"_b, "unallocated"},
+      {"10x1"_b, "unallocated"},
+      {"111x"_b, "unallocated"},
+      {"xxxx"_b, "_00000000_1165"},
+    },
+  },
+
+  { "_00000000_1165",
+    {12},
+    { {"0"_b, "vmvn_imm_q_t1"},
+    },
+  },
+
+  { "_00000000_964",
+    {11, 10, 9, 8, 5},
+    { {"0xx10"_b, "unallocated"},
+      {"x0x10"_b, "unallocated"},
+      {"0xxx1"_b, "unallocated"},
+      {"x0xx1"_b, "unallocated"},
+      {"xx0x1"_b, "unallocated"},
+      {"xxx11"_b, "unallocated"},
+      {"xxxxx"_b, "_00000000_1166"},
+    },
+  },
+
+  { "_00000000_1166",
+    {12},
+    { {"0"_b, "vmov_imm_q_t1"},
+    },
+  },
+
+  { "_00000000_965",
+    {5},
+    { {"0"_b, "_00000000_966"},
+      {"1"_b, "_00000000_967"},
+    },
+  },
+
+  { "_00000000_966",
+    {11, 10, 8},
+    { {"xx0"_b, "unallocated"},
+      {"11x"_b, "unallocated"},
+      {"xxx"_b, "_00000000_1167"},
+    },
+  },
+
+  { "_00000000_1167",
+    {12},
+    { {"0"_b, "vorr_q_t1"},
+    },
+  },
+
+  { "_00000000_967",
+    {11, 10, 8},
+    { {"xx0"_b, "unallocated"},
+      {"11x"_b, "unallocated"},
+      {"xxx"_b, "_00000000_1168"},
+    },
+  },
+
+  { "_00000000_1168",
+    {12},
+    { {"0"_b, "vbic_imm_q_t1"},
+    },
+  },
+
+  { "_00000000_968",
+    {9, 8},
+    { {"00"_b, "_00000000_969"},
+      {"01"_b, "_00000000_970"},
+      {"10"_b, "_00000000_971"},
+      {"11"_b, "_00000000_972"},
+    },
+  },
+
+  { "_00000000_969",
+    {21, 20, 19, 7},
+    { {"0000"_b, "unallocated"},
+      {"xxxx"_b, "_00000000_1169"},
+    },
+  },
+
+  { "_00000000_1169",
+    {12, 0},
+    { {"00"_b, "vshr_q_t1"},
+    },
+  },
+
+  { "_00000000_970",
+    {21, 20, 19, 7},
+    { {"0000"_b, "unallocated"},
+      {"xxxx"_b, "_00000000_1170"},
+    },
+  },
+
+  { "_00000000_1170",
+    {12, 0},
+    { {"00"_b, "vsra_q_t1"},
+    },
+  },
+
+  { "_00000000_971",
+    {21, 20, 19, 7},
+    { {"0000"_b, "unallocated"},
+      {"xxxx"_b, "_00000000_1171"},
+    },
+  },
+
+  { "_00000000_1171",
+    {12, 0},
+    { {"00"_b, "vrshr_q_t1"},
+    },
+  },
+
+  { "_00000000_972",
+    {21, 20, 19, 7},
+    { {"0000"_b, "unallocated"},
+      {"xxxx"_b, "_00000000_1172"},
+    },
+  },
+
+  { "_00000000_1172",
+    {12, 0},
+    { {"00"_b, "vrsra_q_t1"},
+    },
+  },
+
+  { "_00000000_973",
+    {21, 20, 19, 7},
+    { {"0000"_b, "_00000000_974"},
+      {"xxxx"_b, "_00000000_982"},
+    },
+  },
+
+  { "_00000000_974",
+    {8},
+    { {"0"_b, "_00000000_975"},
+      {"1"_b, "_00000000_979"},
+    },
+  },
+
+  { "_00000000_975",
+    {9},
+    { {"x"_b, "_00000000_976"},
+    },
+  },
+
+  { "_00000000_976",
+    {5},
+    { {"1"_b, "_00000000_977"},
+      {"x"_b, "_00000000_978"},
+    },
+  },
+
+  { "_00000000_977",
+    {11, 10, 9, 8},
+    { {"00x1"_b, "unallocated"},
+      {"01x1"_b, "unallocated"},
+      {"10x1"_b, "unallocated"},
+      {"111x"_b, "unallocated"},
+      {"xxxx"_b, "_00000000_1165"},
+    },
+  },
+
+  { "_00000000_978",
+    {11, 10, 9, 8, 5},
+    { {"0xx10"_b, "unallocated"},
+      {"x0x10"_b, "unallocated"},
+      {"0xxx1"_b, "unallocated"},
+      {"x0xx1"_b, "unallocated"},
+      {"xx0x1"_b, "unallocated"},
+      {"xxx11"_b, "unallocated"},
+      {"xxxxx"_b, "_00000000_1166"},
+    },
+  },
+
+  { "_00000000_979",
+    {5},
+    { {"0"_b, "_00000000_980"},
+      {"1"_b, "_00000000_981"},
+    },
+  },
+
+  { "_00000000_980",
+    {11, 10, 8},
+    { {"xx0"_b, "unallocated"},
+      {"11x"_b, "unallocated"},
+      {"xxx"_b, "_00000000_1167"},
+    },
+  },
+
+  { "_00000000_981",
+    {11, 10, 8},
+    { {"xx0"_b, "unallocated"},
+      {"11x"_b, "unallocated"},
+      {"xxx"_b, "_00000000_1168"},
+    },
+  },
+
+  { "_00000000_982",
+    {9, 8},
+    { {"00"_b, "_00000000_983"},
+      {"01"_b, "_00000000_985"},
+      {"10"_b, "_00000000_988"},
+      {"11"_b, "_00000000_989"},
+    },
+  },
+
+  { "_00000000_983",
+    {28},
+    { {"1"_b, "_00000000_984"},
+      {"x"_b, "unallocated"},
+    },
+  },
+
+  { "_00000000_984",
+    {21, 20, 19, 7},
+    { {"0000"_b, "unallocated"},
+      {"xxxx"_b, "_00000000_1173"},
+    },
+  },
+
+  { "_00000000_1173",
+    {12, 0},
+    { {"00"_b, "vsri_q_t1"},
+    },
+  },
+
+  { "_00000000_985",
+    {28},
+    { {"0"_b, "_00000000_986"},
+      {"1"_b, "_00000000_987"},
+    },
+  },
+
+  { "_00000000_986",
+    {21, 20, 19, 7},
+    { {"0000"_b, "unallocated"},
+      {"xxxx"_b, "_00000000_1174"},
+    },
+  },
+
+  { "_00000000_1174",
+    {12, 0},
+    { {"00"_b, "vshl_imm_q_t1"},
+    },
+  },
+
+  { "_00000000_987",
+    {21, 20, 19, 7},
+    { {"0000"_b, "unallocated"},
+      {"xxxx"_b, "_00000000_1175"},
+    },
+  },
+
+  { "_00000000_1175",
+    {12, 0},
+    { {"00"_b, "vsli_q_t1"},
+    },
+  },
+
+  { "_00000000_988",
+    {21, 20, 19, 7},
+    { {"0000"_b, "unallocated"},
+      {"xxxx"_b, "_00000000_1176"},
+    },
+  },
+
+  { "_00000000_1176",
+    {12, 0},
+    { {"00"_b, "vqshlu_q_t1"},
+    },
+  },
+
+  { "_00000000_989",
+    {21, 20, 19, 7},
+    { {"0000"_b, "unallocated"},
+      {"xxxx"_b, "_00000000_1177"},
+    },
+  },
+
+  { "_00000000_1177",
+    {12, 0},
+    { {"00"_b, "vqshl_imm_q_t1"},
+    },
+  },
+
+  { "_00000000_990",
+    {7},
+    { {"0"_b, "_00000000_991"},
+      {"x"_b, "unallocated"},
+    },
+  },
+
+  { "_00000000_991",
+    {21, 20, 19},
+    { {"000"_b, "_00000000_992"},
+      {"xxx"_b, "_00000000_1000"},
+    },
+  },
+
+  { "_00000000_992",
+    {8},
+    { {"0"_b, "_00000000_993"},
+      {"1"_b, "_00000000_997"},
+    },
+  },
+
+  { "_00000000_993",
+    {9},
+    { {"x"_b, "_00000000_994"},
+    },
+  },
+
+  { "_00000000_994",
+    {5},
+    { {"1"_b, "_00000000_995"},
+      {"x"_b, "_00000000_996"},
+    },
+  },
+
+  { "_00000000_995",
+    {11, 10, 9, 8},
+    { {"00x1"_b, "unallocated"},
+      {"01x1"_b, "unallocated"},
+      {"10x1"_b, "unallocated"},
+      {"111x"_b, "unallocated"},
+      {"xxxx"_b, "_00000000_1165"},
+    },
+  },
+
+  { "_00000000_996",
+    {11, 10, 9, 8, 5},
+    { {"0xx10"_b, "unallocated"},
+      {"x0x10"_b, "unallocated"},
+      {"0xxx1"_b, "unallocated"},
+      {"x0xx1"_b, "unallocated"},
+      {"xx0x1"_b, "unallocated"},
+      {"xxx11"_b, "unallocated"},
+      {"xxxxx"_b, "_00000000_1166"},
+    },
+  },
+
+  { "_00000000_997",
+    {5},
+    { {"0"_b, "_00000000_998"},
+      {"1"_b, "_00000000_999"},
+    },
+  },
+
+  { "_00000000_998",
+    {11, 10, 8},
+    { {"xx0"_b, "unallocated"},
+      {"11x"_b, "unallocated"},
+      {"xxx"_b, "_00000000_1167"},
+    },
+  },
+
+  { "_00000000_999",
+    {11, 10, 8},
+    { {"xx0"_b, "unallocated"},
+      {"11x"_b, "unallocated"},
+      {"xxx"_b, "_00000000_1168"},
+    },
+  },
+
+  { "_00000000_1000",
+    {9, 8},
+    { {"00"_b, "_00000000_1001"},
+      {"01"_b, "_00000000_1004"},
+      {"xx"_b, "unallocated"},
+    },
+  },
+
+  { "_00000000_1001",
+    {28},
+    { {"0"_b, "_00000000_1002"},
+      {"1"_b, "_00000000_1003"},
+    },
+  },
+
+  { "_00000000_1002",
+    {21, 20, 19},
+    { {"000"_b, "unallocated"},
+      {"xxx"_b, "_00000000_1178"},
+    },
+  },
+
+  { "_00000000_1178",
+    {0},
+    { {"0"_b, "vrshrn_t1"},
+    },
+  },
+
+  { "_00000000_1003",
+    {21, 20, 19},
+    { {"000"_b, "unallocated"},
+      {"xxx"_b, "_00000000_1179"},
+    },
+  },
+
+  { "_00000000_1179",
+    {0},
+    { {"0"_b, "vqrshrun_t1"},
+    },
+  },
+
+  { "_00000000_1004",
+    {21, 20, 19},
+    { {"000"_b, "unallocated"},
+      {"xxx"_b, "_00000000_1180"},
+    },
+  },
+
+  { "_00000000_1180",
+    {0},
+    { {"0"_b, "vqrshrn_t1"},
+    },
+  },
+
+  { "_00000000_1005",
+    {7},
+    { {"0"_b, "_00000000_1006"},
+      {"x"_b, "unallocated"},
+    },
+  },
+
+  { "_00000000_1006",
+    {21},
+    { {"0"_b, "_00000000_1007"},
+      {"x"_b, "_00000000_1033"},
+    },
+  },
+
+  { "_00000000_1007",
+    {20, 19},
+    { {"00"_b, "_00000000_1008"},
+      {"xx"_b, "unallocated"},
+    },
+  },
+
+  { "_00000000_1008",
+    {9, 8},
+    { {"10"_b, "_00000000_1009"},
+      {"11"_b, "_00000000_1010"},
+      {"xx"_b, "_00000000_1011"},
+    },
+  },
+
+  { "_00000000_1009",
+    {11, 10, 9, 8, 5},
+    { {"0xx10"_b, "unallocated"},
+      {"x0x10"_b, "unallocated"},
+      {"0xxx1"_b, "unallocated"},
+      {"x0xx1"_b, "unallocated"},
+      {"xx0x1"_b, "unallocated"},
+      {"xxx11"_b, "unallocated"},
+      {"xxxxx"_b, "_00000000_1166"},
+    },
+  },
+
+  { "_00000000_1010",
+    {11, 10, 9, 8, 5},
+    { {"0xx10"_b, "unallocated"},
+      {"x0x10"_b, "unallocated"},
+      {"0xxx1"_b, "unallocated"},
+      {"x0xx1"_b, "unallocated"},
+      {"xx0x1"_b, "unallocated"},
+      {"xxx11"_b, "unallocated"},
+      {"xxxxx"_b, "_00000000_1166"},
+    },
+  },
+
+  { "_00000000_1011",
+    {5},
+    { {"1"_b, "_00000000_1012"},
+      {"x"_b, "_00000000_1032"},
+    },
+  },
+
+  { "_00000000_1012",
+    {11, 10, 9, 8, 5},
+    { {"00000"_b, "_00000000_1013"},
+      {"00001"_b, "_00000000_1014"},
+      {"00100"_b, "_00000000_1015"},
+      {"00101"_b, "_00000000_1016"},
+      {"01000"_b, "_00000000_1017"},
+      {"01001"_b, "_00000000_1018"},
+      {"01100"_b, "_00000000_1019"},
+      {"01101"_b, "_00000000_1020"},
+      {"10000"_b, "_00000000_1021"},
+      {"10001"_b, "_00000000_1022"},
+      {"10100"_b, "_00000000_1023"},
+      {"10101"_b, "_00000000_1024"},
+      {"11000"_b, "_00000000_1025"},
+      {"11001"_b, "_00000000_1026"},
+      {"11010"_b, "_00000000_1027"},
+      {"11011"_b, "_00000000_1028"},
+      {"11100"_b, "_00000000_1029"},
+      {"11101"_b, "_00000000_1030"},
+      {"11110"_b, "_00000000_1031"},
+      {"xxxxx"_b, "unallocated"},
+    },
+  },
+
+  { "_00000000_1013",
+    {11, 10, 9, 8, 5},
+    { {"0xx10"_b, "unallocated"},
+      {"x0x10"_b, "unallocated"},
+      {"0xxx1"_b, "unallocated"},
+      {"x0xx1"_b, "unallocated"},
+      {"xx0x1"_b, "unallocated"},
+      {"xxx11"_b, "unallocated"},
+      {"xxxxx"_b, "_00000000_1166"},
+    },
+  },
+
+  { "_00000000_1014",
+    {11, 10, 9, 8},
+    { {"00x1"_b, "unallocated"},
+      {"01x1"_b, "unallocated"},
+      {"10x1"_b, "unallocated"},
+      {"111x"_b, "unallocated"},
+      {"xxxx"_b, "_00000000_1165"},
+    },
+  },
+
+  { "_00000000_1015",
+    {11, 10, 9, 8, 5},
+    { {"0xx10"_b, "unallocated"},
+      {"x0x10"_b, "unallocated"},
+      {"0xxx1"_b, "unallocated"},
+      {"x0xx1"_b, "unallocated"},
+      {"xx0x1"_b, "unallocated"},
+      {"xxx11"_b, "unallocated"},
+      {"xxxxx"_b, "_00000000_1166"},
+    },
+  },
+
+  { "_00000000_1016",
+    {11, 10, 9, 8},
+    { {"00x1"_b, "unallocated"},
+      {"01x1"_b, "unallocated"},
+      {"10x1"_b, "unallocated"},
+      {"111x"_b, "unallocated"},
+      {"xxxx"_b, "_00000000_1165"},
+    },
+  },
+
+  { "_00000000_1017",
+    {11, 10, 9, 8, 5},
+    { {"0xx10"_b, "unallocated"},
+      {"x0x10"_b, "unallocated"},
+      {"0xxx1"_b, "unallocated"},
+      {"x0xx1"_b, "unallocated"},
+      {"xx0x1"_b, "unallocated"},
+      {"xxx11"_b, "unallocated"},
+      {"xxxxx"_b, "_00000000_1166"},
+    },
+  },
+
+  { "_00000000_1018",
+    {11, 10, 9, 8},
+    { {"00x1"_b, "unallocated"},
+      {"01x1"_b, "unallocated"},
+      {"10x1"_b, "unallocated"},
+      {"111x"_b, "unallocated"},
+      {"xxxx"_b, "_00000000_1165"},
+    },
+  },
+
+  { "_00000000_1019",
+    {11, 10, 9, 8, 5},
+    { {"0xx10"_b, "unallocated"},
+      {"x0x10"_b, "unallocated"},
+      {"0xxx1"_b, "unallocated"},
+      {"x0xx1"_b, "unallocated"},
+      {"xx0x1"_b, "unallocated"},
+      {"xxx11"_b, "unallocated"},
+      {"xxxxx"_b, "_00000000_1166"},
+    },
+  },
+
+  { "_00000000_1020",
+    {11, 10, 9, 8},
+    { {"00x1"_b, "unallocated"},
+      {"01x1"_b, "unallocated"},
+      {"10x1"_b, "unallocated"},
+      {"111x"_b, "unallocated"},
+      {"xxxx"_b, "_00000000_1165"},
+    },
+  },
+
+  { "_00000000_1021",
+    {11, 10, 9, 8, 5},
+    { {"0xx10"_b, "unallocated"},
+      {"x0x10"_b, "unallocated"},
+      {"0xxx1"_b, "unallocated"},
+      {"x0xx1"_b, "unallocated"},
+      {"xx0x1"_b, "unallocated"},
+      {"xxx11"_b, "unallocated"},
+      {"xxxxx"_b, "_00000000_1166"},
+    },
+  },
+
+  { "_00000000_1022",
+    {11, 10, 9, 8},
+    { {"00x1"_b, "unallocated"},
+      {"01x1"_b, "unallocated"},
+      {"10x1"_b, "unallocated"},
+      {"111x"_b, "unallocated"},
+      {"xxxx"_b, "_00000000_1165"},
+    },
+  },
+
+  { "_00000000_1023",
+    {11, 10, 9, 8, 5},
+    { {"0xx10"_b, "unallocated"},
+      {"x0x10"_b, "unallocated"},
+      {"0xxx1"_b, "unallocated"},
+      {"x0xx1"_b, "unallocated"},
+      {"xx0x1"_b, "unallocated"},
+      {"xxx11"_b, "unallocated"},
+      {"xxxxx"_b, "_00000000_1166"},
+    },
+  },
+
+  { "_00000000_1024",
+    {11, 10, 9, 8},
+    { {"00x1"_b, "unallocated"},
+      {"01x1"_b, "unallocated"},
+      {"10x1"_b, "unallocated"},
+      {"111x"_b, "unallocated"},
+      {"xxxx"_b, "_00000000_1165"},
+    },
+  },
+
+  { "_00000000_1025",
+    {11, 10, 9, 8, 5},
+    { {"0xx10"_b, "unallocated"},
+      {"x0x10"_b, "unallocated"},
+      {"0xxx1"_b, "unallocated"},
+      {"x0xx1"_b, "unallocated"},
+      {"xx0x1"_b, "unallocated"},
+      {"xxx11"_b, "unallocated"},
+      {"xxxxx"_b, "_00000000_1166"},
+    },
+  },
+
+  { "_00000000_1026",
+    {11, 10, 9, 8},
+    { {"00x1"_b, "unallocated"},
+      {"01x1"_b, "unallocated"},
+      {"10x1"_b, "unallocated"},
+      {"111x"_b, "unallocated"},
+      {"xxxx"_b, "_00000000_1165"},
+    },
+  },
+
+  { "_00000000_1027",
+    {11, 10, 9, 8, 5},
+    { {"0xx10"_b, "unallocated"},
+      {"x0x10"_b, "unallocated"},
+      {"0xxx1"_b, "unallocated"},
+      {"x0xx1"_b, "unallocated"},
+      {"xx0x1"_b, "unallocated"},
+      {"xxx11"_b, "unallocated"},
+      {"xxxxx"_b, "_00000000_1166"},
+    },
+  },
+
+  { "_00000000_1028",
+    {11, 10, 9, 8},
+    { {"00x1"_b, "unallocated"},
+      {"01x1"_b, "unallocated"},
+      {"10x1"_b, "unallocated"},
+      {"111x"_b, "unallocated"},
+      {"xxxx"_b, "_00000000_1165"},
+    },
+  },
+
+  { "_00000000_1029",
+    {11, 10, 9, 8, 5},
+    { {"0xx10"_b, "unallocated"},
+      {"x0x10"_b, "unallocated"},
+      {"0xxx1"_b, "unallocated"},
+      {"x0xx1"_b, "unallocated"},
+      {"xx0x1"_b, "unallocated"},
+      {"xxx11"_b, "unallocated"},
+      {"xxxxx"_b, "_00000000_1166"},
+    },
+  },
+
+  { "_00000000_1030",
+    {11, 10, 9, 8, 5},
+    { {"0xx10"_b, "unallocated"},
+      {"x0x10"_b, "unallocated"},
+      {"0xxx1"_b, "unallocated"},
+      {"x0xx1"_b, "unallocated"},
+      {"xx0x1"_b, "unallocated"},
+      {"xxx11"_b, "unallocated"},
+      {"xxxxx"_b, "_00000000_1166"},
+    },
+  },
+
+  { "_00000000_1031",
+    {11, 10, 9, 8, 5},
+    { {"0xx10"_b, "unallocated"},
+      {"x0x10"_b, "unallocated"},
+      {"0xxx1"_b, "unallocated"},
+      {"x0xx1"_b, "unallocated"},
+      {"xx0x1"_b, "unallocated"},
+      {"xxx11"_b, "unallocated"},
+      {"xxxxx"_b, "_00000000_1166"},
+    },
+  },
+
+  { "_00000000_1032",
+    {11, 10, 9, 8, 5},
+    { {"0xx10"_b, "unallocated"},
+      {"x0x10"_b, "unallocated"},
+      {"0xxx1"_b, "unallocated"},
+      {"x0xx1"_b, "unallocated"},
+      {"xx0x1"_b, "unallocated"},
+      {"xxx11"_b, "unallocated"},
+      {"xxxxx"_b, "_00000000_1166"},
+    },
+  },
+
+  { "_00000000_1033",
+    {9},
+    { {"1"_b, "_00000000_1034"},
+      {"x"_b, "unallocated"},
+    },
+  },
+
+  { "_00000000_1034",
+    {21},
+    { {"0"_b, "unallocated"},
+      {"x"_b, "_00000000_1181"},
+    },
+  },
+
+  { "_00000000_1181",
+    {12, 0},
+    { {"00"_b, "vcvt_fx_q_t1"},
+    },
+  },
+};
+// clang-format on
+
+}  // namespace aarch32
+}  // namespace vixl
@@ -0,0 +1,1915 @@
+// Copyright 2026, VIXL authors
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//   * Redistributions of source code must retain the above copyright notice,
+//     this list of conditions and the following disclaimer.
+//   * Redistributions in binary form must reproduce the above copyright notice,
+//     this list of conditions and the following disclaimer in the documentation
+//     and/or other materials provided with the distribution.
+//   * Neither the name of ARM Limited nor the names of its contributors may be
+//     used to endorse or promote products derived from this software without
+//     specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS CONTRIBUTORS "AS IS" AND
+// ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+// WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+// This file is auto generated from decoder-constants-aarch32.h using
+// tools/generate_decoder_tables.py. Do not edit it by hand.
+
+#ifndef VIXL_AARCH32_DECODER_ENCODINGS_AARCH32_H_
+#define VIXL_AARCH32_DECODER_ENCODINGS_AARCH32_H_
+
+namespace vixl {
+namespace aarch32 {
+
+// clang-format off
+// The A32 encodings, in the order that they first appear in kA32DecodeMapping.
+enum A32Encoding {
+  kA32_unallocated,
+  kA32_blx_a2,
+  kA32_cpsie_a1,
+  kA32_cpsid_a1,
+  kA32_cps_a1,
+  kA32_setend_a1,
+  kA32_vhadd_d_a1,
+  kA32_vrhadd_d_a1,
+  kA32_vhsub_d_a1,
+  kA32_vcgt_d_a1,
+  kA32_vshl_d_a1,
+  kA32_vrshl_d_a1,
+  kA32_vmax_d_a1,
+  kA32_vabd_d_a1,
+  kA32_vpmax_a1,
+  kA32_vhadd_q_a1,
+  kA32_vrhadd_q_a1,
+  kA32_vhsub_q_a1,
+  kA32_vcgt_q_a1,
+  kA32_vshl_q_a1,
+  kA32_vrshl_q_a1,
+  kA32_vmax_q_a1,
+  kA32_vabd_q_a1,
+  kA32_vadd_d_a1,
+  kA32_vsub_d_a1,
+  kA32_vadd_q_a1,
+  kA32_vsub_q_a1,
+  kA32_vmla_d_a1,
+  kA32_vmls_d_a1,
+  kA32_vmla_q_a1,
+  kA32_vmls_q_a1,
+  kA32_vqdmulh_d_a1,
+  kA32_vqrdmulh_d_a1,
+  kA32_vqdmulh_q_a1,
+  kA32_vqrdmulh_q_a1,
+  kA32_sha1c_a1,
+  kA32_sha1p_a1,
+  kA32_sha1m_a1,
+  kA32_sha1su0_a1,
+  kA32_sha256h_a1,
+  kA32_sha256h2_a1,
+  kA32_sha256su1_a1,
+  kA32_vadd_f32_d_a1,
+  kA32_vsub_f32_d_a1,
+  kA32_vpadd_f32_a1,
+  kA32_vabd_f32_d_a1,
+  kA32_vadd_f32_q_a1,
+  kA32_vsub_f32_q_a1,
+  kA32_vabd_f32_q_a1,
+  kA32_vceq_d_a2,
+  kA32_vcge_d_a2,
+  kA32_vcgt_d_a2,
+  kA32_vceq_q_a2,
+  kA32_vcge_q_a2,
+  kA32_vcgt_q_a2,
+  kA32_vmax_f32_d_a1,
+  kA32_vmin_f32_d_a1,
+  kA32_vpmax_f32_a1,
+  kA32_vpmin_f32_a1,
+  kA32_vmax_f32_q_a1,
+  kA32_vmin_f32_q_a1,
+  kA32_vqadd_d_a1,
+  kA32_vqsub_d_a1,
+  kA32_vcge_d_a1,
+  kA32_vqshl_d_a1,
+  kA32_vqrshl_d_a1,
+  kA32_vmin_d_a1,
+  kA32_vaba_d_a1,
+  kA32_vmul_d_a1,
+  kA32_vpmin_a1,
+  kA32_vqadd_q_a1,
+  kA32_vqsub_q_a1,
+  kA32_vcge_q_a1,
+  kA32_vqshl_q_a1,
+  kA32_vqrshl_q_a1,
+  kA32_vmin_q_a1,
+  kA32_vaba_q_a1,
+  kA32_vmul_q_a1,
+  kA32_vand_d_a1,
+  kA32_vbic_d_a1,
+  kA32_vmov_d_a1,
+  kA32_vorn_d_a1,
+  kA32_veor_d_a1,
+  kA32_vbsl_d_a1,
+  kA32_vbit_d_a1,
+  kA32_vbif_d_a1,
+  kA32_vmov_q_a1,
+  kA32_vand_q_a1,
+  kA32_vbic_q_a1,
+  kA32_vorn_q_a1,
+  kA32_veor_q_a1,
+  kA32_vbsl_q_a1,
+  kA32_vbit_q_a1,
+  kA32_vbif_q_a1,
+  kA32_vtst_d_a1,
+  kA32_vceq_d_a1,
+  kA32_vtst_q_a1,
+  kA32_vceq_q_a1,
+  kA32_vpadd_a1,
+  kA32_vfma_d_a1,
+  kA32_vfms_d_a1,
+  kA32_vfma_q_a1,
+  kA32_vfms_q_a1,
+  kA32_vmla_f32_d_a1,
+  kA32_vmls_f32_d_a1,
+  kA32_vmul_f32_d_a1,
+  kA32_vmla_f32_q_a1,
+  kA32_vmls_f32_q_a1,
+  kA32_vmul_f32_q_a1,
+  kA32_vacge_d_a1,
+  kA32_vacgt_d_a1,
+  kA32_vacge_q_a1,
+  kA32_vacgt_q_a1,
+  kA32_vrecps_d_a1,
+  kA32_vrsqrts_d_a1,
+  kA32_vmaxnm_d_a1,
+  kA32_vminnm_d_a1,
+  kA32_vrecps_q_a1,
+  kA32_vrsqrts_q_a1,
+  kA32_vmaxnm_q_a1,
+  kA32_vminnm_q_a1,
+  kA32_vext_d_a1,
+  kA32_vext_q_a1,
+  kA32_vrev64_d_a1,
+  kA32_vrev32_d_a1,
+  kA32_vrev16_d_a1,
+  kA32_vcls_d_a1,
+  kA32_vclz_d_a1,
+  kA32_vrev64_q_a1,
+  kA32_vrev32_q_a1,
+  kA32_vrev16_q_a1,
+  kA32_vcls_q_a1,
+  kA32_vclz_q_a1,
+  kA32_vcnt_d_a1,
+  kA32_vcnt_q_a1,
+  kA32_vmvn_d_a1,
+  kA32_vmvn_q_a1,
+  kA32_vpaddl_d_a1,
+  kA32_vpadal_d_a1,
+  kA32_vpaddl_q_a1,
+  kA32_vpadal_q_a1,
+  kA32_aese_a1,
+  kA32_aesmc_a1,
+  kA32_aesd_a1,
+  kA32_aesimc_a1,
+  kA32_vqabs_d_a1,
+  kA32_vqneg_d_a1,
+  kA32_vqabs_q_a1,
+  kA32_vqneg_q_a1,
+  kA32_vcgt_imm_d_a1,
+  kA32_vcge_imm_d_a1,
+  kA32_vceq_imm_d_a1,
+  kA32_vcle_d_a1,
+  kA32_vcgt_imm_q_a1,
+  kA32_vcge_imm_q_a1,
+  kA32_vceq_imm_q_a1,
+  kA32_vcle_q_a1,
+  kA32_vclt_d_a1,
+  kA32_vabs_d_a1,
+  kA32_vneg_d_a1,
+  kA32_vclt_q_a1,
+  kA32_vabs_q_a1,
+  kA32_vneg_q_a1,
+  kA32_sha1h_a1,
+  kA32_vtrn_d_a1,
+  kA32_vuzp_d_a1,
+  kA32_vzip_d_a1,
+  kA32_vrintn_d_a1,
+  kA32_vrintx_d_a1,
+  kA32_vrinta_d_a1,
+  kA32_vrintz_d_a1,
+  kA32_vtrn_q_a1,
+  kA32_vuzp_q_a1,
+  kA32_vzip_q_a1,
+  kA32_vrintn_q_a1,
+  kA32_vrintx_q_a1,
+  kA32_vrinta_q_a1,
+  kA32_vrintz_q_a1,
+  kA32_vswp_d_a1,
+  kA32_vswp_q_a1,
+  kA32_vqmovn_a1,
+  kA32_vmovn_a1,
+  kA32_vqmovun_a1,
+  kA32_vshll_a2,
+  kA32_sha1su1_a1,
+  kA32_sha256su0_a1,
+  kA32_vcvt_f16_f32_a1,
+  kA32_vrintm_d_a1,
+  kA32_vrintm_q_a1,
+  kA32_vcvt_f32_f16_a1,
+  kA32_vrintp_d_a1,
+  kA32_vrintp_q_a1,
+  kA32_vcvta_int_f32_d_a1,
+  kA32_vcvtn_int_f32_d_a1,
+  kA32_vcvta_int_f32_q_a1,
+  kA32_vcvtn_int_f32_q_a1,
+  kA32_vrecpe_d_a1,
+  kA32_vrsqrte_d_a1,
+  kA32_vrecpe_q_a1,
+  kA32_vrsqrte_q_a1,
+  kA32_vcvt_d_a1,
+  kA32_vcvt_q_a1,
+  kA32_vcvtp_int_f32_d_a1,
+  kA32_vcvtm_int_f32_d_a1,
+  kA32_vcvtp_int_f32_q_a1,
+  kA32_vcvtm_int_f32_q_a1,
+  kA32_vtbl_a1,
+  kA32_vtbx_a1,
+  kA32_vdup_scalar_d_a1,
+  kA32_vdup_scalar_q_a1,
+  kA32_vaddl_a1,
+  kA32_vaddw_a1,
+  kA32_vsubl_a1,
+  kA32_vsubw_a1,
+  kA32_vmla_scalar_d_a1,
+  kA32_vmla_scalar_q_a1,
+  kA32_vmlal_scalar_a1,
+  kA32_vqdmlal_a2,
+  kA32_vaddhn_a1,
+  kA32_vraddhn_a1,
+  kA32_vabal_a1,
+  kA32_vsubhn_a1,
+  kA32_vrsubhn_a1,
+  kA32_vabdl_a1,
+  kA32_vmls_scalar_d_a1,
+  kA32_vmls_scalar_q_a1,
+  kA32_vmlsl_scalar_a1,
+  kA32_vqdmlsl_a2,
+  kA32_vmlal_a1,
+  kA32_vqdmlal_a1,
+  kA32_vmlsl_a1,
+  kA32_vqdmlsl_a1,
+  kA32_vmul_scalar_d_a1,
+  kA32_vmul_scalar_q_a1,
+  kA32_vmull_scalar_a1,
+  kA32_vqdmull_a2,
+  kA32_vmull_a1,
+  kA32_vqdmull_a1,
+  kA32_vqdmulh_d_a2,
+  kA32_vqrdmulh_d_a2,
+  kA32_vqdmulh_q_a2,
+  kA32_vqrdmulh_q_a2,
+  kA32_vmvn_imm_d_a1,
+  kA32_vmov_imm_d_a1,
+  kA32_vorr_d_a1,
+  kA32_vbic_imm_d_a1,
+  kA32_vshr_d_a1,
+  kA32_vsra_d_a1,
+  kA32_vrshr_d_a1,
+  kA32_vrsra_d_a1,
+  kA32_vsri_d_a1,
+  kA32_vshl_imm_d_a1,
+  kA32_vsli_d_a1,
+  kA32_vqshlu_d_a1,
+  kA32_vqshl_imm_d_a1,
+  kA32_vshrn_a1,
+  kA32_vqshrun_a1,
+  kA32_vqshrn_a1,
+  kA32_vshll_a1,
+  kA32_vmovl_a1,
+  kA32_vcvt_fx_d_a1,
+  kA32_vmvn_imm_q_a1,
+  kA32_vmov_imm_q_a1,
+  kA32_vorr_q_a1,
+  kA32_vbic_imm_q_a1,
+  kA32_vshr_q_a1,
+  kA32_vsra_q_a1,
+  kA32_vrshr_q_a1,
+  kA32_vrsra_q_a1,
+  kA32_vsri_q_a1,
+  kA32_vshl_imm_q_a1,
+  kA32_vsli_q_a1,
+  kA32_vqshlu_q_a1,
+  kA32_vqshl_imm_q_a1,
+  kA32_vrshrn_a1,
+  kA32_vqrshrun_a1,
+  kA32_vqrshrn_a1,
+  kA32_vcvt_fx_q_a1,
+  kA32_vst4_multi_wb_a1,
+  kA32_vst1_multi_wb_a1,
+  kA32_vst2_multi_wb_a1,
+  kA32_vst3_multi_wb_a1,
+  kA32_vst4_multi_off_a1,
+  kA32_vst1_multi_off_a1,
+  kA32_vst2_multi_off_a1,
+  kA32_vst3_multi_off_a1,
+  kA32_vst4_multi_post_a1,
+  kA32_vst1_multi_post_a1,
+  kA32_vst2_multi_post_a1,
+  kA32_vst3_multi_post_a1,
+  kA32_vst1_lane_wb_a1,
+  kA32_vst1_lane_off_a1,
+  kA32_vst1_lane_post_a1,
+  kA32_vst2_lane_wb_a1,
+  kA32_vst2_lane_off_a1,
+  kA32_vst2_lane_post_a1,
+  kA32_vst3_lane_wb_a1,
+  kA32_vst3_lane_off_a1,
+  kA32_vst3_lane_post_a1,
+  kA32_vst4_lane_wb_a1,
+  kA32_vst4_lane_off_a1,
+  kA32_vst4_lane_post_a1,
+  kA32_pli_lit_a1,
+  kA32_pli_imm_a1,
+  kA32_vld4_multi_wb_a1,
+  kA32_vld3_multi_wb_a1,
+  kA32_vld1_multi_wb_a1,
+  kA32_vld2_multi_wb_a1,
+  kA32_vld4_multi_off_a1,
+  kA32_vld3_multi_off_a1,
+  kA32_vld1_multi_off_a1,
+  kA32_vld2_multi_off_a1,
+  kA32_vld4_multi_post_a1,
+  kA32_vld1_multi_post_a1,
+  kA32_vld2_multi_post_a1,
+  kA32_vld3_multi_post_a1,
+  kA32_vld1_all_wb_a1,
+  kA32_vld1_all_off_a1,
+  kA32_vld1_all_post_a1,
+  kA32_vld1_lane_wb_a1,
+  kA32_vld1_lane_off_a1,
+  kA32_vld1_lane_post_a1,
+  kA32_vld2_all_wb_a1,
+  kA32_vld2_all_off_a1,
+  kA32_vld2_all_post_a1,
+  kA32_vld2_lane_wb_a1,
+  kA32_vld2_lane_off_a1,
+  kA32_vld2_lane_post_a1,
+  kA32_vld3_all_wb_a1,
+  kA32_vld3_all_off_a1,
+  kA32_vld3_all_post_a1,
+  kA32_vld3_lane_wb_a1,
+  kA32_vld3_lane_off_a1,
+  kA32_vld3_lane_post_a1,
+  kA32_vld4_all_wb_a1,
+  kA32_vld4_all_off_a1,
+  kA32_vld4_all_post_a1,
+  kA32_vld4_lane_wb_a1,
+  kA32_vld4_lane_off_a1,
+  kA32_vld4_lane_post_a1,
+  kA32_pld_lit_a1,
+  kA32_pldw_imm_a1,
+  kA32_pld_imm_a1,
+  kA32_clrex_a1,
+  kA32_dsb_a1,
+  kA32_dmb_a1,
+  kA32_isb_a1,
+  kA32_pli_rrx_a1,
+  kA32_pli_reg_a1,
+  kA32_pldw_rrx_a1,
+  kA32_pldw_reg_a1,
+  kA32_pld_rrx_a1,
+  kA32_pld_reg_a1,
+  kA32_rfeda_a1,
+  kA32_srsda_a1,
+  kA32_rfeia_a1,
+  kA32_srsia_a1,
+  kA32_rfedb_a1,
+  kA32_srsdb_a1,
+  kA32_rfeib_a1,
+  kA32_srsib_a1,
+  kA32_vseleq_f32_a1,
+  kA32_vseleq_f64_a1,
+  kA32_vselvs_f32_a1,
+  kA32_vselvs_f64_a1,
+  kA32_vselge_f32_a1,
+  kA32_vselge_f64_a1,
+  kA32_vselgt_f32_a1,
+  kA32_vselgt_f64_a1,
+  kA32_vmaxnm_f32_a2,
+  kA32_vminnm_f32_a2,
+  kA32_vmaxnm_f64_a2,
+  kA32_vminnm_f64_a2,
+  kA32_vcvta_int_f32_s_a1,
+  kA32_vcvtn_int_f32_s_a1,
+  kA32_vcvtp_int_f32_s_a1,
+  kA32_vcvtm_int_f32_s_a1,
+  kA32_vrinta_f32_a1,
+  kA32_vrintn_f32_a1,
+  kA32_vrintp_f32_a1,
+  kA32_vrintm_f32_a1,
+  kA32_vcvta_int_f64_a1,
+  kA32_vcvtn_int_f64_a1,
+  kA32_vcvtp_int_f64_a1,
+  kA32_vcvtm_int_f64_a1,
+  kA32_vrinta_f64_a1,
+  kA32_vrintn_f64_a1,
+  kA32_vrintp_f64_a1,
+  kA32_vrintm_f64_a1,
+  kA32_and_rrx_a1,
+  kA32_and_reg_a1,
+  kA32_sub_sp_rrx_a1,
+  kA32_sub_sp_reg_a1,
+  kA32_sub_rrx_a1,
+  kA32_sub_reg_a1,
+  kA32_eor_rrx_a1,
+  kA32_eor_reg_a1,
+  kA32_rsb_rrx_a1,
+  kA32_rsb_reg_a1,
+  kA32_add_sp_rrx_a1,
+  kA32_add_sp_reg_a1,
+  kA32_add_rrx_a1,
+  kA32_add_reg_a1,
+  kA32_sbc_rrx_a1,
+  kA32_sbc_reg_a1,
+  kA32_adc_rrx_a1,
+  kA32_adc_reg_a1,
+  kA32_rsc_rrx_a1,
+  kA32_rsc_reg_a1,
+  kA32_mrs_a1,
+  kA32_mrs_banked_a1,
+  kA32_crc32b_a1,
+  kA32_crc32cb_a1,
+  kA32_crc32w_a1,
+  kA32_crc32cw_a1,
+  kA32_smlabb_a1,
+  kA32_smlalbb_a1,
+  kA32_smlatb_a1,
+  kA32_smlaltb_a1,
+  kA32_smlabt_a1,
+  kA32_smlalbt_a1,
+  kA32_smlatt_a1,
+  kA32_smlaltt_a1,
+  kA32_msr_reg_a1,
+  kA32_msr_banked_a1,
+  kA32_bxj_a1,
+  kA32_crc32h_a1,
+  kA32_crc32ch_a1,
+  kA32_eret_a1,
+  kA32_smlawb_a1,
+  kA32_smulbb_a1,
+  kA32_smulwb_a1,
+  kA32_smultb_a1,
+  kA32_smlawt_a1,
+  kA32_smulbt_a1,
+  kA32_smulwt_a1,
+  kA32_smultt_a1,
+  kA32_orr_rrx_a1,
+  kA32_orr_reg_a1,
+  kA32_bic_rrx_a1,
+  kA32_bic_reg_a1,
+  kA32_mov_rrx_a1,
+  kA32_rrx_a1,
+  kA32_asr_imm_a1,
+  kA32_lsr_imm_a1,
+  kA32_mov_reg_a1,
+  kA32_ror_imm_a1,
+  kA32_lsl_imm_a1,
+  kA32_mvn_rrx_a1,
+  kA32_mvn_reg_a1,
+  kA32_and_rsr_a1,
+  kA32_eor_rsr_a1,
+  kA32_add_rsr_a1,
+  kA32_adc_rsr_a1,
+  kA32_qadd_a1,
+  kA32_hlt_a1,
+  kA32_bx_a1,
+  kA32_blx_a1,
+  kA32_qsub_a1,
+  kA32_bkpt_a1,
+  kA32_orr_rsr_a1,
+  kA32_asr_reg_a1,
+  kA32_lsl_reg_a1,
+  kA32_lsr_reg_a1,
+  kA32_mov_rsr_a1,
+  kA32_ror_reg_a1,
+  kA32_mul_a1,
+  kA32_umull_a1,
+  kA32_strh_reg_post_a1,
+  kA32_ldrd_reg_post_a1,
+  kA32_strd_reg_post_a1,
+  kA32_mla_a1,
+  kA32_umlal_a1,
+  kA32_strht_a2,
+  kA32_stl_a1,
+  kA32_stlex_a1,
+  kA32_strex_a1,
+  kA32_strh_reg_off_a1,
+  kA32_ldrd_reg_off_a1,
+  kA32_strd_reg_off_a1,
+  kA32_stlexd_a1,
+  kA32_strexd_a1,
+  kA32_strh_reg_pre_a1,
+  kA32_ldrd_reg_pre_a1,
+  kA32_strd_reg_pre_a1,
+  kA32_sub_rsr_a1,
+  kA32_rsb_rsr_a1,
+  kA32_sbc_rsr_a1,
+  kA32_rsc_rsr_a1,
+  kA32_qdadd_a1,
+  kA32_hvc_a1,
+  kA32_clz_a1,
+  kA32_qdsub_a1,
+  kA32_smc_a1,
+  kA32_bic_rsr_a1,
+  kA32_mvn_rsr_a1,
+  kA32_umaal_a1,
+  kA32_mls_a1,
+  kA32_smull_a1,
+  kA32_smlal_a1,
+  kA32_stlb_a1,
+  kA32_stlexb_a1,
+  kA32_strexb_a1,
+  kA32_stlh_a1,
+  kA32_stlexh_a1,
+  kA32_strexh_a1,
+  kA32_strh_imm_post_a1,
+  kA32_strht_a1,
+  kA32_strh_imm_off_a1,
+  kA32_strh_imm_pre_a1,
+  kA32_ldrd_lit_a1,
+  kA32_ldrd_imm_post_a1,
+  kA32_ldrd_imm_off_a1,
+  kA32_ldrd_imm_pre_a1,
+  kA32_strd_imm_post_a1,
+  kA32_strd_imm_off_a1,
+  kA32_strd_imm_pre_a1,
+  kA32_ands_rrx_a1,
+  kA32_ands_reg_a1,
+  kA32_eors_rrx_a1,
+  kA32_eors_reg_a1,
+  kA32_subs_sp_rrx_a1,
+  kA32_subs_sp_reg_a1,
+  kA32_subs_rrx_a1,
+  kA32_subs_reg_a1,
+  kA32_rsbs_rrx_a1,
+  kA32_rsbs_reg_a1,
+  kA32_adds_sp_rrx_a1,
+  kA32_adds_sp_reg_a1,
+  kA32_adds_rrx_a1,
+  kA32_adds_reg_a1,
+  kA32_adcs_rrx_a1,
+  kA32_adcs_reg_a1,
+  kA32_sbcs_rrx_a1,
+  kA32_sbcs_reg_a1,
+  kA32_rscs_rrx_a1,
+  kA32_rscs_reg_a1,
+  kA32_tst_rrx_a1,
+  kA32_tst_reg_a1,
+  kA32_teq_rrx_a1,
+  kA32_teq_reg_a1,
+  kA32_cmp_rrx_a1,
+  kA32_cmp_reg_a1,
+  kA32_cmn_rrx_a1,
+  kA32_cmn_reg_a1,
+  kA32_orrs_rrx_a1,
+  kA32_orrs_reg_a1,
+  kA32_movs_rrx_a1,
+  kA32_rrxs_a1,
+  kA32_asrs_imm_a1,
+  kA32_lsrs_imm_a1,
+  kA32_movs_reg_a1,
+  kA32_rors_imm_a1,
+  kA32_lsls_imm_a1,
+  kA32_bics_rrx_a1,
+  kA32_bics_reg_a1,
+  kA32_mvns_rrx_a1,
+  kA32_mvns_reg_a1,
+  kA32_ands_rsr_a1,
+  kA32_eors_rsr_a1,
+  kA32_adds_rsr_a1,
+  kA32_adcs_rsr_a1,
+  kA32_tst_rsr_a1,
+  kA32_teq_rsr_a1,
+  kA32_orrs_rsr_a1,
+  kA32_asrs_reg_a1,
+  kA32_lsls_reg_a1,
+  kA32_lsrs_reg_a1,
+  kA32_movs_rsr_a1,
+  kA32_rors_reg_a1,
+  kA32_muls_a1,
+  kA32_umulls_a1,
+  kA32_ldrh_reg_post_a1,
+  kA32_ldrsb_reg_post_a1,
+  kA32_ldrsh_reg_post_a1,
+  kA32_mlas_a1,
+  kA32_umlals_a1,
+  kA32_ldrht_a2,
+  kA32_ldrsbt_a2,
+  kA32_ldrsht_a2,
+  kA32_lda_a1,
+  kA32_ldaex_a1,
+  kA32_ldrex_a1,
+  kA32_ldrh_reg_off_a1,
+  kA32_ldrsb_reg_off_a1,
+  kA32_ldrsh_reg_off_a1,
+  kA32_ldaexd_a1,
+  kA32_ldrexd_a1,
+  kA32_ldrh_reg_pre_a1,
+  kA32_ldrsb_reg_pre_a1,
+  kA32_ldrsh_reg_pre_a1,
+  kA32_subs_rsr_a1,
+  kA32_rsbs_rsr_a1,
+  kA32_sbcs_rsr_a1,
+  kA32_rscs_rsr_a1,
+  kA32_cmp_rsr_a1,
+  kA32_cmn_rsr_a1,
+  kA32_bics_rsr_a1,
+  kA32_mvns_rsr_a1,
+  kA32_smulls_a1,
+  kA32_smlals_a1,
+  kA32_ldab_a1,
+  kA32_ldaexb_a1,
+  kA32_ldrexb_a1,
+  kA32_ldah_a1,
+  kA32_ldaexh_a1,
+  kA32_ldrexh_a1,
+  kA32_ldrh_lit_a1,
+  kA32_ldrh_imm_post_a1,
+  kA32_ldrht_a1,
+  kA32_ldrh_imm_off_a1,
+  kA32_ldrh_imm_pre_a1,
+  kA32_ldrsb_lit_a1,
+  kA32_ldrsb_imm_post_a1,
+  kA32_ldrsbt_a1,
+  kA32_ldrsb_imm_off_a1,
+  kA32_ldrsb_imm_pre_a1,
+  kA32_ldrsh_lit_a1,
+  kA32_ldrsh_imm_post_a1,
+  kA32_ldrsht_a1,
+  kA32_ldrsh_imm_off_a1,
+  kA32_ldrsh_imm_pre_a1,
+  kA32_and_imm_a1,
+  kA32_sub_sp_imm_a1,
+  kA32_sub_a2,
+  kA32_adr_a2,
+  kA32_sub_imm_a1,
+  kA32_ands_imm_a1,
+  kA32_subs_sp_imm_a1,
+  kA32_subs_imm_a1,
+  kA32_eor_imm_a1,
+  kA32_rsb_imm_a1,
+  kA32_eors_imm_a1,
+  kA32_rsbs_imm_a1,
+  kA32_add_sp_imm_a1,
+  kA32_adr_a1,
+  kA32_add_imm_a1,
+  kA32_sbc_imm_a1,
+  kA32_adds_sp_imm_a1,
+  kA32_adds_imm_a1,
+  kA32_sbcs_imm_a1,
+  kA32_adc_imm_a1,
+  kA32_rsc_imm_a1,
+  kA32_adcs_imm_a1,
+  kA32_rscs_imm_a1,
+  kA32_mov_a2,
+  kA32_movt_a1,
+  kA32_tst_imm_a1,
+  kA32_cmp_imm_a1,
+  kA32_nop_a1,
+  kA32_yield_a1,
+  kA32_wfe_a1,
+  kA32_wfi_a1,
+  kA32_sev_a1,
+  kA32_sevl_a1,
+  kA32_dbg_a1,
+  kA32_msr_imm_a1,
+  kA32_teq_imm_a1,
+  kA32_cmn_imm_a1,
+  kA32_orr_imm_a1,
+  kA32_bic_imm_a1,
+  kA32_orrs_imm_a1,
+  kA32_bics_imm_a1,
+  kA32_mov_imm_a1,
+  kA32_mvn_imm_a1,
+  kA32_movs_imm_a1,
+  kA32_mvns_imm_a1,
+  kA32_str_imm_post_a1,
+  kA32_strt_a1,
+  kA32_str_imm_off_a1,
+  kA32_push_single_a1,
+  kA32_str_imm_pre_a1,
+  kA32_ldr_lit_a1,
+  kA32_pop_single_a1,
+  kA32_ldr_imm_post_a1,
+  kA32_ldrt_a1,
+  kA32_ldr_imm_off_a1,
+  kA32_ldr_imm_pre_a1,
+  kA32_strb_imm_post_a1,
+  kA32_strbt_a1,
+  kA32_strb_imm_off_a1,
+  kA32_strb_imm_pre_a1,
+  kA32_ldrb_lit_a1,
+  kA32_ldrb_imm_post_a1,
+  kA32_ldrbt_a1,
+  kA32_ldrb_imm_off_a1,
+  kA32_ldrb_imm_pre_a1,
+  kA32_str_reg_post_a1,
+  kA32_ldr_reg_post_a1,
+  kA32_sadd16_a1,
+  kA32_sadd8_a1,
+  kA32_sasx_a1,
+  kA32_ssax_a1,
+  kA32_ssub16_a1,
+  kA32_ssub8_a1,
+  kA32_pkhbt_a1,
+  kA32_sel_a1,
+  kA32_pkhtb_a1,
+  kA32_sxtb16_a1,
+  kA32_sxtab16_a1,
+  kA32_strt_a2,
+  kA32_ldrt_a2,
+  kA32_qadd16_a1,
+  kA32_qadd8_a1,
+  kA32_shadd16_a1,
+  kA32_shadd8_a1,
+  kA32_qasx_a1,
+  kA32_shasx_a1,
+  kA32_qsax_a1,
+  kA32_shsax_a1,
+  kA32_qsub16_a1,
+  kA32_qsub8_a1,
+  kA32_shsub16_a1,
+  kA32_shsub8_a1,
+  kA32_ssat_lsl_a1,
+  kA32_ssat16_a1,
+  kA32_rev_a1,
+  kA32_rev16_a1,
+  kA32_ssat_asr_a1,
+  kA32_sxtb_a1,
+  kA32_sxtab_a1,
+  kA32_sxth_a1,
+  kA32_sxtah_a1,
+  kA32_strb_reg_post_a1,
+  kA32_ldrb_reg_post_a1,
+  kA32_uadd16_a1,
+  kA32_uasx_a1,
+  kA32_usax_a1,
+  kA32_usub16_a1,
+  kA32_uadd8_a1,
+  kA32_usub8_a1,
+  kA32_uxtb16_a1,
+  kA32_uxtab16_a1,
+  kA32_strbt_a2,
+  kA32_ldrbt_a2,
+  kA32_uqadd16_a1,
+  kA32_uqadd8_a1,
+  kA32_uhadd16_a1,
+  kA32_uhadd8_a1,
+  kA32_uqasx_a1,
+  kA32_uhasx_a1,
+  kA32_uqsax_a1,
+  kA32_uhsax_a1,
+  kA32_uqsub16_a1,
+  kA32_uqsub8_a1,
+  kA32_uhsub16_a1,
+  kA32_uhsub8_a1,
+  kA32_usat_lsl_a1,
+  kA32_usat16_a1,
+  kA32_rbit_a1,
+  kA32_revsh_a1,
+  kA32_usat_asr_a1,
+  kA32_uxtb_a1,
+  kA32_uxtab_a1,
+  kA32_uxth_a1,
+  kA32_uxtah_a1,
+  kA32_str_reg_off_a1,
+  kA32_ldr_reg_off_a1,
+  kA32_smuad_a1,
+  kA32_smlad_a1,
+  kA32_smuadx_a1,
+  kA32_smladx_a1,
+  kA32_smusd_a1,
+  kA32_smlsd_a1,
+  kA32_smusdx_a1,
+  kA32_smlsdx_a1,
+  kA32_sdiv_a1,
+  kA32_usad8_a1,
+  kA32_usada8_a1,
+  kA32_str_reg_pre_a1,
+  kA32_ldr_reg_pre_a1,
+  kA32_udiv_a1,
+  kA32_sbfx_a1,
+  kA32_strb_reg_off_a1,
+  kA32_ldrb_reg_off_a1,
+  kA32_smlald_a1,
+  kA32_smmul_a1,
+  kA32_smmla_a1,
+  kA32_smlaldx_a1,
+  kA32_smmulr_a1,
+  kA32_smmlar_a1,
+  kA32_smlsld_a1,
+  kA32_smmls_a1,
+  kA32_smlsldx_a1,
+  kA32_smmlsr_a1,
+  kA32_bfc_a1,
+  kA32_bfi_a1,
+  kA32_strb_reg_pre_a1,
+  kA32_ldrb_reg_pre_a1,
+  kA32_ubfx_a1,
+  kA32_udf_a1,
+  kA32_stmda_a1,
+  kA32_stm_a1,
+  kA32_push_list_a1,
+  kA32_stmib_a1,
+  kA32_ldmda_a1,
+  kA32_pop_list_a1,
+  kA32_ldmdb_a1,
+  kA32_ldmib_a1,
+  kA32_stm_usr_a1,
+  kA32_ldm_usr_a1,
+  kA32_ldm_eret_a1,
+  kA32_b_a1,
+  kA32_bl_a1,
+  kA32_vmov_ss_rr_a1,
+  kA32_vmov_d_rr_a1,
+  kA32_vstm_a2,
+  kA32_vstm_a1,
+  kA32_fstmiax_a1,
+  kA32_stc_a1,
+  kA32_mcrr_a1,
+  kA32_vmov_rr_ss_a1,
+  kA32_vmov_rr_d_a1,
+  kA32_vldm_a2,
+  kA32_vpop_a2,
+  kA32_vldm_a1,
+  kA32_vpop_a1,
+  kA32_fldmiax_a1,
+  kA32_ldc_lit_a1,
+  kA32_ldc_imm_a1,
+  kA32_mrrc_a1,
+  kA32_vstr_a2,
+  kA32_vstr_a1,
+  kA32_vstmdb_a2,
+  kA32_vpush_a2,
+  kA32_vstmdb_a1,
+  kA32_vpush_a1,
+  kA32_fstmdbx_a1,
+  kA32_vldr_lit_a2,
+  kA32_vldr_imm_a2,
+  kA32_vldr_lit_a1,
+  kA32_vldr_imm_a1,
+  kA32_vldmdb_a2,
+  kA32_vldmdb_a1,
+  kA32_fldmdbx_a1,
+  kA32_vmla_f32_a2,
+  kA32_vmls_f32_a2,
+  kA32_vmla_f64_a2,
+  kA32_vmls_f64_a2,
+  kA32_vmul_f32_a2,
+  kA32_vnmul_f32_a1,
+  kA32_vmul_f64_a2,
+  kA32_vnmul_f64_a1,
+  kA32_vdiv_f32_a1,
+  kA32_vdiv_f64_a1,
+  kA32_vfma_f32_a2,
+  kA32_vfms_f32_a2,
+  kA32_vfma_f64_a2,
+  kA32_vfms_f64_a2,
+  kA32_vmov_s_r_a1,
+  kA32_vmov_scalar_r_a1,
+  kA32_vmsr_a1,
+  kA32_vdup_d_a1,
+  kA32_vdup_q_a1,
+  kA32_mcr_a1,
+  kA32_vnmls_f32_a1,
+  kA32_vnmla_f32_a1,
+  kA32_vnmls_f64_a1,
+  kA32_vnmla_f64_a1,
+  kA32_vadd_f32_a2,
+  kA32_vsub_f32_a2,
+  kA32_vadd_f64_a2,
+  kA32_vsub_f64_a2,
+  kA32_vfnms_f32_a1,
+  kA32_vfnma_f32_a1,
+  kA32_vfnms_f64_a1,
+  kA32_vfnma_f64_a1,
+  kA32_vmov_imm_f32_a2,
+  kA32_vmov_f32_a2,
+  kA32_vabs_f32_a2,
+  kA32_vneg_f32_a2,
+  kA32_vsqrt_f32_a1,
+  kA32_vcvtb_f32_f16_a1,
+  kA32_vcvtt_f32_f16_a1,
+  kA32_vcvtb_f16_f32_a1,
+  kA32_vcvtt_f16_f32_a1,
+  kA32_vcmp_f32_a1,
+  kA32_vcmpe_f32_a1,
+  kA32_vcmp_f32_a2,
+  kA32_vcmpe_f32_a2,
+  kA32_vrintr_f32_a1,
+  kA32_vrintz_f32_a1,
+  kA32_vrintx_f32_a1,
+  kA32_vcvt_f64_f32_a1,
+  kA32_vcvt_f32_int_a1,
+  kA32_vcvt_f32_fx_a1,
+  kA32_vcvtr_u32_f32_a1,
+  kA32_vcvt_u32_f32_a1,
+  kA32_vcvtr_s32_f32_a1,
+  kA32_vcvt_s32_f32_a1,
+  kA32_vcvt_fx_f32_a1,
+  kA32_vmov_imm_f64_a2,
+  kA32_vmov_f64_a2,
+  kA32_vabs_f64_a2,
+  kA32_vneg_f64_a2,
+  kA32_vsqrt_f64_a1,
+  kA32_vcvtb_f64_f16_a1,
+  kA32_vcvtt_f64_f16_a1,
+  kA32_vcvtb_f16_f64_a1,
+  kA32_vcvtt_f16_f64_a1,
+  kA32_vcmp_f64_a1,
+  kA32_vcmpe_f64_a1,
+  kA32_vcmp_f64_a2,
+  kA32_vcmpe_f64_a2,
+  kA32_vrintr_f64_a1,
+  kA32_vrintz_f64_a1,
+  kA32_vrintx_f64_a1,
+  kA32_vcvt_f32_f64_a1,
+  kA32_vcvt_f64_int_a1,
+  kA32_vcvt_f64_fx_a1,
+  kA32_vcvtr_u32_f64_a1,
+  kA32_vcvt_u32_f64_a1,
+  kA32_vcvtr_s32_f64_a1,
+  kA32_vcvt_s32_f64_a1,
+  kA32_vcvt_fx_f64_a1,
+  kA32_vmov_r_s_a1,
+  kA32_vmrs_a1,
+  kA32_vmov_r_scalar_a1,
+  kA32_mrc_a1,
+  kA32_svc_a1,
+};
+
+const unsigned kA32EncodingCount = 920;
+
+// The T32 encodings, in the order that they first appear in kT32DecodeMapping.
+enum T32Encoding {
+  kT32_unallocated,
+  kT32_add_reg_t1,
+  kT32_sub_reg_t1,
+  kT32_add_imm_t1,
+  kT32_sub_imm_t1,
+  kT32_asr_imm_t2,
+  kT32_lsr_imm_t2,
+  kT32_mov_reg_t2,
+  kT32_lsl_imm_t2,
+  kT32_mov_imm_t1,
+  kT32_cmp_imm_t1,
+  kT32_add_imm_t2,
+  kT32_sub_imm_t2,
+  kT32_ldr_lit_t1,
+  kT32_cmp_reg_t2,
+  kT32_mov_reg_t1,
+  kT32_and_reg_t1,
+  kT32_eor_reg_t1,
+  kT32_lsl_t1,
+  kT32_lsr_t1,
+  kT32_asr_t1,
+  kT32_adc_reg_t1,
+  kT32_sbc_reg_t1,
+  kT32_ror_t1,
+  kT32_tst_reg_t1,
+  kT32_rsb_imm_t1,
+  kT32_cmp_reg_t1,
+  kT32_cmn_reg_t1,
+  kT32_orr_reg_t1,
+  kT32_mul_t1,
+  kT32_bic_reg_t1,
+  kT32_mvn_reg_t1,
+  kT32_add_sp_t1,
+  kT32_add_sp_reg_t2,
+  kT32_add_reg_t2,
+  kT32_bx_t1,
+  kT32_blx_t1,
+  kT32_str_reg_t1,
+  kT32_strh_reg_t1,
+  kT32_strb_reg_t1,
+  kT32_ldrsb_reg_t1,
+  kT32_ldr_reg_t1,
+  kT32_ldrh_reg_t1,
+  kT32_ldrb_reg_t1,
+  kT32_ldrsh_reg_t1,
+  kT32_str_imm_t1,
+  kT32_ldr_imm_t1,
+  kT32_strb_imm_t1,
+  kT32_ldrb_imm_t1,
+  kT32_strh_imm_t1,
+  kT32_ldrh_imm_t1,
+  kT32_str_sp_t2,
+  kT32_ldr_sp_t2,
+  kT32_adr_t1,
+  kT32_add_sp_imm_t1,
+  kT32_cbz_t1,
+  kT32_add_sp_imm_t2,
+  kT32_sub_sp_imm_t1,
+  kT32_sxth_t1,
+  kT32_sxtb_t1,
+  kT32_uxth_t1,
+  kT32_uxtb_t1,
+  kT32_push_t1,
+  kT32_setend_t1,
+  kT32_cpsie_t1,
+  kT32_cpsid_t1,
+  kT32_cbnz_t1,
+  kT32_rev_t1,
+  kT32_rev16_t1,
+  kT32_hlt_t1,
+  kT32_revsh_t1,
+  kT32_pop_t1,
+  kT32_bkpt_t1,
+  kT32_nop_t1,
+  kT32_yield_t1,
+  kT32_wfe_t1,
+  kT32_wfi_t1,
+  kT32_sev_t1,
+  kT32_sevl_t1,
+  kT32_it_t1,
+  kT32_stm_t1,
+  kT32_ldm_t1,
+  kT32_udf_t1,
+  kT32_svc_t1,
+  kT32_b_t1,
+  kT32_b_t2,
+  kT32_and_imm_t1,
+  kT32_bic_imm_t1,
+  kT32_bics_t1,
+  kT32_eor_imm_t1,
+  kT32_adc_imm_t1,
+  kT32_adcs_t1,
+  kT32_sbc_imm_t1,
+  kT32_sbcs_t1,
+  kT32_rsb_t2,
+  kT32_rsbs_t2,
+  kT32_mov_imm_t3,
+  kT32_movt_t1,
+  kT32_ssat_lsl_t1,
+  kT32_sbfx_t1,
+  kT32_usat_lsl_t1,
+  kT32_ubfx_t1,
+  kT32_tst_imm_t1,
+  kT32_ands_t1,
+  kT32_mov_imm_t2,
+  kT32_orr_imm_t1,
+  kT32_movs_imm_t2,
+  kT32_orrs_t1,
+  kT32_mvn_imm_t1,
+  kT32_orn_imm_t1,
+  kT32_mvns_t1,
+  kT32_orns_imm_t1,
+  kT32_teq_imm_t1,
+  kT32_eors_t1,
+  kT32_add_sp_imm_t3,
+  kT32_add_imm_t3,
+  kT32_cmn_imm_t1,
+  kT32_adds_sp_imm_t3,
+  kT32_adds_imm_t3,
+  kT32_sub_sp_t2,
+  kT32_sub_t3,
+  kT32_cmp_imm_t2,
+  kT32_subs_sp_t2,
+  kT32_subs_t3,
+  kT32_add_sp_t4,
+  kT32_adr_t3,
+  kT32_add_t4,
+  kT32_sub_sp_t3,
+  kT32_sub_pc_t2,
+  kT32_adr_t2,
+  kT32_sub_t4,
+  kT32_ssat16_t1,
+  kT32_ssat_asr_t1,
+  kT32_bfc_t1,
+  kT32_bfi_t1,
+  kT32_usat16_t1,
+  kT32_usat_asr_t1,
+  kT32_b_t4,
+  kT32_bl_t1,
+  kT32_msr_t1,
+  kT32_msr_banked_t1,
+  kT32_cpsie_t2,
+  kT32_cpsid_t2,
+  kT32_dbg_t1,
+  kT32_nop_t2,
+  kT32_yield_t2,
+  kT32_wfe_t2,
+  kT32_wfi_t2,
+  kT32_sev_t2,
+  kT32_sevl_t2,
+  kT32_cps_t2,
+  kT32_clrex_t1,
+  kT32_dsb_t1,
+  kT32_dmb_t1,
+  kT32_isb_t1,
+  kT32_bxj_t1,
+  kT32_eret_t1,
+  kT32_subs_t5,
+  kT32_mrs_t1,
+  kT32_mrs_banked_t1,
+  kT32_dcps1_t1,
+  kT32_dcps2_t1,
+  kT32_dcps3_t1,
+  kT32_hvc_t1,
+  kT32_smc_t1,
+  kT32_udf_t2,
+  kT32_b_t3,
+  kT32_blx_t2,
+  kT32_srsdb_t1,
+  kT32_stm_t2,
+  kT32_strex_t1,
+  kT32_strexb_t1,
+  kT32_strexh_t1,
+  kT32_strexd_t1,
+  kT32_stlb_t1,
+  kT32_stlh_t1,
+  kT32_stl_t1,
+  kT32_stlexb_t1,
+  kT32_stlexh_t1,
+  kT32_stlex_t1,
+  kT32_stlexd_t1,
+  kT32_strd_post_t1,
+  kT32_push_t2,
+  kT32_srsia_t2,
+  kT32_strd_off_t1,
+  kT32_strd_pre_t1,
+  kT32_rfedb_t1,
+  kT32_pop_t2,
+  kT32_ldmdb_t1,
+  kT32_rfeia_t2,
+  kT32_ldrex_t1,
+  kT32_tbb_t1,
+  kT32_tbh_t1,
+  kT32_ldrexb_t1,
+  kT32_ldrexh_t1,
+  kT32_ldrexd_t1,
+  kT32_ldab_t1,
+  kT32_ldah_t1,
+  kT32_lda_t1,
+  kT32_ldaexb_t1,
+  kT32_ldaexh_t1,
+  kT32_ldaex_t1,
+  kT32_ldaexd_t1,
+  kT32_ldrd_lit_t1,
+  kT32_ldrd_imm_post_t1,
+  kT32_ldrd_imm_off_t1,
+  kT32_ldrd_imm_pre_t1,
+  kT32_strb_reg_t2,
+  kT32_strb_post_t3,
+  kT32_strb_off_t3,
+  kT32_strbt_t1,
+  kT32_strb_pre_t3,
+  kT32_str_t2,
+  kT32_str_post_t4,
+  kT32_str_off_t4,
+  kT32_strt_t1,
+  kT32_push_t4,
+  kT32_str_pre_t4,
+  kT32_strh_reg_t2,
+  kT32_strh_post_t3,
+  kT32_strh_off_t3,
+  kT32_strht_t1,
+  kT32_strh_pre_t3,
+  kT32_strb_imm_t2,
+  kT32_str_t3,
+  kT32_strh_imm_t2,
+  kT32_vst4_multi_wb_t1,
+  kT32_vst1_multi_wb_t1,
+  kT32_vst2_multi_wb_t1,
+  kT32_vst3_multi_wb_t1,
+  kT32_vst4_multi_off_t1,
+  kT32_vst1_multi_off_t1,
+  kT32_vst2_multi_off_t1,
+  kT32_vst3_multi_off_t1,
+  kT32_vst4_multi_post_t1,
+  kT32_vst1_multi_post_t1,
+  kT32_vst2_multi_post_t1,
+  kT32_vst3_multi_post_t1,
+  kT32_vld4_multi_wb_t1,
+  kT32_vld3_multi_wb_t1,
+  kT32_vld1_multi_wb_t1,
+  kT32_vld2_multi_wb_t1,
+  kT32_vld4_multi_off_t1,
+  kT32_vld3_multi_off_t1,
+  kT32_vld1_multi_off_t1,
+  kT32_vld2_multi_off_t1,
+  kT32_vld4_multi_post_t1,
+  kT32_vld1_multi_post_t1,
+  kT32_vld2_multi_post_t1,
+  kT32_vld3_multi_post_t1,
+  kT32_vst1_lane_wb_t1,
+  kT32_vst1_lane_off_t1,
+  kT32_vst1_lane_post_t1,
+  kT32_vst2_lane_wb_t1,
+  kT32_vst2_lane_off_t1,
+  kT32_vst2_lane_post_t1,
+  kT32_vst3_lane_wb_t1,
+  kT32_vst3_lane_off_t1,
+  kT32_vst3_lane_post_t1,
+  kT32_vst4_lane_wb_t1,
+  kT32_vst4_lane_off_t1,
+  kT32_vst4_lane_post_t1,
+  kT32_vld1_all_wb_t1,
+  kT32_vld1_all_off_t1,
+  kT32_vld1_all_post_t1,
+  kT32_vld1_lane_wb_t1,
+  kT32_vld1_lane_off_t1,
+  kT32_vld1_lane_post_t1,
+  kT32_vld2_all_wb_t1,
+  kT32_vld2_all_off_t1,
+  kT32_vld2_all_post_t1,
+  kT32_vld2_lane_wb_t1,
+  kT32_vld2_lane_off_t1,
+  kT32_vld2_lane_post_t1,
+  kT32_vld3_all_wb_t1,
+  kT32_vld3_all_off_t1,
+  kT32_vld3_all_post_t1,
+  kT32_vld3_lane_wb_t1,
+  kT32_vld3_lane_off_t1,
+  kT32_vld3_lane_post_t1,
+  kT32_vld4_all_wb_t1,
+  kT32_vld4_all_off_t1,
+  kT32_vld4_all_post_t1,
+  kT32_vld4_lane_wb_t1,
+  kT32_vld4_lane_off_t1,
+  kT32_vld4_lane_post_t1,
+  kT32_pld_lit_t1,
+  kT32_ldrb_lit_t1,
+  kT32_ldrh_lit_t1,
+  kT32_pld_reg_t1,
+  kT32_ldrb_reg_t2,
+  kT32_ldrb_post_t3,
+  kT32_pld_t2,
+  kT32_ldrb_off_t3,
+  kT32_ldrbt_t1,
+  kT32_ldrb_pre_t3,
+  kT32_pldw_reg_t1,
+  kT32_ldrh_reg_t2,
+  kT32_ldrh_post_t3,
+  kT32_pldw_t2,
+  kT32_ldrh_off_t3,
+  kT32_ldrht_t1,
+  kT32_ldrh_pre_t3,
+  kT32_pld_imm_t1,
+  kT32_ldrb_imm_t2,
+  kT32_pldw_imm_t1,
+  kT32_ldrh_imm_t2,
+  kT32_ldr_lit_t2,
+  kT32_ldr_reg_t2,
+  kT32_pop_t4,
+  kT32_ldr_post_t4,
+  kT32_ldr_off_t4,
+  kT32_ldrt_t1,
+  kT32_ldr_pre_t4,
+  kT32_ldr_t3,
+  kT32_pli_t3,
+  kT32_ldrsb_lit_t1,
+  kT32_pli_reg_t1,
+  kT32_ldrsb_reg_t2,
+  kT32_ldrsb_imm_post_t2,
+  kT32_pli_t2,
+  kT32_ldrsb_imm_off_t2,
+  kT32_ldrsbt_t1,
+  kT32_ldrsb_imm_pre_t2,
+  kT32_pli_imm_t1,
+  kT32_ldrsb_imm_t1,
+  kT32_ldrsh_lit_t1,
+  kT32_ldrsh_reg_t2,
+  kT32_ldrsh_imm_post_t2,
+  kT32_ldrsh_imm_off_t2,
+  kT32_ldrsht_t1,
+  kT32_ldrsh_imm_pre_t2,
+  kT32_ldrsh_imm_t1,
+  kT32_and_rrx_t2,
+  kT32_and_reg_t2,
+  kT32_bic_rrx_t2,
+  kT32_bic_reg_t2,
+  kT32_rrx_t3,
+  kT32_asr_t3,
+  kT32_lsl_t3,
+  kT32_lsr_t3,
+  kT32_mov_reg_t3,
+  kT32_ror_t3,
+  kT32_orr_rrx_t2,
+  kT32_orr_reg_t2,
+  kT32_mvn_rrx_t2,
+  kT32_mvn_reg_t2,
+  kT32_orn_rrx_t1,
+  kT32_orn_reg_t1,
+  kT32_tst_rrx_t2,
+  kT32_tst_reg_t2,
+  kT32_ands_rrx_t2,
+  kT32_ands_reg_t2,
+  kT32_bics_rrx_t2,
+  kT32_bics_reg_t2,
+  kT32_rrxs_t3,
+  kT32_asrs_t3,
+  kT32_lsls_t3,
+  kT32_lsrs_t3,
+  kT32_movs_t3,
+  kT32_rors_t3,
+  kT32_orrs_rrx_t2,
+  kT32_orrs_reg_t2,
+  kT32_mvns_rrx_t2,
+  kT32_mvns_reg_t2,
+  kT32_orns_rrx_t1,
+  kT32_orns_reg_t1,
+  kT32_eor_rrx_t2,
+  kT32_eor_reg_t2,
+  kT32_pkhbt_t1,
+  kT32_pkhtb_t1,
+  kT32_teq_rrx_t1,
+  kT32_teq_reg_t1,
+  kT32_eors_rrx_t2,
+  kT32_eors_reg_t2,
+  kT32_add_sp_rrx_t3,
+  kT32_add_sp_reg_t3,
+  kT32_add_rrx_t3,
+  kT32_add_reg_t3,
+  kT32_adc_rrx_t2,
+  kT32_adc_reg_t2,
+  kT32_sbc_rrx_t2,
+  kT32_sbc_reg_t2,
+  kT32_cmn_rrx_t2,
+  kT32_cmn_reg_t2,
+  kT32_adds_sp_rrx_t3,
+  kT32_adds_sp_reg_t3,
+  kT32_adds_rrx_t3,
+  kT32_adds_reg_t3,
+  kT32_adcs_rrx_t2,
+  kT32_adcs_reg_t2,
+  kT32_sbcs_rrx_t2,
+  kT32_sbcs_reg_t2,
+  kT32_sub_sp_rrx_t1,
+  kT32_sub_sp_reg_t1,
+  kT32_sub_rrx_t2,
+  kT32_sub_reg_t2,
+  kT32_rsb_rrx_t1,
+  kT32_rsb_reg_t1,
+  kT32_cmp_rrx_t3,
+  kT32_cmp_reg_t3,
+  kT32_subs_rrx_t1,
+  kT32_subs_reg_t1,
+  kT32_subs_rrx_t2,
+  kT32_subs_reg_t2,
+  kT32_rsbs_rrx_t1,
+  kT32_rsbs_reg_t1,
+  kT32_asr_reg_t2,
+  kT32_lsl_reg_t2,
+  kT32_lsr_reg_t2,
+  kT32_ror_t2,
+  kT32_mov_rsr_t2,
+  kT32_sxth_t2,
+  kT32_sxtah_t1,
+  kT32_sxtb16_t1,
+  kT32_sxtab16_t1,
+  kT32_sxtb_t2,
+  kT32_sxtab_t1,
+  kT32_asrs_t2,
+  kT32_lsls_t2,
+  kT32_lsrs_t2,
+  kT32_rors_t2,
+  kT32_movs_rsr_t2,
+  kT32_uxth_t2,
+  kT32_uxtah_t1,
+  kT32_uxtb16_t1,
+  kT32_uxtab16_t1,
+  kT32_uxtb_t2,
+  kT32_uxtab_t1,
+  kT32_sadd8_t1,
+  kT32_qadd8_t1,
+  kT32_shadd8_t1,
+  kT32_uadd8_t1,
+  kT32_uqadd8_t1,
+  kT32_uhadd8_t1,
+  kT32_qadd_t1,
+  kT32_qdadd_t1,
+  kT32_qsub_t1,
+  kT32_qdsub_t1,
+  kT32_sasx_t1,
+  kT32_qasx_t1,
+  kT32_shasx_t1,
+  kT32_uasx_t1,
+  kT32_uqasx_t1,
+  kT32_uhasx_t1,
+  kT32_sel_t1,
+  kT32_ssub8_t1,
+  kT32_qsub8_t1,
+  kT32_shsub8_t1,
+  kT32_usub8_t1,
+  kT32_uqsub8_t1,
+  kT32_uhsub8_t1,
+  kT32_crc32b_t1,
+  kT32_crc32h_t1,
+  kT32_crc32w_t1,
+  kT32_ssax_t1,
+  kT32_qsax_t1,
+  kT32_shsax_t1,
+  kT32_usax_t1,
+  kT32_uqsax_t1,
+  kT32_uhsax_t1,
+  kT32_sadd16_t1,
+  kT32_qadd16_t1,
+  kT32_shadd16_t1,
+  kT32_uadd16_t1,
+  kT32_uqadd16_t1,
+  kT32_uhadd16_t1,
+  kT32_rev_t2,
+  kT32_rev16_t2,
+  kT32_rbit_t1,
+  kT32_revsh_t2,
+  kT32_clz_t1,
+  kT32_ssub16_t1,
+  kT32_qsub16_t1,
+  kT32_shsub16_t1,
+  kT32_usub16_t1,
+  kT32_uqsub16_t1,
+  kT32_uhsub16_t1,
+  kT32_crc32cb_t1,
+  kT32_crc32ch_t1,
+  kT32_crc32cw_t1,
+  kT32_mls_t1,
+  kT32_smmls_t1,
+  kT32_smmlsr_t1,
+  kT32_mul_t2,
+  kT32_mla_t1,
+  kT32_smuad_t1,
+  kT32_smlad_t1,
+  kT32_smuadx_t1,
+  kT32_smladx_t1,
+  kT32_smusd_t1,
+  kT32_smlsd_t1,
+  kT32_smusdx_t1,
+  kT32_smlsdx_t1,
+  kT32_smulbb_t1,
+  kT32_smlabb_t1,
+  kT32_smulbt_t1,
+  kT32_smlabt_t1,
+  kT32_smultb_t1,
+  kT32_smlatb_t1,
+  kT32_smultt_t1,
+  kT32_smlatt_t1,
+  kT32_smulwb_t1,
+  kT32_smlawb_t1,
+  kT32_smulwt_t1,
+  kT32_smlawt_t1,
+  kT32_smmul_t1,
+  kT32_smmla_t1,
+  kT32_smmulr_t1,
+  kT32_smmlar_t1,
+  kT32_usad8_t1,
+  kT32_usada8_t1,
+  kT32_smull_t1,
+  kT32_umull_t1,
+  kT32_smlal_t1,
+  kT32_smlalbb_t1,
+  kT32_smlalbt_t1,
+  kT32_smlaltb_t1,
+  kT32_smlaltt_t1,
+  kT32_smlald_t1,
+  kT32_smlaldx_t1,
+  kT32_umlal_t1,
+  kT32_umaal_t1,
+  kT32_sdiv_t1,
+  kT32_udiv_t1,
+  kT32_smlsld_t1,
+  kT32_smlsldx_t1,
+  kT32_vstm_t2,
+  kT32_vmov_ss_rr_t1,
+  kT32_vmov_d_rr_t1,
+  kT32_vstm_t1,
+  kT32_fstmiax_t1,
+  kT32_stc_t1,
+  kT32_mcrr_t1,
+  kT32_vmov_rr_ss_t1,
+  kT32_vmov_rr_d_t1,
+  kT32_vpop_t2,
+  kT32_vldm_t2,
+  kT32_fldmiax_t1,
+  kT32_vpop_t1,
+  kT32_vldm_t1,
+  kT32_ldc_imm_t1,
+  kT32_mrrc_t1,
+  kT32_vstr_t2,
+  kT32_vstr_t1,
+  kT32_vpush_t2,
+  kT32_vstmdb_t2,
+  kT32_fstmdbx_t1,
+  kT32_vpush_t1,
+  kT32_vstmdb_t1,
+  kT32_vldr_lit_t2,
+  kT32_vldr_imm_t2,
+  kT32_vldr_lit_t1,
+  kT32_vldr_imm_t1,
+  kT32_vldmdb_t2,
+  kT32_vldmdb_t1,
+  kT32_fldmdbx_t1,
+  kT32_ldc_lit_t1,
+  kT32_vmla_f32_t2,
+  kT32_vmls_f32_t2,
+  kT32_vmla_f64_t2,
+  kT32_vmls_f64_t2,
+  kT32_vnmls_f32_t1,
+  kT32_vnmla_f32_t1,
+  kT32_vnmls_f64_t1,
+  kT32_vnmla_f64_t1,
+  kT32_vmul_f32_t2,
+  kT32_vnmul_f32_t1,
+  kT32_vmul_f64_t2,
+  kT32_vnmul_f64_t1,
+  kT32_vadd_f32_t2,
+  kT32_vsub_f32_t2,
+  kT32_vadd_f64_t2,
+  kT32_vsub_f64_t2,
+  kT32_vdiv_f32_t1,
+  kT32_vdiv_f64_t1,
+  kT32_vfnms_f32_t1,
+  kT32_vfnma_f32_t1,
+  kT32_vfnms_f64_t1,
+  kT32_vfnma_f64_t1,
+  kT32_vfma_f32_t2,
+  kT32_vfms_f32_t2,
+  kT32_vfma_f64_t2,
+  kT32_vfms_f64_t2,
+  kT32_vmov_imm_f32_t2,
+  kT32_vmov_imm_f64_t2,
+  kT32_vseleq_f32_t1,
+  kT32_vseleq_f64_t1,
+  kT32_vselvs_f32_t1,
+  kT32_vselvs_f64_t1,
+  kT32_vselge_f32_t1,
+  kT32_vselge_f64_t1,
+  kT32_vselgt_f32_t1,
+  kT32_vselgt_f64_t1,
+  kT32_vmaxnm_f32_t2,
+  kT32_vminnm_f32_t2,
+  kT32_vmaxnm_f64_t2,
+  kT32_vminnm_f64_t2,
+  kT32_vcvt_f32_fx_t1,
+  kT32_vcvt_fx_f32_t1,
+  kT32_vmov_f32_t2,
+  kT32_vabs_f32_t2,
+  kT32_vneg_f32_t2,
+  kT32_vsqrt_f32_t1,
+  kT32_vcvtb_f32_f16_t1,
+  kT32_vcvtt_f32_f16_t1,
+  kT32_vcvtb_f16_f32_t1,
+  kT32_vcvtt_f16_f32_t1,
+  kT32_vcmp_f32_t1,
+  kT32_vcmpe_f32_t1,
+  kT32_vcmp_f32_t2,
+  kT32_vcmpe_f32_t2,
+  kT32_vrintr_f32_t1,
+  kT32_vrintz_f32_t1,
+  kT32_vrintx_f32_t1,
+  kT32_vcvt_f64_f32_t1,
+  kT32_vcvt_f32_int_t1,
+  kT32_vcvtr_u32_f32_t1,
+  kT32_vcvt_u32_f32_t1,
+  kT32_vcvtr_s32_f32_t1,
+  kT32_vcvt_s32_f32_t1,
+  kT32_vcvt_f64_fx_t1,
+  kT32_vcvt_fx_f64_t1,
+  kT32_vmov_f64_t2,
+  kT32_vabs_f64_t2,
+  kT32_vneg_f64_t2,
+  kT32_vsqrt_f64_t1,
+  kT32_vcvtb_f64_f16_t1,
+  kT32_vcvtt_f64_f16_t1,
+  kT32_vcvtb_f16_f64_t1,
+  kT32_vcvtt_f16_f64_t1,
+  kT32_vcmp_f64_t1,
+  kT32_vcmpe_f64_t1,
+  kT32_vcmp_f64_t2,
+  kT32_vcmpe_f64_t2,
+  kT32_vrintr_f64_t1,
+  kT32_vrintz_f64_t1,
+  kT32_vrintx_f64_t1,
+  kT32_vcvt_f32_f64_t1,
+  kT32_vcvt_f64_int_t1,
+  kT32_vcvtr_u32_f64_t1,
+  kT32_vcvt_u32_f64_t1,
+  kT32_vcvtr_s32_f64_t1,
+  kT32_vcvt_s32_f64_t1,
+  kT32_vcvta_int_f32_s_t1,
+  kT32_vcvtn_int_f32_s_t1,
+  kT32_vcvtp_int_f32_s_t1,
+  kT32_vcvtm_int_f32_s_t1,
+  kT32_vrinta_f32_t1,
+  kT32_vrintn_f32_t1,
+  kT32_vrintp_f32_t1,
+  kT32_vrintm_f32_t1,
+  kT32_vcvta_int_f64_t1,
+  kT32_vcvtn_int_f64_t1,
+  kT32_vcvtp_int_f64_t1,
+  kT32_vcvtm_int_f64_t1,
+  kT32_vrinta_f64_t1,
+  kT32_vrintn_f64_t1,
+  kT32_vrintp_f64_t1,
+  kT32_vrintm_f64_t1,
+  kT32_mcr_t1,
+  kT32_mrc_t1,
+  kT32_vmov_scalar_r_t1,
+  kT32_vmov_s_r_t1,
+  kT32_vmsr_t1,
+  kT32_vdup_d_t1,
+  kT32_vdup_q_t1,
+  kT32_vmov_r_scalar_t1,
+  kT32_vmov_r_s_t1,
+  kT32_vmrs_t1,
+  kT32_vhadd_d_t1,
+  kT32_vrhadd_d_t1,
+  kT32_vhsub_d_t1,
+  kT32_vcgt_d_t1,
+  kT32_vshl_d_t1,
+  kT32_vrshl_d_t1,
+  kT32_vmax_d_t1,
+  kT32_vabd_d_t1,
+  kT32_vpmax_t1,
+  kT32_vhadd_q_t1,
+  kT32_vrhadd_q_t1,
+  kT32_vhsub_q_t1,
+  kT32_vcgt_q_t1,
+  kT32_vshl_q_t1,
+  kT32_vrshl_q_t1,
+  kT32_vmax_q_t1,
+  kT32_vabd_q_t1,
+  kT32_vadd_d_t1,
+  kT32_vsub_d_t1,
+  kT32_vadd_q_t1,
+  kT32_vsub_q_t1,
+  kT32_vmla_d_t1,
+  kT32_vmls_d_t1,
+  kT32_vmla_q_t1,
+  kT32_vmls_q_t1,
+  kT32_vqdmulh_d_t1,
+  kT32_vqrdmulh_d_t1,
+  kT32_vqdmulh_q_t1,
+  kT32_vqrdmulh_q_t1,
+  kT32_sha1c_t1,
+  kT32_sha1p_t1,
+  kT32_sha1m_t1,
+  kT32_sha1su0_t1,
+  kT32_sha256h_t1,
+  kT32_sha256h2_t1,
+  kT32_sha256su1_t1,
+  kT32_vadd_f32_d_t1,
+  kT32_vsub_f32_d_t1,
+  kT32_vpadd_f32_t1,
+  kT32_vabd_f32_d_t1,
+  kT32_vadd_f32_q_t1,
+  kT32_vsub_f32_q_t1,
+  kT32_vabd_f32_q_t1,
+  kT32_vceq_d_t2,
+  kT32_vcge_d_t2,
+  kT32_vcgt_d_t2,
+  kT32_vceq_q_t2,
+  kT32_vcge_q_t2,
+  kT32_vcgt_q_t2,
+  kT32_vmax_f32_d_t1,
+  kT32_vmin_f32_d_t1,
+  kT32_vpmax_f32_t1,
+  kT32_vpmin_f32_t1,
+  kT32_vmax_f32_q_t1,
+  kT32_vmin_f32_q_t1,
+  kT32_vext_d_t1,
+  kT32_vext_q_t1,
+  kT32_vrev64_d_t1,
+  kT32_vrev32_d_t1,
+  kT32_vrev16_d_t1,
+  kT32_vcls_d_t1,
+  kT32_vclz_d_t1,
+  kT32_vrev64_q_t1,
+  kT32_vrev32_q_t1,
+  kT32_vrev16_q_t1,
+  kT32_vcls_q_t1,
+  kT32_vclz_q_t1,
+  kT32_vcnt_d_t1,
+  kT32_vcnt_q_t1,
+  kT32_vmvn_d_t1,
+  kT32_vmvn_q_t1,
+  kT32_vpaddl_d_t1,
+  kT32_vpadal_d_t1,
+  kT32_vpaddl_q_t1,
+  kT32_vpadal_q_t1,
+  kT32_aese_t1,
+  kT32_aesmc_t1,
+  kT32_aesd_t1,
+  kT32_aesimc_t1,
+  kT32_vqabs_d_t1,
+  kT32_vqneg_d_t1,
+  kT32_vqabs_q_t1,
+  kT32_vqneg_q_t1,
+  kT32_vcgt_imm_d_t1,
+  kT32_vcge_imm_d_t1,
+  kT32_vceq_imm_d_t1,
+  kT32_vcle_d_t1,
+  kT32_vcgt_imm_q_t1,
+  kT32_vcge_imm_q_t1,
+  kT32_vceq_imm_q_t1,
+  kT32_vcle_q_t1,
+  kT32_vclt_d_t1,
+  kT32_vabs_d_t1,
+  kT32_vneg_d_t1,
+  kT32_vclt_q_t1,
+  kT32_vabs_q_t1,
+  kT32_vneg_q_t1,
+  kT32_sha1h_t1,
+  kT32_vtrn_d_t1,
+  kT32_vuzp_d_t1,
+  kT32_vzip_d_t1,
+  kT32_vrintn_d_t1,
+  kT32_vrintx_d_t1,
+  kT32_vrinta_d_t1,
+  kT32_vrintz_d_t1,
+  kT32_vtrn_q_t1,
+  kT32_vuzp_q_t1,
+  kT32_vzip_q_t1,
+  kT32_vrintn_q_t1,
+  kT32_vrintx_q_t1,
+  kT32_vrinta_q_t1,
+  kT32_vrintz_q_t1,
+  kT32_vswp_d_t1,
+  kT32_vswp_q_t1,
+  kT32_vqmovn_t1,
+  kT32_vmovn_t1,
+  kT32_vqmovun_t1,
+  kT32_vshll_t2,
+  kT32_sha1su1_t1,
+  kT32_sha256su0_t1,
+  kT32_vcvt_f16_f32_t1,
+  kT32_vrintm_d_t1,
+  kT32_vrintm_q_t1,
+  kT32_vcvt_f32_f16_t1,
+  kT32_vrintp_d_t1,
+  kT32_vrintp_q_t1,
+  kT32_vcvta_int_f32_d_t1,
+  kT32_vcvtn_int_f32_d_t1,
+  kT32_vcvta_int_f32_q_t1,
+  kT32_vcvtn_int_f32_q_t1,
+  kT32_vrecpe_d_t1,
+  kT32_vrsqrte_d_t1,
+  kT32_vrecpe_q_t1,
+  kT32_vrsqrte_q_t1,
+  kT32_vcvt_d_t1,
+  kT32_vcvt_q_t1,
+  kT32_vcvtp_int_f32_d_t1,
+  kT32_vcvtm_int_f32_d_t1,
+  kT32_vcvtp_int_f32_q_t1,
+  kT32_vcvtm_int_f32_q_t1,
+  kT32_vtbl_t1,
+  kT32_vtbx_t1,
+  kT32_vdup_scalar_d_t1,
+  kT32_vdup_scalar_q_t1,
+  kT32_vaddl_t1,
+  kT32_vaddw_t1,
+  kT32_vsubl_t1,
+  kT32_vsubw_t1,
+  kT32_vmla_scalar_d_t1,
+  kT32_vmla_scalar_q_t1,
+  kT32_vmlal_scalar_t1,
+  kT32_vqdmlal_t2,
+  kT32_vaddhn_t1,
+  kT32_vraddhn_t1,
+  kT32_vabal_t1,
+  kT32_vsubhn_t1,
+  kT32_vrsubhn_t1,
+  kT32_vabdl_t1,
+  kT32_vmls_scalar_d_t1,
+  kT32_vmls_scalar_q_t1,
+  kT32_vmlsl_scalar_t1,
+  kT32_vqdmlsl_t2,
+  kT32_vmlal_t1,
+  kT32_vqdmlal_t1,
+  kT32_vmlsl_t1,
+  kT32_vqdmlsl_t1,
+  kT32_vmul_scalar_d_t1,
+  kT32_vmul_scalar_q_t1,
+  kT32_vmull_scalar_t1,
+  kT32_vqdmull_t2,
+  kT32_vmull_t1,
+  kT32_vqdmull_t1,
+  kT32_vqdmulh_d_t2,
+  kT32_vqrdmulh_d_t2,
+  kT32_vqdmulh_q_t2,
+  kT32_vqrdmulh_q_t2,
+  kT32_vqadd_d_t1,
+  kT32_vqsub_d_t1,
+  kT32_vcge_d_t1,
+  kT32_vqshl_d_t1,
+  kT32_vqrshl_d_t1,
+  kT32_vmin_d_t1,
+  kT32_vaba_d_t1,
+  kT32_vmul_d_t1,
+  kT32_vpmin_t1,
+  kT32_vand_d_t1,
+  kT32_vbic_d_t1,
+  kT32_vmov_d_t1,
+  kT32_vorn_d_t1,
+  kT32_veor_d_t1,
+  kT32_vbsl_d_t1,
+  kT32_vbit_d_t1,
+  kT32_vbif_d_t1,
+  kT32_vtst_d_t1,
+  kT32_vceq_d_t1,
+  kT32_vpadd_t1,
+  kT32_vfma_d_t1,
+  kT32_vfms_d_t1,
+  kT32_vmla_f32_d_t1,
+  kT32_vmls_f32_d_t1,
+  kT32_vmul_f32_d_t1,
+  kT32_vacge_d_t1,
+  kT32_vacgt_d_t1,
+  kT32_vrecps_d_t1,
+  kT32_vrsqrts_d_t1,
+  kT32_vmaxnm_d_t1,
+  kT32_vminnm_d_t1,
+  kT32_vqadd_q_t1,
+  kT32_vqsub_q_t1,
+  kT32_vcge_q_t1,
+  kT32_vqshl_q_t1,
+  kT32_vqrshl_q_t1,
+  kT32_vmin_q_t1,
+  kT32_vaba_q_t1,
+  kT32_vmul_q_t1,
+  kT32_vmov_q_t1,
+  kT32_vand_q_t1,
+  kT32_vbic_q_t1,
+  kT32_vorn_q_t1,
+  kT32_veor_q_t1,
+  kT32_vbsl_q_t1,
+  kT32_vbit_q_t1,
+  kT32_vbif_q_t1,
+  kT32_vtst_q_t1,
+  kT32_vceq_q_t1,
+  kT32_vfma_q_t1,
+  kT32_vfms_q_t1,
+  kT32_vmla_f32_q_t1,
+  kT32_vmls_f32_q_t1,
+  kT32_vmul_f32_q_t1,
+  kT32_vacge_q_t1,
+  kT32_vacgt_q_t1,
+  kT32_vrecps_q_t1,
+  kT32_vrsqrts_q_t1,
+  kT32_vmaxnm_q_t1,
+  kT32_vminnm_q_t1,
+  kT32_vmvn_imm_d_t1,
+  kT32_vmov_imm_d_t1,
+  kT32_vorr_d_t1,
+  kT32_vbic_imm_d_t1,
+  kT32_vshr_d_t1,
+  kT32_vsra_d_t1,
+  kT32_vrshr_d_t1,
+  kT32_vrsra_d_t1,
+  kT32_vsri_d_t1,
+  kT32_vshl_imm_d_t1,
+  kT32_vsli_d_t1,
+  kT32_vqshlu_d_t1,
+  kT32_vqshl_imm_d_t1,
+  kT32_vshrn_t1,
+  kT32_vqshrun_t1,
+  kT32_vqshrn_t1,
+  kT32_vshll_t1,
+  kT32_vmovl_t1,
+  kT32_vcvt_fx_d_t1,
+  kT32_vmvn_imm_q_t1,
+  kT32_vmov_imm_q_t1,
+  kT32_vorr_q_t1,
+  kT32_vbic_imm_q_t1,
+  kT32_vshr_q_t1,
+  kT32_vsra_q_t1,
+  kT32_vrshr_q_t1,
+  kT32_vrsra_q_t1,
+  kT32_vsri_q_t1,
+  kT32_vshl_imm_q_t1,
+  kT32_vsli_q_t1,
+  kT32_vqshlu_q_t1,
+  kT32_vqshl_imm_q_t1,
+  kT32_vrshrn_t1,
+  kT32_vqrshrun_t1,
+  kT32_vqrshrn_t1,
+  kT32_vcvt_fx_q_t1,
+};
+
+const unsigned kT32EncodingCount = 942;
+// clang-format on
+
+}  // namespace aarch32
+}  // namespace vixl
+
+#endif  // VIXL_AARCH32_DECODER_ENCODINGS_AARCH32_H_
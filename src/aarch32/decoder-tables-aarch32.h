@@ -0,0 +1,6968 @@
+// Copyright 2026, VIXL authors
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//   * Redistributions of source code must retain the above copyright notice,
+//     this list of conditions and the following disclaimer.
+//   * Redistributions in binary form must reproduce the above copyright notice,
+//     this list of conditions and the following disclaimer in the documentation
+//     and/or other materials provided with the distribution.
+//   * Neither the name of ARM Limited nor the names of its contributors may be
+//     used to endorse or promote products derived from this software without
+//     specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS CONTRIBUTORS "AS IS" AND
+// ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+// WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+// This file is auto generated from decoder-constants-aarch32.h using
+// tools/generate_decoder_tables.py. Do not edit it by hand.
+
+#ifndef VIXL_AARCH32_DECODER_TABLES_AARCH32_H_
+#define VIXL_AARCH32_DECODER_TABLES_AARCH32_H_
+
+namespace vixl {
+namespace aarch32 {
+
+// clang-format off
+// The names of the A32 encodings, indexed by A32Encoding.
+static const char* const kA32EncodingNames[] = {
+  "unallocated",
+  "blx_a2",
+  "cpsie_a1",
+  "cpsid_a1",
+  "cps_a1",
+  "setend_a1",
+  "vhadd_d_a1",
+  "vrhadd_d_a1",
+  "vhsub_d_a1",
+  "vcgt_d_a1",
+  "vshl_d_a1",
+  "vrshl_d_a1",
+  "vmax_d_a1",
+  "vabd_d_a1",
+  "vpmax_a1",
+  "vhadd_q_a1",
+  "vrhadd_q_a1",
+  "vhsub_q_a1",
+  "vcgt_q_a1",
+  "vshl_q_a1",
+  "vrshl_q_a1",
+  "vmax_q_a1",
+  "vabd_q_a1",
+  "vadd_d_a1",
+  "vsub_d_a1",
+  "vadd_q_a1",
+  "vsub_q_a1",
+  "vmla_d_a1",
+  "vmls_d_a1",
+  "vmla_q_a1",
+  "vmls_q_a1",
+  "vqdmulh_d_a1",
+  "vqrdmulh_d_a1",
+  "vqdmulh_q_a1",
+  "vqrdmulh_q_a1",
+  "sha1c_a1",
+  "sha1p_a1",
+  "sha1m_a1",
+  "sha1su0_a1",
+  "sha256h_a1",
+  "sha256h2_a1",
+  "sha256su1_a1",
+  "vadd_f32_d_a1",
+  "vsub_f32_d_a1",
+  "vpadd_f32_a1",
+  "vabd_f32_d_a1",
+  "vadd_f32_q_a1",
+  "vsub_f32_q_a1",
+  "vabd_f32_q_a1",
+  "vceq_d_a2",
+  "vcge_d_a2",
+  "vcgt_d_a2",
+  "vceq_q_a2",
+  "vcge_q_a2",
+  "vcgt_q_a2",
+  "vmax_f32_d_a1",
+  "vmin_f32_d_a1",
+  "vpmax_f32_a1",
+  "vpmin_f32_a1",
+  "vmax_f32_q_a1",
+  "vmin_f32_q_a1",
+  "vqadd_d_a1",
+  "vqsub_d_a1",
+  "vcge_d_a1",
+  "vqshl_d_a1",
+  "vqrshl_d_a1",
+  "vmin_d_a1",
+  "vaba_d_a1",
+  "vmul_d_a1",
+  "vpmin_a1",
+  "vqadd_q_a1",
+  "vqsub_q_a1",
+  "vcge_q_a1",
+  "vqshl_q_a1",
+  "vqrshl_q_a1",
+  "vmin_q_a1",
+  "vaba_q_a1",
+  "vmul_q_a1",
+  "vand_d_a1",
+  "vbic_d_a1",
+  "vmov_d_a1",
+  "vorn_d_a1",
+  "veor_d_a1",
+  "vbsl_d_a1",
+  "vbit_d_a1",
+  "vbif_d_a1",
+  "vmov_q_a1",
+  "vand_q_a1",
+  "vbic_q_a1",
+  "vorn_q_a1",
+  "veor_q_a1",
+  "vbsl_q_a1",
+  "vbit_q_a1",
+  "vbif_q_a1",
+  "vtst_d_a1",
+  "vceq_d_a1",
+  "vtst_q_a1",
+  "vceq_q_a1",
+  "vpadd_a1",
+  "vfma_d_a1",
+  "vfms_d_a1",
+  "vfma_q_a1",
+  "vfms_q_a1",
+  "vmla_f32_d_a1",
+  "vmls_f32_d_a1",
+  "vmul_f32_d_a1",
+  "vmla_f32_q_a1",
+  "vmls_f32_q_a1",
+  "vmul_f32_q_a1",
+  "vacge_d_a1",
+  "vacgt_d_a1",
+  "vacge_q_a1",
+  "vacgt_q_a1",
+  "vrecps_d_a1",
+  "vrsqrts_d_a1",
+  "vmaxnm_d_a1",
+  "vminnm_d_a1",
+  "vrecps_q_a1",
+  "vrsqrts_q_a1",
+  "vmaxnm_q_a1",
+  "vminnm_q_a1",
+  "vext_d_a1",
+  "vext_q_a1",
+  "vrev64_d_a1",
+  "vrev32_d_a1",
+  "vrev16_d_a1",
+  "vcls_d_a1",
+  "vclz_d_a1",
+  "vrev64_q_a1",
+  "vrev32_q_a1",
+  "vrev16_q_a1",
+  "vcls_q_a1",
+  "vclz_q_a1",
+  "vcnt_d_a1",
+  "vcnt_q_a1",
+  "vmvn_d_a1",
+  "vmvn_q_a1",
+  "vpaddl_d_a1",
+  "vpadal_d_a1",
+  "vpaddl_q_a1",
+  "vpadal_q_a1",
+  "aese_a1",
+  "aesmc_a1",
+  "aesd_a1",
+  "aesimc_a1",
+  "vqabs_d_a1",
+  "vqneg_d_a1",
+  "vqabs_q_a1",
+  "vqneg_q_a1",
+  "vcgt_imm_d_a1",
+  "vcge_imm_d_a1",
+  "vceq_imm_d_a1",
+  "vcle_d_a1",
+  "vcgt_imm_q_a1",
+  "vcge_imm_q_a1",
+  "vceq_imm_q_a1",
+  "vcle_q_a1",
+  "vclt_d_a1",
+  "vabs_d_a1",
+  "vneg_d_a1",
+  "vclt_q_a1",
+  "vabs_q_a1",
+  "vneg_q_a1",
+  "sha1h_a1",
+  "vtrn_d_a1",
+  "vuzp_d_a1",
+  "vzip_d_a1",
+  "vrintn_d_a1",
+  "vrintx_d_a1",
+  "vrinta_d_a1",
+  "vrintz_d_a1",
+  "vtrn_q_a1",
+  "vuzp_q_a1",
+  "vzip_q_a1",
+  "vrintn_q_a1",
+  "vrintx_q_a1",
+  "vrinta_q_a1",
+  "vrintz_q_a1",
+  "vswp_d_a1",
+  "vswp_q_a1",
+  "vqmovn_a1",
+  "vmovn_a1",
+  "vqmovun_a1",
+  "vshll_a2",
+  "sha1su1_a1",
+  "sha256su0_a1",
+  "vcvt_f16_f32_a1",
+  "vrintm_d_a1",
+  "vrintm_q_a1",
+  "vcvt_f32_f16_a1",
+  "vrintp_d_a1",
+  "vrintp_q_a1",
+  "vcvta_int_f32_d_a1",
+  "vcvtn_int_f32_d_a1",
+  "vcvta_int_f32_q_a1",
+  "vcvtn_int_f32_q_a1",
+  "vrecpe_d_a1",
+  "vrsqrte_d_a1",
+  "vrecpe_q_a1",
+  "vrsqrte_q_a1",
+  "vcvt_d_a1",
+  "vcvt_q_a1",
+  "vcvtp_int_f32_d_a1",
+  "vcvtm_int_f32_d_a1",
+  "vcvtp_int_f32_q_a1",
+  "vcvtm_int_f32_q_a1",
+  "vtbl_a1",
+  "vtbx_a1",
+  "vdup_scalar_d_a1",
+  "vdup_scalar_q_a1",
+  "vaddl_a1",
+  "vaddw_a1",
+  "vsubl_a1",
+  "vsubw_a1",
+  "vmla_scalar_d_a1",
+  "vmla_scalar_q_a1",
+  "vmlal_scalar_a1",
+  "vqdmlal_a2",
+  "vaddhn_a1",
+  "vraddhn_a1",
+  "vabal_a1",
+  "vsubhn_a1",
+  "vrsubhn_a1",
+  "vabdl_a1",
+  "vmls_scalar_d_a1",
+  "vmls_scalar_q_a1",
+  "vmlsl_scalar_a1",
+  "vqdmlsl_a2",
+  "vmlal_a1",
+  "vqdmlal_a1",
+  "vmlsl_a1",
+  "vqdmlsl_a1",
+  "vmul_scalar_d_a1",
+  "vmul_scalar_q_a1",
+  "vmull_scalar_a1",
+  "vqdmull_a2",
+  "vmull_a1",
+  "vqdmull_a1",
+  "vqdmulh_d_a2",
+  "vqrdmulh_d_a2",
+  "vqdmulh_q_a2",
+  "vqrdmulh_q_a2",
+  "vmvn_imm_d_a1",
+  "vmov_imm_d_a1",
+  "vorr_d_a1",
+  "vbic_imm_d_a1",
+  "vshr_d_a1",
+  "vsra_d_a1",
+  "vrshr_d_a1",
+  "vrsra_d_a1",
+  "vsri_d_a1",
+  "vshl_imm_d_a1",
+  "vsli_d_a1",
+  "vqshlu_d_a1",
+  "vqshl_imm_d_a1",
+  "vshrn_a1",
+  "vqshrun_a1",
+  "vqshrn_a1",
+  "vshll_a1",
+  "vmovl_a1",
+  "vcvt_fx_d_a1",
+  "vmvn_imm_q_a1",
+  "vmov_imm_q_a1",
+  "vorr_q_a1",
+  "vbic_imm_q_a1",
+  "vshr_q_a1",
+  "vsra_q_a1",
+  "vrshr_q_a1",
+  "vrsra_q_a1",
+  "vsri_q_a1",
+  "vshl_imm_q_a1",
+  "vsli_q_a1",
+  "vqshlu_q_a1",
+  "vqshl_imm_q_a1",
+  "vrshrn_a1",
+  "vqrshrun_a1",
+  "vqrshrn_a1",
+  "vcvt_fx_q_a1",
+  "vst4_multi_wb_a1",
+  "vst1_multi_wb_a1",
+  "vst2_multi_wb_a1",
+  "vst3_multi_wb_a1",
+  "vst4_multi_off_a1",
+  "vst1_multi_off_a1",
+  "vst2_multi_off_a1",
+  "vst3_multi_off_a1",
+  "vst4_multi_post_a1",
+  "vst1_multi_post_a1",
+  "vst2_multi_post_a1",
+  "vst3_multi_post_a1",
+  "vst1_lane_wb_a1",
+  "vst1_lane_off_a1",
+  "vst1_lane_post_a1",
+  "vst2_lane_wb_a1",
+  "vst2_lane_off_a1",
+  "vst2_lane_post_a1",
+  "vst3_lane_wb_a1",
+  "vst3_lane_off_a1",
+  "vst3_lane_post_a1",
+  "vst4_lane_wb_a1",
+  "vst4_lane_off_a1",
+  "vst4_lane_post_a1",
+  "pli_lit_a1",
+  "pli_imm_a1",
+  "vld4_multi_wb_a1",
+  "vld3_multi_wb_a1",
+  "vld1_multi_wb_a1",
+  "vld2_multi_wb_a1",
+  "vld4_multi_off_a1",
+  "vld3_multi_off_a1",
+  "vld1_multi_off_a1",
+  "vld2_multi_off_a1",
+  "vld4_multi_post_a1",
+  "vld1_multi_post_a1",
+  "vld2_multi_post_a1",
+  "vld3_multi_post_a1",
+  "vld1_all_wb_a1",
+  "vld1_all_off_a1",
+  "vld1_all_post_a1",
+  "vld1_lane_wb_a1",
+  "vld1_lane_off_a1",
+  "vld1_lane_post_a1",
+  "vld2_all_wb_a1",
+  "vld2_all_off_a1",
+  "vld2_all_post_a1",
+  "vld2_lane_wb_a1",
+  "vld2_lane_off_a1",
+  "vld2_lane_post_a1",
+  "vld3_all_wb_a1",
+  "vld3_all_off_a1",
+  "vld3_all_post_a1",
+  "vld3_lane_wb_a1",
+  "vld3_lane_off_a1",
+  "vld3_lane_post_a1",
+  "vld4_all_wb_a1",
+  "vld4_all_off_a1",
+  "vld4_all_post_a1",
+  "vld4_lane_wb_a1",
+  "vld4_lane_off_a1",
+  "vld4_lane_post_a1",
+  "pld_lit_a1",
+  "pldw_imm_a1",
+  "pld_imm_a1",
+  "clrex_a1",
+  "dsb_a1",
+  "dmb_a1",
+  "isb_a1",
+  "pli_rrx_a1",
+  "pli_reg_a1",
+  "pldw_rrx_a1",
+  "pldw_reg_a1",
+  "pld_rrx_a1",
+  "pld_reg_a1",
+  "rfeda_a1",
+  "srsda_a1",
+  "rfeia_a1",
+  "srsia_a1",
+  "rfedb_a1",
+  "srsdb_a1",
+  "rfeib_a1",
+  "srsib_a1",
+  "vseleq_f32_a1",
+  "vseleq_f64_a1",
+  "vselvs_f32_a1",
+  "vselvs_f64_a1",
+  "vselge_f32_a1",
+  "vselge_f64_a1",
+  "vselgt_f32_a1",
+  "vselgt_f64_a1",
+  "vmaxnm_f32_a2",
+  "vminnm_f32_a2",
+  "vmaxnm_f64_a2",
+  "vminnm_f64_a2",
+  "vcvta_int_f32_s_a1",
+  "vcvtn_int_f32_s_a1",
+  "vcvtp_int_f32_s_a1",
+  "vcvtm_int_f32_s_a1",
+  "vrinta_f32_a1",
+  "vrintn_f32_a1",
+  "vrintp_f32_a1",
+  "vrintm_f32_a1",
+  "vcvta_int_f64_a1",
+  "vcvtn_int_f64_a1",
+  "vcvtp_int_f64_a1",
+  "vcvtm_int_f64_a1",
+  "vrinta_f64_a1",
+  "vrintn_f64_a1",
+  "vrintp_f64_a1",
+  "vrintm_f64_a1",
+  "and_rrx_a1",
+  "and_reg_a1",
+  "sub_sp_rrx_a1",
+  "sub_sp_reg_a1",
+  "sub_rrx_a1",
+  "sub_reg_a1",
+  "eor_rrx_a1",
+  "eor_reg_a1",
+  "rsb_rrx_a1",
+  "rsb_reg_a1",
+  "add_sp_rrx_a1",
+  "add_sp_reg_a1",
+  "add_rrx_a1",
+  "add_reg_a1",
+  "sbc_rrx_a1",
+  "sbc_reg_a1",
+  "adc_rrx_a1",
+  "adc_reg_a1",
+  "rsc_rrx_a1",
+  "rsc_reg_a1",
+  "mrs_a1",
+  "mrs_banked_a1",
+  "crc32b_a1",
+  "crc32cb_a1",
+  "crc32w_a1",
+  "crc32cw_a1",
+  "smlabb_a1",
+  "smlalbb_a1",
+  "smlatb_a1",
+  "smlaltb_a1",
+  "smlabt_a1",
+  "smlalbt_a1",
+  "smlatt_a1",
+  "smlaltt_a1",
+  "msr_reg_a1",
+  "msr_banked_a1",
+  "bxj_a1",
+  "crc32h_a1",
+  "crc32ch_a1",
+  "eret_a1",
+  "smlawb_a1",
+  "smulbb_a1",
+  "smulwb_a1",
+  "smultb_a1",
+  "smlawt_a1",
+  "smulbt_a1",
+  "smulwt_a1",
+  "smultt_a1",
+  "orr_rrx_a1",
+  "orr_reg_a1",
+  "bic_rrx_a1",
+  "bic_reg_a1",
+  "mov_rrx_a1",
+  "rrx_a1",
+  "asr_imm_a1",
+  "lsr_imm_a1",
+  "mov_reg_a1",
+  "ror_imm_a1",
+  "lsl_imm_a1",
+  "mvn_rrx_a1",
+  "mvn_reg_a1",
+  "and_rsr_a1",
+  "eor_rsr_a1",
+  "add_rsr_a1",
+  "adc_rsr_a1",
+  "qadd_a1",
+  "hlt_a1",
+  "bx_a1",
+  "blx_a1",
+  "qsub_a1",
+  "bkpt_a1",
+  "orr_rsr_a1",
+  "asr_reg_a1",
+  "lsl_reg_a1",
+  "lsr_reg_a1",
+  "mov_rsr_a1",
+  "ror_reg_a1",
+  "mul_a1",
+  "umull_a1",
+  "strh_reg_post_a1",
+  "ldrd_reg_post_a1",
+  "strd_reg_post_a1",
+  "mla_a1",
+  "umlal_a1",
+  "strht_a2",
+  "stl_a1",
+  "stlex_a1",
+  "strex_a1",
+  "strh_reg_off_a1",
+  "ldrd_reg_off_a1",
+  "strd_reg_off_a1",
+  "stlexd_a1",
+  "strexd_a1",
+  "strh_reg_pre_a1",
+  "ldrd_reg_pre_a1",
+  "strd_reg_pre_a1",
+  "sub_rsr_a1",
+  "rsb_rsr_a1",
+  "sbc_rsr_a1",
+  "rsc_rsr_a1",
+  "qdadd_a1",
+  "hvc_a1",
+  "clz_a1",
+  "qdsub_a1",
+  "smc_a1",
+  "bic_rsr_a1",
+  "mvn_rsr_a1",
+  "umaal_a1",
+  "mls_a1",
+  "smull_a1",
+  "smlal_a1",
+  "stlb_a1",
+  "stlexb_a1",
+  "strexb_a1",
+  "stlh_a1",
+  "stlexh_a1",
+  "strexh_a1",
+  "strh_imm_post_a1",
+  "strht_a1",
+  "strh_imm_off_a1",
+  "strh_imm_pre_a1",
+  "ldrd_lit_a1",
+  "ldrd_imm_post_a1",
+  "ldrd_imm_off_a1",
+  "ldrd_imm_pre_a1",
+  "strd_imm_post_a1",
+  "strd_imm_off_a1",
+  "strd_imm_pre_a1",
+  "ands_rrx_a1",
+  "ands_reg_a1",
+  "eors_rrx_a1",
+  "eors_reg_a1",
+  "subs_sp_rrx_a1",
+  "subs_sp_reg_a1",
+  "subs_rrx_a1",
+  "subs_reg_a1",
+  "rsbs_rrx_a1",
+  "rsbs_reg_a1",
+  "adds_sp_rrx_a1",
+  "adds_sp_reg_a1",
+  "adds_rrx_a1",
+  "adds_reg_a1",
+  "adcs_rrx_a1",
+  "adcs_reg_a1",
+  "sbcs_rrx_a1",
+  "sbcs_reg_a1",
+  "rscs_rrx_a1",
+  "rscs_reg_a1",
+  "tst_rrx_a1",
+  "tst_reg_a1",
+  "teq_rrx_a1",
+  "teq_reg_a1",
+  "cmp_rrx_a1",
+  "cmp_reg_a1",
+  "cmn_rrx_a1",
+  "cmn_reg_a1",
+  "orrs_rrx_a1",
+  "orrs_reg_a1",
+  "movs_rrx_a1",
+  "rrxs_a1",
+  "asrs_imm_a1",
+  "lsrs_imm_a1",
+  "movs_reg_a1",
+  "rors_imm_a1",
+  "lsls_imm_a1",
+  "bics_rrx_a1",
+  "bics_reg_a1",
+  "mvns_rrx_a1",
+  "mvns_reg_a1",
+  "ands_rsr_a1",
+  "eors_rsr_a1",
+  "adds_rsr_a1",
+  "adcs_rsr_a1",
+  "tst_rsr_a1",
+  "teq_rsr_a1",
+  "orrs_rsr_a1",
+  "asrs_reg_a1",
+  "lsls_reg_a1",
+  "lsrs_reg_a1",
+  "movs_rsr_a1",
+  "rors_reg_a1",
+  "muls_a1",
+  "umulls_a1",
+  "ldrh_reg_post_a1",
+  "ldrsb_reg_post_a1",
+  "ldrsh_reg_post_a1",
+  "mlas_a1",
+  "umlals_a1",
+  "ldrht_a2",
+  "ldrsbt_a2",
+  "ldrsht_a2",
+  "lda_a1",
+  "ldaex_a1",
+  "ldrex_a1",
+  "ldrh_reg_off_a1",
+  "ldrsb_reg_off_a1",
+  "ldrsh_reg_off_a1",
+  "ldaexd_a1",
+  "ldrexd_a1",
+  "ldrh_reg_pre_a1",
+  "ldrsb_reg_pre_a1",
+  "ldrsh_reg_pre_a1",
+  "subs_rsr_a1",
+  "rsbs_rsr_a1",
+  "sbcs_rsr_a1",
+  "rscs_rsr_a1",
+  "cmp_rsr_a1",
+  "cmn_rsr_a1",
+  "bics_rsr_a1",
+  "mvns_rsr_a1",
+  "smulls_a1",
+  "smlals_a1",
+  "ldab_a1",
+  "ldaexb_a1",
+  "ldrexb_a1",
+  "ldah_a1",
+  "ldaexh_a1",
+  "ldrexh_a1",
+  "ldrh_lit_a1",
+  "ldrh_imm_post_a1",
+  "ldrht_a1",
+  "ldrh_imm_off_a1",
+  "ldrh_imm_pre_a1",
+  "ldrsb_lit_a1",
+  "ldrsb_imm_post_a1",
+  "ldrsbt_a1",
+  "ldrsb_imm_off_a1",
+  "ldrsb_imm_pre_a1",
+  "ldrsh_lit_a1",
+  "ldrsh_imm_post_a1",
+  "ldrsht_a1",
+  "ldrsh_imm_off_a1",
+  "ldrsh_imm_pre_a1",
+  "and_imm_a1",
+  "sub_sp_imm_a1",
+  "sub_a2",
+  "adr_a2",
+  "sub_imm_a1",
+  "ands_imm_a1",
+  "subs_sp_imm_a1",
+  "subs_imm_a1",
+  "eor_imm_a1",
+  "rsb_imm_a1",
+  "eors_imm_a1",
+  "rsbs_imm_a1",
+  "add_sp_imm_a1",
+  "adr_a1",
+  "add_imm_a1",
+  "sbc_imm_a1",
+  "adds_sp_imm_a1",
+  "adds_imm_a1",
+  "sbcs_imm_a1",
+  "adc_imm_a1",
+  "rsc_imm_a1",
+  "adcs_imm_a1",
+  "rscs_imm_a1",
+  "mov_a2",
+  "movt_a1",
+  "tst_imm_a1",
+  "cmp_imm_a1",
+  "nop_a1",
+  "yield_a1",
+  "wfe_a1",
+  "wfi_a1",
+  "sev_a1",
+  "sevl_a1",
+  "dbg_a1",
+  "msr_imm_a1",
+  "teq_imm_a1",
+  "cmn_imm_a1",
+  "orr_imm_a1",
+  "bic_imm_a1",
+  "orrs_imm_a1",
+  "bics_imm_a1",
+  "mov_imm_a1",
+  "mvn_imm_a1",
+  "movs_imm_a1",
+  "mvns_imm_a1",
+  "str_imm_post_a1",
+  "strt_a1",
+  "str_imm_off_a1",
+  "push_single_a1",
+  "str_imm_pre_a1",
+  "ldr_lit_a1",
+  "pop_single_a1",
+  "ldr_imm_post_a1",
+  "ldrt_a1",
+  "ldr_imm_off_a1",
+  "ldr_imm_pre_a1",
+  "strb_imm_post_a1",
+  "strbt_a1",
+  "strb_imm_off_a1",
+  "strb_imm_pre_a1",
+  "ldrb_lit_a1",
+  "ldrb_imm_post_a1",
+  "ldrbt_a1",
+  "ldrb_imm_off_a1",
+  "ldrb_imm_pre_a1",
+  "str_reg_post_a1",
+  "ldr_reg_post_a1",
+  "sadd16_a1",
+  "sadd8_a1",
+  "sasx_a1",
+  "ssax_a1",
+  "ssub16_a1",
+  "ssub8_a1",
+  "pkhbt_a1",
+  "sel_a1",
+  "pkhtb_a1",
+  "sxtb16_a1",
+  "sxtab16_a1",
+  "strt_a2",
+  "ldrt_a2",
+  "qadd16_a1",
+  "qadd8_a1",
+  "shadd16_a1",
+  "shadd8_a1",
+  "qasx_a1",
+  "shasx_a1",
+  "qsax_a1",
+  "shsax_a1",
+  "qsub16_a1",
+  "qsub8_a1",
+  "shsub16_a1",
+  "shsub8_a1",
+  "ssat_lsl_a1",
+  "ssat16_a1",
+  "rev_a1",
+  "rev16_a1",
+  "ssat_asr_a1",
+  "sxtb_a1",
+  "sxtab_a1",
+  "sxth_a1",
+  "sxtah_a1",
+  "strb_reg_post_a1",
+  "ldrb_reg_post_a1",
+  "uadd16_a1",
+  "uasx_a1",
+  "usax_a1",
+  "usub16_a1",
+  "uadd8_a1",
+  "usub8_a1",
+  "uxtb16_a1",
+  "uxtab16_a1",
+  "strbt_a2",
+  "ldrbt_a2",
+  "uqadd16_a1",
+  "uqadd8_a1",
+  "uhadd16_a1",
+  "uhadd8_a1",
+  "uqasx_a1",
+  "uhasx_a1",
+  "uqsax_a1",
+  "uhsax_a1",
+  "uqsub16_a1",
+  "uqsub8_a1",
+  "uhsub16_a1",
+  "uhsub8_a1",
+  "usat_lsl_a1",
+  "usat16_a1",
+  "rbit_a1",
+  "revsh_a1",
+  "usat_asr_a1",
+  "uxtb_a1",
+  "uxtab_a1",
+  "uxth_a1",
+  "uxtah_a1",
+  "str_reg_off_a1",
+  "ldr_reg_off_a1",
+  "smuad_a1",
+  "smlad_a1",
+  "smuadx_a1",
+  "smladx_a1",
+  "smusd_a1",
+  "smlsd_a1",
+  "smusdx_a1",
+  "smlsdx_a1",
+  "sdiv_a1",
+  "usad8_a1",
+  "usada8_a1",
+  "str_reg_pre_a1",
+  "ldr_reg_pre_a1",
+  "udiv_a1",
+  "sbfx_a1",
+  "strb_reg_off_a1",
+  "ldrb_reg_off_a1",
+  "smlald_a1",
+  "smmul_a1",
+  "smmla_a1",
+  "smlaldx_a1",
+  "smmulr_a1",
+  "smmlar_a1",
+  "smlsld_a1",
+  "smmls_a1",
+  "smlsldx_a1",
+  "smmlsr_a1",
+  "bfc_a1",
+  "bfi_a1",
+  "strb_reg_pre_a1",
+  "ldrb_reg_pre_a1",
+  "ubfx_a1",
+  "udf_a1",
+  "stmda_a1",
+  "stm_a1",
+  "push_list_a1",
+  "stmib_a1",
+  "ldmda_a1",
+  "pop_list_a1",
+  "ldmdb_a1",
+  "ldmib_a1",
+  "stm_usr_a1",
+  "ldm_usr_a1",
+  "ldm_eret_a1",
+  "b_a1",
+  "bl_a1",
+  "vmov_ss_rr_a1",
+  "vmov_d_rr_a1",
+  "vstm_a2",
+  "vstm_a1",
+  "fstmiax_a1",
+  "stc_a1",
+  "mcrr_a1",
+  "vmov_rr_ss_a1",
+  "vmov_rr_d_a1",
+  "vldm_a2",
+  "vpop_a2",
+  "vldm_a1",
+  "vpop_a1",
+  "fldmiax_a1",
+  "ldc_lit_a1",
+  "ldc_imm_a1",
+  "mrrc_a1",
+  "vstr_a2",
+  "vstr_a1",
+  "vstmdb_a2",
+  "vpush_a2",
+  "vstmdb_a1",
+  "vpush_a1",
+  "fstmdbx_a1",
+  "vldr_lit_a2",
+  "vldr_imm_a2",
+  "vldr_lit_a1",
+  "vldr_imm_a1",
+  "vldmdb_a2",
+  "vldmdb_a1",
+  "fldmdbx_a1",
+  "vmla_f32_a2",
+  "vmls_f32_a2",
+  "vmla_f64_a2",
+  "vmls_f64_a2",
+  "vmul_f32_a2",
+  "vnmul_f32_a1",
+  "vmul_f64_a2",
+  "vnmul_f64_a1",
+  "vdiv_f32_a1",
+  "vdiv_f64_a1",
+  "vfma_f32_a2",
+  "vfms_f32_a2",
+  "vfma_f64_a2",
+  "vfms_f64_a2",
+  "vmov_s_r_a1",
+  "vmov_scalar_r_a1",
+  "vmsr_a1",
+  "vdup_d_a1",
+  "vdup_q_a1",
+  "mcr_a1",
+  "vnmls_f32_a1",
+  "vnmla_f32_a1",
+  "vnmls_f64_a1",
+  "vnmla_f64_a1",
+  "vadd_f32_a2",
+  "vsub_f32_a2",
+  "vadd_f64_a2",
+  "vsub_f64_a2",
+  "vfnms_f32_a1",
+  "vfnma_f32_a1",
+  "vfnms_f64_a1",
+  "vfnma_f64_a1",
+  "vmov_imm_f32_a2",
+  "vmov_f32_a2",
+  "vabs_f32_a2",
+  "vneg_f32_a2",
+  "vsqrt_f32_a1",
+  "vcvtb_f32_f16_a1",
+  "vcvtt_f32_f16_a1",
+  "vcvtb_f16_f32_a1",
+  "vcvtt_f16_f32_a1",
+  "vcmp_f32_a1",
+  "vcmpe_f32_a1",
+  "vcmp_f32_a2",
+  "vcmpe_f32_a2",
+  "vrintr_f32_a1",
+  "vrintz_f32_a1",
+  "vrintx_f32_a1",
+  "vcvt_f64_f32_a1",
+  "vcvt_f32_int_a1",
+  "vcvt_f32_fx_a1",
+  "vcvtr_u32_f32_a1",
+  "vcvt_u32_f32_a1",
+  "vcvtr_s32_f32_a1",
+  "vcvt_s32_f32_a1",
+  "vcvt_fx_f32_a1",
+  "vmov_imm_f64_a2",
+  "vmov_f64_a2",
+  "vabs_f64_a2",
+  "vneg_f64_a2",
+  "vsqrt_f64_a1",
+  "vcvtb_f64_f16_a1",
+  "vcvtt_f64_f16_a1",
+  "vcvtb_f16_f64_a1",
+  "vcvtt_f16_f64_a1",
+  "vcmp_f64_a1",
+  "vcmpe_f64_a1",
+  "vcmp_f64_a2",
+  "vcmpe_f64_a2",
+  "vrintr_f64_a1",
+  "vrintz_f64_a1",
+  "vrintx_f64_a1",
+  "vcvt_f32_f64_a1",
+  "vcvt_f64_int_a1",
+  "vcvt_f64_fx_a1",
+  "vcvtr_u32_f64_a1",
+  "vcvt_u32_f64_a1",
+  "vcvtr_s32_f64_a1",
+  "vcvt_s32_f64_a1",
+  "vcvt_fx_f64_a1",
+  "vmov_r_s_a1",
+  "vmrs_a1",
+  "vmov_r_scalar_a1",
+  "mrc_a1",
+  "svc_a1",
+};
+
+// The decode table, as {base, mask, shift, type}. See DecodeTableEntry.
+static const DecodeTableEntry kA32DecodeTable[] = {
+  {6107, 0x1, 0, 2}, {390, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {1, 0x0, 0, 2}, {0, 0x0, 0, 0}, {389, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {3, 0x1, 0, 2}, {5, 0x1, 0, 2},
+  {394, 0x0, 0, 0}, {0, 0x0, 0, 0}, {9, 0x0, 0, 2},
+  {0, 0x0, 0, 0}, {11, 0x2, 0, 2}, {0, 0x0, 0, 0},
+  {31, 0xf, 16, 1}, {31, 0xf, 16, 1}, {31, 0xf, 16, 1},
+  {31, 0xf, 16, 1}, {31, 0xf, 16, 1}, {31, 0xf, 16, 1},
+  {31, 0xf, 16, 1}, {31, 0xf, 16, 1}, {31, 0xf, 16, 1},
+  {31, 0xf, 16, 1}, {31, 0xf, 16, 1}, {31, 0xf, 16, 1},
+  {31, 0xf, 16, 1}, {31, 0xf, 16, 1}, {31, 0xf, 16, 1},
+  {0, 0x0, 0, 0}, {393, 0x0, 0, 0}, {393, 0x0, 0, 0},
+  {393, 0x0, 0, 0}, {393, 0x0, 0, 0}, {393, 0x0, 0, 0},
+  {393, 0x0, 0, 0}, {393, 0x0, 0, 0}, {393, 0x0, 0, 0},
+  {393, 0x0, 0, 0}, {393, 0x0, 0, 0}, {393, 0x0, 0, 0},
+  {393, 0x0, 0, 0}, {393, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {393, 0x0, 0, 0}, {393, 0x0, 0, 0}, {13, 0x1, 0, 2},
+  {15, 0xf, 28, 1}, {392, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {49, 0x0, 0, 2}, {0, 0x0, 0, 0}, {391, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {51, 0x1, 0, 2}, {53, 0x1, 0, 2},
+  {47, 0x0, 0, 2}, {55, 0x0, 0, 2}, {7, 0x0, 0, 2},
+  {57, 0x2, 0, 2}, {396, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {61, 0x0, 0, 2}, {0, 0x0, 0, 0}, {395, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {63, 0x1, 0, 2}, {65, 0x1, 0, 2},
+  {398, 0x0, 0, 0}, {0, 0x0, 0, 0}, {69, 0x0, 0, 2},
+  {0, 0x0, 0, 0}, {397, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {71, 0x1, 0, 2}, {73, 0x1, 0, 2}, {67, 0x0, 0, 2},
+  {75, 0x0, 0, 2}, {402, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {79, 0x0, 0, 2}, {0, 0x0, 0, 0}, {81, 0x2, 0, 2},
+  {0, 0x0, 0, 0}, {101, 0xf, 16, 1}, {101, 0xf, 16, 1},
+  {101, 0xf, 16, 1}, {101, 0xf, 16, 1}, {101, 0xf, 16, 1},
+  {101, 0xf, 16, 1}, {101, 0xf, 16, 1}, {101, 0xf, 16, 1},
+  {101, 0xf, 16, 1}, {101, 0xf, 16, 1}, {101, 0xf, 16, 1},
+  {101, 0xf, 16, 1}, {101, 0xf, 16, 1}, {101, 0xf, 16, 1},
+  {101, 0xf, 16, 1}, {0, 0x0, 0, 0}, {401, 0x0, 0, 0},
+  {401, 0x0, 0, 0}, {401, 0x0, 0, 0}, {401, 0x0, 0, 0},
+  {401, 0x0, 0, 0}, {401, 0x0, 0, 0}, {401, 0x0, 0, 0},
+  {401, 0x0, 0, 0}, {401, 0x0, 0, 0}, {401, 0x0, 0, 0},
+  {401, 0x0, 0, 0}, {401, 0x0, 0, 0}, {401, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {401, 0x0, 0, 0}, {401, 0x0, 0, 0},
+  {83, 0x1, 0, 2}, {85, 0xf, 28, 1}, {400, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {119, 0x0, 0, 2}, {0, 0x0, 0, 0},
+  {399, 0x0, 0, 0}, {0, 0x0, 0, 0}, {121, 0x1, 0, 2},
+  {123, 0x1, 0, 2}, {117, 0x0, 0, 2}, {125, 0x0, 0, 2},
+  {404, 0x0, 0, 0}, {0, 0x0, 0, 0}, {129, 0x0, 0, 2},
+  {0, 0x0, 0, 0}, {403, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {131, 0x1, 0, 2}, {133, 0x1, 0, 2}, {127, 0x2, 0, 2},
+  {135, 0x0, 0, 2}, {406, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {139, 0x0, 0, 2}, {0, 0x0, 0, 0}, {405, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {141, 0x1, 0, 2}, {143, 0x1, 0, 2},
+  {408, 0x0, 0, 0}, {0, 0x0, 0, 0}, {147, 0x0, 0, 2},
+  {0, 0x0, 0, 0}, {407, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {149, 0x1, 0, 2}, {151, 0x1, 0, 2}, {145, 0x0, 0, 2},
+  {153, 0x0, 0, 2}, {409, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {410, 0x0, 0, 0}, {0, 0x0, 0, 0}, {157, 0x1, 0, 2},
+  {159, 0x1, 0, 2}, {411, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {412, 0x0, 0, 0}, {0, 0x0, 0, 0}, {413, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {414, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {173, 0x1, 9, 1}, {175, 0x1, 9, 1}, {163, 0x1, 0, 2},
+  {165, 0x1, 0, 2}, {167, 0x1, 0, 2}, {169, 0x1, 0, 2},
+  {415, 0x0, 0, 0}, {0, 0x0, 0, 0}, {416, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {177, 0x1, 0, 2}, {179, 0x1, 0, 2},
+  {417, 0x0, 0, 0}, {0, 0x0, 0, 0}, {418, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {183, 0x1, 0, 2}, {185, 0x1, 0, 2},
+  {419, 0x0, 0, 0}, {0, 0x0, 0, 0}, {420, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {189, 0x1, 0, 2}, {191, 0x1, 0, 2},
+  {421, 0x0, 0, 0}, {0, 0x0, 0, 0}, {422, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {195, 0x1, 0, 2}, {197, 0x1, 0, 2},
+  {161, 0x1, 9, 1}, {0, 0x0, 0, 0}, {171, 0x1, 22, 1},
+  {0, 0x0, 0, 0}, {181, 0x1, 22, 1}, {187, 0x1, 22, 1},
+  {193, 0x1, 22, 1}, {199, 0x1, 22, 1}, {423, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {424, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {209, 0x1, 0, 2}, {211, 0x1, 0, 2}, {425, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {215, 0x1, 0, 2}, {0, 0x0, 0, 0},
+  {426, 0x0, 0, 0}, {0, 0x0, 0, 0}, {427, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {225, 0x1, 9, 1}, {0, 0x0, 0, 0},
+  {219, 0x1, 0, 2}, {221, 0x1, 0, 2}, {428, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {227, 0x1, 0, 2},
+  {429, 0x0, 0, 0}, {0, 0x0, 0, 0}, {430, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {231, 0x1, 0, 2}, {233, 0x1, 0, 2},
+  {431, 0x0, 0, 0}, {0, 0x0, 0, 0}, {432, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {237, 0x1, 0, 2}, {239, 0x1, 0, 2},
+  {433, 0x0, 0, 0}, {0, 0x0, 0, 0}, {434, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {243, 0x1, 0, 2}, {245, 0x1, 0, 2},
+  {435, 0x0, 0, 0}, {0, 0x0, 0, 0}, {436, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {249, 0x1, 0, 2}, {251, 0x1, 0, 2},
+  {213, 0x1, 9, 1}, {217, 0x1, 22, 1}, {223, 0x1, 22, 1},
+  {229, 0x1, 22, 1}, {235, 0x1, 22, 1}, {241, 0x1, 22, 1},
+  {247, 0x1, 22, 1}, {253, 0x1, 22, 1}, {438, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {263, 0x0, 0, 2}, {0, 0x0, 0, 0},
+  {437, 0x0, 0, 0}, {0, 0x0, 0, 0}, {265, 0x1, 0, 2},
+  {267, 0x1, 0, 2}, {440, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {271, 0x0, 0, 2}, {0, 0x0, 0, 0}, {439, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {273, 0x1, 0, 2}, {275, 0x1, 0, 2},
+  {269, 0x0, 0, 2}, {277, 0x0, 0, 2}, {446, 0x0, 0, 0},
+  {445, 0x0, 0, 0}, {281, 0x3, 0, 2}, {445, 0x0, 0, 0},
+  {445, 0x0, 0, 0}, {283, 0x1, 0, 2}, {444, 0x0, 0, 0},
+  {285, 0x4, 0, 2}, {285, 0x4, 0, 2}, {287, 0x1, 0, 2},
+  {447, 0x0, 0, 0}, {289, 0x5, 0, 2}, {291, 0x3, 0, 2},
+  {289, 0x5, 0, 2}, {289, 0x5, 0, 2}, {293, 0x1, 0, 2},
+  {443, 0x0, 0, 0}, {295, 0x6, 0, 2}, {295, 0x6, 0, 2},
+  {297, 0x1, 0, 2}, {299, 0x7, 0, 2}, {0, 0x0, 0, 0},
+  {301, 0x0, 0, 2}, {0, 0x0, 0, 0}, {442, 0x0, 0, 0},
+  {441, 0x0, 0, 0}, {305, 0x1, 0, 2}, {0, 0x0, 0, 0},
+  {303, 0x1, 0, 2}, {307, 0x1, 0, 2}, {449, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {311, 0x0, 0, 2}, {0, 0x0, 0, 0},
+  {448, 0x0, 0, 0}, {0, 0x0, 0, 0}, {313, 0x1, 0, 2},
+  {315, 0x1, 0, 2}, {309, 0x0, 0, 2}, {317, 0x0, 0, 2},
+  {325, 0x1, 21, 1}, {327, 0x1, 21, 1}, {329, 0x1, 21, 1},
+  {331, 0x1, 21, 1}, {59, 0x1, 22, 1}, {77, 0x1, 22, 1},
+  {137, 0x1, 22, 1}, {155, 0x1, 22, 1}, {201, 0x7, 5, 1},
+  {255, 0x7, 5, 1}, {279, 0x1, 22, 1}, {319, 0x1, 22, 1},
+  {450, 0x0, 0, 0}, {0, 0x0, 0, 0}, {451, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {452, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {453, 0x0, 0, 0}, {0, 0x0, 0, 0}, {454, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {455, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {341, 0x1, 0, 2},
+  {343, 0x1, 0, 2}, {456, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {457, 0x0, 0, 0}, {0, 0x0, 0, 0}, {458, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {459, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {349, 0x1, 0, 2}, {351, 0x1, 0, 2}, {353, 0x1, 0, 2},
+  {355, 0x1, 0, 2}, {460, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {465, 0x0, 0, 0}, {464, 0x0, 0, 0}, {464, 0x0, 0, 0},
+  {363, 0x1, 0, 2}, {463, 0x0, 0, 0}, {365, 0x4, 0, 2},
+  {365, 0x4, 0, 2}, {367, 0x1, 0, 2}, {462, 0x0, 0, 0},
+  {369, 0x5, 0, 2}, {369, 0x5, 0, 2}, {371, 0x1, 0, 2},
+  {461, 0x0, 0, 0}, {373, 0x6, 0, 2}, {373, 0x6, 0, 2},
+  {375, 0x1, 0, 2}, {377, 0x7, 0, 2}, {0, 0x0, 0, 0},
+  {385, 0x1, 21, 1}, {387, 0x1, 21, 1}, {389, 0x1, 21, 1},
+  {391, 0x1, 21, 1}, {333, 0x1, 0, 2}, {335, 0x1, 0, 2},
+  {337, 0x1, 0, 2}, {339, 0x1, 0, 2}, {345, 0x3, 5, 1},
+  {357, 0x3, 5, 1}, {361, 0x1, 0, 2}, {379, 0x1, 0, 2},
+  {466, 0x0, 0, 0}, {0, 0x0, 0, 0}, {467, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {393, 0x1, 0, 2}, {395, 0x1, 0, 2},
+  {468, 0x0, 0, 0}, {0, 0x0, 0, 0}, {469, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {470, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {471, 0x0, 0, 0}, {0, 0x0, 0, 0}, {472, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {405, 0x1, 0, 2}, {407, 0x1, 0, 2},
+  {473, 0x0, 0, 0}, {0, 0x0, 0, 0}, {474, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {475, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {476, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {421, 0x3, 8, 1}, {413, 0x1, 0, 2}, {0, 0x0, 0, 0},
+  {415, 0x1, 0, 2}, {417, 0x1, 0, 2}, {477, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {478, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {479, 0x0, 0, 0}, {0, 0x0, 0, 0}, {480, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {481, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {437, 0x3, 8, 1}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {431, 0x1, 0, 2}, {433, 0x1, 0, 2},
+  {482, 0x0, 0, 0}, {0, 0x0, 0, 0}, {483, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {484, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {449, 0x1, 21, 1}, {459, 0x1, 21, 1}, {451, 0x3, 5, 1},
+  {455, 0x3, 5, 1}, {397, 0x1, 23, 1}, {399, 0x1, 0, 2},
+  {401, 0x1, 0, 2}, {403, 0x1, 0, 2}, {409, 0x1, 23, 1},
+  {411, 0x1, 0, 2}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {461, 0x3, 5, 1}, {465, 0x3, 5, 1}, {419, 0x1, 23, 1},
+  {425, 0x1, 0, 2}, {427, 0x1, 0, 2}, {429, 0x1, 0, 2},
+  {435, 0x1, 23, 1}, {441, 0x1, 0, 2}, {443, 0x1, 0, 2},
+  {445, 0x1, 0, 2}, {485, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {486, 0x0, 0, 0}, {0, 0x0, 0, 0}, {487, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {488, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {489, 0x0, 0, 0}, {0, 0x0, 0, 0}, {490, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {477, 0x1, 0, 2}, {479, 0x1, 0, 2}, {491, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {492, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {493, 0x0, 0, 0}, {0, 0x0, 0, 0}, {485, 0x1, 0, 2},
+  {0, 0x0, 0, 0}, {487, 0x1, 0, 2}, {489, 0x1, 0, 2},
+  {494, 0x0, 0, 0}, {0, 0x0, 0, 0}, {495, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {503, 0x1, 21, 1}, {505, 0x1, 21, 1},
+  {507, 0x1, 21, 1}, {509, 0x1, 21, 1}, {469, 0x1, 0, 2},
+  {471, 0x1, 0, 2}, {473, 0x1, 0, 2}, {475, 0x1, 0, 2},
+  {481, 0x3, 5, 1}, {491, 0x3, 5, 1}, {495, 0x1, 0, 2},
+  {497, 0x1, 0, 2}, {496, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {497, 0x0, 0, 0}, {0, 0x0, 0, 0}, {498, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {499, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {500, 0x0, 0, 0}, {0, 0x0, 0, 0}, {501, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {502, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {519, 0x1, 0, 2}, {0, 0x0, 0, 0}, {521, 0x1, 0, 2},
+  {523, 0x1, 0, 2}, {503, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {504, 0x0, 0, 0}, {0, 0x0, 0, 0}, {505, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {529, 0x1, 0, 2}, {0, 0x0, 0, 0},
+  {531, 0x1, 0, 2}, {533, 0x1, 0, 2}, {543, 0x1, 21, 1},
+  {545, 0x1, 21, 1}, {0, 0x0, 0, 0}, {547, 0x1, 21, 1},
+  {511, 0x1, 0, 2}, {513, 0x1, 0, 2}, {515, 0x1, 0, 2},
+  {517, 0x1, 0, 2}, {525, 0x3, 8, 1}, {535, 0x3, 8, 1},
+  {506, 0x0, 0, 0}, {0, 0x0, 0, 0}, {507, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {508, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {509, 0x0, 0, 0}, {0, 0x0, 0, 0}, {559, 0x1, 21, 1},
+  {561, 0x1, 21, 1}, {549, 0x1, 0, 2}, {551, 0x1, 0, 2},
+  {553, 0x1, 0, 2}, {555, 0x1, 0, 2}, {579, 0xf, 16, 1},
+  {579, 0xf, 16, 1}, {579, 0xf, 16, 1}, {579, 0xf, 16, 1},
+  {579, 0xf, 16, 1}, {579, 0xf, 16, 1}, {579, 0xf, 16, 1},
+  {579, 0xf, 16, 1}, {579, 0xf, 16, 1}, {579, 0xf, 16, 1},
+  {579, 0xf, 16, 1}, {579, 0xf, 16, 1}, {579, 0xf, 16, 1},
+  {579, 0xf, 16, 1}, {579, 0xf, 16, 1}, {0, 0x0, 0, 0},
+  {511, 0x0, 0, 0}, {511, 0x0, 0, 0}, {511, 0x0, 0, 0},
+  {511, 0x0, 0, 0}, {511, 0x0, 0, 0}, {511, 0x0, 0, 0},
+  {511, 0x0, 0, 0}, {511, 0x0, 0, 0}, {511, 0x0, 0, 0},
+  {511, 0x0, 0, 0}, {511, 0x0, 0, 0}, {511, 0x0, 0, 0},
+  {511, 0x0, 0, 0}, {511, 0x0, 0, 0}, {511, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {611, 0xf, 16, 1}, {611, 0xf, 16, 1},
+  {611, 0xf, 16, 1}, {611, 0xf, 16, 1}, {611, 0xf, 16, 1},
+  {611, 0xf, 16, 1}, {611, 0xf, 16, 1}, {611, 0xf, 16, 1},
+  {611, 0xf, 16, 1}, {611, 0xf, 16, 1}, {611, 0xf, 16, 1},
+  {611, 0xf, 16, 1}, {611, 0xf, 16, 1}, {611, 0xf, 16, 1},
+  {611, 0xf, 16, 1}, {0, 0x0, 0, 0}, {512, 0x0, 0, 0},
+  {512, 0x0, 0, 0}, {512, 0x0, 0, 0}, {512, 0x0, 0, 0},
+  {512, 0x0, 0, 0}, {512, 0x0, 0, 0}, {512, 0x0, 0, 0},
+  {512, 0x0, 0, 0}, {512, 0x0, 0, 0}, {512, 0x0, 0, 0},
+  {512, 0x0, 0, 0}, {512, 0x0, 0, 0}, {512, 0x0, 0, 0},
+  {512, 0x0, 0, 0}, {512, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {643, 0xf, 16, 1}, {643, 0xf, 16, 1}, {643, 0xf, 16, 1},
+  {643, 0xf, 16, 1}, {643, 0xf, 16, 1}, {643, 0xf, 16, 1},
+  {643, 0xf, 16, 1}, {643, 0xf, 16, 1}, {643, 0xf, 16, 1},
+  {643, 0xf, 16, 1}, {643, 0xf, 16, 1}, {643, 0xf, 16, 1},
+  {643, 0xf, 16, 1}, {643, 0xf, 16, 1}, {643, 0xf, 16, 1},
+  {0, 0x0, 0, 0}, {513, 0x0, 0, 0}, {513, 0x0, 0, 0},
+  {513, 0x0, 0, 0}, {513, 0x0, 0, 0}, {513, 0x0, 0, 0},
+  {513, 0x0, 0, 0}, {513, 0x0, 0, 0}, {513, 0x0, 0, 0},
+  {513, 0x0, 0, 0}, {513, 0x0, 0, 0}, {513, 0x0, 0, 0},
+  {513, 0x0, 0, 0}, {513, 0x0, 0, 0}, {513, 0x0, 0, 0},
+  {513, 0x0, 0, 0}, {0, 0x0, 0, 0}, {661, 0x1, 21, 1},
+  {663, 0x1, 21, 1}, {563, 0xf, 28, 1}, {0, 0x0, 0, 0},
+  {595, 0xf, 28, 1}, {627, 0xf, 28, 1}, {510, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {659, 0x1, 24, 1}, {665, 0x1, 0, 2},
+  {514, 0x0, 0, 0}, {0, 0x0, 0, 0}, {515, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {516, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {677, 0x1, 21, 1}, {679, 0x1, 21, 1}, {669, 0x1, 0, 2},
+  {0, 0x0, 0, 0}, {671, 0x1, 0, 2}, {673, 0x1, 0, 2},
+  {539, 0x3, 23, 1}, {557, 0x1, 24, 1}, {667, 0x8, 0, 2},
+  {675, 0x1, 24, 1}, {687, 0x1, 7, 1}, {689, 0x1, 7, 1},
+  {381, 0x3, 23, 1}, {447, 0x1, 24, 1}, {499, 0x3, 23, 1},
+  {681, 0x3, 5, 1}, {518, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {691, 0x0, 0, 2}, {0, 0x0, 0, 0}, {517, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {693, 0x1, 0, 2}, {695, 0x1, 0, 2},
+  {520, 0x0, 0, 0}, {0, 0x0, 0, 0}, {699, 0x0, 0, 2},
+  {0, 0x0, 0, 0}, {519, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {701, 0x1, 0, 2}, {703, 0x1, 0, 2}, {524, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {707, 0x0, 0, 2}, {0, 0x0, 0, 0},
+  {709, 0x2, 0, 2}, {0, 0x0, 0, 0}, {729, 0xf, 16, 1},
+  {729, 0xf, 16, 1}, {729, 0xf, 16, 1}, {729, 0xf, 16, 1},
+  {729, 0xf, 16, 1}, {729, 0xf, 16, 1}, {729, 0xf, 16, 1},
+  {729, 0xf, 16, 1}, {729, 0xf, 16, 1}, {729, 0xf, 16, 1},
+  {729, 0xf, 16, 1}, {729, 0xf, 16, 1}, {729, 0xf, 16, 1},
+  {729, 0xf, 16, 1}, {729, 0xf, 16, 1}, {0, 0x0, 0, 0},
+  {523, 0x0, 0, 0}, {523, 0x0, 0, 0}, {523, 0x0, 0, 0},
+  {523, 0x0, 0, 0}, {523, 0x0, 0, 0}, {523, 0x0, 0, 0},
+  {523, 0x0, 0, 0}, {523, 0x0, 0, 0}, {523, 0x0, 0, 0},
+  {523, 0x0, 0, 0}, {523, 0x0, 0, 0}, {523, 0x0, 0, 0},
+  {523, 0x0, 0, 0}, {0, 0x0, 0, 0}, {523, 0x0, 0, 0},
+  {523, 0x0, 0, 0}, {711, 0x1, 0, 2}, {713, 0xf, 28, 1},
+  {522, 0x0, 0, 0}, {0, 0x0, 0, 0}, {747, 0x0, 0, 2},
+  {0, 0x0, 0, 0}, {521, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {749, 0x1, 0, 2}, {751, 0x1, 0, 2}, {745, 0x0, 0, 2},
+  {753, 0x0, 0, 2}, {526, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {757, 0x0, 0, 2}, {0, 0x0, 0, 0}, {525, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {759, 0x1, 0, 2}, {761, 0x1, 0, 2},
+  {530, 0x0, 0, 0}, {0, 0x0, 0, 0}, {765, 0x0, 0, 2},
+  {0, 0x0, 0, 0}, {767, 0x2, 0, 2}, {0, 0x0, 0, 0},
+  {787, 0xf, 16, 1}, {787, 0xf, 16, 1}, {787, 0xf, 16, 1},
+  {787, 0xf, 16, 1}, {787, 0xf, 16, 1}, {787, 0xf, 16, 1},
+  {787, 0xf, 16, 1}, {787, 0xf, 16, 1}, {787, 0xf, 16, 1},
+  {787, 0xf, 16, 1}, {787, 0xf, 16, 1}, {787, 0xf, 16, 1},
+  {787, 0xf, 16, 1}, {787, 0xf, 16, 1}, {787, 0xf, 16, 1},
+  {0, 0x0, 0, 0}, {529, 0x0, 0, 0}, {529, 0x0, 0, 0},
+  {529, 0x0, 0, 0}, {529, 0x0, 0, 0}, {529, 0x0, 0, 0},
+  {529, 0x0, 0, 0}, {529, 0x0, 0, 0}, {529, 0x0, 0, 0},
+  {529, 0x0, 0, 0}, {529, 0x0, 0, 0}, {529, 0x0, 0, 0},
+  {529, 0x0, 0, 0}, {529, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {529, 0x0, 0, 0}, {529, 0x0, 0, 0}, {769, 0x1, 0, 2},
+  {771, 0xf, 28, 1}, {528, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {805, 0x0, 0, 2}, {0, 0x0, 0, 0}, {527, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {807, 0x1, 0, 2}, {809, 0x1, 0, 2},
+  {803, 0x0, 0, 2}, {811, 0x0, 0, 2}, {532, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {815, 0x0, 0, 2}, {0, 0x0, 0, 0},
+  {531, 0x0, 0, 0}, {0, 0x0, 0, 0}, {817, 0x1, 0, 2},
+  {819, 0x1, 0, 2}, {534, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {823, 0x0, 0, 2}, {0, 0x0, 0, 0}, {533, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {825, 0x1, 0, 2}, {827, 0x1, 0, 2},
+  {536, 0x0, 0, 0}, {0, 0x0, 0, 0}, {831, 0x0, 0, 2},
+  {0, 0x0, 0, 0}, {535, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {833, 0x1, 0, 2}, {835, 0x1, 0, 2}, {538, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {839, 0x0, 0, 2}, {0, 0x0, 0, 0},
+  {537, 0x0, 0, 0}, {0, 0x0, 0, 0}, {841, 0x1, 0, 2},
+  {843, 0x1, 0, 2}, {540, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {847, 0x0, 0, 2}, {0, 0x0, 0, 0}, {539, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {849, 0x1, 0, 2}, {851, 0x1, 0, 2},
+  {542, 0x0, 0, 0}, {0, 0x0, 0, 0}, {855, 0x0, 0, 2},
+  {0, 0x0, 0, 0}, {541, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {857, 0x1, 0, 2}, {859, 0x1, 0, 2}, {544, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {863, 0x0, 0, 2}, {0, 0x0, 0, 0},
+  {543, 0x0, 0, 0}, {0, 0x0, 0, 0}, {865, 0x1, 0, 2},
+  {867, 0x1, 0, 2}, {546, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {871, 0x0, 0, 2}, {0, 0x0, 0, 0}, {545, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {873, 0x1, 0, 2}, {875, 0x1, 0, 2},
+  {552, 0x0, 0, 0}, {551, 0x0, 0, 0}, {879, 0x3, 0, 2},
+  {551, 0x0, 0, 0}, {551, 0x0, 0, 0}, {881, 0x1, 0, 2},
+  {550, 0x0, 0, 0}, {883, 0x4, 0, 2}, {883, 0x4, 0, 2},
+  {885, 0x1, 0, 2}, {553, 0x0, 0, 0}, {887, 0x5, 0, 2},
+  {889, 0x3, 0, 2}, {887, 0x5, 0, 2}, {887, 0x5, 0, 2},
+  {891, 0x1, 0, 2}, {549, 0x0, 0, 0}, {893, 0x6, 0, 2},
+  {893, 0x6, 0, 2}, {895, 0x1, 0, 2}, {897, 0x7, 0, 2},
+  {0, 0x0, 0, 0}, {899, 0x0, 0, 2}, {0, 0x0, 0, 0},
+  {548, 0x0, 0, 0}, {547, 0x0, 0, 0}, {903, 0x1, 0, 2},
+  {0, 0x0, 0, 0}, {901, 0x1, 0, 2}, {905, 0x1, 0, 2},
+  {555, 0x0, 0, 0}, {0, 0x0, 0, 0}, {909, 0x0, 0, 2},
+  {0, 0x0, 0, 0}, {554, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {911, 0x1, 0, 2}, {913, 0x1, 0, 2}, {557, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {917, 0x0, 0, 2}, {0, 0x0, 0, 0},
+  {556, 0x0, 0, 0}, {0, 0x0, 0, 0}, {919, 0x1, 0, 2},
+  {921, 0x1, 0, 2}, {697, 0x0, 0, 2}, {705, 0x0, 0, 2},
+  {755, 0x2, 0, 2}, {763, 0x0, 0, 2}, {813, 0x2, 0, 2},
+  {821, 0x0, 0, 2}, {829, 0x0, 0, 2}, {837, 0x0, 0, 2},
+  {845, 0x0, 0, 2}, {853, 0x0, 0, 2}, {861, 0x0, 0, 2},
+  {869, 0x0, 0, 2}, {877, 0x0, 0, 2}, {907, 0x0, 0, 2},
+  {915, 0x0, 0, 2}, {923, 0x0, 0, 2}, {558, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {559, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {560, 0x0, 0, 0}, {0, 0x0, 0, 0}, {561, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {562, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {563, 0x0, 0, 0}, {0, 0x0, 0, 0}, {564, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {569, 0x0, 0, 0}, {568, 0x0, 0, 0},
+  {568, 0x0, 0, 0}, {955, 0x1, 0, 2}, {567, 0x0, 0, 0},
+  {957, 0x4, 0, 2}, {957, 0x4, 0, 2}, {959, 0x1, 0, 2},
+  {566, 0x0, 0, 0}, {961, 0x5, 0, 2}, {961, 0x5, 0, 2},
+  {963, 0x1, 0, 2}, {565, 0x0, 0, 0}, {965, 0x6, 0, 2},
+  {965, 0x6, 0, 2}, {967, 0x1, 0, 2}, {969, 0x7, 0, 2},
+  {0, 0x0, 0, 0}, {977, 0x1, 21, 1}, {979, 0x1, 21, 1},
+  {981, 0x1, 21, 1}, {983, 0x1, 21, 1}, {941, 0x1, 0, 2},
+  {943, 0x1, 0, 2}, {945, 0x1, 0, 2}, {947, 0x1, 0, 2},
+  {949, 0x1, 0, 2}, {951, 0x1, 0, 2}, {953, 0x1, 0, 2},
+  {971, 0x1, 0, 2}, {570, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {571, 0x0, 0, 0}, {0, 0x0, 0, 0}, {985, 0x1, 0, 2},
+  {987, 0x1, 0, 2}, {572, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {573, 0x0, 0, 0}, {0, 0x0, 0, 0}, {574, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {575, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {576, 0x0, 0, 0}, {0, 0x0, 0, 0}, {997, 0x1, 0, 2},
+  {999, 0x1, 0, 2}, {577, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {578, 0x0, 0, 0}, {0, 0x0, 0, 0}, {579, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {580, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {581, 0x0, 0, 0}, {0, 0x0, 0, 0}, {582, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {1017, 0x3, 8, 1},
+  {1009, 0x1, 0, 2}, {0, 0x0, 0, 0}, {1011, 0x1, 0, 2},
+  {1013, 0x1, 0, 2}, {583, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {584, 0x0, 0, 0}, {0, 0x0, 0, 0}, {585, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {586, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {587, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {1033, 0x3, 8, 1}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {1027, 0x1, 0, 2}, {1029, 0x1, 0, 2}, {588, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {589, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {590, 0x0, 0, 0}, {0, 0x0, 0, 0}, {1045, 0x1, 21, 1},
+  {1055, 0x1, 21, 1}, {1047, 0x3, 5, 1}, {1051, 0x3, 5, 1},
+  {989, 0x1, 23, 1}, {991, 0x1, 0, 2}, {993, 0x1, 0, 2},
+  {995, 0x1, 0, 2}, {1001, 0x1, 23, 1}, {1003, 0x1, 0, 2},
+  {1005, 0x1, 0, 2}, {1007, 0x1, 0, 2}, {1057, 0x3, 5, 1},
+  {1061, 0x3, 5, 1}, {1015, 0x1, 23, 1}, {1021, 0x1, 0, 2},
+  {1023, 0x1, 0, 2}, {1025, 0x1, 0, 2}, {1031, 0x1, 23, 1},
+  {1037, 0x1, 0, 2}, {1039, 0x1, 0, 2}, {1041, 0x1, 0, 2},
+  {591, 0x0, 0, 0}, {0, 0x0, 0, 0}, {592, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {593, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {594, 0x0, 0, 0}, {0, 0x0, 0, 0}, {595, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {596, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {597, 0x0, 0, 0}, {0, 0x0, 0, 0}, {598, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {1085, 0x1, 21, 1}, {1087, 0x1, 21, 1},
+  {1089, 0x1, 21, 1}, {1091, 0x1, 21, 1}, {1065, 0x1, 0, 2},
+  {1067, 0x1, 0, 2}, {1069, 0x1, 0, 2}, {1071, 0x1, 0, 2},
+  {1073, 0x1, 0, 2}, {1075, 0x1, 0, 2}, {1077, 0x1, 0, 2},
+  {1079, 0x1, 0, 2}, {599, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {600, 0x0, 0, 0}, {0, 0x0, 0, 0}, {601, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {602, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {603, 0x0, 0, 0}, {0, 0x0, 0, 0}, {1097, 0x1, 0, 2},
+  {0, 0x0, 0, 0}, {1099, 0x1, 0, 2}, {1101, 0x1, 0, 2},
+  {604, 0x0, 0, 0}, {0, 0x0, 0, 0}, {605, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {606, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {1107, 0x1, 0, 2}, {0, 0x0, 0, 0}, {1109, 0x1, 0, 2},
+  {1111, 0x1, 0, 2}, {0, 0x0, 0, 0}, {1121, 0x1, 21, 1},
+  {0, 0x0, 0, 0}, {1123, 0x1, 21, 1}, {1093, 0x1, 0, 2},
+  {1095, 0x1, 0, 2}, {1103, 0x3, 8, 1}, {1113, 0x3, 8, 1},
+  {1141, 0xf, 16, 1}, {1141, 0xf, 16, 1}, {1141, 0xf, 16, 1},
+  {1141, 0xf, 16, 1}, {1141, 0xf, 16, 1}, {1141, 0xf, 16, 1},
+  {1141, 0xf, 16, 1}, {1141, 0xf, 16, 1}, {1141, 0xf, 16, 1},
+  {1141, 0xf, 16, 1}, {1141, 0xf, 16, 1}, {1141, 0xf, 16, 1},
+  {1141, 0xf, 16, 1}, {1141, 0xf, 16, 1}, {1141, 0xf, 16, 1},
+  {0, 0x0, 0, 0}, {608, 0x0, 0, 0}, {608, 0x0, 0, 0},
+  {608, 0x0, 0, 0}, {608, 0x0, 0, 0}, {608, 0x0, 0, 0},
+  {608, 0x0, 0, 0}, {608, 0x0, 0, 0}, {608, 0x0, 0, 0},
+  {608, 0x0, 0, 0}, {608, 0x0, 0, 0}, {608, 0x0, 0, 0},
+  {608, 0x0, 0, 0}, {608, 0x0, 0, 0}, {608, 0x0, 0, 0},
+  {608, 0x0, 0, 0}, {0, 0x0, 0, 0}, {1173, 0x1, 24, 1},
+  {1173, 0x1, 24, 1}, {1173, 0x1, 24, 1}, {1173, 0x1, 24, 1},
+  {1173, 0x1, 24, 1}, {1173, 0x1, 24, 1}, {1173, 0x1, 24, 1},
+  {1173, 0x1, 24, 1}, {1173, 0x1, 24, 1}, {1173, 0x1, 24, 1},
+  {1173, 0x1, 24, 1}, {1173, 0x1, 24, 1}, {1173, 0x1, 24, 1},
+  {1173, 0x1, 24, 1}, {1173, 0x1, 24, 1}, {0, 0x0, 0, 0},
+  {1175, 0x1, 21, 1}, {607, 0x0, 0, 0}, {607, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {1125, 0xf, 28, 1}, {1157, 0xf, 28, 1},
+  {609, 0x0, 0, 0}, {0, 0x0, 0, 0}, {1197, 0xf, 16, 1},
+  {1197, 0xf, 16, 1}, {1197, 0xf, 16, 1}, {1197, 0xf, 16, 1},
+  {1197, 0xf, 16, 1}, {1197, 0xf, 16, 1}, {1197, 0xf, 16, 1},
+  {1197, 0xf, 16, 1}, {1197, 0xf, 16, 1}, {1197, 0xf, 16, 1},
+  {1197, 0xf, 16, 1}, {1197, 0xf, 16, 1}, {1197, 0xf, 16, 1},
+  {1197, 0xf, 16, 1}, {1197, 0xf, 16, 1}, {0, 0x0, 0, 0},
+  {610, 0x0, 0, 0}, {610, 0x0, 0, 0}, {610, 0x0, 0, 0},
+  {610, 0x0, 0, 0}, {610, 0x0, 0, 0}, {610, 0x0, 0, 0},
+  {610, 0x0, 0, 0}, {610, 0x0, 0, 0}, {610, 0x0, 0, 0},
+  {610, 0x0, 0, 0}, {610, 0x0, 0, 0}, {610, 0x0, 0, 0},
+  {610, 0x0, 0, 0}, {610, 0x0, 0, 0}, {610, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {1181, 0xf, 28, 1}, {1157, 0xf, 28, 1},
+  {1231, 0xf, 16, 1}, {1231, 0xf, 16, 1}, {1231, 0xf, 16, 1},
+  {1231, 0xf, 16, 1}, {1231, 0xf, 16, 1}, {1231, 0xf, 16, 1},
+  {1231, 0xf, 16, 1}, {1231, 0xf, 16, 1}, {1231, 0xf, 16, 1},
+  {1231, 0xf, 16, 1}, {1231, 0xf, 16, 1}, {1231, 0xf, 16, 1},
+  {1231, 0xf, 16, 1}, {1231, 0xf, 16, 1}, {1231, 0xf, 16, 1},
+  {0, 0x0, 0, 0}, {611, 0x0, 0, 0}, {611, 0x0, 0, 0},
+  {611, 0x0, 0, 0}, {611, 0x0, 0, 0}, {611, 0x0, 0, 0},
+  {611, 0x0, 0, 0}, {611, 0x0, 0, 0}, {611, 0x0, 0, 0},
+  {611, 0x0, 0, 0}, {611, 0x0, 0, 0}, {611, 0x0, 0, 0},
+  {611, 0x0, 0, 0}, {611, 0x0, 0, 0}, {611, 0x0, 0, 0},
+  {611, 0x0, 0, 0}, {0, 0x0, 0, 0}, {1215, 0xf, 28, 1},
+  {1157, 0xf, 28, 1}, {1251, 0x1, 21, 1}, {1253, 0x1, 21, 1},
+  {1177, 0x8, 0, 2}, {1179, 0x1, 0, 2}, {1213, 0x8, 0, 2},
+  {1247, 0x8, 0, 2}, {1271, 0xf, 16, 1}, {1271, 0xf, 16, 1},
+  {1271, 0xf, 16, 1}, {1271, 0xf, 16, 1}, {1271, 0xf, 16, 1},
+  {1271, 0xf, 16, 1}, {1271, 0xf, 16, 1}, {1271, 0xf, 16, 1},
+  {1271, 0xf, 16, 1}, {1271, 0xf, 16, 1}, {1271, 0xf, 16, 1},
+  {1271, 0xf, 16, 1}, {1271, 0xf, 16, 1}, {1271, 0xf, 16, 1},
+  {1271, 0xf, 16, 1}, {0, 0x0, 0, 0}, {613, 0x0, 0, 0},
+  {613, 0x0, 0, 0}, {613, 0x0, 0, 0}, {613, 0x0, 0, 0},
+  {613, 0x0, 0, 0}, {613, 0x0, 0, 0}, {613, 0x0, 0, 0},
+  {613, 0x0, 0, 0}, {613, 0x0, 0, 0}, {613, 0x0, 0, 0},
+  {613, 0x0, 0, 0}, {613, 0x0, 0, 0}, {613, 0x0, 0, 0},
+  {613, 0x0, 0, 0}, {613, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {1303, 0x1, 24, 1}, {1303, 0x1, 24, 1}, {1303, 0x1, 24, 1},
+  {1303, 0x1, 24, 1}, {1303, 0x1, 24, 1}, {1303, 0x1, 24, 1},
+  {1303, 0x1, 24, 1}, {1303, 0x1, 24, 1}, {1303, 0x1, 24, 1},
+  {1303, 0x1, 24, 1}, {1303, 0x1, 24, 1}, {1303, 0x1, 24, 1},
+  {1303, 0x1, 24, 1}, {1303, 0x1, 24, 1}, {1303, 0x1, 24, 1},
+  {0, 0x0, 0, 0}, {1305, 0x1, 21, 1}, {612, 0x0, 0, 0},
+  {612, 0x0, 0, 0}, {0, 0x0, 0, 0}, {1255, 0xf, 28, 1},
+  {1287, 0xf, 28, 1}, {614, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {1327, 0xf, 16, 1}, {1327, 0xf, 16, 1}, {1327, 0xf, 16, 1},
+  {1327, 0xf, 16, 1}, {1327, 0xf, 16, 1}, {1327, 0xf, 16, 1},
+  {1327, 0xf, 16, 1}, {1327, 0xf, 16, 1}, {1327, 0xf, 16, 1},
+  {1327, 0xf, 16, 1}, {1327, 0xf, 16, 1}, {1327, 0xf, 16, 1},
+  {1327, 0xf, 16, 1}, {1327, 0xf, 16, 1}, {1327, 0xf, 16, 1},
+  {0, 0x0, 0, 0}, {615, 0x0, 0, 0}, {615, 0x0, 0, 0},
+  {615, 0x0, 0, 0}, {615, 0x0, 0, 0}, {615, 0x0, 0, 0},
+  {615, 0x0, 0, 0}, {615, 0x0, 0, 0}, {615, 0x0, 0, 0},
+  {615, 0x0, 0, 0}, {615, 0x0, 0, 0}, {615, 0x0, 0, 0},
+  {615, 0x0, 0, 0}, {615, 0x0, 0, 0}, {615, 0x0, 0, 0},
+  {615, 0x0, 0, 0}, {0, 0x0, 0, 0}, {1311, 0xf, 28, 1},
+  {1287, 0xf, 28, 1}, {1361, 0xf, 16, 1}, {1361, 0xf, 16, 1},
+  {1361, 0xf, 16, 1}, {1361, 0xf, 16, 1}, {1361, 0xf, 16, 1},
+  {1361, 0xf, 16, 1}, {1361, 0xf, 16, 1}, {1361, 0xf, 16, 1},
+  {1361, 0xf, 16, 1}, {1361, 0xf, 16, 1}, {1361, 0xf, 16, 1},
+  {1361, 0xf, 16, 1}, {1361, 0xf, 16, 1}, {1361, 0xf, 16, 1},
+  {1361, 0xf, 16, 1}, {0, 0x0, 0, 0}, {616, 0x0, 0, 0},
+  {616, 0x0, 0, 0}, {616, 0x0, 0, 0}, {616, 0x0, 0, 0},
+  {616, 0x0, 0, 0}, {616, 0x0, 0, 0}, {616, 0x0, 0, 0},
+  {616, 0x0, 0, 0}, {616, 0x0, 0, 0}, {616, 0x0, 0, 0},
+  {616, 0x0, 0, 0}, {616, 0x0, 0, 0}, {616, 0x0, 0, 0},
+  {616, 0x0, 0, 0}, {616, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {1345, 0xf, 28, 1}, {1287, 0xf, 28, 1}, {1381, 0x1, 21, 1},
+  {1383, 0x1, 21, 1}, {1307, 0x8, 0, 2}, {1309, 0x1, 0, 2},
+  {1343, 0x8, 0, 2}, {1377, 0x8, 0, 2}, {1401, 0xf, 16, 1},
+  {1401, 0xf, 16, 1}, {1401, 0xf, 16, 1}, {1401, 0xf, 16, 1},
+  {1401, 0xf, 16, 1}, {1401, 0xf, 16, 1}, {1401, 0xf, 16, 1},
+  {1401, 0xf, 16, 1}, {1401, 0xf, 16, 1}, {1401, 0xf, 16, 1},
+  {1401, 0xf, 16, 1}, {1401, 0xf, 16, 1}, {1401, 0xf, 16, 1},
+  {1401, 0xf, 16, 1}, {1401, 0xf, 16, 1}, {0, 0x0, 0, 0},
+  {618, 0x0, 0, 0}, {618, 0x0, 0, 0}, {618, 0x0, 0, 0},
+  {618, 0x0, 0, 0}, {618, 0x0, 0, 0}, {618, 0x0, 0, 0},
+  {618, 0x0, 0, 0}, {618, 0x0, 0, 0}, {618, 0x0, 0, 0},
+  {618, 0x0, 0, 0}, {618, 0x0, 0, 0}, {618, 0x0, 0, 0},
+  {618, 0x0, 0, 0}, {618, 0x0, 0, 0}, {618, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {1433, 0x1, 24, 1}, {1433, 0x1, 24, 1},
+  {1433, 0x1, 24, 1}, {1433, 0x1, 24, 1}, {1433, 0x1, 24, 1},
+  {1433, 0x1, 24, 1}, {1433, 0x1, 24, 1}, {1433, 0x1, 24, 1},
+  {1433, 0x1, 24, 1}, {1433, 0x1, 24, 1}, {1433, 0x1, 24, 1},
+  {1433, 0x1, 24, 1}, {1433, 0x1, 24, 1}, {1433, 0x1, 24, 1},
+  {1433, 0x1, 24, 1}, {0, 0x0, 0, 0}, {1435, 0x1, 21, 1},
+  {617, 0x0, 0, 0}, {617, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {1385, 0xf, 28, 1}, {1417, 0xf, 28, 1}, {619, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {1457, 0xf, 16, 1}, {1457, 0xf, 16, 1},
+  {1457, 0xf, 16, 1}, {1457, 0xf, 16, 1}, {1457, 0xf, 16, 1},
+  {1457, 0xf, 16, 1}, {1457, 0xf, 16, 1}, {1457, 0xf, 16, 1},
+  {1457, 0xf, 16, 1}, {1457, 0xf, 16, 1}, {1457, 0xf, 16, 1},
+  {1457, 0xf, 16, 1}, {1457, 0xf, 16, 1}, {1457, 0xf, 16, 1},
+  {1457, 0xf, 16, 1}, {0, 0x0, 0, 0}, {620, 0x0, 0, 0},
+  {620, 0x0, 0, 0}, {620, 0x0, 0, 0}, {620, 0x0, 0, 0},
+  {620, 0x0, 0, 0}, {620, 0x0, 0, 0}, {620, 0x0, 0, 0},
+  {620, 0x0, 0, 0}, {620, 0x0, 0, 0}, {620, 0x0, 0, 0},
+  {620, 0x0, 0, 0}, {620, 0x0, 0, 0}, {620, 0x0, 0, 0},
+  {620, 0x0, 0, 0}, {620, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {1441, 0xf, 28, 1}, {1417, 0xf, 28, 1}, {1491, 0xf, 16, 1},
+  {1491, 0xf, 16, 1}, {1491, 0xf, 16, 1}, {1491, 0xf, 16, 1},
+  {1491, 0xf, 16, 1}, {1491, 0xf, 16, 1}, {1491, 0xf, 16, 1},
+  {1491, 0xf, 16, 1}, {1491, 0xf, 16, 1}, {1491, 0xf, 16, 1},
+  {1491, 0xf, 16, 1}, {1491, 0xf, 16, 1}, {1491, 0xf, 16, 1},
+  {1491, 0xf, 16, 1}, {1491, 0xf, 16, 1}, {0, 0x0, 0, 0},
+  {621, 0x0, 0, 0}, {621, 0x0, 0, 0}, {621, 0x0, 0, 0},
+  {621, 0x0, 0, 0}, {621, 0x0, 0, 0}, {621, 0x0, 0, 0},
+  {621, 0x0, 0, 0}, {621, 0x0, 0, 0}, {621, 0x0, 0, 0},
+  {621, 0x0, 0, 0}, {621, 0x0, 0, 0}, {621, 0x0, 0, 0},
+  {621, 0x0, 0, 0}, {621, 0x0, 0, 0}, {621, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {1475, 0xf, 28, 1}, {1417, 0xf, 28, 1},
+  {1511, 0x1, 21, 1}, {1513, 0x1, 21, 1}, {1437, 0x8, 0, 2},
+  {1439, 0x1, 0, 2}, {1473, 0x8, 0, 2}, {1507, 0x8, 0, 2},
+  {1117, 0x3, 23, 1}, {1249, 0x1, 24, 1}, {1379, 0x1, 24, 1},
+  {1509, 0x1, 24, 1}, {1521, 0x1, 7, 1}, {1523, 0x1, 7, 1},
+  {973, 0x3, 23, 1}, {1043, 0x1, 24, 1}, {1081, 0x3, 23, 1},
+  {1515, 0x3, 5, 1}, {1527, 0x1, 4, 1}, {1529, 0x1, 4, 1},
+  {321, 0x3, 23, 1}, {685, 0x1, 22, 1}, {925, 0xf, 21, 1},
+  {1519, 0x1, 22, 1}, {622, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {1549, 0x3, 18, 1}, {1549, 0x3, 18, 1}, {1549, 0x3, 18, 1},
+  {1549, 0x3, 18, 1}, {1549, 0x3, 18, 1}, {1549, 0x3, 18, 1},
+  {1549, 0x3, 18, 1}, {1549, 0x3, 18, 1}, {1549, 0x3, 18, 1},
+  {1549, 0x3, 18, 1}, {1549, 0x3, 18, 1}, {1549, 0x3, 18, 1},
+  {1549, 0x3, 18, 1}, {1549, 0x3, 18, 1}, {1549, 0x3, 18, 1},
+  {0, 0x0, 0, 0}, {626, 0x0, 0, 0}, {626, 0x0, 0, 0},
+  {626, 0x0, 0, 0}, {1553, 0x1, 16, 1}, {626, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {623, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {625, 0x0, 0, 0}, {624, 0x0, 0, 0}, {1557, 0x9, 0, 2},
+  {0, 0x0, 0, 0}, {1555, 0x1, 0, 2}, {1559, 0x1, 0, 2},
+  {1533, 0xf, 28, 1}, {1561, 0x1, 17, 1}, {1531, 0x1, 0, 2},
+  {1563, 0xa, 0, 2}, {627, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {1585, 0xf, 16, 1}, {1585, 0xf, 16, 1}, {1585, 0xf, 16, 1},
+  {1585, 0xf, 16, 1}, {1585, 0xf, 16, 1}, {1585, 0xf, 16, 1},
+  {1585, 0xf, 16, 1}, {1585, 0xf, 16, 1}, {1585, 0xf, 16, 1},
+  {1585, 0xf, 16, 1}, {1585, 0xf, 16, 1}, {1585, 0xf, 16, 1},
+  {1585, 0xf, 16, 1}, {1585, 0xf, 16, 1}, {1585, 0xf, 16, 1},
+  {0, 0x0, 0, 0}, {629, 0x0, 0, 0}, {629, 0x0, 0, 0},
+  {629, 0x0, 0, 0}, {629, 0x0, 0, 0}, {629, 0x0, 0, 0},
+  {629, 0x0, 0, 0}, {629, 0x0, 0, 0}, {629, 0x0, 0, 0},
+  {629, 0x0, 0, 0}, {629, 0x0, 0, 0}, {629, 0x0, 0, 0},
+  {629, 0x0, 0, 0}, {629, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {629, 0x0, 0, 0}, {629, 0x0, 0, 0}, {628, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {1569, 0xf, 28, 1}, {1601, 0x1, 0, 2},
+  {1567, 0x1, 0, 2}, {1603, 0x2, 0, 2}, {630, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {631, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {1607, 0x1, 0, 2}, {1609, 0x1, 0, 2}, {632, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {633, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {1613, 0x1, 0, 2}, {1615, 0x1, 0, 2}, {1635, 0x3, 18, 1},
+  {1635, 0x3, 18, 1}, {1635, 0x3, 18, 1}, {1635, 0x3, 18, 1},
+  {1635, 0x3, 18, 1}, {1635, 0x3, 18, 1}, {1635, 0x3, 18, 1},
+  {1635, 0x3, 18, 1}, {1635, 0x3, 18, 1}, {1635, 0x3, 18, 1},
+  {1635, 0x3, 18, 1}, {1635, 0x3, 18, 1}, {1635, 0x3, 18, 1},
+  {1635, 0x3, 18, 1}, {1635, 0x3, 18, 1}, {0, 0x0, 0, 0},
+  {636, 0x0, 0, 0}, {636, 0x0, 0, 0}, {636, 0x0, 0, 0},
+  {1639, 0x1, 16, 1}, {636, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {634, 0x0, 0, 0}, {0, 0x0, 0, 0}, {635, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {1641, 0x1, 0, 2}, {1643, 0x1, 0, 2},
+  {1619, 0xf, 28, 1}, {1645, 0x1, 17, 1}, {637, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {1647, 0xa, 0, 2}, {1649, 0x1, 0, 2},
+  {1669, 0xf, 16, 1}, {1669, 0xf, 16, 1}, {1669, 0xf, 16, 1},
+  {1669, 0xf, 16, 1}, {1669, 0xf, 16, 1}, {1669, 0xf, 16, 1},
+  {1669, 0xf, 16, 1}, {1669, 0xf, 16, 1}, {1669, 0xf, 16, 1},
+  {1669, 0xf, 16, 1}, {1669, 0xf, 16, 1}, {1669, 0xf, 16, 1},
+  {1669, 0xf, 16, 1}, {1669, 0xf, 16, 1}, {1669, 0xf, 16, 1},
+  {0, 0x0, 0, 0}, {639, 0x0, 0, 0}, {639, 0x0, 0, 0},
+  {639, 0x0, 0, 0}, {639, 0x0, 0, 0}, {639, 0x0, 0, 0},
+  {639, 0x0, 0, 0}, {639, 0x0, 0, 0}, {639, 0x0, 0, 0},
+  {639, 0x0, 0, 0}, {639, 0x0, 0, 0}, {639, 0x0, 0, 0},
+  {639, 0x0, 0, 0}, {639, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {639, 0x0, 0, 0}, {639, 0x0, 0, 0}, {638, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {1653, 0xf, 28, 1}, {1685, 0x1, 0, 2},
+  {640, 0x0, 0, 0}, {0, 0x0, 0, 0}, {1687, 0x2, 0, 2},
+  {1689, 0x1, 0, 2}, {641, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {642, 0x0, 0, 0}, {0, 0x0, 0, 0}, {1693, 0x1, 0, 2},
+  {1695, 0x1, 0, 2}, {643, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {644, 0x0, 0, 0}, {0, 0x0, 0, 0}, {1699, 0x1, 0, 2},
+  {1701, 0x1, 0, 2}, {645, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {646, 0x0, 0, 0}, {0, 0x0, 0, 0}, {1705, 0x1, 0, 2},
+  {1707, 0x1, 0, 2}, {647, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {648, 0x0, 0, 0}, {0, 0x0, 0, 0}, {1711, 0x1, 0, 2},
+  {1713, 0x1, 0, 2}, {656, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {1717, 0xb, 0, 2}, {0, 0x0, 0, 0}, {649, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {650, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {651, 0x0, 0, 0}, {0, 0x0, 0, 0}, {652, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {653, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {654, 0x0, 0, 0}, {0, 0x0, 0, 0}, {1721, 0x1, 0, 2},
+  {1723, 0x1, 0, 2}, {1725, 0x1, 0, 2}, {1727, 0x1, 0, 2},
+  {1729, 0x1, 0, 2}, {1731, 0x1, 0, 2}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {655, 0x0, 0, 0}, {0, 0x0, 0, 0}, {1733, 0xf, 0, 1},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {1749, 0x1, 0, 2},
+  {1719, 0x1, 0, 2}, {1751, 0xf, 4, 1}, {657, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {658, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {1769, 0x1, 0, 2}, {1771, 0x1, 0, 2}, {659, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {660, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {1775, 0x1, 0, 2}, {1777, 0x1, 0, 2}, {661, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {662, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {1781, 0x1, 0, 2}, {1783, 0x1, 0, 2}, {663, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {664, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {1787, 0x1, 0, 2}, {1789, 0x1, 0, 2}, {665, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {666, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {1793, 0x1, 0, 2}, {1795, 0x1, 0, 2}, {1803, 0x3, 20, 1},
+  {1807, 0x3, 20, 1}, {1811, 0x3, 20, 1}, {1815, 0x3, 20, 1},
+  {1565, 0x1, 22, 1}, {1605, 0x1, 22, 1}, {1611, 0x1, 22, 1},
+  {1617, 0x1, 22, 1}, {1651, 0x1, 22, 1}, {1691, 0x1, 22, 1},
+  {1697, 0x1, 22, 1}, {1703, 0x1, 22, 1}, {1709, 0x1, 22, 1},
+  {1715, 0x1, 22, 1}, {1767, 0xb, 0, 2}, {1773, 0x1, 22, 1},
+  {1779, 0x1, 22, 1}, {1785, 0x1, 22, 1}, {1791, 0x1, 22, 1},
+  {1797, 0x1, 22, 1}, {667, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {668, 0x0, 0, 0}, {0, 0x0, 0, 0}, {669, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {671, 0x0, 0, 0}, {670, 0x0, 0, 0},
+  {1825, 0xc, 0, 2}, {0, 0x0, 0, 0}, {1831, 0x1, 21, 1},
+  {1833, 0x1, 21, 1}, {1819, 0x1, 0, 2}, {1821, 0x1, 0, 2},
+  {1823, 0x1, 0, 2}, {1827, 0x1, 0, 2}, {674, 0x0, 0, 0},
+  {673, 0x0, 0, 0}, {1853, 0xf, 16, 1}, {1853, 0xf, 16, 1},
+  {1853, 0xf, 16, 1}, {1853, 0xf, 16, 1}, {1853, 0xf, 16, 1},
+  {1853, 0xf, 16, 1}, {1853, 0xf, 16, 1}, {1853, 0xf, 16, 1},
+  {1853, 0xf, 16, 1}, {1853, 0xf, 16, 1}, {1853, 0xf, 16, 1},
+  {1853, 0xf, 16, 1}, {1853, 0xf, 16, 1}, {1853, 0xf, 16, 1},
+  {1853, 0xf, 16, 1}, {0, 0x0, 0, 0}, {1835, 0xd, 0, 2},
+  {1835, 0xd, 0, 2}, {1835, 0xd, 0, 2}, {1835, 0xd, 0, 2},
+  {1835, 0xd, 0, 2}, {1835, 0xd, 0, 2}, {1835, 0xd, 0, 2},
+  {1835, 0xd, 0, 2}, {1835, 0xd, 0, 2}, {1835, 0xd, 0, 2},
+  {1835, 0xd, 0, 2}, {1835, 0xd, 0, 2}, {1835, 0xd, 0, 2},
+  {1835, 0xd, 0, 2}, {1835, 0xd, 0, 2}, {0, 0x0, 0, 0},
+  {1885, 0x1, 24, 1}, {1885, 0x1, 24, 1}, {1885, 0x1, 24, 1},
+  {1885, 0x1, 24, 1}, {1885, 0x1, 24, 1}, {1885, 0x1, 24, 1},
+  {1885, 0x1, 24, 1}, {1885, 0x1, 24, 1}, {1885, 0x1, 24, 1},
+  {1885, 0x1, 24, 1}, {1885, 0x1, 24, 1}, {1885, 0x1, 24, 1},
+  {1885, 0x1, 24, 1}, {1885, 0x1, 24, 1}, {1885, 0x1, 24, 1},
+  {0, 0x0, 0, 0}, {1887, 0x1, 21, 1}, {672, 0x0, 0, 0},
+  {672, 0x0, 0, 0}, {0, 0x0, 0, 0}, {1837, 0xf, 28, 1},
+  {1869, 0xf, 28, 1}, {675, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {1909, 0xf, 16, 1}, {1909, 0xf, 16, 1}, {1909, 0xf, 16, 1},
+  {1909, 0xf, 16, 1}, {1909, 0xf, 16, 1}, {1909, 0xf, 16, 1},
+  {1909, 0xf, 16, 1}, {1909, 0xf, 16, 1}, {1909, 0xf, 16, 1},
+  {1909, 0xf, 16, 1}, {1909, 0xf, 16, 1}, {1909, 0xf, 16, 1},
+  {1909, 0xf, 16, 1}, {1909, 0xf, 16, 1}, {1909, 0xf, 16, 1},
+  {0, 0x0, 0, 0}, {676, 0x0, 0, 0}, {676, 0x0, 0, 0},
+  {676, 0x0, 0, 0}, {676, 0x0, 0, 0}, {676, 0x0, 0, 0},
+  {676, 0x0, 0, 0}, {676, 0x0, 0, 0}, {676, 0x0, 0, 0},
+  {676, 0x0, 0, 0}, {676, 0x0, 0, 0}, {676, 0x0, 0, 0},
+  {676, 0x0, 0, 0}, {676, 0x0, 0, 0}, {676, 0x0, 0, 0},
+  {676, 0x0, 0, 0}, {0, 0x0, 0, 0}, {1893, 0xf, 28, 1},
+  {1869, 0xf, 28, 1}, {1943, 0xf, 16, 1}, {1943, 0xf, 16, 1},
+  {1943, 0xf, 16, 1}, {1943, 0xf, 16, 1}, {1943, 0xf, 16, 1},
+  {1943, 0xf, 16, 1}, {1943, 0xf, 16, 1}, {1943, 0xf, 16, 1},
+  {1943, 0xf, 16, 1}, {1943, 0xf, 16, 1}, {1943, 0xf, 16, 1},
+  {1943, 0xf, 16, 1}, {1943, 0xf, 16, 1}, {1943, 0xf, 16, 1},
+  {1943, 0xf, 16, 1}, {0, 0x0, 0, 0}, {677, 0x0, 0, 0},
+  {677, 0x0, 0, 0}, {677, 0x0, 0, 0}, {677, 0x0, 0, 0},
+  {677, 0x0, 0, 0}, {677, 0x0, 0, 0}, {677, 0x0, 0, 0},
+  {677, 0x0, 0, 0}, {677, 0x0, 0, 0}, {677, 0x0, 0, 0},
+  {677, 0x0, 0, 0}, {677, 0x0, 0, 0}, {677, 0x0, 0, 0},
+  {677, 0x0, 0, 0}, {677, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {1927, 0xf, 28, 1}, {1869, 0xf, 28, 1}, {1963, 0x1, 21, 1},
+  {1965, 0x1, 21, 1}, {1889, 0x8, 0, 2}, {1891, 0x1, 0, 2},
+  {1925, 0x8, 0, 2}, {1959, 0x8, 0, 2}, {678, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {679, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {680, 0x0, 0, 0}, {0, 0x0, 0, 0}, {681, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {1977, 0x1, 21, 1}, {1979, 0x1, 21, 1},
+  {1967, 0x1, 0, 2}, {1969, 0x1, 0, 2}, {1971, 0x1, 0, 2},
+  {1973, 0x1, 0, 2}, {1997, 0xf, 16, 1}, {1997, 0xf, 16, 1},
+  {1997, 0xf, 16, 1}, {1997, 0xf, 16, 1}, {1997, 0xf, 16, 1},
+  {1997, 0xf, 16, 1}, {1997, 0xf, 16, 1}, {1997, 0xf, 16, 1},
+  {1997, 0xf, 16, 1}, {1997, 0xf, 16, 1}, {1997, 0xf, 16, 1},
+  {1997, 0xf, 16, 1}, {1997, 0xf, 16, 1}, {1997, 0xf, 16, 1},
+  {1997, 0xf, 16, 1}, {0, 0x0, 0, 0}, {683, 0x0, 0, 0},
+  {683, 0x0, 0, 0}, {683, 0x0, 0, 0}, {683, 0x0, 0, 0},
+  {683, 0x0, 0, 0}, {683, 0x0, 0, 0}, {683, 0x0, 0, 0},
+  {683, 0x0, 0, 0}, {683, 0x0, 0, 0}, {683, 0x0, 0, 0},
+  {683, 0x0, 0, 0}, {683, 0x0, 0, 0}, {683, 0x0, 0, 0},
+  {683, 0x0, 0, 0}, {683, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {2029, 0x1, 24, 1}, {2029, 0x1, 24, 1}, {2029, 0x1, 24, 1},
+  {2029, 0x1, 24, 1}, {2029, 0x1, 24, 1}, {2029, 0x1, 24, 1},
+  {2029, 0x1, 24, 1}, {2029, 0x1, 24, 1}, {2029, 0x1, 24, 1},
+  {2029, 0x1, 24, 1}, {2029, 0x1, 24, 1}, {2029, 0x1, 24, 1},
+  {2029, 0x1, 24, 1}, {2029, 0x1, 24, 1}, {2029, 0x1, 24, 1},
+  {0, 0x0, 0, 0}, {2031, 0x1, 21, 1}, {682, 0x0, 0, 0},
+  {682, 0x0, 0, 0}, {0, 0x0, 0, 0}, {1981, 0xf, 28, 1},
+  {2013, 0xf, 28, 1}, {684, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {2053, 0xf, 16, 1}, {2053, 0xf, 16, 1}, {2053, 0xf, 16, 1},
+  {2053, 0xf, 16, 1}, {2053, 0xf, 16, 1}, {2053, 0xf, 16, 1},
+  {2053, 0xf, 16, 1}, {2053, 0xf, 16, 1}, {2053, 0xf, 16, 1},
+  {2053, 0xf, 16, 1}, {2053, 0xf, 16, 1}, {2053, 0xf, 16, 1},
+  {2053, 0xf, 16, 1}, {2053, 0xf, 16, 1}, {2053, 0xf, 16, 1},
+  {0, 0x0, 0, 0}, {685, 0x0, 0, 0}, {685, 0x0, 0, 0},
+  {685, 0x0, 0, 0}, {685, 0x0, 0, 0}, {685, 0x0, 0, 0},
+  {685, 0x0, 0, 0}, {685, 0x0, 0, 0}, {685, 0x0, 0, 0},
+  {685, 0x0, 0, 0}, {685, 0x0, 0, 0}, {685, 0x0, 0, 0},
+  {685, 0x0, 0, 0}, {685, 0x0, 0, 0}, {685, 0x0, 0, 0},
+  {685, 0x0, 0, 0}, {0, 0x0, 0, 0}, {2037, 0xf, 28, 1},
+  {2013, 0xf, 28, 1}, {2087, 0xf, 16, 1}, {2087, 0xf, 16, 1},
+  {2087, 0xf, 16, 1}, {2087, 0xf, 16, 1}, {2087, 0xf, 16, 1},
+  {2087, 0xf, 16, 1}, {2087, 0xf, 16, 1}, {2087, 0xf, 16, 1},
+  {2087, 0xf, 16, 1}, {2087, 0xf, 16, 1}, {2087, 0xf, 16, 1},
+  {2087, 0xf, 16, 1}, {2087, 0xf, 16, 1}, {2087, 0xf, 16, 1},
+  {2087, 0xf, 16, 1}, {0, 0x0, 0, 0}, {686, 0x0, 0, 0},
+  {686, 0x0, 0, 0}, {686, 0x0, 0, 0}, {686, 0x0, 0, 0},
+  {686, 0x0, 0, 0}, {686, 0x0, 0, 0}, {686, 0x0, 0, 0},
+  {686, 0x0, 0, 0}, {686, 0x0, 0, 0}, {686, 0x0, 0, 0},
+  {686, 0x0, 0, 0}, {686, 0x0, 0, 0}, {686, 0x0, 0, 0},
+  {686, 0x0, 0, 0}, {686, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {2071, 0xf, 28, 1}, {2013, 0xf, 28, 1}, {2107, 0x1, 21, 1},
+  {2109, 0x1, 21, 1}, {2033, 0x8, 0, 2}, {2035, 0x1, 0, 2},
+  {2069, 0x8, 0, 2}, {2103, 0x8, 0, 2}, {2113, 0x1, 20, 1},
+  {2115, 0x1, 20, 1}, {1829, 0x1, 24, 1}, {1961, 0x1, 24, 1},
+  {1975, 0x1, 24, 1}, {2105, 0x1, 24, 1}, {687, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {688, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {2117, 0x1, 0, 2}, {2119, 0x1, 0, 2}, {689, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {690, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {2123, 0x1, 0, 2}, {2125, 0x1, 0, 2}, {691, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {2129, 0x1, 0, 2}, {0, 0x0, 0, 0},
+  {692, 0x0, 0, 0}, {0, 0x0, 0, 0}, {2133, 0x1, 0, 2},
+  {0, 0x0, 0, 0}, {693, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {694, 0x0, 0, 0}, {0, 0x0, 0, 0}, {2137, 0x1, 0, 2},
+  {2139, 0x1, 0, 2}, {695, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {696, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {2145, 0x1, 0, 2}, {697, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {2167, 0xf, 16, 1}, {2167, 0xf, 16, 1}, {2167, 0xf, 16, 1},
+  {2167, 0xf, 16, 1}, {2167, 0xf, 16, 1}, {2167, 0xf, 16, 1},
+  {2167, 0xf, 16, 1}, {2167, 0xf, 16, 1}, {2167, 0xf, 16, 1},
+  {2167, 0xf, 16, 1}, {2167, 0xf, 16, 1}, {2167, 0xf, 16, 1},
+  {2167, 0xf, 16, 1}, {2167, 0xf, 16, 1}, {2167, 0xf, 16, 1},
+  {0, 0x0, 0, 0}, {699, 0x0, 0, 0}, {699, 0x0, 0, 0},
+  {699, 0x0, 0, 0}, {699, 0x0, 0, 0}, {699, 0x0, 0, 0},
+  {699, 0x0, 0, 0}, {699, 0x0, 0, 0}, {699, 0x0, 0, 0},
+  {699, 0x0, 0, 0}, {699, 0x0, 0, 0}, {699, 0x0, 0, 0},
+  {699, 0x0, 0, 0}, {699, 0x0, 0, 0}, {699, 0x0, 0, 0},
+  {699, 0x0, 0, 0}, {0, 0x0, 0, 0}, {698, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {2151, 0xf, 28, 1}, {2183, 0x1, 0, 2},
+  {2185, 0x8, 0, 2}, {0, 0x0, 0, 0}, {2191, 0x1, 20, 1},
+  {2197, 0x1, 20, 1}, {0, 0x0, 0, 0}, {2193, 0x3, 5, 1},
+  {2127, 0x1, 7, 1}, {2131, 0x1, 7, 1}, {2135, 0x1, 7, 1},
+  {2141, 0x1, 7, 1}, {2199, 0x3, 5, 1}, {0, 0x0, 0, 0},
+  {2143, 0x1, 0, 2}, {2147, 0x1, 7, 1}, {2149, 0x1, 0, 2},
+  {2187, 0x1, 7, 1}, {700, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {701, 0x0, 0, 0}, {0, 0x0, 0, 0}, {2203, 0x1, 0, 2},
+  {2205, 0x1, 0, 2}, {702, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {703, 0x0, 0, 0}, {0, 0x0, 0, 0}, {704, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {705, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {2219, 0x1, 7, 1}, {2221, 0x1, 7, 1}, {2209, 0x1, 0, 2},
+  {2211, 0x1, 0, 2}, {2213, 0x1, 0, 2}, {2215, 0x1, 0, 2},
+  {706, 0x0, 0, 0}, {0, 0x0, 0, 0}, {707, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {2229, 0x1, 7, 1}, {2231, 0x1, 7, 1},
+  {2223, 0x1, 0, 2}, {0, 0x0, 0, 0}, {2225, 0x1, 0, 2},
+  {0, 0x0, 0, 0}, {708, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {709, 0x0, 0, 0}, {0, 0x0, 0, 0}, {2239, 0x1, 7, 1},
+  {2241, 0x1, 7, 1}, {2233, 0x1, 0, 2}, {0, 0x0, 0, 0},
+  {2235, 0x1, 0, 2}, {0, 0x0, 0, 0}, {710, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {711, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {712, 0x0, 0, 0}, {0, 0x0, 0, 0}, {713, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {2253, 0x1, 7, 1}, {2255, 0x1, 7, 1},
+  {2243, 0x1, 0, 2}, {2245, 0x1, 0, 2}, {2247, 0x1, 0, 2},
+  {2249, 0x1, 0, 2}, {714, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {715, 0x0, 0, 0}, {0, 0x0, 0, 0}, {716, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {717, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {2267, 0x1, 7, 1}, {2269, 0x1, 7, 1}, {2259, 0x1, 0, 2},
+  {0, 0x0, 0, 0}, {2261, 0x1, 0, 2}, {2263, 0x1, 0, 2},
+  {718, 0x0, 0, 0}, {0, 0x0, 0, 0}, {2289, 0xf, 16, 1},
+  {2289, 0xf, 16, 1}, {2289, 0xf, 16, 1}, {2289, 0xf, 16, 1},
+  {2289, 0xf, 16, 1}, {2289, 0xf, 16, 1}, {2289, 0xf, 16, 1},
+  {2289, 0xf, 16, 1}, {2289, 0xf, 16, 1}, {2289, 0xf, 16, 1},
+  {2289, 0xf, 16, 1}, {2289, 0xf, 16, 1}, {2289, 0xf, 16, 1},
+  {2289, 0xf, 16, 1}, {2289, 0xf, 16, 1}, {0, 0x0, 0, 0},
+  {720, 0x0, 0, 0}, {720, 0x0, 0, 0}, {720, 0x0, 0, 0},
+  {720, 0x0, 0, 0}, {720, 0x0, 0, 0}, {720, 0x0, 0, 0},
+  {720, 0x0, 0, 0}, {720, 0x0, 0, 0}, {720, 0x0, 0, 0},
+  {720, 0x0, 0, 0}, {720, 0x0, 0, 0}, {720, 0x0, 0, 0},
+  {720, 0x0, 0, 0}, {720, 0x0, 0, 0}, {720, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {719, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {2273, 0xf, 28, 1}, {2305, 0x1, 0, 2}, {2325, 0xf, 16, 1},
+  {2325, 0xf, 16, 1}, {2325, 0xf, 16, 1}, {2325, 0xf, 16, 1},
+  {2325, 0xf, 16, 1}, {2325, 0xf, 16, 1}, {2325, 0xf, 16, 1},
+  {2325, 0xf, 16, 1}, {2325, 0xf, 16, 1}, {2325, 0xf, 16, 1},
+  {2325, 0xf, 16, 1}, {2325, 0xf, 16, 1}, {2325, 0xf, 16, 1},
+  {2325, 0xf, 16, 1}, {2325, 0xf, 16, 1}, {0, 0x0, 0, 0},
+  {722, 0x0, 0, 0}, {722, 0x0, 0, 0}, {722, 0x0, 0, 0},
+  {722, 0x0, 0, 0}, {722, 0x0, 0, 0}, {722, 0x0, 0, 0},
+  {722, 0x0, 0, 0}, {722, 0x0, 0, 0}, {722, 0x0, 0, 0},
+  {722, 0x0, 0, 0}, {722, 0x0, 0, 0}, {722, 0x0, 0, 0},
+  {722, 0x0, 0, 0}, {722, 0x0, 0, 0}, {722, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {721, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {2309, 0xf, 28, 1}, {2341, 0x1, 0, 2}, {2347, 0x1, 7, 1},
+  {2349, 0x1, 7, 1}, {2307, 0x8, 0, 2}, {0, 0x0, 0, 0},
+  {2343, 0x8, 0, 2}, {0, 0x0, 0, 0}, {2353, 0x3, 5, 1},
+  {2357, 0x3, 5, 1}, {2217, 0x1, 20, 1}, {2227, 0x1, 20, 1},
+  {2237, 0x1, 20, 1}, {2251, 0x1, 20, 1}, {2257, 0x1, 0, 2},
+  {2265, 0x1, 20, 1}, {2271, 0x1, 0, 2}, {2345, 0x1, 20, 1},
+  {723, 0x0, 0, 0}, {0, 0x0, 0, 0}, {724, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {2361, 0x1, 0, 2}, {2363, 0x1, 0, 2},
+  {725, 0x0, 0, 0}, {0, 0x0, 0, 0}, {726, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {727, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {728, 0x0, 0, 0}, {0, 0x0, 0, 0}, {729, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {730, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {2395, 0xf, 16, 1}, {2395, 0xf, 16, 1}, {2395, 0xf, 16, 1},
+  {2395, 0xf, 16, 1}, {2395, 0xf, 16, 1}, {2395, 0xf, 16, 1},
+  {2395, 0xf, 16, 1}, {2395, 0xf, 16, 1}, {2395, 0xf, 16, 1},
+  {2395, 0xf, 16, 1}, {2395, 0xf, 16, 1}, {2395, 0xf, 16, 1},
+  {2395, 0xf, 16, 1}, {2395, 0xf, 16, 1}, {2395, 0xf, 16, 1},
+  {0, 0x0, 0, 0}, {732, 0x0, 0, 0}, {732, 0x0, 0, 0},
+  {732, 0x0, 0, 0}, {732, 0x0, 0, 0}, {732, 0x0, 0, 0},
+  {732, 0x0, 0, 0}, {732, 0x0, 0, 0}, {732, 0x0, 0, 0},
+  {732, 0x0, 0, 0}, {732, 0x0, 0, 0}, {732, 0x0, 0, 0},
+  {732, 0x0, 0, 0}, {732, 0x0, 0, 0}, {732, 0x0, 0, 0},
+  {732, 0x0, 0, 0}, {0, 0x0, 0, 0}, {731, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {2379, 0xf, 28, 1}, {2411, 0x1, 0, 2},
+  {2417, 0x1, 20, 1}, {2427, 0x1, 20, 1}, {0, 0x0, 0, 0},
+  {2419, 0x7, 5, 1}, {2367, 0x1, 0, 2}, {2369, 0x1, 0, 2},
+  {2371, 0x1, 0, 2}, {2373, 0x1, 0, 2}, {2375, 0x1, 0, 2},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {2377, 0x1, 0, 2},
+  {2429, 0x7, 5, 1}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {2413, 0x8, 0, 2},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {733, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {734, 0x0, 0, 0}, {0, 0x0, 0, 0}, {2437, 0x1, 0, 2},
+  {2439, 0x1, 0, 2}, {735, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {736, 0x0, 0, 0}, {0, 0x0, 0, 0}, {737, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {738, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {2453, 0x1, 7, 1}, {2455, 0x1, 7, 1}, {2443, 0x1, 0, 2},
+  {2445, 0x1, 0, 2}, {2447, 0x1, 0, 2}, {2449, 0x1, 0, 2},
+  {739, 0x0, 0, 0}, {0, 0x0, 0, 0}, {740, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {2463, 0x1, 7, 1}, {2465, 0x1, 7, 1},
+  {2457, 0x1, 0, 2}, {0, 0x0, 0, 0}, {2459, 0x1, 0, 2},
+  {0, 0x0, 0, 0}, {741, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {742, 0x0, 0, 0}, {0, 0x0, 0, 0}, {2473, 0x1, 7, 1},
+  {2475, 0x1, 7, 1}, {2467, 0x1, 0, 2}, {0, 0x0, 0, 0},
+  {2469, 0x1, 0, 2}, {0, 0x0, 0, 0}, {743, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {744, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {745, 0x0, 0, 0}, {0, 0x0, 0, 0}, {746, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {2487, 0x1, 7, 1}, {2489, 0x1, 7, 1},
+  {2477, 0x1, 0, 2}, {2479, 0x1, 0, 2}, {2481, 0x1, 0, 2},
+  {2483, 0x1, 0, 2}, {747, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {748, 0x0, 0, 0}, {0, 0x0, 0, 0}, {749, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {750, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {2501, 0x1, 7, 1}, {2503, 0x1, 7, 1}, {2493, 0x1, 0, 2},
+  {0, 0x0, 0, 0}, {2495, 0x1, 0, 2}, {2497, 0x1, 0, 2},
+  {751, 0x0, 0, 0}, {0, 0x0, 0, 0}, {2523, 0xf, 16, 1},
+  {2523, 0xf, 16, 1}, {2523, 0xf, 16, 1}, {2523, 0xf, 16, 1},
+  {2523, 0xf, 16, 1}, {2523, 0xf, 16, 1}, {2523, 0xf, 16, 1},
+  {2523, 0xf, 16, 1}, {2523, 0xf, 16, 1}, {2523, 0xf, 16, 1},
+  {2523, 0xf, 16, 1}, {2523, 0xf, 16, 1}, {2523, 0xf, 16, 1},
+  {2523, 0xf, 16, 1}, {2523, 0xf, 16, 1}, {0, 0x0, 0, 0},
+  {753, 0x0, 0, 0}, {753, 0x0, 0, 0}, {753, 0x0, 0, 0},
+  {753, 0x0, 0, 0}, {753, 0x0, 0, 0}, {753, 0x0, 0, 0},
+  {753, 0x0, 0, 0}, {753, 0x0, 0, 0}, {753, 0x0, 0, 0},
+  {753, 0x0, 0, 0}, {753, 0x0, 0, 0}, {753, 0x0, 0, 0},
+  {753, 0x0, 0, 0}, {753, 0x0, 0, 0}, {753, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {752, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {2507, 0xf, 28, 1}, {2539, 0x1, 0, 2}, {2559, 0xf, 16, 1},
+  {2559, 0xf, 16, 1}, {2559, 0xf, 16, 1}, {2559, 0xf, 16, 1},
+  {2559, 0xf, 16, 1}, {2559, 0xf, 16, 1}, {2559, 0xf, 16, 1},
+  {2559, 0xf, 16, 1}, {2559, 0xf, 16, 1}, {2559, 0xf, 16, 1},
+  {2559, 0xf, 16, 1}, {2559, 0xf, 16, 1}, {2559, 0xf, 16, 1},
+  {2559, 0xf, 16, 1}, {2559, 0xf, 16, 1}, {0, 0x0, 0, 0},
+  {755, 0x0, 0, 0}, {755, 0x0, 0, 0}, {755, 0x0, 0, 0},
+  {755, 0x0, 0, 0}, {755, 0x0, 0, 0}, {755, 0x0, 0, 0},
+  {755, 0x0, 0, 0}, {755, 0x0, 0, 0}, {755, 0x0, 0, 0},
+  {755, 0x0, 0, 0}, {755, 0x0, 0, 0}, {755, 0x0, 0, 0},
+  {755, 0x0, 0, 0}, {755, 0x0, 0, 0}, {755, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {754, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {2543, 0xf, 28, 1}, {2575, 0x1, 0, 2}, {2581, 0x1, 7, 1},
+  {2583, 0x1, 7, 1}, {2541, 0x8, 0, 2}, {0, 0x0, 0, 0},
+  {2577, 0x8, 0, 2}, {0, 0x0, 0, 0}, {2587, 0x3, 5, 1},
+  {2591, 0x3, 5, 1}, {2451, 0x1, 20, 1}, {2461, 0x1, 20, 1},
+  {2471, 0x1, 20, 1}, {2485, 0x1, 20, 1}, {2491, 0x1, 0, 2},
+  {2499, 0x1, 20, 1}, {2505, 0x1, 0, 2}, {2579, 0x1, 20, 1},
+  {756, 0x0, 0, 0}, {0, 0x0, 0, 0}, {757, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {2595, 0x1, 0, 2}, {2597, 0x1, 0, 2},
+  {2617, 0xf, 12, 1}, {2617, 0xf, 12, 1}, {2617, 0xf, 12, 1},
+  {2617, 0xf, 12, 1}, {2617, 0xf, 12, 1}, {2617, 0xf, 12, 1},
+  {2617, 0xf, 12, 1}, {2617, 0xf, 12, 1}, {2617, 0xf, 12, 1},
+  {2617, 0xf, 12, 1}, {2617, 0xf, 12, 1}, {2617, 0xf, 12, 1},
+  {2617, 0xf, 12, 1}, {2617, 0xf, 12, 1}, {2617, 0xf, 12, 1},
+  {0, 0x0, 0, 0}, {759, 0x0, 0, 0}, {759, 0x0, 0, 0},
+  {759, 0x0, 0, 0}, {759, 0x0, 0, 0}, {759, 0x0, 0, 0},
+  {759, 0x0, 0, 0}, {759, 0x0, 0, 0}, {759, 0x0, 0, 0},
+  {759, 0x0, 0, 0}, {759, 0x0, 0, 0}, {759, 0x0, 0, 0},
+  {759, 0x0, 0, 0}, {759, 0x0, 0, 0}, {759, 0x0, 0, 0},
+  {759, 0x0, 0, 0}, {0, 0x0, 0, 0}, {758, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {2601, 0xf, 28, 1}, {2633, 0x1, 0, 2},
+  {2653, 0xf, 12, 1}, {2653, 0xf, 12, 1}, {2653, 0xf, 12, 1},
+  {2653, 0xf, 12, 1}, {2653, 0xf, 12, 1}, {2653, 0xf, 12, 1},
+  {2653, 0xf, 12, 1}, {2653, 0xf, 12, 1}, {2653, 0xf, 12, 1},
+  {2653, 0xf, 12, 1}, {2653, 0xf, 12, 1}, {2653, 0xf, 12, 1},
+  {2653, 0xf, 12, 1}, {2653, 0xf, 12, 1}, {2653, 0xf, 12, 1},
+  {0, 0x0, 0, 0}, {761, 0x0, 0, 0}, {761, 0x0, 0, 0},
+  {761, 0x0, 0, 0}, {761, 0x0, 0, 0}, {761, 0x0, 0, 0},
+  {761, 0x0, 0, 0}, {761, 0x0, 0, 0}, {761, 0x0, 0, 0},
+  {761, 0x0, 0, 0}, {761, 0x0, 0, 0}, {761, 0x0, 0, 0},
+  {761, 0x0, 0, 0}, {761, 0x0, 0, 0}, {761, 0x0, 0, 0},
+  {761, 0x0, 0, 0}, {0, 0x0, 0, 0}, {760, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {2637, 0xf, 28, 1}, {2669, 0x1, 0, 2},
+  {2689, 0xf, 12, 1}, {2689, 0xf, 12, 1}, {2689, 0xf, 12, 1},
+  {2689, 0xf, 12, 1}, {2689, 0xf, 12, 1}, {2689, 0xf, 12, 1},
+  {2689, 0xf, 12, 1}, {2689, 0xf, 12, 1}, {2689, 0xf, 12, 1},
+  {2689, 0xf, 12, 1}, {2689, 0xf, 12, 1}, {2689, 0xf, 12, 1},
+  {2689, 0xf, 12, 1}, {2689, 0xf, 12, 1}, {2689, 0xf, 12, 1},
+  {0, 0x0, 0, 0}, {763, 0x0, 0, 0}, {763, 0x0, 0, 0},
+  {763, 0x0, 0, 0}, {763, 0x0, 0, 0}, {763, 0x0, 0, 0},
+  {763, 0x0, 0, 0}, {763, 0x0, 0, 0}, {763, 0x0, 0, 0},
+  {763, 0x0, 0, 0}, {763, 0x0, 0, 0}, {763, 0x0, 0, 0},
+  {763, 0x0, 0, 0}, {763, 0x0, 0, 0}, {763, 0x0, 0, 0},
+  {763, 0x0, 0, 0}, {0, 0x0, 0, 0}, {762, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {2673, 0xf, 28, 1}, {2705, 0x1, 0, 2},
+  {2725, 0xf, 12, 1}, {2725, 0xf, 12, 1}, {2725, 0xf, 12, 1},
+  {2725, 0xf, 12, 1}, {2725, 0xf, 12, 1}, {2725, 0xf, 12, 1},
+  {2725, 0xf, 12, 1}, {2725, 0xf, 12, 1}, {2725, 0xf, 12, 1},
+  {2725, 0xf, 12, 1}, {2725, 0xf, 12, 1}, {2725, 0xf, 12, 1},
+  {2725, 0xf, 12, 1}, {2725, 0xf, 12, 1}, {2725, 0xf, 12, 1},
+  {0, 0x0, 0, 0}, {765, 0x0, 0, 0}, {765, 0x0, 0, 0},
+  {765, 0x0, 0, 0}, {765, 0x0, 0, 0}, {765, 0x0, 0, 0},
+  {765, 0x0, 0, 0}, {765, 0x0, 0, 0}, {765, 0x0, 0, 0},
+  {765, 0x0, 0, 0}, {765, 0x0, 0, 0}, {765, 0x0, 0, 0},
+  {765, 0x0, 0, 0}, {765, 0x0, 0, 0}, {765, 0x0, 0, 0},
+  {765, 0x0, 0, 0}, {0, 0x0, 0, 0}, {764, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {2709, 0xf, 28, 1}, {2741, 0x1, 0, 2},
+  {766, 0x0, 0, 0}, {0, 0x0, 0, 0}, {2763, 0xf, 12, 1},
+  {2763, 0xf, 12, 1}, {2763, 0xf, 12, 1}, {2763, 0xf, 12, 1},
+  {2763, 0xf, 12, 1}, {2763, 0xf, 12, 1}, {2763, 0xf, 12, 1},
+  {2763, 0xf, 12, 1}, {2763, 0xf, 12, 1}, {2763, 0xf, 12, 1},
+  {2763, 0xf, 12, 1}, {2763, 0xf, 12, 1}, {2763, 0xf, 12, 1},
+  {2763, 0xf, 12, 1}, {2763, 0xf, 12, 1}, {0, 0x0, 0, 0},
+  {768, 0x0, 0, 0}, {768, 0x0, 0, 0}, {768, 0x0, 0, 0},
+  {768, 0x0, 0, 0}, {768, 0x0, 0, 0}, {768, 0x0, 0, 0},
+  {768, 0x0, 0, 0}, {768, 0x0, 0, 0}, {768, 0x0, 0, 0},
+  {768, 0x0, 0, 0}, {768, 0x0, 0, 0}, {768, 0x0, 0, 0},
+  {768, 0x0, 0, 0}, {768, 0x0, 0, 0}, {768, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {767, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {2747, 0xf, 28, 1}, {2779, 0x1, 0, 2}, {2785, 0x1, 20, 1},
+  {2803, 0x1, 20, 1}, {2787, 0x7, 5, 1}, {2795, 0x7, 5, 1},
+  {2635, 0xe, 0, 2}, {2671, 0xe, 0, 2}, {2707, 0xe, 0, 2},
+  {2743, 0xe, 0, 2}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {2745, 0x1, 0, 2},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {2805, 0x7, 5, 1}, {0, 0x0, 0, 0},
+  {2781, 0xe, 0, 2}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {769, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {770, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {2813, 0x1, 0, 2}, {2815, 0x1, 0, 2}, {771, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {2819, 0x1, 0, 2},
+  {772, 0x0, 0, 0}, {0, 0x0, 0, 0}, {2827, 0x3, 5, 1},
+  {2831, 0x3, 5, 1}, {2821, 0xf, 0, 2}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {2823, 0x1, 0, 2}, {0, 0x0, 0, 0},
+  {773, 0x0, 0, 0}, {0, 0x0, 0, 0}, {774, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {2835, 0x1, 0, 2}, {2837, 0x1, 0, 2},
+  {775, 0x0, 0, 0}, {0, 0x0, 0, 0}, {2859, 0xf, 12, 1},
+  {2859, 0xf, 12, 1}, {2859, 0xf, 12, 1}, {2859, 0xf, 12, 1},
+  {2859, 0xf, 12, 1}, {2859, 0xf, 12, 1}, {2859, 0xf, 12, 1},
+  {2859, 0xf, 12, 1}, {2859, 0xf, 12, 1}, {2859, 0xf, 12, 1},
+  {2859, 0xf, 12, 1}, {2859, 0xf, 12, 1}, {2859, 0xf, 12, 1},
+  {2859, 0xf, 12, 1}, {2859, 0xf, 12, 1}, {0, 0x0, 0, 0},
+  {777, 0x0, 0, 0}, {777, 0x0, 0, 0}, {777, 0x0, 0, 0},
+  {777, 0x0, 0, 0}, {777, 0x0, 0, 0}, {777, 0x0, 0, 0},
+  {777, 0x0, 0, 0}, {777, 0x0, 0, 0}, {777, 0x0, 0, 0},
+  {777, 0x0, 0, 0}, {777, 0x0, 0, 0}, {777, 0x0, 0, 0},
+  {777, 0x0, 0, 0}, {777, 0x0, 0, 0}, {777, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {776, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {2843, 0xf, 28, 1}, {2875, 0x1, 0, 2}, {2881, 0x1, 7, 1},
+  {2883, 0x1, 7, 1}, {2841, 0x1, 0, 2}, {0, 0x0, 0, 0},
+  {2877, 0xe, 0, 2}, {0, 0x0, 0, 0}, {778, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {2903, 0xf, 12, 1}, {2903, 0xf, 12, 1},
+  {2903, 0xf, 12, 1}, {2903, 0xf, 12, 1}, {2903, 0xf, 12, 1},
+  {2903, 0xf, 12, 1}, {2903, 0xf, 12, 1}, {2903, 0xf, 12, 1},
+  {2903, 0xf, 12, 1}, {2903, 0xf, 12, 1}, {2903, 0xf, 12, 1},
+  {2903, 0xf, 12, 1}, {2903, 0xf, 12, 1}, {2903, 0xf, 12, 1},
+  {2903, 0xf, 12, 1}, {0, 0x0, 0, 0}, {780, 0x0, 0, 0},
+  {780, 0x0, 0, 0}, {780, 0x0, 0, 0}, {780, 0x0, 0, 0},
+  {780, 0x0, 0, 0}, {780, 0x0, 0, 0}, {780, 0x0, 0, 0},
+  {780, 0x0, 0, 0}, {780, 0x0, 0, 0}, {780, 0x0, 0, 0},
+  {780, 0x0, 0, 0}, {780, 0x0, 0, 0}, {780, 0x0, 0, 0},
+  {780, 0x0, 0, 0}, {780, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {779, 0x0, 0, 0}, {0, 0x0, 0, 0}, {2887, 0xf, 28, 1},
+  {2919, 0x1, 0, 2}, {2925, 0x1, 7, 1}, {2927, 0x1, 7, 1},
+  {2885, 0x1, 0, 2}, {0, 0x0, 0, 0}, {2921, 0xe, 0, 2},
+  {0, 0x0, 0, 0}, {781, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {782, 0x0, 0, 0}, {0, 0x0, 0, 0}, {2935, 0x1, 7, 1},
+  {2937, 0x1, 7, 1}, {2929, 0x1, 0, 2}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {2931, 0x1, 0, 2}, {783, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {784, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {2945, 0x1, 7, 1}, {2947, 0x1, 7, 1}, {2939, 0x1, 0, 2},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {2941, 0x1, 0, 2},
+  {2965, 0xf, 0, 1}, {2965, 0xf, 0, 1}, {2965, 0xf, 0, 1},
+  {2965, 0xf, 0, 1}, {2965, 0xf, 0, 1}, {2965, 0xf, 0, 1},
+  {2965, 0xf, 0, 1}, {2965, 0xf, 0, 1}, {2965, 0xf, 0, 1},
+  {2965, 0xf, 0, 1}, {2965, 0xf, 0, 1}, {2965, 0xf, 0, 1},
+  {2965, 0xf, 0, 1}, {2965, 0xf, 0, 1}, {2965, 0xf, 0, 1},
+  {0, 0x0, 0, 0}, {786, 0x0, 0, 0}, {786, 0x0, 0, 0},
+  {786, 0x0, 0, 0}, {786, 0x0, 0, 0}, {786, 0x0, 0, 0},
+  {786, 0x0, 0, 0}, {786, 0x0, 0, 0}, {786, 0x0, 0, 0},
+  {786, 0x0, 0, 0}, {786, 0x0, 0, 0}, {786, 0x0, 0, 0},
+  {786, 0x0, 0, 0}, {786, 0x0, 0, 0}, {786, 0x0, 0, 0},
+  {786, 0x0, 0, 0}, {0, 0x0, 0, 0}, {785, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {2949, 0xf, 28, 1}, {2981, 0x1, 0, 2},
+  {2987, 0x3, 5, 1}, {2991, 0x3, 5, 1}, {2879, 0x1, 20, 1},
+  {2923, 0x1, 20, 1}, {2933, 0x1, 20, 1}, {2943, 0x1, 20, 1},
+  {2983, 0x10, 0, 2}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {787, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {788, 0x0, 0, 0}, {0, 0x0, 0, 0}, {2995, 0x1, 0, 2},
+  {2997, 0x1, 0, 2}, {789, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {790, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {3007, 0x3, 5, 1}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {3001, 0x1, 0, 2}, {3003, 0x11, 0, 2}, {3013, 0x3, 21, 1},
+  {3025, 0x3, 21, 1}, {3017, 0x1, 4, 1}, {3019, 0x1, 4, 1},
+  {3021, 0x1, 4, 1}, {3023, 0x1, 4, 1}, {2121, 0x1, 20, 1},
+  {2189, 0x1, 23, 1}, {2207, 0x1, 20, 1}, {2351, 0x1, 23, 1},
+  {2365, 0x1, 20, 1}, {2415, 0x1, 23, 1}, {2441, 0x1, 20, 1},
+  {2585, 0x1, 23, 1}, {3029, 0x1, 4, 1}, {3031, 0x1, 4, 1},
+  {3033, 0x1, 4, 1}, {3035, 0x1, 4, 1}, {2599, 0x1, 20, 1},
+  {2783, 0x1, 23, 1}, {2817, 0x1, 20, 1}, {2825, 0x1, 23, 1},
+  {2839, 0x1, 20, 1}, {2985, 0x1, 23, 1}, {2999, 0x1, 20, 1},
+  {3005, 0x1, 23, 1}, {791, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {792, 0x0, 0, 0}, {0, 0x0, 0, 0}, {793, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {794, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {3037, 0x1, 0, 2}, {3039, 0x1, 0, 2}, {3041, 0x1, 0, 2},
+  {3043, 0x1, 0, 2}, {795, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {796, 0x0, 0, 0}, {0, 0x0, 0, 0}, {797, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {798, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {3049, 0x1, 0, 2}, {3051, 0x1, 0, 2}, {3053, 0x1, 0, 2},
+  {3055, 0x1, 0, 2}, {799, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {800, 0x0, 0, 0}, {0, 0x0, 0, 0}, {801, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {3063, 0x1, 0, 2}, {3065, 0x1, 0, 2},
+  {3071, 0x1, 20, 1}, {3073, 0x1, 20, 1}, {3045, 0x3, 23, 1},
+  {3057, 0x3, 23, 1}, {3061, 0x1, 0, 2}, {3067, 0x1, 15, 1},
+  {802, 0x0, 0, 0}, {0, 0x0, 0, 0}, {803, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {3075, 0x1, 0, 2}, {3077, 0x1, 0, 2},
+  {804, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {3081, 0x1, 0, 2}, {805, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {3085, 0x1, 0, 2}, {806, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {807, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {808, 0x0, 0, 0}, {0, 0x0, 0, 0}, {3091, 0x1, 0, 2},
+  {3093, 0x1, 0, 2}, {3099, 0x1, 8, 1}, {3101, 0x1, 8, 1},
+  {3083, 0x12, 0, 2}, {3087, 0x12, 0, 2}, {3089, 0x1, 0, 2},
+  {3095, 0x1, 0, 1}, {809, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {3103, 0x1, 0, 2}, {0, 0x0, 0, 0},
+  {3103, 0x1, 0, 2}, {810, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {3109, 0x1, 0, 2}, {0, 0x0, 0, 0}, {3105, 0x13, 0, 2},
+  {3107, 0x14, 0, 2}, {3111, 0x1, 23, 1}, {0, 0x0, 0, 0},
+  {811, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {3117, 0x1, 0, 2}, {812, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {3121, 0x1, 0, 2}, {814, 0x0, 0, 0},
+  {813, 0x0, 0, 0}, {813, 0x0, 0, 0}, {3125, 0x1, 0, 2},
+  {813, 0x0, 0, 0}, {3127, 0x2, 0, 2}, {3129, 0x1, 21, 1},
+  {0, 0x0, 0, 0}, {816, 0x0, 0, 0}, {815, 0x0, 0, 0},
+  {815, 0x0, 0, 0}, {3133, 0x1, 0, 2}, {815, 0x0, 0, 0},
+  {3135, 0x2, 0, 2}, {3137, 0x1, 21, 1}, {0, 0x0, 0, 0},
+  {817, 0x0, 0, 0}, {0, 0x0, 0, 0}, {3139, 0x1, 0, 2},
+  {3141, 0x1, 0, 2}, {3147, 0x1, 8, 1}, {3149, 0x1, 8, 1},
+  {3119, 0x12, 0, 2}, {3123, 0x12, 0, 2}, {3131, 0x1, 0, 2},
+  {3143, 0x1, 0, 1}, {3167, 0xf, 16, 1}, {3167, 0xf, 16, 1},
+  {3167, 0xf, 16, 1}, {3167, 0xf, 16, 1}, {3167, 0xf, 16, 1},
+  {3167, 0xf, 16, 1}, {3167, 0xf, 16, 1}, {3167, 0xf, 16, 1},
+  {3167, 0xf, 16, 1}, {3167, 0xf, 16, 1}, {3167, 0xf, 16, 1},
+  {3167, 0xf, 16, 1}, {3167, 0xf, 16, 1}, {3167, 0xf, 16, 1},
+  {3167, 0xf, 16, 1}, {0, 0x0, 0, 0}, {819, 0x0, 0, 0},
+  {819, 0x0, 0, 0}, {819, 0x0, 0, 0}, {819, 0x0, 0, 0},
+  {819, 0x0, 0, 0}, {819, 0x0, 0, 0}, {819, 0x0, 0, 0},
+  {819, 0x0, 0, 0}, {819, 0x0, 0, 0}, {819, 0x0, 0, 0},
+  {819, 0x0, 0, 0}, {819, 0x0, 0, 0}, {819, 0x0, 0, 0},
+  {819, 0x0, 0, 0}, {819, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {818, 0x0, 0, 0}, {0, 0x0, 0, 0}, {3151, 0xf, 28, 1},
+  {3183, 0x1, 0, 2}, {0, 0x0, 0, 0}, {3185, 0x8, 0, 2},
+  {0, 0x0, 0, 0}, {3151, 0xf, 28, 1}, {820, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {3191, 0x1, 0, 2}, {0, 0x0, 0, 0},
+  {3187, 0x13, 0, 2}, {3189, 0x14, 0, 2}, {3193, 0x1, 23, 1},
+  {0, 0x0, 0, 0}, {821, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {822, 0x0, 0, 0}, {0, 0x0, 0, 0}, {824, 0x0, 0, 0},
+  {823, 0x0, 0, 0}, {823, 0x0, 0, 0}, {3203, 0x1, 0, 2},
+  {3205, 0x2, 0, 2}, {0, 0x0, 0, 0}, {3207, 0x1, 0, 2},
+  {0, 0x0, 0, 0}, {826, 0x0, 0, 0}, {825, 0x0, 0, 0},
+  {825, 0x0, 0, 0}, {3211, 0x1, 0, 2}, {3213, 0x2, 0, 2},
+  {0, 0x0, 0, 0}, {827, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {3221, 0x1, 0, 1}, {0, 0x0, 0, 0}, {3215, 0x1, 0, 2},
+  {3217, 0x1, 0, 2}, {3225, 0x1, 8, 1}, {3227, 0x1, 8, 1},
+  {3199, 0x1, 0, 2}, {3201, 0x1, 0, 2}, {3209, 0x1, 23, 1},
+  {3219, 0x1, 23, 1}, {3233, 0xf, 12, 1}, {3233, 0xf, 12, 1},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {3249, 0x1, 8, 1}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {3103, 0x1, 0, 2}, {0, 0x0, 0, 0}, {3267, 0xf, 16, 1},
+  {3267, 0xf, 16, 1}, {3267, 0xf, 16, 1}, {3267, 0xf, 16, 1},
+  {3267, 0xf, 16, 1}, {3267, 0xf, 16, 1}, {3267, 0xf, 16, 1},
+  {3267, 0xf, 16, 1}, {3267, 0xf, 16, 1}, {3267, 0xf, 16, 1},
+  {3267, 0xf, 16, 1}, {3267, 0xf, 16, 1}, {3267, 0xf, 16, 1},
+  {3267, 0xf, 16, 1}, {3267, 0xf, 16, 1}, {0, 0x0, 0, 0},
+  {829, 0x0, 0, 0}, {829, 0x0, 0, 0}, {829, 0x0, 0, 0},
+  {829, 0x0, 0, 0}, {829, 0x0, 0, 0}, {829, 0x0, 0, 0},
+  {829, 0x0, 0, 0}, {829, 0x0, 0, 0}, {829, 0x0, 0, 0},
+  {829, 0x0, 0, 0}, {829, 0x0, 0, 0}, {829, 0x0, 0, 0},
+  {829, 0x0, 0, 0}, {829, 0x0, 0, 0}, {829, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {828, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {3251, 0xf, 28, 1}, {3283, 0x1, 0, 2}, {3303, 0xf, 16, 1},
+  {3303, 0xf, 16, 1}, {3303, 0xf, 16, 1}, {3303, 0xf, 16, 1},
+  {3303, 0xf, 16, 1}, {3303, 0xf, 16, 1}, {3303, 0xf, 16, 1},
+  {3303, 0xf, 16, 1}, {3303, 0xf, 16, 1}, {3303, 0xf, 16, 1},
+  {3303, 0xf, 16, 1}, {3303, 0xf, 16, 1}, {3303, 0xf, 16, 1},
+  {3303, 0xf, 16, 1}, {3303, 0xf, 16, 1}, {0, 0x0, 0, 0},
+  {831, 0x0, 0, 0}, {831, 0x0, 0, 0}, {831, 0x0, 0, 0},
+  {831, 0x0, 0, 0}, {831, 0x0, 0, 0}, {831, 0x0, 0, 0},
+  {831, 0x0, 0, 0}, {831, 0x0, 0, 0}, {831, 0x0, 0, 0},
+  {831, 0x0, 0, 0}, {831, 0x0, 0, 0}, {831, 0x0, 0, 0},
+  {831, 0x0, 0, 0}, {831, 0x0, 0, 0}, {831, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {830, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {3287, 0xf, 28, 1}, {3319, 0x1, 0, 2}, {832, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {3323, 0x1, 0, 2}, {0, 0x0, 0, 0},
+  {833, 0x0, 0, 0}, {0, 0x0, 0, 0}, {834, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {3333, 0x1, 0, 1}, {0, 0x0, 0, 0},
+  {3327, 0x1, 0, 2}, {3329, 0x1, 0, 2}, {3337, 0x1, 8, 1},
+  {3339, 0x1, 8, 1}, {3285, 0x8, 0, 2}, {3321, 0x8, 0, 2},
+  {3325, 0x1, 23, 1}, {3331, 0x1, 23, 1}, {3345, 0xf, 12, 1},
+  {3363, 0xf, 12, 1}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {3361, 0x1, 8, 1},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {3185, 0x8, 0, 2}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {3379, 0x1, 8, 1},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {3151, 0xf, 28, 1}, {0, 0x0, 0, 0},
+  {3383, 0x1, 20, 1}, {3401, 0x1, 20, 1}, {3385, 0x7, 9, 1},
+  {3393, 0x7, 9, 1}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {3097, 0x1, 23, 1}, {0, 0x0, 0, 0}, {3113, 0x3, 21, 1},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {3145, 0x1, 23, 1},
+  {0, 0x0, 0, 0}, {3195, 0x3, 21, 1}, {3403, 0x7, 9, 1},
+  {3411, 0x7, 9, 1}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {3223, 0x1, 21, 1}, {0, 0x0, 0, 0}, {3229, 0x3, 21, 1},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {3335, 0x1, 21, 1},
+  {0, 0x0, 0, 0}, {3341, 0x3, 21, 1}, {835, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {836, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {837, 0x0, 0, 0}, {0, 0x0, 0, 0}, {838, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {839, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {840, 0x0, 0, 0}, {0, 0x0, 0, 0}, {841, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {842, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {843, 0x0, 0, 0}, {0, 0x0, 0, 0}, {844, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {845, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {846, 0x0, 0, 0}, {0, 0x0, 0, 0}, {847, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {848, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {3449, 0x1, 21, 1}, {3463, 0x1, 21, 1}, {3451, 0x1, 8, 1},
+  {3457, 0x1, 8, 1}, {3453, 0x1, 6, 1}, {3455, 0x1, 6, 1},
+  {3419, 0x1, 0, 2}, {3421, 0x1, 0, 2}, {3423, 0x1, 0, 2},
+  {3425, 0x1, 0, 2}, {3459, 0x1, 6, 1}, {3461, 0x1, 6, 1},
+  {3427, 0x1, 0, 2}, {3429, 0x1, 0, 2}, {3431, 0x1, 0, 2},
+  {3433, 0x1, 0, 2}, {3465, 0x1, 8, 1}, {3471, 0x1, 8, 1},
+  {3467, 0x1, 6, 1}, {3469, 0x1, 6, 1}, {3435, 0x1, 0, 2},
+  {0, 0x0, 0, 0}, {3437, 0x1, 0, 2}, {0, 0x0, 0, 0},
+  {3473, 0x1, 6, 1}, {3475, 0x1, 6, 1}, {3439, 0x1, 0, 2},
+  {3441, 0x1, 0, 2}, {3443, 0x1, 0, 2}, {3445, 0x1, 0, 2},
+  {849, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {3477, 0x1, 0, 2}, {850, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {851, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {3483, 0x1, 0, 2}, {852, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {853, 0x0, 0, 0}, {0, 0x0, 0, 0}, {3489, 0x1, 16, 1},
+  {0, 0x0, 0, 0}, {3495, 0x1, 6, 1}, {3497, 0x1, 6, 1},
+  {3487, 0x1, 0, 2}, {0, 0x0, 0, 0}, {3491, 0x1, 0, 2},
+  {0, 0x0, 0, 0}, {3501, 0x1, 8, 1}, {3503, 0x1, 8, 1},
+  {3479, 0x15, 0, 2}, {3481, 0x1, 0, 2}, {3485, 0x16, 0, 2},
+  {3493, 0x1, 21, 1}, {854, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {855, 0x0, 0, 0}, {0, 0x0, 0, 0}, {856, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {857, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {858, 0x0, 0, 0}, {0, 0x0, 0, 0}, {859, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {860, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {861, 0x0, 0, 0}, {0, 0x0, 0, 0}, {862, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {863, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {864, 0x0, 0, 0}, {0, 0x0, 0, 0}, {865, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {866, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {867, 0x0, 0, 0}, {0, 0x0, 0, 0}, {868, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {869, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {870, 0x0, 0, 0}, {0, 0x0, 0, 0}, {871, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {3543, 0x1, 7, 1}, {3545, 0x1, 7, 1},
+  {3533, 0x1, 0, 2}, {3535, 0x1, 0, 2}, {3537, 0x1, 0, 2},
+  {3539, 0x1, 0, 2}, {872, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {873, 0x0, 0, 0}, {0, 0x0, 0, 0}, {874, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {875, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {3557, 0x1, 7, 1}, {3559, 0x1, 7, 1}, {3547, 0x1, 0, 2},
+  {3549, 0x1, 0, 2}, {3551, 0x1, 0, 2}, {3553, 0x1, 0, 2},
+  {876, 0x0, 0, 0}, {0, 0x0, 0, 0}, {877, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {878, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {879, 0x0, 0, 0}, {0, 0x0, 0, 0}, {3571, 0x1, 7, 1},
+  {3573, 0x1, 7, 1}, {3561, 0x1, 0, 2}, {3563, 0x1, 0, 2},
+  {3565, 0x1, 0, 2}, {3567, 0x1, 0, 2}, {880, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {881, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {882, 0x0, 0, 0}, {0, 0x0, 0, 0}, {883, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {3585, 0x1, 7, 1}, {3587, 0x1, 7, 1},
+  {3575, 0x1, 0, 2}, {3577, 0x1, 0, 2}, {3579, 0x1, 0, 2},
+  {3581, 0x1, 0, 2}, {884, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {3589, 0x1, 0, 2}, {0, 0x0, 0, 0}, {885, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {886, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {887, 0x0, 0, 0}, {0, 0x0, 0, 0}, {888, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {889, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {3605, 0x1, 7, 1}, {3607, 0x1, 7, 1}, {3595, 0x1, 0, 2},
+  {3597, 0x1, 0, 2}, {3599, 0x1, 0, 2}, {3601, 0x1, 0, 2},
+  {890, 0x0, 0, 0}, {0, 0x0, 0, 0}, {3541, 0x1, 16, 1},
+  {3555, 0x1, 16, 1}, {3569, 0x1, 16, 1}, {3583, 0x1, 16, 1},
+  {3591, 0x1, 16, 1}, {3593, 0x1, 0, 2}, {3603, 0x1, 16, 1},
+  {3609, 0x1, 0, 2}, {891, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {892, 0x0, 0, 0}, {0, 0x0, 0, 0}, {893, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {894, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {895, 0x0, 0, 0}, {0, 0x0, 0, 0}, {3631, 0x1, 7, 1},
+  {3633, 0x1, 7, 1}, {3621, 0x1, 0, 2}, {3623, 0x1, 0, 2},
+  {3625, 0x1, 0, 2}, {3627, 0x1, 0, 2}, {896, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {897, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {898, 0x0, 0, 0}, {0, 0x0, 0, 0}, {899, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {3645, 0x1, 7, 1}, {3647, 0x1, 7, 1},
+  {3635, 0x1, 0, 2}, {3637, 0x1, 0, 2}, {3639, 0x1, 0, 2},
+  {3641, 0x1, 0, 2}, {900, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {901, 0x0, 0, 0}, {0, 0x0, 0, 0}, {902, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {903, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {3659, 0x1, 7, 1}, {3661, 0x1, 7, 1}, {3649, 0x1, 0, 2},
+  {3651, 0x1, 0, 2}, {3653, 0x1, 0, 2}, {3655, 0x1, 0, 2},
+  {904, 0x0, 0, 0}, {0, 0x0, 0, 0}, {905, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {906, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {907, 0x0, 0, 0}, {0, 0x0, 0, 0}, {3673, 0x1, 7, 1},
+  {3675, 0x1, 7, 1}, {3663, 0x1, 0, 2}, {3665, 0x1, 0, 2},
+  {3667, 0x1, 0, 2}, {3669, 0x1, 0, 2}, {908, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {3677, 0x1, 0, 2}, {0, 0x0, 0, 0},
+  {909, 0x0, 0, 0}, {0, 0x0, 0, 0}, {910, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {911, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {912, 0x0, 0, 0}, {0, 0x0, 0, 0}, {913, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {3693, 0x1, 7, 1}, {3695, 0x1, 7, 1},
+  {3683, 0x1, 0, 2}, {3685, 0x1, 0, 2}, {3687, 0x1, 0, 2},
+  {3689, 0x1, 0, 2}, {914, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {3629, 0x1, 16, 1}, {3643, 0x1, 16, 1}, {3657, 0x1, 16, 1},
+  {3671, 0x1, 16, 1}, {3679, 0x1, 16, 1}, {3681, 0x1, 0, 2},
+  {3691, 0x1, 16, 1}, {3697, 0x1, 0, 2}, {3709, 0x1, 21, 1},
+  {3723, 0x1, 21, 1}, {3711, 0x1, 8, 1}, {3717, 0x1, 8, 1},
+  {3713, 0x1, 6, 1}, {3715, 0x1, 6, 1}, {3507, 0x1, 0, 2},
+  {3509, 0x1, 0, 2}, {3511, 0x1, 0, 2}, {3513, 0x1, 0, 2},
+  {3719, 0x1, 6, 1}, {3721, 0x1, 6, 1}, {3515, 0x1, 0, 2},
+  {3517, 0x1, 0, 2}, {3519, 0x1, 0, 2}, {3521, 0x1, 0, 2},
+  {3725, 0x1, 8, 1}, {3731, 0x1, 8, 1}, {3727, 0x1, 6, 1},
+  {3729, 0x1, 6, 1}, {3523, 0x1, 0, 2}, {3525, 0x1, 0, 2},
+  {3527, 0x1, 0, 2}, {3529, 0x1, 0, 2}, {3733, 0x1, 6, 1},
+  {3735, 0x1, 6, 1}, {3531, 0x1, 0, 2}, {3611, 0x7, 17, 1},
+  {3619, 0x1, 0, 2}, {3699, 0x7, 17, 1}, {915, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {916, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {3737, 0x1, 0, 2}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {3739, 0x1, 0, 2}, {917, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {3741, 0x7, 21, 1}, {3749, 0x1, 0, 2},
+  {918, 0x0, 0, 0}, {0, 0x0, 0, 0}, {3757, 0x7, 9, 1},
+  {3769, 0x7, 9, 1}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {3765, 0x1, 4, 1}, {0, 0x0, 0, 0}, {3767, 0x1, 4, 1},
+  {3447, 0x1, 23, 1}, {3499, 0x1, 23, 1}, {0, 0x0, 0, 0},
+  {3505, 0x1, 0, 2}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {3777, 0x1, 4, 1}, {0, 0x0, 0, 0}, {3779, 0x1, 4, 1},
+  {3707, 0x1, 23, 1}, {3751, 0x1, 8, 1}, {0, 0x0, 0, 0},
+  {3753, 0x1, 0, 2}, {919, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {3755, 0x1, 20, 1}, {3781, 0x1, 0, 2}, {1525, 0x1, 20, 1},
+  {1799, 0x3, 23, 1}, {2111, 0x1, 22, 1}, {3011, 0x1, 24, 1},
+  {3069, 0x1, 22, 1}, {3079, 0x1, 24, 1}, {3381, 0x1, 24, 1},
+  {3783, 0x1, 24, 1}, {0, 0x0, 0, 0}, {4, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {2, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {3, 0x0, 0, 0}, {0, 0x0, 0, 0}, {3793, 0x17, 0, 2},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {3795, 0x18, 0, 2},
+  {2, 0x0, 0, 0}, {3797, 0x18, 0, 2}, {3, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {5, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {3841, 0x1, 16, 1}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {3843, 0x1, 5, 1}, {3845, 0x1, 5, 1},
+  {3799, 0x7, 17, 1}, {0, 0x0, 0, 0}, {3807, 0x19, 0, 2},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {15, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {16, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {17, 0x0, 0, 0}, {0, 0x0, 0, 0}, {18, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {19, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {20, 0x0, 0, 0}, {0, 0x0, 0, 0}, {21, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {22, 0x0, 0, 0}, {23, 0x0, 0, 0},
+  {24, 0x0, 0, 0}, {0, 0x0, 0, 0}, {25, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {26, 0x0, 0, 0}, {3865, 0x1a, 0, 2},
+  {3867, 0x1a, 0, 2}, {27, 0x0, 0, 0}, {28, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {29, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {30, 0x0, 0, 0}, {3873, 0x1a, 0, 2}, {3875, 0x1a, 0, 2},
+  {31, 0x0, 0, 0}, {32, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {33, 0x0, 0, 0}, {0, 0x0, 0, 0}, {34, 0x0, 0, 0},
+  {3881, 0x1a, 0, 2}, {3883, 0x1a, 0, 2}, {3889, 0x3, 20, 1},
+  {3893, 0x3, 20, 1}, {35, 0x0, 0, 0}, {36, 0x0, 0, 0},
+  {37, 0x0, 0, 0}, {38, 0x0, 0, 0}, {39, 0x0, 0, 0},
+  {40, 0x0, 0, 0}, {41, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {3899, 0x3, 20, 1}, {3903, 0x3, 20, 1}, {42, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {43, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {44, 0x0, 0, 0}, {0, 0x0, 0, 0}, {45, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {46, 0x0, 0, 0},
+  {3907, 0x1b, 0, 2}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {47, 0x0, 0, 0}, {3911, 0x1b, 0, 2}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {48, 0x0, 0, 0}, {3915, 0x1b, 0, 2},
+  {0, 0x0, 0, 0}, {3921, 0x3, 20, 1}, {3925, 0x3, 20, 1},
+  {3909, 0x1, 12, 1}, {0, 0x0, 0, 0}, {3913, 0x1, 12, 1},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {3917, 0x1, 12, 1}, {0, 0x0, 0, 0}, {50, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {51, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {3935, 0x1, 21, 1}, {3937, 0x1, 21, 1}, {49, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {3929, 0x1, 20, 1}, {3931, 0x1, 20, 1},
+  {0, 0x0, 0, 0}, {52, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {53, 0x0, 0, 0}, {3941, 0x1b, 0, 2}, {0, 0x0, 0, 0},
+  {3943, 0x1, 12, 1}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {54, 0x0, 0, 0}, {3947, 0x1b, 0, 2}, {0, 0x0, 0, 0},
+  {3949, 0x1, 12, 1}, {0, 0x0, 0, 0}, {3955, 0x1, 21, 1},
+  {3957, 0x1, 21, 1}, {3939, 0x1a, 0, 2}, {0, 0x0, 0, 0},
+  {3945, 0x1, 20, 1}, {3951, 0x1, 20, 1}, {3961, 0x3, 20, 1},
+  {3965, 0x3, 20, 1}, {55, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {56, 0x0, 0, 0}, {0, 0x0, 0, 0}, {57, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {58, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {59, 0x0, 0, 0}, {3969, 0x1b, 0, 2},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {60, 0x0, 0, 0},
+  {3973, 0x1b, 0, 2}, {0, 0x0, 0, 0}, {3979, 0x3, 20, 1},
+  {0, 0x0, 0, 0}, {3971, 0x1, 12, 1}, {0, 0x0, 0, 0},
+  {3975, 0x1, 12, 1}, {0, 0x0, 0, 0}, {3999, 0x1, 6, 1},
+  {4001, 0x1, 6, 1}, {4003, 0x1, 6, 1}, {4005, 0x1, 6, 1},
+  {4007, 0x1, 6, 1}, {4009, 0x1, 6, 1}, {4011, 0x1, 6, 1},
+  {4013, 0x1, 6, 1}, {4015, 0x1, 6, 1}, {4017, 0x1, 6, 1},
+  {4019, 0x1, 6, 1}, {4021, 0x1, 6, 1}, {4023, 0x1, 6, 1},
+  {4025, 0x1, 6, 1}, {4027, 0x1, 6, 1}, {4029, 0x1, 6, 1},
+  {6, 0x0, 0, 0}, {3847, 0x1a, 0, 2}, {7, 0x0, 0, 0},
+  {3849, 0x1a, 0, 2}, {8, 0x0, 0, 0}, {3851, 0x1a, 0, 2},
+  {9, 0x0, 0, 0}, {3853, 0x1a, 0, 2}, {10, 0x0, 0, 0},
+  {3855, 0x1a, 0, 2}, {11, 0x0, 0, 0}, {3857, 0x1a, 0, 2},
+  {12, 0x0, 0, 0}, {3859, 0x1a, 0, 2}, {13, 0x0, 0, 0},
+  {3861, 0x1a, 0, 2}, {3863, 0x1, 24, 1}, {3869, 0x1, 24, 1},
+  {3871, 0x1, 24, 1}, {3877, 0x1, 24, 1}, {14, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {3879, 0x1, 24, 1}, {3885, 0x1, 24, 1},
+  {0, 0x0, 0, 0}, {3887, 0x1, 24, 1}, {3897, 0x1, 24, 1},
+  {3919, 0x1, 24, 1}, {3933, 0x1, 24, 1}, {3953, 0x1, 24, 1},
+  {3959, 0x1, 24, 1}, {3977, 0x1, 24, 1}, {0, 0x0, 0, 0},
+  {70, 0x0, 0, 0}, {4035, 0x3, 20, 1}, {4039, 0x3, 20, 1},
+  {78, 0x0, 0, 0}, {79, 0x0, 0, 0}, {80, 0x0, 0, 0},
+  {81, 0x0, 0, 0}, {82, 0x0, 0, 0}, {83, 0x0, 0, 0},
+  {84, 0x0, 0, 0}, {85, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {87, 0x0, 0, 0}, {4043, 0x1b, 0, 2}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {88, 0x0, 0, 0}, {4047, 0x1b, 0, 2},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {86, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {89, 0x0, 0, 0}, {4053, 0x1b, 0, 2},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {90, 0x0, 0, 0},
+  {4057, 0x1b, 0, 2}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {91, 0x0, 0, 0}, {4061, 0x1b, 0, 2}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {92, 0x0, 0, 0}, {4065, 0x1b, 0, 2},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {93, 0x0, 0, 0},
+  {4069, 0x1b, 0, 2}, {0, 0x0, 0, 0}, {4075, 0x3, 20, 1},
+  {4079, 0x3, 20, 1}, {4045, 0x1, 12, 1}, {4049, 0x1, 12, 1},
+  {4051, 0x1a, 0, 2}, {4055, 0x1, 12, 1}, {4059, 0x1, 12, 1},
+  {4063, 0x1, 12, 1}, {4067, 0x1, 12, 1}, {4071, 0x1, 12, 1},
+  {0, 0x0, 0, 0}, {71, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {72, 0x0, 0, 0}, {0, 0x0, 0, 0}, {73, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {74, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {75, 0x0, 0, 0}, {0, 0x0, 0, 0}, {76, 0x0, 0, 0},
+  {94, 0x0, 0, 0}, {95, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {96, 0x0, 0, 0}, {0, 0x0, 0, 0}, {97, 0x0, 0, 0},
+  {4097, 0x1a, 0, 2}, {4099, 0x1a, 0, 2}, {0, 0x0, 0, 0},
+  {77, 0x0, 0, 0}, {98, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {4109, 0x3, 20, 1}, {0, 0x0, 0, 0}, {99, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {100, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {101, 0x0, 0, 0}, {4113, 0x1b, 0, 2},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {102, 0x0, 0, 0},
+  {4117, 0x1b, 0, 2}, {0, 0x0, 0, 0}, {4123, 0x3, 20, 1},
+  {0, 0x0, 0, 0}, {4115, 0x1, 12, 1}, {0, 0x0, 0, 0},
+  {4119, 0x1, 12, 1}, {0, 0x0, 0, 0}, {4129, 0x3, 20, 1},
+  {4133, 0x3, 20, 1}, {103, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {104, 0x0, 0, 0}, {0, 0x0, 0, 0}, {105, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {106, 0x0, 0, 0}, {4137, 0x1b, 0, 2},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {107, 0x0, 0, 0},
+  {4141, 0x1b, 0, 2}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {108, 0x0, 0, 0}, {4145, 0x1b, 0, 2}, {0, 0x0, 0, 0},
+  {4151, 0x3, 20, 1}, {4155, 0x3, 20, 1}, {4139, 0x1, 12, 1},
+  {0, 0x0, 0, 0}, {4143, 0x1, 12, 1}, {0, 0x0, 0, 0},
+  {4147, 0x1, 12, 1}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {4161, 0x3, 20, 1},
+  {109, 0x0, 0, 0}, {0, 0x0, 0, 0}, {110, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {111, 0x0, 0, 0},
+  {4165, 0x1b, 0, 2}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {112, 0x0, 0, 0}, {4169, 0x1b, 0, 2}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {4175, 0x3, 20, 1}, {4167, 0x1, 12, 1},
+  {0, 0x0, 0, 0}, {4171, 0x1, 12, 1}, {0, 0x0, 0, 0},
+  {4181, 0x3, 20, 1}, {4185, 0x3, 20, 1}, {113, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {114, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {115, 0x0, 0, 0}, {0, 0x0, 0, 0}, {116, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {117, 0x0, 0, 0},
+  {4189, 0x1b, 0, 2}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {118, 0x0, 0, 0}, {4193, 0x1b, 0, 2}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {119, 0x0, 0, 0}, {4197, 0x1b, 0, 2},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {120, 0x0, 0, 0},
+  {4201, 0x1b, 0, 2}, {0, 0x0, 0, 0}, {4207, 0x3, 20, 1},
+  {4211, 0x3, 20, 1}, {4191, 0x1, 12, 1}, {0, 0x0, 0, 0},
+  {4195, 0x1, 12, 1}, {0, 0x0, 0, 0}, {4199, 0x1, 12, 1},
+  {0, 0x0, 0, 0}, {4203, 0x1, 12, 1}, {0, 0x0, 0, 0},
+  {4231, 0x1, 6, 1}, {4233, 0x1, 6, 1}, {4235, 0x1, 6, 1},
+  {4237, 0x1, 6, 1}, {4239, 0x1, 6, 1}, {4241, 0x1, 6, 1},
+  {4243, 0x1, 6, 1}, {4245, 0x1, 6, 1}, {4247, 0x1, 6, 1},
+  {4249, 0x1, 6, 1}, {4251, 0x1, 6, 1}, {4253, 0x1, 6, 1},
+  {4255, 0x1, 6, 1}, {4257, 0x1, 6, 1}, {4259, 0x1, 6, 1},
+  {4261, 0x1, 6, 1}, {61, 0x0, 0, 0}, {4031, 0x1a, 0, 2},
+  {4033, 0x1, 24, 1}, {4073, 0x1, 24, 1}, {62, 0x0, 0, 0},
+  {4083, 0x1a, 0, 2}, {63, 0x0, 0, 0}, {4085, 0x1a, 0, 2},
+  {64, 0x0, 0, 0}, {4087, 0x1a, 0, 2}, {65, 0x0, 0, 0},
+  {4089, 0x1a, 0, 2}, {66, 0x0, 0, 0}, {4091, 0x1a, 0, 2},
+  {67, 0x0, 0, 0}, {4093, 0x1a, 0, 2}, {4095, 0x1, 24, 1},
+  {4101, 0x1, 24, 1}, {68, 0x0, 0, 0}, {4103, 0x1a, 0, 2},
+  {69, 0x0, 0, 0}, {0, 0x0, 0, 0}, {4105, 0x1, 24, 1},
+  {0, 0x0, 0, 0}, {4107, 0x1, 24, 1}, {4121, 0x1, 24, 1},
+  {4127, 0x1, 24, 1}, {4149, 0x1, 24, 1}, {4159, 0x1, 24, 1},
+  {4173, 0x1, 24, 1}, {4179, 0x1, 24, 1}, {4205, 0x1, 24, 1},
+  {210, 0x0, 0, 0}, {0, 0x0, 0, 0}, {4263, 0x1, 12, 1},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {211, 0x0, 0, 0},
+  {4267, 0x1d, 0, 2}, {0, 0x0, 0, 0}, {212, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {4271, 0x1, 12, 1}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {213, 0x0, 0, 0}, {4275, 0x1d, 0, 2},
+  {0, 0x0, 0, 0}, {4265, 0x1c, 0, 2}, {4269, 0x1c, 0, 2},
+  {4273, 0x1c, 0, 2}, {4277, 0x1c, 0, 2}, {214, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {215, 0x0, 0, 0},
+  {4285, 0x1d, 0, 2}, {0, 0x0, 0, 0}, {4283, 0x1c, 0, 2},
+  {4287, 0x1c, 0, 2}, {216, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {4291, 0x1, 12, 1}, {0, 0x0, 0, 0}, {217, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {4295, 0x1, 12, 1}, {0, 0x0, 0, 0},
+  {4297, 0x1c, 0, 2}, {0, 0x0, 0, 0}, {4293, 0x1c, 0, 2},
+  {4299, 0x1, 24, 1}, {4289, 0x1, 24, 1}, {4301, 0x1, 8, 1},
+  {0, 0x0, 0, 0}, {218, 0x0, 0, 0}, {4305, 0x1b, 0, 2},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {219, 0x0, 0, 0},
+  {4309, 0x1b, 0, 2}, {0, 0x0, 0, 0}, {4307, 0x1c, 0, 2},
+  {4311, 0x1c, 0, 2}, {220, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {4315, 0x1, 12, 1}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {221, 0x0, 0, 0}, {4319, 0x1b, 0, 2}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {222, 0x0, 0, 0}, {4323, 0x1b, 0, 2},
+  {0, 0x0, 0, 0}, {4321, 0x1c, 0, 2}, {4325, 0x1c, 0, 2},
+  {223, 0x0, 0, 0}, {0, 0x0, 0, 0}, {4329, 0x1, 12, 1},
+  {0, 0x0, 0, 0}, {4313, 0x1, 24, 1}, {4317, 0x1c, 0, 2},
+  {4327, 0x1, 24, 1}, {4331, 0x1c, 0, 2}, {224, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {225, 0x0, 0, 0},
+  {4339, 0x1d, 0, 2}, {0, 0x0, 0, 0}, {4337, 0x1c, 0, 2},
+  {4341, 0x1c, 0, 2}, {226, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {4345, 0x1, 12, 1}, {0, 0x0, 0, 0}, {227, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {4349, 0x1, 12, 1}, {0, 0x0, 0, 0},
+  {4351, 0x1c, 0, 2}, {0, 0x0, 0, 0}, {4347, 0x1c, 0, 2},
+  {4353, 0x1, 24, 1}, {4343, 0x1, 24, 1}, {4355, 0x1, 8, 1},
+  {228, 0x0, 0, 0}, {0, 0x0, 0, 0}, {4359, 0x1, 12, 1},
+  {0, 0x0, 0, 0}, {229, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {4363, 0x1, 12, 1}, {0, 0x0, 0, 0}, {4365, 0x1c, 0, 2},
+  {0, 0x0, 0, 0}, {230, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {4369, 0x1, 12, 1}, {0, 0x0, 0, 0}, {231, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {4373, 0x1, 12, 1}, {0, 0x0, 0, 0},
+  {4375, 0x1c, 0, 2}, {0, 0x0, 0, 0}, {4361, 0x1c, 0, 2},
+  {4367, 0x1, 24, 1}, {4371, 0x1c, 0, 2}, {4377, 0x1, 24, 1},
+  {232, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {233, 0x0, 0, 0}, {4385, 0x1d, 0, 2}, {0, 0x0, 0, 0},
+  {4383, 0x1c, 0, 2}, {4387, 0x1c, 0, 2}, {234, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {4391, 0x1, 12, 1}, {0, 0x0, 0, 0},
+  {235, 0x0, 0, 0}, {0, 0x0, 0, 0}, {4395, 0x1, 12, 1},
+  {0, 0x0, 0, 0}, {4397, 0x1c, 0, 2}, {0, 0x0, 0, 0},
+  {4393, 0x1c, 0, 2}, {4399, 0x1, 24, 1}, {4389, 0x1, 24, 1},
+  {4401, 0x1, 8, 1}, {236, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {4405, 0x1, 12, 1}, {0, 0x0, 0, 0}, {237, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {4409, 0x1, 12, 1}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {4411, 0x1c, 0, 2}, {4407, 0x1c, 0, 2},
+  {4413, 0x1e, 0, 2}, {238, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {239, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {240, 0x0, 0, 0}, {4421, 0x1d, 0, 2}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {241, 0x0, 0, 0}, {4425, 0x1d, 0, 2},
+  {0, 0x0, 0, 0}, {4431, 0x3, 8, 1}, {4435, 0x3, 8, 1},
+  {4417, 0x1c, 0, 2}, {4419, 0x1c, 0, 2}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {4423, 0x1c, 0, 2}, {4427, 0x1c, 0, 2},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {4443, 0x1, 6, 1},
+  {4445, 0x1, 6, 1}, {4447, 0x1, 6, 1}, {4449, 0x1, 6, 1},
+  {4279, 0x3, 8, 1}, {4303, 0x1, 9, 1}, {4333, 0x3, 8, 1},
+  {4357, 0x1, 9, 1}, {4379, 0x3, 8, 1}, {4403, 0x1, 9, 1},
+  {4415, 0x1, 8, 1}, {4429, 0x1, 24, 1}, {121, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {122, 0x0, 0, 0},
+  {4453, 0x1b, 0, 2}, {0, 0x0, 0, 0}, {4451, 0x1, 11, 1},
+  {4455, 0x1, 12, 1}, {0, 0x0, 0, 0}, {128, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {129, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {130, 0x0, 0, 0}, {0, 0x0, 0, 0}, {131, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {132, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {133, 0x0, 0, 0}, {134, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {4471, 0x1, 0, 1}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {4473, 0x1, 12, 1}, {0, 0x0, 0, 0}, {135, 0x0, 0, 0},
+  {136, 0x0, 0, 0}, {0, 0x0, 0, 0}, {4479, 0x1, 0, 1},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {4481, 0x1, 12, 1},
+  {4487, 0x7, 6, 1}, {4495, 0x7, 6, 1}, {123, 0x0, 0, 0},
+  {4459, 0x1f, 0, 2}, {124, 0x0, 0, 0}, {4461, 0x1f, 0, 2},
+  {125, 0x0, 0, 0}, {4463, 0x1f, 0, 2}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {126, 0x0, 0, 0}, {4465, 0x1f, 0, 2},
+  {127, 0x0, 0, 0}, {4467, 0x1f, 0, 2}, {4469, 0x20, 0, 2},
+  {4475, 0x20, 0, 2}, {4477, 0x20, 0, 2}, {4483, 0x20, 0, 2},
+  {0, 0x0, 0, 0}, {139, 0x0, 0, 0}, {141, 0x0, 0, 0},
+  {142, 0x0, 0, 0}, {143, 0x0, 0, 0}, {144, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {140, 0x0, 0, 0}, {145, 0x0, 0, 0},
+  {146, 0x0, 0, 0}, {0, 0x0, 0, 0}, {147, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {148, 0x0, 0, 0}, {4513, 0x1f, 0, 2},
+  {4515, 0x1f, 0, 2}, {4521, 0x1, 8, 1}, {4527, 0x1, 8, 1},
+  {4523, 0x1, 6, 1}, {4525, 0x1, 6, 1}, {137, 0x0, 0, 0},
+  {4503, 0x1f, 0, 2}, {4505, 0x1, 7, 1}, {4507, 0x1, 7, 1},
+  {4529, 0x1, 6, 1}, {4531, 0x1, 6, 1}, {138, 0x0, 0, 0},
+  {4509, 0x1f, 0, 2}, {4511, 0x1, 7, 1}, {4517, 0x1, 7, 1},
+  {0, 0x0, 0, 0}, {153, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {154, 0x0, 0, 0}, {0, 0x0, 0, 0}, {155, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {156, 0x0, 0, 0}, {149, 0x0, 0, 0},
+  {4533, 0x1f, 0, 2}, {150, 0x0, 0, 0}, {4535, 0x1f, 0, 2},
+  {151, 0x0, 0, 0}, {4537, 0x1f, 0, 2}, {152, 0x0, 0, 0},
+  {4539, 0x1f, 0, 2}, {0, 0x0, 0, 0}, {160, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {163, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {161, 0x0, 0, 0}, {0, 0x0, 0, 0}, {162, 0x0, 0, 0},
+  {157, 0x0, 0, 0}, {4549, 0x1f, 0, 2}, {0, 0x0, 0, 0},
+  {4551, 0x21, 0, 2}, {158, 0x0, 0, 0}, {4553, 0x1f, 0, 2},
+  {159, 0x0, 0, 0}, {4555, 0x1f, 0, 2}, {0, 0x0, 0, 0},
+  {178, 0x0, 0, 0}, {179, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {4567, 0x1, 0, 1}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {4569, 0x1, 12, 1}, {0, 0x0, 0, 0}, {171, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {172, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {173, 0x0, 0, 0}, {0, 0x0, 0, 0}, {174, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {175, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {176, 0x0, 0, 0}, {0, 0x0, 0, 0}, {177, 0x0, 0, 0},
+  {4589, 0x7, 6, 1}, {4597, 0x7, 6, 1}, {4565, 0x20, 0, 2},
+  {4571, 0x20, 0, 2}, {164, 0x0, 0, 0}, {4573, 0x1f, 0, 2},
+  {165, 0x0, 0, 0}, {4575, 0x1f, 0, 2}, {166, 0x0, 0, 0},
+  {4577, 0x1f, 0, 2}, {167, 0x0, 0, 0}, {4579, 0x1f, 0, 2},
+  {168, 0x0, 0, 0}, {4581, 0x1f, 0, 2}, {169, 0x0, 0, 0},
+  {4583, 0x1f, 0, 2}, {170, 0x0, 0, 0}, {4585, 0x1f, 0, 2},
+  {181, 0x0, 0, 0}, {0, 0x0, 0, 0}, {182, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {4605, 0x1, 0, 1}, {4607, 0x1, 0, 1},
+  {180, 0x0, 0, 0}, {0, 0x0, 0, 0}, {183, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {4613, 0x1, 12, 1}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {4621, 0x1, 6, 1},
+  {0, 0x0, 0, 0}, {184, 0x0, 0, 0}, {185, 0x0, 0, 0},
+  {186, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {4623, 0x1, 0, 1}, {0, 0x0, 0, 0}, {188, 0x0, 0, 0},
+  {187, 0x0, 0, 0}, {4627, 0x1f, 0, 2}, {189, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {4631, 0x1, 12, 1},
+  {0, 0x0, 0, 0}, {191, 0x0, 0, 0}, {190, 0x0, 0, 0},
+  {4635, 0x1f, 0, 2}, {4641, 0x3, 7, 1}, {4645, 0x3, 7, 1},
+  {4609, 0x1, 6, 1}, {4611, 0x1, 0, 1}, {4615, 0x1, 6, 1},
+  {4617, 0x3, 18, 1}, {4625, 0x22, 0, 2}, {4629, 0x1, 6, 1},
+  {4633, 0x22, 0, 2}, {4637, 0x1, 6, 1}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {4653, 0x1, 8, 1}, {0, 0x0, 0, 0},
+  {192, 0x0, 0, 0}, {193, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {194, 0x0, 0, 0}, {0, 0x0, 0, 0}, {195, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {4663, 0x1, 8, 1},
+  {0, 0x0, 0, 0}, {4655, 0x1f, 0, 2}, {4657, 0x1f, 0, 2},
+  {196, 0x0, 0, 0}, {197, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {198, 0x0, 0, 0}, {0, 0x0, 0, 0}, {199, 0x0, 0, 0},
+  {4667, 0x1f, 0, 2}, {4669, 0x1f, 0, 2}, {4675, 0x1, 6, 1},
+  {4677, 0x1, 6, 1}, {4649, 0x3, 18, 1}, {4659, 0x3, 18, 1},
+  {4665, 0x1, 7, 1}, {4671, 0x1, 7, 1}, {202, 0x0, 0, 0},
+  {203, 0x0, 0, 0}, {0, 0x0, 0, 0}, {204, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {205, 0x0, 0, 0}, {4681, 0x1f, 0, 2},
+  {4683, 0x1f, 0, 2}, {0, 0x0, 0, 0}, {201, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {4693, 0x1, 10, 1},
+  {0, 0x0, 0, 0}, {4695, 0x1, 6, 1}, {4697, 0x1, 6, 1},
+  {4679, 0x1, 8, 1}, {4685, 0x1, 8, 1}, {200, 0x0, 0, 0},
+  {4687, 0x1f, 0, 2}, {4703, 0x1, 9, 1}, {4705, 0x1, 9, 1},
+  {4707, 0x1, 9, 1}, {4709, 0x1, 9, 1}, {4485, 0x1, 10, 1},
+  {4519, 0x1, 10, 1}, {4541, 0x7, 6, 1}, {4557, 0x7, 6, 1},
+  {4587, 0x1, 10, 1}, {4639, 0x1, 10, 1}, {4673, 0x1, 10, 1},
+  {4689, 0x3, 18, 1}, {0, 0x0, 0, 0}, {208, 0x0, 0, 0},
+  {209, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {4713, 0x1, 12, 1}, {4719, 0x1, 6, 1}, {4721, 0x1, 6, 1},
+  {206, 0x0, 0, 0}, {207, 0x0, 0, 0}, {4711, 0x23, 0, 2},
+  {4715, 0x23, 0, 2}, {4699, 0x3, 16, 1}, {4717, 0x1, 10, 1},
+  {4457, 0x1, 6, 1}, {4723, 0x1, 11, 1}, {4439, 0x3, 10, 1},
+  {4725, 0x1, 24, 1}, {246, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {247, 0x0, 0, 0}, {0, 0x0, 0, 0}, {248, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {249, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {4729, 0x24, 0, 2}, {4731, 0x24, 0, 2}, {4733, 0x24, 0, 2},
+  {4735, 0x24, 0, 2}, {4757, 0x1, 5, 1}, {0, 0x0, 0, 0},
+  {4757, 0x1, 5, 1}, {0, 0x0, 0, 0}, {4757, 0x1, 5, 1},
+  {0, 0x0, 0, 0}, {4757, 0x1, 5, 1}, {0, 0x0, 0, 0},
+  {4757, 0x1, 5, 1}, {0, 0x0, 0, 0}, {4757, 0x1, 5, 1},
+  {0, 0x0, 0, 0}, {4757, 0x1, 5, 1}, {4757, 0x1, 5, 1},
+  {243, 0x0, 0, 0}, {4757, 0x1, 5, 1}, {243, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {242, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {242, 0x0, 0, 0}, {0, 0x0, 0, 0}, {242, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {242, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {242, 0x0, 0, 0}, {0, 0x0, 0, 0}, {242, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {242, 0x0, 0, 0}, {242, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {4741, 0xf, 8, 1},
+  {4759, 0xf, 8, 1}, {4781, 0x1, 8, 1}, {4781, 0x1, 8, 1},
+  {4781, 0x1, 8, 1}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {244, 0x0, 0, 0}, {4787, 0x1, 8, 1}, {4787, 0x1, 8, 1},
+  {4787, 0x1, 8, 1}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {245, 0x0, 0, 0}, {4777, 0x3, 10, 1}, {4783, 0x3, 10, 1},
+  {4775, 0x1, 5, 1}, {4789, 0x1, 5, 1}, {4737, 0x3, 8, 1},
+  {4791, 0x1, 8, 1}, {250, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {4795, 0x24, 0, 2}, {251, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {252, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {4799, 0x24, 0, 2}, {4801, 0x24, 0, 2}, {253, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {254, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {4797, 0x1, 24, 1}, {4803, 0x1, 24, 1}, {4805, 0x24, 0, 2},
+  {4807, 0x24, 0, 2}, {4809, 0x3, 8, 1}, {4791, 0x1, 8, 1},
+  {255, 0x0, 0, 0}, {0, 0x0, 0, 0}, {4815, 0x1, 0, 1},
+  {0, 0x0, 0, 0}, {256, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {4819, 0x1, 0, 1}, {0, 0x0, 0, 0}, {4817, 0x25, 0, 2},
+  {4821, 0x25, 0, 2}, {257, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {4825, 0x1, 0, 1}, {0, 0x0, 0, 0}, {258, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {4829, 0x1, 12, 1}, {4829, 0x1, 12, 1},
+  {4829, 0x1, 12, 1}, {4829, 0x1, 12, 1}, {4829, 0x1, 12, 1},
+  {4829, 0x1, 12, 1}, {4829, 0x1, 12, 1}, {0, 0x0, 0, 0},
+  {4829, 0x1, 12, 1}, {4829, 0x1, 12, 1}, {4829, 0x1, 12, 1},
+  {4829, 0x1, 12, 1}, {4829, 0x1, 12, 1}, {4829, 0x1, 12, 1},
+  {4829, 0x1, 12, 1}, {4829, 0x1, 12, 1}, {4829, 0x1, 12, 1},
+  {4829, 0x1, 12, 1}, {4829, 0x1, 12, 1}, {4829, 0x1, 12, 1},
+  {4829, 0x1, 12, 1}, {4829, 0x1, 12, 1}, {4829, 0x1, 12, 1},
+  {0, 0x0, 0, 0}, {4829, 0x1, 12, 1}, {4829, 0x1, 12, 1},
+  {4829, 0x1, 12, 1}, {4829, 0x1, 12, 1}, {4829, 0x1, 12, 1},
+  {4829, 0x1, 12, 1}, {4829, 0x1, 12, 1}, {4829, 0x1, 12, 1},
+  {4829, 0x1, 12, 1}, {4829, 0x1, 12, 1}, {4829, 0x1, 12, 1},
+  {4829, 0x1, 12, 1}, {4829, 0x1, 12, 1}, {4829, 0x1, 12, 1},
+  {4829, 0x1, 12, 1}, {4829, 0x1, 12, 1}, {4829, 0x1, 12, 1},
+  {4829, 0x1, 12, 1}, {4829, 0x1, 12, 1}, {4829, 0x1, 12, 1},
+  {4829, 0x1, 12, 1}, {4829, 0x1, 12, 1}, {4829, 0x1, 12, 1},
+  {4829, 0x1, 12, 1}, {4829, 0x1, 12, 1}, {4829, 0x1, 12, 1},
+  {4829, 0x1, 12, 1}, {4829, 0x1, 12, 1}, {4829, 0x1, 12, 1},
+  {4829, 0x1, 12, 1}, {4829, 0x1, 12, 1}, {259, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {4895, 0x1, 12, 1},
+  {4895, 0x1, 12, 1}, {0, 0x0, 0, 0}, {4895, 0x1, 12, 1},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {4897, 0x7, 19, 1},
+  {4831, 0x3f, 16, 1}, {4831, 0x3f, 16, 1}, {4831, 0x3f, 16, 1},
+  {4831, 0x3f, 16, 1}, {4831, 0x3f, 16, 1}, {4831, 0x3f, 16, 1},
+  {4831, 0x3f, 16, 1}, {4897, 0x7, 19, 1}, {4831, 0x3f, 16, 1},
+  {4831, 0x3f, 16, 1}, {4831, 0x3f, 16, 1}, {4831, 0x3f, 16, 1},
+  {4831, 0x3f, 16, 1}, {4831, 0x3f, 16, 1}, {4831, 0x3f, 16, 1},
+  {4831, 0x3f, 16, 1}, {4831, 0x3f, 16, 1}, {4831, 0x3f, 16, 1},
+  {4831, 0x3f, 16, 1}, {4831, 0x3f, 16, 1}, {4831, 0x3f, 16, 1},
+  {4831, 0x3f, 16, 1}, {4831, 0x3f, 16, 1}, {4897, 0x7, 19, 1},
+  {4831, 0x3f, 16, 1}, {4831, 0x3f, 16, 1}, {4831, 0x3f, 16, 1},
+  {4831, 0x3f, 16, 1}, {4831, 0x3f, 16, 1}, {4831, 0x3f, 16, 1},
+  {4831, 0x3f, 16, 1}, {4831, 0x3f, 16, 1}, {4831, 0x3f, 16, 1},
+  {4831, 0x3f, 16, 1}, {4831, 0x3f, 16, 1}, {4831, 0x3f, 16, 1},
+  {4831, 0x3f, 16, 1}, {4831, 0x3f, 16, 1}, {4831, 0x3f, 16, 1},
+  {4831, 0x3f, 16, 1}, {4831, 0x3f, 16, 1}, {4831, 0x3f, 16, 1},
+  {4831, 0x3f, 16, 1}, {4831, 0x3f, 16, 1}, {4831, 0x3f, 16, 1},
+  {4831, 0x3f, 16, 1}, {4831, 0x3f, 16, 1}, {4831, 0x3f, 16, 1},
+  {4831, 0x3f, 16, 1}, {4831, 0x3f, 16, 1}, {4831, 0x3f, 16, 1},
+  {4831, 0x3f, 16, 1}, {4831, 0x3f, 16, 1}, {4831, 0x3f, 16, 1},
+  {4831, 0x3f, 16, 1}, {4831, 0x3f, 16, 1}, {4905, 0x3f, 16, 1},
+  {4823, 0x1, 24, 1}, {4827, 0x25, 0, 2}, {4969, 0x26, 0, 2},
+  {0, 0x0, 0, 0}, {4823, 0x1, 24, 1}, {4827, 0x25, 0, 2},
+  {4831, 0x3f, 16, 1}, {0, 0x0, 0, 0}, {4791, 0x1, 8, 1},
+  {4971, 0x3, 8, 1}, {4971, 0x3, 8, 1}, {4975, 0x3, 8, 1},
+  {4971, 0x3, 8, 1}, {4975, 0x3, 8, 1}, {4975, 0x3, 8, 1},
+  {4975, 0x3, 8, 1}, {4979, 0x7, 19, 1}, {0, 0x0, 0, 0},
+  {4775, 0x1, 5, 1}, {0, 0x0, 0, 0}, {4775, 0x1, 5, 1},
+  {0, 0x0, 0, 0}, {4775, 0x1, 5, 1}, {0, 0x0, 0, 0},
+  {4775, 0x1, 5, 1}, {0, 0x0, 0, 0}, {4775, 0x1, 5, 1},
+  {0, 0x0, 0, 0}, {4775, 0x1, 5, 1}, {0, 0x0, 0, 0},
+  {4775, 0x1, 5, 1}, {4775, 0x1, 5, 1}, {4741, 0xf, 8, 1},
+  {5005, 0x1, 5, 1}, {4741, 0xf, 8, 1}, {0, 0x0, 0, 0},
+  {4741, 0xf, 8, 1}, {4989, 0xf, 8, 1}, {5007, 0x1, 5, 1},
+  {5007, 0x1, 5, 1}, {4741, 0xf, 8, 1}, {4741, 0xf, 8, 1},
+  {0, 0x0, 0, 0}, {5009, 0x3, 8, 1}, {0, 0x0, 0, 0},
+  {260, 0x0, 0, 0}, {0, 0x0, 0, 0}, {5015, 0x1, 21, 1},
+  {5013, 0x27, 0, 2}, {5017, 0x1, 9, 1}, {5019, 0x1, 21, 1},
+  {0, 0x0, 0, 0}, {4793, 0x24, 0, 2}, {4813, 0x24, 0, 2},
+  {4987, 0x1, 7, 1}, {5021, 0x1, 7, 1}, {0, 0x0, 0, 0},
+  {265, 0x0, 0, 0}, {5027, 0x1f, 0, 2}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {266, 0x0, 0, 0}, {5031, 0x1f, 0, 2},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {267, 0x0, 0, 0},
+  {5035, 0x1f, 0, 2}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {268, 0x0, 0, 0}, {5039, 0x1f, 0, 2}, {0, 0x0, 0, 0},
+  {5029, 0x24, 0, 2}, {5033, 0x24, 0, 2}, {5037, 0x24, 0, 2},
+  {5041, 0x24, 0, 2}, {262, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {5065, 0x1, 5, 1}, {0, 0x0, 0, 0}, {5065, 0x1, 5, 1},
+  {0, 0x0, 0, 0}, {5065, 0x1, 5, 1}, {0, 0x0, 0, 0},
+  {5065, 0x1, 5, 1}, {0, 0x0, 0, 0}, {5065, 0x1, 5, 1},
+  {0, 0x0, 0, 0}, {5065, 0x1, 5, 1}, {0, 0x0, 0, 0},
+  {5065, 0x1, 5, 1}, {5065, 0x1, 5, 1}, {5047, 0x1, 12, 1},
+  {5065, 0x1, 5, 1}, {5047, 0x1, 12, 1}, {0, 0x0, 0, 0},
+  {261, 0x0, 0, 0}, {0, 0x0, 0, 0}, {5067, 0x1, 12, 1},
+  {0, 0x0, 0, 0}, {5067, 0x1, 12, 1}, {0, 0x0, 0, 0},
+  {5067, 0x1, 12, 1}, {0, 0x0, 0, 0}, {5067, 0x1, 12, 1},
+  {0, 0x0, 0, 0}, {5067, 0x1, 12, 1}, {0, 0x0, 0, 0},
+  {5067, 0x1, 12, 1}, {0, 0x0, 0, 0}, {5067, 0x1, 12, 1},
+  {5067, 0x1, 12, 1}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {5049, 0xf, 8, 1}, {5069, 0xf, 8, 1}, {263, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {5093, 0x1, 8, 1}, {5093, 0x1, 8, 1},
+  {5093, 0x1, 8, 1}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {5087, 0x1, 12, 1}, {264, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {5101, 0x1, 8, 1}, {5101, 0x1, 8, 1}, {5101, 0x1, 8, 1},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {5095, 0x1, 12, 1},
+  {5089, 0x3, 10, 1}, {5097, 0x3, 10, 1}, {5085, 0x1, 5, 1},
+  {5103, 0x1, 5, 1}, {5043, 0x3, 8, 1}, {5105, 0x1, 8, 1},
+  {0, 0x0, 0, 0}, {269, 0x0, 0, 0}, {5109, 0x1f, 0, 2},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {5111, 0x24, 0, 2},
+  {0, 0x0, 0, 0}, {270, 0x0, 0, 0}, {5115, 0x1f, 0, 2},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {271, 0x0, 0, 0},
+  {5119, 0x1f, 0, 2}, {0, 0x0, 0, 0}, {5117, 0x24, 0, 2},
+  {5121, 0x24, 0, 2}, {0, 0x0, 0, 0}, {272, 0x0, 0, 0},
+  {5125, 0x1f, 0, 2}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {273, 0x0, 0, 0}, {5129, 0x1f, 0, 2}, {0, 0x0, 0, 0},
+  {5113, 0x1, 24, 1}, {5123, 0x1, 24, 1}, {5127, 0x24, 0, 2},
+  {5131, 0x24, 0, 2}, {5133, 0x3, 8, 1}, {5105, 0x1, 8, 1},
+  {274, 0x0, 0, 0}, {0, 0x0, 0, 0}, {5139, 0x1, 0, 1},
+  {0, 0x0, 0, 0}, {275, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {5143, 0x1, 0, 1}, {0, 0x0, 0, 0}, {5141, 0x25, 0, 2},
+  {5145, 0x25, 0, 2}, {276, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {5149, 0x1, 0, 1}, {0, 0x0, 0, 0}, {5147, 0x1, 24, 1},
+  {5151, 0x25, 0, 2}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {5153, 0x3, 8, 1}, {5105, 0x1, 8, 1}, {5157, 0x25, 0, 2},
+  {0, 0x0, 0, 0}, {5085, 0x1, 5, 1}, {0, 0x0, 0, 0},
+  {5085, 0x1, 5, 1}, {0, 0x0, 0, 0}, {5085, 0x1, 5, 1},
+  {0, 0x0, 0, 0}, {5085, 0x1, 5, 1}, {0, 0x0, 0, 0},
+  {5085, 0x1, 5, 1}, {0, 0x0, 0, 0}, {5085, 0x1, 5, 1},
+  {0, 0x0, 0, 0}, {5085, 0x1, 5, 1}, {5085, 0x1, 5, 1},
+  {5049, 0xf, 8, 1}, {5177, 0x1, 5, 1}, {5049, 0xf, 8, 1},
+  {0, 0x0, 0, 0}, {5049, 0xf, 8, 1}, {5161, 0xf, 8, 1},
+  {5179, 0x1, 5, 1}, {5179, 0x1, 5, 1}, {5049, 0xf, 8, 1},
+  {5049, 0xf, 8, 1}, {0, 0x0, 0, 0}, {5181, 0x3, 8, 1},
+  {0, 0x0, 0, 0}, {277, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {5187, 0x1f, 0, 2}, {0, 0x0, 0, 0}, {5189, 0x1, 21, 1},
+  {5185, 0x27, 0, 2}, {5191, 0x1, 9, 1}, {5193, 0x1, 21, 1},
+  {0, 0x0, 0, 0}, {5107, 0x24, 0, 2}, {5137, 0x24, 0, 2},
+  {5159, 0x1, 7, 1}, {5195, 0x1, 7, 1}, {5023, 0x3, 10, 1},
+  {5197, 0x3, 10, 1}, {5205, 0x1, 4, 1}, {5207, 0x1, 4, 1},
+  {3983, 0xf, 8, 1}, {4215, 0xf, 8, 1}, {4727, 0x1c, 0, 2},
+  {5201, 0x1, 6, 1}, {286, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {287, 0x0, 0, 0}, {0, 0x0, 0, 0}, {5211, 0x29, 0, 2},
+  {0, 0x0, 0, 0}, {5213, 0x2a, 0, 2}, {0, 0x0, 0, 0},
+  {5225, 0xf, 2, 1}, {5225, 0xf, 2, 1}, {5225, 0xf, 2, 1},
+  {5225, 0xf, 2, 1}, {5243, 0xf, 2, 1}, {5225, 0xf, 2, 1},
+  {5225, 0xf, 2, 1}, {5225, 0xf, 2, 1}, {288, 0x0, 0, 0},
+  {288, 0x0, 0, 0}, {288, 0x0, 0, 0}, {5241, 0x1, 0, 1},
+  {288, 0x0, 0, 0}, {288, 0x0, 0, 0}, {288, 0x0, 0, 0},
+  {5241, 0x1, 0, 1}, {288, 0x0, 0, 0}, {288, 0x0, 0, 0},
+  {288, 0x0, 0, 0}, {5241, 0x1, 0, 1}, {288, 0x0, 0, 0},
+  {288, 0x0, 0, 0}, {288, 0x0, 0, 0}, {5241, 0x1, 0, 1},
+  {288, 0x0, 0, 0}, {0, 0x0, 0, 0}, {288, 0x0, 0, 0},
+  {288, 0x0, 0, 0}, {288, 0x0, 0, 0}, {5241, 0x1, 0, 1},
+  {288, 0x0, 0, 0}, {288, 0x0, 0, 0}, {288, 0x0, 0, 0},
+  {5241, 0x1, 0, 1}, {288, 0x0, 0, 0}, {288, 0x0, 0, 0},
+  {288, 0x0, 0, 0}, {5241, 0x1, 0, 1}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {5261, 0x3, 2, 1}, {0, 0x0, 0, 0}, {289, 0x0, 0, 0},
+  {289, 0x0, 0, 0}, {289, 0x0, 0, 0}, {5265, 0x1, 0, 1},
+  {289, 0x0, 0, 0}, {0, 0x0, 0, 0}, {5209, 0x28, 0, 2},
+  {5209, 0x28, 0, 2}, {5215, 0x28, 0, 2}, {5217, 0x7, 9, 1},
+  {5259, 0x1, 5, 1}, {5259, 0x1, 5, 1}, {5215, 0x28, 0, 2},
+  {5215, 0x28, 0, 2}, {5217, 0x7, 9, 1}, {5217, 0x7, 9, 1},
+  {5215, 0x28, 0, 2}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {279, 0x0, 0, 0}, {279, 0x0, 0, 0}, {279, 0x0, 0, 0},
+  {279, 0x0, 0, 0}, {279, 0x0, 0, 0}, {279, 0x0, 0, 0},
+  {5299, 0x3, 4, 1}, {5299, 0x3, 4, 1}, {279, 0x0, 0, 0},
+  {279, 0x0, 0, 0}, {5303, 0x3, 4, 1}, {279, 0x0, 0, 0},
+  {279, 0x0, 0, 0}, {279, 0x0, 0, 0}, {279, 0x0, 0, 0},
+  {279, 0x0, 0, 0}, {279, 0x0, 0, 0}, {279, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {279, 0x0, 0, 0},
+  {279, 0x0, 0, 0}, {279, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {280, 0x0, 0, 0}, {0, 0x0, 0, 0}, {281, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {278, 0x0, 0, 0}, {278, 0x0, 0, 0},
+  {5283, 0xf, 8, 1}, {5307, 0x2b, 0, 2}, {5309, 0x1, 5, 1},
+  {5309, 0x1, 5, 1}, {5283, 0xf, 8, 1}, {5283, 0xf, 8, 1},
+  {5307, 0x2b, 0, 2}, {5307, 0x2b, 0, 2}, {5283, 0xf, 8, 1},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {283, 0x0, 0, 0},
+  {283, 0x0, 0, 0}, {283, 0x0, 0, 0}, {283, 0x0, 0, 0},
+  {283, 0x0, 0, 0}, {283, 0x0, 0, 0}, {5343, 0x3, 4, 1},
+  {5343, 0x3, 4, 1}, {283, 0x0, 0, 0}, {283, 0x0, 0, 0},
+  {5347, 0x3, 4, 1}, {283, 0x0, 0, 0}, {283, 0x0, 0, 0},
+  {283, 0x0, 0, 0}, {283, 0x0, 0, 0}, {283, 0x0, 0, 0},
+  {283, 0x0, 0, 0}, {283, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {283, 0x0, 0, 0}, {283, 0x0, 0, 0},
+  {283, 0x0, 0, 0}, {0, 0x0, 0, 0}, {284, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {285, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {282, 0x0, 0, 0}, {282, 0x0, 0, 0}, {5327, 0xf, 8, 1},
+  {5351, 0x2b, 0, 2}, {5353, 0x1, 5, 1}, {5353, 0x1, 5, 1},
+  {5327, 0xf, 8, 1}, {5327, 0xf, 8, 1}, {5351, 0x2b, 0, 2},
+  {5351, 0x2b, 0, 2}, {5327, 0xf, 8, 1}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {5311, 0xf, 8, 1}, {5355, 0xf, 8, 1},
+  {5267, 0xf, 8, 1}, {5371, 0x1, 1, 1}, {5379, 0x3, 2, 1},
+  {5379, 0x3, 2, 1}, {5379, 0x3, 2, 1}, {0, 0x0, 0, 0},
+  {292, 0x0, 0, 0}, {292, 0x0, 0, 0}, {292, 0x0, 0, 0},
+  {5383, 0x1, 0, 1}, {292, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {290, 0x0, 0, 0}, {0, 0x0, 0, 0}, {291, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {5385, 0x2c, 0, 2}, {5387, 0x2c, 0, 2},
+  {5375, 0x3, 10, 1}, {5389, 0x1, 1, 1}, {5391, 0x28, 0, 2},
+  {0, 0x0, 0, 0}, {5399, 0x3, 2, 1}, {5399, 0x3, 2, 1},
+  {5399, 0x3, 2, 1}, {0, 0x0, 0, 0}, {295, 0x0, 0, 0},
+  {295, 0x0, 0, 0}, {295, 0x0, 0, 0}, {5403, 0x1, 0, 1},
+  {295, 0x0, 0, 0}, {0, 0x0, 0, 0}, {293, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {294, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {5405, 0x2c, 0, 2}, {5407, 0x2c, 0, 2}, {5395, 0x3, 10, 1},
+  {5409, 0x1, 1, 1}, {5411, 0x28, 0, 2}, {0, 0x0, 0, 0},
+  {5419, 0xf, 2, 1}, {5419, 0xf, 2, 1}, {5437, 0xf, 2, 1},
+  {0, 0x0, 0, 0}, {298, 0x0, 0, 0}, {298, 0x0, 0, 0},
+  {298, 0x0, 0, 0}, {5435, 0x1, 0, 1}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {298, 0x0, 0, 0}, {298, 0x0, 0, 0}, {298, 0x0, 0, 0},
+  {5435, 0x1, 0, 1}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {298, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {298, 0x0, 0, 0}, {298, 0x0, 0, 0},
+  {298, 0x0, 0, 0}, {5435, 0x1, 0, 1}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {5457, 0x3, 4, 1},
+  {5457, 0x3, 4, 1}, {5461, 0x3, 4, 1}, {0, 0x0, 0, 0},
+  {296, 0x0, 0, 0}, {0, 0x0, 0, 0}, {296, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {296, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {5469, 0x3, 4, 1},
+  {5469, 0x3, 4, 1}, {5473, 0x3, 4, 1}, {0, 0x0, 0, 0},
+  {297, 0x0, 0, 0}, {0, 0x0, 0, 0}, {297, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {297, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {5453, 0x3, 10, 1},
+  {5465, 0x3, 10, 1}, {5415, 0x3, 10, 1}, {5477, 0x1, 1, 1},
+  {5485, 0x3, 4, 1}, {5485, 0x3, 4, 1}, {5489, 0x3, 4, 1},
+  {0, 0x0, 0, 0}, {5479, 0x28, 0, 2}, {0, 0x0, 0, 0},
+  {5479, 0x28, 0, 2}, {0, 0x0, 0, 0}, {5479, 0x28, 0, 2},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {5497, 0x3, 2, 1}, {5497, 0x3, 2, 1}, {5497, 0x3, 2, 1},
+  {0, 0x0, 0, 0}, {301, 0x0, 0, 0}, {301, 0x0, 0, 0},
+  {301, 0x0, 0, 0}, {5501, 0x1, 0, 1}, {301, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {299, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {300, 0x0, 0, 0}, {0, 0x0, 0, 0}, {5503, 0x2c, 0, 2},
+  {5505, 0x2c, 0, 2}, {5493, 0x3, 10, 1}, {5507, 0x1, 1, 1},
+  {5509, 0x28, 0, 2}, {0, 0x0, 0, 0}, {5393, 0x2c, 0, 2},
+  {5413, 0x2c, 0, 2}, {5481, 0x3, 10, 1}, {5511, 0x2c, 0, 2},
+  {5373, 0x28, 0, 2}, {5513, 0x3, 8, 1}, {303, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {5519, 0x8, 0, 2}, {302, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {5521, 0x8, 0, 2}, {312, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {313, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {5527, 0x29, 0, 2}, {0, 0x0, 0, 0}, {5529, 0x2a, 0, 2},
+  {0, 0x0, 0, 0}, {5541, 0xf, 2, 1}, {5541, 0xf, 2, 1},
+  {5541, 0xf, 2, 1}, {5541, 0xf, 2, 1}, {5559, 0xf, 2, 1},
+  {5541, 0xf, 2, 1}, {5541, 0xf, 2, 1}, {5541, 0xf, 2, 1},
+  {314, 0x0, 0, 0}, {314, 0x0, 0, 0}, {314, 0x0, 0, 0},
+  {5557, 0x1, 0, 1}, {314, 0x0, 0, 0}, {314, 0x0, 0, 0},
+  {314, 0x0, 0, 0}, {5557, 0x1, 0, 1}, {314, 0x0, 0, 0},
+  {314, 0x0, 0, 0}, {314, 0x0, 0, 0}, {5557, 0x1, 0, 1},
+  {314, 0x0, 0, 0}, {314, 0x0, 0, 0}, {314, 0x0, 0, 0},
+  {5557, 0x1, 0, 1}, {314, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {314, 0x0, 0, 0}, {314, 0x0, 0, 0}, {314, 0x0, 0, 0},
+  {5557, 0x1, 0, 1}, {314, 0x0, 0, 0}, {314, 0x0, 0, 0},
+  {314, 0x0, 0, 0}, {5557, 0x1, 0, 1}, {314, 0x0, 0, 0},
+  {314, 0x0, 0, 0}, {314, 0x0, 0, 0}, {5557, 0x1, 0, 1},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {315, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {5525, 0x28, 0, 2}, {5525, 0x28, 0, 2}, {5531, 0x28, 0, 2},
+  {5533, 0x7, 9, 1}, {5575, 0x28, 0, 2}, {5575, 0x28, 0, 2},
+  {5531, 0x28, 0, 2}, {5531, 0x28, 0, 2}, {5533, 0x7, 9, 1},
+  {5533, 0x7, 9, 1}, {5531, 0x28, 0, 2}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {306, 0x0, 0, 0}, {306, 0x0, 0, 0},
+  {306, 0x0, 0, 0}, {306, 0x0, 0, 0}, {306, 0x0, 0, 0},
+  {306, 0x0, 0, 0}, {5609, 0x3, 4, 1}, {5609, 0x3, 4, 1},
+  {306, 0x0, 0, 0}, {306, 0x0, 0, 0}, {5613, 0x3, 4, 1},
+  {306, 0x0, 0, 0}, {306, 0x0, 0, 0}, {306, 0x0, 0, 0},
+  {306, 0x0, 0, 0}, {306, 0x0, 0, 0}, {306, 0x0, 0, 0},
+  {306, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {306, 0x0, 0, 0}, {306, 0x0, 0, 0}, {306, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {307, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {304, 0x0, 0, 0}, {304, 0x0, 0, 0}, {5593, 0xf, 8, 1},
+  {5617, 0x2b, 0, 2}, {305, 0x0, 0, 0}, {305, 0x0, 0, 0},
+  {5593, 0xf, 8, 1}, {5593, 0xf, 8, 1}, {5617, 0x2b, 0, 2},
+  {5617, 0x2b, 0, 2}, {5593, 0xf, 8, 1}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {310, 0x0, 0, 0}, {310, 0x0, 0, 0},
+  {310, 0x0, 0, 0}, {310, 0x0, 0, 0}, {310, 0x0, 0, 0},
+  {310, 0x0, 0, 0}, {5651, 0x3, 4, 1}, {5651, 0x3, 4, 1},
+  {310, 0x0, 0, 0}, {310, 0x0, 0, 0}, {5655, 0x3, 4, 1},
+  {310, 0x0, 0, 0}, {310, 0x0, 0, 0}, {310, 0x0, 0, 0},
+  {310, 0x0, 0, 0}, {310, 0x0, 0, 0}, {310, 0x0, 0, 0},
+  {310, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {310, 0x0, 0, 0}, {310, 0x0, 0, 0}, {310, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {311, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {308, 0x0, 0, 0}, {308, 0x0, 0, 0}, {5635, 0xf, 8, 1},
+  {5659, 0x2b, 0, 2}, {309, 0x0, 0, 0}, {309, 0x0, 0, 0},
+  {5635, 0xf, 8, 1}, {5635, 0xf, 8, 1}, {5659, 0x2b, 0, 2},
+  {5659, 0x2b, 0, 2}, {5635, 0xf, 8, 1}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {5619, 0xf, 8, 1}, {5661, 0xf, 8, 1},
+  {5577, 0xf, 8, 1}, {5677, 0x1, 1, 1}, {5685, 0x3, 2, 1},
+  {5685, 0x3, 2, 1}, {5685, 0x3, 2, 1}, {0, 0x0, 0, 0},
+  {321, 0x0, 0, 0}, {321, 0x0, 0, 0}, {321, 0x0, 0, 0},
+  {5689, 0x1, 0, 1}, {321, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {319, 0x0, 0, 0}, {0, 0x0, 0, 0}, {320, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {5691, 0x2c, 0, 2}, {5693, 0x2c, 0, 2},
+  {5681, 0x3, 10, 1}, {5695, 0x1, 1, 1}, {318, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {316, 0x0, 0, 0}, {317, 0x0, 0, 0},
+  {5699, 0x28, 0, 2}, {5701, 0x1, 1, 1}, {5697, 0x28, 0, 2},
+  {5703, 0x28, 0, 2}, {5711, 0x3, 2, 1}, {5711, 0x3, 2, 1},
+  {5711, 0x3, 2, 1}, {0, 0x0, 0, 0}, {327, 0x0, 0, 0},
+  {327, 0x0, 0, 0}, {327, 0x0, 0, 0}, {5715, 0x1, 0, 1},
+  {327, 0x0, 0, 0}, {0, 0x0, 0, 0}, {325, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {326, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {5717, 0x2c, 0, 2}, {5719, 0x2c, 0, 2}, {5707, 0x3, 10, 1},
+  {5721, 0x1, 1, 1}, {324, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {322, 0x0, 0, 0}, {323, 0x0, 0, 0}, {5725, 0x28, 0, 2},
+  {5727, 0x1, 1, 1}, {5723, 0x28, 0, 2}, {5729, 0x28, 0, 2},
+  {5737, 0x3, 2, 1}, {5737, 0x3, 2, 1}, {5737, 0x3, 2, 1},
+  {0, 0x0, 0, 0}, {333, 0x0, 0, 0}, {333, 0x0, 0, 0},
+  {333, 0x0, 0, 0}, {5741, 0x1, 0, 1}, {333, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {331, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {332, 0x0, 0, 0}, {0, 0x0, 0, 0}, {5743, 0x2c, 0, 2},
+  {5745, 0x2c, 0, 2}, {5733, 0x3, 10, 1}, {5747, 0x1, 1, 1},
+  {330, 0x0, 0, 0}, {0, 0x0, 0, 0}, {328, 0x0, 0, 0},
+  {329, 0x0, 0, 0}, {5751, 0x28, 0, 2}, {5753, 0x1, 1, 1},
+  {5755, 0x28, 0, 2}, {0, 0x0, 0, 0}, {5749, 0x28, 0, 2},
+  {5757, 0x1, 4, 1}, {5765, 0x3, 2, 1}, {5765, 0x3, 2, 1},
+  {5765, 0x3, 2, 1}, {0, 0x0, 0, 0}, {339, 0x0, 0, 0},
+  {339, 0x0, 0, 0}, {339, 0x0, 0, 0}, {5769, 0x1, 0, 1},
+  {339, 0x0, 0, 0}, {0, 0x0, 0, 0}, {337, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {338, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {5771, 0x2c, 0, 2}, {5773, 0x2c, 0, 2}, {5761, 0x3, 10, 1},
+  {5775, 0x1, 1, 1}, {336, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {334, 0x0, 0, 0}, {335, 0x0, 0, 0}, {5779, 0x28, 0, 2},
+  {5781, 0x1, 1, 1}, {5777, 0x28, 0, 2}, {5783, 0x28, 0, 2},
+  {5705, 0x2c, 0, 2}, {5731, 0x2c, 0, 2}, {5759, 0x2c, 0, 2},
+  {5785, 0x2c, 0, 2}, {5679, 0x28, 0, 2}, {5787, 0x3, 8, 1},
+  {341, 0x0, 0, 0}, {0, 0x0, 0, 0}, {342, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {5793, 0x8, 0, 2}, {5795, 0x8, 0, 2},
+  {5797, 0x1, 22, 1}, {340, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {5805, 0xf, 4, 1}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {343, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {344, 0x0, 0, 0}, {345, 0x0, 0, 0},
+  {346, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {5823, 0x3, 20, 1}, {5827, 0x3, 20, 1},
+  {5517, 0x1, 23, 1}, {5523, 0x1, 22, 1}, {5791, 0x1, 23, 1},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {5799, 0x8, 0, 2},
+  {0, 0x0, 0, 0}, {5801, 0x3, 22, 1}, {348, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {5831, 0x0, 0, 2}, {347, 0x0, 0, 0},
+  {350, 0x0, 0, 0}, {0, 0x0, 0, 0}, {5835, 0x0, 0, 2},
+  {349, 0x0, 0, 0}, {352, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {5839, 0x0, 0, 2}, {351, 0x0, 0, 0}, {5845, 0x7, 20, 1},
+  {5855, 0x7, 20, 1}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {5853, 0x1, 4, 1}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {5833, 0x0, 0, 2}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {5863, 0x1, 4, 1}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {5865, 0x1, 4, 1}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {5837, 0x0, 0, 2}, {0, 0x0, 0, 0},
+  {5841, 0x0, 0, 2}, {0, 0x0, 0, 0}, {5875, 0x1, 20, 1},
+  {5877, 0x1, 20, 1}, {5879, 0x1, 20, 1}, {5881, 0x1, 20, 1},
+  {5883, 0x1, 20, 1}, {5885, 0x1, 20, 1}, {5887, 0x1, 20, 1},
+  {5889, 0x1, 20, 1}, {0, 0x0, 0, 0}, {353, 0x0, 0, 0},
+  {354, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {355, 0x0, 0, 0}, {356, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {357, 0x0, 0, 0}, {358, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {359, 0x0, 0, 0},
+  {360, 0x0, 0, 0}, {0, 0x0, 0, 0}, {377, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {378, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {379, 0x0, 0, 0}, {0, 0x0, 0, 0}, {380, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {5891, 0x1, 7, 1}, {5893, 0x1, 7, 1}, {5895, 0x1, 7, 1},
+  {5897, 0x1, 7, 1}, {373, 0x0, 0, 0}, {374, 0x0, 0, 0},
+  {375, 0x0, 0, 0}, {376, 0x0, 0, 0}, {385, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {386, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {387, 0x0, 0, 0}, {0, 0x0, 0, 0}, {388, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {5915, 0x1, 7, 1}, {5917, 0x1, 7, 1}, {5919, 0x1, 7, 1},
+  {5921, 0x1, 7, 1}, {381, 0x0, 0, 0}, {382, 0x0, 0, 0},
+  {383, 0x0, 0, 0}, {384, 0x0, 0, 0}, {5943, 0x3, 20, 1},
+  {6043, 0x3, 20, 1}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {5947, 0xf, 8, 1}, {5971, 0xf, 8, 1}, {5995, 0xf, 8, 1},
+  {6019, 0xf, 8, 1}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {5963, 0x1, 6, 1},
+  {5967, 0x1, 6, 1}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {5965, 0x1, 4, 1},
+  {0, 0x0, 0, 0}, {361, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {5969, 0x1, 4, 1}, {0, 0x0, 0, 0}, {362, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {5987, 0x1, 6, 1},
+  {5991, 0x1, 6, 1}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {5989, 0x1, 4, 1},
+  {0, 0x0, 0, 0}, {363, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {5993, 0x1, 4, 1}, {0, 0x0, 0, 0}, {364, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {6011, 0x1, 6, 1},
+  {6015, 0x1, 6, 1}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {6013, 0x1, 4, 1},
+  {0, 0x0, 0, 0}, {365, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {6017, 0x1, 4, 1}, {0, 0x0, 0, 0}, {366, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {6035, 0x1, 6, 1},
+  {6039, 0x1, 6, 1}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {6037, 0x1, 4, 1},
+  {0, 0x0, 0, 0}, {367, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {6041, 0x1, 4, 1}, {0, 0x0, 0, 0}, {368, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {6047, 0xf, 8, 1}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {6075, 0xf, 8, 1}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {6063, 0x1, 6, 1}, {6069, 0x1, 6, 1}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {6065, 0x1, 4, 1}, {6067, 0x1, 4, 1}, {369, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {370, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {6071, 0x1, 4, 1}, {6073, 0x1, 4, 1}, {371, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {372, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {6091, 0x1, 6, 1}, {6095, 0x1, 6, 1},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {6093, 0x1, 4, 1},
+  {5899, 0xf, 16, 1}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {6097, 0x1, 4, 1}, {5923, 0xf, 16, 1}, {0, 0x0, 0, 0},
+  {3809, 0x1f, 20, 1}, {5203, 0x1, 23, 1}, {5821, 0x1, 24, 1},
+  {5843, 0x1, 24, 1}, {5867, 0x7, 22, 1}, {1, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {5939, 0x3, 23, 1}, {3785, 0x7, 25, 1},
+  {6099, 0x7, 25, 1},
+};
+
+// The {mask, value} pairs used by kTestEntry entries.
+static const DecodeTableTest kA32DecodeTableTests[] = {
+  {0x00000fe0, 0x00000060}, {0xf0000000, 0xf0000000}, {0x000f0000, 0x000d0000},
+  {0x00000f80, 0x00000000}, {0x00000060, 0x00000060}, {0x00000060, 0x00000020},
+  {0x00000060, 0x00000000}, {0x00000060, 0x00000040}, {0x000f0000, 0x000f0000},
+  {0x00000fff, 0x00000000}, {0x000d0000, 0x000d0000}, {0x004f0000, 0x00000000},
+  {0x008f0fff, 0x000d0004}, {0x008f0fff, 0x008d0004}, {0x0000f000, 0x0000f000},
+  {0x00100080, 0x00100000}, {0x0000000f, 0x0000000f}, {0xf0100080, 0xe0100080},
+  {0x006000d0, 0x00400010}, {0x0080f100, 0x00805000}, {0x0000f100, 0x00005000},
+  {0x00600000, 0x00000000}, {0x00600000, 0x00600000}, {0x000001c0, 0x00000000},
+  {0x0000001f, 0x00000000}, {0x000000d0, 0x00000000}, {0x00011001, 0x00000000},
+  {0x00010001, 0x00000000}, {0x00300000, 0x00300000}, {0x00011000, 0x00000000},
+  {0x01000200, 0x00000000}, {0x00001001, 0x00000000}, {0x000c0000, 0x00000000},
+  {0x000c0400, 0x00080000}, {0x000c0040, 0x00040000}, {0x00000380, 0x00000000},
+  {0x00380080, 0x00000000}, {0x00380000, 0x00000000}, {0x00070000, 0x00000000},
+  {0x00180000, 0x00000000}, {0x0000000d, 0x0000000d}, {0x00000f30, 0x00000a30},
+  {0x00000e20, 0x00000620}, {0x00000e30, 0x00000830}, {0x00000c00, 0x00000c00},
+};
+
+// The names of the T32 encodings, indexed by T32Encoding.
+static const char* const kT32EncodingNames[] = {
+  "unallocated",
+  "add_reg_t1",
+  "sub_reg_t1",
+  "add_imm_t1",
+  "sub_imm_t1",
+  "asr_imm_t2",
+  "lsr_imm_t2",
+  "mov_reg_t2",
+  "lsl_imm_t2",
+  "mov_imm_t1",
+  "cmp_imm_t1",
+  "add_imm_t2",
+  "sub_imm_t2",
+  "ldr_lit_t1",
+  "cmp_reg_t2",
+  "mov_reg_t1",
+  "and_reg_t1",
+  "eor_reg_t1",
+  "lsl_t1",
+  "lsr_t1",
+  "asr_t1",
+  "adc_reg_t1",
+  "sbc_reg_t1",
+  "ror_t1",
+  "tst_reg_t1",
+  "rsb_imm_t1",
+  "cmp_reg_t1",
+  "cmn_reg_t1",
+  "orr_reg_t1",
+  "mul_t1",
+  "bic_reg_t1",
+  "mvn_reg_t1",
+  "add_sp_t1",
+  "add_sp_reg_t2",
+  "add_reg_t2",
+  "bx_t1",
+  "blx_t1",
+  "str_reg_t1",
+  "strh_reg_t1",
+  "strb_reg_t1",
+  "ldrsb_reg_t1",
+  "ldr_reg_t1",
+  "ldrh_reg_t1",
+  "ldrb_reg_t1",
+  "ldrsh_reg_t1",
+  "str_imm_t1",
+  "ldr_imm_t1",
+  "strb_imm_t1",
+  "ldrb_imm_t1",
+  "strh_imm_t1",
+  "ldrh_imm_t1",
+  "str_sp_t2",
+  "ldr_sp_t2",
+  "adr_t1",
+  "add_sp_imm_t1",
+  "cbz_t1",
+  "add_sp_imm_t2",
+  "sub_sp_imm_t1",
+  "sxth_t1",
+  "sxtb_t1",
+  "uxth_t1",
+  "uxtb_t1",
+  "push_t1",
+  "setend_t1",
+  "cpsie_t1",
+  "cpsid_t1",
+  "cbnz_t1",
+  "rev_t1",
+  "rev16_t1",
+  "hlt_t1",
+  "revsh_t1",
+  "pop_t1",
+  "bkpt_t1",
+  "nop_t1",
+  "yield_t1",
+  "wfe_t1",
+  "wfi_t1",
+  "sev_t1",
+  "sevl_t1",
+  "it_t1",
+  "stm_t1",
+  "ldm_t1",
+  "udf_t1",
+  "svc_t1",
+  "b_t1",
+  "b_t2",
+  "and_imm_t1",
+  "bic_imm_t1",
+  "bics_t1",
+  "eor_imm_t1",
+  "adc_imm_t1",
+  "adcs_t1",
+  "sbc_imm_t1",
+  "sbcs_t1",
+  "rsb_t2",
+  "rsbs_t2",
+  "mov_imm_t3",
+  "movt_t1",
+  "ssat_lsl_t1",
+  "sbfx_t1",
+  "usat_lsl_t1",
+  "ubfx_t1",
+  "tst_imm_t1",
+  "ands_t1",
+  "mov_imm_t2",
+  "orr_imm_t1",
+  "movs_imm_t2",
+  "orrs_t1",
+  "mvn_imm_t1",
+  "orn_imm_t1",
+  "mvns_t1",
+  "orns_imm_t1",
+  "teq_imm_t1",
+  "eors_t1",
+  "add_sp_imm_t3",
+  "add_imm_t3",
+  "cmn_imm_t1",
+  "adds_sp_imm_t3",
+  "adds_imm_t3",
+  "sub_sp_t2",
+  "sub_t3",
+  "cmp_imm_t2",
+  "subs_sp_t2",
+  "subs_t3",
+  "add_sp_t4",
+  "adr_t3",
+  "add_t4",
+  "sub_sp_t3",
+  "sub_pc_t2",
+  "adr_t2",
+  "sub_t4",
+  "ssat16_t1",
+  "ssat_asr_t1",
+  "bfc_t1",
+  "bfi_t1",
+  "usat16_t1",
+  "usat_asr_t1",
+  "b_t4",
+  "bl_t1",
+  "msr_t1",
+  "msr_banked_t1",
+  "cpsie_t2",
+  "cpsid_t2",
+  "dbg_t1",
+  "nop_t2",
+  "yield_t2",
+  "wfe_t2",
+  "wfi_t2",
+  "sev_t2",
+  "sevl_t2",
+  "cps_t2",
+  "clrex_t1",
+  "dsb_t1",
+  "dmb_t1",
+  "isb_t1",
+  "bxj_t1",
+  "eret_t1",
+  "subs_t5",
+  "mrs_t1",
+  "mrs_banked_t1",
+  "dcps1_t1",
+  "dcps2_t1",
+  "dcps3_t1",
+  "hvc_t1",
+  "smc_t1",
+  "udf_t2",
+  "b_t3",
+  "blx_t2",
+  "srsdb_t1",
+  "stm_t2",
+  "strex_t1",
+  "strexb_t1",
+  "strexh_t1",
+  "strexd_t1",
+  "stlb_t1",
+  "stlh_t1",
+  "stl_t1",
+  "stlexb_t1",
+  "stlexh_t1",
+  "stlex_t1",
+  "stlexd_t1",
+  "strd_post_t1",
+  "push_t2",
+  "srsia_t2",
+  "strd_off_t1",
+  "strd_pre_t1",
+  "rfedb_t1",
+  "pop_t2",
+  "ldmdb_t1",
+  "rfeia_t2",
+  "ldrex_t1",
+  "tbb_t1",
+  "tbh_t1",
+  "ldrexb_t1",
+  "ldrexh_t1",
+  "ldrexd_t1",
+  "ldab_t1",
+  "ldah_t1",
+  "lda_t1",
+  "ldaexb_t1",
+  "ldaexh_t1",
+  "ldaex_t1",
+  "ldaexd_t1",
+  "ldrd_lit_t1",
+  "ldrd_imm_post_t1",
+  "ldrd_imm_off_t1",
+  "ldrd_imm_pre_t1",
+  "strb_reg_t2",
+  "strb_post_t3",
+  "strb_off_t3",
+  "strbt_t1",
+  "strb_pre_t3",
+  "str_t2",
+  "str_post_t4",
+  "str_off_t4",
+  "strt_t1",
+  "push_t4",
+  "str_pre_t4",
+  "strh_reg_t2",
+  "strh_post_t3",
+  "strh_off_t3",
+  "strht_t1",
+  "strh_pre_t3",
+  "strb_imm_t2",
+  "str_t3",
+  "strh_imm_t2",
+  "vst4_multi_wb_t1",
+  "vst1_multi_wb_t1",
+  "vst2_multi_wb_t1",
+  "vst3_multi_wb_t1",
+  "vst4_multi_off_t1",
+  "vst1_multi_off_t1",
+  "vst2_multi_off_t1",
+  "vst3_multi_off_t1",
+  "vst4_multi_post_t1",
+  "vst1_multi_post_t1",
+  "vst2_multi_post_t1",
+  "vst3_multi_post_t1",
+  "vld4_multi_wb_t1",
+  "vld3_multi_wb_t1",
+  "vld1_multi_wb_t1",
+  "vld2_multi_wb_t1",
+  "vld4_multi_off_t1",
+  "vld3_multi_off_t1",
+  "vld1_multi_off_t1",
+  "vld2_multi_off_t1",
+  "vld4_multi_post_t1",
+  "vld1_multi_post_t1",
+  "vld2_multi_post_t1",
+  "vld3_multi_post_t1",
+  "vst1_lane_wb_t1",
+  "vst1_lane_off_t1",
+  "vst1_lane_post_t1",
+  "vst2_lane_wb_t1",
+  "vst2_lane_off_t1",
+  "vst2_lane_post_t1",
+  "vst3_lane_wb_t1",
+  "vst3_lane_off_t1",
+  "vst3_lane_post_t1",
+  "vst4_lane_wb_t1",
+  "vst4_lane_off_t1",
+  "vst4_lane_post_t1",
+  "vld1_all_wb_t1",
+  "vld1_all_off_t1",
+  "vld1_all_post_t1",
+  "vld1_lane_wb_t1",
+  "vld1_lane_off_t1",
+  "vld1_lane_post_t1",
+  "vld2_all_wb_t1",
+  "vld2_all_off_t1",
+  "vld2_all_post_t1",
+  "vld2_lane_wb_t1",
+  "vld2_lane_off_t1",
+  "vld2_lane_post_t1",
+  "vld3_all_wb_t1",
+  "vld3_all_off_t1",
+  "vld3_all_post_t1",
+  "vld3_lane_wb_t1",
+  "vld3_lane_off_t1",
+  "vld3_lane_post_t1",
+  "vld4_all_wb_t1",
+  "vld4_all_off_t1",
+  "vld4_all_post_t1",
+  "vld4_lane_wb_t1",
+  "vld4_lane_off_t1",
+  "vld4_lane_post_t1",
+  "pld_lit_t1",
+  "ldrb_lit_t1",
+  "ldrh_lit_t1",
+  "pld_reg_t1",
+  "ldrb_reg_t2",
+  "ldrb_post_t3",
+  "pld_t2",
+  "ldrb_off_t3",
+  "ldrbt_t1",
+  "ldrb_pre_t3",
+  "pldw_reg_t1",
+  "ldrh_reg_t2",
+  "ldrh_post_t3",
+  "pldw_t2",
+  "ldrh_off_t3",
+  "ldrht_t1",
+  "ldrh_pre_t3",
+  "pld_imm_t1",
+  "ldrb_imm_t2",
+  "pldw_imm_t1",
+  "ldrh_imm_t2",
+  "ldr_lit_t2",
+  "ldr_reg_t2",
+  "pop_t4",
+  "ldr_post_t4",
+  "ldr_off_t4",
+  "ldrt_t1",
+  "ldr_pre_t4",
+  "ldr_t3",
+  "pli_t3",
+  "ldrsb_lit_t1",
+  "pli_reg_t1",
+  "ldrsb_reg_t2",
+  "ldrsb_imm_post_t2",
+  "pli_t2",
+  "ldrsb_imm_off_t2",
+  "ldrsbt_t1",
+  "ldrsb_imm_pre_t2",
+  "pli_imm_t1",
+  "ldrsb_imm_t1",
+  "ldrsh_lit_t1",
+  "ldrsh_reg_t2",
+  "ldrsh_imm_post_t2",
+  "ldrsh_imm_off_t2",
+  "ldrsht_t1",
+  "ldrsh_imm_pre_t2",
+  "ldrsh_imm_t1",
+  "and_rrx_t2",
+  "and_reg_t2",
+  "bic_rrx_t2",
+  "bic_reg_t2",
+  "rrx_t3",
+  "asr_t3",
+  "lsl_t3",
+  "lsr_t3",
+  "mov_reg_t3",
+  "ror_t3",
+  "orr_rrx_t2",
+  "orr_reg_t2",
+  "mvn_rrx_t2",
+  "mvn_reg_t2",
+  "orn_rrx_t1",
+  "orn_reg_t1",
+  "tst_rrx_t2",
+  "tst_reg_t2",
+  "ands_rrx_t2",
+  "ands_reg_t2",
+  "bics_rrx_t2",
+  "bics_reg_t2",
+  "rrxs_t3",
+  "asrs_t3",
+  "lsls_t3",
+  "lsrs_t3",
+  "movs_t3",
+  "rors_t3",
+  "orrs_rrx_t2",
+  "orrs_reg_t2",
+  "mvns_rrx_t2",
+  "mvns_reg_t2",
+  "orns_rrx_t1",
+  "orns_reg_t1",
+  "eor_rrx_t2",
+  "eor_reg_t2",
+  "pkhbt_t1",
+  "pkhtb_t1",
+  "teq_rrx_t1",
+  "teq_reg_t1",
+  "eors_rrx_t2",
+  "eors_reg_t2",
+  "add_sp_rrx_t3",
+  "add_sp_reg_t3",
+  "add_rrx_t3",
+  "add_reg_t3",
+  "adc_rrx_t2",
+  "adc_reg_t2",
+  "sbc_rrx_t2",
+  "sbc_reg_t2",
+  "cmn_rrx_t2",
+  "cmn_reg_t2",
+  "adds_sp_rrx_t3",
+  "adds_sp_reg_t3",
+  "adds_rrx_t3",
+  "adds_reg_t3",
+  "adcs_rrx_t2",
+  "adcs_reg_t2",
+  "sbcs_rrx_t2",
+  "sbcs_reg_t2",
+  "sub_sp_rrx_t1",
+  "sub_sp_reg_t1",
+  "sub_rrx_t2",
+  "sub_reg_t2",
+  "rsb_rrx_t1",
+  "rsb_reg_t1",
+  "cmp_rrx_t3",
+  "cmp_reg_t3",
+  "subs_rrx_t1",
+  "subs_reg_t1",
+  "subs_rrx_t2",
+  "subs_reg_t2",
+  "rsbs_rrx_t1",
+  "rsbs_reg_t1",
+  "asr_reg_t2",
+  "lsl_reg_t2",
+  "lsr_reg_t2",
+  "ror_t2",
+  "mov_rsr_t2",
+  "sxth_t2",
+  "sxtah_t1",
+  "sxtb16_t1",
+  "sxtab16_t1",
+  "sxtb_t2",
+  "sxtab_t1",
+  "asrs_t2",
+  "lsls_t2",
+  "lsrs_t2",
+  "rors_t2",
+  "movs_rsr_t2",
+  "uxth_t2",
+  "uxtah_t1",
+  "uxtb16_t1",
+  "uxtab16_t1",
+  "uxtb_t2",
+  "uxtab_t1",
+  "sadd8_t1",
+  "qadd8_t1",
+  "shadd8_t1",
+  "uadd8_t1",
+  "uqadd8_t1",
+  "uhadd8_t1",
+  "qadd_t1",
+  "qdadd_t1",
+  "qsub_t1",
+  "qdsub_t1",
+  "sasx_t1",
+  "qasx_t1",
+  "shasx_t1",
+  "uasx_t1",
+  "uqasx_t1",
+  "uhasx_t1",
+  "sel_t1",
+  "ssub8_t1",
+  "qsub8_t1",
+  "shsub8_t1",
+  "usub8_t1",
+  "uqsub8_t1",
+  "uhsub8_t1",
+  "crc32b_t1",
+  "crc32h_t1",
+  "crc32w_t1",
+  "ssax_t1",
+  "qsax_t1",
+  "shsax_t1",
+  "usax_t1",
+  "uqsax_t1",
+  "uhsax_t1",
+  "sadd16_t1",
+  "qadd16_t1",
+  "shadd16_t1",
+  "uadd16_t1",
+  "uqadd16_t1",
+  "uhadd16_t1",
+  "rev_t2",
+  "rev16_t2",
+  "rbit_t1",
+  "revsh_t2",
+  "clz_t1",
+  "ssub16_t1",
+  "qsub16_t1",
+  "shsub16_t1",
+  "usub16_t1",
+  "uqsub16_t1",
+  "uhsub16_t1",
+  "crc32cb_t1",
+  "crc32ch_t1",
+  "crc32cw_t1",
+  "mls_t1",
+  "smmls_t1",
+  "smmlsr_t1",
+  "mul_t2",
+  "mla_t1",
+  "smuad_t1",
+  "smlad_t1",
+  "smuadx_t1",
+  "smladx_t1",
+  "smusd_t1",
+  "smlsd_t1",
+  "smusdx_t1",
+  "smlsdx_t1",
+  "smulbb_t1",
+  "smlabb_t1",
+  "smulbt_t1",
+  "smlabt_t1",
+  "smultb_t1",
+  "smlatb_t1",
+  "smultt_t1",
+  "smlatt_t1",
+  "smulwb_t1",
+  "smlawb_t1",
+  "smulwt_t1",
+  "smlawt_t1",
+  "smmul_t1",
+  "smmla_t1",
+  "smmulr_t1",
+  "smmlar_t1",
+  "usad8_t1",
+  "usada8_t1",
+  "smull_t1",
+  "umull_t1",
+  "smlal_t1",
+  "smlalbb_t1",
+  "smlalbt_t1",
+  "smlaltb_t1",
+  "smlaltt_t1",
+  "smlald_t1",
+  "smlaldx_t1",
+  "umlal_t1",
+  "umaal_t1",
+  "sdiv_t1",
+  "udiv_t1",
+  "smlsld_t1",
+  "smlsldx_t1",
+  "vstm_t2",
+  "vmov_ss_rr_t1",
+  "vmov_d_rr_t1",
+  "vstm_t1",
+  "fstmiax_t1",
+  "stc_t1",
+  "mcrr_t1",
+  "vmov_rr_ss_t1",
+  "vmov_rr_d_t1",
+  "vpop_t2",
+  "vldm_t2",
+  "fldmiax_t1",
+  "vpop_t1",
+  "vldm_t1",
+  "ldc_imm_t1",
+  "mrrc_t1",
+  "vstr_t2",
+  "vstr_t1",
+  "vpush_t2",
+  "vstmdb_t2",
+  "fstmdbx_t1",
+  "vpush_t1",
+  "vstmdb_t1",
+  "vldr_lit_t2",
+  "vldr_imm_t2",
+  "vldr_lit_t1",
+  "vldr_imm_t1",
+  "vldmdb_t2",
+  "vldmdb_t1",
+  "fldmdbx_t1",
+  "ldc_lit_t1",
+  "vmla_f32_t2",
+  "vmls_f32_t2",
+  "vmla_f64_t2",
+  "vmls_f64_t2",
+  "vnmls_f32_t1",
+  "vnmla_f32_t1",
+  "vnmls_f64_t1",
+  "vnmla_f64_t1",
+  "vmul_f32_t2",
+  "vnmul_f32_t1",
+  "vmul_f64_t2",
+  "vnmul_f64_t1",
+  "vadd_f32_t2",
+  "vsub_f32_t2",
+  "vadd_f64_t2",
+  "vsub_f64_t2",
+  "vdiv_f32_t1",
+  "vdiv_f64_t1",
+  "vfnms_f32_t1",
+  "vfnma_f32_t1",
+  "vfnms_f64_t1",
+  "vfnma_f64_t1",
+  "vfma_f32_t2",
+  "vfms_f32_t2",
+  "vfma_f64_t2",
+  "vfms_f64_t2",
+  "vmov_imm_f32_t2",
+  "vmov_imm_f64_t2",
+  "vseleq_f32_t1",
+  "vseleq_f64_t1",
+  "vselvs_f32_t1",
+  "vselvs_f64_t1",
+  "vselge_f32_t1",
+  "vselge_f64_t1",
+  "vselgt_f32_t1",
+  "vselgt_f64_t1",
+  "vmaxnm_f32_t2",
+  "vminnm_f32_t2",
+  "vmaxnm_f64_t2",
+  "vminnm_f64_t2",
+  "vcvt_f32_fx_t1",
+  "vcvt_fx_f32_t1",
+  "vmov_f32_t2",
+  "vabs_f32_t2",
+  "vneg_f32_t2",
+  "vsqrt_f32_t1",
+  "vcvtb_f32_f16_t1",
+  "vcvtt_f32_f16_t1",
+  "vcvtb_f16_f32_t1",
+  "vcvtt_f16_f32_t1",
+  "vcmp_f32_t1",
+  "vcmpe_f32_t1",
+  "vcmp_f32_t2",
+  "vcmpe_f32_t2",
+  "vrintr_f32_t1",
+  "vrintz_f32_t1",
+  "vrintx_f32_t1",
+  "vcvt_f64_f32_t1",
+  "vcvt_f32_int_t1",
+  "vcvtr_u32_f32_t1",
+  "vcvt_u32_f32_t1",
+  "vcvtr_s32_f32_t1",
+  "vcvt_s32_f32_t1",
+  "vcvt_f64_fx_t1",
+  "vcvt_fx_f64_t1",
+  "vmov_f64_t2",
+  "vabs_f64_t2",
+  "vneg_f64_t2",
+  "vsqrt_f64_t1",
+  "vcvtb_f64_f16_t1",
+  "vcvtt_f64_f16_t1",
+  "vcvtb_f16_f64_t1",
+  "vcvtt_f16_f64_t1",
+  "vcmp_f64_t1",
+  "vcmpe_f64_t1",
+  "vcmp_f64_t2",
+  "vcmpe_f64_t2",
+  "vrintr_f64_t1",
+  "vrintz_f64_t1",
+  "vrintx_f64_t1",
+  "vcvt_f32_f64_t1",
+  "vcvt_f64_int_t1",
+  "vcvtr_u32_f64_t1",
+  "vcvt_u32_f64_t1",
+  "vcvtr_s32_f64_t1",
+  "vcvt_s32_f64_t1",
+  "vcvta_int_f32_s_t1",
+  "vcvtn_int_f32_s_t1",
+  "vcvtp_int_f32_s_t1",
+  "vcvtm_int_f32_s_t1",
+  "vrinta_f32_t1",
+  "vrintn_f32_t1",
+  "vrintp_f32_t1",
+  "vrintm_f32_t1",
+  "vcvta_int_f64_t1",
+  "vcvtn_int_f64_t1",
+  "vcvtp_int_f64_t1",
+  "vcvtm_int_f64_t1",
+  "vrinta_f64_t1",
+  "vrintn_f64_t1",
+  "vrintp_f64_t1",
+  "vrintm_f64_t1",
+  "mcr_t1",
+  "mrc_t1",
+  "vmov_scalar_r_t1",
+  "vmov_s_r_t1",
+  "vmsr_t1",
+  "vdup_d_t1",
+  "vdup_q_t1",
+  "vmov_r_scalar_t1",
+  "vmov_r_s_t1",
+  "vmrs_t1",
+  "vhadd_d_t1",
+  "vrhadd_d_t1",
+  "vhsub_d_t1",
+  "vcgt_d_t1",
+  "vshl_d_t1",
+  "vrshl_d_t1",
+  "vmax_d_t1",
+  "vabd_d_t1",
+  "vpmax_t1",
+  "vhadd_q_t1",
+  "vrhadd_q_t1",
+  "vhsub_q_t1",
+  "vcgt_q_t1",
+  "vshl_q_t1",
+  "vrshl_q_t1",
+  "vmax_q_t1",
+  "vabd_q_t1",
+  "vadd_d_t1",
+  "vsub_d_t1",
+  "vadd_q_t1",
+  "vsub_q_t1",
+  "vmla_d_t1",
+  "vmls_d_t1",
+  "vmla_q_t1",
+  "vmls_q_t1",
+  "vqdmulh_d_t1",
+  "vqrdmulh_d_t1",
+  "vqdmulh_q_t1",
+  "vqrdmulh_q_t1",
+  "sha1c_t1",
+  "sha1p_t1",
+  "sha1m_t1",
+  "sha1su0_t1",
+  "sha256h_t1",
+  "sha256h2_t1",
+  "sha256su1_t1",
+  "vadd_f32_d_t1",
+  "vsub_f32_d_t1",
+  "vpadd_f32_t1",
+  "vabd_f32_d_t1",
+  "vadd_f32_q_t1",
+  "vsub_f32_q_t1",
+  "vabd_f32_q_t1",
+  "vceq_d_t2",
+  "vcge_d_t2",
+  "vcgt_d_t2",
+  "vceq_q_t2",
+  "vcge_q_t2",
+  "vcgt_q_t2",
+  "vmax_f32_d_t1",
+  "vmin_f32_d_t1",
+  "vpmax_f32_t1",
+  "vpmin_f32_t1",
+  "vmax_f32_q_t1",
+  "vmin_f32_q_t1",
+  "vext_d_t1",
+  "vext_q_t1",
+  "vrev64_d_t1",
+  "vrev32_d_t1",
+  "vrev16_d_t1",
+  "vcls_d_t1",
+  "vclz_d_t1",
+  "vrev64_q_t1",
+  "vrev32_q_t1",
+  "vrev16_q_t1",
+  "vcls_q_t1",
+  "vclz_q_t1",
+  "vcnt_d_t1",
+  "vcnt_q_t1",
+  "vmvn_d_t1",
+  "vmvn_q_t1",
+  "vpaddl_d_t1",
+  "vpadal_d_t1",
+  "vpaddl_q_t1",
+  "vpadal_q_t1",
+  "aese_t1",
+  "aesmc_t1",
+  "aesd_t1",
+  "aesimc_t1",
+  "vqabs_d_t1",
+  "vqneg_d_t1",
+  "vqabs_q_t1",
+  "vqneg_q_t1",
+  "vcgt_imm_d_t1",
+  "vcge_imm_d_t1",
+  "vceq_imm_d_t1",
+  "vcle_d_t1",
+  "vcgt_imm_q_t1",
+  "vcge_imm_q_t1",
+  "vceq_imm_q_t1",
+  "vcle_q_t1",
+  "vclt_d_t1",
+  "vabs_d_t1",
+  "vneg_d_t1",
+  "vclt_q_t1",
+  "vabs_q_t1",
+  "vneg_q_t1",
+  "sha1h_t1",
+  "vtrn_d_t1",
+  "vuzp_d_t1",
+  "vzip_d_t1",
+  "vrintn_d_t1",
+  "vrintx_d_t1",
+  "vrinta_d_t1",
+  "vrintz_d_t1",
+  "vtrn_q_t1",
+  "vuzp_q_t1",
+  "vzip_q_t1",
+  "vrintn_q_t1",
+  "vrintx_q_t1",
+  "vrinta_q_t1",
+  "vrintz_q_t1",
+  "vswp_d_t1",
+  "vswp_q_t1",
+  "vqmovn_t1",
+  "vmovn_t1",
+  "vqmovun_t1",
+  "vshll_t2",
+  "sha1su1_t1",
+  "sha256su0_t1",
+  "vcvt_f16_f32_t1",
+  "vrintm_d_t1",
+  "vrintm_q_t1",
+  "vcvt_f32_f16_t1",
+  "vrintp_d_t1",
+  "vrintp_q_t1",
+  "vcvta_int_f32_d_t1",
+  "vcvtn_int_f32_d_t1",
+  "vcvta_int_f32_q_t1",
+  "vcvtn_int_f32_q_t1",
+  "vrecpe_d_t1",
+  "vrsqrte_d_t1",
+  "vrecpe_q_t1",
+  "vrsqrte_q_t1",
+  "vcvt_d_t1",
+  "vcvt_q_t1",
+  "vcvtp_int_f32_d_t1",
+  "vcvtm_int_f32_d_t1",
+  "vcvtp_int_f32_q_t1",
+  "vcvtm_int_f32_q_t1",
+  "vtbl_t1",
+  "vtbx_t1",
+  "vdup_scalar_d_t1",
+  "vdup_scalar_q_t1",
+  "vaddl_t1",
+  "vaddw_t1",
+  "vsubl_t1",
+  "vsubw_t1",
+  "vmla_scalar_d_t1",
+  "vmla_scalar_q_t1",
+  "vmlal_scalar_t1",
+  "vqdmlal_t2",
+  "vaddhn_t1",
+  "vraddhn_t1",
+  "vabal_t1",
+  "vsubhn_t1",
+  "vrsubhn_t1",
+  "vabdl_t1",
+  "vmls_scalar_d_t1",
+  "vmls_scalar_q_t1",
+  "vmlsl_scalar_t1",
+  "vqdmlsl_t2",
+  "vmlal_t1",
+  "vqdmlal_t1",
+  "vmlsl_t1",
+  "vqdmlsl_t1",
+  "vmul_scalar_d_t1",
+  "vmul_scalar_q_t1",
+  "vmull_scalar_t1",
+  "vqdmull_t2",
+  "vmull_t1",
+  "vqdmull_t1",
+  "vqdmulh_d_t2",
+  "vqrdmulh_d_t2",
+  "vqdmulh_q_t2",
+  "vqrdmulh_q_t2",
+  "vqadd_d_t1",
+  "vqsub_d_t1",
+  "vcge_d_t1",
+  "vqshl_d_t1",
+  "vqrshl_d_t1",
+  "vmin_d_t1",
+  "vaba_d_t1",
+  "vmul_d_t1",
+  "vpmin_t1",
+  "vand_d_t1",
+  "vbic_d_t1",
+  "vmov_d_t1",
+  "vorn_d_t1",
+  "veor_d_t1",
+  "vbsl_d_t1",
+  "vbit_d_t1",
+  "vbif_d_t1",
+  "vtst_d_t1",
+  "vceq_d_t1",
+  "vpadd_t1",
+  "vfma_d_t1",
+  "vfms_d_t1",
+  "vmla_f32_d_t1",
+  "vmls_f32_d_t1",
+  "vmul_f32_d_t1",
+  "vacge_d_t1",
+  "vacgt_d_t1",
+  "vrecps_d_t1",
+  "vrsqrts_d_t1",
+  "vmaxnm_d_t1",
+  "vminnm_d_t1",
+  "vqadd_q_t1",
+  "vqsub_q_t1",
+  "vcge_q_t1",
+  "vqshl_q_t1",
+  "vqrshl_q_t1",
+  "vmin_q_t1",
+  "vaba_q_t1",
+  "vmul_q_t1",
+  "vmov_q_t1",
+  "vand_q_t1",
+  "vbic_q_t1",
+  "vorn_q_t1",
+  "veor_q_t1",
+  "vbsl_q_t1",
+  "vbit_q_t1",
+  "vbif_q_t1",
+  "vtst_q_t1",
+  "vceq_q_t1",
+  "vfma_q_t1",
+  "vfms_q_t1",
+  "vmla_f32_q_t1",
+  "vmls_f32_q_t1",
+  "vmul_f32_q_t1",
+  "vacge_q_t1",
+  "vacgt_q_t1",
+  "vrecps_q_t1",
+  "vrsqrts_q_t1",
+  "vmaxnm_q_t1",
+  "vminnm_q_t1",
+  "vmvn_imm_d_t1",
+  "vmov_imm_d_t1",
+  "vorr_d_t1",
+  "vbic_imm_d_t1",
+  "vshr_d_t1",
+  "vsra_d_t1",
+  "vrshr_d_t1",
+  "vrsra_d_t1",
+  "vsri_d_t1",
+  "vshl_imm_d_t1",
+  "vsli_d_t1",
+  "vqshlu_d_t1",
+  "vqshl_imm_d_t1",
+  "vshrn_t1",
+  "vqshrun_t1",
+  "vqshrn_t1",
+  "vshll_t1",
+  "vmovl_t1",
+  "vcvt_fx_d_t1",
+  "vmvn_imm_q_t1",
+  "vmov_imm_q_t1",
+  "vorr_q_t1",
+  "vbic_imm_q_t1",
+  "vshr_q_t1",
+  "vsra_q_t1",
+  "vrshr_q_t1",
+  "vrsra_q_t1",
+  "vsri_q_t1",
+  "vshl_imm_q_t1",
+  "vsli_q_t1",
+  "vqshlu_q_t1",
+  "vqshl_imm_q_t1",
+  "vrshrn_t1",
+  "vqrshrun_t1",
+  "vqrshrn_t1",
+  "vcvt_fx_q_t1",
+};
+
+// The decode table, as {base, mask, shift, type}. See DecodeTableEntry.
+static const DecodeTableEntry kT32DecodeTable[] = {
+  {8901, 0x7, 29, 1}, {7, 0x0, 0, 0}, {8, 0x0, 0, 0},
+  {8, 0x0, 0, 0}, {8, 0x0, 0, 0}, {8, 0x0, 0, 0},
+  {8, 0x0, 0, 0}, {8, 0x0, 0, 0}, {8, 0x0, 0, 0},
+  {8, 0x0, 0, 0}, {8, 0x0, 0, 0}, {8, 0x0, 0, 0},
+  {8, 0x0, 0, 0}, {8, 0x0, 0, 0}, {8, 0x0, 0, 0},
+  {8, 0x0, 0, 0}, {8, 0x0, 0, 0}, {8, 0x0, 0, 0},
+  {8, 0x0, 0, 0}, {8, 0x0, 0, 0}, {8, 0x0, 0, 0},
+  {8, 0x0, 0, 0}, {8, 0x0, 0, 0}, {8, 0x0, 0, 0},
+  {8, 0x0, 0, 0}, {8, 0x0, 0, 0}, {8, 0x0, 0, 0},
+  {8, 0x0, 0, 0}, {8, 0x0, 0, 0}, {8, 0x0, 0, 0},
+  {8, 0x0, 0, 0}, {8, 0x0, 0, 0}, {8, 0x0, 0, 0},
+  {6, 0x0, 0, 0}, {6, 0x0, 0, 0}, {6, 0x0, 0, 0},
+  {6, 0x0, 0, 0}, {6, 0x0, 0, 0}, {6, 0x0, 0, 0},
+  {6, 0x0, 0, 0}, {6, 0x0, 0, 0}, {6, 0x0, 0, 0},
+  {6, 0x0, 0, 0}, {6, 0x0, 0, 0}, {6, 0x0, 0, 0},
+  {6, 0x0, 0, 0}, {6, 0x0, 0, 0}, {6, 0x0, 0, 0},
+  {6, 0x0, 0, 0}, {6, 0x0, 0, 0}, {6, 0x0, 0, 0},
+  {6, 0x0, 0, 0}, {6, 0x0, 0, 0}, {6, 0x0, 0, 0},
+  {6, 0x0, 0, 0}, {6, 0x0, 0, 0}, {6, 0x0, 0, 0},
+  {6, 0x0, 0, 0}, {6, 0x0, 0, 0}, {6, 0x0, 0, 0},
+  {6, 0x0, 0, 0}, {6, 0x0, 0, 0}, {6, 0x0, 0, 0},
+  {6, 0x0, 0, 0}, {6, 0x0, 0, 0}, {5, 0x0, 0, 0},
+  {5, 0x0, 0, 0}, {5, 0x0, 0, 0}, {5, 0x0, 0, 0},
+  {5, 0x0, 0, 0}, {5, 0x0, 0, 0}, {5, 0x0, 0, 0},
+  {5, 0x0, 0, 0}, {5, 0x0, 0, 0}, {5, 0x0, 0, 0},
+  {5, 0x0, 0, 0}, {5, 0x0, 0, 0}, {5, 0x0, 0, 0},
+  {5, 0x0, 0, 0}, {5, 0x0, 0, 0}, {5, 0x0, 0, 0},
+  {5, 0x0, 0, 0}, {5, 0x0, 0, 0}, {5, 0x0, 0, 0},
+  {5, 0x0, 0, 0}, {5, 0x0, 0, 0}, {5, 0x0, 0, 0},
+  {5, 0x0, 0, 0}, {5, 0x0, 0, 0}, {5, 0x0, 0, 0},
+  {5, 0x0, 0, 0}, {5, 0x0, 0, 0}, {5, 0x0, 0, 0},
+  {5, 0x0, 0, 0}, {5, 0x0, 0, 0}, {5, 0x0, 0, 0},
+  {5, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {1, 0x7f, 22, 1}, {0, 0x0, 0, 0}, {1, 0x0, 0, 0},
+  {2, 0x0, 0, 0}, {3, 0x0, 0, 0}, {4, 0x0, 0, 0},
+  {129, 0x0, 0, 2}, {131, 0x3, 25, 1}, {9, 0x0, 0, 0},
+  {10, 0x0, 0, 0}, {11, 0x0, 0, 0}, {12, 0x0, 0, 0},
+  {16, 0x0, 0, 0}, {17, 0x0, 0, 0}, {18, 0x0, 0, 0},
+  {19, 0x0, 0, 0}, {20, 0x0, 0, 0}, {21, 0x0, 0, 0},
+  {22, 0x0, 0, 0}, {23, 0x0, 0, 0}, {24, 0x0, 0, 0},
+  {25, 0x0, 0, 0}, {26, 0x0, 0, 0}, {27, 0x0, 0, 0},
+  {28, 0x0, 0, 0}, {29, 0x0, 0, 0}, {30, 0x0, 0, 0},
+  {31, 0x0, 0, 0}, {34, 0x0, 0, 0}, {34, 0x0, 0, 0},
+  {34, 0x0, 0, 0}, {34, 0x0, 0, 0}, {34, 0x0, 0, 0},
+  {34, 0x0, 0, 0}, {34, 0x0, 0, 0}, {34, 0x0, 0, 0},
+  {34, 0x0, 0, 0}, {34, 0x0, 0, 0}, {34, 0x0, 0, 0},
+  {34, 0x0, 0, 0}, {34, 0x0, 0, 0}, {34, 0x0, 0, 0},
+  {34, 0x0, 0, 0}, {34, 0x0, 0, 0}, {34, 0x0, 0, 0},
+  {34, 0x0, 0, 0}, {34, 0x0, 0, 0}, {34, 0x0, 0, 0},
+  {34, 0x0, 0, 0}, {34, 0x0, 0, 0}, {34, 0x0, 0, 0},
+  {34, 0x0, 0, 0}, {34, 0x0, 0, 0}, {34, 0x0, 0, 0},
+  {34, 0x0, 0, 0}, {34, 0x0, 0, 0}, {34, 0x0, 0, 0},
+  {34, 0x0, 0, 0}, {34, 0x0, 0, 0}, {34, 0x0, 0, 0},
+  {34, 0x0, 0, 0}, {34, 0x0, 0, 0}, {34, 0x0, 0, 0},
+  {34, 0x0, 0, 0}, {34, 0x0, 0, 0}, {34, 0x0, 0, 0},
+  {34, 0x0, 0, 0}, {34, 0x0, 0, 0}, {34, 0x0, 0, 0},
+  {34, 0x0, 0, 0}, {34, 0x0, 0, 0}, {34, 0x0, 0, 0},
+  {34, 0x0, 0, 0}, {34, 0x0, 0, 0}, {34, 0x0, 0, 0},
+  {34, 0x0, 0, 0}, {34, 0x0, 0, 0}, {34, 0x0, 0, 0},
+  {34, 0x0, 0, 0}, {34, 0x0, 0, 0}, {34, 0x0, 0, 0},
+  {34, 0x0, 0, 0}, {34, 0x0, 0, 0}, {34, 0x0, 0, 0},
+  {34, 0x0, 0, 0}, {34, 0x0, 0, 0}, {34, 0x0, 0, 0},
+  {34, 0x0, 0, 0}, {34, 0x0, 0, 0}, {34, 0x0, 0, 0},
+  {34, 0x0, 0, 0}, {34, 0x0, 0, 0}, {34, 0x0, 0, 0},
+  {34, 0x0, 0, 0}, {34, 0x0, 0, 0}, {34, 0x0, 0, 0},
+  {34, 0x0, 0, 0}, {34, 0x0, 0, 0}, {34, 0x0, 0, 0},
+  {34, 0x0, 0, 0}, {34, 0x0, 0, 0}, {34, 0x0, 0, 0},
+  {34, 0x0, 0, 0}, {34, 0x0, 0, 0}, {34, 0x0, 0, 0},
+  {34, 0x0, 0, 0}, {34, 0x0, 0, 0}, {34, 0x0, 0, 0},
+  {34, 0x0, 0, 0}, {34, 0x0, 0, 0}, {34, 0x0, 0, 0},
+  {34, 0x0, 0, 0}, {34, 0x0, 0, 0}, {34, 0x0, 0, 0},
+  {34, 0x0, 0, 0}, {34, 0x0, 0, 0}, {34, 0x0, 0, 0},
+  {34, 0x0, 0, 0}, {34, 0x0, 0, 0}, {34, 0x0, 0, 0},
+  {34, 0x0, 0, 0}, {34, 0x0, 0, 0}, {34, 0x0, 0, 0},
+  {34, 0x0, 0, 0}, {34, 0x0, 0, 0}, {34, 0x0, 0, 0},
+  {34, 0x0, 0, 0}, {34, 0x0, 0, 0}, {34, 0x0, 0, 0},
+  {34, 0x0, 0, 0}, {34, 0x0, 0, 0}, {34, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {34, 0x0, 0, 0},
+  {34, 0x0, 0, 0}, {34, 0x0, 0, 0}, {34, 0x0, 0, 0},
+  {34, 0x0, 0, 0}, {34, 0x0, 0, 0}, {34, 0x0, 0, 0},
+  {34, 0x0, 0, 0}, {34, 0x0, 0, 0}, {34, 0x0, 0, 0},
+  {34, 0x0, 0, 0}, {34, 0x0, 0, 0}, {34, 0x0, 0, 0},
+  {34, 0x0, 0, 0}, {34, 0x0, 0, 0}, {34, 0x0, 0, 0},
+  {34, 0x0, 0, 0}, {34, 0x0, 0, 0}, {34, 0x0, 0, 0},
+  {34, 0x0, 0, 0}, {34, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {34, 0x0, 0, 0}, {34, 0x0, 0, 0}, {34, 0x0, 0, 0},
+  {34, 0x0, 0, 0}, {34, 0x0, 0, 0}, {34, 0x0, 0, 0},
+  {34, 0x0, 0, 0}, {0, 0x0, 0, 0}, {34, 0x0, 0, 0},
+  {34, 0x0, 0, 0}, {34, 0x0, 0, 0}, {34, 0x0, 0, 0},
+  {34, 0x0, 0, 0}, {34, 0x0, 0, 0}, {34, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {34, 0x0, 0, 0}, {34, 0x0, 0, 0},
+  {34, 0x0, 0, 0}, {34, 0x0, 0, 0}, {34, 0x0, 0, 0},
+  {34, 0x0, 0, 0}, {34, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {34, 0x0, 0, 0}, {34, 0x0, 0, 0}, {34, 0x0, 0, 0},
+  {34, 0x0, 0, 0}, {34, 0x0, 0, 0}, {34, 0x0, 0, 0},
+  {34, 0x0, 0, 0}, {0, 0x0, 0, 0}, {34, 0x0, 0, 0},
+  {34, 0x0, 0, 0}, {34, 0x0, 0, 0}, {34, 0x0, 0, 0},
+  {34, 0x0, 0, 0}, {34, 0x0, 0, 0}, {34, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {34, 0x0, 0, 0}, {34, 0x0, 0, 0},
+  {34, 0x0, 0, 0}, {34, 0x0, 0, 0}, {34, 0x0, 0, 0},
+  {34, 0x0, 0, 0}, {34, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {34, 0x0, 0, 0}, {34, 0x0, 0, 0}, {34, 0x0, 0, 0},
+  {34, 0x0, 0, 0}, {34, 0x0, 0, 0}, {34, 0x0, 0, 0},
+  {34, 0x0, 0, 0}, {0, 0x0, 0, 0}, {34, 0x0, 0, 0},
+  {34, 0x0, 0, 0}, {34, 0x0, 0, 0}, {34, 0x0, 0, 0},
+  {34, 0x0, 0, 0}, {34, 0x0, 0, 0}, {34, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {34, 0x0, 0, 0}, {34, 0x0, 0, 0},
+  {34, 0x0, 0, 0}, {34, 0x0, 0, 0}, {34, 0x0, 0, 0},
+  {34, 0x0, 0, 0}, {34, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {34, 0x0, 0, 0}, {34, 0x0, 0, 0}, {34, 0x0, 0, 0},
+  {34, 0x0, 0, 0}, {34, 0x0, 0, 0}, {34, 0x0, 0, 0},
+  {34, 0x0, 0, 0}, {0, 0x0, 0, 0}, {34, 0x0, 0, 0},
+  {34, 0x0, 0, 0}, {34, 0x0, 0, 0}, {34, 0x0, 0, 0},
+  {34, 0x0, 0, 0}, {34, 0x0, 0, 0}, {34, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {34, 0x0, 0, 0}, {34, 0x0, 0, 0},
+  {34, 0x0, 0, 0}, {34, 0x0, 0, 0}, {34, 0x0, 0, 0},
+  {34, 0x0, 0, 0}, {34, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {34, 0x0, 0, 0}, {34, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {34, 0x0, 0, 0}, {34, 0x0, 0, 0},
+  {34, 0x0, 0, 0}, {34, 0x0, 0, 0}, {34, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {34, 0x0, 0, 0}, {34, 0x0, 0, 0},
+  {34, 0x0, 0, 0}, {34, 0x0, 0, 0}, {34, 0x0, 0, 0},
+  {34, 0x0, 0, 0}, {34, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {34, 0x0, 0, 0}, {34, 0x0, 0, 0}, {33, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {157, 0xff, 16, 1}, {413, 0x1, 0, 2},
+  {415, 0x2, 0, 2}, {32, 0x0, 0, 0}, {35, 0x0, 0, 0},
+  {36, 0x0, 0, 0}, {141, 0x3, 22, 1}, {145, 0x3, 22, 1},
+  {149, 0x3, 22, 1}, {153, 0x3, 22, 1}, {417, 0x1, 0, 2},
+  {14, 0x0, 0, 0}, {15, 0x0, 0, 0}, {419, 0x1, 23, 1},
+  {37, 0x0, 0, 0}, {38, 0x0, 0, 0}, {39, 0x0, 0, 0},
+  {40, 0x0, 0, 0}, {41, 0x0, 0, 0}, {42, 0x0, 0, 0},
+  {43, 0x0, 0, 0}, {44, 0x0, 0, 0}, {421, 0x7, 24, 1},
+  {13, 0x0, 0, 0}, {429, 0x3, 25, 1}, {433, 0x3, 25, 1},
+  {45, 0x0, 0, 0}, {46, 0x0, 0, 0}, {47, 0x0, 0, 0},
+  {48, 0x0, 0, 0}, {49, 0x0, 0, 0}, {50, 0x0, 0, 0},
+  {51, 0x0, 0, 0}, {52, 0x0, 0, 0}, {58, 0x0, 0, 0},
+  {59, 0x0, 0, 0}, {60, 0x0, 0, 0}, {61, 0x0, 0, 0},
+  {455, 0x1, 23, 1}, {457, 0x1, 23, 1}, {56, 0x0, 0, 0},
+  {57, 0x0, 0, 0}, {449, 0x1, 22, 1}, {451, 0x1, 22, 1},
+  {453, 0x1, 25, 1}, {55, 0x0, 0, 0}, {64, 0x0, 0, 0},
+  {65, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {63, 0x0, 0, 0}, {461, 0x1, 20, 1}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {62, 0x0, 0, 0},
+  {463, 0xf, 21, 1}, {459, 0x1, 24, 1}, {479, 0x1, 25, 1},
+  {0, 0x0, 0, 0}, {485, 0x3, 22, 1}, {67, 0x0, 0, 0},
+  {68, 0x0, 0, 0}, {69, 0x0, 0, 0}, {70, 0x0, 0, 0},
+  {483, 0x1, 25, 1}, {66, 0x0, 0, 0}, {79, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {73, 0x0, 0, 0}, {74, 0x0, 0, 0},
+  {75, 0x0, 0, 0}, {76, 0x0, 0, 0}, {77, 0x0, 0, 0},
+  {78, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {491, 0x3, 0, 2},
+  {493, 0xf, 20, 1}, {72, 0x0, 0, 0}, {509, 0x3, 0, 2},
+  {71, 0x0, 0, 0}, {511, 0x1, 24, 1}, {489, 0x1, 24, 1},
+  {513, 0x1, 25, 1}, {53, 0x0, 0, 0}, {54, 0x0, 0, 0},
+  {481, 0x1, 26, 1}, {515, 0x1, 26, 1}, {80, 0x0, 0, 0},
+  {81, 0x0, 0, 0}, {84, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {82, 0x0, 0, 0}, {83, 0x0, 0, 0}, {523, 0x4, 0, 2},
+  {525, 0x1, 24, 1}, {521, 0x1, 27, 1}, {527, 0x4, 0, 2},
+  {103, 0x0, 0, 0}, {0, 0x0, 0, 0}, {531, 0x5, 0, 2},
+  {102, 0x0, 0, 0}, {105, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {535, 0x6, 0, 2}, {104, 0x0, 0, 0}, {107, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {539, 0x6, 0, 2}, {106, 0x0, 0, 0},
+  {109, 0x0, 0, 0}, {0, 0x0, 0, 0}, {543, 0x6, 0, 2},
+  {108, 0x0, 0, 0}, {111, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {547, 0x6, 0, 2}, {110, 0x0, 0, 0}, {113, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {551, 0x5, 0, 2}, {112, 0x0, 0, 0},
+  {115, 0x0, 0, 0}, {0, 0x0, 0, 0}, {555, 0x7, 0, 2},
+  {114, 0x0, 0, 0}, {575, 0xf, 8, 1}, {575, 0xf, 8, 1},
+  {575, 0xf, 8, 1}, {575, 0xf, 8, 1}, {575, 0xf, 8, 1},
+  {575, 0xf, 8, 1}, {575, 0xf, 8, 1}, {575, 0xf, 8, 1},
+  {575, 0xf, 8, 1}, {575, 0xf, 8, 1}, {575, 0xf, 8, 1},
+  {575, 0xf, 8, 1}, {575, 0xf, 8, 1}, {0, 0x0, 0, 0},
+  {575, 0xf, 8, 1}, {575, 0xf, 8, 1}, {118, 0x0, 0, 0},
+  {118, 0x0, 0, 0}, {118, 0x0, 0, 0}, {118, 0x0, 0, 0},
+  {118, 0x0, 0, 0}, {118, 0x0, 0, 0}, {118, 0x0, 0, 0},
+  {118, 0x0, 0, 0}, {118, 0x0, 0, 0}, {118, 0x0, 0, 0},
+  {118, 0x0, 0, 0}, {118, 0x0, 0, 0}, {118, 0x0, 0, 0},
+  {118, 0x0, 0, 0}, {118, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {117, 0x0, 0, 0}, {0, 0x0, 0, 0}, {559, 0xf, 16, 1},
+  {591, 0x5, 0, 2}, {593, 0x7, 0, 2}, {116, 0x0, 0, 0},
+  {120, 0x0, 0, 0}, {0, 0x0, 0, 0}, {597, 0x7, 0, 2},
+  {119, 0x0, 0, 0}, {617, 0xf, 8, 1}, {617, 0xf, 8, 1},
+  {617, 0xf, 8, 1}, {617, 0xf, 8, 1}, {617, 0xf, 8, 1},
+  {617, 0xf, 8, 1}, {617, 0xf, 8, 1}, {617, 0xf, 8, 1},
+  {617, 0xf, 8, 1}, {617, 0xf, 8, 1}, {617, 0xf, 8, 1},
+  {617, 0xf, 8, 1}, {617, 0xf, 8, 1}, {0, 0x0, 0, 0},
+  {617, 0xf, 8, 1}, {617, 0xf, 8, 1}, {123, 0x0, 0, 0},
+  {123, 0x0, 0, 0}, {123, 0x0, 0, 0}, {123, 0x0, 0, 0},
+  {123, 0x0, 0, 0}, {123, 0x0, 0, 0}, {123, 0x0, 0, 0},
+  {123, 0x0, 0, 0}, {123, 0x0, 0, 0}, {123, 0x0, 0, 0},
+  {123, 0x0, 0, 0}, {123, 0x0, 0, 0}, {123, 0x0, 0, 0},
+  {123, 0x0, 0, 0}, {123, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {122, 0x0, 0, 0}, {0, 0x0, 0, 0}, {601, 0xf, 16, 1},
+  {633, 0x5, 0, 2}, {635, 0x7, 0, 2}, {121, 0x0, 0, 0},
+  {126, 0x0, 0, 0}, {0, 0x0, 0, 0}, {124, 0x0, 0, 0},
+  {125, 0x0, 0, 0}, {639, 0x8, 0, 2}, {641, 0x1, 17, 1},
+  {130, 0x0, 0, 0}, {0, 0x0, 0, 0}, {129, 0x0, 0, 0},
+  {128, 0x0, 0, 0}, {127, 0x0, 0, 0}, {647, 0x9, 0, 2},
+  {645, 0x8, 0, 2}, {649, 0x1, 17, 1}, {132, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {653, 0xa, 0, 2}, {131, 0x0, 0, 0},
+  {134, 0x0, 0, 0}, {0, 0x0, 0, 0}, {657, 0x6, 0, 2},
+  {133, 0x0, 0, 0}, {136, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {661, 0xa, 0, 2}, {135, 0x0, 0, 0}, {86, 0x0, 0, 0},
+  {533, 0x5, 0, 2}, {87, 0x0, 0, 0}, {88, 0x0, 0, 0},
+  {537, 0x6, 0, 2}, {541, 0x6, 0, 2}, {545, 0x6, 0, 2},
+  {549, 0x6, 0, 2}, {89, 0x0, 0, 0}, {553, 0x5, 0, 2},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {557, 0x7, 0, 2}, {595, 0x5, 0, 2}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {90, 0x0, 0, 0}, {91, 0x0, 0, 0},
+  {92, 0x0, 0, 0}, {93, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {599, 0x7, 0, 2}, {637, 0x5, 0, 2},
+  {94, 0x0, 0, 0}, {95, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {643, 0x8, 0, 2}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {96, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {651, 0x8, 0, 2},
+  {0, 0x0, 0, 0}, {97, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {98, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {655, 0xa, 0, 2}, {0, 0x0, 0, 0},
+  {99, 0x0, 0, 0}, {0, 0x0, 0, 0}, {659, 0x6, 0, 2},
+  {0, 0x0, 0, 0}, {100, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {663, 0xa, 0, 2}, {0, 0x0, 0, 0}, {101, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {166, 0x0, 0, 0}, {0, 0x0, 0, 0}, {139, 0x0, 0, 0},
+  {140, 0x0, 0, 0}, {144, 0x0, 0, 0}, {145, 0x0, 0, 0},
+  {146, 0x0, 0, 0}, {147, 0x0, 0, 0}, {148, 0x0, 0, 0},
+  {149, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {733, 0xf, 0, 1},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {143, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {150, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {141, 0x0, 0, 0}, {0, 0x0, 0, 0}, {142, 0x0, 0, 0},
+  {749, 0xf, 4, 1}, {765, 0xc, 0, 2}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {767, 0xd, 0, 2}, {141, 0x0, 0, 0},
+  {769, 0xd, 0, 2}, {142, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {151, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {152, 0x0, 0, 0}, {153, 0x0, 0, 0}, {154, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {771, 0x7, 8, 1}, {779, 0xf, 4, 1}, {157, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {156, 0x0, 0, 0},
+  {797, 0xe, 0, 2}, {799, 0xf, 0, 2}, {155, 0x0, 0, 0},
+  {801, 0xe, 0, 2}, {158, 0x0, 0, 0}, {159, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {811, 0x1, 13, 1}, {813, 0x3ff, 2, 1}, {0, 0x0, 0, 0},
+  {1837, 0x3, 0, 1}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {160, 0x0, 0, 0},
+  {161, 0x0, 0, 0}, {162, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {807, 0x3, 16, 1}, {1845, 0x1, 13, 1}, {1847, 0x1, 13, 1},
+  {163, 0x0, 0, 0}, {0, 0x0, 0, 0}, {164, 0x0, 0, 0},
+  {165, 0x0, 0, 0}, {1851, 0x3, 21, 1}, {1855, 0x3, 21, 1},
+  {731, 0x1, 5, 1}, {795, 0x1, 20, 1}, {803, 0x1, 20, 1},
+  {805, 0x1, 5, 1}, {1841, 0x10, 0, 2}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {1843, 0x1, 20, 1}, {729, 0xb, 0, 2},
+  {1849, 0x1, 26, 1}, {167, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {1865, 0x1, 12, 1}, {1867, 0x1, 12, 1}, {1859, 0xb, 0, 2},
+  {137, 0x0, 0, 0}, {1861, 0x1, 0, 1}, {138, 0x0, 0, 0},
+  {665, 0x3f, 20, 1}, {1863, 0x1, 14, 1}, {85, 0x0, 0, 0},
+  {1869, 0x1, 15, 1}, {168, 0x0, 0, 0}, {169, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {171, 0x0, 0, 0}, {172, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {173, 0x0, 0, 0}, {174, 0x0, 0, 0},
+  {175, 0x0, 0, 0}, {176, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {177, 0x0, 0, 0}, {178, 0x0, 0, 0}, {179, 0x0, 0, 0},
+  {180, 0x0, 0, 0}, {170, 0x0, 0, 0}, {1875, 0xf, 4, 1},
+  {181, 0x0, 0, 0}, {0, 0x0, 0, 0}, {1891, 0x1, 23, 1},
+  {1893, 0x6, 0, 2}, {182, 0x0, 0, 0}, {183, 0x0, 0, 0},
+  {184, 0x0, 0, 0}, {0, 0x0, 0, 0}, {185, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {1899, 0x6, 0, 2}, {1901, 0x6, 0, 2},
+  {1907, 0x1, 22, 1}, {1909, 0x1, 22, 1}, {1873, 0x1, 23, 1},
+  {1895, 0x1, 21, 1}, {1897, 0x1, 23, 1}, {1903, 0x1, 21, 1},
+  {186, 0x0, 0, 0}, {187, 0x0, 0, 0}, {188, 0x0, 0, 0},
+  {189, 0x0, 0, 0}, {191, 0x0, 0, 0}, {192, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {193, 0x0, 0, 0},
+  {194, 0x0, 0, 0}, {0, 0x0, 0, 0}, {195, 0x0, 0, 0},
+  {196, 0x0, 0, 0}, {197, 0x0, 0, 0}, {198, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {199, 0x0, 0, 0}, {200, 0x0, 0, 0},
+  {201, 0x0, 0, 0}, {202, 0x0, 0, 0}, {190, 0x0, 0, 0},
+  {1915, 0xf, 4, 1}, {204, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {203, 0x0, 0, 0}, {0, 0x0, 0, 0}, {1933, 0x6, 0, 2},
+  {1935, 0x11, 0, 2}, {205, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {1939, 0x6, 0, 2}, {1935, 0x11, 0, 2}, {206, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {1943, 0x6, 0, 2}, {1935, 0x11, 0, 2},
+  {1949, 0x1, 21, 1}, {1951, 0x1, 21, 1}, {1931, 0x1, 23, 1},
+  {1937, 0x6, 0, 2}, {1941, 0x6, 0, 2}, {1945, 0x6, 0, 2},
+  {1911, 0x3, 23, 1}, {1947, 0x1, 24, 1}, {207, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {1955, 0x6, 0, 2},
+  {208, 0x0, 0, 0}, {0, 0x0, 0, 0}, {209, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {210, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {1961, 0x6, 0, 2}, {1963, 0x6, 0, 2}, {211, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {212, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {1969, 0x6, 0, 2}, {213, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {214, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {215, 0x0, 0, 0}, {0, 0x0, 0, 0}, {1975, 0x6, 0, 2},
+  {1977, 0x6, 0, 2}, {217, 0x0, 0, 0}, {216, 0x0, 0, 0},
+  {1981, 0x13, 0, 2}, {0, 0x0, 0, 0}, {1987, 0x3, 10, 1},
+  {1997, 0x3, 10, 1}, {1991, 0x1, 8, 1}, {0, 0x0, 0, 0},
+  {1993, 0x1, 8, 1}, {1995, 0x1, 8, 1}, {1957, 0x12, 0, 2},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {1959, 0x6, 0, 2},
+  {1965, 0x1, 9, 1}, {1967, 0x6, 0, 2}, {2001, 0x1, 8, 1},
+  {0, 0x0, 0, 0}, {2003, 0x1, 8, 1}, {2005, 0x1, 8, 1},
+  {1971, 0x12, 0, 2}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {1973, 0x6, 0, 2}, {1979, 0x1, 9, 1}, {1983, 0x6, 0, 2},
+  {218, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {2007, 0x6, 0, 2}, {219, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {220, 0x0, 0, 0}, {0, 0x0, 0, 0}, {221, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {2013, 0x6, 0, 2}, {2015, 0x6, 0, 2},
+  {222, 0x0, 0, 0}, {0, 0x0, 0, 0}, {2023, 0x3, 10, 1},
+  {0, 0x0, 0, 0}, {2027, 0x1, 8, 1}, {0, 0x0, 0, 0},
+  {2029, 0x1, 8, 1}, {2031, 0x1, 8, 1}, {2009, 0x12, 0, 2},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {2011, 0x6, 0, 2},
+  {2017, 0x1, 9, 1}, {2019, 0x6, 0, 2}, {223, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {224, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {2033, 0x6, 0, 2}, {2035, 0x6, 0, 2}, {225, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {2039, 0x6, 0, 2}, {0, 0x0, 0, 0},
+  {234, 0x0, 0, 0}, {0, 0x0, 0, 0}, {235, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {2045, 0x15, 0, 2}, {0, 0x0, 0, 0},
+  {2047, 0x16, 0, 2}, {0, 0x0, 0, 0}, {2059, 0xf, 2, 1},
+  {2059, 0xf, 2, 1}, {2059, 0xf, 2, 1}, {2059, 0xf, 2, 1},
+  {2077, 0xf, 2, 1}, {2059, 0xf, 2, 1}, {2059, 0xf, 2, 1},
+  {2059, 0xf, 2, 1}, {236, 0x0, 0, 0}, {236, 0x0, 0, 0},
+  {236, 0x0, 0, 0}, {2075, 0x1, 0, 1}, {236, 0x0, 0, 0},
+  {236, 0x0, 0, 0}, {236, 0x0, 0, 0}, {2075, 0x1, 0, 1},
+  {236, 0x0, 0, 0}, {236, 0x0, 0, 0}, {236, 0x0, 0, 0},
+  {2075, 0x1, 0, 1}, {236, 0x0, 0, 0}, {236, 0x0, 0, 0},
+  {236, 0x0, 0, 0}, {2075, 0x1, 0, 1}, {236, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {236, 0x0, 0, 0}, {236, 0x0, 0, 0},
+  {236, 0x0, 0, 0}, {2075, 0x1, 0, 1}, {236, 0x0, 0, 0},
+  {236, 0x0, 0, 0}, {236, 0x0, 0, 0}, {2075, 0x1, 0, 1},
+  {236, 0x0, 0, 0}, {236, 0x0, 0, 0}, {236, 0x0, 0, 0},
+  {2075, 0x1, 0, 1}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {2095, 0x3, 2, 1},
+  {0, 0x0, 0, 0}, {237, 0x0, 0, 0}, {237, 0x0, 0, 0},
+  {237, 0x0, 0, 0}, {2099, 0x1, 0, 1}, {237, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {2043, 0x14, 0, 2}, {2043, 0x14, 0, 2},
+  {2049, 0x14, 0, 2}, {2051, 0x7, 9, 1}, {2093, 0x1, 5, 1},
+  {2093, 0x1, 5, 1}, {2049, 0x14, 0, 2}, {2049, 0x14, 0, 2},
+  {2051, 0x7, 9, 1}, {2051, 0x7, 9, 1}, {2049, 0x14, 0, 2},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {227, 0x0, 0, 0},
+  {227, 0x0, 0, 0}, {227, 0x0, 0, 0}, {227, 0x0, 0, 0},
+  {227, 0x0, 0, 0}, {227, 0x0, 0, 0}, {2133, 0x3, 4, 1},
+  {2133, 0x3, 4, 1}, {227, 0x0, 0, 0}, {227, 0x0, 0, 0},
+  {2137, 0x3, 4, 1}, {227, 0x0, 0, 0}, {227, 0x0, 0, 0},
+  {227, 0x0, 0, 0}, {227, 0x0, 0, 0}, {227, 0x0, 0, 0},
+  {227, 0x0, 0, 0}, {227, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {227, 0x0, 0, 0}, {227, 0x0, 0, 0},
+  {227, 0x0, 0, 0}, {0, 0x0, 0, 0}, {228, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {229, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {226, 0x0, 0, 0}, {226, 0x0, 0, 0}, {2117, 0xf, 8, 1},
+  {2141, 0x17, 0, 2}, {2143, 0x1, 5, 1}, {2143, 0x1, 5, 1},
+  {2117, 0xf, 8, 1}, {2117, 0xf, 8, 1}, {2141, 0x17, 0, 2},
+  {2141, 0x17, 0, 2}, {2117, 0xf, 8, 1}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {231, 0x0, 0, 0}, {231, 0x0, 0, 0},
+  {231, 0x0, 0, 0}, {231, 0x0, 0, 0}, {231, 0x0, 0, 0},
+  {231, 0x0, 0, 0}, {2177, 0x3, 4, 1}, {2177, 0x3, 4, 1},
+  {231, 0x0, 0, 0}, {231, 0x0, 0, 0}, {2181, 0x3, 4, 1},
+  {231, 0x0, 0, 0}, {231, 0x0, 0, 0}, {231, 0x0, 0, 0},
+  {231, 0x0, 0, 0}, {231, 0x0, 0, 0}, {231, 0x0, 0, 0},
+  {231, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {231, 0x0, 0, 0}, {231, 0x0, 0, 0}, {231, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {232, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {233, 0x0, 0, 0}, {0, 0x0, 0, 0}, {230, 0x0, 0, 0},
+  {230, 0x0, 0, 0}, {2161, 0xf, 8, 1}, {2185, 0x17, 0, 2},
+  {2187, 0x1, 5, 1}, {2187, 0x1, 5, 1}, {2161, 0xf, 8, 1},
+  {2161, 0xf, 8, 1}, {2185, 0x17, 0, 2}, {2185, 0x17, 0, 2},
+  {2161, 0xf, 8, 1}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {2145, 0xf, 8, 1}, {2189, 0xf, 8, 1}, {2101, 0xf, 8, 1},
+  {2205, 0x1, 1, 1}, {246, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {247, 0x0, 0, 0}, {0, 0x0, 0, 0}, {2211, 0x15, 0, 2},
+  {0, 0x0, 0, 0}, {2213, 0x16, 0, 2}, {0, 0x0, 0, 0},
+  {2225, 0xf, 2, 1}, {2225, 0xf, 2, 1}, {2225, 0xf, 2, 1},
+  {2225, 0xf, 2, 1}, {2243, 0xf, 2, 1}, {2225, 0xf, 2, 1},
+  {2225, 0xf, 2, 1}, {2225, 0xf, 2, 1}, {248, 0x0, 0, 0},
+  {248, 0x0, 0, 0}, {248, 0x0, 0, 0}, {2241, 0x1, 0, 1},
+  {248, 0x0, 0, 0}, {248, 0x0, 0, 0}, {248, 0x0, 0, 0},
+  {2241, 0x1, 0, 1}, {248, 0x0, 0, 0}, {248, 0x0, 0, 0},
+  {248, 0x0, 0, 0}, {2241, 0x1, 0, 1}, {248, 0x0, 0, 0},
+  {248, 0x0, 0, 0}, {248, 0x0, 0, 0}, {2241, 0x1, 0, 1},
+  {248, 0x0, 0, 0}, {0, 0x0, 0, 0}, {248, 0x0, 0, 0},
+  {248, 0x0, 0, 0}, {248, 0x0, 0, 0}, {2241, 0x1, 0, 1},
+  {248, 0x0, 0, 0}, {248, 0x0, 0, 0}, {248, 0x0, 0, 0},
+  {2241, 0x1, 0, 1}, {248, 0x0, 0, 0}, {248, 0x0, 0, 0},
+  {248, 0x0, 0, 0}, {2241, 0x1, 0, 1}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {249, 0x0, 0, 0}, {0, 0x0, 0, 0}, {2209, 0x14, 0, 2},
+  {2209, 0x14, 0, 2}, {2215, 0x14, 0, 2}, {2217, 0x7, 9, 1},
+  {2259, 0x14, 0, 2}, {2259, 0x14, 0, 2}, {2215, 0x14, 0, 2},
+  {2215, 0x14, 0, 2}, {2217, 0x7, 9, 1}, {2217, 0x7, 9, 1},
+  {2215, 0x14, 0, 2}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {240, 0x0, 0, 0}, {240, 0x0, 0, 0}, {240, 0x0, 0, 0},
+  {240, 0x0, 0, 0}, {240, 0x0, 0, 0}, {240, 0x0, 0, 0},
+  {2293, 0x3, 4, 1}, {2293, 0x3, 4, 1}, {240, 0x0, 0, 0},
+  {240, 0x0, 0, 0}, {2297, 0x3, 4, 1}, {240, 0x0, 0, 0},
+  {240, 0x0, 0, 0}, {240, 0x0, 0, 0}, {240, 0x0, 0, 0},
+  {240, 0x0, 0, 0}, {240, 0x0, 0, 0}, {240, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {240, 0x0, 0, 0},
+  {240, 0x0, 0, 0}, {240, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {241, 0x0, 0, 0}, {0, 0x0, 0, 0}, {238, 0x0, 0, 0},
+  {238, 0x0, 0, 0}, {2277, 0xf, 8, 1}, {2301, 0x17, 0, 2},
+  {239, 0x0, 0, 0}, {239, 0x0, 0, 0}, {2277, 0xf, 8, 1},
+  {2277, 0xf, 8, 1}, {2301, 0x17, 0, 2}, {2301, 0x17, 0, 2},
+  {2277, 0xf, 8, 1}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {244, 0x0, 0, 0}, {244, 0x0, 0, 0}, {244, 0x0, 0, 0},
+  {244, 0x0, 0, 0}, {244, 0x0, 0, 0}, {244, 0x0, 0, 0},
+  {2335, 0x3, 4, 1}, {2335, 0x3, 4, 1}, {244, 0x0, 0, 0},
+  {244, 0x0, 0, 0}, {2339, 0x3, 4, 1}, {244, 0x0, 0, 0},
+  {244, 0x0, 0, 0}, {244, 0x0, 0, 0}, {244, 0x0, 0, 0},
+  {244, 0x0, 0, 0}, {244, 0x0, 0, 0}, {244, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {244, 0x0, 0, 0},
+  {244, 0x0, 0, 0}, {244, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {245, 0x0, 0, 0}, {0, 0x0, 0, 0}, {242, 0x0, 0, 0},
+  {242, 0x0, 0, 0}, {2319, 0xf, 8, 1}, {2343, 0x17, 0, 2},
+  {243, 0x0, 0, 0}, {243, 0x0, 0, 0}, {2319, 0xf, 8, 1},
+  {2319, 0xf, 8, 1}, {2343, 0x17, 0, 2}, {2343, 0x17, 0, 2},
+  {2319, 0xf, 8, 1}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {2303, 0xf, 8, 1}, {2345, 0xf, 8, 1}, {2261, 0xf, 8, 1},
+  {2361, 0x1, 1, 1}, {2369, 0x3, 2, 1}, {2369, 0x3, 2, 1},
+  {2369, 0x3, 2, 1}, {0, 0x0, 0, 0}, {252, 0x0, 0, 0},
+  {252, 0x0, 0, 0}, {252, 0x0, 0, 0}, {2373, 0x1, 0, 1},
+  {252, 0x0, 0, 0}, {0, 0x0, 0, 0}, {250, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {251, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {2375, 0x18, 0, 2}, {2377, 0x18, 0, 2}, {2365, 0x3, 10, 1},
+  {2379, 0x1, 1, 1}, {2381, 0x14, 0, 2}, {0, 0x0, 0, 0},
+  {2389, 0x3, 2, 1}, {2389, 0x3, 2, 1}, {2389, 0x3, 2, 1},
+  {0, 0x0, 0, 0}, {255, 0x0, 0, 0}, {255, 0x0, 0, 0},
+  {255, 0x0, 0, 0}, {2393, 0x1, 0, 1}, {255, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {253, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {254, 0x0, 0, 0}, {0, 0x0, 0, 0}, {2395, 0x18, 0, 2},
+  {2397, 0x18, 0, 2}, {2385, 0x3, 10, 1}, {2399, 0x1, 1, 1},
+  {2401, 0x14, 0, 2}, {0, 0x0, 0, 0}, {2409, 0xf, 2, 1},
+  {2409, 0xf, 2, 1}, {2427, 0xf, 2, 1}, {0, 0x0, 0, 0},
+  {258, 0x0, 0, 0}, {258, 0x0, 0, 0}, {258, 0x0, 0, 0},
+  {2425, 0x1, 0, 1}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {258, 0x0, 0, 0},
+  {258, 0x0, 0, 0}, {258, 0x0, 0, 0}, {2425, 0x1, 0, 1},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {258, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {258, 0x0, 0, 0}, {258, 0x0, 0, 0}, {258, 0x0, 0, 0},
+  {2425, 0x1, 0, 1}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {2447, 0x3, 4, 1}, {2447, 0x3, 4, 1},
+  {2451, 0x3, 4, 1}, {0, 0x0, 0, 0}, {256, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {256, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {256, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {2459, 0x3, 4, 1}, {2459, 0x3, 4, 1},
+  {2463, 0x3, 4, 1}, {0, 0x0, 0, 0}, {257, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {257, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {257, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {2443, 0x3, 10, 1}, {2455, 0x3, 10, 1},
+  {2405, 0x3, 10, 1}, {2467, 0x1, 1, 1}, {2475, 0x3, 4, 1},
+  {2475, 0x3, 4, 1}, {2479, 0x3, 4, 1}, {0, 0x0, 0, 0},
+  {2469, 0x14, 0, 2}, {0, 0x0, 0, 0}, {2469, 0x14, 0, 2},
+  {0, 0x0, 0, 0}, {2469, 0x14, 0, 2}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {2487, 0x3, 2, 1},
+  {2487, 0x3, 2, 1}, {2487, 0x3, 2, 1}, {0, 0x0, 0, 0},
+  {261, 0x0, 0, 0}, {261, 0x0, 0, 0}, {261, 0x0, 0, 0},
+  {2491, 0x1, 0, 1}, {261, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {259, 0x0, 0, 0}, {0, 0x0, 0, 0}, {260, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {2493, 0x18, 0, 2}, {2495, 0x18, 0, 2},
+  {2483, 0x3, 10, 1}, {2497, 0x1, 1, 1}, {2499, 0x14, 0, 2},
+  {0, 0x0, 0, 0}, {2383, 0x18, 0, 2}, {2403, 0x18, 0, 2},
+  {2471, 0x3, 10, 1}, {2501, 0x18, 0, 2}, {2511, 0x3, 2, 1},
+  {2511, 0x3, 2, 1}, {2511, 0x3, 2, 1}, {0, 0x0, 0, 0},
+  {267, 0x0, 0, 0}, {267, 0x0, 0, 0}, {267, 0x0, 0, 0},
+  {2515, 0x1, 0, 1}, {267, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {265, 0x0, 0, 0}, {0, 0x0, 0, 0}, {266, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {2517, 0x18, 0, 2}, {2519, 0x18, 0, 2},
+  {2507, 0x3, 10, 1}, {2521, 0x1, 1, 1}, {264, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {262, 0x0, 0, 0}, {263, 0x0, 0, 0},
+  {2525, 0x14, 0, 2}, {2527, 0x1, 1, 1}, {2523, 0x14, 0, 2},
+  {2529, 0x14, 0, 2}, {2537, 0x3, 2, 1}, {2537, 0x3, 2, 1},
+  {2537, 0x3, 2, 1}, {0, 0x0, 0, 0}, {273, 0x0, 0, 0},
+  {273, 0x0, 0, 0}, {273, 0x0, 0, 0}, {2541, 0x1, 0, 1},
+  {273, 0x0, 0, 0}, {0, 0x0, 0, 0}, {271, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {272, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {2543, 0x18, 0, 2}, {2545, 0x18, 0, 2}, {2533, 0x3, 10, 1},
+  {2547, 0x1, 1, 1}, {270, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {268, 0x0, 0, 0}, {269, 0x0, 0, 0}, {2551, 0x14, 0, 2},
+  {2553, 0x1, 1, 1}, {2549, 0x14, 0, 2}, {2555, 0x14, 0, 2},
+  {2563, 0x3, 2, 1}, {2563, 0x3, 2, 1}, {2563, 0x3, 2, 1},
+  {0, 0x0, 0, 0}, {279, 0x0, 0, 0}, {279, 0x0, 0, 0},
+  {279, 0x0, 0, 0}, {2567, 0x1, 0, 1}, {279, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {277, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {278, 0x0, 0, 0}, {0, 0x0, 0, 0}, {2569, 0x18, 0, 2},
+  {2571, 0x18, 0, 2}, {2559, 0x3, 10, 1}, {2573, 0x1, 1, 1},
+  {276, 0x0, 0, 0}, {0, 0x0, 0, 0}, {274, 0x0, 0, 0},
+  {275, 0x0, 0, 0}, {2577, 0x14, 0, 2}, {2579, 0x1, 1, 1},
+  {2581, 0x14, 0, 2}, {0, 0x0, 0, 0}, {2575, 0x14, 0, 2},
+  {2583, 0x1, 4, 1}, {2591, 0x3, 2, 1}, {2591, 0x3, 2, 1},
+  {2591, 0x3, 2, 1}, {0, 0x0, 0, 0}, {285, 0x0, 0, 0},
+  {285, 0x0, 0, 0}, {285, 0x0, 0, 0}, {2595, 0x1, 0, 1},
+  {285, 0x0, 0, 0}, {0, 0x0, 0, 0}, {283, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {284, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {2597, 0x18, 0, 2}, {2599, 0x18, 0, 2}, {2587, 0x3, 10, 1},
+  {2601, 0x1, 1, 1}, {282, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {280, 0x0, 0, 0}, {281, 0x0, 0, 0}, {2605, 0x14, 0, 2},
+  {2607, 0x1, 1, 1}, {2603, 0x14, 0, 2}, {2609, 0x14, 0, 2},
+  {2531, 0x18, 0, 2}, {2557, 0x18, 0, 2}, {2585, 0x18, 0, 2},
+  {2611, 0x18, 0, 2}, {2621, 0x1, 21, 1}, {2623, 0x1, 21, 1},
+  {2625, 0x1, 21, 1}, {2627, 0x1, 21, 1}, {1985, 0x1, 22, 1},
+  {2021, 0x1, 22, 1}, {2037, 0x1, 22, 1}, {2041, 0x1, 22, 1},
+  {2207, 0x14, 0, 2}, {2363, 0x14, 0, 2}, {2503, 0x3, 8, 1},
+  {2613, 0x3, 8, 1}, {290, 0x0, 0, 0}, {290, 0x0, 0, 0},
+  {290, 0x0, 0, 0}, {290, 0x0, 0, 0}, {290, 0x0, 0, 0},
+  {290, 0x0, 0, 0}, {290, 0x0, 0, 0}, {290, 0x0, 0, 0},
+  {290, 0x0, 0, 0}, {290, 0x0, 0, 0}, {290, 0x0, 0, 0},
+  {290, 0x0, 0, 0}, {290, 0x0, 0, 0}, {290, 0x0, 0, 0},
+  {290, 0x0, 0, 0}, {0, 0x0, 0, 0}, {290, 0x0, 0, 0},
+  {290, 0x0, 0, 0}, {290, 0x0, 0, 0}, {290, 0x0, 0, 0},
+  {290, 0x0, 0, 0}, {290, 0x0, 0, 0}, {290, 0x0, 0, 0},
+  {290, 0x0, 0, 0}, {290, 0x0, 0, 0}, {290, 0x0, 0, 0},
+  {290, 0x0, 0, 0}, {290, 0x0, 0, 0}, {290, 0x0, 0, 0},
+  {290, 0x0, 0, 0}, {290, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {290, 0x0, 0, 0}, {290, 0x0, 0, 0}, {290, 0x0, 0, 0},
+  {290, 0x0, 0, 0}, {290, 0x0, 0, 0}, {290, 0x0, 0, 0},
+  {290, 0x0, 0, 0}, {290, 0x0, 0, 0}, {290, 0x0, 0, 0},
+  {290, 0x0, 0, 0}, {290, 0x0, 0, 0}, {290, 0x0, 0, 0},
+  {290, 0x0, 0, 0}, {290, 0x0, 0, 0}, {290, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {290, 0x0, 0, 0}, {290, 0x0, 0, 0},
+  {290, 0x0, 0, 0}, {290, 0x0, 0, 0}, {290, 0x0, 0, 0},
+  {290, 0x0, 0, 0}, {290, 0x0, 0, 0}, {290, 0x0, 0, 0},
+  {290, 0x0, 0, 0}, {290, 0x0, 0, 0}, {290, 0x0, 0, 0},
+  {290, 0x0, 0, 0}, {290, 0x0, 0, 0}, {290, 0x0, 0, 0},
+  {290, 0x0, 0, 0}, {0, 0x0, 0, 0}, {290, 0x0, 0, 0},
+  {290, 0x0, 0, 0}, {290, 0x0, 0, 0}, {290, 0x0, 0, 0},
+  {290, 0x0, 0, 0}, {290, 0x0, 0, 0}, {290, 0x0, 0, 0},
+  {290, 0x0, 0, 0}, {290, 0x0, 0, 0}, {290, 0x0, 0, 0},
+  {290, 0x0, 0, 0}, {290, 0x0, 0, 0}, {290, 0x0, 0, 0},
+  {290, 0x0, 0, 0}, {290, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {290, 0x0, 0, 0}, {290, 0x0, 0, 0}, {290, 0x0, 0, 0},
+  {290, 0x0, 0, 0}, {290, 0x0, 0, 0}, {290, 0x0, 0, 0},
+  {290, 0x0, 0, 0}, {290, 0x0, 0, 0}, {290, 0x0, 0, 0},
+  {290, 0x0, 0, 0}, {290, 0x0, 0, 0}, {290, 0x0, 0, 0},
+  {290, 0x0, 0, 0}, {290, 0x0, 0, 0}, {290, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {290, 0x0, 0, 0}, {290, 0x0, 0, 0},
+  {290, 0x0, 0, 0}, {290, 0x0, 0, 0}, {290, 0x0, 0, 0},
+  {290, 0x0, 0, 0}, {290, 0x0, 0, 0}, {290, 0x0, 0, 0},
+  {290, 0x0, 0, 0}, {290, 0x0, 0, 0}, {290, 0x0, 0, 0},
+  {290, 0x0, 0, 0}, {290, 0x0, 0, 0}, {290, 0x0, 0, 0},
+  {290, 0x0, 0, 0}, {0, 0x0, 0, 0}, {290, 0x0, 0, 0},
+  {290, 0x0, 0, 0}, {290, 0x0, 0, 0}, {290, 0x0, 0, 0},
+  {290, 0x0, 0, 0}, {290, 0x0, 0, 0}, {290, 0x0, 0, 0},
+  {290, 0x0, 0, 0}, {290, 0x0, 0, 0}, {290, 0x0, 0, 0},
+  {290, 0x0, 0, 0}, {290, 0x0, 0, 0}, {290, 0x0, 0, 0},
+  {290, 0x0, 0, 0}, {290, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {290, 0x0, 0, 0}, {290, 0x0, 0, 0}, {290, 0x0, 0, 0},
+  {290, 0x0, 0, 0}, {290, 0x0, 0, 0}, {290, 0x0, 0, 0},
+  {290, 0x0, 0, 0}, {290, 0x0, 0, 0}, {290, 0x0, 0, 0},
+  {290, 0x0, 0, 0}, {290, 0x0, 0, 0}, {290, 0x0, 0, 0},
+  {290, 0x0, 0, 0}, {290, 0x0, 0, 0}, {290, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {290, 0x0, 0, 0}, {290, 0x0, 0, 0},
+  {290, 0x0, 0, 0}, {290, 0x0, 0, 0}, {290, 0x0, 0, 0},
+  {290, 0x0, 0, 0}, {290, 0x0, 0, 0}, {290, 0x0, 0, 0},
+  {290, 0x0, 0, 0}, {290, 0x0, 0, 0}, {290, 0x0, 0, 0},
+  {290, 0x0, 0, 0}, {290, 0x0, 0, 0}, {290, 0x0, 0, 0},
+  {290, 0x0, 0, 0}, {0, 0x0, 0, 0}, {290, 0x0, 0, 0},
+  {290, 0x0, 0, 0}, {290, 0x0, 0, 0}, {290, 0x0, 0, 0},
+  {290, 0x0, 0, 0}, {290, 0x0, 0, 0}, {290, 0x0, 0, 0},
+  {290, 0x0, 0, 0}, {290, 0x0, 0, 0}, {290, 0x0, 0, 0},
+  {290, 0x0, 0, 0}, {290, 0x0, 0, 0}, {290, 0x0, 0, 0},
+  {290, 0x0, 0, 0}, {290, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {290, 0x0, 0, 0}, {290, 0x0, 0, 0}, {290, 0x0, 0, 0},
+  {290, 0x0, 0, 0}, {290, 0x0, 0, 0}, {290, 0x0, 0, 0},
+  {290, 0x0, 0, 0}, {290, 0x0, 0, 0}, {290, 0x0, 0, 0},
+  {290, 0x0, 0, 0}, {290, 0x0, 0, 0}, {290, 0x0, 0, 0},
+  {290, 0x0, 0, 0}, {290, 0x0, 0, 0}, {290, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {290, 0x0, 0, 0}, {290, 0x0, 0, 0},
+  {290, 0x0, 0, 0}, {290, 0x0, 0, 0}, {290, 0x0, 0, 0},
+  {290, 0x0, 0, 0}, {290, 0x0, 0, 0}, {290, 0x0, 0, 0},
+  {290, 0x0, 0, 0}, {290, 0x0, 0, 0}, {290, 0x0, 0, 0},
+  {290, 0x0, 0, 0}, {290, 0x0, 0, 0}, {290, 0x0, 0, 0},
+  {290, 0x0, 0, 0}, {0, 0x0, 0, 0}, {290, 0x0, 0, 0},
+  {290, 0x0, 0, 0}, {290, 0x0, 0, 0}, {290, 0x0, 0, 0},
+  {290, 0x0, 0, 0}, {290, 0x0, 0, 0}, {290, 0x0, 0, 0},
+  {290, 0x0, 0, 0}, {290, 0x0, 0, 0}, {290, 0x0, 0, 0},
+  {290, 0x0, 0, 0}, {290, 0x0, 0, 0}, {290, 0x0, 0, 0},
+  {290, 0x0, 0, 0}, {290, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {290, 0x0, 0, 0}, {290, 0x0, 0, 0}, {290, 0x0, 0, 0},
+  {290, 0x0, 0, 0}, {290, 0x0, 0, 0}, {290, 0x0, 0, 0},
+  {290, 0x0, 0, 0}, {290, 0x0, 0, 0}, {290, 0x0, 0, 0},
+  {290, 0x0, 0, 0}, {290, 0x0, 0, 0}, {290, 0x0, 0, 0},
+  {290, 0x0, 0, 0}, {290, 0x0, 0, 0}, {290, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {289, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {2629, 0xff, 12, 1}, {2885, 0x6, 0, 2},
+  {0, 0x0, 0, 0}, {2887, 0x19, 0, 2}, {291, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {293, 0x0, 0, 0}, {293, 0x0, 0, 0},
+  {293, 0x0, 0, 0}, {293, 0x0, 0, 0}, {293, 0x0, 0, 0},
+  {293, 0x0, 0, 0}, {293, 0x0, 0, 0}, {293, 0x0, 0, 0},
+  {293, 0x0, 0, 0}, {293, 0x0, 0, 0}, {293, 0x0, 0, 0},
+  {293, 0x0, 0, 0}, {293, 0x0, 0, 0}, {293, 0x0, 0, 0},
+  {293, 0x0, 0, 0}, {0, 0x0, 0, 0}, {293, 0x0, 0, 0},
+  {293, 0x0, 0, 0}, {293, 0x0, 0, 0}, {293, 0x0, 0, 0},
+  {293, 0x0, 0, 0}, {293, 0x0, 0, 0}, {293, 0x0, 0, 0},
+  {293, 0x0, 0, 0}, {293, 0x0, 0, 0}, {293, 0x0, 0, 0},
+  {293, 0x0, 0, 0}, {293, 0x0, 0, 0}, {293, 0x0, 0, 0},
+  {293, 0x0, 0, 0}, {293, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {293, 0x0, 0, 0}, {293, 0x0, 0, 0}, {293, 0x0, 0, 0},
+  {293, 0x0, 0, 0}, {293, 0x0, 0, 0}, {293, 0x0, 0, 0},
+  {293, 0x0, 0, 0}, {293, 0x0, 0, 0}, {293, 0x0, 0, 0},
+  {293, 0x0, 0, 0}, {293, 0x0, 0, 0}, {293, 0x0, 0, 0},
+  {293, 0x0, 0, 0}, {293, 0x0, 0, 0}, {293, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {293, 0x0, 0, 0}, {293, 0x0, 0, 0},
+  {293, 0x0, 0, 0}, {293, 0x0, 0, 0}, {293, 0x0, 0, 0},
+  {293, 0x0, 0, 0}, {293, 0x0, 0, 0}, {293, 0x0, 0, 0},
+  {293, 0x0, 0, 0}, {293, 0x0, 0, 0}, {293, 0x0, 0, 0},
+  {293, 0x0, 0, 0}, {293, 0x0, 0, 0}, {293, 0x0, 0, 0},
+  {293, 0x0, 0, 0}, {0, 0x0, 0, 0}, {293, 0x0, 0, 0},
+  {293, 0x0, 0, 0}, {293, 0x0, 0, 0}, {293, 0x0, 0, 0},
+  {293, 0x0, 0, 0}, {293, 0x0, 0, 0}, {293, 0x0, 0, 0},
+  {293, 0x0, 0, 0}, {293, 0x0, 0, 0}, {293, 0x0, 0, 0},
+  {293, 0x0, 0, 0}, {293, 0x0, 0, 0}, {293, 0x0, 0, 0},
+  {293, 0x0, 0, 0}, {293, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {293, 0x0, 0, 0}, {293, 0x0, 0, 0}, {293, 0x0, 0, 0},
+  {293, 0x0, 0, 0}, {293, 0x0, 0, 0}, {293, 0x0, 0, 0},
+  {293, 0x0, 0, 0}, {293, 0x0, 0, 0}, {293, 0x0, 0, 0},
+  {293, 0x0, 0, 0}, {293, 0x0, 0, 0}, {293, 0x0, 0, 0},
+  {293, 0x0, 0, 0}, {293, 0x0, 0, 0}, {293, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {293, 0x0, 0, 0}, {293, 0x0, 0, 0},
+  {293, 0x0, 0, 0}, {293, 0x0, 0, 0}, {293, 0x0, 0, 0},
+  {293, 0x0, 0, 0}, {293, 0x0, 0, 0}, {293, 0x0, 0, 0},
+  {293, 0x0, 0, 0}, {293, 0x0, 0, 0}, {293, 0x0, 0, 0},
+  {293, 0x0, 0, 0}, {293, 0x0, 0, 0}, {293, 0x0, 0, 0},
+  {293, 0x0, 0, 0}, {0, 0x0, 0, 0}, {293, 0x0, 0, 0},
+  {293, 0x0, 0, 0}, {293, 0x0, 0, 0}, {293, 0x0, 0, 0},
+  {293, 0x0, 0, 0}, {293, 0x0, 0, 0}, {293, 0x0, 0, 0},
+  {293, 0x0, 0, 0}, {293, 0x0, 0, 0}, {293, 0x0, 0, 0},
+  {293, 0x0, 0, 0}, {293, 0x0, 0, 0}, {293, 0x0, 0, 0},
+  {293, 0x0, 0, 0}, {293, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {293, 0x0, 0, 0}, {293, 0x0, 0, 0}, {293, 0x0, 0, 0},
+  {293, 0x0, 0, 0}, {293, 0x0, 0, 0}, {293, 0x0, 0, 0},
+  {293, 0x0, 0, 0}, {293, 0x0, 0, 0}, {293, 0x0, 0, 0},
+  {293, 0x0, 0, 0}, {293, 0x0, 0, 0}, {293, 0x0, 0, 0},
+  {293, 0x0, 0, 0}, {293, 0x0, 0, 0}, {293, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {293, 0x0, 0, 0}, {293, 0x0, 0, 0},
+  {293, 0x0, 0, 0}, {293, 0x0, 0, 0}, {293, 0x0, 0, 0},
+  {293, 0x0, 0, 0}, {293, 0x0, 0, 0}, {293, 0x0, 0, 0},
+  {293, 0x0, 0, 0}, {293, 0x0, 0, 0}, {293, 0x0, 0, 0},
+  {293, 0x0, 0, 0}, {293, 0x0, 0, 0}, {293, 0x0, 0, 0},
+  {293, 0x0, 0, 0}, {0, 0x0, 0, 0}, {293, 0x0, 0, 0},
+  {293, 0x0, 0, 0}, {293, 0x0, 0, 0}, {293, 0x0, 0, 0},
+  {293, 0x0, 0, 0}, {293, 0x0, 0, 0}, {293, 0x0, 0, 0},
+  {293, 0x0, 0, 0}, {293, 0x0, 0, 0}, {293, 0x0, 0, 0},
+  {293, 0x0, 0, 0}, {293, 0x0, 0, 0}, {293, 0x0, 0, 0},
+  {293, 0x0, 0, 0}, {293, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {293, 0x0, 0, 0}, {293, 0x0, 0, 0}, {293, 0x0, 0, 0},
+  {293, 0x0, 0, 0}, {293, 0x0, 0, 0}, {293, 0x0, 0, 0},
+  {293, 0x0, 0, 0}, {293, 0x0, 0, 0}, {293, 0x0, 0, 0},
+  {293, 0x0, 0, 0}, {293, 0x0, 0, 0}, {293, 0x0, 0, 0},
+  {293, 0x0, 0, 0}, {293, 0x0, 0, 0}, {293, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {293, 0x0, 0, 0}, {293, 0x0, 0, 0},
+  {293, 0x0, 0, 0}, {293, 0x0, 0, 0}, {293, 0x0, 0, 0},
+  {293, 0x0, 0, 0}, {293, 0x0, 0, 0}, {293, 0x0, 0, 0},
+  {293, 0x0, 0, 0}, {293, 0x0, 0, 0}, {293, 0x0, 0, 0},
+  {293, 0x0, 0, 0}, {293, 0x0, 0, 0}, {293, 0x0, 0, 0},
+  {293, 0x0, 0, 0}, {0, 0x0, 0, 0}, {293, 0x0, 0, 0},
+  {293, 0x0, 0, 0}, {293, 0x0, 0, 0}, {293, 0x0, 0, 0},
+  {293, 0x0, 0, 0}, {293, 0x0, 0, 0}, {293, 0x0, 0, 0},
+  {293, 0x0, 0, 0}, {293, 0x0, 0, 0}, {293, 0x0, 0, 0},
+  {293, 0x0, 0, 0}, {293, 0x0, 0, 0}, {293, 0x0, 0, 0},
+  {293, 0x0, 0, 0}, {293, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {293, 0x0, 0, 0}, {293, 0x0, 0, 0}, {293, 0x0, 0, 0},
+  {293, 0x0, 0, 0}, {293, 0x0, 0, 0}, {293, 0x0, 0, 0},
+  {293, 0x0, 0, 0}, {293, 0x0, 0, 0}, {293, 0x0, 0, 0},
+  {293, 0x0, 0, 0}, {293, 0x0, 0, 0}, {293, 0x0, 0, 0},
+  {293, 0x0, 0, 0}, {293, 0x0, 0, 0}, {293, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {292, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {2893, 0xff, 12, 1}, {3149, 0x6, 0, 2},
+  {294, 0x0, 0, 0}, {0, 0x0, 0, 0}, {3151, 0x19, 0, 2},
+  {3153, 0x6, 0, 2}, {295, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {3163, 0x1, 8, 1}, {0, 0x0, 0, 0}, {3165, 0x1, 8, 1},
+  {3167, 0x1, 8, 1}, {2889, 0x12, 0, 2}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {2891, 0x6, 0, 2}, {3155, 0x1, 9, 1},
+  {3157, 0x6, 0, 2}, {297, 0x0, 0, 0}, {297, 0x0, 0, 0},
+  {297, 0x0, 0, 0}, {297, 0x0, 0, 0}, {297, 0x0, 0, 0},
+  {297, 0x0, 0, 0}, {297, 0x0, 0, 0}, {297, 0x0, 0, 0},
+  {297, 0x0, 0, 0}, {297, 0x0, 0, 0}, {297, 0x0, 0, 0},
+  {297, 0x0, 0, 0}, {297, 0x0, 0, 0}, {297, 0x0, 0, 0},
+  {297, 0x0, 0, 0}, {0, 0x0, 0, 0}, {297, 0x0, 0, 0},
+  {297, 0x0, 0, 0}, {297, 0x0, 0, 0}, {297, 0x0, 0, 0},
+  {297, 0x0, 0, 0}, {297, 0x0, 0, 0}, {297, 0x0, 0, 0},
+  {297, 0x0, 0, 0}, {297, 0x0, 0, 0}, {297, 0x0, 0, 0},
+  {297, 0x0, 0, 0}, {297, 0x0, 0, 0}, {297, 0x0, 0, 0},
+  {297, 0x0, 0, 0}, {297, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {297, 0x0, 0, 0}, {297, 0x0, 0, 0}, {297, 0x0, 0, 0},
+  {297, 0x0, 0, 0}, {297, 0x0, 0, 0}, {297, 0x0, 0, 0},
+  {297, 0x0, 0, 0}, {297, 0x0, 0, 0}, {297, 0x0, 0, 0},
+  {297, 0x0, 0, 0}, {297, 0x0, 0, 0}, {297, 0x0, 0, 0},
+  {297, 0x0, 0, 0}, {297, 0x0, 0, 0}, {297, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {297, 0x0, 0, 0}, {297, 0x0, 0, 0},
+  {297, 0x0, 0, 0}, {297, 0x0, 0, 0}, {297, 0x0, 0, 0},
+  {297, 0x0, 0, 0}, {297, 0x0, 0, 0}, {297, 0x0, 0, 0},
+  {297, 0x0, 0, 0}, {297, 0x0, 0, 0}, {297, 0x0, 0, 0},
+  {297, 0x0, 0, 0}, {297, 0x0, 0, 0}, {297, 0x0, 0, 0},
+  {297, 0x0, 0, 0}, {0, 0x0, 0, 0}, {297, 0x0, 0, 0},
+  {297, 0x0, 0, 0}, {297, 0x0, 0, 0}, {297, 0x0, 0, 0},
+  {297, 0x0, 0, 0}, {297, 0x0, 0, 0}, {297, 0x0, 0, 0},
+  {297, 0x0, 0, 0}, {297, 0x0, 0, 0}, {297, 0x0, 0, 0},
+  {297, 0x0, 0, 0}, {297, 0x0, 0, 0}, {297, 0x0, 0, 0},
+  {297, 0x0, 0, 0}, {297, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {297, 0x0, 0, 0}, {297, 0x0, 0, 0}, {297, 0x0, 0, 0},
+  {297, 0x0, 0, 0}, {297, 0x0, 0, 0}, {297, 0x0, 0, 0},
+  {297, 0x0, 0, 0}, {297, 0x0, 0, 0}, {297, 0x0, 0, 0},
+  {297, 0x0, 0, 0}, {297, 0x0, 0, 0}, {297, 0x0, 0, 0},
+  {297, 0x0, 0, 0}, {297, 0x0, 0, 0}, {297, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {297, 0x0, 0, 0}, {297, 0x0, 0, 0},
+  {297, 0x0, 0, 0}, {297, 0x0, 0, 0}, {297, 0x0, 0, 0},
+  {297, 0x0, 0, 0}, {297, 0x0, 0, 0}, {297, 0x0, 0, 0},
+  {297, 0x0, 0, 0}, {297, 0x0, 0, 0}, {297, 0x0, 0, 0},
+  {297, 0x0, 0, 0}, {297, 0x0, 0, 0}, {297, 0x0, 0, 0},
+  {297, 0x0, 0, 0}, {0, 0x0, 0, 0}, {297, 0x0, 0, 0},
+  {297, 0x0, 0, 0}, {297, 0x0, 0, 0}, {297, 0x0, 0, 0},
+  {297, 0x0, 0, 0}, {297, 0x0, 0, 0}, {297, 0x0, 0, 0},
+  {297, 0x0, 0, 0}, {297, 0x0, 0, 0}, {297, 0x0, 0, 0},
+  {297, 0x0, 0, 0}, {297, 0x0, 0, 0}, {297, 0x0, 0, 0},
+  {297, 0x0, 0, 0}, {297, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {297, 0x0, 0, 0}, {297, 0x0, 0, 0}, {297, 0x0, 0, 0},
+  {297, 0x0, 0, 0}, {297, 0x0, 0, 0}, {297, 0x0, 0, 0},
+  {297, 0x0, 0, 0}, {297, 0x0, 0, 0}, {297, 0x0, 0, 0},
+  {297, 0x0, 0, 0}, {297, 0x0, 0, 0}, {297, 0x0, 0, 0},
+  {297, 0x0, 0, 0}, {297, 0x0, 0, 0}, {297, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {297, 0x0, 0, 0}, {297, 0x0, 0, 0},
+  {297, 0x0, 0, 0}, {297, 0x0, 0, 0}, {297, 0x0, 0, 0},
+  {297, 0x0, 0, 0}, {297, 0x0, 0, 0}, {297, 0x0, 0, 0},
+  {297, 0x0, 0, 0}, {297, 0x0, 0, 0}, {297, 0x0, 0, 0},
+  {297, 0x0, 0, 0}, {297, 0x0, 0, 0}, {297, 0x0, 0, 0},
+  {297, 0x0, 0, 0}, {0, 0x0, 0, 0}, {297, 0x0, 0, 0},
+  {297, 0x0, 0, 0}, {297, 0x0, 0, 0}, {297, 0x0, 0, 0},
+  {297, 0x0, 0, 0}, {297, 0x0, 0, 0}, {297, 0x0, 0, 0},
+  {297, 0x0, 0, 0}, {297, 0x0, 0, 0}, {297, 0x0, 0, 0},
+  {297, 0x0, 0, 0}, {297, 0x0, 0, 0}, {297, 0x0, 0, 0},
+  {297, 0x0, 0, 0}, {297, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {297, 0x0, 0, 0}, {297, 0x0, 0, 0}, {297, 0x0, 0, 0},
+  {297, 0x0, 0, 0}, {297, 0x0, 0, 0}, {297, 0x0, 0, 0},
+  {297, 0x0, 0, 0}, {297, 0x0, 0, 0}, {297, 0x0, 0, 0},
+  {297, 0x0, 0, 0}, {297, 0x0, 0, 0}, {297, 0x0, 0, 0},
+  {297, 0x0, 0, 0}, {297, 0x0, 0, 0}, {297, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {297, 0x0, 0, 0}, {297, 0x0, 0, 0},
+  {297, 0x0, 0, 0}, {297, 0x0, 0, 0}, {297, 0x0, 0, 0},
+  {297, 0x0, 0, 0}, {297, 0x0, 0, 0}, {297, 0x0, 0, 0},
+  {297, 0x0, 0, 0}, {297, 0x0, 0, 0}, {297, 0x0, 0, 0},
+  {297, 0x0, 0, 0}, {297, 0x0, 0, 0}, {297, 0x0, 0, 0},
+  {297, 0x0, 0, 0}, {0, 0x0, 0, 0}, {297, 0x0, 0, 0},
+  {297, 0x0, 0, 0}, {297, 0x0, 0, 0}, {297, 0x0, 0, 0},
+  {297, 0x0, 0, 0}, {297, 0x0, 0, 0}, {297, 0x0, 0, 0},
+  {297, 0x0, 0, 0}, {297, 0x0, 0, 0}, {297, 0x0, 0, 0},
+  {297, 0x0, 0, 0}, {297, 0x0, 0, 0}, {297, 0x0, 0, 0},
+  {297, 0x0, 0, 0}, {297, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {297, 0x0, 0, 0}, {297, 0x0, 0, 0}, {297, 0x0, 0, 0},
+  {297, 0x0, 0, 0}, {297, 0x0, 0, 0}, {297, 0x0, 0, 0},
+  {297, 0x0, 0, 0}, {297, 0x0, 0, 0}, {297, 0x0, 0, 0},
+  {297, 0x0, 0, 0}, {297, 0x0, 0, 0}, {297, 0x0, 0, 0},
+  {297, 0x0, 0, 0}, {297, 0x0, 0, 0}, {297, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {296, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {3169, 0xff, 12, 1}, {3425, 0x6, 0, 2},
+  {0, 0x0, 0, 0}, {3427, 0x19, 0, 2}, {298, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {300, 0x0, 0, 0}, {300, 0x0, 0, 0},
+  {300, 0x0, 0, 0}, {300, 0x0, 0, 0}, {300, 0x0, 0, 0},
+  {300, 0x0, 0, 0}, {300, 0x0, 0, 0}, {300, 0x0, 0, 0},
+  {300, 0x0, 0, 0}, {300, 0x0, 0, 0}, {300, 0x0, 0, 0},
+  {300, 0x0, 0, 0}, {300, 0x0, 0, 0}, {300, 0x0, 0, 0},
+  {300, 0x0, 0, 0}, {0, 0x0, 0, 0}, {300, 0x0, 0, 0},
+  {300, 0x0, 0, 0}, {300, 0x0, 0, 0}, {300, 0x0, 0, 0},
+  {300, 0x0, 0, 0}, {300, 0x0, 0, 0}, {300, 0x0, 0, 0},
+  {300, 0x0, 0, 0}, {300, 0x0, 0, 0}, {300, 0x0, 0, 0},
+  {300, 0x0, 0, 0}, {300, 0x0, 0, 0}, {300, 0x0, 0, 0},
+  {300, 0x0, 0, 0}, {300, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {300, 0x0, 0, 0}, {300, 0x0, 0, 0}, {300, 0x0, 0, 0},
+  {300, 0x0, 0, 0}, {300, 0x0, 0, 0}, {300, 0x0, 0, 0},
+  {300, 0x0, 0, 0}, {300, 0x0, 0, 0}, {300, 0x0, 0, 0},
+  {300, 0x0, 0, 0}, {300, 0x0, 0, 0}, {300, 0x0, 0, 0},
+  {300, 0x0, 0, 0}, {300, 0x0, 0, 0}, {300, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {300, 0x0, 0, 0}, {300, 0x0, 0, 0},
+  {300, 0x0, 0, 0}, {300, 0x0, 0, 0}, {300, 0x0, 0, 0},
+  {300, 0x0, 0, 0}, {300, 0x0, 0, 0}, {300, 0x0, 0, 0},
+  {300, 0x0, 0, 0}, {300, 0x0, 0, 0}, {300, 0x0, 0, 0},
+  {300, 0x0, 0, 0}, {300, 0x0, 0, 0}, {300, 0x0, 0, 0},
+  {300, 0x0, 0, 0}, {0, 0x0, 0, 0}, {300, 0x0, 0, 0},
+  {300, 0x0, 0, 0}, {300, 0x0, 0, 0}, {300, 0x0, 0, 0},
+  {300, 0x0, 0, 0}, {300, 0x0, 0, 0}, {300, 0x0, 0, 0},
+  {300, 0x0, 0, 0}, {300, 0x0, 0, 0}, {300, 0x0, 0, 0},
+  {300, 0x0, 0, 0}, {300, 0x0, 0, 0}, {300, 0x0, 0, 0},
+  {300, 0x0, 0, 0}, {300, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {300, 0x0, 0, 0}, {300, 0x0, 0, 0}, {300, 0x0, 0, 0},
+  {300, 0x0, 0, 0}, {300, 0x0, 0, 0}, {300, 0x0, 0, 0},
+  {300, 0x0, 0, 0}, {300, 0x0, 0, 0}, {300, 0x0, 0, 0},
+  {300, 0x0, 0, 0}, {300, 0x0, 0, 0}, {300, 0x0, 0, 0},
+  {300, 0x0, 0, 0}, {300, 0x0, 0, 0}, {300, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {300, 0x0, 0, 0}, {300, 0x0, 0, 0},
+  {300, 0x0, 0, 0}, {300, 0x0, 0, 0}, {300, 0x0, 0, 0},
+  {300, 0x0, 0, 0}, {300, 0x0, 0, 0}, {300, 0x0, 0, 0},
+  {300, 0x0, 0, 0}, {300, 0x0, 0, 0}, {300, 0x0, 0, 0},
+  {300, 0x0, 0, 0}, {300, 0x0, 0, 0}, {300, 0x0, 0, 0},
+  {300, 0x0, 0, 0}, {0, 0x0, 0, 0}, {300, 0x0, 0, 0},
+  {300, 0x0, 0, 0}, {300, 0x0, 0, 0}, {300, 0x0, 0, 0},
+  {300, 0x0, 0, 0}, {300, 0x0, 0, 0}, {300, 0x0, 0, 0},
+  {300, 0x0, 0, 0}, {300, 0x0, 0, 0}, {300, 0x0, 0, 0},
+  {300, 0x0, 0, 0}, {300, 0x0, 0, 0}, {300, 0x0, 0, 0},
+  {300, 0x0, 0, 0}, {300, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {300, 0x0, 0, 0}, {300, 0x0, 0, 0}, {300, 0x0, 0, 0},
+  {300, 0x0, 0, 0}, {300, 0x0, 0, 0}, {300, 0x0, 0, 0},
+  {300, 0x0, 0, 0}, {300, 0x0, 0, 0}, {300, 0x0, 0, 0},
+  {300, 0x0, 0, 0}, {300, 0x0, 0, 0}, {300, 0x0, 0, 0},
+  {300, 0x0, 0, 0}, {300, 0x0, 0, 0}, {300, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {300, 0x0, 0, 0}, {300, 0x0, 0, 0},
+  {300, 0x0, 0, 0}, {300, 0x0, 0, 0}, {300, 0x0, 0, 0},
+  {300, 0x0, 0, 0}, {300, 0x0, 0, 0}, {300, 0x0, 0, 0},
+  {300, 0x0, 0, 0}, {300, 0x0, 0, 0}, {300, 0x0, 0, 0},
+  {300, 0x0, 0, 0}, {300, 0x0, 0, 0}, {300, 0x0, 0, 0},
+  {300, 0x0, 0, 0}, {0, 0x0, 0, 0}, {300, 0x0, 0, 0},
+  {300, 0x0, 0, 0}, {300, 0x0, 0, 0}, {300, 0x0, 0, 0},
+  {300, 0x0, 0, 0}, {300, 0x0, 0, 0}, {300, 0x0, 0, 0},
+  {300, 0x0, 0, 0}, {300, 0x0, 0, 0}, {300, 0x0, 0, 0},
+  {300, 0x0, 0, 0}, {300, 0x0, 0, 0}, {300, 0x0, 0, 0},
+  {300, 0x0, 0, 0}, {300, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {300, 0x0, 0, 0}, {300, 0x0, 0, 0}, {300, 0x0, 0, 0},
+  {300, 0x0, 0, 0}, {300, 0x0, 0, 0}, {300, 0x0, 0, 0},
+  {300, 0x0, 0, 0}, {300, 0x0, 0, 0}, {300, 0x0, 0, 0},
+  {300, 0x0, 0, 0}, {300, 0x0, 0, 0}, {300, 0x0, 0, 0},
+  {300, 0x0, 0, 0}, {300, 0x0, 0, 0}, {300, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {300, 0x0, 0, 0}, {300, 0x0, 0, 0},
+  {300, 0x0, 0, 0}, {300, 0x0, 0, 0}, {300, 0x0, 0, 0},
+  {300, 0x0, 0, 0}, {300, 0x0, 0, 0}, {300, 0x0, 0, 0},
+  {300, 0x0, 0, 0}, {300, 0x0, 0, 0}, {300, 0x0, 0, 0},
+  {300, 0x0, 0, 0}, {300, 0x0, 0, 0}, {300, 0x0, 0, 0},
+  {300, 0x0, 0, 0}, {0, 0x0, 0, 0}, {300, 0x0, 0, 0},
+  {300, 0x0, 0, 0}, {300, 0x0, 0, 0}, {300, 0x0, 0, 0},
+  {300, 0x0, 0, 0}, {300, 0x0, 0, 0}, {300, 0x0, 0, 0},
+  {300, 0x0, 0, 0}, {300, 0x0, 0, 0}, {300, 0x0, 0, 0},
+  {300, 0x0, 0, 0}, {300, 0x0, 0, 0}, {300, 0x0, 0, 0},
+  {300, 0x0, 0, 0}, {300, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {300, 0x0, 0, 0}, {300, 0x0, 0, 0}, {300, 0x0, 0, 0},
+  {300, 0x0, 0, 0}, {300, 0x0, 0, 0}, {300, 0x0, 0, 0},
+  {300, 0x0, 0, 0}, {300, 0x0, 0, 0}, {300, 0x0, 0, 0},
+  {300, 0x0, 0, 0}, {300, 0x0, 0, 0}, {300, 0x0, 0, 0},
+  {300, 0x0, 0, 0}, {300, 0x0, 0, 0}, {300, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {299, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {3433, 0xff, 12, 1}, {3689, 0x6, 0, 2},
+  {301, 0x0, 0, 0}, {0, 0x0, 0, 0}, {3691, 0x19, 0, 2},
+  {3693, 0x6, 0, 2}, {302, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {3703, 0x1, 8, 1}, {0, 0x0, 0, 0}, {3705, 0x1, 8, 1},
+  {3707, 0x1, 8, 1}, {3429, 0x12, 0, 2}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {3431, 0x6, 0, 2}, {3695, 0x1, 9, 1},
+  {3697, 0x6, 0, 2}, {304, 0x0, 0, 0}, {304, 0x0, 0, 0},
+  {304, 0x0, 0, 0}, {304, 0x0, 0, 0}, {304, 0x0, 0, 0},
+  {304, 0x0, 0, 0}, {304, 0x0, 0, 0}, {304, 0x0, 0, 0},
+  {304, 0x0, 0, 0}, {304, 0x0, 0, 0}, {304, 0x0, 0, 0},
+  {304, 0x0, 0, 0}, {304, 0x0, 0, 0}, {304, 0x0, 0, 0},
+  {304, 0x0, 0, 0}, {0, 0x0, 0, 0}, {304, 0x0, 0, 0},
+  {304, 0x0, 0, 0}, {304, 0x0, 0, 0}, {304, 0x0, 0, 0},
+  {304, 0x0, 0, 0}, {304, 0x0, 0, 0}, {304, 0x0, 0, 0},
+  {304, 0x0, 0, 0}, {304, 0x0, 0, 0}, {304, 0x0, 0, 0},
+  {304, 0x0, 0, 0}, {304, 0x0, 0, 0}, {304, 0x0, 0, 0},
+  {304, 0x0, 0, 0}, {304, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {304, 0x0, 0, 0}, {304, 0x0, 0, 0}, {304, 0x0, 0, 0},
+  {304, 0x0, 0, 0}, {304, 0x0, 0, 0}, {304, 0x0, 0, 0},
+  {304, 0x0, 0, 0}, {304, 0x0, 0, 0}, {304, 0x0, 0, 0},
+  {304, 0x0, 0, 0}, {304, 0x0, 0, 0}, {304, 0x0, 0, 0},
+  {304, 0x0, 0, 0}, {304, 0x0, 0, 0}, {304, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {304, 0x0, 0, 0}, {304, 0x0, 0, 0},
+  {304, 0x0, 0, 0}, {304, 0x0, 0, 0}, {304, 0x0, 0, 0},
+  {304, 0x0, 0, 0}, {304, 0x0, 0, 0}, {304, 0x0, 0, 0},
+  {304, 0x0, 0, 0}, {304, 0x0, 0, 0}, {304, 0x0, 0, 0},
+  {304, 0x0, 0, 0}, {304, 0x0, 0, 0}, {304, 0x0, 0, 0},
+  {304, 0x0, 0, 0}, {0, 0x0, 0, 0}, {304, 0x0, 0, 0},
+  {304, 0x0, 0, 0}, {304, 0x0, 0, 0}, {304, 0x0, 0, 0},
+  {304, 0x0, 0, 0}, {304, 0x0, 0, 0}, {304, 0x0, 0, 0},
+  {304, 0x0, 0, 0}, {304, 0x0, 0, 0}, {304, 0x0, 0, 0},
+  {304, 0x0, 0, 0}, {304, 0x0, 0, 0}, {304, 0x0, 0, 0},
+  {304, 0x0, 0, 0}, {304, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {304, 0x0, 0, 0}, {304, 0x0, 0, 0}, {304, 0x0, 0, 0},
+  {304, 0x0, 0, 0}, {304, 0x0, 0, 0}, {304, 0x0, 0, 0},
+  {304, 0x0, 0, 0}, {304, 0x0, 0, 0}, {304, 0x0, 0, 0},
+  {304, 0x0, 0, 0}, {304, 0x0, 0, 0}, {304, 0x0, 0, 0},
+  {304, 0x0, 0, 0}, {304, 0x0, 0, 0}, {304, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {304, 0x0, 0, 0}, {304, 0x0, 0, 0},
+  {304, 0x0, 0, 0}, {304, 0x0, 0, 0}, {304, 0x0, 0, 0},
+  {304, 0x0, 0, 0}, {304, 0x0, 0, 0}, {304, 0x0, 0, 0},
+  {304, 0x0, 0, 0}, {304, 0x0, 0, 0}, {304, 0x0, 0, 0},
+  {304, 0x0, 0, 0}, {304, 0x0, 0, 0}, {304, 0x0, 0, 0},
+  {304, 0x0, 0, 0}, {0, 0x0, 0, 0}, {304, 0x0, 0, 0},
+  {304, 0x0, 0, 0}, {304, 0x0, 0, 0}, {304, 0x0, 0, 0},
+  {304, 0x0, 0, 0}, {304, 0x0, 0, 0}, {304, 0x0, 0, 0},
+  {304, 0x0, 0, 0}, {304, 0x0, 0, 0}, {304, 0x0, 0, 0},
+  {304, 0x0, 0, 0}, {304, 0x0, 0, 0}, {304, 0x0, 0, 0},
+  {304, 0x0, 0, 0}, {304, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {304, 0x0, 0, 0}, {304, 0x0, 0, 0}, {304, 0x0, 0, 0},
+  {304, 0x0, 0, 0}, {304, 0x0, 0, 0}, {304, 0x0, 0, 0},
+  {304, 0x0, 0, 0}, {304, 0x0, 0, 0}, {304, 0x0, 0, 0},
+  {304, 0x0, 0, 0}, {304, 0x0, 0, 0}, {304, 0x0, 0, 0},
+  {304, 0x0, 0, 0}, {304, 0x0, 0, 0}, {304, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {304, 0x0, 0, 0}, {304, 0x0, 0, 0},
+  {304, 0x0, 0, 0}, {304, 0x0, 0, 0}, {304, 0x0, 0, 0},
+  {304, 0x0, 0, 0}, {304, 0x0, 0, 0}, {304, 0x0, 0, 0},
+  {304, 0x0, 0, 0}, {304, 0x0, 0, 0}, {304, 0x0, 0, 0},
+  {304, 0x0, 0, 0}, {304, 0x0, 0, 0}, {304, 0x0, 0, 0},
+  {304, 0x0, 0, 0}, {0, 0x0, 0, 0}, {304, 0x0, 0, 0},
+  {304, 0x0, 0, 0}, {304, 0x0, 0, 0}, {304, 0x0, 0, 0},
+  {304, 0x0, 0, 0}, {304, 0x0, 0, 0}, {304, 0x0, 0, 0},
+  {304, 0x0, 0, 0}, {304, 0x0, 0, 0}, {304, 0x0, 0, 0},
+  {304, 0x0, 0, 0}, {304, 0x0, 0, 0}, {304, 0x0, 0, 0},
+  {304, 0x0, 0, 0}, {304, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {304, 0x0, 0, 0}, {304, 0x0, 0, 0}, {304, 0x0, 0, 0},
+  {304, 0x0, 0, 0}, {304, 0x0, 0, 0}, {304, 0x0, 0, 0},
+  {304, 0x0, 0, 0}, {304, 0x0, 0, 0}, {304, 0x0, 0, 0},
+  {304, 0x0, 0, 0}, {304, 0x0, 0, 0}, {304, 0x0, 0, 0},
+  {304, 0x0, 0, 0}, {304, 0x0, 0, 0}, {304, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {304, 0x0, 0, 0}, {304, 0x0, 0, 0},
+  {304, 0x0, 0, 0}, {304, 0x0, 0, 0}, {304, 0x0, 0, 0},
+  {304, 0x0, 0, 0}, {304, 0x0, 0, 0}, {304, 0x0, 0, 0},
+  {304, 0x0, 0, 0}, {304, 0x0, 0, 0}, {304, 0x0, 0, 0},
+  {304, 0x0, 0, 0}, {304, 0x0, 0, 0}, {304, 0x0, 0, 0},
+  {304, 0x0, 0, 0}, {0, 0x0, 0, 0}, {304, 0x0, 0, 0},
+  {304, 0x0, 0, 0}, {304, 0x0, 0, 0}, {304, 0x0, 0, 0},
+  {304, 0x0, 0, 0}, {304, 0x0, 0, 0}, {304, 0x0, 0, 0},
+  {304, 0x0, 0, 0}, {304, 0x0, 0, 0}, {304, 0x0, 0, 0},
+  {304, 0x0, 0, 0}, {304, 0x0, 0, 0}, {304, 0x0, 0, 0},
+  {304, 0x0, 0, 0}, {304, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {304, 0x0, 0, 0}, {304, 0x0, 0, 0}, {304, 0x0, 0, 0},
+  {304, 0x0, 0, 0}, {304, 0x0, 0, 0}, {304, 0x0, 0, 0},
+  {304, 0x0, 0, 0}, {304, 0x0, 0, 0}, {304, 0x0, 0, 0},
+  {304, 0x0, 0, 0}, {304, 0x0, 0, 0}, {304, 0x0, 0, 0},
+  {304, 0x0, 0, 0}, {304, 0x0, 0, 0}, {304, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {303, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {3709, 0xff, 12, 1}, {3965, 0x6, 0, 2},
+  {306, 0x0, 0, 0}, {306, 0x0, 0, 0}, {306, 0x0, 0, 0},
+  {306, 0x0, 0, 0}, {306, 0x0, 0, 0}, {306, 0x0, 0, 0},
+  {306, 0x0, 0, 0}, {306, 0x0, 0, 0}, {306, 0x0, 0, 0},
+  {306, 0x0, 0, 0}, {306, 0x0, 0, 0}, {306, 0x0, 0, 0},
+  {306, 0x0, 0, 0}, {306, 0x0, 0, 0}, {306, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {306, 0x0, 0, 0}, {306, 0x0, 0, 0},
+  {306, 0x0, 0, 0}, {306, 0x0, 0, 0}, {306, 0x0, 0, 0},
+  {306, 0x0, 0, 0}, {306, 0x0, 0, 0}, {306, 0x0, 0, 0},
+  {306, 0x0, 0, 0}, {306, 0x0, 0, 0}, {306, 0x0, 0, 0},
+  {306, 0x0, 0, 0}, {306, 0x0, 0, 0}, {306, 0x0, 0, 0},
+  {306, 0x0, 0, 0}, {0, 0x0, 0, 0}, {306, 0x0, 0, 0},
+  {306, 0x0, 0, 0}, {306, 0x0, 0, 0}, {306, 0x0, 0, 0},
+  {306, 0x0, 0, 0}, {306, 0x0, 0, 0}, {306, 0x0, 0, 0},
+  {306, 0x0, 0, 0}, {306, 0x0, 0, 0}, {306, 0x0, 0, 0},
+  {306, 0x0, 0, 0}, {306, 0x0, 0, 0}, {306, 0x0, 0, 0},
+  {306, 0x0, 0, 0}, {306, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {306, 0x0, 0, 0}, {306, 0x0, 0, 0}, {306, 0x0, 0, 0},
+  {306, 0x0, 0, 0}, {306, 0x0, 0, 0}, {306, 0x0, 0, 0},
+  {306, 0x0, 0, 0}, {306, 0x0, 0, 0}, {306, 0x0, 0, 0},
+  {306, 0x0, 0, 0}, {306, 0x0, 0, 0}, {306, 0x0, 0, 0},
+  {306, 0x0, 0, 0}, {306, 0x0, 0, 0}, {306, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {306, 0x0, 0, 0}, {306, 0x0, 0, 0},
+  {306, 0x0, 0, 0}, {306, 0x0, 0, 0}, {306, 0x0, 0, 0},
+  {306, 0x0, 0, 0}, {306, 0x0, 0, 0}, {306, 0x0, 0, 0},
+  {306, 0x0, 0, 0}, {306, 0x0, 0, 0}, {306, 0x0, 0, 0},
+  {306, 0x0, 0, 0}, {306, 0x0, 0, 0}, {306, 0x0, 0, 0},
+  {306, 0x0, 0, 0}, {0, 0x0, 0, 0}, {306, 0x0, 0, 0},
+  {306, 0x0, 0, 0}, {306, 0x0, 0, 0}, {306, 0x0, 0, 0},
+  {306, 0x0, 0, 0}, {306, 0x0, 0, 0}, {306, 0x0, 0, 0},
+  {306, 0x0, 0, 0}, {306, 0x0, 0, 0}, {306, 0x0, 0, 0},
+  {306, 0x0, 0, 0}, {306, 0x0, 0, 0}, {306, 0x0, 0, 0},
+  {306, 0x0, 0, 0}, {306, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {306, 0x0, 0, 0}, {306, 0x0, 0, 0}, {306, 0x0, 0, 0},
+  {306, 0x0, 0, 0}, {306, 0x0, 0, 0}, {306, 0x0, 0, 0},
+  {306, 0x0, 0, 0}, {306, 0x0, 0, 0}, {306, 0x0, 0, 0},
+  {306, 0x0, 0, 0}, {306, 0x0, 0, 0}, {306, 0x0, 0, 0},
+  {306, 0x0, 0, 0}, {306, 0x0, 0, 0}, {306, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {306, 0x0, 0, 0}, {306, 0x0, 0, 0},
+  {306, 0x0, 0, 0}, {306, 0x0, 0, 0}, {306, 0x0, 0, 0},
+  {306, 0x0, 0, 0}, {306, 0x0, 0, 0}, {306, 0x0, 0, 0},
+  {306, 0x0, 0, 0}, {306, 0x0, 0, 0}, {306, 0x0, 0, 0},
+  {306, 0x0, 0, 0}, {306, 0x0, 0, 0}, {306, 0x0, 0, 0},
+  {306, 0x0, 0, 0}, {0, 0x0, 0, 0}, {306, 0x0, 0, 0},
+  {306, 0x0, 0, 0}, {306, 0x0, 0, 0}, {306, 0x0, 0, 0},
+  {306, 0x0, 0, 0}, {306, 0x0, 0, 0}, {306, 0x0, 0, 0},
+  {306, 0x0, 0, 0}, {306, 0x0, 0, 0}, {306, 0x0, 0, 0},
+  {306, 0x0, 0, 0}, {306, 0x0, 0, 0}, {306, 0x0, 0, 0},
+  {306, 0x0, 0, 0}, {306, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {306, 0x0, 0, 0}, {306, 0x0, 0, 0}, {306, 0x0, 0, 0},
+  {306, 0x0, 0, 0}, {306, 0x0, 0, 0}, {306, 0x0, 0, 0},
+  {306, 0x0, 0, 0}, {306, 0x0, 0, 0}, {306, 0x0, 0, 0},
+  {306, 0x0, 0, 0}, {306, 0x0, 0, 0}, {306, 0x0, 0, 0},
+  {306, 0x0, 0, 0}, {306, 0x0, 0, 0}, {306, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {306, 0x0, 0, 0}, {306, 0x0, 0, 0},
+  {306, 0x0, 0, 0}, {306, 0x0, 0, 0}, {306, 0x0, 0, 0},
+  {306, 0x0, 0, 0}, {306, 0x0, 0, 0}, {306, 0x0, 0, 0},
+  {306, 0x0, 0, 0}, {306, 0x0, 0, 0}, {306, 0x0, 0, 0},
+  {306, 0x0, 0, 0}, {306, 0x0, 0, 0}, {306, 0x0, 0, 0},
+  {306, 0x0, 0, 0}, {0, 0x0, 0, 0}, {306, 0x0, 0, 0},
+  {306, 0x0, 0, 0}, {306, 0x0, 0, 0}, {306, 0x0, 0, 0},
+  {306, 0x0, 0, 0}, {306, 0x0, 0, 0}, {306, 0x0, 0, 0},
+  {306, 0x0, 0, 0}, {306, 0x0, 0, 0}, {306, 0x0, 0, 0},
+  {306, 0x0, 0, 0}, {306, 0x0, 0, 0}, {306, 0x0, 0, 0},
+  {306, 0x0, 0, 0}, {306, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {306, 0x0, 0, 0}, {306, 0x0, 0, 0}, {306, 0x0, 0, 0},
+  {306, 0x0, 0, 0}, {306, 0x0, 0, 0}, {306, 0x0, 0, 0},
+  {306, 0x0, 0, 0}, {306, 0x0, 0, 0}, {306, 0x0, 0, 0},
+  {306, 0x0, 0, 0}, {306, 0x0, 0, 0}, {306, 0x0, 0, 0},
+  {306, 0x0, 0, 0}, {306, 0x0, 0, 0}, {306, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {306, 0x0, 0, 0}, {306, 0x0, 0, 0},
+  {306, 0x0, 0, 0}, {306, 0x0, 0, 0}, {306, 0x0, 0, 0},
+  {306, 0x0, 0, 0}, {306, 0x0, 0, 0}, {306, 0x0, 0, 0},
+  {306, 0x0, 0, 0}, {306, 0x0, 0, 0}, {306, 0x0, 0, 0},
+  {306, 0x0, 0, 0}, {306, 0x0, 0, 0}, {306, 0x0, 0, 0},
+  {306, 0x0, 0, 0}, {0, 0x0, 0, 0}, {306, 0x0, 0, 0},
+  {306, 0x0, 0, 0}, {306, 0x0, 0, 0}, {306, 0x0, 0, 0},
+  {306, 0x0, 0, 0}, {306, 0x0, 0, 0}, {306, 0x0, 0, 0},
+  {306, 0x0, 0, 0}, {306, 0x0, 0, 0}, {306, 0x0, 0, 0},
+  {306, 0x0, 0, 0}, {306, 0x0, 0, 0}, {306, 0x0, 0, 0},
+  {306, 0x0, 0, 0}, {306, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {305, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {3969, 0xff, 12, 1}, {4225, 0x6, 0, 2}, {4231, 0x1, 21, 1},
+  {4233, 0x1, 21, 1}, {3159, 0x3, 10, 1}, {3699, 0x3, 10, 1},
+  {3967, 0x19, 0, 2}, {4227, 0x19, 0, 2}, {287, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {288, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {4235, 0x19, 0, 2}, {4237, 0x19, 0, 2}, {4239, 0x1, 21, 1},
+  {286, 0x0, 0, 0}, {4229, 0x1, 23, 1}, {4241, 0x19, 0, 2},
+  {308, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {4245, 0x6, 0, 2}, {310, 0x0, 0, 0}, {309, 0x0, 0, 0},
+  {4249, 0x1a, 0, 2}, {0, 0x0, 0, 0}, {311, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {312, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {4253, 0x6, 0, 2}, {4255, 0x6, 0, 2}, {313, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {4265, 0x1, 8, 1}, {0, 0x0, 0, 0},
+  {4267, 0x1, 8, 1}, {4269, 0x1, 8, 1}, {4247, 0x12, 0, 2},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {4251, 0x6, 0, 2},
+  {4257, 0x1, 9, 1}, {4259, 0x6, 0, 2}, {314, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {4261, 0x3, 10, 1}, {4271, 0x6, 0, 2},
+  {4273, 0x1, 23, 1}, {307, 0x0, 0, 0}, {4275, 0x6, 0, 2},
+  {0, 0x0, 0, 0}, {318, 0x0, 0, 0}, {318, 0x0, 0, 0},
+  {318, 0x0, 0, 0}, {318, 0x0, 0, 0}, {318, 0x0, 0, 0},
+  {318, 0x0, 0, 0}, {318, 0x0, 0, 0}, {318, 0x0, 0, 0},
+  {318, 0x0, 0, 0}, {318, 0x0, 0, 0}, {318, 0x0, 0, 0},
+  {318, 0x0, 0, 0}, {318, 0x0, 0, 0}, {318, 0x0, 0, 0},
+  {318, 0x0, 0, 0}, {0, 0x0, 0, 0}, {318, 0x0, 0, 0},
+  {318, 0x0, 0, 0}, {318, 0x0, 0, 0}, {318, 0x0, 0, 0},
+  {318, 0x0, 0, 0}, {318, 0x0, 0, 0}, {318, 0x0, 0, 0},
+  {318, 0x0, 0, 0}, {318, 0x0, 0, 0}, {318, 0x0, 0, 0},
+  {318, 0x0, 0, 0}, {318, 0x0, 0, 0}, {318, 0x0, 0, 0},
+  {318, 0x0, 0, 0}, {318, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {318, 0x0, 0, 0}, {318, 0x0, 0, 0}, {318, 0x0, 0, 0},
+  {318, 0x0, 0, 0}, {318, 0x0, 0, 0}, {318, 0x0, 0, 0},
+  {318, 0x0, 0, 0}, {318, 0x0, 0, 0}, {318, 0x0, 0, 0},
+  {318, 0x0, 0, 0}, {318, 0x0, 0, 0}, {318, 0x0, 0, 0},
+  {318, 0x0, 0, 0}, {318, 0x0, 0, 0}, {318, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {318, 0x0, 0, 0}, {318, 0x0, 0, 0},
+  {318, 0x0, 0, 0}, {318, 0x0, 0, 0}, {318, 0x0, 0, 0},
+  {318, 0x0, 0, 0}, {318, 0x0, 0, 0}, {318, 0x0, 0, 0},
+  {318, 0x0, 0, 0}, {318, 0x0, 0, 0}, {318, 0x0, 0, 0},
+  {318, 0x0, 0, 0}, {318, 0x0, 0, 0}, {318, 0x0, 0, 0},
+  {318, 0x0, 0, 0}, {0, 0x0, 0, 0}, {318, 0x0, 0, 0},
+  {318, 0x0, 0, 0}, {318, 0x0, 0, 0}, {318, 0x0, 0, 0},
+  {318, 0x0, 0, 0}, {318, 0x0, 0, 0}, {318, 0x0, 0, 0},
+  {318, 0x0, 0, 0}, {318, 0x0, 0, 0}, {318, 0x0, 0, 0},
+  {318, 0x0, 0, 0}, {318, 0x0, 0, 0}, {318, 0x0, 0, 0},
+  {318, 0x0, 0, 0}, {318, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {318, 0x0, 0, 0}, {318, 0x0, 0, 0}, {318, 0x0, 0, 0},
+  {318, 0x0, 0, 0}, {318, 0x0, 0, 0}, {318, 0x0, 0, 0},
+  {318, 0x0, 0, 0}, {318, 0x0, 0, 0}, {318, 0x0, 0, 0},
+  {318, 0x0, 0, 0}, {318, 0x0, 0, 0}, {318, 0x0, 0, 0},
+  {318, 0x0, 0, 0}, {318, 0x0, 0, 0}, {318, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {318, 0x0, 0, 0}, {318, 0x0, 0, 0},
+  {318, 0x0, 0, 0}, {318, 0x0, 0, 0}, {318, 0x0, 0, 0},
+  {318, 0x0, 0, 0}, {318, 0x0, 0, 0}, {318, 0x0, 0, 0},
+  {318, 0x0, 0, 0}, {318, 0x0, 0, 0}, {318, 0x0, 0, 0},
+  {318, 0x0, 0, 0}, {318, 0x0, 0, 0}, {318, 0x0, 0, 0},
+  {318, 0x0, 0, 0}, {0, 0x0, 0, 0}, {318, 0x0, 0, 0},
+  {318, 0x0, 0, 0}, {318, 0x0, 0, 0}, {318, 0x0, 0, 0},
+  {318, 0x0, 0, 0}, {318, 0x0, 0, 0}, {318, 0x0, 0, 0},
+  {318, 0x0, 0, 0}, {318, 0x0, 0, 0}, {318, 0x0, 0, 0},
+  {318, 0x0, 0, 0}, {318, 0x0, 0, 0}, {318, 0x0, 0, 0},
+  {318, 0x0, 0, 0}, {318, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {318, 0x0, 0, 0}, {318, 0x0, 0, 0}, {318, 0x0, 0, 0},
+  {318, 0x0, 0, 0}, {318, 0x0, 0, 0}, {318, 0x0, 0, 0},
+  {318, 0x0, 0, 0}, {318, 0x0, 0, 0}, {318, 0x0, 0, 0},
+  {318, 0x0, 0, 0}, {318, 0x0, 0, 0}, {318, 0x0, 0, 0},
+  {318, 0x0, 0, 0}, {318, 0x0, 0, 0}, {318, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {318, 0x0, 0, 0}, {318, 0x0, 0, 0},
+  {318, 0x0, 0, 0}, {318, 0x0, 0, 0}, {318, 0x0, 0, 0},
+  {318, 0x0, 0, 0}, {318, 0x0, 0, 0}, {318, 0x0, 0, 0},
+  {318, 0x0, 0, 0}, {318, 0x0, 0, 0}, {318, 0x0, 0, 0},
+  {318, 0x0, 0, 0}, {318, 0x0, 0, 0}, {318, 0x0, 0, 0},
+  {318, 0x0, 0, 0}, {0, 0x0, 0, 0}, {318, 0x0, 0, 0},
+  {318, 0x0, 0, 0}, {318, 0x0, 0, 0}, {318, 0x0, 0, 0},
+  {318, 0x0, 0, 0}, {318, 0x0, 0, 0}, {318, 0x0, 0, 0},
+  {318, 0x0, 0, 0}, {318, 0x0, 0, 0}, {318, 0x0, 0, 0},
+  {318, 0x0, 0, 0}, {318, 0x0, 0, 0}, {318, 0x0, 0, 0},
+  {318, 0x0, 0, 0}, {318, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {318, 0x0, 0, 0}, {318, 0x0, 0, 0}, {318, 0x0, 0, 0},
+  {318, 0x0, 0, 0}, {318, 0x0, 0, 0}, {318, 0x0, 0, 0},
+  {318, 0x0, 0, 0}, {318, 0x0, 0, 0}, {318, 0x0, 0, 0},
+  {318, 0x0, 0, 0}, {318, 0x0, 0, 0}, {318, 0x0, 0, 0},
+  {318, 0x0, 0, 0}, {318, 0x0, 0, 0}, {318, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {318, 0x0, 0, 0}, {318, 0x0, 0, 0},
+  {318, 0x0, 0, 0}, {318, 0x0, 0, 0}, {318, 0x0, 0, 0},
+  {318, 0x0, 0, 0}, {318, 0x0, 0, 0}, {318, 0x0, 0, 0},
+  {318, 0x0, 0, 0}, {318, 0x0, 0, 0}, {318, 0x0, 0, 0},
+  {318, 0x0, 0, 0}, {318, 0x0, 0, 0}, {318, 0x0, 0, 0},
+  {318, 0x0, 0, 0}, {0, 0x0, 0, 0}, {318, 0x0, 0, 0},
+  {318, 0x0, 0, 0}, {318, 0x0, 0, 0}, {318, 0x0, 0, 0},
+  {318, 0x0, 0, 0}, {318, 0x0, 0, 0}, {318, 0x0, 0, 0},
+  {318, 0x0, 0, 0}, {318, 0x0, 0, 0}, {318, 0x0, 0, 0},
+  {318, 0x0, 0, 0}, {318, 0x0, 0, 0}, {318, 0x0, 0, 0},
+  {318, 0x0, 0, 0}, {318, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {318, 0x0, 0, 0}, {318, 0x0, 0, 0}, {318, 0x0, 0, 0},
+  {318, 0x0, 0, 0}, {318, 0x0, 0, 0}, {318, 0x0, 0, 0},
+  {318, 0x0, 0, 0}, {318, 0x0, 0, 0}, {318, 0x0, 0, 0},
+  {318, 0x0, 0, 0}, {318, 0x0, 0, 0}, {318, 0x0, 0, 0},
+  {318, 0x0, 0, 0}, {318, 0x0, 0, 0}, {318, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {317, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {4279, 0xff, 12, 1}, {4535, 0x6, 0, 2},
+  {0, 0x0, 0, 0}, {4537, 0x19, 0, 2}, {319, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {321, 0x0, 0, 0}, {321, 0x0, 0, 0},
+  {321, 0x0, 0, 0}, {321, 0x0, 0, 0}, {321, 0x0, 0, 0},
+  {321, 0x0, 0, 0}, {321, 0x0, 0, 0}, {321, 0x0, 0, 0},
+  {321, 0x0, 0, 0}, {321, 0x0, 0, 0}, {321, 0x0, 0, 0},
+  {321, 0x0, 0, 0}, {321, 0x0, 0, 0}, {321, 0x0, 0, 0},
+  {321, 0x0, 0, 0}, {0, 0x0, 0, 0}, {321, 0x0, 0, 0},
+  {321, 0x0, 0, 0}, {321, 0x0, 0, 0}, {321, 0x0, 0, 0},
+  {321, 0x0, 0, 0}, {321, 0x0, 0, 0}, {321, 0x0, 0, 0},
+  {321, 0x0, 0, 0}, {321, 0x0, 0, 0}, {321, 0x0, 0, 0},
+  {321, 0x0, 0, 0}, {321, 0x0, 0, 0}, {321, 0x0, 0, 0},
+  {321, 0x0, 0, 0}, {321, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {321, 0x0, 0, 0}, {321, 0x0, 0, 0}, {321, 0x0, 0, 0},
+  {321, 0x0, 0, 0}, {321, 0x0, 0, 0}, {321, 0x0, 0, 0},
+  {321, 0x0, 0, 0}, {321, 0x0, 0, 0}, {321, 0x0, 0, 0},
+  {321, 0x0, 0, 0}, {321, 0x0, 0, 0}, {321, 0x0, 0, 0},
+  {321, 0x0, 0, 0}, {321, 0x0, 0, 0}, {321, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {321, 0x0, 0, 0}, {321, 0x0, 0, 0},
+  {321, 0x0, 0, 0}, {321, 0x0, 0, 0}, {321, 0x0, 0, 0},
+  {321, 0x0, 0, 0}, {321, 0x0, 0, 0}, {321, 0x0, 0, 0},
+  {321, 0x0, 0, 0}, {321, 0x0, 0, 0}, {321, 0x0, 0, 0},
+  {321, 0x0, 0, 0}, {321, 0x0, 0, 0}, {321, 0x0, 0, 0},
+  {321, 0x0, 0, 0}, {0, 0x0, 0, 0}, {321, 0x0, 0, 0},
+  {321, 0x0, 0, 0}, {321, 0x0, 0, 0}, {321, 0x0, 0, 0},
+  {321, 0x0, 0, 0}, {321, 0x0, 0, 0}, {321, 0x0, 0, 0},
+  {321, 0x0, 0, 0}, {321, 0x0, 0, 0}, {321, 0x0, 0, 0},
+  {321, 0x0, 0, 0}, {321, 0x0, 0, 0}, {321, 0x0, 0, 0},
+  {321, 0x0, 0, 0}, {321, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {321, 0x0, 0, 0}, {321, 0x0, 0, 0}, {321, 0x0, 0, 0},
+  {321, 0x0, 0, 0}, {321, 0x0, 0, 0}, {321, 0x0, 0, 0},
+  {321, 0x0, 0, 0}, {321, 0x0, 0, 0}, {321, 0x0, 0, 0},
+  {321, 0x0, 0, 0}, {321, 0x0, 0, 0}, {321, 0x0, 0, 0},
+  {321, 0x0, 0, 0}, {321, 0x0, 0, 0}, {321, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {321, 0x0, 0, 0}, {321, 0x0, 0, 0},
+  {321, 0x0, 0, 0}, {321, 0x0, 0, 0}, {321, 0x0, 0, 0},
+  {321, 0x0, 0, 0}, {321, 0x0, 0, 0}, {321, 0x0, 0, 0},
+  {321, 0x0, 0, 0}, {321, 0x0, 0, 0}, {321, 0x0, 0, 0},
+  {321, 0x0, 0, 0}, {321, 0x0, 0, 0}, {321, 0x0, 0, 0},
+  {321, 0x0, 0, 0}, {0, 0x0, 0, 0}, {321, 0x0, 0, 0},
+  {321, 0x0, 0, 0}, {321, 0x0, 0, 0}, {321, 0x0, 0, 0},
+  {321, 0x0, 0, 0}, {321, 0x0, 0, 0}, {321, 0x0, 0, 0},
+  {321, 0x0, 0, 0}, {321, 0x0, 0, 0}, {321, 0x0, 0, 0},
+  {321, 0x0, 0, 0}, {321, 0x0, 0, 0}, {321, 0x0, 0, 0},
+  {321, 0x0, 0, 0}, {321, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {321, 0x0, 0, 0}, {321, 0x0, 0, 0}, {321, 0x0, 0, 0},
+  {321, 0x0, 0, 0}, {321, 0x0, 0, 0}, {321, 0x0, 0, 0},
+  {321, 0x0, 0, 0}, {321, 0x0, 0, 0}, {321, 0x0, 0, 0},
+  {321, 0x0, 0, 0}, {321, 0x0, 0, 0}, {321, 0x0, 0, 0},
+  {321, 0x0, 0, 0}, {321, 0x0, 0, 0}, {321, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {321, 0x0, 0, 0}, {321, 0x0, 0, 0},
+  {321, 0x0, 0, 0}, {321, 0x0, 0, 0}, {321, 0x0, 0, 0},
+  {321, 0x0, 0, 0}, {321, 0x0, 0, 0}, {321, 0x0, 0, 0},
+  {321, 0x0, 0, 0}, {321, 0x0, 0, 0}, {321, 0x0, 0, 0},
+  {321, 0x0, 0, 0}, {321, 0x0, 0, 0}, {321, 0x0, 0, 0},
+  {321, 0x0, 0, 0}, {0, 0x0, 0, 0}, {321, 0x0, 0, 0},
+  {321, 0x0, 0, 0}, {321, 0x0, 0, 0}, {321, 0x0, 0, 0},
+  {321, 0x0, 0, 0}, {321, 0x0, 0, 0}, {321, 0x0, 0, 0},
+  {321, 0x0, 0, 0}, {321, 0x0, 0, 0}, {321, 0x0, 0, 0},
+  {321, 0x0, 0, 0}, {321, 0x0, 0, 0}, {321, 0x0, 0, 0},
+  {321, 0x0, 0, 0}, {321, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {321, 0x0, 0, 0}, {321, 0x0, 0, 0}, {321, 0x0, 0, 0},
+  {321, 0x0, 0, 0}, {321, 0x0, 0, 0}, {321, 0x0, 0, 0},
+  {321, 0x0, 0, 0}, {321, 0x0, 0, 0}, {321, 0x0, 0, 0},
+  {321, 0x0, 0, 0}, {321, 0x0, 0, 0}, {321, 0x0, 0, 0},
+  {321, 0x0, 0, 0}, {321, 0x0, 0, 0}, {321, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {321, 0x0, 0, 0}, {321, 0x0, 0, 0},
+  {321, 0x0, 0, 0}, {321, 0x0, 0, 0}, {321, 0x0, 0, 0},
+  {321, 0x0, 0, 0}, {321, 0x0, 0, 0}, {321, 0x0, 0, 0},
+  {321, 0x0, 0, 0}, {321, 0x0, 0, 0}, {321, 0x0, 0, 0},
+  {321, 0x0, 0, 0}, {321, 0x0, 0, 0}, {321, 0x0, 0, 0},
+  {321, 0x0, 0, 0}, {0, 0x0, 0, 0}, {321, 0x0, 0, 0},
+  {321, 0x0, 0, 0}, {321, 0x0, 0, 0}, {321, 0x0, 0, 0},
+  {321, 0x0, 0, 0}, {321, 0x0, 0, 0}, {321, 0x0, 0, 0},
+  {321, 0x0, 0, 0}, {321, 0x0, 0, 0}, {321, 0x0, 0, 0},
+  {321, 0x0, 0, 0}, {321, 0x0, 0, 0}, {321, 0x0, 0, 0},
+  {321, 0x0, 0, 0}, {321, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {321, 0x0, 0, 0}, {321, 0x0, 0, 0}, {321, 0x0, 0, 0},
+  {321, 0x0, 0, 0}, {321, 0x0, 0, 0}, {321, 0x0, 0, 0},
+  {321, 0x0, 0, 0}, {321, 0x0, 0, 0}, {321, 0x0, 0, 0},
+  {321, 0x0, 0, 0}, {321, 0x0, 0, 0}, {321, 0x0, 0, 0},
+  {321, 0x0, 0, 0}, {321, 0x0, 0, 0}, {321, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {320, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {4543, 0xff, 12, 1}, {4799, 0x6, 0, 2},
+  {322, 0x0, 0, 0}, {0, 0x0, 0, 0}, {4801, 0x19, 0, 2},
+  {4803, 0x6, 0, 2}, {323, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {4813, 0x1, 8, 1}, {0, 0x0, 0, 0}, {4815, 0x1, 8, 1},
+  {4817, 0x1, 8, 1}, {4539, 0x12, 0, 2}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {4541, 0x6, 0, 2}, {4805, 0x1, 9, 1},
+  {4807, 0x6, 0, 2}, {325, 0x0, 0, 0}, {325, 0x0, 0, 0},
+  {325, 0x0, 0, 0}, {325, 0x0, 0, 0}, {325, 0x0, 0, 0},
+  {325, 0x0, 0, 0}, {325, 0x0, 0, 0}, {325, 0x0, 0, 0},
+  {325, 0x0, 0, 0}, {325, 0x0, 0, 0}, {325, 0x0, 0, 0},
+  {325, 0x0, 0, 0}, {325, 0x0, 0, 0}, {325, 0x0, 0, 0},
+  {325, 0x0, 0, 0}, {0, 0x0, 0, 0}, {325, 0x0, 0, 0},
+  {325, 0x0, 0, 0}, {325, 0x0, 0, 0}, {325, 0x0, 0, 0},
+  {325, 0x0, 0, 0}, {325, 0x0, 0, 0}, {325, 0x0, 0, 0},
+  {325, 0x0, 0, 0}, {325, 0x0, 0, 0}, {325, 0x0, 0, 0},
+  {325, 0x0, 0, 0}, {325, 0x0, 0, 0}, {325, 0x0, 0, 0},
+  {325, 0x0, 0, 0}, {325, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {325, 0x0, 0, 0}, {325, 0x0, 0, 0}, {325, 0x0, 0, 0},
+  {325, 0x0, 0, 0}, {325, 0x0, 0, 0}, {325, 0x0, 0, 0},
+  {325, 0x0, 0, 0}, {325, 0x0, 0, 0}, {325, 0x0, 0, 0},
+  {325, 0x0, 0, 0}, {325, 0x0, 0, 0}, {325, 0x0, 0, 0},
+  {325, 0x0, 0, 0}, {325, 0x0, 0, 0}, {325, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {325, 0x0, 0, 0}, {325, 0x0, 0, 0},
+  {325, 0x0, 0, 0}, {325, 0x0, 0, 0}, {325, 0x0, 0, 0},
+  {325, 0x0, 0, 0}, {325, 0x0, 0, 0}, {325, 0x0, 0, 0},
+  {325, 0x0, 0, 0}, {325, 0x0, 0, 0}, {325, 0x0, 0, 0},
+  {325, 0x0, 0, 0}, {325, 0x0, 0, 0}, {325, 0x0, 0, 0},
+  {325, 0x0, 0, 0}, {0, 0x0, 0, 0}, {325, 0x0, 0, 0},
+  {325, 0x0, 0, 0}, {325, 0x0, 0, 0}, {325, 0x0, 0, 0},
+  {325, 0x0, 0, 0}, {325, 0x0, 0, 0}, {325, 0x0, 0, 0},
+  {325, 0x0, 0, 0}, {325, 0x0, 0, 0}, {325, 0x0, 0, 0},
+  {325, 0x0, 0, 0}, {325, 0x0, 0, 0}, {325, 0x0, 0, 0},
+  {325, 0x0, 0, 0}, {325, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {325, 0x0, 0, 0}, {325, 0x0, 0, 0}, {325, 0x0, 0, 0},
+  {325, 0x0, 0, 0}, {325, 0x0, 0, 0}, {325, 0x0, 0, 0},
+  {325, 0x0, 0, 0}, {325, 0x0, 0, 0}, {325, 0x0, 0, 0},
+  {325, 0x0, 0, 0}, {325, 0x0, 0, 0}, {325, 0x0, 0, 0},
+  {325, 0x0, 0, 0}, {325, 0x0, 0, 0}, {325, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {325, 0x0, 0, 0}, {325, 0x0, 0, 0},
+  {325, 0x0, 0, 0}, {325, 0x0, 0, 0}, {325, 0x0, 0, 0},
+  {325, 0x0, 0, 0}, {325, 0x0, 0, 0}, {325, 0x0, 0, 0},
+  {325, 0x0, 0, 0}, {325, 0x0, 0, 0}, {325, 0x0, 0, 0},
+  {325, 0x0, 0, 0}, {325, 0x0, 0, 0}, {325, 0x0, 0, 0},
+  {325, 0x0, 0, 0}, {0, 0x0, 0, 0}, {325, 0x0, 0, 0},
+  {325, 0x0, 0, 0}, {325, 0x0, 0, 0}, {325, 0x0, 0, 0},
+  {325, 0x0, 0, 0}, {325, 0x0, 0, 0}, {325, 0x0, 0, 0},
+  {325, 0x0, 0, 0}, {325, 0x0, 0, 0}, {325, 0x0, 0, 0},
+  {325, 0x0, 0, 0}, {325, 0x0, 0, 0}, {325, 0x0, 0, 0},
+  {325, 0x0, 0, 0}, {325, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {325, 0x0, 0, 0}, {325, 0x0, 0, 0}, {325, 0x0, 0, 0},
+  {325, 0x0, 0, 0}, {325, 0x0, 0, 0}, {325, 0x0, 0, 0},
+  {325, 0x0, 0, 0}, {325, 0x0, 0, 0}, {325, 0x0, 0, 0},
+  {325, 0x0, 0, 0}, {325, 0x0, 0, 0}, {325, 0x0, 0, 0},
+  {325, 0x0, 0, 0}, {325, 0x0, 0, 0}, {325, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {325, 0x0, 0, 0}, {325, 0x0, 0, 0},
+  {325, 0x0, 0, 0}, {325, 0x0, 0, 0}, {325, 0x0, 0, 0},
+  {325, 0x0, 0, 0}, {325, 0x0, 0, 0}, {325, 0x0, 0, 0},
+  {325, 0x0, 0, 0}, {325, 0x0, 0, 0}, {325, 0x0, 0, 0},
+  {325, 0x0, 0, 0}, {325, 0x0, 0, 0}, {325, 0x0, 0, 0},
+  {325, 0x0, 0, 0}, {0, 0x0, 0, 0}, {325, 0x0, 0, 0},
+  {325, 0x0, 0, 0}, {325, 0x0, 0, 0}, {325, 0x0, 0, 0},
+  {325, 0x0, 0, 0}, {325, 0x0, 0, 0}, {325, 0x0, 0, 0},
+  {325, 0x0, 0, 0}, {325, 0x0, 0, 0}, {325, 0x0, 0, 0},
+  {325, 0x0, 0, 0}, {325, 0x0, 0, 0}, {325, 0x0, 0, 0},
+  {325, 0x0, 0, 0}, {325, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {325, 0x0, 0, 0}, {325, 0x0, 0, 0}, {325, 0x0, 0, 0},
+  {325, 0x0, 0, 0}, {325, 0x0, 0, 0}, {325, 0x0, 0, 0},
+  {325, 0x0, 0, 0}, {325, 0x0, 0, 0}, {325, 0x0, 0, 0},
+  {325, 0x0, 0, 0}, {325, 0x0, 0, 0}, {325, 0x0, 0, 0},
+  {325, 0x0, 0, 0}, {325, 0x0, 0, 0}, {325, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {325, 0x0, 0, 0}, {325, 0x0, 0, 0},
+  {325, 0x0, 0, 0}, {325, 0x0, 0, 0}, {325, 0x0, 0, 0},
+  {325, 0x0, 0, 0}, {325, 0x0, 0, 0}, {325, 0x0, 0, 0},
+  {325, 0x0, 0, 0}, {325, 0x0, 0, 0}, {325, 0x0, 0, 0},
+  {325, 0x0, 0, 0}, {325, 0x0, 0, 0}, {325, 0x0, 0, 0},
+  {325, 0x0, 0, 0}, {0, 0x0, 0, 0}, {325, 0x0, 0, 0},
+  {325, 0x0, 0, 0}, {325, 0x0, 0, 0}, {325, 0x0, 0, 0},
+  {325, 0x0, 0, 0}, {325, 0x0, 0, 0}, {325, 0x0, 0, 0},
+  {325, 0x0, 0, 0}, {325, 0x0, 0, 0}, {325, 0x0, 0, 0},
+  {325, 0x0, 0, 0}, {325, 0x0, 0, 0}, {325, 0x0, 0, 0},
+  {325, 0x0, 0, 0}, {325, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {325, 0x0, 0, 0}, {325, 0x0, 0, 0}, {325, 0x0, 0, 0},
+  {325, 0x0, 0, 0}, {325, 0x0, 0, 0}, {325, 0x0, 0, 0},
+  {325, 0x0, 0, 0}, {325, 0x0, 0, 0}, {325, 0x0, 0, 0},
+  {325, 0x0, 0, 0}, {325, 0x0, 0, 0}, {325, 0x0, 0, 0},
+  {325, 0x0, 0, 0}, {325, 0x0, 0, 0}, {325, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {324, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {4819, 0xff, 12, 1}, {5075, 0x6, 0, 2},
+  {4809, 0x3, 10, 1}, {5077, 0x19, 0, 2}, {316, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {5081, 0x19, 0, 2}, {315, 0x0, 0, 0},
+  {5079, 0x1, 23, 1}, {5083, 0x19, 0, 2}, {327, 0x0, 0, 0},
+  {327, 0x0, 0, 0}, {327, 0x0, 0, 0}, {327, 0x0, 0, 0},
+  {327, 0x0, 0, 0}, {327, 0x0, 0, 0}, {327, 0x0, 0, 0},
+  {327, 0x0, 0, 0}, {327, 0x0, 0, 0}, {327, 0x0, 0, 0},
+  {327, 0x0, 0, 0}, {327, 0x0, 0, 0}, {327, 0x0, 0, 0},
+  {327, 0x0, 0, 0}, {327, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {327, 0x0, 0, 0}, {327, 0x0, 0, 0}, {327, 0x0, 0, 0},
+  {327, 0x0, 0, 0}, {327, 0x0, 0, 0}, {327, 0x0, 0, 0},
+  {327, 0x0, 0, 0}, {327, 0x0, 0, 0}, {327, 0x0, 0, 0},
+  {327, 0x0, 0, 0}, {327, 0x0, 0, 0}, {327, 0x0, 0, 0},
+  {327, 0x0, 0, 0}, {327, 0x0, 0, 0}, {327, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {327, 0x0, 0, 0}, {327, 0x0, 0, 0},
+  {327, 0x0, 0, 0}, {327, 0x0, 0, 0}, {327, 0x0, 0, 0},
+  {327, 0x0, 0, 0}, {327, 0x0, 0, 0}, {327, 0x0, 0, 0},
+  {327, 0x0, 0, 0}, {327, 0x0, 0, 0}, {327, 0x0, 0, 0},
+  {327, 0x0, 0, 0}, {327, 0x0, 0, 0}, {327, 0x0, 0, 0},
+  {327, 0x0, 0, 0}, {0, 0x0, 0, 0}, {327, 0x0, 0, 0},
+  {327, 0x0, 0, 0}, {327, 0x0, 0, 0}, {327, 0x0, 0, 0},
+  {327, 0x0, 0, 0}, {327, 0x0, 0, 0}, {327, 0x0, 0, 0},
+  {327, 0x0, 0, 0}, {327, 0x0, 0, 0}, {327, 0x0, 0, 0},
+  {327, 0x0, 0, 0}, {327, 0x0, 0, 0}, {327, 0x0, 0, 0},
+  {327, 0x0, 0, 0}, {327, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {327, 0x0, 0, 0}, {327, 0x0, 0, 0}, {327, 0x0, 0, 0},
+  {327, 0x0, 0, 0}, {327, 0x0, 0, 0}, {327, 0x0, 0, 0},
+  {327, 0x0, 0, 0}, {327, 0x0, 0, 0}, {327, 0x0, 0, 0},
+  {327, 0x0, 0, 0}, {327, 0x0, 0, 0}, {327, 0x0, 0, 0},
+  {327, 0x0, 0, 0}, {327, 0x0, 0, 0}, {327, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {327, 0x0, 0, 0}, {327, 0x0, 0, 0},
+  {327, 0x0, 0, 0}, {327, 0x0, 0, 0}, {327, 0x0, 0, 0},
+  {327, 0x0, 0, 0}, {327, 0x0, 0, 0}, {327, 0x0, 0, 0},
+  {327, 0x0, 0, 0}, {327, 0x0, 0, 0}, {327, 0x0, 0, 0},
+  {327, 0x0, 0, 0}, {327, 0x0, 0, 0}, {327, 0x0, 0, 0},
+  {327, 0x0, 0, 0}, {0, 0x0, 0, 0}, {327, 0x0, 0, 0},
+  {327, 0x0, 0, 0}, {327, 0x0, 0, 0}, {327, 0x0, 0, 0},
+  {327, 0x0, 0, 0}, {327, 0x0, 0, 0}, {327, 0x0, 0, 0},
+  {327, 0x0, 0, 0}, {327, 0x0, 0, 0}, {327, 0x0, 0, 0},
+  {327, 0x0, 0, 0}, {327, 0x0, 0, 0}, {327, 0x0, 0, 0},
+  {327, 0x0, 0, 0}, {327, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {327, 0x0, 0, 0}, {327, 0x0, 0, 0}, {327, 0x0, 0, 0},
+  {327, 0x0, 0, 0}, {327, 0x0, 0, 0}, {327, 0x0, 0, 0},
+  {327, 0x0, 0, 0}, {327, 0x0, 0, 0}, {327, 0x0, 0, 0},
+  {327, 0x0, 0, 0}, {327, 0x0, 0, 0}, {327, 0x0, 0, 0},
+  {327, 0x0, 0, 0}, {327, 0x0, 0, 0}, {327, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {327, 0x0, 0, 0}, {327, 0x0, 0, 0},
+  {327, 0x0, 0, 0}, {327, 0x0, 0, 0}, {327, 0x0, 0, 0},
+  {327, 0x0, 0, 0}, {327, 0x0, 0, 0}, {327, 0x0, 0, 0},
+  {327, 0x0, 0, 0}, {327, 0x0, 0, 0}, {327, 0x0, 0, 0},
+  {327, 0x0, 0, 0}, {327, 0x0, 0, 0}, {327, 0x0, 0, 0},
+  {327, 0x0, 0, 0}, {0, 0x0, 0, 0}, {327, 0x0, 0, 0},
+  {327, 0x0, 0, 0}, {327, 0x0, 0, 0}, {327, 0x0, 0, 0},
+  {327, 0x0, 0, 0}, {327, 0x0, 0, 0}, {327, 0x0, 0, 0},
+  {327, 0x0, 0, 0}, {327, 0x0, 0, 0}, {327, 0x0, 0, 0},
+  {327, 0x0, 0, 0}, {327, 0x0, 0, 0}, {327, 0x0, 0, 0},
+  {327, 0x0, 0, 0}, {327, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {327, 0x0, 0, 0}, {327, 0x0, 0, 0}, {327, 0x0, 0, 0},
+  {327, 0x0, 0, 0}, {327, 0x0, 0, 0}, {327, 0x0, 0, 0},
+  {327, 0x0, 0, 0}, {327, 0x0, 0, 0}, {327, 0x0, 0, 0},
+  {327, 0x0, 0, 0}, {327, 0x0, 0, 0}, {327, 0x0, 0, 0},
+  {327, 0x0, 0, 0}, {327, 0x0, 0, 0}, {327, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {327, 0x0, 0, 0}, {327, 0x0, 0, 0},
+  {327, 0x0, 0, 0}, {327, 0x0, 0, 0}, {327, 0x0, 0, 0},
+  {327, 0x0, 0, 0}, {327, 0x0, 0, 0}, {327, 0x0, 0, 0},
+  {327, 0x0, 0, 0}, {327, 0x0, 0, 0}, {327, 0x0, 0, 0},
+  {327, 0x0, 0, 0}, {327, 0x0, 0, 0}, {327, 0x0, 0, 0},
+  {327, 0x0, 0, 0}, {0, 0x0, 0, 0}, {327, 0x0, 0, 0},
+  {327, 0x0, 0, 0}, {327, 0x0, 0, 0}, {327, 0x0, 0, 0},
+  {327, 0x0, 0, 0}, {327, 0x0, 0, 0}, {327, 0x0, 0, 0},
+  {327, 0x0, 0, 0}, {327, 0x0, 0, 0}, {327, 0x0, 0, 0},
+  {327, 0x0, 0, 0}, {327, 0x0, 0, 0}, {327, 0x0, 0, 0},
+  {327, 0x0, 0, 0}, {327, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {327, 0x0, 0, 0}, {327, 0x0, 0, 0}, {327, 0x0, 0, 0},
+  {327, 0x0, 0, 0}, {327, 0x0, 0, 0}, {327, 0x0, 0, 0},
+  {327, 0x0, 0, 0}, {327, 0x0, 0, 0}, {327, 0x0, 0, 0},
+  {327, 0x0, 0, 0}, {327, 0x0, 0, 0}, {327, 0x0, 0, 0},
+  {327, 0x0, 0, 0}, {327, 0x0, 0, 0}, {327, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {327, 0x0, 0, 0}, {327, 0x0, 0, 0},
+  {327, 0x0, 0, 0}, {327, 0x0, 0, 0}, {327, 0x0, 0, 0},
+  {327, 0x0, 0, 0}, {327, 0x0, 0, 0}, {327, 0x0, 0, 0},
+  {327, 0x0, 0, 0}, {327, 0x0, 0, 0}, {327, 0x0, 0, 0},
+  {327, 0x0, 0, 0}, {327, 0x0, 0, 0}, {327, 0x0, 0, 0},
+  {327, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {5087, 0xff, 12, 1}, {328, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {329, 0x0, 0, 0}, {329, 0x0, 0, 0},
+  {329, 0x0, 0, 0}, {329, 0x0, 0, 0}, {329, 0x0, 0, 0},
+  {329, 0x0, 0, 0}, {329, 0x0, 0, 0}, {329, 0x0, 0, 0},
+  {329, 0x0, 0, 0}, {329, 0x0, 0, 0}, {329, 0x0, 0, 0},
+  {329, 0x0, 0, 0}, {329, 0x0, 0, 0}, {329, 0x0, 0, 0},
+  {329, 0x0, 0, 0}, {0, 0x0, 0, 0}, {329, 0x0, 0, 0},
+  {329, 0x0, 0, 0}, {329, 0x0, 0, 0}, {329, 0x0, 0, 0},
+  {329, 0x0, 0, 0}, {329, 0x0, 0, 0}, {329, 0x0, 0, 0},
+  {329, 0x0, 0, 0}, {329, 0x0, 0, 0}, {329, 0x0, 0, 0},
+  {329, 0x0, 0, 0}, {329, 0x0, 0, 0}, {329, 0x0, 0, 0},
+  {329, 0x0, 0, 0}, {329, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {329, 0x0, 0, 0}, {329, 0x0, 0, 0}, {329, 0x0, 0, 0},
+  {329, 0x0, 0, 0}, {329, 0x0, 0, 0}, {329, 0x0, 0, 0},
+  {329, 0x0, 0, 0}, {329, 0x0, 0, 0}, {329, 0x0, 0, 0},
+  {329, 0x0, 0, 0}, {329, 0x0, 0, 0}, {329, 0x0, 0, 0},
+  {329, 0x0, 0, 0}, {329, 0x0, 0, 0}, {329, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {329, 0x0, 0, 0}, {329, 0x0, 0, 0},
+  {329, 0x0, 0, 0}, {329, 0x0, 0, 0}, {329, 0x0, 0, 0},
+  {329, 0x0, 0, 0}, {329, 0x0, 0, 0}, {329, 0x0, 0, 0},
+  {329, 0x0, 0, 0}, {329, 0x0, 0, 0}, {329, 0x0, 0, 0},
+  {329, 0x0, 0, 0}, {329, 0x0, 0, 0}, {329, 0x0, 0, 0},
+  {329, 0x0, 0, 0}, {0, 0x0, 0, 0}, {329, 0x0, 0, 0},
+  {329, 0x0, 0, 0}, {329, 0x0, 0, 0}, {329, 0x0, 0, 0},
+  {329, 0x0, 0, 0}, {329, 0x0, 0, 0}, {329, 0x0, 0, 0},
+  {329, 0x0, 0, 0}, {329, 0x0, 0, 0}, {329, 0x0, 0, 0},
+  {329, 0x0, 0, 0}, {329, 0x0, 0, 0}, {329, 0x0, 0, 0},
+  {329, 0x0, 0, 0}, {329, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {329, 0x0, 0, 0}, {329, 0x0, 0, 0}, {329, 0x0, 0, 0},
+  {329, 0x0, 0, 0}, {329, 0x0, 0, 0}, {329, 0x0, 0, 0},
+  {329, 0x0, 0, 0}, {329, 0x0, 0, 0}, {329, 0x0, 0, 0},
+  {329, 0x0, 0, 0}, {329, 0x0, 0, 0}, {329, 0x0, 0, 0},
+  {329, 0x0, 0, 0}, {329, 0x0, 0, 0}, {329, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {329, 0x0, 0, 0}, {329, 0x0, 0, 0},
+  {329, 0x0, 0, 0}, {329, 0x0, 0, 0}, {329, 0x0, 0, 0},
+  {329, 0x0, 0, 0}, {329, 0x0, 0, 0}, {329, 0x0, 0, 0},
+  {329, 0x0, 0, 0}, {329, 0x0, 0, 0}, {329, 0x0, 0, 0},
+  {329, 0x0, 0, 0}, {329, 0x0, 0, 0}, {329, 0x0, 0, 0},
+  {329, 0x0, 0, 0}, {0, 0x0, 0, 0}, {329, 0x0, 0, 0},
+  {329, 0x0, 0, 0}, {329, 0x0, 0, 0}, {329, 0x0, 0, 0},
+  {329, 0x0, 0, 0}, {329, 0x0, 0, 0}, {329, 0x0, 0, 0},
+  {329, 0x0, 0, 0}, {329, 0x0, 0, 0}, {329, 0x0, 0, 0},
+  {329, 0x0, 0, 0}, {329, 0x0, 0, 0}, {329, 0x0, 0, 0},
+  {329, 0x0, 0, 0}, {329, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {329, 0x0, 0, 0}, {329, 0x0, 0, 0}, {329, 0x0, 0, 0},
+  {329, 0x0, 0, 0}, {329, 0x0, 0, 0}, {329, 0x0, 0, 0},
+  {329, 0x0, 0, 0}, {329, 0x0, 0, 0}, {329, 0x0, 0, 0},
+  {329, 0x0, 0, 0}, {329, 0x0, 0, 0}, {329, 0x0, 0, 0},
+  {329, 0x0, 0, 0}, {329, 0x0, 0, 0}, {329, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {329, 0x0, 0, 0}, {329, 0x0, 0, 0},
+  {329, 0x0, 0, 0}, {329, 0x0, 0, 0}, {329, 0x0, 0, 0},
+  {329, 0x0, 0, 0}, {329, 0x0, 0, 0}, {329, 0x0, 0, 0},
+  {329, 0x0, 0, 0}, {329, 0x0, 0, 0}, {329, 0x0, 0, 0},
+  {329, 0x0, 0, 0}, {329, 0x0, 0, 0}, {329, 0x0, 0, 0},
+  {329, 0x0, 0, 0}, {0, 0x0, 0, 0}, {329, 0x0, 0, 0},
+  {329, 0x0, 0, 0}, {329, 0x0, 0, 0}, {329, 0x0, 0, 0},
+  {329, 0x0, 0, 0}, {329, 0x0, 0, 0}, {329, 0x0, 0, 0},
+  {329, 0x0, 0, 0}, {329, 0x0, 0, 0}, {329, 0x0, 0, 0},
+  {329, 0x0, 0, 0}, {329, 0x0, 0, 0}, {329, 0x0, 0, 0},
+  {329, 0x0, 0, 0}, {329, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {329, 0x0, 0, 0}, {329, 0x0, 0, 0}, {329, 0x0, 0, 0},
+  {329, 0x0, 0, 0}, {329, 0x0, 0, 0}, {329, 0x0, 0, 0},
+  {329, 0x0, 0, 0}, {329, 0x0, 0, 0}, {329, 0x0, 0, 0},
+  {329, 0x0, 0, 0}, {329, 0x0, 0, 0}, {329, 0x0, 0, 0},
+  {329, 0x0, 0, 0}, {329, 0x0, 0, 0}, {329, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {329, 0x0, 0, 0}, {329, 0x0, 0, 0},
+  {329, 0x0, 0, 0}, {329, 0x0, 0, 0}, {329, 0x0, 0, 0},
+  {329, 0x0, 0, 0}, {329, 0x0, 0, 0}, {329, 0x0, 0, 0},
+  {329, 0x0, 0, 0}, {329, 0x0, 0, 0}, {329, 0x0, 0, 0},
+  {329, 0x0, 0, 0}, {329, 0x0, 0, 0}, {329, 0x0, 0, 0},
+  {329, 0x0, 0, 0}, {0, 0x0, 0, 0}, {329, 0x0, 0, 0},
+  {329, 0x0, 0, 0}, {329, 0x0, 0, 0}, {329, 0x0, 0, 0},
+  {329, 0x0, 0, 0}, {329, 0x0, 0, 0}, {329, 0x0, 0, 0},
+  {329, 0x0, 0, 0}, {329, 0x0, 0, 0}, {329, 0x0, 0, 0},
+  {329, 0x0, 0, 0}, {329, 0x0, 0, 0}, {329, 0x0, 0, 0},
+  {329, 0x0, 0, 0}, {329, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {329, 0x0, 0, 0}, {329, 0x0, 0, 0}, {329, 0x0, 0, 0},
+  {329, 0x0, 0, 0}, {329, 0x0, 0, 0}, {329, 0x0, 0, 0},
+  {329, 0x0, 0, 0}, {329, 0x0, 0, 0}, {329, 0x0, 0, 0},
+  {329, 0x0, 0, 0}, {329, 0x0, 0, 0}, {329, 0x0, 0, 0},
+  {329, 0x0, 0, 0}, {329, 0x0, 0, 0}, {329, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {330, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {5347, 0xff, 12, 1}, {5603, 0x6, 0, 2},
+  {331, 0x0, 0, 0}, {0, 0x0, 0, 0}, {5613, 0x1, 8, 1},
+  {0, 0x0, 0, 0}, {5615, 0x1, 8, 1}, {5617, 0x1, 8, 1},
+  {5343, 0x12, 0, 2}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {5345, 0x6, 0, 2}, {5605, 0x1, 9, 1}, {5607, 0x6, 0, 2},
+  {332, 0x0, 0, 0}, {332, 0x0, 0, 0}, {332, 0x0, 0, 0},
+  {332, 0x0, 0, 0}, {332, 0x0, 0, 0}, {332, 0x0, 0, 0},
+  {332, 0x0, 0, 0}, {332, 0x0, 0, 0}, {332, 0x0, 0, 0},
+  {332, 0x0, 0, 0}, {332, 0x0, 0, 0}, {332, 0x0, 0, 0},
+  {332, 0x0, 0, 0}, {332, 0x0, 0, 0}, {332, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {332, 0x0, 0, 0}, {332, 0x0, 0, 0},
+  {332, 0x0, 0, 0}, {332, 0x0, 0, 0}, {332, 0x0, 0, 0},
+  {332, 0x0, 0, 0}, {332, 0x0, 0, 0}, {332, 0x0, 0, 0},
+  {332, 0x0, 0, 0}, {332, 0x0, 0, 0}, {332, 0x0, 0, 0},
+  {332, 0x0, 0, 0}, {332, 0x0, 0, 0}, {332, 0x0, 0, 0},
+  {332, 0x0, 0, 0}, {0, 0x0, 0, 0}, {332, 0x0, 0, 0},
+  {332, 0x0, 0, 0}, {332, 0x0, 0, 0}, {332, 0x0, 0, 0},
+  {332, 0x0, 0, 0}, {332, 0x0, 0, 0}, {332, 0x0, 0, 0},
+  {332, 0x0, 0, 0}, {332, 0x0, 0, 0}, {332, 0x0, 0, 0},
+  {332, 0x0, 0, 0}, {332, 0x0, 0, 0}, {332, 0x0, 0, 0},
+  {332, 0x0, 0, 0}, {332, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {332, 0x0, 0, 0}, {332, 0x0, 0, 0}, {332, 0x0, 0, 0},
+  {332, 0x0, 0, 0}, {332, 0x0, 0, 0}, {332, 0x0, 0, 0},
+  {332, 0x0, 0, 0}, {332, 0x0, 0, 0}, {332, 0x0, 0, 0},
+  {332, 0x0, 0, 0}, {332, 0x0, 0, 0}, {332, 0x0, 0, 0},
+  {332, 0x0, 0, 0}, {332, 0x0, 0, 0}, {332, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {332, 0x0, 0, 0}, {332, 0x0, 0, 0},
+  {332, 0x0, 0, 0}, {332, 0x0, 0, 0}, {332, 0x0, 0, 0},
+  {332, 0x0, 0, 0}, {332, 0x0, 0, 0}, {332, 0x0, 0, 0},
+  {332, 0x0, 0, 0}, {332, 0x0, 0, 0}, {332, 0x0, 0, 0},
+  {332, 0x0, 0, 0}, {332, 0x0, 0, 0}, {332, 0x0, 0, 0},
+  {332, 0x0, 0, 0}, {0, 0x0, 0, 0}, {332, 0x0, 0, 0},
+  {332, 0x0, 0, 0}, {332, 0x0, 0, 0}, {332, 0x0, 0, 0},
+  {332, 0x0, 0, 0}, {332, 0x0, 0, 0}, {332, 0x0, 0, 0},
+  {332, 0x0, 0, 0}, {332, 0x0, 0, 0}, {332, 0x0, 0, 0},
+  {332, 0x0, 0, 0}, {332, 0x0, 0, 0}, {332, 0x0, 0, 0},
+  {332, 0x0, 0, 0}, {332, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {332, 0x0, 0, 0}, {332, 0x0, 0, 0}, {332, 0x0, 0, 0},
+  {332, 0x0, 0, 0}, {332, 0x0, 0, 0}, {332, 0x0, 0, 0},
+  {332, 0x0, 0, 0}, {332, 0x0, 0, 0}, {332, 0x0, 0, 0},
+  {332, 0x0, 0, 0}, {332, 0x0, 0, 0}, {332, 0x0, 0, 0},
+  {332, 0x0, 0, 0}, {332, 0x0, 0, 0}, {332, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {332, 0x0, 0, 0}, {332, 0x0, 0, 0},
+  {332, 0x0, 0, 0}, {332, 0x0, 0, 0}, {332, 0x0, 0, 0},
+  {332, 0x0, 0, 0}, {332, 0x0, 0, 0}, {332, 0x0, 0, 0},
+  {332, 0x0, 0, 0}, {332, 0x0, 0, 0}, {332, 0x0, 0, 0},
+  {332, 0x0, 0, 0}, {332, 0x0, 0, 0}, {332, 0x0, 0, 0},
+  {332, 0x0, 0, 0}, {0, 0x0, 0, 0}, {332, 0x0, 0, 0},
+  {332, 0x0, 0, 0}, {332, 0x0, 0, 0}, {332, 0x0, 0, 0},
+  {332, 0x0, 0, 0}, {332, 0x0, 0, 0}, {332, 0x0, 0, 0},
+  {332, 0x0, 0, 0}, {332, 0x0, 0, 0}, {332, 0x0, 0, 0},
+  {332, 0x0, 0, 0}, {332, 0x0, 0, 0}, {332, 0x0, 0, 0},
+  {332, 0x0, 0, 0}, {332, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {332, 0x0, 0, 0}, {332, 0x0, 0, 0}, {332, 0x0, 0, 0},
+  {332, 0x0, 0, 0}, {332, 0x0, 0, 0}, {332, 0x0, 0, 0},
+  {332, 0x0, 0, 0}, {332, 0x0, 0, 0}, {332, 0x0, 0, 0},
+  {332, 0x0, 0, 0}, {332, 0x0, 0, 0}, {332, 0x0, 0, 0},
+  {332, 0x0, 0, 0}, {332, 0x0, 0, 0}, {332, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {332, 0x0, 0, 0}, {332, 0x0, 0, 0},
+  {332, 0x0, 0, 0}, {332, 0x0, 0, 0}, {332, 0x0, 0, 0},
+  {332, 0x0, 0, 0}, {332, 0x0, 0, 0}, {332, 0x0, 0, 0},
+  {332, 0x0, 0, 0}, {332, 0x0, 0, 0}, {332, 0x0, 0, 0},
+  {332, 0x0, 0, 0}, {332, 0x0, 0, 0}, {332, 0x0, 0, 0},
+  {332, 0x0, 0, 0}, {0, 0x0, 0, 0}, {332, 0x0, 0, 0},
+  {332, 0x0, 0, 0}, {332, 0x0, 0, 0}, {332, 0x0, 0, 0},
+  {332, 0x0, 0, 0}, {332, 0x0, 0, 0}, {332, 0x0, 0, 0},
+  {332, 0x0, 0, 0}, {332, 0x0, 0, 0}, {332, 0x0, 0, 0},
+  {332, 0x0, 0, 0}, {332, 0x0, 0, 0}, {332, 0x0, 0, 0},
+  {332, 0x0, 0, 0}, {332, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {332, 0x0, 0, 0}, {332, 0x0, 0, 0}, {332, 0x0, 0, 0},
+  {332, 0x0, 0, 0}, {332, 0x0, 0, 0}, {332, 0x0, 0, 0},
+  {332, 0x0, 0, 0}, {332, 0x0, 0, 0}, {332, 0x0, 0, 0},
+  {332, 0x0, 0, 0}, {332, 0x0, 0, 0}, {332, 0x0, 0, 0},
+  {332, 0x0, 0, 0}, {332, 0x0, 0, 0}, {332, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {332, 0x0, 0, 0}, {332, 0x0, 0, 0},
+  {332, 0x0, 0, 0}, {332, 0x0, 0, 0}, {332, 0x0, 0, 0},
+  {332, 0x0, 0, 0}, {332, 0x0, 0, 0}, {332, 0x0, 0, 0},
+  {332, 0x0, 0, 0}, {332, 0x0, 0, 0}, {332, 0x0, 0, 0},
+  {332, 0x0, 0, 0}, {332, 0x0, 0, 0}, {332, 0x0, 0, 0},
+  {332, 0x0, 0, 0}, {0, 0x0, 0, 0}, {332, 0x0, 0, 0},
+  {332, 0x0, 0, 0}, {332, 0x0, 0, 0}, {332, 0x0, 0, 0},
+  {332, 0x0, 0, 0}, {332, 0x0, 0, 0}, {332, 0x0, 0, 0},
+  {332, 0x0, 0, 0}, {332, 0x0, 0, 0}, {332, 0x0, 0, 0},
+  {332, 0x0, 0, 0}, {332, 0x0, 0, 0}, {332, 0x0, 0, 0},
+  {332, 0x0, 0, 0}, {332, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {5609, 0x3, 10, 1}, {5619, 0xff, 12, 1},
+  {326, 0x0, 0, 0}, {0, 0x0, 0, 0}, {5875, 0x1, 23, 1},
+  {5877, 0x19, 0, 2}, {5085, 0x6, 0, 2}, {5879, 0x6, 0, 2},
+  {5885, 0x1, 22, 1}, {5887, 0x1, 22, 1}, {4243, 0x6, 0, 2},
+  {4277, 0x1, 21, 1}, {5881, 0x1, 21, 1}, {0, 0x0, 0, 0},
+  {5891, 0x1, 20, 1}, {5893, 0x1, 20, 1}, {1905, 0x1, 24, 1},
+  {1953, 0x1, 22, 1}, {2617, 0x3, 23, 1}, {5883, 0x1, 24, 1},
+  {334, 0x0, 0, 0}, {0, 0x0, 0, 0}, {5895, 0x1b, 0, 2},
+  {333, 0x0, 0, 0}, {336, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {5899, 0x1b, 0, 2}, {335, 0x0, 0, 0}, {344, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {5903, 0x1b, 0, 2}, {0, 0x0, 0, 0},
+  {343, 0x0, 0, 0}, {0, 0x0, 0, 0}, {5905, 0x6, 0, 2},
+  {5907, 0x6, 0, 2}, {342, 0x0, 0, 0}, {341, 0x0, 0, 0},
+  {341, 0x0, 0, 0}, {5911, 0xa, 0, 2}, {5913, 0x1c, 0, 2},
+  {340, 0x0, 0, 0}, {339, 0x0, 0, 0}, {5915, 0x1d, 0, 2},
+  {5915, 0x1d, 0, 2}, {5917, 0xa, 0, 2}, {5919, 0x1e, 0, 2},
+  {338, 0x0, 0, 0}, {5921, 0x1f, 0, 2}, {0, 0x0, 0, 0},
+  {5923, 0x1b, 0, 2}, {337, 0x0, 0, 0}, {5909, 0x1b, 0, 2},
+  {5925, 0x1b, 0, 2}, {348, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {5929, 0x1b, 0, 2}, {0, 0x0, 0, 0}, {347, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {5931, 0x6, 0, 2}, {5933, 0x6, 0, 2},
+  {346, 0x0, 0, 0}, {0, 0x0, 0, 0}, {5937, 0x1b, 0, 2},
+  {345, 0x0, 0, 0}, {5935, 0x1b, 0, 2}, {5939, 0x1b, 0, 2},
+  {5897, 0x1b, 0, 2}, {5901, 0x1b, 0, 2}, {5927, 0x6, 0, 2},
+  {5941, 0x6, 0, 2}, {352, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {5947, 0x5, 0, 2}, {0, 0x0, 0, 0}, {351, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {5949, 0x1b, 0, 2}, {5951, 0x5, 0, 2},
+  {350, 0x0, 0, 0}, {0, 0x0, 0, 0}, {5955, 0x1b, 0, 2},
+  {349, 0x0, 0, 0}, {5953, 0x1b, 0, 2}, {5957, 0x1b, 0, 2},
+  {354, 0x0, 0, 0}, {0, 0x0, 0, 0}, {5961, 0x1b, 0, 2},
+  {353, 0x0, 0, 0}, {362, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {5965, 0x1b, 0, 2}, {0, 0x0, 0, 0}, {361, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {5967, 0x6, 0, 2}, {5969, 0x6, 0, 2},
+  {360, 0x0, 0, 0}, {359, 0x0, 0, 0}, {359, 0x0, 0, 0},
+  {5973, 0xa, 0, 2}, {5975, 0x1c, 0, 2}, {358, 0x0, 0, 0},
+  {357, 0x0, 0, 0}, {5977, 0x1d, 0, 2}, {5977, 0x1d, 0, 2},
+  {5979, 0xa, 0, 2}, {5981, 0x1e, 0, 2}, {356, 0x0, 0, 0},
+  {5983, 0x1f, 0, 2}, {0, 0x0, 0, 0}, {5985, 0x1b, 0, 2},
+  {355, 0x0, 0, 0}, {5971, 0x1b, 0, 2}, {5987, 0x1b, 0, 2},
+  {366, 0x0, 0, 0}, {0, 0x0, 0, 0}, {5991, 0x1b, 0, 2},
+  {0, 0x0, 0, 0}, {365, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {5993, 0x6, 0, 2}, {5995, 0x6, 0, 2}, {364, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {5999, 0x1b, 0, 2}, {363, 0x0, 0, 0},
+  {5997, 0x1b, 0, 2}, {6001, 0x1b, 0, 2}, {5959, 0x5, 0, 2},
+  {5963, 0x1b, 0, 2}, {5989, 0x6, 0, 2}, {6003, 0x6, 0, 2},
+  {368, 0x0, 0, 0}, {0, 0x0, 0, 0}, {6009, 0x1b, 0, 2},
+  {367, 0x0, 0, 0}, {369, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {370, 0x0, 0, 0}, {0, 0x0, 0, 0}, {6011, 0x1b, 0, 2},
+  {0, 0x0, 0, 0}, {6013, 0x3, 4, 1}, {0, 0x0, 0, 0},
+  {374, 0x0, 0, 0}, {0, 0x0, 0, 0}, {6021, 0x5, 0, 2},
+  {0, 0x0, 0, 0}, {373, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {6023, 0x1b, 0, 2}, {6025, 0x5, 0, 2}, {372, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {6029, 0x1b, 0, 2}, {371, 0x0, 0, 0},
+  {6027, 0x1b, 0, 2}, {6031, 0x1b, 0, 2}, {0, 0x0, 0, 0},
+  {6033, 0x5, 0, 2}, {378, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {6037, 0x1b, 0, 2}, {0, 0x0, 0, 0}, {377, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {6039, 0x7, 0, 2}, {6041, 0x7, 0, 2},
+  {376, 0x0, 0, 0}, {0, 0x0, 0, 0}, {6045, 0x1b, 0, 2},
+  {375, 0x0, 0, 0}, {6043, 0x1b, 0, 2}, {6047, 0x1b, 0, 2},
+  {380, 0x0, 0, 0}, {0, 0x0, 0, 0}, {6051, 0x1b, 0, 2},
+  {379, 0x0, 0, 0}, {382, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {6055, 0x1b, 0, 2}, {381, 0x0, 0, 0}, {6049, 0x7, 0, 2},
+  {0, 0x0, 0, 0}, {6053, 0x1b, 0, 2}, {6057, 0x1b, 0, 2},
+  {388, 0x0, 0, 0}, {0, 0x0, 0, 0}, {6063, 0x5, 0, 2},
+  {0, 0x0, 0, 0}, {6065, 0x1b, 0, 2}, {0, 0x0, 0, 0},
+  {6085, 0xf, 8, 1}, {6085, 0xf, 8, 1}, {6085, 0xf, 8, 1},
+  {6085, 0xf, 8, 1}, {6085, 0xf, 8, 1}, {6085, 0xf, 8, 1},
+  {6085, 0xf, 8, 1}, {6085, 0xf, 8, 1}, {6085, 0xf, 8, 1},
+  {6085, 0xf, 8, 1}, {6085, 0xf, 8, 1}, {6085, 0xf, 8, 1},
+  {6085, 0xf, 8, 1}, {0, 0x0, 0, 0}, {6085, 0xf, 8, 1},
+  {6085, 0xf, 8, 1}, {387, 0x0, 0, 0}, {387, 0x0, 0, 0},
+  {387, 0x0, 0, 0}, {387, 0x0, 0, 0}, {387, 0x0, 0, 0},
+  {387, 0x0, 0, 0}, {387, 0x0, 0, 0}, {387, 0x0, 0, 0},
+  {387, 0x0, 0, 0}, {387, 0x0, 0, 0}, {387, 0x0, 0, 0},
+  {387, 0x0, 0, 0}, {387, 0x0, 0, 0}, {387, 0x0, 0, 0},
+  {387, 0x0, 0, 0}, {0, 0x0, 0, 0}, {6067, 0x7, 0, 2},
+  {6069, 0xf, 16, 1}, {386, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {6103, 0x5, 0, 2}, {0, 0x0, 0, 0}, {385, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {6105, 0x1b, 0, 2}, {6107, 0x5, 0, 2},
+  {6101, 0x1b, 0, 2}, {6109, 0x1b, 0, 2}, {384, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {6113, 0x1b, 0, 2}, {383, 0x0, 0, 0},
+  {6111, 0x7, 0, 2}, {6115, 0x1b, 0, 2}, {390, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {6119, 0x1b, 0, 2}, {389, 0x0, 0, 0},
+  {392, 0x0, 0, 0}, {0, 0x0, 0, 0}, {6123, 0x1b, 0, 2},
+  {391, 0x0, 0, 0}, {6117, 0x5, 0, 2}, {0, 0x0, 0, 0},
+  {6121, 0x1b, 0, 2}, {6125, 0x1b, 0, 2}, {396, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {6131, 0x1b, 0, 2}, {0, 0x0, 0, 0},
+  {395, 0x0, 0, 0}, {0, 0x0, 0, 0}, {6133, 0x7, 0, 2},
+  {6135, 0x7, 0, 2}, {394, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {6139, 0x1b, 0, 2}, {393, 0x0, 0, 0}, {6137, 0x1b, 0, 2},
+  {6141, 0x1b, 0, 2}, {398, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {6145, 0x1b, 0, 2}, {397, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {6143, 0x7, 0, 2}, {6147, 0x1b, 0, 2}, {0, 0x0, 0, 0},
+  {404, 0x0, 0, 0}, {0, 0x0, 0, 0}, {6153, 0x5, 0, 2},
+  {0, 0x0, 0, 0}, {6155, 0x1b, 0, 2}, {0, 0x0, 0, 0},
+  {6175, 0xf, 8, 1}, {6175, 0xf, 8, 1}, {6175, 0xf, 8, 1},
+  {6175, 0xf, 8, 1}, {6175, 0xf, 8, 1}, {6175, 0xf, 8, 1},
+  {6175, 0xf, 8, 1}, {6175, 0xf, 8, 1}, {6175, 0xf, 8, 1},
+  {6175, 0xf, 8, 1}, {6175, 0xf, 8, 1}, {6175, 0xf, 8, 1},
+  {6175, 0xf, 8, 1}, {0, 0x0, 0, 0}, {6175, 0xf, 8, 1},
+  {6175, 0xf, 8, 1}, {403, 0x0, 0, 0}, {403, 0x0, 0, 0},
+  {403, 0x0, 0, 0}, {403, 0x0, 0, 0}, {403, 0x0, 0, 0},
+  {403, 0x0, 0, 0}, {403, 0x0, 0, 0}, {403, 0x0, 0, 0},
+  {403, 0x0, 0, 0}, {403, 0x0, 0, 0}, {403, 0x0, 0, 0},
+  {403, 0x0, 0, 0}, {403, 0x0, 0, 0}, {403, 0x0, 0, 0},
+  {403, 0x0, 0, 0}, {0, 0x0, 0, 0}, {6157, 0x7, 0, 2},
+  {6159, 0xf, 16, 1}, {402, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {6193, 0x5, 0, 2}, {0, 0x0, 0, 0}, {401, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {6195, 0x1b, 0, 2}, {6197, 0x5, 0, 2},
+  {6191, 0x1b, 0, 2}, {6199, 0x1b, 0, 2}, {400, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {6203, 0x1b, 0, 2}, {399, 0x0, 0, 0},
+  {6201, 0x7, 0, 2}, {6205, 0x1b, 0, 2}, {406, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {6209, 0x1b, 0, 2}, {405, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {6207, 0x5, 0, 2}, {6211, 0x1b, 0, 2},
+  {0, 0x0, 0, 0}, {411, 0x0, 0, 0}, {410, 0x0, 0, 0},
+  {6217, 0x21, 0, 2}, {409, 0x0, 0, 0}, {6219, 0x22, 0, 2},
+  {408, 0x0, 0, 0}, {6221, 0x20, 0, 2}, {407, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {6223, 0x23, 0, 2}, {413, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {6227, 0x6, 0, 2}, {412, 0x0, 0, 0},
+  {415, 0x0, 0, 0}, {0, 0x0, 0, 0}, {6231, 0x6, 0, 2},
+  {414, 0x0, 0, 0}, {417, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {6235, 0x6, 0, 2}, {416, 0x0, 0, 0}, {6229, 0x6, 0, 2},
+  {6233, 0x6, 0, 2}, {6237, 0x6, 0, 2}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {6259, 0x1, 7, 1}, {6225, 0x24, 0, 2}, {6239, 0x3, 21, 1},
+  {422, 0x0, 0, 0}, {421, 0x0, 0, 0}, {6261, 0x21, 0, 2},
+  {420, 0x0, 0, 0}, {6263, 0x22, 0, 2}, {419, 0x0, 0, 0},
+  {6265, 0x20, 0, 2}, {418, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {6267, 0x23, 0, 2}, {424, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {6271, 0x6, 0, 2}, {423, 0x0, 0, 0}, {426, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {6275, 0x6, 0, 2}, {425, 0x0, 0, 0},
+  {428, 0x0, 0, 0}, {0, 0x0, 0, 0}, {6279, 0x6, 0, 2},
+  {427, 0x0, 0, 0}, {6273, 0x6, 0, 2}, {6277, 0x6, 0, 2},
+  {6281, 0x6, 0, 2}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {6303, 0x1, 7, 1},
+  {6269, 0x24, 0, 2}, {6283, 0x3, 21, 1}, {6309, 0xf, 12, 1},
+  {6341, 0xf, 12, 1}, {6373, 0xf, 12, 1}, {6405, 0xf, 12, 1},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {6325, 0xf, 4, 1}, {429, 0x0, 0, 0}, {430, 0x0, 0, 0},
+  {431, 0x0, 0, 0}, {0, 0x0, 0, 0}, {432, 0x0, 0, 0},
+  {433, 0x0, 0, 0}, {434, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {435, 0x0, 0, 0}, {436, 0x0, 0, 0}, {437, 0x0, 0, 0},
+  {438, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {6357, 0xf, 4, 1},
+  {439, 0x0, 0, 0}, {440, 0x0, 0, 0}, {441, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {442, 0x0, 0, 0}, {443, 0x0, 0, 0},
+  {444, 0x0, 0, 0}, {0, 0x0, 0, 0}, {445, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {6389, 0xf, 4, 1}, {446, 0x0, 0, 0},
+  {447, 0x0, 0, 0}, {448, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {449, 0x0, 0, 0}, {450, 0x0, 0, 0}, {451, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {452, 0x0, 0, 0}, {453, 0x0, 0, 0},
+  {454, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {6421, 0xf, 4, 1}, {455, 0x0, 0, 0}, {456, 0x0, 0, 0},
+  {457, 0x0, 0, 0}, {0, 0x0, 0, 0}, {458, 0x0, 0, 0},
+  {459, 0x0, 0, 0}, {460, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {6441, 0xf, 12, 1},
+  {6473, 0xf, 12, 1}, {6505, 0xf, 12, 1}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {6457, 0xf, 4, 1}, {461, 0x0, 0, 0}, {462, 0x0, 0, 0},
+  {463, 0x0, 0, 0}, {0, 0x0, 0, 0}, {464, 0x0, 0, 0},
+  {465, 0x0, 0, 0}, {466, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {467, 0x0, 0, 0}, {468, 0x0, 0, 0}, {469, 0x0, 0, 0},
+  {470, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {6489, 0xf, 4, 1},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {471, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {6521, 0xf, 4, 1}, {472, 0x0, 0, 0},
+  {473, 0x0, 0, 0}, {474, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {475, 0x0, 0, 0}, {476, 0x0, 0, 0}, {477, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {478, 0x0, 0, 0}, {479, 0x0, 0, 0},
+  {480, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {485, 0x0, 0, 0}, {0, 0x0, 0, 0}, {6537, 0x19, 0, 2},
+  {484, 0x0, 0, 0}, {487, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {6541, 0x19, 0, 2}, {486, 0x0, 0, 0}, {489, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {6545, 0x19, 0, 2}, {488, 0x0, 0, 0},
+  {491, 0x0, 0, 0}, {0, 0x0, 0, 0}, {6549, 0x19, 0, 2},
+  {490, 0x0, 0, 0}, {493, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {6553, 0x19, 0, 2}, {492, 0x0, 0, 0}, {6561, 0xf, 4, 1},
+  {6577, 0xf, 4, 1}, {6593, 0xf, 4, 1}, {6609, 0xf, 4, 1},
+  {6539, 0x19, 0, 2}, {481, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {6543, 0x19, 0, 2}, {6547, 0x19, 0, 2},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {6551, 0x19, 0, 2},
+  {6555, 0x19, 0, 2}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {482, 0x0, 0, 0}, {483, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {495, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {6625, 0x19, 0, 2}, {494, 0x0, 0, 0}, {497, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {6629, 0x19, 0, 2}, {496, 0x0, 0, 0},
+  {499, 0x0, 0, 0}, {0, 0x0, 0, 0}, {6633, 0x19, 0, 2},
+  {498, 0x0, 0, 0}, {501, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {6637, 0x19, 0, 2}, {500, 0x0, 0, 0}, {503, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {6641, 0x19, 0, 2}, {502, 0x0, 0, 0},
+  {505, 0x0, 0, 0}, {0, 0x0, 0, 0}, {6645, 0x19, 0, 2},
+  {504, 0x0, 0, 0}, {507, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {6649, 0x19, 0, 2}, {506, 0x0, 0, 0}, {509, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {6653, 0x19, 0, 2}, {508, 0x0, 0, 0},
+  {511, 0x0, 0, 0}, {0, 0x0, 0, 0}, {6657, 0x19, 0, 2},
+  {510, 0x0, 0, 0}, {6665, 0xf, 4, 1}, {6681, 0xf, 4, 1},
+  {6697, 0xf, 4, 1}, {6713, 0xf, 4, 1}, {6627, 0x19, 0, 2},
+  {6631, 0x19, 0, 2}, {6635, 0x19, 0, 2}, {6639, 0x19, 0, 2},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {6643, 0x19, 0, 2}, {6647, 0x19, 0, 2}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {6651, 0x19, 0, 2}, {6655, 0x19, 0, 2},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {6659, 0x19, 0, 2},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {6733, 0xf, 4, 1}, {6749, 0xf, 4, 1}, {6765, 0xf, 4, 1},
+  {6781, 0xf, 4, 1}, {512, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {513, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {514, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {515, 0x0, 0, 0},
+  {516, 0x0, 0, 0}, {517, 0x0, 0, 0}, {518, 0x0, 0, 0},
+  {519, 0x0, 0, 0}, {520, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {521, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {522, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {6801, 0xf, 4, 1},
+  {6817, 0xf, 4, 1}, {6833, 0xf, 4, 1}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {523, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {524, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {525, 0x0, 0, 0},
+  {526, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {6851, 0x3, 23, 1}, {6863, 0x3, 23, 1}, {6855, 0x1, 20, 1},
+  {6857, 0x1, 20, 1}, {6859, 0x1, 20, 1}, {6861, 0x1, 20, 1},
+  {5943, 0x3, 21, 1}, {6005, 0x3, 21, 1}, {6017, 0x3, 21, 1},
+  {6035, 0x20, 0, 2}, {6059, 0x3, 21, 1}, {6127, 0x3, 21, 1},
+  {6149, 0x3, 21, 1}, {6213, 0x3, 21, 1}, {6867, 0x1, 20, 1},
+  {6869, 0x1, 20, 1}, {6871, 0x1, 20, 1}, {6873, 0x1, 20, 1},
+  {6243, 0xf, 12, 1}, {6287, 0xf, 12, 1}, {6305, 0x3, 21, 1},
+  {6437, 0x3, 21, 1}, {6557, 0x3, 21, 1}, {6661, 0x3, 21, 1},
+  {6729, 0x3, 21, 1}, {6797, 0x3, 21, 1}, {0, 0x0, 0, 0},
+  {528, 0x0, 0, 0}, {0, 0x0, 0, 0}, {529, 0x0, 0, 0},
+  {530, 0x0, 0, 0}, {531, 0x0, 0, 0}, {6883, 0x1, 8, 1},
+  {6885, 0x1, 8, 1}, {6875, 0x25, 0, 2}, {6877, 0x25, 0, 2},
+  {527, 0x0, 0, 0}, {6879, 0x1, 0, 1}, {0, 0x0, 0, 0},
+  {532, 0x0, 0, 0}, {0, 0x0, 0, 0}, {532, 0x0, 0, 0},
+  {533, 0x0, 0, 0}, {0, 0x0, 0, 0}, {6887, 0x26, 0, 2},
+  {6889, 0x27, 0, 2}, {6891, 0x1, 23, 1}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {534, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {535, 0x0, 0, 0}, {537, 0x0, 0, 0}, {536, 0x0, 0, 0},
+  {540, 0x0, 0, 0}, {539, 0x0, 0, 0}, {6903, 0x28, 0, 2},
+  {538, 0x0, 0, 0}, {6909, 0x1, 8, 1}, {6911, 0x1, 8, 1},
+  {6897, 0x25, 0, 2}, {6899, 0x25, 0, 2}, {6901, 0x28, 0, 2},
+  {6905, 0x1, 0, 1}, {541, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {6913, 0x6, 0, 2}, {0, 0x0, 0, 0},
+  {6913, 0x6, 0, 2}, {542, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {6915, 0x26, 0, 2}, {6917, 0x27, 0, 2}, {6919, 0x1, 23, 1},
+  {0, 0x0, 0, 0}, {546, 0x0, 0, 0}, {545, 0x0, 0, 0},
+  {6925, 0x7, 0, 2}, {0, 0x0, 0, 0}, {549, 0x0, 0, 0},
+  {548, 0x0, 0, 0}, {6933, 0x1, 0, 1}, {0, 0x0, 0, 0},
+  {6929, 0x7, 0, 2}, {547, 0x0, 0, 0}, {6937, 0x1, 8, 1},
+  {6939, 0x1, 8, 1}, {543, 0x0, 0, 0}, {544, 0x0, 0, 0},
+  {6927, 0x1, 23, 1}, {6931, 0x1, 23, 1}, {6945, 0xf, 12, 1},
+  {6945, 0xf, 12, 1}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {6961, 0x1, 8, 1},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {532, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {551, 0x0, 0, 0}, {0, 0x0, 0, 0}, {6963, 0x6, 0, 2},
+  {550, 0x0, 0, 0}, {553, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {6967, 0x6, 0, 2}, {552, 0x0, 0, 0}, {554, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {6975, 0x1, 0, 1}, {0, 0x0, 0, 0},
+  {555, 0x0, 0, 0}, {556, 0x0, 0, 0}, {6979, 0x1, 8, 1},
+  {6981, 0x1, 8, 1}, {6965, 0x6, 0, 2}, {6969, 0x6, 0, 2},
+  {6971, 0x1, 23, 1}, {6973, 0x1, 23, 1}, {6913, 0x6, 0, 2},
+  {557, 0x0, 0, 0}, {6989, 0xf, 12, 1}, {7007, 0xf, 12, 1},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {7005, 0x1, 8, 1}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {6983, 0x6, 0, 2}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {7023, 0x1, 8, 1}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {6913, 0x6, 0, 2}, {0, 0x0, 0, 0}, {7027, 0x1, 24, 1},
+  {0, 0x0, 0, 0}, {7029, 0x1, 20, 1}, {7047, 0x1, 20, 1},
+  {7031, 0x7, 9, 1}, {7039, 0x7, 9, 1}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {6881, 0x1, 23, 1}, {0, 0x0, 0, 0},
+  {6893, 0x3, 21, 1}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {6907, 0x1, 23, 1}, {0, 0x0, 0, 0}, {6921, 0x3, 21, 1},
+  {7049, 0x7, 9, 1}, {7057, 0x7, 9, 1}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {6935, 0x1, 21, 1}, {0, 0x0, 0, 0},
+  {6941, 0x3, 21, 1}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {6977, 0x1, 21, 1}, {0, 0x0, 0, 0}, {6985, 0x3, 21, 1},
+  {7067, 0x1, 7, 1}, {7069, 0x1, 7, 1}, {600, 0x0, 0, 0},
+  {601, 0x0, 0, 0}, {602, 0x0, 0, 0}, {603, 0x0, 0, 0},
+  {7073, 0x1, 7, 1}, {7075, 0x1, 7, 1}, {604, 0x0, 0, 0},
+  {605, 0x0, 0, 0}, {606, 0x0, 0, 0}, {607, 0x0, 0, 0},
+  {7079, 0x1, 7, 1}, {7081, 0x1, 7, 1}, {608, 0x0, 0, 0},
+  {609, 0x0, 0, 0}, {610, 0x0, 0, 0}, {611, 0x0, 0, 0},
+  {7085, 0x1, 7, 1}, {7087, 0x1, 7, 1}, {612, 0x0, 0, 0},
+  {613, 0x0, 0, 0}, {614, 0x0, 0, 0}, {615, 0x0, 0, 0},
+  {616, 0x0, 0, 0}, {0, 0x0, 0, 0}, {7093, 0x1, 7, 1},
+  {7095, 0x1, 7, 1}, {617, 0x0, 0, 0}, {618, 0x0, 0, 0},
+  {619, 0x0, 0, 0}, {620, 0x0, 0, 0}, {7065, 0x1, 16, 1},
+  {7071, 0x1, 16, 1}, {7077, 0x1, 16, 1}, {7083, 0x1, 16, 1},
+  {7089, 0x1, 16, 1}, {598, 0x0, 0, 0}, {7091, 0x1, 16, 1},
+  {599, 0x0, 0, 0}, {7107, 0x1, 7, 1}, {7109, 0x1, 7, 1},
+  {623, 0x0, 0, 0}, {624, 0x0, 0, 0}, {625, 0x0, 0, 0},
+  {626, 0x0, 0, 0}, {7113, 0x1, 7, 1}, {7115, 0x1, 7, 1},
+  {627, 0x0, 0, 0}, {628, 0x0, 0, 0}, {629, 0x0, 0, 0},
+  {630, 0x0, 0, 0}, {7119, 0x1, 7, 1}, {7121, 0x1, 7, 1},
+  {631, 0x0, 0, 0}, {632, 0x0, 0, 0}, {633, 0x0, 0, 0},
+  {634, 0x0, 0, 0}, {7125, 0x1, 7, 1}, {7127, 0x1, 7, 1},
+  {635, 0x0, 0, 0}, {636, 0x0, 0, 0}, {637, 0x0, 0, 0},
+  {638, 0x0, 0, 0}, {639, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {7133, 0x1, 7, 1}, {7135, 0x1, 7, 1}, {640, 0x0, 0, 0},
+  {641, 0x0, 0, 0}, {642, 0x0, 0, 0}, {643, 0x0, 0, 0},
+  {7105, 0x1, 16, 1}, {7111, 0x1, 16, 1}, {7117, 0x1, 16, 1},
+  {7123, 0x1, 16, 1}, {7129, 0x1, 16, 1}, {621, 0x0, 0, 0},
+  {7131, 0x1, 16, 1}, {622, 0x0, 0, 0}, {648, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {649, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {650, 0x0, 0, 0}, {0, 0x0, 0, 0}, {651, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {7145, 0x1, 7, 1}, {7147, 0x1, 7, 1}, {7149, 0x1, 7, 1},
+  {7151, 0x1, 7, 1}, {644, 0x0, 0, 0}, {645, 0x0, 0, 0},
+  {646, 0x0, 0, 0}, {647, 0x0, 0, 0}, {656, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {657, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {658, 0x0, 0, 0}, {0, 0x0, 0, 0}, {659, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {7169, 0x1, 7, 1}, {7171, 0x1, 7, 1}, {7173, 0x1, 7, 1},
+  {7175, 0x1, 7, 1}, {652, 0x0, 0, 0}, {653, 0x0, 0, 0},
+  {654, 0x0, 0, 0}, {655, 0x0, 0, 0}, {7195, 0x1, 23, 1},
+  {7365, 0x1, 23, 1}, {7197, 0x3, 20, 1}, {7281, 0x3, 20, 1},
+  {7201, 0xf, 8, 1}, {7221, 0xf, 8, 1}, {7241, 0xf, 8, 1},
+  {7261, 0xf, 8, 1}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {7217, 0x1, 6, 1},
+  {7219, 0x1, 6, 1}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {558, 0x0, 0, 0},
+  {559, 0x0, 0, 0}, {560, 0x0, 0, 0}, {561, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {7237, 0x1, 6, 1}, {7239, 0x1, 6, 1},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {562, 0x0, 0, 0}, {563, 0x0, 0, 0},
+  {564, 0x0, 0, 0}, {565, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {7257, 0x1, 6, 1}, {7259, 0x1, 6, 1}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {566, 0x0, 0, 0}, {567, 0x0, 0, 0}, {568, 0x0, 0, 0},
+  {569, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {7277, 0x1, 6, 1},
+  {7279, 0x1, 6, 1}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {570, 0x0, 0, 0},
+  {571, 0x0, 0, 0}, {572, 0x0, 0, 0}, {573, 0x0, 0, 0},
+  {7285, 0xf, 8, 1}, {7305, 0xf, 8, 1}, {7325, 0xf, 8, 1},
+  {7345, 0xf, 8, 1}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {7301, 0x1, 6, 1},
+  {7303, 0x1, 6, 1}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {574, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {575, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {7321, 0x1, 6, 1}, {7323, 0x1, 6, 1},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {576, 0x0, 0, 0}, {577, 0x0, 0, 0},
+  {578, 0x0, 0, 0}, {579, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {7341, 0x1, 6, 1}, {7343, 0x1, 6, 1}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {580, 0x0, 0, 0}, {581, 0x0, 0, 0}, {582, 0x0, 0, 0},
+  {583, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {7361, 0x1, 6, 1},
+  {7363, 0x1, 6, 1}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {584, 0x0, 0, 0},
+  {7097, 0x7, 17, 1}, {585, 0x0, 0, 0}, {7137, 0x7, 17, 1},
+  {7367, 0x3, 20, 1}, {7451, 0x3, 20, 1}, {7371, 0xf, 8, 1},
+  {7391, 0xf, 8, 1}, {7411, 0xf, 8, 1}, {7431, 0xf, 8, 1},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {7387, 0x1, 6, 1}, {7389, 0x1, 6, 1},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {586, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {587, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {7407, 0x1, 6, 1}, {7409, 0x1, 6, 1}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {588, 0x0, 0, 0}, {0, 0x0, 0, 0}, {589, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {7427, 0x1, 6, 1},
+  {7429, 0x1, 6, 1}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {590, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {591, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {7447, 0x1, 6, 1}, {7449, 0x1, 6, 1},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {592, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {593, 0x0, 0, 0}, {0, 0x0, 0, 0}, {7455, 0xf, 8, 1},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {7475, 0xf, 8, 1},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {7471, 0x1, 6, 1}, {7473, 0x1, 6, 1},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {594, 0x0, 0, 0}, {595, 0x0, 0, 0},
+  {596, 0x0, 0, 0}, {597, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {7491, 0x1, 6, 1}, {7493, 0x1, 6, 1}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {7153, 0xf, 16, 1}, {0, 0x0, 0, 0},
+  {7177, 0xf, 16, 1}, {0, 0x0, 0, 0}, {663, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {664, 0x0, 0, 0}, {666, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {7503, 0x1, 6, 1}, {7505, 0x1, 6, 1},
+  {665, 0x0, 0, 0}, {0, 0x0, 0, 0}, {7499, 0x1, 16, 1},
+  {0, 0x0, 0, 0}, {7509, 0x1, 8, 1}, {7511, 0x1, 8, 1},
+  {7495, 0x20, 0, 2}, {662, 0x0, 0, 0}, {7497, 0x21, 0, 2},
+  {7501, 0x1, 21, 1}, {668, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {669, 0x0, 0, 0},
+  {7513, 0x7, 21, 1}, {667, 0x0, 0, 0}, {7525, 0x1, 20, 1},
+  {0, 0x0, 0, 0}, {7527, 0x7, 9, 1}, {7535, 0x7, 9, 1},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {7507, 0x1, 23, 1},
+  {0, 0x0, 0, 0}, {660, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {7521, 0x1, 8, 1}, {0, 0x0, 0, 0},
+  {661, 0x0, 0, 0}, {0, 0x0, 0, 0}, {679, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {680, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {681, 0x0, 0, 0}, {0, 0x0, 0, 0}, {682, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {683, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {684, 0x0, 0, 0}, {0, 0x0, 0, 0}, {685, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {686, 0x0, 0, 0}, {687, 0x0, 0, 0},
+  {688, 0x0, 0, 0}, {0, 0x0, 0, 0}, {689, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {690, 0x0, 0, 0}, {7561, 0x29, 0, 2},
+  {7563, 0x29, 0, 2}, {691, 0x0, 0, 0}, {692, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {693, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {694, 0x0, 0, 0}, {7569, 0x29, 0, 2}, {7571, 0x29, 0, 2},
+  {695, 0x0, 0, 0}, {696, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {697, 0x0, 0, 0}, {0, 0x0, 0, 0}, {698, 0x0, 0, 0},
+  {7577, 0x29, 0, 2}, {7579, 0x29, 0, 2}, {7585, 0x3, 20, 1},
+  {7589, 0x3, 20, 1}, {699, 0x0, 0, 0}, {700, 0x0, 0, 0},
+  {701, 0x0, 0, 0}, {702, 0x0, 0, 0}, {703, 0x0, 0, 0},
+  {704, 0x0, 0, 0}, {705, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {7595, 0x3, 20, 1}, {7599, 0x3, 20, 1}, {706, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {707, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {708, 0x0, 0, 0}, {0, 0x0, 0, 0}, {709, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {710, 0x0, 0, 0},
+  {7603, 0x2a, 0, 2}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {711, 0x0, 0, 0}, {7607, 0x2a, 0, 2}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {712, 0x0, 0, 0}, {7611, 0x2a, 0, 2},
+  {0, 0x0, 0, 0}, {7617, 0x3, 20, 1}, {7621, 0x3, 20, 1},
+  {7605, 0x1, 12, 1}, {0, 0x0, 0, 0}, {7609, 0x1, 12, 1},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {7613, 0x1, 12, 1}, {0, 0x0, 0, 0}, {714, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {715, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {7631, 0x1, 21, 1}, {7633, 0x1, 21, 1}, {713, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {7625, 0x1, 20, 1}, {7627, 0x1, 20, 1},
+  {0, 0x0, 0, 0}, {716, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {717, 0x0, 0, 0}, {7637, 0x2a, 0, 2}, {0, 0x0, 0, 0},
+  {7639, 0x1, 12, 1}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {718, 0x0, 0, 0}, {7643, 0x2a, 0, 2}, {0, 0x0, 0, 0},
+  {7645, 0x1, 12, 1}, {0, 0x0, 0, 0}, {7651, 0x1, 21, 1},
+  {7653, 0x1, 21, 1}, {7635, 0x29, 0, 2}, {0, 0x0, 0, 0},
+  {7641, 0x1, 20, 1}, {7647, 0x1, 20, 1}, {7657, 0x3, 20, 1},
+  {7661, 0x3, 20, 1}, {719, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {720, 0x0, 0, 0}, {0, 0x0, 0, 0}, {721, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {722, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {723, 0x0, 0, 0}, {7665, 0x2a, 0, 2},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {724, 0x0, 0, 0},
+  {7669, 0x2a, 0, 2}, {0, 0x0, 0, 0}, {7675, 0x3, 20, 1},
+  {0, 0x0, 0, 0}, {7667, 0x1, 12, 1}, {0, 0x0, 0, 0},
+  {7671, 0x1, 12, 1}, {0, 0x0, 0, 0}, {7695, 0x1, 6, 1},
+  {7697, 0x1, 6, 1}, {7699, 0x1, 6, 1}, {7701, 0x1, 6, 1},
+  {7703, 0x1, 6, 1}, {7705, 0x1, 6, 1}, {7707, 0x1, 6, 1},
+  {7709, 0x1, 6, 1}, {7711, 0x1, 6, 1}, {7713, 0x1, 6, 1},
+  {7715, 0x1, 6, 1}, {7717, 0x1, 6, 1}, {7719, 0x1, 6, 1},
+  {7721, 0x1, 6, 1}, {7723, 0x1, 6, 1}, {7725, 0x1, 6, 1},
+  {670, 0x0, 0, 0}, {7543, 0x29, 0, 2}, {671, 0x0, 0, 0},
+  {7545, 0x29, 0, 2}, {672, 0x0, 0, 0}, {7547, 0x29, 0, 2},
+  {673, 0x0, 0, 0}, {7549, 0x29, 0, 2}, {674, 0x0, 0, 0},
+  {7551, 0x29, 0, 2}, {675, 0x0, 0, 0}, {7553, 0x29, 0, 2},
+  {676, 0x0, 0, 0}, {7555, 0x29, 0, 2}, {677, 0x0, 0, 0},
+  {7557, 0x29, 0, 2}, {7559, 0x1, 28, 1}, {7565, 0x1, 28, 1},
+  {7567, 0x1, 28, 1}, {7573, 0x1, 28, 1}, {678, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {7575, 0x1, 28, 1}, {7581, 0x1, 28, 1},
+  {0, 0x0, 0, 0}, {7583, 0x1, 28, 1}, {7593, 0x1, 28, 1},
+  {7615, 0x1, 28, 1}, {7629, 0x1, 28, 1}, {7649, 0x1, 28, 1},
+  {7655, 0x1, 28, 1}, {7673, 0x1, 28, 1}, {814, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {7727, 0x1, 12, 1}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {815, 0x0, 0, 0}, {7731, 0x2c, 0, 2},
+  {0, 0x0, 0, 0}, {816, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {7735, 0x1, 12, 1}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {817, 0x0, 0, 0}, {7739, 0x2c, 0, 2}, {0, 0x0, 0, 0},
+  {7729, 0x2b, 0, 2}, {7733, 0x2b, 0, 2}, {7737, 0x2b, 0, 2},
+  {7741, 0x2b, 0, 2}, {818, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {819, 0x0, 0, 0}, {7749, 0x2c, 0, 2},
+  {0, 0x0, 0, 0}, {7747, 0x2b, 0, 2}, {7751, 0x2b, 0, 2},
+  {820, 0x0, 0, 0}, {0, 0x0, 0, 0}, {7755, 0x1, 12, 1},
+  {0, 0x0, 0, 0}, {821, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {7759, 0x1, 12, 1}, {0, 0x0, 0, 0}, {7761, 0x2b, 0, 2},
+  {0, 0x0, 0, 0}, {7757, 0x2b, 0, 2}, {7763, 0x1, 28, 1},
+  {7753, 0x1, 28, 1}, {7765, 0x1, 8, 1}, {0, 0x0, 0, 0},
+  {822, 0x0, 0, 0}, {7769, 0x2a, 0, 2}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {823, 0x0, 0, 0}, {7773, 0x2a, 0, 2},
+  {0, 0x0, 0, 0}, {7771, 0x2b, 0, 2}, {7775, 0x2b, 0, 2},
+  {824, 0x0, 0, 0}, {0, 0x0, 0, 0}, {7779, 0x1, 12, 1},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {825, 0x0, 0, 0},
+  {7783, 0x2a, 0, 2}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {826, 0x0, 0, 0}, {7787, 0x2a, 0, 2}, {0, 0x0, 0, 0},
+  {7785, 0x2b, 0, 2}, {7789, 0x2b, 0, 2}, {827, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {7793, 0x1, 12, 1}, {0, 0x0, 0, 0},
+  {7777, 0x1, 28, 1}, {7781, 0x2b, 0, 2}, {7791, 0x1, 28, 1},
+  {7795, 0x2b, 0, 2}, {828, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {829, 0x0, 0, 0}, {7803, 0x2c, 0, 2},
+  {0, 0x0, 0, 0}, {7801, 0x2b, 0, 2}, {7805, 0x2b, 0, 2},
+  {830, 0x0, 0, 0}, {0, 0x0, 0, 0}, {7809, 0x1, 12, 1},
+  {0, 0x0, 0, 0}, {831, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {7813, 0x1, 12, 1}, {0, 0x0, 0, 0}, {7815, 0x2b, 0, 2},
+  {0, 0x0, 0, 0}, {7811, 0x2b, 0, 2}, {7817, 0x1, 28, 1},
+  {7807, 0x1, 28, 1}, {7819, 0x1, 8, 1}, {832, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {7823, 0x1, 12, 1}, {0, 0x0, 0, 0},
+  {833, 0x0, 0, 0}, {0, 0x0, 0, 0}, {7827, 0x1, 12, 1},
+  {0, 0x0, 0, 0}, {7829, 0x2b, 0, 2}, {0, 0x0, 0, 0},
+  {834, 0x0, 0, 0}, {0, 0x0, 0, 0}, {7833, 0x1, 12, 1},
+  {0, 0x0, 0, 0}, {835, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {7837, 0x1, 12, 1}, {0, 0x0, 0, 0}, {7839, 0x2b, 0, 2},
+  {0, 0x0, 0, 0}, {7825, 0x2b, 0, 2}, {7831, 0x1, 28, 1},
+  {7835, 0x2b, 0, 2}, {7841, 0x1, 28, 1}, {836, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {837, 0x0, 0, 0},
+  {7849, 0x2c, 0, 2}, {0, 0x0, 0, 0}, {7847, 0x2b, 0, 2},
+  {7851, 0x2b, 0, 2}, {838, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {7855, 0x1, 12, 1}, {0, 0x0, 0, 0}, {839, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {7859, 0x1, 12, 1}, {0, 0x0, 0, 0},
+  {7861, 0x2b, 0, 2}, {0, 0x0, 0, 0}, {7857, 0x2b, 0, 2},
+  {7863, 0x1, 28, 1}, {7853, 0x1, 28, 1}, {7865, 0x1, 8, 1},
+  {840, 0x0, 0, 0}, {0, 0x0, 0, 0}, {7869, 0x1, 12, 1},
+  {0, 0x0, 0, 0}, {841, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {7873, 0x1, 12, 1}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {7875, 0x2b, 0, 2}, {7871, 0x2b, 0, 2}, {7877, 0x2d, 0, 2},
+  {842, 0x0, 0, 0}, {0, 0x0, 0, 0}, {843, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {844, 0x0, 0, 0},
+  {7885, 0x2c, 0, 2}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {845, 0x0, 0, 0}, {7889, 0x2c, 0, 2}, {0, 0x0, 0, 0},
+  {7895, 0x3, 8, 1}, {7899, 0x3, 8, 1}, {7881, 0x2b, 0, 2},
+  {7883, 0x2b, 0, 2}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {7887, 0x2b, 0, 2}, {7891, 0x2b, 0, 2}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {7907, 0x1, 6, 1}, {7909, 0x1, 6, 1},
+  {7911, 0x1, 6, 1}, {7913, 0x1, 6, 1}, {7743, 0x3, 8, 1},
+  {7767, 0x1, 9, 1}, {7797, 0x3, 8, 1}, {7821, 0x1, 9, 1},
+  {7843, 0x3, 8, 1}, {7867, 0x1, 9, 1}, {7879, 0x1, 8, 1},
+  {7893, 0x1, 28, 1}, {725, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {726, 0x0, 0, 0}, {7917, 0x2a, 0, 2},
+  {0, 0x0, 0, 0}, {7915, 0x1, 11, 1}, {7919, 0x1, 12, 1},
+  {0, 0x0, 0, 0}, {732, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {733, 0x0, 0, 0}, {0, 0x0, 0, 0}, {734, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {735, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {736, 0x0, 0, 0}, {0, 0x0, 0, 0}, {737, 0x0, 0, 0},
+  {738, 0x0, 0, 0}, {0, 0x0, 0, 0}, {7935, 0x1, 0, 1},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {7937, 0x1, 12, 1},
+  {0, 0x0, 0, 0}, {739, 0x0, 0, 0}, {740, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {7943, 0x1, 0, 1}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {7945, 0x1, 12, 1}, {7951, 0x7, 6, 1},
+  {7959, 0x7, 6, 1}, {727, 0x0, 0, 0}, {7923, 0x2e, 0, 2},
+  {728, 0x0, 0, 0}, {7925, 0x2e, 0, 2}, {729, 0x0, 0, 0},
+  {7927, 0x2e, 0, 2}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {730, 0x0, 0, 0}, {7929, 0x2e, 0, 2}, {731, 0x0, 0, 0},
+  {7931, 0x2e, 0, 2}, {7933, 0x2f, 0, 2}, {7939, 0x2f, 0, 2},
+  {7941, 0x2f, 0, 2}, {7947, 0x2f, 0, 2}, {0, 0x0, 0, 0},
+  {743, 0x0, 0, 0}, {745, 0x0, 0, 0}, {746, 0x0, 0, 0},
+  {747, 0x0, 0, 0}, {748, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {744, 0x0, 0, 0}, {749, 0x0, 0, 0}, {750, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {751, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {752, 0x0, 0, 0}, {7977, 0x2e, 0, 2}, {7979, 0x2e, 0, 2},
+  {7985, 0x1, 8, 1}, {7991, 0x1, 8, 1}, {7987, 0x1, 6, 1},
+  {7989, 0x1, 6, 1}, {741, 0x0, 0, 0}, {7967, 0x2e, 0, 2},
+  {7969, 0x1, 7, 1}, {7971, 0x1, 7, 1}, {7993, 0x1, 6, 1},
+  {7995, 0x1, 6, 1}, {742, 0x0, 0, 0}, {7973, 0x2e, 0, 2},
+  {7975, 0x1, 7, 1}, {7981, 0x1, 7, 1}, {0, 0x0, 0, 0},
+  {757, 0x0, 0, 0}, {0, 0x0, 0, 0}, {758, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {759, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {760, 0x0, 0, 0}, {753, 0x0, 0, 0}, {7997, 0x2e, 0, 2},
+  {754, 0x0, 0, 0}, {7999, 0x2e, 0, 2}, {755, 0x0, 0, 0},
+  {8001, 0x2e, 0, 2}, {756, 0x0, 0, 0}, {8003, 0x2e, 0, 2},
+  {0, 0x0, 0, 0}, {764, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {767, 0x0, 0, 0}, {0, 0x0, 0, 0}, {765, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {766, 0x0, 0, 0}, {761, 0x0, 0, 0},
+  {8013, 0x2e, 0, 2}, {0, 0x0, 0, 0}, {8015, 0x30, 0, 2},
+  {762, 0x0, 0, 0}, {8017, 0x2e, 0, 2}, {763, 0x0, 0, 0},
+  {8019, 0x2e, 0, 2}, {0, 0x0, 0, 0}, {782, 0x0, 0, 0},
+  {783, 0x0, 0, 0}, {0, 0x0, 0, 0}, {8031, 0x1, 0, 1},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {8033, 0x1, 12, 1},
+  {0, 0x0, 0, 0}, {775, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {776, 0x0, 0, 0}, {0, 0x0, 0, 0}, {777, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {778, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {779, 0x0, 0, 0}, {0, 0x0, 0, 0}, {780, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {781, 0x0, 0, 0}, {8053, 0x7, 6, 1},
+  {8061, 0x7, 6, 1}, {8029, 0x2f, 0, 2}, {8035, 0x2f, 0, 2},
+  {768, 0x0, 0, 0}, {8037, 0x2e, 0, 2}, {769, 0x0, 0, 0},
+  {8039, 0x2e, 0, 2}, {770, 0x0, 0, 0}, {8041, 0x2e, 0, 2},
+  {771, 0x0, 0, 0}, {8043, 0x2e, 0, 2}, {772, 0x0, 0, 0},
+  {8045, 0x2e, 0, 2}, {773, 0x0, 0, 0}, {8047, 0x2e, 0, 2},
+  {774, 0x0, 0, 0}, {8049, 0x2e, 0, 2}, {785, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {786, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {8069, 0x1, 0, 1}, {8071, 0x1, 0, 1}, {784, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {787, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {8077, 0x1, 12, 1}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {8085, 0x1, 6, 1}, {0, 0x0, 0, 0},
+  {788, 0x0, 0, 0}, {789, 0x0, 0, 0}, {790, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {8087, 0x1, 0, 1},
+  {0, 0x0, 0, 0}, {792, 0x0, 0, 0}, {791, 0x0, 0, 0},
+  {8091, 0x2e, 0, 2}, {793, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {8095, 0x1, 12, 1}, {0, 0x0, 0, 0},
+  {795, 0x0, 0, 0}, {794, 0x0, 0, 0}, {8099, 0x2e, 0, 2},
+  {8105, 0x3, 7, 1}, {8109, 0x3, 7, 1}, {8073, 0x1, 6, 1},
+  {8075, 0x1, 0, 1}, {8079, 0x1, 6, 1}, {8081, 0x3, 18, 1},
+  {8089, 0x31, 0, 2}, {8093, 0x1, 6, 1}, {8097, 0x31, 0, 2},
+  {8101, 0x1, 6, 1}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {8117, 0x1, 8, 1}, {0, 0x0, 0, 0}, {796, 0x0, 0, 0},
+  {797, 0x0, 0, 0}, {0, 0x0, 0, 0}, {798, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {799, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {8127, 0x1, 8, 1}, {0, 0x0, 0, 0},
+  {8119, 0x2e, 0, 2}, {8121, 0x2e, 0, 2}, {800, 0x0, 0, 0},
+  {801, 0x0, 0, 0}, {0, 0x0, 0, 0}, {802, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {803, 0x0, 0, 0}, {8131, 0x2e, 0, 2},
+  {8133, 0x2e, 0, 2}, {8139, 0x1, 6, 1}, {8141, 0x1, 6, 1},
+  {8113, 0x3, 18, 1}, {8123, 0x3, 18, 1}, {8129, 0x1, 7, 1},
+  {8135, 0x1, 7, 1}, {806, 0x0, 0, 0}, {807, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {808, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {809, 0x0, 0, 0}, {8145, 0x2e, 0, 2}, {8147, 0x2e, 0, 2},
+  {0, 0x0, 0, 0}, {805, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {8157, 0x1, 10, 1}, {0, 0x0, 0, 0},
+  {8159, 0x1, 6, 1}, {8161, 0x1, 6, 1}, {8143, 0x1, 8, 1},
+  {8149, 0x1, 8, 1}, {804, 0x0, 0, 0}, {8151, 0x2e, 0, 2},
+  {8167, 0x1, 9, 1}, {8169, 0x1, 9, 1}, {8171, 0x1, 9, 1},
+  {8173, 0x1, 9, 1}, {7949, 0x1, 10, 1}, {7983, 0x1, 10, 1},
+  {8005, 0x7, 6, 1}, {8021, 0x7, 6, 1}, {8051, 0x1, 10, 1},
+  {8103, 0x1, 10, 1}, {8137, 0x1, 10, 1}, {8153, 0x3, 18, 1},
+  {0, 0x0, 0, 0}, {812, 0x0, 0, 0}, {813, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {8177, 0x1, 12, 1},
+  {8183, 0x1, 6, 1}, {8185, 0x1, 6, 1}, {810, 0x0, 0, 0},
+  {811, 0x0, 0, 0}, {8175, 0x32, 0, 2}, {8179, 0x32, 0, 2},
+  {8163, 0x3, 16, 1}, {8181, 0x1, 10, 1}, {7921, 0x1, 6, 1},
+  {8187, 0x1, 11, 1}, {7903, 0x3, 10, 1}, {8189, 0x1, 28, 1},
+  {7679, 0xf, 8, 1}, {8191, 0x2b, 0, 2}, {8197, 0x3, 20, 1},
+  {8201, 0x3, 20, 1}, {855, 0x0, 0, 0}, {856, 0x0, 0, 0},
+  {857, 0x0, 0, 0}, {858, 0x0, 0, 0}, {859, 0x0, 0, 0},
+  {860, 0x0, 0, 0}, {861, 0x0, 0, 0}, {862, 0x0, 0, 0},
+  {863, 0x0, 0, 0}, {864, 0x0, 0, 0}, {865, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {8211, 0x3, 20, 1}, {0, 0x0, 0, 0},
+  {866, 0x0, 0, 0}, {0, 0x0, 0, 0}, {867, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {8217, 0x3, 20, 1}, {8221, 0x3, 20, 1},
+  {868, 0x0, 0, 0}, {0, 0x0, 0, 0}, {869, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {870, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {8227, 0x3, 20, 1}, {871, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {872, 0x0, 0, 0}, {0, 0x0, 0, 0}, {8233, 0x3, 20, 1},
+  {8237, 0x3, 20, 1}, {873, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {874, 0x0, 0, 0}, {0, 0x0, 0, 0}, {875, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {876, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {846, 0x0, 0, 0}, {8195, 0x1, 28, 1}, {847, 0x0, 0, 0},
+  {848, 0x0, 0, 0}, {849, 0x0, 0, 0}, {850, 0x0, 0, 0},
+  {851, 0x0, 0, 0}, {852, 0x0, 0, 0}, {8205, 0x1, 28, 1},
+  {853, 0x0, 0, 0}, {854, 0x0, 0, 0}, {8207, 0x1, 28, 1},
+  {8209, 0x1, 28, 1}, {8215, 0x1, 28, 1}, {8225, 0x1, 28, 1},
+  {8231, 0x1, 28, 1}, {0, 0x0, 0, 0}, {877, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {886, 0x0, 0, 0}, {8259, 0x2a, 0, 2},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {887, 0x0, 0, 0},
+  {8263, 0x2a, 0, 2}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {885, 0x0, 0, 0}, {0, 0x0, 0, 0}, {888, 0x0, 0, 0},
+  {8269, 0x2a, 0, 2}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {889, 0x0, 0, 0}, {8273, 0x2a, 0, 2}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {890, 0x0, 0, 0}, {8277, 0x2a, 0, 2},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {891, 0x0, 0, 0},
+  {8281, 0x2a, 0, 2}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {892, 0x0, 0, 0}, {8285, 0x2a, 0, 2}, {0, 0x0, 0, 0},
+  {8291, 0x3, 20, 1}, {8295, 0x3, 20, 1}, {8261, 0x1, 12, 1},
+  {8265, 0x1, 12, 1}, {8267, 0x29, 0, 2}, {8271, 0x1, 12, 1},
+  {8275, 0x1, 12, 1}, {8279, 0x1, 12, 1}, {8283, 0x1, 12, 1},
+  {8287, 0x1, 12, 1}, {0, 0x0, 0, 0}, {878, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {879, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {880, 0x0, 0, 0}, {0, 0x0, 0, 0}, {881, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {882, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {883, 0x0, 0, 0}, {0, 0x0, 0, 0}, {893, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {894, 0x0, 0, 0}, {8311, 0x29, 0, 2},
+  {8313, 0x29, 0, 2}, {0, 0x0, 0, 0}, {884, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {895, 0x0, 0, 0}, {8319, 0x2a, 0, 2},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {896, 0x0, 0, 0},
+  {8323, 0x2a, 0, 2}, {0, 0x0, 0, 0}, {8329, 0x3, 20, 1},
+  {0, 0x0, 0, 0}, {8321, 0x1, 12, 1}, {0, 0x0, 0, 0},
+  {8325, 0x1, 12, 1}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {897, 0x0, 0, 0}, {8333, 0x2a, 0, 2}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {898, 0x0, 0, 0}, {8337, 0x2a, 0, 2},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {899, 0x0, 0, 0},
+  {8341, 0x2a, 0, 2}, {0, 0x0, 0, 0}, {8347, 0x3, 20, 1},
+  {8351, 0x3, 20, 1}, {8335, 0x1, 12, 1}, {0, 0x0, 0, 0},
+  {8339, 0x1, 12, 1}, {0, 0x0, 0, 0}, {8343, 0x1, 12, 1},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {900, 0x0, 0, 0}, {8355, 0x2a, 0, 2},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {901, 0x0, 0, 0},
+  {8359, 0x2a, 0, 2}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {8365, 0x3, 20, 1}, {8357, 0x1, 12, 1}, {0, 0x0, 0, 0},
+  {8361, 0x1, 12, 1}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {902, 0x0, 0, 0}, {8369, 0x2a, 0, 2}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {903, 0x0, 0, 0}, {8373, 0x2a, 0, 2},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {904, 0x0, 0, 0},
+  {8377, 0x2a, 0, 2}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {905, 0x0, 0, 0}, {8381, 0x2a, 0, 2}, {0, 0x0, 0, 0},
+  {8387, 0x3, 20, 1}, {8391, 0x3, 20, 1}, {8371, 0x1, 12, 1},
+  {0, 0x0, 0, 0}, {8375, 0x1, 12, 1}, {0, 0x0, 0, 0},
+  {8379, 0x1, 12, 1}, {0, 0x0, 0, 0}, {8383, 0x1, 12, 1},
+  {0, 0x0, 0, 0}, {8257, 0x29, 0, 2}, {8289, 0x1, 28, 1},
+  {8299, 0x29, 0, 2}, {8301, 0x29, 0, 2}, {8303, 0x29, 0, 2},
+  {8305, 0x29, 0, 2}, {8307, 0x29, 0, 2}, {8309, 0x29, 0, 2},
+  {8315, 0x1, 28, 1}, {8317, 0x29, 0, 2}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {8327, 0x1, 28, 1}, {8345, 0x1, 28, 1},
+  {8363, 0x1, 28, 1}, {8385, 0x1, 28, 1}, {910, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {911, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {912, 0x0, 0, 0}, {0, 0x0, 0, 0}, {913, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {8411, 0x33, 0, 2}, {8413, 0x33, 0, 2},
+  {8415, 0x33, 0, 2}, {8417, 0x33, 0, 2}, {8439, 0x1, 5, 1},
+  {0, 0x0, 0, 0}, {8439, 0x1, 5, 1}, {0, 0x0, 0, 0},
+  {8439, 0x1, 5, 1}, {0, 0x0, 0, 0}, {8439, 0x1, 5, 1},
+  {0, 0x0, 0, 0}, {8439, 0x1, 5, 1}, {0, 0x0, 0, 0},
+  {8439, 0x1, 5, 1}, {0, 0x0, 0, 0}, {8439, 0x1, 5, 1},
+  {8439, 0x1, 5, 1}, {907, 0x0, 0, 0}, {8439, 0x1, 5, 1},
+  {907, 0x0, 0, 0}, {0, 0x0, 0, 0}, {906, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {906, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {906, 0x0, 0, 0}, {0, 0x0, 0, 0}, {906, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {906, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {906, 0x0, 0, 0}, {0, 0x0, 0, 0}, {906, 0x0, 0, 0},
+  {906, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {8423, 0xf, 8, 1}, {8441, 0xf, 8, 1}, {8463, 0x1, 8, 1},
+  {8463, 0x1, 8, 1}, {8463, 0x1, 8, 1}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {908, 0x0, 0, 0}, {8469, 0x1, 8, 1},
+  {8469, 0x1, 8, 1}, {8469, 0x1, 8, 1}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {909, 0x0, 0, 0}, {8459, 0x3, 10, 1},
+  {8465, 0x3, 10, 1}, {8457, 0x1, 5, 1}, {8471, 0x1, 5, 1},
+  {8419, 0x3, 8, 1}, {8473, 0x1, 8, 1}, {914, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {8477, 0x33, 0, 2},
+  {915, 0x0, 0, 0}, {0, 0x0, 0, 0}, {916, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {8481, 0x33, 0, 2}, {8483, 0x33, 0, 2},
+  {917, 0x0, 0, 0}, {0, 0x0, 0, 0}, {918, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {8479, 0x1, 28, 1}, {8485, 0x1, 28, 1},
+  {8487, 0x33, 0, 2}, {8489, 0x33, 0, 2}, {8491, 0x3, 8, 1},
+  {8473, 0x1, 8, 1}, {919, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {8497, 0x1, 0, 1}, {0, 0x0, 0, 0}, {920, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {8501, 0x1, 0, 1}, {0, 0x0, 0, 0},
+  {8499, 0x34, 0, 2}, {8503, 0x34, 0, 2}, {921, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {8507, 0x1, 0, 1}, {0, 0x0, 0, 0},
+  {922, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {8511, 0x1, 12, 1},
+  {8511, 0x1, 12, 1}, {8511, 0x1, 12, 1}, {8511, 0x1, 12, 1},
+  {8511, 0x1, 12, 1}, {8511, 0x1, 12, 1}, {8511, 0x1, 12, 1},
+  {0, 0x0, 0, 0}, {8511, 0x1, 12, 1}, {8511, 0x1, 12, 1},
+  {8511, 0x1, 12, 1}, {8511, 0x1, 12, 1}, {8511, 0x1, 12, 1},
+  {8511, 0x1, 12, 1}, {8511, 0x1, 12, 1}, {8511, 0x1, 12, 1},
+  {8511, 0x1, 12, 1}, {8511, 0x1, 12, 1}, {8511, 0x1, 12, 1},
+  {8511, 0x1, 12, 1}, {8511, 0x1, 12, 1}, {8511, 0x1, 12, 1},
+  {8511, 0x1, 12, 1}, {0, 0x0, 0, 0}, {8511, 0x1, 12, 1},
+  {8511, 0x1, 12, 1}, {8511, 0x1, 12, 1}, {8511, 0x1, 12, 1},
+  {8511, 0x1, 12, 1}, {8511, 0x1, 12, 1}, {8511, 0x1, 12, 1},
+  {8511, 0x1, 12, 1}, {8511, 0x1, 12, 1}, {8511, 0x1, 12, 1},
+  {8511, 0x1, 12, 1}, {8511, 0x1, 12, 1}, {8511, 0x1, 12, 1},
+  {8511, 0x1, 12, 1}, {8511, 0x1, 12, 1}, {8511, 0x1, 12, 1},
+  {8511, 0x1, 12, 1}, {8511, 0x1, 12, 1}, {8511, 0x1, 12, 1},
+  {8511, 0x1, 12, 1}, {8511, 0x1, 12, 1}, {8511, 0x1, 12, 1},
+  {8511, 0x1, 12, 1}, {8511, 0x1, 12, 1}, {8511, 0x1, 12, 1},
+  {8511, 0x1, 12, 1}, {8511, 0x1, 12, 1}, {8511, 0x1, 12, 1},
+  {8511, 0x1, 12, 1}, {8511, 0x1, 12, 1}, {8511, 0x1, 12, 1},
+  {923, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {8577, 0x1, 12, 1}, {8577, 0x1, 12, 1}, {0, 0x0, 0, 0},
+  {8577, 0x1, 12, 1}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {8579, 0x7, 19, 1}, {8513, 0x3f, 16, 1}, {8513, 0x3f, 16, 1},
+  {8513, 0x3f, 16, 1}, {8513, 0x3f, 16, 1}, {8513, 0x3f, 16, 1},
+  {8513, 0x3f, 16, 1}, {8513, 0x3f, 16, 1}, {8579, 0x7, 19, 1},
+  {8513, 0x3f, 16, 1}, {8513, 0x3f, 16, 1}, {8513, 0x3f, 16, 1},
+  {8513, 0x3f, 16, 1}, {8513, 0x3f, 16, 1}, {8513, 0x3f, 16, 1},
+  {8513, 0x3f, 16, 1}, {8513, 0x3f, 16, 1}, {8513, 0x3f, 16, 1},
+  {8513, 0x3f, 16, 1}, {8513, 0x3f, 16, 1}, {8513, 0x3f, 16, 1},
+  {8513, 0x3f, 16, 1}, {8513, 0x3f, 16, 1}, {8513, 0x3f, 16, 1},
+  {8579, 0x7, 19, 1}, {8513, 0x3f, 16, 1}, {8513, 0x3f, 16, 1},
+  {8513, 0x3f, 16, 1}, {8513, 0x3f, 16, 1}, {8513, 0x3f, 16, 1},
+  {8513, 0x3f, 16, 1}, {8513, 0x3f, 16, 1}, {8513, 0x3f, 16, 1},
+  {8513, 0x3f, 16, 1}, {8513, 0x3f, 16, 1}, {8513, 0x3f, 16, 1},
+  {8513, 0x3f, 16, 1}, {8513, 0x3f, 16, 1}, {8513, 0x3f, 16, 1},
+  {8513, 0x3f, 16, 1}, {8513, 0x3f, 16, 1}, {8513, 0x3f, 16, 1},
+  {8513, 0x3f, 16, 1}, {8513, 0x3f, 16, 1}, {8513, 0x3f, 16, 1},
+  {8513, 0x3f, 16, 1}, {8513, 0x3f, 16, 1}, {8513, 0x3f, 16, 1},
+  {8513, 0x3f, 16, 1}, {8513, 0x3f, 16, 1}, {8513, 0x3f, 16, 1},
+  {8513, 0x3f, 16, 1}, {8513, 0x3f, 16, 1}, {8513, 0x3f, 16, 1},
+  {8513, 0x3f, 16, 1}, {8513, 0x3f, 16, 1}, {8513, 0x3f, 16, 1},
+  {8587, 0x3f, 16, 1}, {8505, 0x1, 28, 1}, {8509, 0x34, 0, 2},
+  {8651, 0x35, 0, 2}, {0, 0x0, 0, 0}, {8505, 0x1, 28, 1},
+  {8509, 0x34, 0, 2}, {8513, 0x3f, 16, 1}, {0, 0x0, 0, 0},
+  {8473, 0x1, 8, 1}, {8653, 0x3, 8, 1}, {8653, 0x3, 8, 1},
+  {8657, 0x3, 8, 1}, {8653, 0x3, 8, 1}, {8657, 0x3, 8, 1},
+  {8657, 0x3, 8, 1}, {8657, 0x3, 8, 1}, {8661, 0x7, 19, 1},
+  {0, 0x0, 0, 0}, {8457, 0x1, 5, 1}, {0, 0x0, 0, 0},
+  {8457, 0x1, 5, 1}, {0, 0x0, 0, 0}, {8457, 0x1, 5, 1},
+  {0, 0x0, 0, 0}, {8457, 0x1, 5, 1}, {0, 0x0, 0, 0},
+  {8457, 0x1, 5, 1}, {0, 0x0, 0, 0}, {8457, 0x1, 5, 1},
+  {0, 0x0, 0, 0}, {8457, 0x1, 5, 1}, {8457, 0x1, 5, 1},
+  {8423, 0xf, 8, 1}, {8687, 0x1, 5, 1}, {8423, 0xf, 8, 1},
+  {0, 0x0, 0, 0}, {8423, 0xf, 8, 1}, {8671, 0xf, 8, 1},
+  {8689, 0x1, 5, 1}, {8689, 0x1, 5, 1}, {8423, 0xf, 8, 1},
+  {8423, 0xf, 8, 1}, {0, 0x0, 0, 0}, {8691, 0x3, 8, 1},
+  {0, 0x0, 0, 0}, {924, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {8697, 0x1, 21, 1}, {8695, 0x36, 0, 2}, {8699, 0x1, 9, 1},
+  {8701, 0x1, 21, 1}, {0, 0x0, 0, 0}, {8475, 0x33, 0, 2},
+  {8495, 0x33, 0, 2}, {8669, 0x1, 7, 1}, {8703, 0x1, 7, 1},
+  {0, 0x0, 0, 0}, {929, 0x0, 0, 0}, {8709, 0x2e, 0, 2},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {930, 0x0, 0, 0},
+  {8713, 0x2e, 0, 2}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {931, 0x0, 0, 0}, {8717, 0x2e, 0, 2}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {932, 0x0, 0, 0}, {8721, 0x2e, 0, 2},
+  {0, 0x0, 0, 0}, {8711, 0x33, 0, 2}, {8715, 0x33, 0, 2},
+  {8719, 0x33, 0, 2}, {8723, 0x33, 0, 2}, {926, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {8747, 0x1, 5, 1}, {0, 0x0, 0, 0},
+  {8747, 0x1, 5, 1}, {0, 0x0, 0, 0}, {8747, 0x1, 5, 1},
+  {0, 0x0, 0, 0}, {8747, 0x1, 5, 1}, {0, 0x0, 0, 0},
+  {8747, 0x1, 5, 1}, {0, 0x0, 0, 0}, {8747, 0x1, 5, 1},
+  {0, 0x0, 0, 0}, {8747, 0x1, 5, 1}, {8747, 0x1, 5, 1},
+  {8729, 0x1, 12, 1}, {8747, 0x1, 5, 1}, {8729, 0x1, 12, 1},
+  {0, 0x0, 0, 0}, {925, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {8749, 0x1, 12, 1}, {0, 0x0, 0, 0}, {8749, 0x1, 12, 1},
+  {0, 0x0, 0, 0}, {8749, 0x1, 12, 1}, {0, 0x0, 0, 0},
+  {8749, 0x1, 12, 1}, {0, 0x0, 0, 0}, {8749, 0x1, 12, 1},
+  {0, 0x0, 0, 0}, {8749, 0x1, 12, 1}, {0, 0x0, 0, 0},
+  {8749, 0x1, 12, 1}, {8749, 0x1, 12, 1}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {8731, 0xf, 8, 1}, {8751, 0xf, 8, 1},
+  {927, 0x0, 0, 0}, {0, 0x0, 0, 0}, {8775, 0x1, 8, 1},
+  {8775, 0x1, 8, 1}, {8775, 0x1, 8, 1}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {8769, 0x1, 12, 1}, {928, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {8783, 0x1, 8, 1}, {8783, 0x1, 8, 1},
+  {8783, 0x1, 8, 1}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {8777, 0x1, 12, 1}, {8771, 0x3, 10, 1}, {8779, 0x3, 10, 1},
+  {8767, 0x1, 5, 1}, {8785, 0x1, 5, 1}, {8725, 0x3, 8, 1},
+  {8787, 0x1, 8, 1}, {0, 0x0, 0, 0}, {933, 0x0, 0, 0},
+  {8791, 0x2e, 0, 2}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {8793, 0x33, 0, 2}, {0, 0x0, 0, 0}, {934, 0x0, 0, 0},
+  {8797, 0x2e, 0, 2}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {935, 0x0, 0, 0}, {8801, 0x2e, 0, 2}, {0, 0x0, 0, 0},
+  {8799, 0x33, 0, 2}, {8803, 0x33, 0, 2}, {0, 0x0, 0, 0},
+  {936, 0x0, 0, 0}, {8807, 0x2e, 0, 2}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {937, 0x0, 0, 0}, {8811, 0x2e, 0, 2},
+  {0, 0x0, 0, 0}, {8795, 0x1, 28, 1}, {8805, 0x1, 28, 1},
+  {8809, 0x33, 0, 2}, {8813, 0x33, 0, 2}, {8815, 0x3, 8, 1},
+  {8787, 0x1, 8, 1}, {938, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {8821, 0x1, 0, 1}, {0, 0x0, 0, 0}, {939, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {8825, 0x1, 0, 1}, {0, 0x0, 0, 0},
+  {8823, 0x34, 0, 2}, {8827, 0x34, 0, 2}, {940, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {8831, 0x1, 0, 1}, {0, 0x0, 0, 0},
+  {8829, 0x1, 28, 1}, {8833, 0x34, 0, 2}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {8835, 0x3, 8, 1}, {8787, 0x1, 8, 1},
+  {8839, 0x34, 0, 2}, {0, 0x0, 0, 0}, {8767, 0x1, 5, 1},
+  {0, 0x0, 0, 0}, {8767, 0x1, 5, 1}, {0, 0x0, 0, 0},
+  {8767, 0x1, 5, 1}, {0, 0x0, 0, 0}, {8767, 0x1, 5, 1},
+  {0, 0x0, 0, 0}, {8767, 0x1, 5, 1}, {0, 0x0, 0, 0},
+  {8767, 0x1, 5, 1}, {0, 0x0, 0, 0}, {8767, 0x1, 5, 1},
+  {8767, 0x1, 5, 1}, {8731, 0xf, 8, 1}, {8859, 0x1, 5, 1},
+  {8731, 0xf, 8, 1}, {0, 0x0, 0, 0}, {8731, 0xf, 8, 1},
+  {8843, 0xf, 8, 1}, {8861, 0x1, 5, 1}, {8861, 0x1, 5, 1},
+  {8731, 0xf, 8, 1}, {8731, 0xf, 8, 1}, {0, 0x0, 0, 0},
+  {8863, 0x3, 8, 1}, {0, 0x0, 0, 0}, {941, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {8869, 0x2e, 0, 2}, {0, 0x0, 0, 0},
+  {8871, 0x1, 21, 1}, {8867, 0x36, 0, 2}, {8873, 0x1, 9, 1},
+  {8875, 0x1, 21, 1}, {0, 0x0, 0, 0}, {8789, 0x33, 0, 2},
+  {8819, 0x33, 0, 2}, {8841, 0x1, 7, 1}, {8877, 0x1, 7, 1},
+  {8885, 0x1, 6, 1}, {8887, 0x1, 6, 1}, {8241, 0xf, 8, 1},
+  {8395, 0xf, 8, 1}, {8705, 0x3, 10, 1}, {8879, 0x3, 10, 1},
+  {8891, 0x1, 4, 1}, {8893, 0x1, 4, 1}, {7193, 0x1, 28, 1},
+  {7523, 0x1, 28, 1}, {8193, 0x1, 23, 1}, {8883, 0x1, 23, 1},
+  {5889, 0x1, 28, 1}, {6849, 0x1, 28, 1}, {7025, 0x1, 28, 1},
+  {8889, 0x1, 24, 1}, {1871, 0x1, 28, 1}, {8895, 0x3, 25, 1},
+  {135, 0x0, 0, 2}, {137, 0x3, 27, 1}, {437, 0x3, 27, 1},
+  {441, 0x3, 27, 1}, {445, 0x3, 27, 1}, {517, 0x3, 27, 1},
+  {529, 0x1, 28, 1}, {8899, 0x1, 27, 1},
+};
+
+// The {mask, value} pairs used by kTestEntry entries.
+static const DecodeTableTest kT32DecodeTableTests[] = {
+  {0x18000000, 0x18000000}, {0x00780000, 0x00680000}, {0x00870000, 0x00850000},
+  {0x000f0000, 0x00000000}, {0x0e000000, 0x0e000000}, {0x00000f00, 0x00000f00},
+  {0x000f0000, 0x000f0000}, {0x000f0000, 0x000d0000}, {0x000d0000, 0x000d0000},
+  {0x040070ff, 0x00000000}, {0x000070c0, 0x00000000}, {0x03800000, 0x03800000},
+  {0x000000e0, 0x00000000}, {0x0000001f, 0x00000000}, {0x000000ff, 0x00000000},
+  {0x000f0000, 0x000e0000}, {0x001c0000, 0x000c0000}, {0x01200000, 0x00000000},
+  {0x000002c0, 0x00000000}, {0x000f02ff, 0x000d0004}, {0x0000000d, 0x0000000d},
+  {0x00000f30, 0x00000a30}, {0x00000e20, 0x00000620}, {0x00000e30, 0x00000830},
+  {0x00000c00, 0x00000c00}, {0x0000f000, 0x0000f000}, {0x000f02ff, 0x000d0204},
+  {0x000070f0, 0x00000030}, {0x00000030, 0x00000030}, {0x00000030, 0x00000010},
+  {0x00000030, 0x00000000}, {0x00000030, 0x00000020}, {0x00600000, 0x00000000},
+  {0x00600000, 0x00600000}, {0x00600000, 0x00200000}, {0x00600000, 0x00400000},
+  {0x00000070, 0x00000000}, {0x006000d0, 0x00400010}, {0x0080f100, 0x00805000},
+  {0x0000f100, 0x00005000}, {0x002f0000, 0x002d0000}, {0x00011001, 0x00000000},
+  {0x00010001, 0x00000000}, {0x00300000, 0x00300000}, {0x00011000, 0x00000000},
+  {0x10000200, 0x00000000}, {0x00001001, 0x00000000}, {0x000c0000, 0x00000000},
+  {0x000c0400, 0x00080000}, {0x000c0040, 0x00040000}, {0x00000380, 0x00000000},
+  {0x00380080, 0x00000000}, {0x00380000, 0x00000000}, {0x00070000, 0x00000000},
+  {0x00180000, 0x00000000},
+};
+// clang-format on
+
+}  // namespace aarch32
+}  // namespace vixl
+
+#endif  // VIXL_AARCH32_DECODER_TABLES_AARCH32_H_
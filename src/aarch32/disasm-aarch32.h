@@ -31,6 +31,7 @@ extern "C" {
 #include <stdint.h>
 }
 
+#include <cstring>
 #include <iomanip>
 
 #include "aarch32/constants-aarch32.h"
@@ -250,18 +251,116 @@ class Disassembler {
     const AlignedMemOperand& GetOperand() const { return operand_; }
   };
 
+  // DisassemblerStream formats the disassembly directly into a character
+  // buffer, without going through std::ostream.
+  //
+  // A stream constructed from a std::ostream collects the output of each
+  // instruction in an internal buffer, and writes it to the std::ostream when
+  // the instruction is complete. A stream constructed from a character buffer
+  // writes straight into that buffer; the caller can then read the text with
+  // GetOutput(), and reuse or replace the buffer between instructions.
   class DisassemblerStream {
-    std::ostream& os_;
+   public:
+    // The size of the internal buffer used by streams constructed from a
+    // std::ostream. Longer output is written to the std::ostream in pieces.
+    static const size_t kBufferSize = 256;
+
+   private:
+    std::ostream* os_;
+    char* buffer_;
+    size_t buffer_size_;
+    size_t length_;
     InstructionType current_instruction_type_;
     InstructionAttribute current_instruction_attributes_;
+    char internal_buffer_[kBufferSize];
 
    public:
     explicit DisassemblerStream(std::ostream& os)  // NOLINT(runtime/references)
-        : os_(os),
+        : os_(&os),
+          buffer_(internal_buffer_),
+          buffer_size_(kBufferSize),
+          length_(0),
           current_instruction_type_(kUndefInstructionType),
-          current_instruction_attributes_(kNoAttribute) {}
-    virtual ~DisassemblerStream() {}
-    std::ostream& os() const { return os_; }
+          current_instruction_attributes_(kNoAttribute) {
+      buffer_[0] = '\0';
+    }
+    // Write the output to `buffer`, which holds `size` characters including
+    // the terminating null character. Output which does not fit is dropped.
+    DisassemblerStream(char* buffer, size_t size)
+        : os_(NULL),
+          buffer_(buffer),
+          buffer_size_(size),
+          length_(0),
+          current_instruction_type_(kUndefInstructionType),
+          current_instruction_attributes_(kNoAttribute) {
+      VIXL_ASSERT(size > 0);
+      buffer_[0] = '\0';
+    }
+    DisassemblerStream(const DisassemblerStream&) = delete;
+    void operator=(const DisassemblerStream&) = delete;
+    virtual ~DisassemblerStream() { Flush(); }
+
+    // Return the underlying std::ostream, after writing any buffered output to
+    // it. This is only available for streams constructed from a std::ostream.
+    std::ostream& os() {
+      VIXL_ASSERT(os_ != NULL);
+      Flush();
+      return *os_;
+    }
+    bool HasOStream() const { return os_ != NULL; }
+
+    // Write the buffered output to the underlying std::ostream, if any.
+    void Flush() {
+      if ((os_ != NULL) && (length_ > 0)) {
+        os_->write(buffer_, length_);
+        length_ = 0;
+        buffer_[0] = '\0';
+      }
+    }
+
+    // The null-terminated output which has not been flushed yet. For streams
+    // constructed from a character buffer, this is everything written since
+    // the last call to ResetOutput() or SetOutputBuffer().
+    const char* GetOutput() const { return buffer_; }
+    size_t GetOutputLength() const { return length_; }
+    void ResetOutput() {
+      length_ = 0;
+      buffer_[0] = '\0';
+    }
+    // Direct the output to a new buffer, for example the next entry of a ring
+    // buffer. This is only available for streams constructed from a character
+    // buffer.
+    void SetOutputBuffer(char* buffer, size_t size) {
+      VIXL_ASSERT(os_ == NULL);
+      VIXL_ASSERT(size > 0);
+      buffer_ = buffer;
+      buffer_size_ = size;
+      ResetOutput();
+    }
+
+    void Append(const char* string, size_t length) {
+      if (length >= (buffer_size_ - length_)) {
+        Flush();
+        if (length >= (buffer_size_ - length_)) {
+          if (os_ != NULL) {
+            os_->write(string, length);
+            return;
+          }
+          length = buffer_size_ - length_ - 1;
+        }
+      }
+      memcpy(buffer_ + length_, string, length);
+      length_ += length;
+      buffer_[length_] = '\0';
+    }
+    void Append(const char* string) { Append(string, strlen(string)); }
+    void AppendChar(char c) { Append(&c, 1); }
+    void AppendUnsigned(uint64_t value);
+    void AppendSigned(int64_t value);
+    // Append `value` in lower-case hexadecimal, without a prefix, padded with
+    // zeros to at least `width` digits.
+    void AppendHex(uint64_t value, int width = 0);
+
     void SetCurrentInstruction(
         InstructionType current_instruction_type,
         InstructionAttribute current_instruction_attributes) {
@@ -277,156 +376,160 @@ class Disassembler {
     bool Has(InstructionAttribute attributes) const {
       return (current_instruction_attributes_ & attributes) == attributes;
     }
-    template <typename T>
-    DisassemblerStream& operator<<(T value) {
-      os_ << value;
+    DisassemblerStream& operator<<(char c) {
+      AppendChar(c);
+      return *this;
+    }
+    DisassemblerStream& operator<<(int32_t value) {
+      AppendSigned(value);
+      return *this;
+    }
+    DisassemblerStream& operator<<(uint32_t value) {
+      AppendUnsigned(value);
       return *this;
     }
+    DisassemblerStream& operator<<(int64_t value) {
+      AppendSigned(value);
+      return *this;
+    }
+    DisassemblerStream& operator<<(uint64_t value) {
+      AppendUnsigned(value);
+      return *this;
+    }
+    DisassemblerStream& operator<<(const ImmediateShiftOperand& shift) {
+      if (shift.IsLSL() && (shift.GetAmount() == 0)) return *this;
+      if (shift.IsRRX()) return *this << ", rrx";
+      return *this << ", " << shift.GetName() << " #" << shift.GetAmount();
+    }
     virtual DisassemblerStream& operator<<(const char* string) {
-      os_ << string;
+      Append(string);
       return *this;
     }
     virtual DisassemblerStream& operator<<(const ConditionPrinter& cond) {
-      os_ << cond;
+      if (cond.GetITBlock().InITBlock() && cond.GetCond().Is(al) &&
+          !cond.GetCond().IsNone()) {
+        Append("al", 2);
+      } else {
+        Append(cond.GetCond().GetName());
+      }
       return *this;
     }
     virtual DisassemblerStream& operator<<(Condition cond) {
-      os_ << cond;
+      Append(cond.GetName());
       return *this;
     }
     virtual DisassemblerStream& operator<<(const EncodingSize& size) {
-      os_ << size;
+      Append(size.GetName());
       return *this;
     }
     virtual DisassemblerStream& operator<<(const ImmediatePrinter& imm) {
-      os_ << imm;
+      AppendChar('#');
+      AppendUnsigned(imm.GetImm());
       return *this;
     }
     virtual DisassemblerStream& operator<<(const SignedImmediatePrinter& imm) {
-      os_ << imm;
+      AppendChar('#');
+      AppendSigned(imm.GetImm());
       return *this;
     }
     virtual DisassemblerStream& operator<<(const RawImmediatePrinter& imm) {
-      os_ << imm;
+      AppendUnsigned(imm.GetImm());
       return *this;
     }
     virtual DisassemblerStream& operator<<(const DtPrinter& dt) {
-      os_ << dt;
+      if (!dt.GetDt().Is(dt.GetDefaultDt())) Append(dt.GetDt().GetName());
       return *this;
     }
     virtual DisassemblerStream& operator<<(const DataType& type) {
-      os_ << type;
+      Append(type.GetName());
       return *this;
     }
     virtual DisassemblerStream& operator<<(Shift shift) {
-      os_ << shift;
+      Append(shift.GetName());
       return *this;
     }
     virtual DisassemblerStream& operator<<(Sign sign) {
-      os_ << sign;
-      return *this;
-    }
-    virtual DisassemblerStream& operator<<(Alignment alignment) {
-      os_ << alignment;
+      Append(sign.GetName());
       return *this;
     }
+    virtual DisassemblerStream& operator<<(Alignment alignment);
     virtual DisassemblerStream& operator<<(const PrintLabel& label) {
-      os_ << label;
+      Append("0x", 2);
+      AppendHex(static_cast<uint32_t>(label.GetLocation()), 8);
       return *this;
     }
     virtual DisassemblerStream& operator<<(const WriteBack& write_back) {
-      os_ << write_back;
-      return *this;
-    }
-    virtual DisassemblerStream& operator<<(const NeonImmediate& immediate) {
-      os_ << immediate;
-      return *this;
-    }
-    virtual DisassemblerStream& operator<<(Register reg) {
-      os_ << reg;
+      if (write_back.DoesWriteBack()) AppendChar('!');
       return *this;
     }
+    virtual DisassemblerStream& operator<<(const NeonImmediate& immediate);
+    virtual DisassemblerStream& operator<<(Register reg);
     virtual DisassemblerStream& operator<<(SRegister reg) {
-      os_ << reg;
+      AppendChar('s');
+      AppendUnsigned(reg.GetCode());
       return *this;
     }
     virtual DisassemblerStream& operator<<(DRegister reg) {
-      os_ << reg;
+      AppendChar('d');
+      AppendUnsigned(reg.GetCode());
       return *this;
     }
     virtual DisassemblerStream& operator<<(QRegister reg) {
-      os_ << reg;
-      return *this;
-    }
-    virtual DisassemblerStream& operator<<(const RegisterOrAPSR_nzcv reg) {
-      os_ << reg;
+      AppendChar('q');
+      AppendUnsigned(reg.GetCode());
       return *this;
     }
+    virtual DisassemblerStream& operator<<(const RegisterOrAPSR_nzcv reg);
     virtual DisassemblerStream& operator<<(SpecialRegister reg) {
-      os_ << reg;
+      Append(reg.GetName());
       return *this;
     }
     virtual DisassemblerStream& operator<<(MaskedSpecialRegister reg) {
-      os_ << reg;
+      Append(reg.GetName());
       return *this;
     }
     virtual DisassemblerStream& operator<<(SpecialFPRegister reg) {
-      os_ << reg;
+      Append(reg.GetName());
       return *this;
     }
     virtual DisassemblerStream& operator<<(BankedRegister reg) {
-      os_ << reg;
-      return *this;
-    }
-    virtual DisassemblerStream& operator<<(const RegisterList& list) {
-      os_ << list;
-      return *this;
-    }
-    virtual DisassemblerStream& operator<<(const SRegisterList& list) {
-      os_ << list;
-      return *this;
-    }
-    virtual DisassemblerStream& operator<<(const DRegisterList& list) {
-      os_ << list;
-      return *this;
-    }
-    virtual DisassemblerStream& operator<<(const NeonRegisterList& list) {
-      os_ << list;
-      return *this;
-    }
-    virtual DisassemblerStream& operator<<(const DRegisterLane& reg) {
-      os_ << reg;
-      return *this;
-    }
-    virtual DisassemblerStream& operator<<(const IndexedRegisterPrinter& reg) {
-      os_ << reg;
+      Append(reg.GetName());
       return *this;
     }
+    virtual DisassemblerStream& operator<<(const RegisterList& list);
+    virtual DisassemblerStream& operator<<(const SRegisterList& list);
+    virtual DisassemblerStream& operator<<(const DRegisterList& list);
+    virtual DisassemblerStream& operator<<(const NeonRegisterList& list);
+    virtual DisassemblerStream& operator<<(const DRegisterLane& reg);
+    virtual DisassemblerStream& operator<<(const IndexedRegisterPrinter& reg);
     virtual DisassemblerStream& operator<<(Coprocessor coproc) {
-      os_ << coproc;
+      AppendChar('p');
+      AppendUnsigned(coproc.GetCoprocessor());
       return *this;
     }
     virtual DisassemblerStream& operator<<(CRegister reg) {
-      os_ << reg;
+      AppendChar('c');
+      AppendUnsigned(reg.GetCode());
       return *this;
     }
     virtual DisassemblerStream& operator<<(Endianness endian_specifier) {
-      os_ << endian_specifier;
+      Append(endian_specifier.GetName());
       return *this;
     }
     virtual DisassemblerStream& operator<<(MemoryBarrier option) {
-      os_ << option;
+      Append(option.GetName());
       return *this;
     }
     virtual DisassemblerStream& operator<<(InterruptFlags iflags) {
-      os_ << iflags;
+      Append(iflags.GetName());
       return *this;
     }
     virtual DisassemblerStream& operator<<(const Operand& operand) {
       if (operand.IsImmediate()) {
         if (Has(kBitwise)) {
-          return *this << "#0x" << std::hex << operand.GetImmediate()
-                       << std::dec;
+          Append("#0x", 3);
+          AppendHex(operand.GetImmediate());
+          return *this;
         }
         return *this << "#" << operand.GetImmediate();
       }
@@ -579,29 +682,28 @@ class Disassembler {
   }
 
   virtual void UnallocatedT32(uint32_t instruction) {
+    os() << "unallocated ";
     if (T32Size(instruction) == 2) {
-      os() << "unallocated " << std::hex << std::setw(4) << std::setfill('0')
-           << (instruction >> 16) << std::dec;
+      os().AppendHex(instruction >> 16, 4);
     } else {
-      os() << "unallocated " << std::hex << std::setw(8) << std::setfill('0')
-           << instruction << std::dec;
+      os().AppendHex(instruction, 8);
     }
   }
   virtual void UnallocatedA32(uint32_t instruction) {
-    os() << "unallocated " << std::hex << std::setw(8) << std::setfill('0')
-         << instruction << std::dec;
+    os() << "unallocated ";
+    os().AppendHex(instruction, 8);
   }
   virtual void UnimplementedT32_16(const char* name, uint32_t instruction) {
-    os() << "unimplemented " << name << " T32:" << std::hex << std::setw(4)
-         << std::setfill('0') << (instruction >> 16) << std::dec;
+    os() << "unimplemented " << name << " T32:";
+    os().AppendHex(instruction >> 16, 4);
   }
   virtual void UnimplementedT32_32(const char* name, uint32_t instruction) {
-    os() << "unimplemented " << name << " T32:" << std::hex << std::setw(8)
-         << std::setfill('0') << instruction << std::dec;
+    os() << "unimplemented " << name << " T32:";
+    os().AppendHex(instruction, 8);
   }
   virtual void UnimplementedA32(const char* name, uint32_t instruction) {
-    os() << "unimplemented " << name << " ARM:" << std::hex << std::setw(8)
-         << std::setfill('0') << instruction << std::dec;
+    os() << "unimplemented " << name << " ARM:";
+    os().AppendHex(instruction, 8);
   }
   virtual void Unpredictable() { os() << " ; unpredictable"; }
   virtual void UnpredictableT32(uint32_t /*instr*/) { return Unpredictable(); }
@@ -2695,18 +2797,19 @@ class PrintDisassembler : public Disassembler {
       : Disassembler(os, code_address) {}
 
   virtual void PrintCodeAddress(uint32_t code_address) {
-    os() << "0x" << std::hex << std::setw(8) << std::setfill('0')
-         << code_address << "\t";
+    os() << "0x";
+    os().AppendHex(code_address, 8);
+    os() << "\t";
   }
 
   virtual void PrintOpcode16(uint32_t opcode) {
-    os() << std::hex << std::setw(4) << std::setfill('0') << opcode << "    "
-         << std::dec << "\t";
+    os().AppendHex(opcode, 4);
+    os() << "    \t";
   }
 
   virtual void PrintOpcode32(uint32_t opcode) {
-    os() << std::hex << std::setw(8) << std::setfill('0') << opcode << std::dec
-         << "\t";
+    os().AppendHex(opcode, 8);
+    os() << "\t";
   }
 
   const uint32_t* DecodeA32At(const uint32_t* instruction_address) {
@@ -220,6 +220,19 @@ void MacroAssembler::EnsureEmitPoolsFor(size_t size_arg) {
 }
 
 
+void MacroAssembler::EmitPoolsAtBarrier() {
+  if (!pool_manager_.ShouldEmitAtBarrier(GetCursorOffset())) return;
+  int32_t new_pc = pool_manager_.Emit(this,
+                                      GetCursorOffset(),
+                                      0,
+                                      NULL,
+                                      NULL,
+                                      PoolManager<int32_t>::kNoBranchRequired);
+  VIXL_ASSERT(new_pc == GetCursorOffset());
+  USE(new_pc);
+}
+
+
 void MacroAssembler::HandleOutOfBoundsImmediate(Condition cond,
                                                 Register tmp,
                                                 uint32_t imm) {
@@ -254,6 +254,11 @@ class MacroAssembler : public Assembler, public MacroAssemblerInterface {
 
   void HandleOutOfBoundsImmediate(Condition cond, Register tmp, uint32_t imm);
 
+  // Called right after an instruction that never falls through, to emit the
+  // pools there if they are close enough to their checkpoint. See
+  // SetPoolBarrierWindow().
+  void EmitPoolsAtBarrier();
+
  public:
   // TODO: If we change the MacroAssembler to disallow setting a different ISA,
   // we can change the alignment of the pool in the pool manager constructor to
@@ -262,9 +267,11 @@ class MacroAssembler : public Assembler, public MacroAssemblerInterface {
       : Assembler(isa),
         available_(r12),
         current_scratch_scope_(NULL),
+        arena_(),
         pool_manager_(4 /*header_size*/,
                       4 /*alignment*/,
-                      4 /*buffer_alignment*/),
+                      4 /*buffer_alignment*/,
+                      &arena_),
         generate_simulator_code_(VIXL_AARCH32_GENERATE_SIMULATOR_CODE),
         pool_end_(NULL) {
 #ifdef VIXL_DEBUG
@@ -278,9 +285,11 @@ class MacroAssembler : public Assembler, public MacroAssemblerInterface {
       : Assembler(size, isa),
         available_(r12),
         current_scratch_scope_(NULL),
+        arena_(),
         pool_manager_(4 /*header_size*/,
                       4 /*alignment*/,
-                      4 /*buffer_alignment*/),
+                      4 /*buffer_alignment*/,
+                      &arena_),
         generate_simulator_code_(VIXL_AARCH32_GENERATE_SIMULATOR_CODE),
         pool_end_(NULL) {
 #ifdef VIXL_DEBUG
@@ -292,9 +301,11 @@ class MacroAssembler : public Assembler, public MacroAssemblerInterface {
       : Assembler(buffer, size, isa),
         available_(r12),
         current_scratch_scope_(NULL),
+        arena_(),
         pool_manager_(4 /*header_size*/,
                       4 /*alignment*/,
-                      4 /*buffer_alignment*/),
+                      4 /*buffer_alignment*/,
+                      &arena_),
         generate_simulator_code_(VIXL_AARCH32_GENERATE_SIMULATOR_CODE),
         pool_end_(NULL) {
 #ifdef VIXL_DEBUG
@@ -313,9 +324,16 @@ class MacroAssembler : public Assembler, public MacroAssemblerInterface {
     EmitLiteralPool(option == kUnreachable
                         ? PoolManager<int32_t>::kNoBranchRequired
                         : PoolManager<int32_t>::kBranchRequired);
+    // Objects in the arena are only used until they are placed in a pool.
+    if (pool_manager_.IsEmpty()) arena_.Reset();
     Assembler::FinalizeCode();
   }
 
+  // The arena used for objects that the MacroAssembler creates for its own
+  // use, such as the literals of Ldr and Vldr with immediate operands. It is
+  // reset by FinalizeCode(), so anything allocated in it must be dead by then.
+  Arena* GetArena() { return &arena_; }
+
   RegisterList* GetScratchRegisterList() { return &available_; }
   VRegisterList* GetScratchVRegisterList() { return &available_vfp_; }
 
@@ -488,6 +506,18 @@ class MacroAssembler : public Assembler, public MacroAssemblerInterface {
     USE(new_pc);
   }
 
+  // Allow the pools to be emitted at natural barriers, such as right after an
+  // unconditional branch or a return, up to `window` bytes before they would
+  // otherwise have to be emitted. This avoids the branch over the pool, at the
+  // cost of emitting the pool earlier than necessary. A window of zero (the
+  // default) disables this.
+  void SetPoolBarrierWindow(int32_t window) {
+    pool_manager_.SetBarrierWindow(window);
+  }
+  int32_t GetPoolBarrierWindow() const {
+    return pool_manager_.GetBarrierWindow();
+  }
+
   void EnsureEmitFor(uint32_t size) {
     EnsureEmitPoolsFor(size);
     VIXL_ASSERT(GetBuffer()->HasSpaceFor(size) || GetBuffer()->IsManaged());
@@ -768,7 +798,7 @@ class MacroAssembler : public Assembler, public MacroAssemblerInterface {
     VIXL_ASSERT(allow_macro_instructions_);
     VIXL_ASSERT(OutsideITBlock());
     RawLiteral* literal =
-        new Literal<uint32_t>(v, RawLiteral::kDeletedOnPlacementByPool);
+        arena_.New<Literal<uint32_t> >(v, RawLiteral::kDeletedOnPlacementByPool);
     Ldr(cond, rt, literal);
   }
   template <typename T>
@@ -783,7 +813,7 @@ class MacroAssembler : public Assembler, public MacroAssemblerInterface {
     VIXL_ASSERT(allow_macro_instructions_);
     VIXL_ASSERT(OutsideITBlock());
     RawLiteral* literal =
-        new Literal<uint64_t>(v, RawLiteral::kDeletedOnPlacementByPool);
+        arena_.New<Literal<uint64_t> >(v, RawLiteral::kDeletedOnPlacementByPool);
     Ldrd(cond, rt, rt2, literal);
   }
   template <typename T>
@@ -796,7 +826,7 @@ class MacroAssembler : public Assembler, public MacroAssemblerInterface {
     VIXL_ASSERT(allow_macro_instructions_);
     VIXL_ASSERT(OutsideITBlock());
     RawLiteral* literal =
-        new Literal<float>(v, RawLiteral::kDeletedOnPlacementByPool);
+        arena_.New<Literal<float> >(v, RawLiteral::kDeletedOnPlacementByPool);
     Vldr(cond, rd, literal);
   }
   void Vldr(SRegister rd, float v) { Vldr(al, rd, v); }
@@ -806,7 +836,7 @@ class MacroAssembler : public Assembler, public MacroAssemblerInterface {
     VIXL_ASSERT(allow_macro_instructions_);
     VIXL_ASSERT(OutsideITBlock());
     RawLiteral* literal =
-        new Literal<double>(v, RawLiteral::kDeletedOnPlacementByPool);
+        arena_.New<Literal<double> >(v, RawLiteral::kDeletedOnPlacementByPool);
     Vldr(cond, rd, literal);
   }
   void Vldr(DRegister rd, double v) { Vldr(al, rd, v); }
@@ -1311,9 +1341,12 @@ class MacroAssembler : public Assembler, public MacroAssemblerInterface {
       // We have already checked for pool emission.
       pool_policy = MacroEmissionCheckScope::kIgnorePools;
     }
-    MacroEmissionCheckScope guard(this, pool_policy);
-    b(cond, size, label);
-    RegisterForwardReference(label);
+    {
+      MacroEmissionCheckScope guard(this, pool_policy);
+      b(cond, size, label);
+      RegisterForwardReference(label);
+    }
+    if (cond.Is(al)) EmitPoolsAtBarrier();
   }
   void B(Label* label, BranchHint hint = kBranchWithoutHint) {
     B(al, label, hint);
@@ -1485,12 +1518,16 @@ class MacroAssembler : public Assembler, public MacroAssemblerInterface {
     VIXL_ASSERT(!AliasesAvailableScratchRegister(rm));
     VIXL_ASSERT(allow_macro_instructions_);
     VIXL_ASSERT(OutsideITBlock());
-    MacroEmissionCheckScope guard(this);
-    bool can_use_it =
-        // BX{<c>}{<q>} <Rm> ; T1
-        !rm.IsPC();
-    ITScope it_scope(this, &cond, guard, can_use_it);
-    bx(cond, rm);
+    bool is_barrier = cond.Is(al);
+    {
+      MacroEmissionCheckScope guard(this);
+      bool can_use_it =
+          // BX{<c>}{<q>} <Rm> ; T1
+          !rm.IsPC();
+      ITScope it_scope(this, &cond, guard, can_use_it);
+      bx(cond, rm);
+    }
+    if (is_barrier) EmitPoolsAtBarrier();
   }
   void Bx(Register rm) { Bx(al, rm); }
 
@@ -2895,14 +2932,18 @@ class MacroAssembler : public Assembler, public MacroAssemblerInterface {
     VIXL_ASSERT(!AliasesAvailableScratchRegister(registers));
     VIXL_ASSERT(allow_macro_instructions_);
     VIXL_ASSERT(OutsideITBlock());
-    MacroEmissionCheckScope guard(this);
-    ITScope it_scope(this, &cond, guard);
-    if (registers.IsSingleRegister() &&
-        (!IsUsingT32() || !registers.IsR0toR7orPC())) {
-      pop(cond, registers.GetFirstAvailableRegister());
-    } else if (!registers.IsEmpty()) {
-      pop(cond, registers);
+    bool is_barrier = cond.Is(al) && registers.Includes(pc);
+    {
+      MacroEmissionCheckScope guard(this);
+      ITScope it_scope(this, &cond, guard);
+      if (registers.IsSingleRegister() &&
+          (!IsUsingT32() || !registers.IsR0toR7orPC())) {
+        pop(cond, registers.GetFirstAvailableRegister());
+      } else if (!registers.IsEmpty()) {
+        pop(cond, registers);
+      }
     }
+    if (is_barrier) EmitPoolsAtBarrier();
   }
   void Pop(RegisterList registers) { Pop(al, registers); }
 
@@ -2910,9 +2951,13 @@ class MacroAssembler : public Assembler, public MacroAssemblerInterface {
     VIXL_ASSERT(!AliasesAvailableScratchRegister(rt));
     VIXL_ASSERT(allow_macro_instructions_);
     VIXL_ASSERT(OutsideITBlock());
-    MacroEmissionCheckScope guard(this);
-    ITScope it_scope(this, &cond, guard);
-    pop(cond, rt);
+    bool is_barrier = cond.Is(al) && rt.IsPC();
+    {
+      MacroEmissionCheckScope guard(this);
+      ITScope it_scope(this, &cond, guard);
+      pop(cond, rt);
+    }
+    if (is_barrier) EmitPoolsAtBarrier();
   }
   void Pop(Register rt) { Pop(al, rt); }
 
@@ -11076,6 +11121,9 @@ class MacroAssembler : public Assembler, public MacroAssemblerInterface {
   VRegisterList available_vfp_;
   UseScratchRegisterScope* current_scratch_scope_;
   MacroAssemblerContext context_;
+  // Short-lived objects owned by the MacroAssembler. This is declared before
+  // the pool manager, so that it outlives it.
+  Arena arena_;
   PoolManager<int32_t> pool_manager_;
   bool generate_simulator_code_;
   bool allow_macro_instructions_;
@@ -418,6 +418,12 @@ class Assembler : public vixl::internal::AssemblerBase {
       : AssemblerBase(buffer, capacity),
         pic_(pic),
         cpu_features_(CPUFeatures::AArch64LegacyBaseline()) {}
+  Assembler(CodeSpace* space,
+            size_t capacity,
+            PositionIndependentCodeOption pic = PositionIndependentCode)
+      : AssemblerBase(space, capacity),
+        pic_(pic),
+        cpu_features_(CPUFeatures::AArch64LegacyBaseline()) {}
 
   // Upon destruction, the code will assert that one of the following is true:
   //  * The Assembler object has not been used.
@@ -0,0 +1,127 @@
+// Copyright 2026, VIXL authors
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//   * Redistributions of source code must retain the above copyright notice,
+//     this list of conditions and the following disclaimer.
+//   * Redistributions in binary form must reproduce the above copyright notice,
+//     this list of conditions and the following disclaimer in the documentation
+//     and/or other materials provided with the distribution.
+//   * Neither the name of ARM Limited nor the names of its contributors may be
+//     used to endorse or promote products derived from this software without
+//     specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS CONTRIBUTORS "AS IS" AND
+// ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+// WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include <algorithm>
+
+#include "code-patching-aarch64.h"
+#include "cpu-aarch64.h"
+
+namespace vixl {
+namespace aarch64 {
+
+void PatchingSession::PrepareWrite(ptrdiff_t offset, size_t size) {
+  VIXL_ASSERT(offset >= 0);
+  VIXL_ASSERT((offset + size) <= buffer_->GetSizeInBytes());
+  if (size == 0) return;
+
+  Range range = {offset, static_cast<ptrdiff_t>(offset + size)};
+  dirty_ranges_.push_back(range);
+
+  // The buffer is page-aligned, so page boundaries can be computed directly
+  // from the offsets.
+  size_t page_size = CodeBuffer::GetPageSize();
+  Range pages = {AlignDown(range.start, page_size),
+                 AlignUp(range.end, page_size)};
+  // Patches tend to be clustered, so most writes fall into pages that have
+  // already been made writable.
+  for (size_t i = 0; i < writable_pages_.size(); i++) {
+    if ((writable_pages_[i].start <= pages.start) &&
+        (pages.end <= writable_pages_[i].end)) {
+      return;
+    }
+  }
+  buffer_->SetWritable(pages.start, GetSizeInBuffer(pages));
+  writable_pages_.push_back(pages);
+}
+
+
+void PatchingSession::PatchInstruction(ptrdiff_t offset, Instr instr) {
+  PrepareWrite(offset, kInstructionSize);
+  buffer_->GetOffsetAddress<Instruction*>(offset)->SetInstructionBits(instr);
+}
+
+
+void PatchingSession::RetargetBranch(ptrdiff_t offset,
+                                     ptrdiff_t target_offset) {
+  PrepareWrite(offset, kInstructionSize);
+  Instruction* branch = buffer_->GetOffsetAddress<Instruction*>(offset);
+  branch->SetImmPCOffsetTarget(
+      buffer_->GetOffsetAddress<Instruction*>(target_offset));
+}
+
+
+void PatchingSession::Commit() {
+  if (IsEmpty()) return;
+
+  // The page ranges may overlap, or be adjacent, since they were recorded in
+  // write order.
+  Coalesce(&writable_pages_);
+  for (size_t i = 0; i < writable_pages_.size(); i++) {
+    buffer_->SetExecutable(writable_pages_[i].start,
+                           GetSizeInBuffer(writable_pages_[i]));
+  }
+
+  Coalesce(&dirty_ranges_);
+  std::vector<CPU::CacheRange> cache_ranges(dirty_ranges_.size());
+  for (size_t i = 0; i < dirty_ranges_.size(); i++) {
+    cache_ranges[i].address =
+        buffer_->GetExecutableOffsetAddress<void*>(dirty_ranges_[i].start);
+    cache_ranges[i].length = dirty_ranges_[i].end - dirty_ranges_[i].start;
+  }
+  CPU::EnsureIAndDCacheCoherency(cache_ranges.data(), cache_ranges.size());
+
+  dirty_ranges_.clear();
+  writable_pages_.clear();
+}
+
+
+size_t PatchingSession::GetSizeInBuffer(const Range& range) const {
+  // The capacity of the buffer need not be a whole number of pages, but the
+  // last page is still protected as a whole by the buffer itself.
+  ptrdiff_t capacity = static_cast<ptrdiff_t>(buffer_->GetCapacity());
+  VIXL_ASSERT(range.start < capacity);
+  return std::min(range.end, capacity) - range.start;
+}
+
+
+void PatchingSession::Coalesce(std::vector<Range>* ranges) {
+  if (ranges->empty()) return;
+  std::sort(ranges->begin(), ranges->end());
+  size_t last = 0;
+  for (size_t i = 1; i < ranges->size(); i++) {
+    Range& current = (*ranges)[last];
+    const Range& next = (*ranges)[i];
+    if (next.start <= current.end) {
+      current.end = std::max(current.end, next.end);
+    } else {
+      (*ranges)[++last] = next;
+    }
+  }
+  ranges->resize(last + 1);
+}
+
+}  // namespace aarch64
+}  // namespace vixl
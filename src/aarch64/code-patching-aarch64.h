@@ -0,0 +1,122 @@
+// Copyright 2026, VIXL authors
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//   * Redistributions of source code must retain the above copyright notice,
+//     this list of conditions and the following disclaimer.
+//   * Redistributions in binary form must reproduce the above copyright notice,
+//     this list of conditions and the following disclaimer in the documentation
+//     and/or other materials provided with the distribution.
+//   * Neither the name of ARM Limited nor the names of its contributors may be
+//     used to endorse or promote products derived from this software without
+//     specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS CONTRIBUTORS "AS IS" AND
+// ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+// WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef VIXL_AARCH64_CODE_PATCHING_AARCH64_H_
+#define VIXL_AARCH64_CODE_PATCHING_AARCH64_H_
+
+#include <vector>
+
+#include "../code-buffer-vixl.h"
+#include "../globals-vixl.h"
+
+#include "assembler-aarch64.h"
+#include "instructions-aarch64.h"
+
+namespace vixl {
+namespace aarch64 {
+
+// A PatchingSession batches modifications to code that has already been made
+// executable, such as updating placed literals or retargeting branches.
+//
+// Each write only makes the pages it touches writable, and the written ranges
+// are recorded. On Commit() (or destruction), the ranges are coalesced, only
+// the affected pages are made executable again, and the instruction and data
+// caches are synchronised in a single batched pass.
+//
+//   {
+//     PatchingSession session(masm.GetBuffer());
+//     session.UpdateLiteral(&literal, new_value);
+//     session.RetargetBranch(branch_offset, target_offset);
+//   }  // The code is executable and coherent again here.
+//
+// The buffer must be executable (see CodeBuffer::SetExecutable()) when the
+// session starts.
+class PatchingSession {
+ public:
+  explicit PatchingSession(CodeBuffer* buffer) : buffer_(buffer) {
+    VIXL_ASSERT(buffer_ != NULL);
+  }
+  ~PatchingSession() { Commit(); }
+
+  // Make [offset, offset + size) writable and record it as modified. This is
+  // only needed when writing to the buffer directly; the helpers below call
+  // it themselves.
+  void PrepareWrite(ptrdiff_t offset, size_t size);
+
+  // Update a literal that has been placed in the buffer.
+  template <typename T>
+  void UpdateLiteral(Literal<T>* literal, T new_value) {
+    VIXL_ASSERT(literal->IsPlaced());
+    PrepareWrite(literal->GetOffset(), literal->GetSize());
+    literal->UpdateValue(new_value, buffer_->GetStartAddress<uint8_t*>());
+  }
+  template <typename T>
+  void UpdateLiteral(Literal<T>* literal, T high64, T low64) {
+    VIXL_ASSERT(literal->IsPlaced());
+    PrepareWrite(literal->GetOffset(), literal->GetSize());
+    literal->UpdateValue(high64,
+                         low64,
+                         buffer_->GetStartAddress<uint8_t*>());
+  }
+
+  // Overwrite the instruction at `offset`.
+  void PatchInstruction(ptrdiff_t offset, Instr instr);
+
+  // Make the PC-relative branch (or adr/adrp) at `offset` target the
+  // instruction at `target_offset`. The target must be in range.
+  void RetargetBranch(ptrdiff_t offset, ptrdiff_t target_offset);
+
+  // Make the modified pages executable again and synchronise the caches. The
+  // session can be reused afterwards.
+  void Commit();
+
+  bool IsEmpty() const { return dirty_ranges_.empty(); }
+
+ private:
+  struct Range {
+    ptrdiff_t start;
+    ptrdiff_t end;
+
+    bool operator<(const Range& other) const { return start < other.start; }
+  };
+
+  // Return the size of the part of `range` that lies within the buffer.
+  size_t GetSizeInBuffer(const Range& range) const;
+
+  // Sort `ranges` and merge any that overlap or touch.
+  static void Coalesce(std::vector<Range>* ranges);
+
+  CodeBuffer* buffer_;
+  // The byte ranges written in this session.
+  std::vector<Range> dirty_ranges_;
+  // The page-aligned ranges made writable in this session.
+  std::vector<Range> writable_pages_;
+};
+
+}  // namespace aarch64
+}  // namespace vixl
+
+#endif  // VIXL_AARCH64_CODE_PATCHING_AARCH64_H_
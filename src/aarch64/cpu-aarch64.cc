@@ -475,50 +475,63 @@ int CPU::ReadSVEVectorLengthInBits() {
 
 
 void CPU::EnsureIAndDCacheCoherency(void* address, size_t length) {
+  CacheRange range = {address, length};
+  EnsureIAndDCacheCoherency(&range, 1);
+}
+
+
+void CPU::EnsureIAndDCacheCoherency(const CacheRange* ranges, size_t count) {
 #ifdef __aarch64__
   // Implement the cache synchronisation for all targets where AArch64 is the
   // host, even if we're building the simulator for an AAarch64 host. This
   // allows for cases where the user wants to simulate code as well as run it
   // natively.
 
-  if (length == 0) {
-    return;
-  }
-
   // The code below assumes user space cache operations are allowed.
 
   // Work out the line sizes for each cache, and use them to determine the
   // start addresses.
-  uintptr_t start = reinterpret_cast<uintptr_t>(address);
   uintptr_t dsize = static_cast<uintptr_t>(dcache_line_size_);
   uintptr_t isize = static_cast<uintptr_t>(icache_line_size_);
-  uintptr_t dline = start & ~(dsize - 1);
-  uintptr_t iline = start & ~(isize - 1);
 
   // Cache line sizes are always a power of 2.
   VIXL_ASSERT(IsPowerOf2(dsize));
   VIXL_ASSERT(IsPowerOf2(isize));
-  uintptr_t end = start + length;
-
-  do {
-    __asm__ __volatile__(
-        // Clean each line of the D cache containing the target data.
-        //
-        // dc       : Data Cache maintenance
-        //     c    : Clean
-        //      va  : by (Virtual) Address
-        //        u : to the point of Unification
-        // The point of unification for a processor is the point by which the
-        // instruction and data caches are guaranteed to see the same copy of a
-        // memory location. See ARM DDI 0406B page B2-12 for more information.
-        "   dc    cvau, %[dline]\n"
-        :
-        : [dline] "r"(dline)
-        // This code does not write to memory, but the "memory" dependency
-        // prevents GCC from reordering the code.
-        : "memory");
-    dline += dsize;
-  } while (dline < end);
+
+  bool any_lines = false;
+  for (size_t i = 0; i < count; i++) {
+    if (ranges[i].length == 0) continue;
+    any_lines = true;
+
+    uintptr_t start = reinterpret_cast<uintptr_t>(ranges[i].address);
+    uintptr_t dline = start & ~(dsize - 1);
+    uintptr_t end = start + ranges[i].length;
+
+    do {
+      __asm__ __volatile__(
+          // Clean each line of the D cache containing the target data.
+          //
+          // dc       : Data Cache maintenance
+          //     c    : Clean
+          //      va  : by (Virtual) Address
+          //        u : to the point of Unification
+          // The point of unification for a processor is the point by which the
+          // instruction and data caches are guaranteed to see the same copy of
+          // a memory location. See ARM DDI 0406B page B2-12 for more
+          // information.
+          "   dc    cvau, %[dline]\n"
+          :
+          : [dline] "r"(dline)
+          // This code does not write to memory, but the "memory" dependency
+          // prevents GCC from reordering the code.
+          : "memory");
+      dline += dsize;
+    } while (dline < end);
+  }
+
+  if (!any_lines) {
+    return;
+  }
 
   __asm__ __volatile__(
       // Make sure that the data cache operations (above) complete before the
@@ -538,20 +551,28 @@ void CPU::EnsureIAndDCacheCoherency(void* address, size_t length) {
       :
       : "memory");
 
-  do {
-    __asm__ __volatile__(
-        // Invalidate each line of the I cache containing the target data.
-        //
-        // ic      : Instruction Cache maintenance
-        //    i    : Invalidate
-        //     va  : by Address
-        //       u : to the point of Unification
-        "   ic   ivau, %[iline]\n"
-        :
-        : [iline] "r"(iline)
-        : "memory");
-    iline += isize;
-  } while (iline < end);
+  for (size_t i = 0; i < count; i++) {
+    if (ranges[i].length == 0) continue;
+
+    uintptr_t start = reinterpret_cast<uintptr_t>(ranges[i].address);
+    uintptr_t iline = start & ~(isize - 1);
+    uintptr_t end = start + ranges[i].length;
+
+    do {
+      __asm__ __volatile__(
+          // Invalidate each line of the I cache containing the target data.
+          //
+          // ic      : Instruction Cache maintenance
+          //    i    : Invalidate
+          //     va  : by Address
+          //       u : to the point of Unification
+          "   ic   ivau, %[iline]\n"
+          :
+          : [iline] "r"(iline)
+          : "memory");
+      iline += isize;
+    } while (iline < end);
+  }
 
   __asm__ __volatile__(
       // Make sure that the instruction cache operations (above) take effect
@@ -568,7 +589,7 @@ void CPU::EnsureIAndDCacheCoherency(void* address, size_t length) {
 #else
   // If the host isn't AArch64, we must be using the simulator, so this function
   // doesn't have to do anything.
-  USE(address, length);
+  USE(ranges, count);
 #endif
 }
 
@@ -249,6 +249,20 @@ class CPU {
   // safely run.
   static void EnsureIAndDCacheCoherency(void *address, size_t length);
 
+  // A range of memory for use with the batched form of
+  // EnsureIAndDCacheCoherency.
+  struct CacheRange {
+    void *address;
+    size_t length;
+  };
+
+  // Like EnsureIAndDCacheCoherency(address, length), but for `count` ranges at
+  // once. Every range is cleaned and invalidated, but the barriers are only
+  // issued once for the whole batch. This is much cheaper than handling each
+  // range separately when patching several scattered words.
+  static void EnsureIAndDCacheCoherency(const CacheRange *ranges,
+                                        size_t count);
+
   // Read and interpret the ID registers. This requires
   // CPUFeatures::kIDRegisterEmulation, and therefore cannot be called on
   // non-AArch64 platforms.
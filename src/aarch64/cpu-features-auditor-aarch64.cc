@@ -71,6 +71,12 @@ CPUFeaturesAuditor::GetFormToVisitorFnMap() {
   return &form_to_visitor;
 }
 
+const CPUFeaturesAuditor::FormToVisitorFnTable*
+CPUFeaturesAuditor::GetFormToVisitorFnTable() {
+  static const FormToVisitorFnTable form_to_visitor(*GetFormToVisitorFnMap());
+  return &form_to_visitor;
+}
+
 // Every instruction must update last_instruction_, even if only to clear it,
 // and every instruction must also update seen_ once it has been fully handled.
 // This scope makes that simple, and allows early returns in the decode logic.
@@ -1401,14 +1407,12 @@ void CPUFeaturesAuditor::VisitUnimplemented(const Instruction* instr) {
 }
 
 void CPUFeaturesAuditor::Visit(Metadata* metadata, const Instruction* instr) {
-  VIXL_ASSERT(metadata->count("form") > 0);
-  const std::string& form = (*metadata)["form"];
-  uint32_t form_hash = Hash(form.c_str());
-  const FormToVisitorFnMap* fv = CPUFeaturesAuditor::GetFormToVisitorFnMap();
-  FormToVisitorFnMap::const_iterator it = fv->find(form_hash);
-  if (it == fv->end()) {
+  const FormToVisitorFn* fn =
+      CPUFeaturesAuditor::GetFormToVisitorFnTable()->Get(metadata->GetFormId());
+  if (fn == NULL) {
     RecordInstructionFeaturesScope scope(this);
-    std::map<uint32_t, const CPUFeatures> features = {
+    uint32_t form_hash = metadata->GetFormHash();
+    static const std::map<uint32_t, const CPUFeatures> features = {
         {"adclb_z_zzz"_h, CPUFeatures::kSVE2},
         {"adclt_z_zzz"_h, CPUFeatures::kSVE2},
         {"addhnb_z_zz"_h, CPUFeatures::kSVE2},
@@ -1802,11 +1806,28 @@ void CPUFeaturesAuditor::Visit(Metadata* metadata, const Instruction* instr) {
         {"setp_set_memcms"_h, CPUFeatures::kMOPS},
     };
 
-    if (features.count(form_hash) > 0) {
-      scope.Record(features[form_hash]);
+    std::map<uint32_t, const CPUFeatures>::const_iterator it =
+        features.find(form_hash);
+    if (it != features.end()) {
+      scope.Record(it->second);
     }
   } else {
-    (it->second)(this, instr);
+    (*fn)(this, instr);
+  }
+}
+
+void CPUFeaturesAuditor::VisitBatch(const DecodedInstruction* batch,
+                                    size_t count) {
+  const FormToVisitorFnTable* table =
+      CPUFeaturesAuditor::GetFormToVisitorFnTable();
+  for (size_t i = 0; i < count; i++) {
+    const FormToVisitorFn* fn = table->Get(batch[i].form_id);
+    if (fn == NULL) {
+      Metadata m(batch[i].form_id);
+      Visit(&m, batch[i].instr);
+    } else {
+      (*fn)(this, batch[i].instr);
+    }
   }
 }
 
@@ -105,6 +105,8 @@ class CPUFeaturesAuditor : public DecoderVisitor {
 
   virtual void Visit(Metadata* metadata,
                      const Instruction* instr) VIXL_OVERRIDE;
+  virtual void VisitBatch(const DecodedInstruction* batch,
+                          size_t count) VIXL_OVERRIDE;
 
  private:
   class RecordInstructionFeaturesScope;
@@ -122,10 +124,12 @@ class CPUFeaturesAuditor : public DecoderVisitor {
 
   Decoder* decoder_;
 
-  using FormToVisitorFnMap = std::unordered_map<
-      uint32_t,
-      std::function<void(CPUFeaturesAuditor*, const Instruction*)>>;
+  using FormToVisitorFn =
+      std::function<void(CPUFeaturesAuditor*, const Instruction*)>;
+  using FormToVisitorFnMap = std::unordered_map<uint32_t, FormToVisitorFn>;
+  using FormToVisitorFnTable = FormIdTable<FormToVisitorFn>;
   static const FormToVisitorFnMap* GetFormToVisitorFnMap();
+  static const FormToVisitorFnTable* GetFormToVisitorFnTable();
 };
 
 }  // namespace aarch64
@@ -30,7 +30,9 @@
 #include <list>
 #include <map>
 #include <string>
+#include <vector>
 
+#include "../decode-table-vixl.h"
 #include "../globals-vixl.h"
 
 #include "instructions-aarch64.h"
@@ -274,9 +276,50 @@
 namespace vixl {
 namespace aarch64 {
 
-using Metadata = std::map<std::string, std::string>;
+// Instruction forms, such as "add_32_addsub_imm", are identified by a dense
+// integer ID, assigned when the decode graph is built. The mapping between IDs
+// and form names is the same for every Decoder in the process.
+typedef uint16_t FormId;
 
-// The Visitor interface consists only of the Visit() method. User classes
+// Information about an instruction identified by the Decoder, passed to each
+// visitor. Creating a Metadata object requires no allocation: the form is
+// carried as a FormId, and its name and hash are looked up from static tables.
+//
+// For compatibility with visitors written for the older string-keyed interface,
+// the form can also be read using `(*metadata)["form"]`. The map backing that
+// interface is only populated when it is used.
+class Metadata {
+ public:
+  explicit Metadata(FormId form_id) : form_id_(form_id) {}
+
+  FormId GetFormId() const { return form_id_; }
+  inline uint32_t GetFormHash() const;
+  inline const char* GetFormName() const;
+
+  // Compatibility interface, following std::map<std::string, std::string>.
+  size_t count(const std::string& key) const {
+    return (key == "form") ? 1 : map_.count(key);
+  }
+  std::string& operator[](const std::string& key) {
+    if ((key == "form") && (map_.count(key) == 0)) {
+      map_[key] = GetFormName();
+    }
+    return map_[key];
+  }
+
+ private:
+  FormId form_id_;
+  std::map<std::string, std::string> map_;
+};
+
+// An instruction and its form, as identified by the Decoder. Batches of these
+// are passed to DecoderVisitor::VisitBatch().
+struct DecodedInstruction {
+  const Instruction* instr;
+  FormId form_id;
+};
+
+// The Visitor interface consists mainly of the Visit() method. User classes
 // that inherit from this one must provide an implementation of the method.
 // Information about the instruction encountered by the Decoder is available
 // via the metadata pointer.
@@ -290,6 +333,12 @@ class DecoderVisitor {
 
   virtual void Visit(Metadata* metadata, const Instruction* instr) = 0;
 
+  // Visit `count` decoded instructions, in order. This is used by
+  // Decoder::DecodeBatch(). The default implementation calls Visit() for each
+  // instruction, but visitors may override it to handle the batch more
+  // efficiently.
+  virtual void VisitBatch(const DecodedInstruction* batch, size_t count);
+
   bool IsConstVisitor() const { return constness_ == kConstVisitor; }
   Instruction* MutableInstruction(const Instruction* instr) {
     VIXL_ASSERT(!IsConstVisitor());
@@ -300,23 +349,27 @@ class DecoderVisitor {
   const VisitorConstness constness_;
 };
 
-class DecodeNode;
-class CompiledDecodeNode;
-
-// The instruction decoder is constructed from a graph of decode nodes. At each
-// node, a number of bits are sampled from the instruction being decoded. The
-// resulting value is used to look up the next node in the graph, which then
-// samples other bits, and moves to other decode nodes. Eventually, a visitor
-// node is reached, and the corresponding visitor function is called, which
-// handles the instruction.
+// The instruction decoder is derived from a graph of decode nodes, described by
+// kDecodeMapping. At each node, a number of bits are sampled from the
+// instruction being decoded. The resulting value is used to look up the next
+// node in the graph, which then samples other bits, and moves to other decode
+// nodes. Eventually, a node naming an instruction form is reached, and the
+// registered visitors are called to handle the instruction.
+//
+// The graph is compiled offline into a static table of DecodeTableEntry
+// values, by tools/generate_decoder_tables.py, so constructing a Decoder is
+// cheap.
 class Decoder {
  public:
-  Decoder() { ConstructDecodeGraph(); }
+  Decoder() {}
 
   // Top-level wrappers around the actual decoding function.
   void Decode(const Instruction* instr);
   void Decode(Instruction* instr);
 
+  // Identify the form of an instruction, without calling any visitors.
+  FormId IdentifyForm(const Instruction* instr) const;
+
   // Decode all instructions from start (inclusive) to end (exclusive).
   template <typename T>
   void Decode(T start, T end) {
@@ -325,6 +378,16 @@ class Decoder {
     }
   }
 
+  // Decode all instructions from start (inclusive) to end (exclusive), in
+  // batches of up to kDecodeBatchSize instructions. The forms of a batch are
+  // identified first, then the whole batch is passed to each visitor in turn,
+  // using VisitBatch(). Unlike Decode(start, end), each visitor sees a whole
+  // batch before the next visitor sees any of it, so visitors must not depend
+  // on the order in which they are called for each instruction. All visitors
+  // must be const visitors.
+  void DecodeBatch(const Instruction* start, const Instruction* end);
+  static const size_t kDecodeBatchSize = 256;
+
   // Register a new visitor class with the decoder.
   // Decode() will call the corresponding visitor method from all registered
   // visitor classes when decoding reaches the leaf node of the instruction
@@ -364,329 +427,76 @@ class Decoder {
   // of visitors stored by the decoder.
   void RemoveVisitor(DecoderVisitor* visitor);
 
-  void VisitNamedInstruction(const Instruction* instr, const std::string& name);
+  // Call the visitors for an instruction of the given form.
+  void VisitInstructionForm(const Instruction* instr, FormId form_id);
+  void VisitNamedInstruction(const Instruction* instr,
+                             const std::string& name) {
+    VisitInstructionForm(instr, GetFormId(name.c_str()));
+  }
 
   std::list<DecoderVisitor*>* visitors() { return &visitors_; }
 
-  // Get a DecodeNode by name from the Decoder's map.
-  DecodeNode* GetDecodeNode(std::string name);
+  // Query the instruction forms known to the decoder. Form IDs are dense, in
+  // the range [0, GetFormCount()), and kUnallocatedFormId is used for
+  // encodings that the decoder does not recognise.
+  static const FormId kUnallocatedFormId = 0;
+  static FormId GetFormCount();
+  static const char* GetFormName(FormId form_id);
+  static uint32_t GetFormHash(FormId form_id);
+
+  // Get the ID of the named form. The form must exist.
+  static FormId GetFormId(const char* name);
 
  private:
   // Decodes an instruction and calls the visitor functions registered with the
   // Decoder class.
   void DecodeInstruction(const Instruction* instr);
 
-  // Add an initialised DecodeNode to the decode_node_ map.
-  void AddDecodeNode(const DecodeNode& node);
-
   // Visitors are registered in a list.
   std::list<DecoderVisitor*> visitors_;
 
-  // Compile the dynamically generated decode graph based on the static
-  // information in kDecodeMapping and kVisitorNodes.
-  void ConstructDecodeGraph();
-
-  // Root node for the compiled decoder graph, stored here to avoid a map lookup
-  // for every instruction decoded.
-  CompiledDecodeNode* compiled_decoder_root_;
-
-  // Map of node names to DecodeNodes.
-  std::map<std::string, DecodeNode> decode_nodes_;
+  // Storage for DecodeBatch(), kept to avoid reallocating it for each call.
+  std::vector<DecodedInstruction> batch_;
 };
 
-typedef void (Decoder::*DecodeFnPtr)(const Instruction*);
-typedef uint32_t (Instruction::*BitExtractFn)(void) const;
+uint32_t Metadata::GetFormHash() const {
+  return Decoder::GetFormHash(form_id_);
+}
 
-// A Visitor node maps the name of a visitor to the function that handles it.
-struct VisitorNode {
-  const char* name;
-  const DecodeFnPtr visitor_fn;
-};
+const char* Metadata::GetFormName() const {
+  return Decoder::GetFormName(form_id_);
+}
 
-// DecodePattern and DecodeMapping represent the input data to the decoder
-// compilation stage. After compilation, the decoder is embodied in the graph
-// of CompiledDecodeNodes pointer to by compiled_decoder_root_.
-
-// A DecodePattern maps a pattern of set/unset/don't care (1, 0, x) bits encoded
-// as uint32_t to its handler.
-// The encoding uses two bits per symbol: 0 => 0b00, 1 => 0b01, x => 0b10.
-// 0b11 marks the edge of the most-significant bits of the pattern, which is
-// required to determine the length. For example, the pattern "1x01"_b is
-// encoded in a uint32_t as 0b11_01_10_00_01.
-struct DecodePattern {
-  uint32_t pattern;
-  const char* handler;
-};
-
-// A DecodeMapping consists of the name of a handler, the bits sampled in the
-// instruction by that handler, and a mapping from the pattern that those
-// sampled bits match to the corresponding name of a node.
-struct DecodeMapping {
-  const char* name;
-  const std::vector<uint8_t> sampled_bits;
-  const std::vector<DecodePattern> mapping;
-};
-
-// For speed, before nodes can be used for decoding instructions, they must
-// be compiled. This converts the mapping "bit pattern strings to decoder name
-// string" stored in DecodeNodes to an array look up for the pointer to the next
-// node, stored in CompiledDecodeNodes. Compilation may also apply other
-// optimisations for simple decode patterns.
-class CompiledDecodeNode {
+// Visitors usually associate instruction forms with handlers using a map keyed
+// by form hash. FormIdTable flattens such a map into a vector indexed by
+// FormId, so that dispatching an instruction needs no hashing. Forms that are
+// absent from the map have a NULL entry.
+template <typename T>
+class FormIdTable {
  public:
-  // Constructor for decode node, containing a decode table and pointer to a
-  // function that extracts the bits to be sampled.
-  CompiledDecodeNode(BitExtractFn bit_extract_fn, size_t decode_table_size)
-      : bit_extract_fn_(bit_extract_fn),
-        instruction_name_("node"),
-        decode_table_size_(decode_table_size),
-        decoder_(NULL) {
-    decode_table_ = new CompiledDecodeNode*[decode_table_size_];
-    memset(decode_table_, 0, decode_table_size_ * sizeof(decode_table_[0]));
-  }
-
-  // Constructor for wrappers around visitor functions. These require no
-  // decoding, so no bit extraction function or decode table is assigned.
-  explicit CompiledDecodeNode(std::string iname, Decoder* decoder)
-      : bit_extract_fn_(NULL),
-        instruction_name_(iname),
-        decode_table_(NULL),
-        decode_table_size_(0),
-        decoder_(decoder) {}
-
-  ~CompiledDecodeNode() VIXL_NEGATIVE_TESTING_ALLOW_EXCEPTION {
-    // Free the decode table, if this is a compiled, non-leaf node.
-    if (decode_table_ != NULL) {
-      VIXL_ASSERT(!IsLeafNode());
-      delete[] decode_table_;
+  template <typename M>
+  explicit FormIdTable(const M& map) : table_(Decoder::GetFormCount(), NULL) {
+    for (FormId id = 0; id < table_.size(); id++) {
+      typename M::const_iterator it = map.find(Decoder::GetFormHash(id));
+      if (it != map.end()) table_[id] = &it->second;
     }
   }
 
-  // Decode the instruction by either sampling the bits using the bit extract
-  // function to find the next node, or, if we're at a leaf, calling the visitor
-  // function.
-  void Decode(const Instruction* instr) const;
-
-  // A leaf node is a wrapper for a visitor function.
-  bool IsLeafNode() const {
-    VIXL_ASSERT(((instruction_name_ == "node") && (bit_extract_fn_ != NULL)) ||
-                ((instruction_name_ != "node") && (bit_extract_fn_ == NULL)));
-    return instruction_name_ != "node";
-  }
-
-  // Get a pointer to the next node required in the decode process, based on the
-  // bits sampled by the current node.
-  CompiledDecodeNode* GetNodeForBits(uint32_t bits) const {
-    VIXL_ASSERT(bits < decode_table_size_);
-    return decode_table_[bits];
-  }
-
-  // Set the next node in the decode process for the pattern of sampled bits in
-  // the current node.
-  void SetNodeForBits(uint32_t bits, CompiledDecodeNode* n) {
-    VIXL_ASSERT(bits < decode_table_size_);
-    VIXL_ASSERT(n != NULL);
-    decode_table_[bits] = n;
+  const T* Get(FormId form_id) const {
+    VIXL_ASSERT(form_id < table_.size());
+    return table_[form_id];
   }
 
  private:
-  // Pointer to an instantiated template function for extracting the bits
-  // sampled by this node. Set to NULL for leaf nodes.
-  const BitExtractFn bit_extract_fn_;
-
-  // Visitor function that handles the instruction identified. Set only for
-  // leaf nodes, where no extra decoding is required, otherwise NULL.
-  std::string instruction_name_;
-
-  // Mapping table from instruction bits to next decode stage.
-  CompiledDecodeNode** decode_table_;
-  const size_t decode_table_size_;
-
-  // Pointer to the decoder containing this node, used to call its visitor
-  // function for leaf nodes. Set to NULL for non-leaf nodes.
-  Decoder* decoder_;
+  std::vector<const T*> table_;
 };
 
-class DecodeNode {
- public:
-  // Default constructor needed for map initialisation.
-  DecodeNode()
-      : sampled_bits_(DecodeNode::kEmptySampledBits),
-        pattern_table_(DecodeNode::kEmptyPatternTable),
-        compiled_node_(NULL) {}
-
-  // Constructor for DecodeNode wrappers around visitor functions. These are
-  // marked as "compiled", as there is no decoding left to do.
-  explicit DecodeNode(const std::string& iname, Decoder* decoder)
-      : name_(iname),
-        sampled_bits_(DecodeNode::kEmptySampledBits),
-        instruction_name_(iname),
-        pattern_table_(DecodeNode::kEmptyPatternTable),
-        decoder_(decoder),
-        compiled_node_(NULL) {}
-
-  // Constructor for DecodeNodes that map bit patterns to other DecodeNodes.
-  explicit DecodeNode(const DecodeMapping& map, Decoder* decoder = NULL)
-      : name_(map.name),
-        sampled_bits_(map.sampled_bits),
-        instruction_name_("node"),
-        pattern_table_(map.mapping),
-        decoder_(decoder),
-        compiled_node_(NULL) {
-    // With the current two bits per symbol encoding scheme, the maximum pattern
-    // length is (32 - 2) / 2 = 15 bits.
-    VIXL_CHECK(GetPatternLength(map.mapping[0].pattern) <= 15);
-    for (const DecodePattern& p : map.mapping) {
-      VIXL_CHECK(GetPatternLength(p.pattern) == map.sampled_bits.size());
-    }
-  }
-
-  ~DecodeNode() {
-    // Delete the compiled version of this node, if one was created.
-    if (compiled_node_ != NULL) {
-      delete compiled_node_;
-    }
-  }
-
-  // Get the bits sampled from the instruction by this node.
-  const std::vector<uint8_t>& GetSampledBits() const { return sampled_bits_; }
-
-  // Get the number of bits sampled from the instruction by this node.
-  size_t GetSampledBitsCount() const { return sampled_bits_.size(); }
-
-  // A leaf node is a DecodeNode that wraps the visitor function for the
-  // identified instruction class.
-  bool IsLeafNode() const { return instruction_name_ != "node"; }
-
-  std::string GetName() const { return name_; }
-
-  // Create a CompiledDecodeNode of specified table size that uses
-  // bit_extract_fn to sample bits from the instruction.
-  void CreateCompiledNode(BitExtractFn bit_extract_fn, size_t table_size) {
-    VIXL_ASSERT(bit_extract_fn != NULL);
-    VIXL_ASSERT(table_size > 0);
-    compiled_node_ = new CompiledDecodeNode(bit_extract_fn, table_size);
-  }
-
-  // Create a CompiledDecodeNode wrapping a visitor function. No decoding is
-  // required for this node; the visitor function is called instead.
-  void CreateVisitorNode() {
-    compiled_node_ = new CompiledDecodeNode(instruction_name_, decoder_);
-  }
-
-  // Find and compile the DecodeNode named "name", and set it as the node for
-  // the pattern "bits".
-  void CompileNodeForBits(Decoder* decoder, std::string name, uint32_t bits);
-
-  // Get a pointer to an instruction method that extracts the instruction bits
-  // specified by the mask argument, and returns those sampled bits as a
-  // contiguous sequence, suitable for indexing an array.
-  // For example, a mask of 0b1010 returns a function that, given an instruction
-  // 0bXYZW, will return 0bXZ.
-  BitExtractFn GetBitExtractFunction(uint32_t mask) {
-    return GetBitExtractFunctionHelper(mask, 0);
-  }
-
-  // Get a pointer to an Instruction method that applies a mask to the
-  // instruction bits, and tests if the result is equal to value. The returned
-  // function gives a 1 result if (inst & mask == value), 0 otherwise.
-  BitExtractFn GetBitExtractFunction(uint32_t mask, uint32_t value) {
-    return GetBitExtractFunctionHelper(value, mask);
-  }
-
-  // Compile this DecodeNode into a new CompiledDecodeNode and returns a pointer
-  // to it. This pointer is also stored inside the DecodeNode itself. Destroying
-  // a DecodeNode frees its associated CompiledDecodeNode.
-  CompiledDecodeNode* Compile(Decoder* decoder);
-
-  // Get a pointer to the CompiledDecodeNode associated with this DecodeNode.
-  // Returns NULL if the node has not been compiled yet.
-  CompiledDecodeNode* GetCompiledNode() const { return compiled_node_; }
-  bool IsCompiled() const { return GetCompiledNode() != NULL; }
-
-  enum class PatternSymbol { kSymbol0 = 0, kSymbol1 = 1, kSymbolX = 2 };
-  static const uint32_t kEndOfPattern = 3;
-  static const uint32_t kPatternSymbolMask = 3;
-
-  size_t GetPatternLength(uint32_t pattern) const {
-    uint32_t hsb = HighestSetBitPosition(pattern);
-    // The pattern length is signified by two set bits in a two bit-aligned
-    // position. Ensure that the pattern has a highest set bit, it's at an odd
-    // bit position, and that the bit to the right of the hsb is also set.
-    VIXL_ASSERT(((hsb % 2) == 1) && (pattern >> (hsb - 1)) == kEndOfPattern);
-    return hsb / 2;
-  }
-
-  bool PatternContainsSymbol(uint32_t pattern, PatternSymbol symbol) const {
-    while ((pattern & kPatternSymbolMask) != kEndOfPattern) {
-      if (static_cast<PatternSymbol>(pattern & kPatternSymbolMask) == symbol)
-        return true;
-      pattern >>= 2;
-    }
-    return false;
-  }
-
-  PatternSymbol GetSymbolAt(uint32_t pattern, size_t pos) const {
-    size_t len = GetPatternLength(pattern);
-    VIXL_ASSERT((pos < 15) && (pos < len));
-    uint32_t shift = static_cast<uint32_t>(2 * (len - pos - 1));
-    uint32_t sym = (pattern >> shift) & kPatternSymbolMask;
-    return static_cast<PatternSymbol>(sym);
-  }
+typedef void (Decoder::*DecodeFnPtr)(const Instruction*);
 
- private:
-  // Generate a mask and value pair from a pattern constructed from 0, 1 and x
-  // (don't care) 2-bit symbols.
-  // For example "10x1"_b should return mask = 0b1101, value = 0b1001.
-  typedef std::pair<Instr, Instr> MaskValuePair;
-  MaskValuePair GenerateMaskValuePair(uint32_t pattern) const;
-
-  // Generate a pattern ordered by the bit positions sampled by this node.
-  // The symbol corresponding to the lowest sample position is placed in the
-  // least-significant bits of the result pattern.
-  // For example, a pattern of "1x0"_b expected when sampling bits 31, 1 and 30
-  // returns the pattern "x01"_b; bit 1 should be 'x', bit 30 '0' and bit 31
-  // '1'.
-  // This output makes comparisons easier between the pattern and bits sampled
-  // from an instruction using the fast "compress" algorithm. See
-  // Instruction::Compress().
-  uint32_t GenerateOrderedPattern(uint32_t pattern) const;
-
-  // Generate a mask with a bit set at each sample position.
-  uint32_t GenerateSampledBitsMask() const;
-
-  // Try to compile a more optimised decode operation for this node, returning
-  // true if successful.
-  bool TryCompileOptimisedDecodeTable(Decoder* decoder);
-
-  // Helper function that returns a bit extracting function. If y is zero,
-  // x is a bit extraction mask. Otherwise, y is the mask, and x is the value
-  // to match after masking.
-  BitExtractFn GetBitExtractFunctionHelper(uint32_t x, uint32_t y);
-
-  // Name of this decoder node, used to construct edges in the decode graph.
-  std::string name_;
-
-  // Vector of bits sampled from an instruction to determine which node to look
-  // up next in the decode process.
-  const std::vector<uint8_t>& sampled_bits_;
-  static const std::vector<uint8_t> kEmptySampledBits;
-
-  // For leaf nodes, this is the name of the instruction form that the node
-  // represents. For other nodes, this is always set to "node".
-  std::string instruction_name_;
-
-  // Source mapping from bit pattern to name of next decode stage.
-  const std::vector<DecodePattern>& pattern_table_;
-  static const std::vector<DecodePattern> kEmptyPatternTable;
-
-  // Pointer to the decoder containing this node, used to call its visitor
-  // function for leaf nodes.
-  Decoder* decoder_;
-
-  // Pointer to the compiled version of this node. Is this node hasn't been
-  // compiled yet, this pointer is NULL.
-  CompiledDecodeNode* compiled_node_;
+// A Visitor node maps the name of a visitor to the function that handles it.
+struct VisitorNode {
+  const char* name;
+  const DecodeFnPtr visitor_fn;
 };
 
 }  // namespace aarch64
@@ -41,7 +41,7 @@ constexpr uint32_t str_to_two_bit_pattern(const char* x, size_t s, uint32_t a) {
 }
 
 constexpr uint32_t operator"" _b(const char* x, size_t s) {
-  return str_to_two_bit_pattern(x, s, DecodeNode::kEndOfPattern);
+  return str_to_two_bit_pattern(x, s, DecodePattern::kEndOfPattern);
 }
 
 // This decode table is derived from the AArch64 ISA XML specification,
@@ -0,0 +1,8246 @@
+// Copyright 2026, VIXL authors
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//   * Redistributions of source code must retain the above copyright notice,
+//     this list of conditions and the following disclaimer.
+//   * Redistributions in binary form must reproduce the above copyright notice,
+//     this list of conditions and the following disclaimer in the documentation
+//     and/or other materials provided with the distribution.
+//   * Neither the name of ARM Limited nor the names of its contributors may be
+//     used to endorse or promote products derived from this software without
+//     specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS CONTRIBUTORS "AS IS" AND
+// ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+// WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+// This file is auto generated from decoder-constants-aarch64.h using
+// tools/generate_decoder_tables.py. Do not edit it by hand.
+
+#ifndef VIXL_AARCH64_DECODER_TABLES_AARCH64_H_
+#define VIXL_AARCH64_DECODER_TABLES_AARCH64_H_
+
+namespace vixl {
+namespace aarch64 {
+
+// clang-format off
+// The instruction forms, indexed by FormId.
+static const char* const kDecodeFormNames[] = {
+  "unallocated",
+  "fcvtnu_asimdmiscfp16_r",
+  "fcvtnu_asimdmisc_r",
+  "fcvtpu_asimdmiscfp16_r",
+  "fcvtpu_asimdmisc_r",
+  "umaxv_asimdall_only",
+  "uminv_asimdall_only",
+  "rbit_32_dp_1src",
+  "clz_32_dp_1src",
+  "fcvtns_64s_float2int",
+  "fcvtnu_64s_float2int",
+  "scvtf_s64_float2int",
+  "ucvtf_s64_float2int",
+  "fcvtas_64s_float2int",
+  "fcvtau_64s_float2int",
+  "fcvtps_64s_float2int",
+  "fcvtpu_64s_float2int",
+  "fcvtms_64s_float2int",
+  "fcvtmu_64s_float2int",
+  "fcvtzs_64s_float2int",
+  "fcvtzu_64s_float2int",
+  "fcvtns_64d_float2int",
+  "fcvtnu_64d_float2int",
+  "scvtf_d64_float2int",
+  "ucvtf_d64_float2int",
+  "fcvtas_64d_float2int",
+  "fcvtau_64d_float2int",
+  "fmov_64d_float2int",
+  "fmov_d64_float2int",
+  "fcvtps_64d_float2int",
+  "fcvtpu_64d_float2int",
+  "fcvtms_64d_float2int",
+  "fcvtmu_64d_float2int",
+  "fcvtzs_64d_float2int",
+  "fcvtzu_64d_float2int",
+  "fmov_64vx_float2int",
+  "fmov_v64i_float2int",
+  "fcvtns_64h_float2int",
+  "fcvtnu_64h_float2int",
+  "scvtf_h64_float2int",
+  "ucvtf_h64_float2int",
+  "fcvtas_64h_float2int",
+  "fcvtau_64h_float2int",
+  "fmov_64h_float2int",
+  "fmov_h64_float2int",
+  "fcvtps_64h_float2int",
+  "fcvtpu_64h_float2int",
+  "fcvtms_64h_float2int",
+  "fcvtmu_64h_float2int",
+  "fcvtzs_64h_float2int",
+  "fcvtzu_64h_float2int",
+  "rev16_64_dp_1src",
+  "cls_64_dp_1src",
+  "pacib_64p_dp_1src",
+  "autib_64p_dp_1src",
+  "fcvtns_32h_float2int",
+  "fcvtnu_32h_float2int",
+  "scvtf_h32_float2int",
+  "ucvtf_h32_float2int",
+  "fcvtas_32h_float2int",
+  "fcvtau_32h_float2int",
+  "fmov_32h_float2int",
+  "fmov_h32_float2int",
+  "fcvtps_32h_float2int",
+  "fcvtpu_32h_float2int",
+  "fcvtms_32h_float2int",
+  "fcvtmu_32h_float2int",
+  "fcvtzs_32h_float2int",
+  "fcvtzu_32h_float2int",
+  "sbfm_32m_bitfield",
+  "ubfm_32m_bitfield",
+  "fcvtmu_asisdmiscfp16_r",
+  "fcvtmu_asisdmisc_r",
+  "fcvtzu_asisdmiscfp16_r",
+  "fcvtzu_asisdmisc_r",
+  "neg_asisdmisc_r",
+  "blraa_64p_branch_reg",
+  "blrab_64p_branch_reg",
+  "fnmsub_s_floatdp3",
+  "fnmsub_d_floatdp3",
+  "fnmsub_h_floatdp3",
+  "fmul_asisdelem_rh_h",
+  "sqshrn_asisdshf_n",
+  "sqrshrn_asisdshf_n",
+  "fmul_asisdelem_r_sd",
+  "sqdmull_asisdelem_l",
+  "not_asimdmisc_r",
+  "rbit_asimdmisc_r",
+  "ld3_asisdlsop_bx3_r3b",
+  "ld3_asisdlsop_b3_i3b",
+  "rev16_asimdmisc_r",
+  "st1_asisdlsep_r4_r4",
+  "st1_asisdlsep_i4_i4",
+  "orr_32_log_shift",
+  "ands_32_log_shift",
+  "stp_q_ldstpair_off",
+  "ldp_q_ldstpair_off",
+  "stp_q_ldstpair_pre",
+  "ldp_q_ldstpair_pre",
+  "eor3_vvv16_crypto4",
+  "sm3ss1_vvv4_crypto4",
+  "xar_vvv2_crypto3_imm6",
+  "fmax_asimdsame_only",
+  "fmin_asimdsame_only",
+  "st4_asisdlso_d4_4d",
+  "ldr_q_loadlit",
+  "cadd_z_zz",
+  "sqcadd_z_zz",
+  "punpklo_p_p",
+  "punpkhi_p_p",
+  "zip1_p_pp",
+  "rev_p_p",
+  "rev16_32_dp_1src",
+  "cls_32_dp_1src",
+  "fcmge_asisdsame_only",
+  "facge_asisdsame_only",
+  "fabd_asisdsame_only",
+  "fcmgt_asisdsame_only",
+  "facgt_asisdsame_only",
+  "braaz_64_branch_reg",
+  "uqxtnt_z_zz",
+  "fcvtau_asisdmiscfp16_r",
+  "fcvtau_asisdmisc_r",
+  "fmaxnmp_asisdpair_only_sd",
+  "fnmadd_s_floatdp3",
+  "fnmadd_d_floatdp3",
+  "fnmadd_h_floatdp3",
+  "fmla_asisdelem_rh_h",
+  "sshr_asisdshf_r",
+  "ssra_asisdshf_r",
+  "srshr_asisdshf_r",
+  "srsra_asisdshf_r",
+  "fmla_asisdelem_r_sd",
+  "sqdmlal_asisdelem_l",
+  "tbx_asimdtbl_l2_2",
+  "ld2_asisdlso_h2_2h",
+  "decb_r_rs",
+  "dech_r_rs",
+  "st1_asisdlso_h1_1h",
+  "ld3_asisdlsop_dx3_r3d",
+  "cmgt_asisdsame_only",
+  "bfmmla_asimdsame2_e",
+  "bfdot_asimdsame2_d",
+  "bfmlal_asimdsame2_f",
+  "fcmla_asimdsame2_c",
+  "fcadd_asimdsame2_c",
+  "st4_asisdlso_h4_4h",
+  "prfw_i_p_bz_s_x32_scaled",
+  "prfd_i_p_bz_s_x32_scaled",
+  "ld1h_z_p_bz_s_x32_scaled",
+  "ldff1h_z_p_bz_s_x32_scaled",
+  "prfw_i_p_bz_d_x32_scaled",
+  "prfd_i_p_bz_d_x32_scaled",
+  "ld1h_z_p_bz_d_x32_scaled",
+  "ldff1h_z_p_bz_d_x32_scaled",
+  "fmls_asimdelem_rh_h",
+  "shl_asimdshf_r",
+  "sqshl_asimdshf_r",
+  "fmlsl_asimdelem_lh",
+  "fmls_asimdelem_r_sd",
+  "smlsl_asimdelem_l",
+  "sqdmlsl_asimdelem_l",
+  "ld2_asisdlsop_bx2_r2b",
+  "ld2_asisdlsop_b2_i2b",
+  "fmulx_asisdelem_rh_h",
+  "sqshrun_asisdshf_n",
+  "sqrshrun_asisdshf_n",
+  "uqshrn_asisdshf_n",
+  "uqrshrn_asisdshf_n",
+  "fmulx_asisdelem_r_sd",
+  "cdot_z_zzzi_s",
+  "cdot_z_zzzi_d",
+  "uqxtn_asisdmisc_n",
+  "stlur_32_ldapstl_unscaled",
+  "ldapur_32_ldapstl_unscaled",
+  "ldapursw_64_ldapstl_unscaled",
+  "stlur_64_ldapstl_unscaled",
+  "ldapur_64_ldapstl_unscaled",
+  "cpyfp_cpy_memcms",
+  "cpyfpwt_cpy_memcms",
+  "cpyfprt_cpy_memcms",
+  "cpyfpt_cpy_memcms",
+  "cpyfm_cpy_memcms",
+  "cpyfmwt_cpy_memcms",
+  "cpyfmrt_cpy_memcms",
+  "cpyfmt_cpy_memcms",
+  "cpyfe_cpy_memcms",
+  "cpyfewt_cpy_memcms",
+  "cpyfert_cpy_memcms",
+  "cpyfet_cpy_memcms",
+  "setp_set_memcms",
+  "setpt_set_memcms",
+  "setpn_set_memcms",
+  "setptn_set_memcms",
+  "scvtf_s32_float2fix",
+  "ucvtf_s32_float2fix",
+  "fcvtzs_32s_float2fix",
+  "fcvtzu_32s_float2fix",
+  "scvtf_d32_float2fix",
+  "ucvtf_d32_float2fix",
+  "fcvtzs_32d_float2fix",
+  "fcvtzu_32d_float2fix",
+  "scvtf_h32_float2fix",
+  "ucvtf_h32_float2fix",
+  "fcvtzs_32h_float2fix",
+  "fcvtzu_32h_float2fix",
+  "ld2_asisdlsop_hx2_r2h",
+  "ld2_asisdlsop_h2_i2h",
+  "fmulx_asimdsame_only",
+  "cpy_z_p_v",
+  "compact_z_p_z",
+  "lasta_v_p_z",
+  "lastb_v_p_z",
+  "revb_z_z",
+  "revh_z_z",
+  "revw_z_z",
+  "rbit_z_p_z",
+  "clasta_z_p_zz",
+  "clastb_z_p_zz",
+  "clasta_v_p_z",
+  "clastb_v_p_z",
+  "splice_z_p_zz_des",
+  "splice_z_p_zz_con",
+  "frinta_asimdmiscfp16_r",
+  "frinta_asimdmisc_r",
+  "cmge_asimdmisc_z",
+  "ctermeq_rr",
+  "ctermne_rr",
+  "whilewr_p_rr",
+  "whilerw_p_rr",
+  "ld4_asisdlsop_dx4_r4d",
+  "ld4_asisdlsop_d4_i4d",
+  "st3_asisdlsop_hx3_r3h",
+  "st3_asisdlsop_h3_i3h",
+  "cpypn_cpy_memcms",
+  "cpypwtn_cpy_memcms",
+  "cpyprtn_cpy_memcms",
+  "cpyptn_cpy_memcms",
+  "cpymn_cpy_memcms",
+  "cpymwtn_cpy_memcms",
+  "cpymrtn_cpy_memcms",
+  "cpymtn_cpy_memcms",
+  "cpyen_cpy_memcms",
+  "cpyewtn_cpy_memcms",
+  "cpyertn_cpy_memcms",
+  "cpyetn_cpy_memcms",
+  "lslv_32_dp_2src",
+  "st3_asisdlso_s3_3s",
+  "ldnt1w_z_p_ar_s_x32_unscaled",
+  "ld1rsh_z_p_bi_s64",
+  "ld1rsh_z_p_bi_s32",
+  "ld1rsb_z_p_bi_s64",
+  "ld1rsb_z_p_bi_s32",
+  "ldnt1sw_z_p_ar_d_64_unscaled",
+  "ld1sw_z_p_bz_d_64_unscaled",
+  "ldff1sw_z_p_bz_d_64_unscaled",
+  "lasta_r_p_z",
+  "lastb_r_p_z",
+  "cpy_z_p_r",
+  "clasta_r_p_z",
+  "clastb_r_p_z",
+  "pacdzb_64z_dp_1src",
+  "sqabs_asisdmisc_r",
+  "sqxtn_asisdmisc_n",
+  "str_s_ldst_pos",
+  "ldr_s_ldst_pos",
+  "str_d_ldst_pos",
+  "ldr_d_ldst_pos",
+  "st1_asisdlsop_dx1_r1d",
+  "sdiv_64_dp_2src",
+  "rorv_64_dp_2src",
+  "str_32_ldst_regoff",
+  "ldr_32_ldst_regoff",
+  "fmlal_asimdsame_f",
+  "fmlsl_asimdsame_f",
+  "ptrue_p_s",
+  "nor_p_p_pp_z",
+  "nand_p_p_pp_z",
+  "retaa_64e_branch_reg",
+  "addhn_asimddiff_n",
+  "sshl_asimdsame_only",
+  "sqshl_asimdsame_only",
+  "sabal_asimddiff_l",
+  "srshl_asimdsame_only",
+  "sqrshl_asimdsame_only",
+  "subhn_asimddiff_n",
+  "smax_asimdsame_only",
+  "smin_asimdsame_only",
+  "sabdl_asimddiff_l",
+  "sabd_asimdsame_only",
+  "saba_asimdsame_only",
+  "br_64_branch_reg",
+  "cmplo_p_p_zi",
+  "cmpls_p_p_zi",
+  "fmov_s_floatimm",
+  "ld2_asisdlso_b2_2b",
+  "ld1_asisdlse_r1_1v",
+  "saddl_asimddiff_l",
+  "shadd_asimdsame_only",
+  "sqadd_asimdsame_only",
+  "saddw_asimddiff_w",
+  "srhadd_asimdsame_only",
+  "ssubl_asimddiff_l",
+  "shsub_asimdsame_only",
+  "sqsub_asimdsame_only",
+  "ssubw_asimddiff_w",
+  "cmgt_asimdsame_only",
+  "cmge_asimdsame_only",
+  "st4_asisdlso_s4_4s",
+  "ld4_asisdlse_r4",
+  "st2_asisdlsop_dx2_r2d",
+  "fadd_z_p_zz",
+  "fsub_z_p_zz",
+  "fmul_z_p_zz",
+  "fsubr_z_p_zz",
+  "fmaxnm_z_p_zz",
+  "fminnm_z_p_zz",
+  "fmax_z_p_zz",
+  "fmin_z_p_zz",
+  "orr_z_zi",
+  "eor_z_zi",
+  "and_z_zi",
+  "dupm_z_i",
+  "fcpy_z_p_i",
+  "bl_only_branch_imm",
+  "fmov_d_floatdp1",
+  "fneg_d_floatdp1",
+  "fcvt_sd_floatdp1",
+  "bfcvt_bs_floatdp1",
+  "frintn_d_floatdp1",
+  "frintm_d_floatdp1",
+  "frinta_d_floatdp1",
+  "frintx_d_floatdp1",
+  "frint32z_d_floatdp1",
+  "frint64z_d_floatdp1",
+  "svc_ex_exception",
+  "hvc_ex_exception",
+  "smc_ex_exception",
+  "hlt_ex_exception",
+  "pfirst_p_p_p",
+  "ldapr_32l_memop",
+  "cmpeq_p_p_zz",
+  "cmpne_p_p_zz",
+  "msub_64a_dp_3src",
+  "add_z_zi",
+  "sub_z_zi",
+  "subr_z_zi",
+  "sqadd_z_zi",
+  "uqadd_z_zi",
+  "sqsub_z_zi",
+  "uqsub_z_zi",
+  "smax_z_zi",
+  "umax_z_zi",
+  "smin_z_zi",
+  "umin_z_zi",
+  "mul_z_zi",
+  "dup_z_i",
+  "fdup_z_i",
+  "fnmad_z_p_zzz",
+  "fnmsb_z_p_zzz",
+  "frint32z_asimdmisc_r",
+  "fcmlt_asimdmiscfp16_fz",
+  "fcmlt_asimdmisc_fz",
+  "sqrdmulh_z_zzi_h",
+  "ld4_asisdlsep_r4_r",
+  "ld4_asisdlsep_i4_i",
+  "aese_b_cryptoaes",
+  "cls_asimdmisc_r",
+  "sqxtn_asimdmisc_n",
+  "ld2w_z_p_bi_contiguous",
+  "ld2w_z_p_br_contiguous",
+  "ld4w_z_p_bi_contiguous",
+  "ld4w_z_p_br_contiguous",
+  "ld2d_z_p_bi_contiguous",
+  "ld2d_z_p_br_contiguous",
+  "ld4d_z_p_bi_contiguous",
+  "ld4d_z_p_br_contiguous",
+  "st2w_z_p_bi_contiguous",
+  "st1w_z_p_bz_d_x32_scaled",
+  "st4w_z_p_bi_contiguous",
+  "st1w_z_p_bz_s_x32_scaled",
+  "st1w_z_p_bi",
+  "st2d_z_p_bi_contiguous",
+  "st1d_z_p_bz_d_x32_scaled",
+  "st4d_z_p_bi_contiguous",
+  "st1d_z_p_bi",
+  "stxp_sp32_ldstexcl",
+  "ldxp_lp32_ldstexcl",
+  "stxp_sp64_ldstexcl",
+  "ldxp_lp64_ldstexcl",
+  "saddv_r_p_z",
+  "uaddv_r_p_z",
+  "smaxv_r_p_z",
+  "umaxv_r_p_z",
+  "sminv_r_p_z",
+  "uminv_r_p_z",
+  "movprfx_z_p_z",
+  "orv_r_p_z",
+  "eorv_r_p_z",
+  "andv_r_p_z",
+  "ld2_asisdlsop_dx2_r2d",
+  "ld2_asisdlsop_d2_i2d",
+  "ld1b_z_p_br_u8",
+  "ldff1b_z_p_br_u8",
+  "ld1b_z_p_br_u32",
+  "ldff1b_z_p_br_u32",
+  "ld1sw_z_p_br_s64",
+  "ldff1sw_z_p_br_s64",
+  "ld1h_z_p_br_u32",
+  "ldff1h_z_p_br_u32",
+  "stnt1b_z_p_br_contiguous",
+  "st3b_z_p_br_contiguous",
+  "st1b_z_p_br",
+  "stnt1h_z_p_br_contiguous",
+  "st3h_z_p_br_contiguous",
+  "st1h_z_p_br",
+  "st1_asisdlse_r4_4v",
+  "sys_cr_systeminstrs",
+  "st2_asisdlsop_sx2_r2s",
+  "st4_asisdlsop_sx4_r4s",
+  "ld2_asisdlsop_sx2_r2s",
+  "ld4_asisdlsop_sx4_r4s",
+  "bic_64_log_shift",
+  "eon_64_log_shift",
+  "match_p_p_zz",
+  "nmatch_p_p_zz",
+  "cmpge_p_p_zz",
+  "cmpgt_p_p_zz",
+  "stxr_sr32_ldstexcl",
+  "ldxr_lr32_ldstexcl",
+  "stllr_sl32_ldstexcl",
+  "ldlar_lr32_ldstexcl",
+  "stxr_sr64_ldstexcl",
+  "ldxr_lr64_ldstexcl",
+  "stllr_sl64_ldstexcl",
+  "ldlar_lr64_ldstexcl",
+  "str_b_ldst_regoff",
+  "str_bl_ldst_regoff",
+  "ldr_b_ldst_regoff",
+  "ldr_bl_ldst_regoff",
+  "str_q_ldst_regoff",
+  "ldr_q_ldst_regoff",
+  "str_h_ldst_regoff",
+  "ldr_h_ldst_regoff",
+  "uqinch_z_zs",
+  "uqdech_z_zs",
+  "dech_z_zs",
+  "sqneg_asimdmisc_r",
+  "fmsub_s_floatdp3",
+  "fmsub_d_floatdp3",
+  "fmsub_h_floatdp3",
+  "sri_asisdshf_r",
+  "sli_asisdshf_r",
+  "sqshlu_asisdshf_r",
+  "uqshl_asisdshf_r",
+  "adds_64s_addsub_imm",
+  "subs_64s_addsub_imm",
+  "whilege_p_p_rr",
+  "whilegt_p_p_rr",
+  "whilelt_p_p_rr",
+  "whilele_p_p_rr",
+  "whilehs_p_p_rr",
+  "whilehi_p_p_rr",
+  "whilelo_p_p_rr",
+  "whilels_p_p_rr",
+  "st2_asisdlse_r2",
+  "orn_32_log_shift",
+  "bics_32_log_shift",
+  "sqinch_z_zs",
+  "sqdech_z_zs",
+  "inch_z_zs",
+  "sqdecp_z_p_z",
+  "sqdecp_r_p_r_sx",
+  "sqdecp_r_p_r_x",
+  "ld1_asisdlsep_r4_r4",
+  "ld1_asisdlsep_i4_i4",
+  "ins_asimdins_iv_v",
+  "fcvtas_asisdmiscfp16_r",
+  "scvtf_asisdmiscfp16_r",
+  "fcvtas_asisdmisc_r",
+  "scvtf_asisdmisc_r",
+  "fmaxnmp_asisdpair_only_h",
+  "faddp_asisdpair_only_h",
+  "fmaxp_asisdpair_only_h",
+  "fcmgt_asisdmiscfp16_fz",
+  "fcmeq_asisdmiscfp16_fz",
+  "fcmlt_asisdmiscfp16_fz",
+  "frecpe_asisdmiscfp16_r",
+  "frecpx_asisdmiscfp16_r",
+  "fcmgt_asisdmisc_fz",
+  "fcmeq_asisdmisc_fz",
+  "fcmlt_asisdmisc_fz",
+  "frecpe_asisdmisc_r",
+  "frecpx_asisdmisc_r",
+  "fminnmp_asisdpair_only_h",
+  "fminp_asisdpair_only_h",
+  "fcmeq_asimdsamefp16_only",
+  "st1_asisdlso_s1_1s",
+  "ucvtf_asisdshf_c",
+  "mul_asimdelem_r",
+  "smull_asimdelem_l",
+  "uqincw_z_zs",
+  "uqdecw_z_zs",
+  "decw_z_zs",
+  "uqincd_z_zs",
+  "uqdecd_z_zs",
+  "decd_z_zs",
+  "ld3_asisdlse_r3",
+  "fminnmp_asimdsamefp16_only",
+  "fabd_asimdsamefp16_only",
+  "fcmgt_asimdsamefp16_only",
+  "facgt_asimdsamefp16_only",
+  "fminp_asimdsamefp16_only",
+  "cmla_z_zzz",
+  "sqrdcmlah_z_zzz",
+  "sqadd_asisdsame_only",
+  "sqsub_asisdsame_only",
+  "cmge_asisdsame_only",
+  "smov_asimdins_w_w",
+  "smov_asimdins_x_x",
+  "add_64_addsub_ext",
+  "sub_64_addsub_ext",
+  "str_64_ldst_regoff",
+  "ldr_64_ldst_regoff",
+  "fcmge_asimdsame_only",
+  "fcmgt_asimdsame_only",
+  "fcsel_s_floatsel",
+  "fcsel_d_floatsel",
+  "fcsel_h_floatsel",
+  "str_b_ldst_pos",
+  "ldr_b_ldst_pos",
+  "str_q_ldst_pos",
+  "ldr_q_ldst_pos",
+  "str_h_ldst_pos",
+  "ldr_h_ldst_pos",
+  "uqincp_z_p_z",
+  "uqincp_r_p_r_uw",
+  "uqincp_r_p_r_x",
+  "usqadd_asisdmisc_r",
+  "bfdot_z_zzzi",
+  "fmlalb_z_zzzi_s",
+  "fmlalt_z_zzzi_s",
+  "bfmlalb_z_zzzi",
+  "bfmlalt_z_zzzi",
+  "brkbs_p_p_p_z",
+  "fmlslb_z_zzz",
+  "fmlslt_z_zzz",
+  "st2_asisdlsop_d2_i2d",
+  "ld1w_z_p_ai_s",
+  "ldff1w_z_p_ai_s",
+  "ld1rw_z_p_bi_u32",
+  "ld1rw_z_p_bi_u64",
+  "ld1rsb_z_p_bi_s16",
+  "ld1rd_z_p_bi_u64",
+  "ld1w_z_p_ai_d",
+  "ldff1w_z_p_ai_d",
+  "ld1w_z_p_bz_d_64_scaled",
+  "ldff1w_z_p_bz_d_64_scaled",
+  "ld1d_z_p_ai_d",
+  "ldff1d_z_p_ai_d",
+  "ld1d_z_p_bz_d_64_scaled",
+  "ldff1d_z_p_bz_d_64_scaled",
+  "smlslb_z_zzzi_s",
+  "smlslt_z_zzzi_s",
+  "smlslb_z_zzzi_d",
+  "smlslt_z_zzzi_d",
+  "sqrdmulh_z_zzi_s",
+  "sqrdmulh_z_zzi_d",
+  "orr_asimdimm_l_sl",
+  "ssra_asimdshf_r",
+  "srsra_asimdshf_r",
+  "tbx_asimdtbl_l1_1",
+  "cmphs_p_p_zi",
+  "cmphi_p_p_zi",
+  "ucvtf_asimdmiscfp16_r",
+  "ucvtf_asimdmisc_r",
+  "fcmle_asimdmiscfp16_fz",
+  "frsqrte_asimdmiscfp16_r",
+  "fcmle_asimdmisc_fz",
+  "frsqrte_asimdmisc_r",
+  "fmaxp_asisdpair_only_sd",
+  "fmla_asimdelem_rh_h",
+  "sshr_asimdshf_r",
+  "srshr_asimdshf_r",
+  "fmlal_asimdelem_lh",
+  "fmla_asimdelem_r_sd",
+  "smlal_asimdelem_l",
+  "sqdmlal_asimdelem_l",
+  "blrabz_64_branch_reg",
+  "pfalse_p",
+  "fcvtms_asimdmiscfp16_r",
+  "fcvtms_asimdmisc_r",
+  "fcvtzs_asimdmiscfp16_r",
+  "fcvtzs_asimdmisc_r",
+  "abs_asimdmisc_r",
+  "addv_asimdall_only",
+  "eretab_64e_branch_reg",
+  "csel_64_condsel",
+  "csinc_64_condsel",
+  "csinv_64_condsel",
+  "csneg_64_condsel",
+  "ld3_asisdlso_h3_3h",
+  "stlurb_32_ldapstl_unscaled",
+  "ldapurb_32_ldapstl_unscaled",
+  "ldapursb_64_ldapstl_unscaled",
+  "ldapursb_32_ldapstl_unscaled",
+  "stlurh_32_ldapstl_unscaled",
+  "ldapurh_32_ldapstl_unscaled",
+  "ldapursh_64_ldapstl_unscaled",
+  "ldapursh_32_ldapstl_unscaled",
+  "cpyfpn_cpy_memcms",
+  "cpyfpwtn_cpy_memcms",
+  "cpyfprtn_cpy_memcms",
+  "cpyfptn_cpy_memcms",
+  "cpyfmn_cpy_memcms",
+  "cpyfmwtn_cpy_memcms",
+  "cpyfmrtn_cpy_memcms",
+  "cpyfmtn_cpy_memcms",
+  "cpyfen_cpy_memcms",
+  "cpyfewtn_cpy_memcms",
+  "cpyfertn_cpy_memcms",
+  "cpyfetn_cpy_memcms",
+  "ld1sh_z_p_bi_s32",
+  "ldnf1sh_z_p_bi_s32",
+  "ld1w_z_p_bi_u64",
+  "ldnf1w_z_p_bi_u64",
+  "ld1sb_z_p_bi_s32",
+  "ldnf1sb_z_p_bi_s32",
+  "ld1d_z_p_bi_u64",
+  "ldnf1d_z_p_bi_u64",
+  "st1w_z_p_bz_d_64_scaled",
+  "st1w_z_p_ai_s",
+  "st1d_z_p_bz_d_64_scaled",
+  "st2_asisdlsop_s2_i2s",
+  "stur_b_ldst_unscaled",
+  "str_b_ldst_immpost",
+  "str_b_ldst_immpre",
+  "ldur_b_ldst_unscaled",
+  "ldr_b_ldst_immpost",
+  "ldr_b_ldst_immpre",
+  "stur_q_ldst_unscaled",
+  "str_q_ldst_immpost",
+  "str_q_ldst_immpre",
+  "ldur_q_ldst_unscaled",
+  "ldr_q_ldst_immpost",
+  "ldr_q_ldst_immpre",
+  "stur_h_ldst_unscaled",
+  "str_h_ldst_immpost",
+  "str_h_ldst_immpre",
+  "ldur_h_ldst_unscaled",
+  "ldr_h_ldst_immpost",
+  "ldr_h_ldst_immpre",
+  "st4_asisdlsop_dx4_r4d",
+  "cfinv_m_pstate",
+  "xaflag_m_pstate",
+  "axflag_m_pstate",
+  "autiza_64z_dp_1src",
+  "fabd_z_p_zz",
+  "fscale_z_p_zz",
+  "fmulx_z_p_zz",
+  "fdivr_z_p_zz",
+  "fdiv_z_p_zz",
+  "ld1b_z_p_bi_u16",
+  "ldnf1b_z_p_bi_u16",
+  "ld1b_z_p_bi_u64",
+  "ldnf1b_z_p_bi_u64",
+  "ld1h_z_p_bi_u16",
+  "ldnf1h_z_p_bi_u16",
+  "ld1h_z_p_bi_u64",
+  "ldnf1h_z_p_bi_u64",
+  "st1b_z_p_ai_s",
+  "st1h_z_p_bz_d_x32_scaled",
+  "st1h_z_p_bz_d_64_scaled",
+  "st1h_z_p_bz_s_x32_scaled",
+  "st1h_z_p_ai_s",
+  "scvtf_s64_float2fix",
+  "ucvtf_s64_float2fix",
+  "fcvtzs_64s_float2fix",
+  "fcvtzu_64s_float2fix",
+  "scvtf_d64_float2fix",
+  "ucvtf_d64_float2fix",
+  "fcvtzs_64d_float2fix",
+  "fcvtzu_64d_float2fix",
+  "scvtf_h64_float2fix",
+  "ucvtf_h64_float2fix",
+  "fcvtzs_64h_float2fix",
+  "fcvtzu_64h_float2fix",
+  "ld3_asisdlsop_d3_i3d",
+  "pacizb_64z_dp_1src",
+  "fmls_asisdelem_rh_h",
+  "shl_asisdshf_r",
+  "sqshl_asisdshf_r",
+  "fmls_asisdelem_r_sd",
+  "sqdmlsl_asisdelem_l",
+  "st3_asisdlso_h3_3h",
+  "asr_z_zw",
+  "lsr_z_zw",
+  "lsl_z_zw",
+  "fmov_d_floatimm",
+  "tbl_asimdtbl_l1_1",
+  "sqincw_r_rs_sx",
+  "sqdecw_r_rs_sx",
+  "sqincw_r_rs_x",
+  "sqdecw_r_rs_x",
+  "sqincd_r_rs_sx",
+  "sqdecd_r_rs_sx",
+  "sqincd_r_rs_x",
+  "sqdecd_r_rs_x",
+  "movi_asimdimm_m_sm",
+  "ld4_asisdlsop_hx4_r4h",
+  "ld4_asisdlsop_h4_i4h",
+  "raddhn_asimddiff_n",
+  "ushl_asimdsame_only",
+  "uqshl_asimdsame_only",
+  "uabal_asimddiff_l",
+  "urshl_asimdsame_only",
+  "uqrshl_asimdsame_only",
+  "rsubhn_asimddiff_n",
+  "umax_asimdsame_only",
+  "umin_asimdsame_only",
+  "uabdl_asimddiff_l",
+  "uabd_asimdsame_only",
+  "uaba_asimdsame_only",
+  "tbnz_only_testbranch",
+  "ld1b_z_p_bz_s_x32_unscaled",
+  "ldff1b_z_p_bz_s_x32_unscaled",
+  "ld1h_z_p_bz_s_x32_unscaled",
+  "ldff1h_z_p_bz_s_x32_unscaled",
+  "ld1b_z_p_bz_d_x32_unscaled",
+  "ldff1b_z_p_bz_d_x32_unscaled",
+  "ld1h_z_p_bz_d_x32_unscaled",
+  "ldff1h_z_p_bz_d_x32_unscaled",
+  "sm3partw1_vvv4_cryptosha512_3",
+  "sm3partw2_vvv4_cryptosha512_3",
+  "sm4ekey_vvv4_cryptosha512_3",
+  "sqdmullb_z_zzi_s",
+  "sqdmullb_z_zzi_d",
+  "stgm_64bulk_ldsttags",
+  "uabalb_z_zzz",
+  "uabalt_z_zzz",
+  "sdiv_32_dp_2src",
+  "rorv_32_dp_2src",
+  "smlalb_z_zzzi_s",
+  "smlalt_z_zzzi_s",
+  "smlalb_z_zzzi_d",
+  "smlalt_z_zzzi_d",
+  "ld4_asisdlso_b4_4b",
+  "aesimc_b_cryptoaes",
+  "fcvtl_asimdmisc_l",
+  "sqabs_asimdmisc_r",
+  "sysl_rc_systeminstrs",
+  "mrs_rs_systemmove",
+  "sqdmulh_asisdelem_r",
+  "sqrdmulh_asisdelem_r",
+  "st1_asisdlsop_hx1_r1h",
+  "ld1_asisdlsop_hx1_r1h",
+  "ld3_asisdlsop_hx3_r3h",
+  "orr_asimdimm_l_hl",
+  "sqshrn_asimdshf_n",
+  "sqrshrn_asimdshf_n",
+  "and_z_zz",
+  "eor3_z_zzz",
+  "bsl_z_zzz",
+  "orr_z_zz",
+  "bcax_z_zzz",
+  "bsl1n_z_zzz",
+  "eor_z_zz",
+  "bsl2n_z_zzz",
+  "bic_z_zz",
+  "nbsl_z_zzz",
+  "add_z_zz",
+  "sub_z_zz",
+  "sqadd_z_zz",
+  "uqadd_z_zz",
+  "sqsub_z_zz",
+  "uqsub_z_zz",
+  "xar_z_zzi",
+  "mla_z_zzzi_h",
+  "mls_z_zzzi_h",
+  "sqrdmlah_z_zzzi_h",
+  "sqrdmlsh_z_zzzi_h",
+  "sdot_z_zzzi_s",
+  "udot_z_zzzi_s",
+  "mla_z_zzzi_s",
+  "mls_z_zzzi_s",
+  "sqrdmlah_z_zzzi_s",
+  "sqrdmlsh_z_zzzi_s",
+  "usdot_z_zzzi_s",
+  "sudot_z_zzzi_s",
+  "sqdmlalb_z_zzzi_s",
+  "sqdmlalt_z_zzzi_s",
+  "sqdmlslb_z_zzzi_s",
+  "sqdmlslt_z_zzzi_s",
+  "sdot_z_zzzi_d",
+  "udot_z_zzzi_d",
+  "mla_z_zzzi_d",
+  "mls_z_zzzi_d",
+  "sqrdmlah_z_zzzi_d",
+  "sqrdmlsh_z_zzzi_d",
+  "sqdmlalb_z_zzzi_d",
+  "sqdmlalt_z_zzzi_d",
+  "sqdmlslb_z_zzzi_d",
+  "sqdmlslt_z_zzzi_d",
+  "ld1_asisdlsop_dx1_r1d",
+  "saba_z_zzz",
+  "uaba_z_zzz",
+  "ushr_asisdshf_r",
+  "usra_asisdshf_r",
+  "urshr_asisdshf_r",
+  "ursra_asisdshf_r",
+  "cmla_z_zzzi_h",
+  "cmla_z_zzzi_s",
+  "sqneg_asisdmisc_r",
+  "ptrues_p_s",
+  "sqxtnb_z_zz",
+  "cmge_asisdmisc_z",
+  "ld3_asisdlsop_sx3_r3s",
+  "ld3_asisdlsop_s3_i3s",
+  "ld3_asisdlso_d3_3d",
+  "fmax_asimdsamefp16_only",
+  "fmin_asimdsamefp16_only",
+  "sha1h_ss_cryptosha2",
+  "sha1su1_vv_cryptosha2",
+  "sha256su0_vv_cryptosha2",
+  "suqadd_asisdmisc_r",
+  "adds_64s_addsub_ext",
+  "subs_64s_addsub_ext",
+  "fcmp_s_floatcmp",
+  "fcmp_sz_floatcmp",
+  "fcmpe_s_floatcmp",
+  "fcmpe_sz_floatcmp",
+  "fmla_z_p_zzz",
+  "fmls_z_p_zzz",
+  "ld64b_64l_memop",
+  "ld1row_z_p_bi_u32",
+  "ld1row_z_p_br_contiguous",
+  "ld1rod_z_p_bi_u64",
+  "ld1rod_z_p_br_contiguous",
+  "str_p_bi",
+  "swp_32_memop",
+  "swpl_32_memop",
+  "cpyprn_cpy_memcms",
+  "cpypwtrn_cpy_memcms",
+  "cpyprtrn_cpy_memcms",
+  "cpyptrn_cpy_memcms",
+  "cpymrn_cpy_memcms",
+  "cpymwtrn_cpy_memcms",
+  "cpymrtrn_cpy_memcms",
+  "cpymtrn_cpy_memcms",
+  "cpyern_cpy_memcms",
+  "cpyewtrn_cpy_memcms",
+  "cpyertrn_cpy_memcms",
+  "cpyetrn_cpy_memcms",
+  "setge_set_memcms",
+  "setget_set_memcms",
+  "setgen_set_memcms",
+  "setgetn_set_memcms",
+  "bic_asimdimm_l_hl",
+  "uqshrn_asimdshf_n",
+  "uqrshrn_asimdshf_n",
+  "saddlb_z_zz",
+  "saddlt_z_zz",
+  "uaddlb_z_zz",
+  "uaddlt_z_zz",
+  "ssublb_z_zz",
+  "ssublt_z_zz",
+  "usublb_z_zz",
+  "usublt_z_zz",
+  "sabdlb_z_zz",
+  "sabdlt_z_zz",
+  "uabdlb_z_zz",
+  "uabdlt_z_zz",
+  "ldadd_32_memop",
+  "ldclr_32_memop",
+  "ldeor_32_memop",
+  "ldset_32_memop",
+  "ldaddl_32_memop",
+  "ldclrl_32_memop",
+  "ldeorl_32_memop",
+  "ldsetl_32_memop",
+  "ldadda_32_memop",
+  "ldclra_32_memop",
+  "ldeora_32_memop",
+  "ldseta_32_memop",
+  "ldrsw_64_ldst_regoff",
+  "ldaddal_32_memop",
+  "ldclral_32_memop",
+  "ldeoral_32_memop",
+  "ldsetal_32_memop",
+  "ldadd_64_memop",
+  "ldclr_64_memop",
+  "ldeor_64_memop",
+  "ldset_64_memop",
+  "ldaddl_64_memop",
+  "ldclrl_64_memop",
+  "ldeorl_64_memop",
+  "ldsetl_64_memop",
+  "ldraa_64_ldst_pac",
+  "ldraa_64w_ldst_pac",
+  "ldadda_64_memop",
+  "ldclra_64_memop",
+  "ldeora_64_memop",
+  "ldseta_64_memop",
+  "prfm_p_ldst_regoff",
+  "ldaddal_64_memop",
+  "ldclral_64_memop",
+  "ldeoral_64_memop",
+  "ldsetal_64_memop",
+  "ldrab_64_ldst_pac",
+  "ldrab_64w_ldst_pac",
+  "ld1sb_z_p_bz_s_x32_unscaled",
+  "ldff1sb_z_p_bz_s_x32_unscaled",
+  "ld1sh_z_p_bz_s_x32_unscaled",
+  "ldff1sh_z_p_bz_s_x32_unscaled",
+  "ld1sb_z_p_bz_d_x32_unscaled",
+  "ldff1sb_z_p_bz_d_x32_unscaled",
+  "ld1sh_z_p_bz_d_x32_unscaled",
+  "ldff1sh_z_p_bz_d_x32_unscaled",
+  "stlxr_sr32_ldstexcl",
+  "ldaxr_lr32_ldstexcl",
+  "stlr_sl32_ldstexcl",
+  "ldar_lr32_ldstexcl",
+  "stlxr_sr64_ldstexcl",
+  "ldaxr_lr64_ldstexcl",
+  "stlr_sl64_ldstexcl",
+  "ldar_lr64_ldstexcl",
+  "ftmad_z_zzi",
+  "dup_asimdins_dr_r",
+  "fmla_asimdsamefp16_only",
+  "fmls_asimdsamefp16_only",
+  "fmlsl2_asimdelem_lh",
+  "sqrdmlah_asimdelem_r",
+  "sabalb_z_zzz",
+  "sabalt_z_zzz",
+  "dup_z_zi",
+  "tbl_z_zz_2",
+  "tbx_z_zz",
+  "tbl_z_zz_1",
+  "bfm_32m_bitfield",
+  "st1_asisdlsop_h1_i1h",
+  "fmaxp_asimdsame_only",
+  "fminp_asimdsame_only",
+  "pacdza_64z_dp_1src",
+  "udiv_32_dp_2src",
+  "asrv_32_dp_2src",
+  "fmul_asimdelem_rh_h",
+  "shrn_asimdshf_n",
+  "rshrn_asimdshf_n",
+  "sshll_asimdshf_l",
+  "fmul_asimdelem_r_sd",
+  "sqdmull_asimdelem_l",
+  "ccmp_64_condcmp_reg",
+  "brkas_p_p_p_z",
+  "brkns_p_p_pp",
+  "ld3_asisdlso_s3_3s",
+  "ld1sh_z_p_br_s32",
+  "ldff1sh_z_p_br_s32",
+  "ld1w_z_p_br_u64",
+  "ldff1w_z_p_br_u64",
+  "ld1sb_z_p_br_s32",
+  "ldff1sb_z_p_br_s32",
+  "ld1d_z_p_br_u64",
+  "ldff1d_z_p_br_u64",
+  "st2w_z_p_br_contiguous",
+  "st4w_z_p_br_contiguous",
+  "st1w_z_p_br",
+  "str_z_bi",
+  "st2d_z_p_br_contiguous",
+  "st1d_z_p_br",
+  "st4d_z_p_br_contiguous",
+  "ssra_z_zi",
+  "usra_z_zi",
+  "st3_asisdlsop_dx3_r3d",
+  "ld1_asisdlsop_sx1_r1s",
+  "ld1_asisdlsop_s1_i1s",
+  "clz_asimdmisc_r",
+  "uqxtn_asimdmisc_n",
+  "rev_32_dp_1src",
+  "srsra_z_zi",
+  "ursra_z_zi",
+  "fcvtns_asimdmiscfp16_r",
+  "fcvtns_asimdmisc_r",
+  "fcvtps_asimdmiscfp16_r",
+  "fcvtps_asimdmisc_r",
+  "cmlt_asimdmisc_z",
+  "smaxv_asimdall_only",
+  "sminv_asimdall_only",
+  "rmif_only_rmif",
+  "ccmn_64_condcmp_reg",
+  "ccmn_64_condcmp_imm",
+  "ccmp_64_condcmp_imm",
+  "sm3tt1a_vvv4_crypto3_imm2",
+  "sm3tt1b_vvv4_crypto3_imm2",
+  "sm3tt2a_vvv4_crypto3_imm2",
+  "sm3tt2b_vvv_crypto3_imm2",
+  "add_asisdsame_only",
+  "sqdmulh_asisdsame_only",
+  "setffr_f",
+  "scvtf_asisdshf_c",
+  "fcvtzs_asisdshf_c",
+  "st1_asisdlsop_sx1_r1s",
+  "st3_asisdlsop_sx3_r3s",
+  "st2_asisdlsop_hx2_r2h",
+  "st4_asisdlsop_hx4_r4h",
+  "aesd_b_cryptoaes",
+  "cnt_asimdmisc_r",
+  "sqincw_z_zs",
+  "sqdecw_z_zs",
+  "incw_z_zs",
+  "sqincd_z_zs",
+  "sqdecd_z_zs",
+  "incd_z_zs",
+  "brkpb_p_p_pp",
+  "brkpbs_p_p_pp",
+  "ld1_asisdlsop_h1_i1h",
+  "stlxp_sp32_ldstexcl",
+  "ldaxp_lp32_ldstexcl",
+  "casl_c32_ldstexcl",
+  "casal_c32_ldstexcl",
+  "stlxp_sp64_ldstexcl",
+  "ldaxp_lp64_ldstexcl",
+  "casl_c64_ldstexcl",
+  "casal_c64_ldstexcl",
+  "ld2_asisdlsop_s2_i2s",
+  "fcvtxn_asisdmisc_n",
+  "rbit_64_dp_1src",
+  "clz_64_dp_1src",
+  "pacia_64p_dp_1src",
+  "autia_64p_dp_1src",
+  "umull_asimddiff_l",
+  "st4_asisdlsep_r4_r",
+  "subps_64s_dp_2src",
+  "movi_asimdimm_l_sl",
+  "smull_asimddiff_l",
+  "sqdmull_asimddiff_l",
+  "pmull_asimddiff_l",
+  "cbz_32_compbranch",
+  "mvni_asimdimm_l_hl",
+  "sqshrun_asimdshf_n",
+  "sqrshrun_asimdshf_n",
+  "ushll_asimdshf_l",
+  "usqadd_asimdmisc_r",
+  "shll_asimdmisc_s",
+  "uaddlv_asimdall_only",
+  "orn_64_log_shift",
+  "bics_64_log_shift",
+  "cpyfpwn_cpy_memcms",
+  "cpyfpwtwn_cpy_memcms",
+  "cpyfprtwn_cpy_memcms",
+  "cpyfptwn_cpy_memcms",
+  "cpyfmwn_cpy_memcms",
+  "cpyfmwtwn_cpy_memcms",
+  "cpyfmrtwn_cpy_memcms",
+  "cpyfmtwn_cpy_memcms",
+  "cpyfewn_cpy_memcms",
+  "cpyfewtwn_cpy_memcms",
+  "cpyfertwn_cpy_memcms",
+  "cpyfetwn_cpy_memcms",
+  "setm_set_memcms",
+  "setmt_set_memcms",
+  "setmn_set_memcms",
+  "setmtn_set_memcms",
+  "cntp_r_p_p",
+  "fmov_h_floatdp1",
+  "fneg_h_floatdp1",
+  "fcvt_sh_floatdp1",
+  "frintn_h_floatdp1",
+  "frintm_h_floatdp1",
+  "frinta_h_floatdp1",
+  "frintx_h_floatdp1",
+  "fcmge_asisdmiscfp16_fz",
+  "fcmge_asisdmisc_fz",
+  "fminnmp_asisdpair_only_sd",
+  "st2_asisdlsop_bx2_r2b",
+  "st2_asisdlsop_b2_i2b",
+  "cmpge_p_p_zw",
+  "cmpgt_p_p_zw",
+  "cmplt_p_p_zw",
+  "cmple_p_p_zw",
+  "fcmla_z_p_zzz",
+  "ccmn_32_condcmp_imm",
+  "udot_asimdelem_d",
+  "sqrdmlsh_asimdelem_r",
+  "cmplt_p_p_zi",
+  "cmple_p_p_zi",
+  "mvni_asimdimm_m_sm",
+  "fmlal2_asimdelem_lh",
+  "umull_asimdelem_l",
+  "ld1b_z_p_br_u16",
+  "ldff1b_z_p_br_u16",
+  "ld1b_z_p_br_u64",
+  "ldff1b_z_p_br_u64",
+  "ld1h_z_p_br_u16",
+  "ldff1h_z_p_br_u16",
+  "ld1h_z_p_br_u64",
+  "ldff1h_z_p_br_u64",
+  "st2b_z_p_br_contiguous",
+  "st4b_z_p_br_contiguous",
+  "st2h_z_p_br_contiguous",
+  "st4h_z_p_br_contiguous",
+  "st3_asisdlsep_r3_r",
+  "st3_asisdlsep_i3_i",
+  "asr_z_zi",
+  "lsr_z_zi",
+  "lsl_z_zi",
+  "fmul_s_floatdp2",
+  "fdiv_s_floatdp2",
+  "fadd_s_floatdp2",
+  "fsub_s_floatdp2",
+  "fmul_d_floatdp2",
+  "fdiv_d_floatdp2",
+  "fadd_d_floatdp2",
+  "fsub_d_floatdp2",
+  "fmul_h_floatdp2",
+  "fdiv_h_floatdp2",
+  "fadd_h_floatdp2",
+  "fsub_h_floatdp2",
+  "add_64_addsub_shift",
+  "sub_64_addsub_shift",
+  "ptest_p_p",
+  "fmadd_s_floatdp3",
+  "fmadd_d_floatdp3",
+  "fmadd_h_floatdp3",
+  "brk_ex_exception",
+  "tcancel_ex_exception",
+  "dcps1_dc_exception",
+  "dcps2_dc_exception",
+  "dcps3_dc_exception",
+  "rdffr_p_f",
+  "index_z_ii",
+  "index_z_ri",
+  "index_z_ir",
+  "index_z_rr",
+  "ccmn_32_condcmp_reg",
+  "ccmp_32_condcmp_reg",
+  "ccmp_32_condcmp_imm",
+  "ld1r_asisdlso_r1",
+  "ld3r_asisdlso_r3",
+  "ld1r_asisdlsop_rx1_r",
+  "ld3r_asisdlsop_rx3_r",
+  "ld1r_asisdlsop_r1_i",
+  "ld3r_asisdlsop_r3_i",
+  "cntb_r_s",
+  "incb_r_rs",
+  "cnth_r_s",
+  "inch_r_rs",
+  "clrex_bn_barriers",
+  "dsb_bo_barriers",
+  "isb_bi_barriers",
+  "fmulx_asisdsame_only",
+  "frecps_asisdsame_only",
+  "frsqrts_asisdsame_only",
+  "aesmc_b_cryptoaes",
+  "fcvtn_asimdmisc_n",
+  "bfcvtn_asimdmisc_4s",
+  "sadalp_asimdmisc_p",
+  "mad_z_p_zzz",
+  "msb_z_p_zzz",
+  "ld1_asisdlso_h1_1h",
+  "ldsmaxb_32_memop",
+  "ldsminb_32_memop",
+  "strb_32b_ldst_regoff",
+  "ldumaxb_32_memop",
+  "lduminb_32_memop",
+  "strb_32bl_ldst_regoff",
+  "ldsmaxlb_32_memop",
+  "ldsminlb_32_memop",
+  "ldrb_32b_ldst_regoff",
+  "ldumaxlb_32_memop",
+  "lduminlb_32_memop",
+  "ldrb_32bl_ldst_regoff",
+  "ldsmaxab_32_memop",
+  "ldsminab_32_memop",
+  "ldrsb_64b_ldst_regoff",
+  "ldumaxab_32_memop",
+  "lduminab_32_memop",
+  "ldrsb_64bl_ldst_regoff",
+  "ldsmaxalb_32_memop",
+  "ldsminalb_32_memop",
+  "ldrsb_32b_ldst_regoff",
+  "ldumaxalb_32_memop",
+  "lduminalb_32_memop",
+  "ldrsb_32bl_ldst_regoff",
+  "ldsmaxh_32_memop",
+  "ldsminh_32_memop",
+  "ldumaxh_32_memop",
+  "lduminh_32_memop",
+  "strh_32_ldst_regoff",
+  "ldsmaxlh_32_memop",
+  "ldsminlh_32_memop",
+  "ldumaxlh_32_memop",
+  "lduminlh_32_memop",
+  "ldrh_32_ldst_regoff",
+  "ldsmaxah_32_memop",
+  "ldsminah_32_memop",
+  "ldumaxah_32_memop",
+  "lduminah_32_memop",
+  "ldrsh_64_ldst_regoff",
+  "ldsmaxalh_32_memop",
+  "ldsminalh_32_memop",
+  "ldumaxalh_32_memop",
+  "lduminalh_32_memop",
+  "ldrsh_32_ldst_regoff",
+  "ret_64r_branch_reg",
+  "ftssel_z_zz",
+  "ld1_asisdlso_s1_1s",
+  "brka_p_p_p",
+  "brkn_p_p_pp",
+  "b_only_branch_imm",
+  "b_only_condbranch",
+  "bc_only_condbranch",
+  "msr_sr_systemmove",
+  "fnmla_z_p_zzz",
+  "fnmls_z_p_zzz",
+  "ld2r_asisdlso_r2",
+  "ld4r_asisdlso_r4",
+  "ld2r_asisdlsop_rx2_r",
+  "ld4r_asisdlsop_rx4_r",
+  "ld2r_asisdlsop_r2_i",
+  "ld4r_asisdlsop_r4_i",
+  "blraaz_64_branch_reg",
+  "swpa_64_memop",
+  "swpal_64_memop",
+  "ld3_asisdlso_b3_3b",
+  "aesimc_z_z",
+  "aesd_z_zz",
+  "fmla_asimdsame_only",
+  "fmls_asimdsame_only",
+  "ld2_asisdlsep_r2_r",
+  "ld2_asisdlsep_i2_i",
+  "eor_asimdsame_only",
+  "bsl_asimdsame_only",
+  "bit_asimdsame_only",
+  "bif_asimdsame_only",
+  "uqincb_r_rs_uw",
+  "uqdecb_r_rs_uw",
+  "uqincb_r_rs_x",
+  "uqdecb_r_rs_x",
+  "uqinch_r_rs_uw",
+  "uqdech_r_rs_uw",
+  "uqinch_r_rs_x",
+  "uqdech_r_rs_x",
+  "cmtst_asisdsame_only",
+  "yield_hi_hints",
+  "wfi_hi_hints",
+  "sevl_hi_hints",
+  "xpaclri_hi_hints",
+  "psb_hc_hints",
+  "hint_hm_hints",
+  "paciasp_hi_hints",
+  "pacibsp_hi_hints",
+  "autiasp_hi_hints",
+  "autibsp_hi_hints",
+  "rev_64_dp_1src",
+  "pacdb_64p_dp_1src",
+  "autdb_64p_dp_1src",
+  "xpacd_64z_dp_1src",
+  "add_z_p_zz",
+  "sub_z_p_zz",
+  "subr_z_p_zz",
+  "smax_z_p_zz",
+  "umax_z_p_zz",
+  "smin_z_p_zz",
+  "umin_z_p_zz",
+  "sabd_z_p_zz",
+  "uabd_z_p_zz",
+  "mul_z_p_zz",
+  "smulh_z_p_zz",
+  "umulh_z_p_zz",
+  "sdiv_z_p_zz",
+  "udiv_z_p_zz",
+  "sdivr_z_p_zz",
+  "udivr_z_p_zz",
+  "orr_z_p_zz",
+  "eor_z_p_zz",
+  "and_z_p_zz",
+  "bic_z_p_zz",
+  "st3_asisdlsop_bx3_r3b",
+  "st3_asisdlsop_b3_i3b",
+  "fmla_z_zzzi_h",
+  "fmls_z_zzzi_h",
+  "fmla_z_zzzi_s",
+  "fmls_z_zzzi_s",
+  "fcmla_z_zzzi_h",
+  "fmla_z_zzzi_d",
+  "fmls_z_zzzi_d",
+  "fcmla_z_zzzi_s",
+  "mla_asimdelem_r",
+  "umlal_asimdelem_l",
+  "rev32_64_dp_1src",
+  "pacda_64p_dp_1src",
+  "autda_64p_dp_1src",
+  "suqadd_asimdmisc_r",
+  "saddlv_asimdall_only",
+  "st4_asisdlsep_i4_i",
+  "rev32_asimdmisc_r",
+  "zip1_z_zz",
+  "zip2_z_zz",
+  "uzp1_z_zz",
+  "uzp2_z_zz",
+  "trn1_z_zz",
+  "trn2_z_zz",
+  "addhnb_z_zz",
+  "addhnt_z_zz",
+  "raddhnb_z_zz",
+  "raddhnt_z_zz",
+  "subhnb_z_zz",
+  "subhnt_z_zz",
+  "rsubhnb_z_zz",
+  "rsubhnt_z_zz",
+  "ld1_asisdlsep_r3_r3",
+  "ld1_asisdlsep_i3_i3",
+  "bic_32_log_shift",
+  "eon_32_log_shift",
+  "fcmlt_p_p_z0",
+  "fcmle_p_p_z0",
+  "fcmne_p_p_z0",
+  "adds_32s_addsub_imm",
+  "subs_32s_addsub_imm",
+  "fadd_asimdsame_only",
+  "fsub_asimdsame_only",
+  "st1_asisdlse_r2_2v",
+  "sqxtunb_z_zz",
+  "fcmp_d_floatcmp",
+  "fcmp_dz_floatcmp",
+  "fcmpe_d_floatcmp",
+  "fcmpe_dz_floatcmp",
+  "madd_32a_dp_3src",
+  "frecpe_z_z",
+  "add_32_addsub_shift",
+  "sub_32_addsub_shift",
+  "ld1_asisdlse_r3_3v",
+  "stg_64spost_ldsttags",
+  "stg_64soffset_ldsttags",
+  "stg_64spre_ldsttags",
+  "ldg_64loffset_ldsttags",
+  "stzg_64spost_ldsttags",
+  "stzg_64soffset_ldsttags",
+  "stzg_64spre_ldsttags",
+  "st2g_64spost_ldsttags",
+  "st2g_64soffset_ldsttags",
+  "st2g_64spre_ldsttags",
+  "stz2g_64spost_ldsttags",
+  "stz2g_64soffset_ldsttags",
+  "stz2g_64spre_ldsttags",
+  "fmlslb_z_zzzi_s",
+  "fmlslt_z_zzzi_s",
+  "nop_hi_hints",
+  "wfe_hi_hints",
+  "sev_hi_hints",
+  "dgh_hi_hints",
+  "pacia1716_hi_hints",
+  "pacib1716_hi_hints",
+  "autia1716_hi_hints",
+  "autib1716_hi_hints",
+  "esb_hi_hints",
+  "tsb_hc_hints",
+  "csdb_hi_hints",
+  "paciaz_hi_hints",
+  "pacibz_hi_hints",
+  "autiaz_hi_hints",
+  "autibz_hi_hints",
+  "bti_hb_hints",
+  "fcmla_asimdelem_c_h",
+  "sri_asimdshf_r",
+  "sli_asimdshf_r",
+  "sqshlu_asimdshf_r",
+  "uqshl_asimdshf_r",
+  "fcmla_asimdelem_c_s",
+  "mls_asimdelem_r",
+  "umlsl_asimdelem_l",
+  "brkpa_p_p_pp",
+  "brkpas_p_p_pp",
+  "movi_asimdimm_d_ds",
+  "movi_asimdimm_d2_d",
+  "fmov_asimdimm_d2_d",
+  "ucvtf_asimdshf_c",
+  "fcvtzu_asimdshf_c",
+  "fcmge_p_p_z0",
+  "fcmgt_p_p_z0",
+  "fcmeq_p_p_z0",
+  "fcmuo_p_p_zz",
+  "asr_z_p_zi",
+  "lsr_z_p_zi",
+  "lsl_z_p_zi",
+  "asrd_z_p_zi",
+  "sqshl_z_p_zi",
+  "uqshl_z_p_zi",
+  "srshr_z_p_zi",
+  "urshr_z_p_zi",
+  "sqshlu_z_p_zi",
+  "asr_z_p_zz",
+  "sxtb_z_p_z",
+  "lsr_z_p_zz",
+  "uxtb_z_p_z",
+  "sxth_z_p_z",
+  "lsl_z_p_zz",
+  "uxth_z_p_z",
+  "asrr_z_p_zz",
+  "sxtw_z_p_z",
+  "lsrr_z_p_zz",
+  "uxtw_z_p_z",
+  "abs_z_p_z",
+  "lslr_z_p_zz",
+  "neg_z_p_z",
+  "asr_z_p_zw",
+  "cls_z_p_z",
+  "lsr_z_p_zw",
+  "clz_z_p_z",
+  "cnt_z_p_z",
+  "lsl_z_p_zw",
+  "cnot_z_p_z",
+  "fabs_z_p_z",
+  "fneg_z_p_z",
+  "not_z_p_z",
+  "urecpe_z_p_z",
+  "ursqrte_z_p_z",
+  "srshl_z_p_zz",
+  "urshl_z_p_zz",
+  "sadalp_z_p_z",
+  "uadalp_z_p_z",
+  "srshlr_z_p_zz",
+  "urshlr_z_p_zz",
+  "sqshl_z_p_zz",
+  "sqabs_z_p_z",
+  "uqshl_z_p_zz",
+  "sqneg_z_p_z",
+  "sqrshl_z_p_zz",
+  "uqrshl_z_p_zz",
+  "sqshlr_z_p_zz",
+  "uqshlr_z_p_zz",
+  "sqrshlr_z_p_zz",
+  "uqrshlr_z_p_zz",
+  "shadd_z_p_zz",
+  "uhadd_z_p_zz",
+  "addp_z_p_zz",
+  "shsub_z_p_zz",
+  "uhsub_z_p_zz",
+  "srhadd_z_p_zz",
+  "smaxp_z_p_zz",
+  "urhadd_z_p_zz",
+  "umaxp_z_p_zz",
+  "shsubr_z_p_zz",
+  "sminp_z_p_zz",
+  "uhsubr_z_p_zz",
+  "uminp_z_p_zz",
+  "sqadd_z_p_zz",
+  "uqadd_z_p_zz",
+  "sqsub_z_p_zz",
+  "uqsub_z_p_zz",
+  "suqadd_z_p_zz",
+  "usqadd_z_p_zz",
+  "sqsubr_z_p_zz",
+  "uqsubr_z_p_zz",
+  "ldr_p_bi",
+  "prfb_i_p_bi_s",
+  "prfh_i_p_bi_s",
+  "ld1sw_z_p_bz_d_x32_scaled",
+  "ldff1sw_z_p_bz_d_x32_scaled",
+  "ldsmax_32_memop",
+  "ldsmin_32_memop",
+  "ldumax_32_memop",
+  "ldumin_32_memop",
+  "ldsmaxl_32_memop",
+  "ldsminl_32_memop",
+  "ldumaxl_32_memop",
+  "lduminl_32_memop",
+  "ldsmaxa_32_memop",
+  "ldsmina_32_memop",
+  "ldumaxa_32_memop",
+  "ldumina_32_memop",
+  "ldsmaxal_32_memop",
+  "ldsminal_32_memop",
+  "ldumaxal_32_memop",
+  "lduminal_32_memop",
+  "ldsmax_64_memop",
+  "ldsmin_64_memop",
+  "ldumax_64_memop",
+  "ldumin_64_memop",
+  "ldsmaxl_64_memop",
+  "ldsminl_64_memop",
+  "ldumaxl_64_memop",
+  "lduminl_64_memop",
+  "ldsmaxa_64_memop",
+  "ldsmina_64_memop",
+  "ldumaxa_64_memop",
+  "ldumina_64_memop",
+  "ldsmaxal_64_memop",
+  "ldsminal_64_memop",
+  "ldumaxal_64_memop",
+  "lduminal_64_memop",
+  "sbc_64_addsub_carry",
+  "bic_asimdimm_l_sl",
+  "cmle_asisdmisc_z",
+  "fcvtxn_asimdmisc_n",
+  "uadalp_asimdmisc_p",
+  "setf16_only_setf",
+  "fminp_asisdpair_only_sd",
+  "sqdmulh_z_zzi_s",
+  "mul_z_zzi_s",
+  "sqdmulh_z_zzi_d",
+  "mul_z_zzi_d",
+  "sqxtunt_z_zz",
+  "subp_64s_dp_2src",
+  "irg_64i_dp_2src",
+  "lslv_64_dp_2src",
+  "pacga_64p_dp_2src",
+  "orr_64_log_imm",
+  "ands_64s_log_imm",
+  "movk_64_movewide",
+  "st1_asisdlsep_r3_r3",
+  "st1_asisdlsep_i3_i3",
+  "adds_32_addsub_shift",
+  "subs_32_addsub_shift",
+  "frintn_asimdmiscfp16_r",
+  "frintn_asimdmisc_r",
+  "frintp_asimdmiscfp16_r",
+  "frintp_asimdmisc_r",
+  "cmgt_asimdmisc_z",
+  "stnp_s_ldstnapair_offs",
+  "ldnp_s_ldstnapair_offs",
+  "stp_s_ldstpair_post",
+  "ldp_s_ldstpair_post",
+  "stnp_d_ldstnapair_offs",
+  "ldnp_d_ldstnapair_offs",
+  "stp_d_ldstpair_post",
+  "ldp_d_ldstpair_post",
+  "stur_32_ldst_unscaled",
+  "str_32_ldst_immpost",
+  "sttr_32_ldst_unpriv",
+  "str_32_ldst_immpre",
+  "ldur_32_ldst_unscaled",
+  "ldr_32_ldst_immpost",
+  "ldtr_32_ldst_unpriv",
+  "ldr_32_ldst_immpre",
+  "ldursw_64_ldst_unscaled",
+  "ldrsw_64_ldst_immpost",
+  "ldtrsw_64_ldst_unpriv",
+  "ldrsw_64_ldst_immpre",
+  "stur_64_ldst_unscaled",
+  "str_64_ldst_immpost",
+  "sttr_64_ldst_unpriv",
+  "str_64_ldst_immpre",
+  "ldur_64_ldst_unscaled",
+  "ldr_64_ldst_immpost",
+  "ldtr_64_ldst_unpriv",
+  "ldr_64_ldst_immpre",
+  "prfum_p_ldst_unscaled",
+  "ld1_asisdlse_r2_2v",
+  "xpaci_64z_dp_1src",
+  "ldr_32_loadlit",
+  "ldr_64_loadlit",
+  "sqdmullt_z_zzi_s",
+  "sqdmullt_z_zzi_d",
+  "ld2_asisdlse_r2",
+  "fmov_h_floatimm",
+  "eor_p_p_pp_z",
+  "sel_p_p_pp",
+  "fabs_d_floatdp1",
+  "fsqrt_d_floatdp1",
+  "fcvt_hd_floatdp1",
+  "frintp_d_floatdp1",
+  "frintz_d_floatdp1",
+  "frinti_d_floatdp1",
+  "frint32x_d_floatdp1",
+  "frint64x_d_floatdp1",
+  "uaddl_asimddiff_l",
+  "uhadd_asimdsame_only",
+  "uqadd_asimdsame_only",
+  "uaddw_asimddiff_w",
+  "urhadd_asimdsame_only",
+  "usubl_asimddiff_l",
+  "uhsub_asimdsame_only",
+  "uqsub_asimdsame_only",
+  "usubw_asimddiff_w",
+  "cmhi_asimdsame_only",
+  "cmhs_asimdsame_only",
+  "fmul_asimdsame_only",
+  "fmaxnmp_asimdsame_only",
+  "fminnmp_asimdsame_only",
+  "ld2b_z_p_bi_contiguous",
+  "ld2b_z_p_br_contiguous",
+  "ld4b_z_p_bi_contiguous",
+  "ld4b_z_p_br_contiguous",
+  "ld2h_z_p_bi_contiguous",
+  "ld2h_z_p_br_contiguous",
+  "ld4h_z_p_bi_contiguous",
+  "ld4h_z_p_br_contiguous",
+  "st2b_z_p_bi_contiguous",
+  "st4b_z_p_bi_contiguous",
+  "st1b_z_p_bi",
+  "st2h_z_p_bi_contiguous",
+  "st4h_z_p_bi_contiguous",
+  "st1h_z_p_bi",
+  "eretaa_64e_branch_reg",
+  "st1_asisdlsop_s1_i1s",
+  "ld1_asisdlsop_bx1_r1b",
+  "ld1_asisdlsop_b1_i1b",
+  "ld1w_z_p_bz_s_x32_unscaled",
+  "ldff1w_z_p_bz_s_x32_unscaled",
+  "ldr_z_bi",
+  "prfw_i_p_bi_s",
+  "prfd_i_p_bi_s",
+  "ld1w_z_p_bz_d_x32_unscaled",
+  "ldff1w_z_p_bz_d_x32_unscaled",
+  "ld1d_z_p_bz_d_x32_unscaled",
+  "ldff1d_z_p_bz_d_x32_unscaled",
+  "fcvtau_asimdmiscfp16_r",
+  "fcvtau_asimdmisc_r",
+  "fmaxnmv_asimdall_only_sd",
+  "fcmge_asimdmiscfp16_fz",
+  "fcmge_asimdmisc_fz",
+  "ursqrte_asimdmisc_r",
+  "fminnmv_asimdall_only_sd",
+  "ld1b_z_p_bi_u8",
+  "ldnf1b_z_p_bi_u8",
+  "ld1b_z_p_bi_u32",
+  "ldnf1b_z_p_bi_u32",
+  "ld1sw_z_p_bi_s64",
+  "ldnf1sw_z_p_bi_s64",
+  "ld1h_z_p_bi_u32",
+  "ldnf1h_z_p_bi_u32",
+  "st1b_z_p_bz_d_x32_unscaled",
+  "st1b_z_p_bz_d_64_unscaled",
+  "st1b_z_p_bz_s_x32_unscaled",
+  "st1b_z_p_ai_d",
+  "st1h_z_p_bz_d_x32_unscaled",
+  "st1h_z_p_bz_d_64_unscaled",
+  "st1h_z_p_bz_s_x32_unscaled",
+  "st1h_z_p_ai_d",
+  "ld4_asisdlsop_s4_i4s",
+  "sha512h_qqv_cryptosha512_3",
+  "sha512h2_qqv_cryptosha512_3",
+  "sha512su1_vvv2_cryptosha512_3",
+  "rax1_vvv2_cryptosha512_3",
+  "csel_32_condsel",
+  "csinc_32_condsel",
+  "crc32b_32c_dp_2src",
+  "crc32h_32c_dp_2src",
+  "crc32w_32c_dp_2src",
+  "crc32cb_32c_dp_2src",
+  "crc32ch_32c_dp_2src",
+  "crc32cw_32c_dp_2src",
+  "csinv_32_condsel",
+  "csneg_32_condsel",
+  "stzgm_64bulk_ldsttags",
+  "setf8_only_setf",
+  "add_32_addsub_ext",
+  "sub_32_addsub_ext",
+  "ld4_asisdlsop_bx4_r4b",
+  "ld4_asisdlsop_b4_i4b",
+  "ld1_asisdlse_r4_4v",
+  "fdiv_asimdsame_only",
+  "retab_64e_branch_reg",
+  "scvtf_asimdmiscfp16_r",
+  "scvtf_asimdmisc_r",
+  "fcmeq_asimdmiscfp16_fz",
+  "frecpe_asimdmiscfp16_r",
+  "fcmeq_asimdmisc_fz",
+  "frecpe_asimdmisc_r",
+  "decw_r_rs",
+  "decd_r_rs",
+  "frint64x_asimdmisc_r",
+  "fmaxv_asimdall_only_sd",
+  "fneg_asimdmiscfp16_r",
+  "fsqrt_asimdmiscfp16_r",
+  "fneg_asimdmisc_r",
+  "fsqrt_asimdmisc_r",
+  "fminv_asimdall_only_sd",
+  "ldnt1w_z_p_bi_contiguous",
+  "ldnt1w_z_p_br_contiguous",
+  "ld3w_z_p_bi_contiguous",
+  "ld3w_z_p_br_contiguous",
+  "ldnt1d_z_p_bi_contiguous",
+  "ldnt1d_z_p_br_contiguous",
+  "ld3d_z_p_bi_contiguous",
+  "ld3d_z_p_br_contiguous",
+  "stnt1w_z_p_bi_contiguous",
+  "st1w_z_p_bz_d_x32_unscaled",
+  "st3w_z_p_bi_contiguous",
+  "st1w_z_p_bz_s_x32_unscaled",
+  "stnt1d_z_p_bi_contiguous",
+  "st1d_z_p_bz_d_x32_unscaled",
+  "st3d_z_p_bi_contiguous",
+  "uzp1_p_pp",
+  "ld1_asisdlsep_r2_r2",
+  "ld1_asisdlsep_i2_i2",
+  "umlal_asimddiff_l",
+  "sub_asimdsame_only",
+  "cmeq_asimdsame_only",
+  "mls_asimdsame_only",
+  "pmul_asimdsame_only",
+  "umlsl_asimddiff_l",
+  "umaxp_asimdsame_only",
+  "uminp_asimdsame_only",
+  "sqrdmulh_asimdsame_only",
+  "sqxtnt_z_zz",
+  "bcax_vvv16_crypto4",
+  "udf_only_perm_undef",
+  "st3_asisdlsop_d3_i3d",
+  "strb_32_ldst_pos",
+  "ldrb_32_ldst_pos",
+  "ldrsb_64_ldst_pos",
+  "ldrsb_32_ldst_pos",
+  "strh_32_ldst_pos",
+  "ldrh_32_ldst_pos",
+  "ldrsh_64_ldst_pos",
+  "ldrsh_32_ldst_pos",
+  "usra_asimdshf_r",
+  "ursra_asimdshf_r",
+  "and_32_log_imm",
+  "movn_32_movewide",
+  "eor_32_log_imm",
+  "movz_32_movewide",
+  "gmi_64g_dp_2src",
+  "lsrv_64_dp_2src",
+  "sbfm_64m_bitfield",
+  "ubfm_64m_bitfield",
+  "saddlp_asimdmisc_p",
+  "xtn_asimdmisc_n",
+  "cmphs_p_p_zw",
+  "cmphi_p_p_zw",
+  "cmplo_p_p_zw",
+  "cmpls_p_p_zw",
+  "trn1_p_pp",
+  "incp_z_p_z",
+  "incp_r_p_r",
+  "fcvtnu_asisdmiscfp16_r",
+  "fcvtnu_asisdmisc_r",
+  "fcvtpu_asisdmiscfp16_r",
+  "fcvtpu_asisdmisc_r",
+  "fmov_s_floatdp1",
+  "fneg_s_floatdp1",
+  "frintn_s_floatdp1",
+  "frintm_s_floatdp1",
+  "frinta_s_floatdp1",
+  "frintx_s_floatdp1",
+  "frint32z_s_floatdp1",
+  "frint64z_s_floatdp1",
+  "cmpge_p_p_zi",
+  "cmpgt_p_p_zi",
+  "fadd_z_p_zs",
+  "fsub_z_p_zs",
+  "fmul_z_p_zs",
+  "fsubr_z_p_zs",
+  "fmaxnm_z_p_zs",
+  "fminnm_z_p_zs",
+  "fmax_z_p_zs",
+  "fmin_z_p_zs",
+  "st3_asisdlso_b3_3b",
+  "movi_asimdimm_l_hl",
+  "fcmge_p_p_zz",
+  "fcmgt_p_p_zz",
+  "fcmeq_p_p_zz",
+  "fcmne_p_p_zz",
+  "sqshrunb_z_zi",
+  "sqshrunt_z_zi",
+  "sqrshrunb_z_zi",
+  "sqrshrunt_z_zi",
+  "shrnb_z_zi",
+  "shrnt_z_zi",
+  "rshrnb_z_zi",
+  "rshrnt_z_zi",
+  "eret_64e_branch_reg",
+  "smaddl_64wa_dp_3src",
+  "umaddl_64wa_dp_3src",
+  "orr_64_log_shift",
+  "ands_64_log_shift",
+  "cpyp_cpy_memcms",
+  "cpypwt_cpy_memcms",
+  "cpyprt_cpy_memcms",
+  "cpypt_cpy_memcms",
+  "cpym_cpy_memcms",
+  "cpymwt_cpy_memcms",
+  "cpymrt_cpy_memcms",
+  "cpymt_cpy_memcms",
+  "cpye_cpy_memcms",
+  "cpyewt_cpy_memcms",
+  "cpyert_cpy_memcms",
+  "cpyet_cpy_memcms",
+  "setgp_set_memcms",
+  "setgpt_set_memcms",
+  "setgpn_set_memcms",
+  "setgptn_set_memcms",
+  "and_asimdsame_only",
+  "bic_asimdsame_only",
+  "orr_asimdsame_only",
+  "orn_asimdsame_only",
+  "st1_asisdlsop_bx1_r1b",
+  "st1_asisdlsop_b1_i1b",
+  "fcmeq_asimdsame_only",
+  "sm4ekey_z_zz",
+  "rax1_z_zz",
+  "facge_p_p_zz",
+  "facgt_p_p_zz",
+  "movprfx_z_z",
+  "ushl_asisdsame_only",
+  "uqshl_asisdsame_only",
+  "urshl_asisdsame_only",
+  "uqrshl_asisdsame_only",
+  "fmaxv_asimdall_only_h",
+  "frint64z_asimdmisc_r",
+  "fminv_asimdall_only_h",
+  "fabs_asimdmiscfp16_r",
+  "fabs_asimdmisc_r",
+  "smmla_asimdsame2_g",
+  "usmmla_asimdsame2_g",
+  "usdot_asimdsame2_d",
+  "sdot_asimdsame2_d",
+  "sqdmull_asisddiff_only",
+  "umullb_z_zzi_s",
+  "umullb_z_zzi_d",
+  "bfdot_z_zzz",
+  "fmlalb_z_zzz",
+  "fmlalt_z_zzz",
+  "bfmlalb_z_zzz",
+  "bfmlalt_z_zzz",
+  "fccmp_s_floatccmp",
+  "fccmpe_s_floatccmp",
+  "fccmp_d_floatccmp",
+  "fccmpe_d_floatccmp",
+  "fccmp_h_floatccmp",
+  "fccmpe_h_floatccmp",
+  "st3_asisdlso_d3_3d",
+  "swpa_32_memop",
+  "swpal_32_memop",
+  "adds_32s_addsub_ext",
+  "subs_32s_addsub_ext",
+  "rev64_asimdmisc_r",
+  "and_64_log_shift",
+  "eor_64_log_shift",
+  "umullt_z_zzi_s",
+  "umullt_z_zzi_d",
+  "fcvtns_asisdmiscfp16_r",
+  "fcvtms_asisdmiscfp16_r",
+  "fcvtns_asisdmisc_r",
+  "fcvtms_asisdmisc_r",
+  "fcvtps_asisdmiscfp16_r",
+  "fcvtzs_asisdmiscfp16_r",
+  "fcvtps_asisdmisc_r",
+  "fcvtzs_asisdmisc_r",
+  "cmgt_asisdmisc_z",
+  "cmeq_asisdmisc_z",
+  "cmlt_asisdmisc_z",
+  "abs_asisdmisc_r",
+  "addp_asisdpair_only",
+  "fcadd_z_p_zz",
+  "faddp_z_p_zz",
+  "fmaxnmp_z_p_zz",
+  "fminnmp_z_p_zz",
+  "fmaxp_z_p_zz",
+  "fminp_z_p_zz",
+  "fmaxnmv_asimdall_only_h",
+  "fcvtas_asimdmiscfp16_r",
+  "fcvtas_asimdmisc_r",
+  "fminnmv_asimdall_only_h",
+  "fcmgt_asimdmiscfp16_fz",
+  "fcmgt_asimdmisc_fz",
+  "urecpe_asimdmisc_r",
+  "st2_asisdlso_s2_2s",
+  "stnp_64_ldstnapair_offs",
+  "ldnp_64_ldstnapair_offs",
+  "stp_64_ldstpair_post",
+  "ldp_64_ldstpair_post",
+  "ins_asimdins_ir_r",
+  "fmulx_asimdsamefp16_only",
+  "nors_p_p_pp_z",
+  "nands_p_p_pp_z",
+  "st2_asisdlsop_h2_i2h",
+  "ld1rqb_z_p_bi_u8",
+  "ld1rqb_z_p_br_contiguous",
+  "ld1rqh_z_p_bi_u16",
+  "ld1rqh_z_p_br_contiguous",
+  "stnt1b_z_p_ar_d_64_unscaled",
+  "stnt1b_z_p_ar_s_x32_unscaled",
+  "stnt1h_z_p_ar_d_64_unscaled",
+  "stnt1h_z_p_ar_s_x32_unscaled",
+  "smullb_z_zzi_s",
+  "smullb_z_zzi_d",
+  "fcvtzu_asisdshf_c",
+  "sqrdmlah_asisdelem_r",
+  "sqrdmlsh_asisdelem_r",
+  "mvni_asimdimm_l_sl",
+  "ushr_asimdshf_r",
+  "urshr_asimdshf_r",
+  "facge_asimdsame_only",
+  "facgt_asimdsame_only",
+  "lsrv_32_dp_2src",
+  "fcvtmu_asimdmiscfp16_r",
+  "fcvtmu_asimdmisc_r",
+  "fcvtzu_asimdmiscfp16_r",
+  "fcvtzu_asimdmisc_r",
+  "neg_asimdmisc_r",
+  "ldaprb_32l_memop",
+  "ldaprh_32l_memop",
+  "braa_64p_branch_reg",
+  "brab_64p_branch_reg",
+  "st1_asisdlse_r1_1v",
+  "sbcs_32_addsub_carry",
+  "fmulx_asimdelem_rh_h",
+  "fmulx_asimdelem_r_sd",
+  "sudot_asimdelem_d",
+  "bfdot_asimdelem_e",
+  "scvtf_asimdshf_c",
+  "fcvtzs_asimdshf_c",
+  "usdot_asimdelem_d",
+  "bfmlal_asimdelem_f",
+  "sqdmulh_asimdelem_r",
+  "sqrdmulh_asimdelem_r",
+  "sdot_asimdelem_d",
+  "ext_asimdext_only",
+  "cpyfprn_cpy_memcms",
+  "cpyfpwtrn_cpy_memcms",
+  "cpyfprtrn_cpy_memcms",
+  "cpyfptrn_cpy_memcms",
+  "cpyfmrn_cpy_memcms",
+  "cpyfmwtrn_cpy_memcms",
+  "cpyfmrtrn_cpy_memcms",
+  "cpyfmtrn_cpy_memcms",
+  "cpyfern_cpy_memcms",
+  "cpyfewtrn_cpy_memcms",
+  "cpyfertrn_cpy_memcms",
+  "cpyfetrn_cpy_memcms",
+  "sete_set_memcms",
+  "setet_set_memcms",
+  "seten_set_memcms",
+  "setetn_set_memcms",
+  "paciza_64z_dp_1src",
+  "sqrdmlah_asisdsame2_only",
+  "sqrdmlsh_asisdsame2_only",
+  "st3_asisdlsop_s3_i3s",
+  "ldr_s_loadlit",
+  "ldr_d_loadlit",
+  "uaddlp_asimdmisc_p",
+  "sqxtun_asimdmisc_n",
+  "ld1_asisdlsop_d1_i1d",
+  "ldgm_64bulk_ldsttags",
+  "tbl_asimdtbl_l2_2",
+  "adcs_32_addsub_carry",
+  "addvl_r_ri",
+  "addpl_r_ri",
+  "rdvl_r_i",
+  "ldnt1sb_z_p_ar_s_x32_unscaled",
+  "ldnt1b_z_p_ar_s_x32_unscaled",
+  "ld1rb_z_p_bi_u8",
+  "ld1rb_z_p_bi_u16",
+  "ldnt1sh_z_p_ar_s_x32_unscaled",
+  "ldnt1h_z_p_ar_s_x32_unscaled",
+  "ld1rsw_z_p_bi_s64",
+  "ld1rh_z_p_bi_u16",
+  "ldnt1sb_z_p_ar_d_64_unscaled",
+  "ld1sb_z_p_bz_d_64_unscaled",
+  "ldff1sb_z_p_bz_d_64_unscaled",
+  "ldnt1sh_z_p_ar_d_64_unscaled",
+  "ld1sh_z_p_bz_d_64_unscaled",
+  "ldff1sh_z_p_bz_d_64_unscaled",
+  "udiv_64_dp_2src",
+  "asrv_64_dp_2src",
+  "umov_asimdins_w_w",
+  "umov_asimdins_x_x",
+  "frecps_asimdsamefp16_only",
+  "frsqrts_asimdsamefp16_only",
+  "movi_asimdimm_n_b",
+  "fmov_asimdimm_s_s",
+  "fmov_asimdimm_h_h",
+  "st1_asisdlsep_r2_r2",
+  "st1_asisdlsep_i2_i2",
+  "umlalb_z_zzzi_s",
+  "umlalt_z_zzzi_s",
+  "umlalb_z_zzzi_d",
+  "umlalt_z_zzzi_d",
+  "st1_asisdlsop_d1_i1d",
+  "st1_asisdlsep_r1_r1",
+  "st1_asisdlsep_i1_i1",
+  "fmax_s_floatdp2",
+  "fmin_s_floatdp2",
+  "fmaxnm_s_floatdp2",
+  "fminnm_s_floatdp2",
+  "fmax_d_floatdp2",
+  "fmin_d_floatdp2",
+  "fmaxnm_d_floatdp2",
+  "fminnm_d_floatdp2",
+  "fmax_h_floatdp2",
+  "fmin_h_floatdp2",
+  "fmaxnm_h_floatdp2",
+  "fminnm_h_floatdp2",
+  "ldnt1b_z_p_bi_contiguous",
+  "ldnt1b_z_p_br_contiguous",
+  "ld3b_z_p_bi_contiguous",
+  "ld3b_z_p_br_contiguous",
+  "ldnt1h_z_p_bi_contiguous",
+  "ldnt1h_z_p_br_contiguous",
+  "ld3h_z_p_bi_contiguous",
+  "ld3h_z_p_br_contiguous",
+  "stnt1b_z_p_bi_contiguous",
+  "st3b_z_p_bi_contiguous",
+  "stnt1h_z_p_bi_contiguous",
+  "st3h_z_p_bi_contiguous",
+  "cpypwn_cpy_memcms",
+  "cpypwtwn_cpy_memcms",
+  "cpyprtwn_cpy_memcms",
+  "cpyptwn_cpy_memcms",
+  "cpymwn_cpy_memcms",
+  "cpymwtwn_cpy_memcms",
+  "cpymrtwn_cpy_memcms",
+  "cpymtwn_cpy_memcms",
+  "cpyewn_cpy_memcms",
+  "cpyewtwn_cpy_memcms",
+  "cpyertwn_cpy_memcms",
+  "cpyetwn_cpy_memcms",
+  "setgm_set_memcms",
+  "setgmt_set_memcms",
+  "setgmn_set_memcms",
+  "setgmtn_set_memcms",
+  "st2_asisdlso_b2_2b",
+  "zip2_p_pp",
+  "st2_asisdlsep_r2_r",
+  "st2_asisdlsep_i2_i",
+  "fmaxnmv_v_p_z",
+  "fmaxv_v_p_z",
+  "uqxtnb_z_zz",
+  "fcmge_asisdsamefp16_only",
+  "facge_asisdsamefp16_only",
+  "fabd_asisdsamefp16_only",
+  "fcmgt_asisdsamefp16_only",
+  "facgt_asisdsamefp16_only",
+  "crc32x_64c_dp_2src",
+  "crc32cx_64c_dp_2src",
+  "wfet_only_systeminstrswithreg",
+  "ld1rqw_z_p_bi_u32",
+  "ld1rqw_z_p_br_contiguous",
+  "ld1rqd_z_p_bi_u64",
+  "ld1rqd_z_p_br_contiguous",
+  "stnt1w_z_p_ar_d_64_unscaled",
+  "stnt1w_z_p_ar_s_x32_unscaled",
+  "stnt1d_z_p_ar_d_64_unscaled",
+  "fminnmv_v_p_z",
+  "fminv_v_p_z",
+  "st1_asisdlso_b1_1b",
+  "ld2_asisdlso_d2_2d",
+  "sqincp_z_p_z",
+  "sqincp_r_p_r_sx",
+  "sqincp_r_p_r_x",
+  "cbnz_32_compbranch",
+  "ld1_asisdlsep_r1_r1",
+  "ld1_asisdlsep_i1_i1",
+  "smsubl_64wa_dp_3src",
+  "umsubl_64wa_dp_3src",
+  "smlal_asimddiff_l",
+  "add_asimdsame_only",
+  "cmtst_asimdsame_only",
+  "sqdmlal_asimddiff_l",
+  "mla_asimdsame_only",
+  "mul_asimdsame_only",
+  "smlsl_asimddiff_l",
+  "smaxp_asimdsame_only",
+  "sminp_asimdsame_only",
+  "sqdmlsl_asimddiff_l",
+  "sqdmulh_asimdsame_only",
+  "addp_asimdsame_only",
+  "cpy_z_p_i",
+  "ld4_asisdlso_s4_4s",
+  "sqdmlal_asisddiff_only",
+  "sqdmlsl_asisddiff_only",
+  "histseg_z_zz",
+  "fcvtxnt_z_p_z_d2s",
+  "fcvtnt_z_p_z_s2h",
+  "fcvtlt_z_p_z_h2s",
+  "bfcvtnt_z_p_z_s2bf",
+  "fcvtnt_z_p_z_d2s",
+  "fcvtlt_z_p_z_s2d",
+  "st4_asisdlsop_s4_i4s",
+  "ld1_asisdlso_d1_1d",
+  "fnmul_s_floatdp2",
+  "fnmul_d_floatdp2",
+  "fnmul_h_floatdp2",
+  "sqrdcmlah_z_zzzi_h",
+  "sqrdcmlah_z_zzzi_s",
+  "and_32_log_shift",
+  "eor_32_log_shift",
+  "prfb_i_p_br_s",
+  "prfb_i_p_ai_s",
+  "ld1rb_z_p_bi_u32",
+  "ld1rb_z_p_bi_u64",
+  "prfh_i_p_br_s",
+  "prfh_i_p_ai_s",
+  "ld1rh_z_p_bi_u32",
+  "ld1rh_z_p_bi_u64",
+  "ldnt1b_z_p_ar_d_64_unscaled",
+  "prfb_i_p_ai_d",
+  "ld1b_z_p_bz_d_64_unscaled",
+  "ldff1b_z_p_bz_d_64_unscaled",
+  "ldnt1h_z_p_ar_d_64_unscaled",
+  "prfh_i_p_ai_d",
+  "ld1h_z_p_bz_d_64_unscaled",
+  "ldff1h_z_p_bz_d_64_unscaled",
+  "dup_asimdins_dv_v",
+  "fmaxnm_asimdsamefp16_only",
+  "fminnm_asimdsamefp16_only",
+  "cas_c32_ldstexcl",
+  "casa_c32_ldstexcl",
+  "cas_c64_ldstexcl",
+  "casa_c64_ldstexcl",
+  "ld1sb_z_p_ai_s",
+  "ldff1sb_z_p_ai_s",
+  "ld1sh_z_p_ai_s",
+  "ldff1sh_z_p_ai_s",
+  "ld1sb_z_p_ai_d",
+  "ldff1sb_z_p_ai_d",
+  "prfb_i_p_bz_d_64_scaled",
+  "prfh_i_p_bz_d_64_scaled",
+  "ld1sh_z_p_ai_d",
+  "ldff1sh_z_p_ai_d",
+  "ld1sh_z_p_bz_d_64_scaled",
+  "ldff1sh_z_p_bz_d_64_scaled",
+  "bfm_64m_bitfield",
+  "fcmle_asisdmiscfp16_fz",
+  "frsqrte_asisdmiscfp16_r",
+  "fcmle_asisdmisc_fz",
+  "frsqrte_asisdmisc_r",
+  "stxrb_sr32_ldstexcl",
+  "ldxrb_lr32_ldstexcl",
+  "stllrb_sl32_ldstexcl",
+  "ldlarb_lr32_ldstexcl",
+  "stxrh_sr32_ldstexcl",
+  "ldxrh_lr32_ldstexcl",
+  "stllrh_sl32_ldstexcl",
+  "ldlarh_lr32_ldstexcl",
+  "stp_32_ldstpair_off",
+  "ldp_32_ldstpair_off",
+  "stp_32_ldstpair_pre",
+  "ldp_32_ldstpair_pre",
+  "stgp_64_ldstpair_off",
+  "ldpsw_64_ldstpair_off",
+  "stgp_64_ldstpair_pre",
+  "ldpsw_64_ldstpair_pre",
+  "wfit_only_systeminstrswithreg",
+  "stp_s_ldstpair_off",
+  "ldp_s_ldstpair_off",
+  "stp_s_ldstpair_pre",
+  "ldp_s_ldstpair_pre",
+  "stp_d_ldstpair_off",
+  "ldp_d_ldstpair_off",
+  "stp_d_ldstpair_pre",
+  "ldp_d_ldstpair_pre",
+  "st4_asisdlse_r4",
+  "st2_asisdlso_h2_2h",
+  "stnp_32_ldstnapair_offs",
+  "ldnp_32_ldstnapair_offs",
+  "stp_32_ldstpair_post",
+  "ldp_32_ldstpair_post",
+  "stgp_64_ldstpair_post",
+  "ldpsw_64_ldstpair_post",
+  "histcnt_z_p_zz",
+  "add_32_addsub_imm",
+  "sub_32_addsub_imm",
+  "saddwb_z_zz",
+  "saddwt_z_zz",
+  "uaddwb_z_zz",
+  "uaddwt_z_zz",
+  "ssubwb_z_zz",
+  "ssubwt_z_zz",
+  "usubwb_z_zz",
+  "usubwt_z_zz",
+  "sqdmullb_z_zz",
+  "sqdmullt_z_zz",
+  "pmullb_z_zz",
+  "pmullt_z_zz",
+  "smullb_z_zz",
+  "smullt_z_zz",
+  "umullb_z_zz",
+  "umullt_z_zz",
+  "fcvtns_32s_float2int",
+  "fcvtnu_32s_float2int",
+  "scvtf_s32_float2int",
+  "ucvtf_s32_float2int",
+  "fcvtas_32s_float2int",
+  "fcvtau_32s_float2int",
+  "fmov_32s_float2int",
+  "fmov_s32_float2int",
+  "fcvtps_32s_float2int",
+  "fcvtpu_32s_float2int",
+  "fcvtms_32s_float2int",
+  "fcvtmu_32s_float2int",
+  "fcvtzs_32s_float2int",
+  "fcvtzu_32s_float2int",
+  "str_32_ldst_pos",
+  "ldr_32_ldst_pos",
+  "ldrsw_64_ldst_pos",
+  "str_64_ldst_pos",
+  "ldr_64_ldst_pos",
+  "prfm_p_ldst_pos",
+  "and_64_log_imm",
+  "movn_64_movewide",
+  "eor_64_log_imm",
+  "movz_64_movewide",
+  "frintx_asimdmiscfp16_r",
+  "frintx_asimdmisc_r",
+  "frinti_asimdmiscfp16_r",
+  "frinti_asimdmisc_r",
+  "cmle_asimdmisc_z",
+  "faddp_asimdsame_only",
+  "fabd_asimdsame_only",
+  "fadda_v_p_z",
+  "add_64_addsub_imm",
+  "addg_64_addsub_immtags",
+  "sub_64_addsub_imm",
+  "subg_64_addsub_immtags",
+  "swpb_32_memop",
+  "swplb_32_memop",
+  "swpab_32_memop",
+  "swpalb_32_memop",
+  "swph_32_memop",
+  "swplh_32_memop",
+  "swpah_32_memop",
+  "swpalh_32_memop",
+  "blr_64_branch_reg",
+  "ands_p_p_pp_z",
+  "bics_p_p_pp_z",
+  "ext_z_zi_des",
+  "ext_z_zi_con",
+  "zip1_z_zz_q",
+  "zip2_z_zz_q",
+  "uzp1_z_zz_q",
+  "uzp2_z_zz_q",
+  "trn1_z_zz_q",
+  "trn2_z_zz_q",
+  "adcs_64_addsub_carry",
+  "fabs_h_floatdp1",
+  "fsqrt_h_floatdp1",
+  "fcvt_dh_floatdp1",
+  "frintp_h_floatdp1",
+  "frintz_h_floatdp1",
+  "frinti_h_floatdp1",
+  "fmaxnmp_asimdsamefp16_only",
+  "faddp_asimdsamefp16_only",
+  "fmul_asimdsamefp16_only",
+  "fcmge_asimdsamefp16_only",
+  "facge_asimdsamefp16_only",
+  "fmaxp_asimdsamefp16_only",
+  "fdiv_asimdsamefp16_only",
+  "st2_asisdlso_d2_2d",
+  "tstart_br_systemresult",
+  "ttest_br_systemresult",
+  "bfmmla_z_zzz",
+  "fmmla_z_zzz_s",
+  "fmmla_z_zzz_d",
+  "st4_asisdlsop_bx4_r4b",
+  "stp_64_ldstpair_off",
+  "ldp_64_ldstpair_off",
+  "stp_64_ldstpair_pre",
+  "ldp_64_ldstpair_pre",
+  "smullt_z_zzi_s",
+  "smullt_z_zzi_d",
+  "and_p_p_pp_z",
+  "bic_p_p_pp_z",
+  "uzp1_asimdperm_only",
+  "trn1_asimdperm_only",
+  "zip1_asimdperm_only",
+  "brabz_64_branch_reg",
+  "st4_asisdlsop_b4_i4b",
+  "fadd_asimdsamefp16_only",
+  "fsub_asimdsamefp16_only",
+  "sri_z_zzi",
+  "sli_z_zzi",
+  "madd_64a_dp_3src",
+  "smulh_64_dp_3src",
+  "umulh_64_dp_3src",
+  "frsqrte_z_z",
+  "sqshl_asisdsame_only",
+  "sqrshl_asisdsame_only",
+  "cmpeq_p_p_zi",
+  "cmpne_p_p_zi",
+  "str_s_ldst_regoff",
+  "ldr_s_ldst_regoff",
+  "str_d_ldst_regoff",
+  "ldr_d_ldst_regoff",
+  "stur_s_ldst_unscaled",
+  "str_s_ldst_immpost",
+  "str_s_ldst_immpre",
+  "ldur_s_ldst_unscaled",
+  "ldr_s_ldst_immpost",
+  "ldr_s_ldst_immpre",
+  "stur_d_ldst_unscaled",
+  "str_d_ldst_immpost",
+  "str_d_ldst_immpre",
+  "ldur_d_ldst_unscaled",
+  "ldr_d_ldst_immpost",
+  "ldr_d_ldst_immpre",
+  "st4_asisdlsop_h4_i4h",
+  "caspl_cp32_ldstexcl",
+  "caspal_cp32_ldstexcl",
+  "caslb_c32_ldstexcl",
+  "casalb_c32_ldstexcl",
+  "caspl_cp64_ldstexcl",
+  "caspal_cp64_ldstexcl",
+  "caslh_c32_ldstexcl",
+  "casalh_c32_ldstexcl",
+  "autizb_64z_dp_1src",
+  "brkb_p_p_p",
+  "orr_32_log_imm",
+  "ands_32s_log_imm",
+  "movk_32_movewide",
+  "orr_p_p_pp_z",
+  "orn_p_p_pp_z",
+  "fadd_z_zz",
+  "fsub_z_zz",
+  "fmul_z_zz",
+  "ftsmul_z_zz",
+  "frecps_z_zz",
+  "frsqrts_z_zz",
+  "autdza_64z_dp_1src",
+  "prfb_i_p_bz_s_x32_scaled",
+  "prfh_i_p_bz_s_x32_scaled",
+  "ld1sh_z_p_bz_s_x32_scaled",
+  "ldff1sh_z_p_bz_s_x32_scaled",
+  "prfb_i_p_bz_d_x32_scaled",
+  "prfh_i_p_bz_d_x32_scaled",
+  "ld1sh_z_p_bz_d_x32_scaled",
+  "ldff1sh_z_p_bz_d_x32_scaled",
+  "mla_z_p_zzz",
+  "mls_z_p_zzz",
+  "usdot_z_zzz_s",
+  "smlalb_z_zzz",
+  "smlalt_z_zzz",
+  "umlalb_z_zzz",
+  "umlalt_z_zzz",
+  "smlslb_z_zzz",
+  "smlslt_z_zzz",
+  "umlslb_z_zzz",
+  "umlslt_z_zzz",
+  "sqdmlalb_z_zzz",
+  "sqdmlalt_z_zzz",
+  "sqdmlslb_z_zzz",
+  "sqdmlslt_z_zzz",
+  "sqrdmlah_z_zzz",
+  "sqrdmlsh_z_zzz",
+  "rdffr_p_p_f",
+  "rdffrs_p_p_f",
+  "extr_64_extract",
+  "tbl_asimdtbl_l3_3",
+  "tbx_asimdtbl_l3_3",
+  "tbl_asimdtbl_l4_4",
+  "tbx_asimdtbl_l4_4",
+  "uzp2_asimdperm_only",
+  "trn2_asimdperm_only",
+  "zip2_asimdperm_only",
+  "ld3_asisdlsop_h3_i3h",
+  "cntw_r_s",
+  "incw_r_rs",
+  "cntd_r_s",
+  "incd_r_rs",
+  "fabs_s_floatdp1",
+  "fsqrt_s_floatdp1",
+  "fcvt_ds_floatdp1",
+  "fcvt_hs_floatdp1",
+  "frintp_s_floatdp1",
+  "frintz_s_floatdp1",
+  "frinti_s_floatdp1",
+  "frint32x_s_floatdp1",
+  "frint64x_s_floatdp1",
+  "fcmp_h_floatcmp",
+  "fcmp_hz_floatcmp",
+  "fcmpe_h_floatcmp",
+  "fcmpe_hz_floatcmp",
+  "adc_32_addsub_carry",
+  "ld2_asisdlso_s2_2s",
+  "fexpa_z_z",
+  "decp_z_p_z",
+  "decp_r_p_r",
+  "st4_asisdlso_b4_4b",
+  "cbnz_64_compbranch",
+  "sel_z_p_zz",
+  "adc_64_addsub_carry",
+  "st4_asisdlsop_d4_i4d",
+  "uqdecp_z_p_z",
+  "uqdecp_r_p_r_uw",
+  "uqdecp_r_p_r_x",
+  "st64b_64l_memop",
+  "ldrsw_64_loadlit",
+  "prfm_p_loadlit",
+  "dup_z_r",
+  "insr_z_r",
+  "sunpklo_z_z",
+  "sunpkhi_z_z",
+  "uunpklo_z_z",
+  "uunpkhi_z_z",
+  "insr_z_v",
+  "rev_z_z",
+  "ld4_asisdlso_d4_4d",
+  "uqadd_asisdsame_only",
+  "uqsub_asisdsame_only",
+  "cmhi_asisdsame_only",
+  "cmhs_asisdsame_only",
+  "ucvtf_asisdmiscfp16_r",
+  "ucvtf_asisdmisc_r",
+  "faddp_asisdpair_only_sd",
+  "ld1b_z_p_ai_s",
+  "ldff1b_z_p_ai_s",
+  "ld1h_z_p_ai_s",
+  "ldff1h_z_p_ai_s",
+  "ld1b_z_p_ai_d",
+  "ldff1b_z_p_ai_d",
+  "prfw_i_p_bz_d_64_scaled",
+  "prfd_i_p_bz_d_64_scaled",
+  "ld1h_z_p_ai_d",
+  "ldff1h_z_p_ai_d",
+  "ld1h_z_p_bz_d_64_scaled",
+  "ldff1h_z_p_bz_d_64_scaled",
+  "uzp2_p_pp",
+  "ld1sh_z_p_br_s64",
+  "ldff1sh_z_p_br_s64",
+  "ld1w_z_p_br_u32",
+  "ldff1w_z_p_br_u32",
+  "ld1sb_z_p_br_s64",
+  "ldff1sb_z_p_br_s64",
+  "ld1sb_z_p_br_s16",
+  "ldff1sb_z_p_br_s16",
+  "stnt1w_z_p_br_contiguous",
+  "st3w_z_p_br_contiguous",
+  "stnt1d_z_p_br_contiguous",
+  "st3d_z_p_br_contiguous",
+  "ld4_asisdlso_h4_4h",
+  "drps_64e_branch_reg",
+  "sub_asisdsame_only",
+  "cmeq_asisdsame_only",
+  "sqrdmulh_asisdsame_only",
+  "umlslb_z_zzzi_s",
+  "umlslt_z_zzzi_s",
+  "umlslb_z_zzzi_d",
+  "umlslt_z_zzzi_d",
+  "fmaxnm_asimdsame_only",
+  "fminnm_asimdsame_only",
+  "st1_asisdlso_d1_1d",
+  "tcommit_only_barriers",
+  "dsb_bon_barriers",
+  "dmb_bo_barriers",
+  "sb_only_barriers",
+  "ld3_asisdlsep_r3_r",
+  "ld1rob_z_p_bi_u8",
+  "ld1rob_z_p_br_contiguous",
+  "ld1roh_z_p_bi_u16",
+  "ld1roh_z_p_br_contiguous",
+  "sqdmulh_z_zz",
+  "sqrdmulh_z_zz",
+  "sshl_asisdsame_only",
+  "srshl_asisdsame_only",
+  "ldapr_64l_memop",
+  "fcvtns_32d_float2int",
+  "fcvtnu_32d_float2int",
+  "scvtf_d32_float2int",
+  "ucvtf_d32_float2int",
+  "fcvtas_32d_float2int",
+  "fcvtau_32d_float2int",
+  "fcvtps_32d_float2int",
+  "fcvtpu_32d_float2int",
+  "fcvtms_32d_float2int",
+  "fcvtmu_32d_float2int",
+  "fcvtzs_32d_float2int",
+  "fcvtzu_32d_float2int",
+  "fjcvtzs_32d_float2int",
+  "adds_64_addsub_shift",
+  "subs_64_addsub_shift",
+  "sbcs_64_addsub_carry",
+  "sdot_z_zzz",
+  "udot_z_zzz",
+  "sqdmlalbt_z_zzz",
+  "sqdmlslbt_z_zzz",
+  "cdot_z_zzz",
+  "ld1w_z_p_bz_s_x32_scaled",
+  "ldff1w_z_p_bz_s_x32_scaled",
+  "ld1w_z_p_bz_d_x32_scaled",
+  "ldff1w_z_p_bz_d_x32_scaled",
+  "ld1d_z_p_bz_d_x32_scaled",
+  "ldff1d_z_p_bz_d_x32_scaled",
+  "msub_32a_dp_3src",
+  "ld1sh_z_p_bi_s64",
+  "ldnf1sh_z_p_bi_s64",
+  "ld1w_z_p_bi_u32",
+  "ldnf1w_z_p_bi_u32",
+  "ld1sb_z_p_bi_s64",
+  "ldnf1sb_z_p_bi_s64",
+  "ld1sb_z_p_bi_s16",
+  "ldnf1sb_z_p_bi_s16",
+  "st1w_z_p_bz_d_64_unscaled",
+  "st1w_z_p_ai_d",
+  "st1d_z_p_bz_d_64_unscaled",
+  "st1d_z_p_ai_d",
+  "stlxrb_sr32_ldstexcl",
+  "ldaxrb_lr32_ldstexcl",
+  "stlrb_sl32_ldstexcl",
+  "ldarb_lr32_ldstexcl",
+  "stlxrh_sr32_ldstexcl",
+  "ldaxrh_lr32_ldstexcl",
+  "stlrh_sl32_ldstexcl",
+  "ldarh_lr32_ldstexcl",
+  "casp_cp32_ldstexcl",
+  "caspa_cp32_ldstexcl",
+  "casb_c32_ldstexcl",
+  "casab_c32_ldstexcl",
+  "casp_cp64_ldstexcl",
+  "caspa_cp64_ldstexcl",
+  "cash_c32_ldstexcl",
+  "casah_c32_ldstexcl",
+  "frecps_asimdsame_only",
+  "frsqrts_asimdsame_only",
+  "autdzb_64z_dp_1src",
+  "sqshrnb_z_zi",
+  "sqshrnt_z_zi",
+  "sqrshrnb_z_zi",
+  "sqrshrnt_z_zi",
+  "uqshrnb_z_zi",
+  "uqshrnt_z_zi",
+  "uqrshrnb_z_zi",
+  "uqrshrnt_z_zi",
+  "frintm_asimdmiscfp16_r",
+  "frintm_asimdmisc_r",
+  "frintz_asimdmiscfp16_r",
+  "frintz_asimdmisc_r",
+  "cmeq_asimdmisc_z",
+  "fmul_z_zzi_h",
+  "fmul_z_zzi_s",
+  "fmul_z_zzi_d",
+  "sha512su0_vv2_cryptosha512_2",
+  "sm4e_vv4_cryptosha512_2",
+  "fmlal2_asimdsame_f",
+  "fmlsl2_asimdsame_f",
+  "adr_z_az_d_s32_scaled",
+  "adr_z_az_d_u32_scaled",
+  "adr_z_az_sd_same_scaled",
+  "smmla_z_zzz",
+  "sshllb_z_zi",
+  "sshllt_z_zi",
+  "ushllb_z_zi",
+  "ushllt_z_zi",
+  "usmmla_z_zzz",
+  "ummla_z_zzz",
+  "saddlbt_z_zz",
+  "ssublbt_z_zz",
+  "ssubltb_z_zz",
+  "eorbt_z_zz",
+  "eortb_z_zz",
+  "bext_z_zz",
+  "bdep_z_zz",
+  "bgrp_z_zz",
+  "orrs_p_p_pp_z",
+  "orns_p_p_pp_z",
+  "aesmc_z_z",
+  "aese_z_zz",
+  "sm4e_z_zz",
+  "prfw_i_p_br_s",
+  "prfw_i_p_ai_s",
+  "prfd_i_p_br_s",
+  "prfd_i_p_ai_s",
+  "ldnt1w_z_p_ar_d_64_unscaled",
+  "prfw_i_p_ai_d",
+  "ld1w_z_p_bz_d_64_unscaled",
+  "ldff1w_z_p_bz_d_64_unscaled",
+  "ldnt1d_z_p_ar_d_64_unscaled",
+  "prfd_i_p_ai_d",
+  "ld1d_z_p_bz_d_64_unscaled",
+  "ldff1d_z_p_bz_d_64_unscaled",
+  "cmphs_p_p_zz",
+  "cmphi_p_p_zz",
+  "cmpeq_p_p_zw",
+  "cmpne_p_p_zw",
+  "eors_p_p_pp_z",
+  "sqxtun_asisdmisc_n",
+  "ummla_asimdsame2_g",
+  "sqrdmlah_asimdsame2_only",
+  "sqrdmlsh_asimdsame2_only",
+  "udot_asimdsame2_d",
+  "ld1_asisdlso_b1_1b",
+  "pnext_p_p_p",
+  "extr_32_extract",
+  "fcvtx_z_p_z_d2s",
+  "flogb_z_p_z",
+  "scvtf_z_p_z_h2fp16",
+  "ucvtf_z_p_z_h2fp16",
+  "scvtf_z_p_z_w2fp16",
+  "ucvtf_z_p_z_w2fp16",
+  "scvtf_z_p_z_x2fp16",
+  "ucvtf_z_p_z_x2fp16",
+  "fcvtzs_z_p_z_fp162h",
+  "fcvtzu_z_p_z_fp162h",
+  "fcvtzs_z_p_z_fp162w",
+  "fcvtzu_z_p_z_fp162w",
+  "fcvtzs_z_p_z_fp162x",
+  "fcvtzu_z_p_z_fp162x",
+  "fcvt_z_p_z_s2h",
+  "fcvt_z_p_z_h2s",
+  "bfcvt_z_p_z_s2bf",
+  "scvtf_z_p_z_w2s",
+  "ucvtf_z_p_z_w2s",
+  "fcvtzs_z_p_z_s2w",
+  "fcvtzu_z_p_z_s2w",
+  "fcvt_z_p_z_d2h",
+  "fcvt_z_p_z_h2d",
+  "fcvt_z_p_z_d2s",
+  "fcvt_z_p_z_s2d",
+  "scvtf_z_p_z_w2d",
+  "ucvtf_z_p_z_w2d",
+  "scvtf_z_p_z_x2s",
+  "ucvtf_z_p_z_x2s",
+  "scvtf_z_p_z_x2d",
+  "ucvtf_z_p_z_x2d",
+  "fcvtzs_z_p_z_d2w",
+  "fcvtzu_z_p_z_d2w",
+  "fcvtzs_z_p_z_s2x",
+  "fcvtzu_z_p_z_s2x",
+  "fcvtzs_z_p_z_d2x",
+  "fcvtzu_z_p_z_d2x",
+  "frintn_z_p_z",
+  "frintp_z_p_z",
+  "frintm_z_p_z",
+  "frintz_z_p_z",
+  "frinta_z_p_z",
+  "frintx_z_p_z",
+  "frinti_z_p_z",
+  "frecpx_z_p_z",
+  "fsqrt_z_p_z",
+  "sqdmulh_z_zzi_h",
+  "mul_z_zzi_h",
+  "adclb_z_zzz",
+  "adclt_z_zzz",
+  "sbclb_z_zzz",
+  "sbclt_z_zzz",
+  "faddv_v_p_z",
+  "st3_asisdlse_r3",
+  "swp_64_memop",
+  "st64bv0_64_memop",
+  "st64bv_64_memop",
+  "swpl_64_memop",
+  "stnp_q_ldstnapair_offs",
+  "ldnp_q_ldstnapair_offs",
+  "stp_q_ldstpair_post",
+  "ldp_q_ldstpair_post",
+  "ldaddb_32_memop",
+  "ldclrb_32_memop",
+  "ldeorb_32_memop",
+  "ldsetb_32_memop",
+  "ldaddlb_32_memop",
+  "ldclrlb_32_memop",
+  "ldeorlb_32_memop",
+  "ldsetlb_32_memop",
+  "ldaddab_32_memop",
+  "ldclrab_32_memop",
+  "ldeorab_32_memop",
+  "ldsetab_32_memop",
+  "ldaddalb_32_memop",
+  "ldclralb_32_memop",
+  "ldeoralb_32_memop",
+  "ldsetalb_32_memop",
+  "ldaddh_32_memop",
+  "ldclrh_32_memop",
+  "ldeorh_32_memop",
+  "ldseth_32_memop",
+  "ldaddlh_32_memop",
+  "ldclrlh_32_memop",
+  "ldeorlh_32_memop",
+  "ldsetlh_32_memop",
+  "ldaddah_32_memop",
+  "ldclrah_32_memop",
+  "ldeorah_32_memop",
+  "ldsetah_32_memop",
+  "ldaddalh_32_memop",
+  "ldclralh_32_memop",
+  "ldeoralh_32_memop",
+  "ldsetalh_32_memop",
+  "wrffr_f_p",
+  "ld1sw_z_p_bz_d_x32_unscaled",
+  "ldff1sw_z_p_bz_d_x32_unscaled",
+  "sbc_32_addsub_carry",
+  "trn2_p_pp",
+  "uqincw_r_rs_uw",
+  "uqdecw_r_rs_uw",
+  "uqincw_r_rs_x",
+  "uqdecw_r_rs_x",
+  "uqincd_r_rs_uw",
+  "uqdecd_r_rs_uw",
+  "uqincd_r_rs_x",
+  "uqdecd_r_rs_x",
+  "st1_asisdlse_r3_3v",
+  "fmad_z_p_zzz",
+  "fmsb_z_p_zzz",
+  "sqincb_r_rs_sx",
+  "sqdecb_r_rs_sx",
+  "sqincb_r_rs_x",
+  "sqdecb_r_rs_x",
+  "sqinch_r_rs_sx",
+  "sqdech_r_rs_sx",
+  "sqinch_r_rs_x",
+  "sqdech_r_rs_x",
+  "fcmeq_asisdsame_only",
+  "sha256h_qqv_cryptosha3",
+  "sha256h2_qqv_cryptosha3",
+  "sha256su1_vvv_cryptosha3",
+  "sturb_32_ldst_unscaled",
+  "strb_32_ldst_immpost",
+  "sttrb_32_ldst_unpriv",
+  "strb_32_ldst_immpre",
+  "ldurb_32_ldst_unscaled",
+  "ldrb_32_ldst_immpost",
+  "ldtrb_32_ldst_unpriv",
+  "ldrb_32_ldst_immpre",
+  "ldursb_64_ldst_unscaled",
+  "ldrsb_64_ldst_immpost",
+  "ldtrsb_64_ldst_unpriv",
+  "ldrsb_64_ldst_immpre",
+  "ldursb_32_ldst_unscaled",
+  "ldrsb_32_ldst_immpost",
+  "ldtrsb_32_ldst_unpriv",
+  "ldrsb_32_ldst_immpre",
+  "sturh_32_ldst_unscaled",
+  "strh_32_ldst_immpost",
+  "sttrh_32_ldst_unpriv",
+  "strh_32_ldst_immpre",
+  "ldurh_32_ldst_unscaled",
+  "ldrh_32_ldst_immpost",
+  "ldtrh_32_ldst_unpriv",
+  "ldrh_32_ldst_immpre",
+  "ldursh_64_ldst_unscaled",
+  "ldrsh_64_ldst_immpost",
+  "ldtrsh_64_ldst_unpriv",
+  "ldrsh_64_ldst_immpre",
+  "ldursh_32_ldst_unscaled",
+  "ldrsh_32_ldst_immpost",
+  "ldtrsh_32_ldst_unpriv",
+  "ldrsh_32_ldst_immpre",
+  "ld1sw_z_p_ai_d",
+  "ldff1sw_z_p_ai_d",
+  "ld1sw_z_p_bz_d_64_scaled",
+  "ldff1sw_z_p_bz_d_64_scaled",
+  "cpy_z_o_i",
+  "cbz_64_compbranch",
+  "tbz_only_testbranch",
+  "frint32x_asimdmisc_r",
+  "ld3_asisdlsep_i3_i",
+  "sha1c_qsv_cryptosha3",
+  "dup_asisdone_only",
+  "sha1p_qsv_cryptosha3",
+  "sha1m_qsv_cryptosha3",
+  "sha1su0_vvv_cryptosha3",
+  "fmulx_asisdsamefp16_only",
+  "fcmeq_asisdsamefp16_only",
+  "frecps_asisdsamefp16_only",
+  "frsqrts_asisdsamefp16_only",
+  "pmul_z_zz",
+  "mul_z_zz",
+  "smulh_z_zz",
+  "umulh_z_zz",
+  "adr_only_pcreladdr",
+  "adrp_only_pcreladdr",
+};
+
+// The decode table, as {base, mask, shift, type}. See DecodeTableEntry.
+static const DecodeTableEntry kDecodeTable[] = {
+  {15739, 0x1, 31, 1}, {0, 0x0, 0, 0}, {1698, 0x0, 0, 0},
+  {1257, 0x0, 0, 0}, {1258, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {1259, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {1260, 0x0, 0, 0},
+  {1261, 0x0, 0, 0}, {1262, 0x0, 0, 0}, {1263, 0x0, 0, 0},
+  {1264, 0x0, 0, 0}, {1265, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {1266, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {1267, 0x0, 0, 0}, {1268, 0x0, 0, 0}, {1269, 0x0, 0, 0},
+  {1270, 0x0, 0, 0}, {1271, 0x0, 0, 0}, {1272, 0x0, 0, 0},
+  {1273, 0x0, 0, 0}, {1274, 0x0, 0, 0}, {1275, 0x0, 0, 0},
+  {1276, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {390, 0x0, 0, 0},
+  {391, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {392, 0x0, 0, 0}, {393, 0x0, 0, 0},
+  {394, 0x0, 0, 0}, {395, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {396, 0x0, 0, 0}, {396, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {397, 0x0, 0, 0},
+  {398, 0x0, 0, 0}, {399, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {2464, 0x0, 0, 0}, {2465, 0x0, 0, 0},
+  {2466, 0x0, 0, 0}, {2467, 0x0, 0, 0}, {2468, 0x0, 0, 0},
+  {2468, 0x0, 0, 0}, {2468, 0x0, 0, 0}, {2468, 0x0, 0, 0},
+  {513, 0x0, 0, 0}, {514, 0x0, 0, 0}, {79, 0x1, 13, 1},
+  {81, 0x1, 13, 1}, {3, 0x1f, 16, 1}, {35, 0x1f, 16, 1},
+  {67, 0x7, 10, 1}, {75, 0x1, 12, 1}, {85, 0x3, 22, 1},
+  {105, 0x3, 22, 1}, {89, 0xf, 10, 1}, {89, 0xf, 10, 1},
+  {89, 0xf, 10, 1}, {89, 0xf, 10, 1}, {2320, 0x0, 0, 0},
+  {2320, 0x0, 0, 0}, {2320, 0x0, 0, 0}, {2320, 0x0, 0, 0},
+  {2320, 0x0, 0, 0}, {2320, 0x0, 0, 0}, {2320, 0x0, 0, 0},
+  {2320, 0x0, 0, 0}, {2321, 0x0, 0, 0}, {2321, 0x0, 0, 0},
+  {2321, 0x0, 0, 0}, {2321, 0x0, 0, 0}, {2321, 0x0, 0, 0},
+  {2321, 0x0, 0, 0}, {2321, 0x0, 0, 0}, {2321, 0x0, 0, 0},
+  {109, 0xf, 10, 1}, {109, 0xf, 10, 1}, {125, 0xf, 10, 1},
+  {109, 0xf, 10, 1}, {2323, 0x0, 0, 0}, {2324, 0x0, 0, 0},
+  {2325, 0x0, 0, 0}, {2326, 0x0, 0, 0}, {2327, 0x0, 0, 0},
+  {2328, 0x0, 0, 0}, {2329, 0x0, 0, 0}, {2330, 0x0, 0, 0},
+  {2331, 0x0, 0, 0}, {2332, 0x0, 0, 0}, {2333, 0x0, 0, 0},
+  {2334, 0x0, 0, 0}, {2335, 0x0, 0, 0}, {2336, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {2323, 0x0, 0, 0},
+  {2324, 0x0, 0, 0}, {2325, 0x0, 0, 0}, {2326, 0x0, 0, 0},
+  {2327, 0x0, 0, 0}, {2328, 0x0, 0, 0}, {2329, 0x0, 0, 0},
+  {2330, 0x0, 0, 0}, {2331, 0x0, 0, 0}, {2332, 0x0, 0, 0},
+  {2333, 0x0, 0, 0}, {2334, 0x0, 0, 0}, {2335, 0x0, 0, 0},
+  {2336, 0x0, 0, 0}, {2322, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {143, 0x1f, 16, 1}, {223, 0x1f, 16, 1}, {175, 0x1, 13, 1},
+  {177, 0x1, 13, 1}, {0, 0x0, 0, 0}, {179, 0x1, 13, 1},
+  {181, 0x1, 13, 1}, {0, 0x0, 0, 0}, {183, 0x1, 13, 1},
+  {185, 0x1, 13, 1}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {187, 0x1, 13, 1},
+  {189, 0x1, 13, 1}, {0, 0x0, 0, 0}, {191, 0x1, 13, 1},
+  {193, 0x1, 13, 1}, {195, 0x1, 13, 1}, {197, 0x1, 13, 1},
+  {199, 0x1, 13, 1}, {201, 0x1, 13, 1}, {203, 0x1, 13, 1},
+  {205, 0x1, 13, 1}, {207, 0x1, 13, 1}, {209, 0x1, 13, 1},
+  {211, 0x1, 13, 1}, {213, 0x1, 13, 1}, {215, 0x1, 13, 1},
+  {217, 0x1, 13, 1}, {219, 0x1, 13, 1}, {221, 0x1, 13, 1},
+  {0, 0x0, 0, 0}, {1382, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {1383, 0x0, 0, 0}, {0, 0x0, 0, 0}, {1384, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {1385, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {1386, 0x0, 0, 0}, {0, 0x0, 0, 0}, {1387, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {1388, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {1389, 0x0, 0, 0}, {0, 0x0, 0, 0}, {1390, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {1391, 0x0, 0, 0}, {1392, 0x0, 0, 0},
+  {1393, 0x0, 0, 0}, {1394, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {1395, 0x0, 0, 0}, {1396, 0x0, 0, 0}, {1397, 0x0, 0, 0},
+  {1398, 0x0, 0, 0}, {1399, 0x0, 0, 0}, {1400, 0x0, 0, 0},
+  {1401, 0x0, 0, 0}, {0, 0x0, 0, 0}, {1402, 0x0, 0, 0},
+  {1403, 0x0, 0, 0}, {1404, 0x0, 0, 0}, {1405, 0x0, 0, 0},
+  {1406, 0x0, 0, 0}, {1407, 0x0, 0, 0}, {1408, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {1409, 0x0, 0, 0}, {1410, 0x0, 0, 0},
+  {1411, 0x0, 0, 0}, {0, 0x0, 0, 0}, {1412, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {1413, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {1414, 0x0, 0, 0}, {255, 0x1, 13, 1}, {257, 0x1, 13, 1},
+  {259, 0x1, 13, 1}, {261, 0x1, 13, 1}, {263, 0x1, 13, 1},
+  {265, 0x1, 13, 1}, {267, 0x1, 13, 1}, {269, 0x1, 13, 1},
+  {271, 0x1, 13, 1}, {273, 0x1, 13, 1}, {275, 0x1, 13, 1},
+  {277, 0x1, 13, 1}, {279, 0x1, 13, 1}, {281, 0x1, 13, 1},
+  {283, 0x1, 13, 1}, {285, 0x1, 13, 1}, {287, 0x1, 13, 1},
+  {289, 0x1, 13, 1}, {291, 0x1, 13, 1}, {293, 0x1, 13, 1},
+  {295, 0x1, 13, 1}, {297, 0x1, 13, 1}, {299, 0x1, 13, 1},
+  {301, 0x1, 13, 1}, {303, 0x1, 13, 1}, {305, 0x1, 13, 1},
+  {307, 0x1, 13, 1}, {309, 0x1, 13, 1}, {311, 0x1, 13, 1},
+  {313, 0x1, 13, 1}, {315, 0x1, 13, 1}, {317, 0x1, 13, 1},
+  {0, 0x0, 0, 0}, {1415, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {1416, 0x0, 0, 0}, {1417, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {1418, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {1419, 0x0, 0, 0}, {0, 0x0, 0, 0}, {1420, 0x0, 0, 0},
+  {1421, 0x0, 0, 0}, {0, 0x0, 0, 0}, {1422, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {1423, 0x0, 0, 0}, {1424, 0x0, 0, 0},
+  {1425, 0x0, 0, 0}, {1426, 0x0, 0, 0}, {1427, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {1428, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {1429, 0x0, 0, 0}, {0, 0x0, 0, 0}, {1430, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {1431, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {1432, 0x0, 0, 0}, {0, 0x0, 0, 0}, {1433, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {1434, 0x0, 0, 0}, {1435, 0x0, 0, 0},
+  {1436, 0x0, 0, 0}, {0, 0x0, 0, 0}, {1437, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {1438, 0x0, 0, 0}, {1439, 0x0, 0, 0},
+  {1440, 0x0, 0, 0}, {1441, 0x0, 0, 0}, {1442, 0x0, 0, 0},
+  {1443, 0x0, 0, 0}, {1444, 0x0, 0, 0}, {1445, 0x0, 0, 0},
+  {1446, 0x0, 0, 0}, {0, 0x0, 0, 0}, {1447, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {1448, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {1449, 0x0, 0, 0}, {0, 0x0, 0, 0}, {1450, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {1451, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {1452, 0x0, 0, 0}, {0, 0x0, 0, 0}, {1453, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {321, 0x1, 13, 1}, {0, 0x0, 0, 0},
+  {1156, 0x0, 0, 0}, {1157, 0x0, 0, 0}, {325, 0x3, 22, 1},
+  {393, 0x3, 22, 1}, {329, 0xf, 10, 1}, {345, 0xf, 10, 1},
+  {361, 0xf, 10, 1}, {377, 0xf, 10, 1}, {770, 0x0, 0, 0},
+  {771, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {772, 0x0, 0, 0}, {773, 0x0, 0, 0}, {774, 0x0, 0, 0},
+  {775, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {760, 0x0, 0, 0},
+  {776, 0x0, 0, 0}, {761, 0x0, 0, 0}, {762, 0x0, 0, 0},
+  {770, 0x0, 0, 0}, {771, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {772, 0x0, 0, 0}, {773, 0x0, 0, 0},
+  {774, 0x0, 0, 0}, {775, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {763, 0x0, 0, 0}, {776, 0x0, 0, 0}, {764, 0x0, 0, 0},
+  {765, 0x0, 0, 0}, {770, 0x0, 0, 0}, {771, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {772, 0x0, 0, 0},
+  {773, 0x0, 0, 0}, {774, 0x0, 0, 0}, {775, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {766, 0x0, 0, 0}, {776, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {767, 0x0, 0, 0}, {770, 0x0, 0, 0},
+  {771, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {772, 0x0, 0, 0}, {773, 0x0, 0, 0}, {774, 0x0, 0, 0},
+  {775, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {768, 0x0, 0, 0},
+  {776, 0x0, 0, 0}, {0, 0x0, 0, 0}, {769, 0x0, 0, 0},
+  {397, 0xf, 10, 1}, {397, 0xf, 10, 1}, {413, 0xf, 10, 1},
+  {429, 0xf, 10, 1}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {777, 0x0, 0, 0}, {778, 0x0, 0, 0}, {779, 0x0, 0, 0},
+  {780, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {781, 0x0, 0, 0},
+  {782, 0x0, 0, 0}, {783, 0x0, 0, 0}, {784, 0x0, 0, 0},
+  {785, 0x0, 0, 0}, {786, 0x0, 0, 0}, {787, 0x0, 0, 0},
+  {788, 0x0, 0, 0}, {789, 0x0, 0, 0}, {790, 0x0, 0, 0},
+  {789, 0x0, 0, 0}, {790, 0x0, 0, 0}, {791, 0x0, 0, 0},
+  {792, 0x0, 0, 0}, {791, 0x0, 0, 0}, {792, 0x0, 0, 0},
+  {793, 0x0, 0, 0}, {794, 0x0, 0, 0}, {795, 0x0, 0, 0},
+  {796, 0x0, 0, 0}, {797, 0x0, 0, 0}, {798, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {799, 0x0, 0, 0},
+  {800, 0x0, 0, 0}, {799, 0x0, 0, 0}, {800, 0x0, 0, 0},
+  {801, 0x0, 0, 0}, {802, 0x0, 0, 0}, {801, 0x0, 0, 0},
+  {802, 0x0, 0, 0}, {1129, 0x0, 0, 0}, {1130, 0x0, 0, 0},
+  {1131, 0x0, 0, 0}, {1132, 0x0, 0, 0}, {1939, 0x0, 0, 0},
+  {1940, 0x0, 0, 0}, {453, 0x1f, 16, 1}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {1941, 0x0, 0, 0}, {449, 0x3, 22, 1},
+  {0, 0x0, 0, 0}, {491, 0x3, 10, 1}, {495, 0x3, 10, 1},
+  {495, 0x3, 10, 1}, {495, 0x3, 10, 1}, {2748, 0x0, 0, 0},
+  {2747, 0x0, 0, 0}, {2749, 0x0, 0, 0}, {2750, 0x0, 0, 0},
+  {2748, 0x0, 0, 0}, {0, 0x0, 0, 0}, {2749, 0x0, 0, 0},
+  {2750, 0x0, 0, 0}, {2443, 0x0, 0, 0}, {2444, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {170, 0x0, 0, 0}, {171, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {810, 0x0, 0, 0},
+  {811, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {2076, 0x0, 0, 0}, {2077, 0x0, 0, 0}, {517, 0x3, 12, 1},
+  {521, 0x3, 12, 1}, {445, 0x3, 10, 1}, {485, 0x1, 11, 1},
+  {487, 0x3, 22, 1}, {499, 0x3, 10, 1}, {503, 0x3, 22, 1},
+  {0, 0x0, 0, 0}, {507, 0x3, 22, 1}, {511, 0x3, 22, 1},
+  {695, 0x0, 0, 0}, {696, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {697, 0x0, 0, 0}, {1102, 0x0, 0, 0}, {1103, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {1104, 0x0, 0, 0}, {2527, 0x0, 0, 0},
+  {2528, 0x0, 0, 0}, {2529, 0x0, 0, 0}, {2529, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {2367, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {1795, 0x0, 0, 0}, {1204, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {537, 0x1, 0, 2}, {539, 0x2, 0, 2}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {549, 0x1, 10, 1}, {551, 0x1, 10, 1},
+  {742, 0x0, 0, 0}, {743, 0x0, 0, 0}, {744, 0x0, 0, 0},
+  {745, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {557, 0x1, 10, 1}, {559, 0x1, 10, 1}, {1967, 0x0, 0, 0},
+  {1968, 0x0, 0, 0}, {1969, 0x0, 0, 0}, {1970, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {565, 0x1, 10, 1},
+  {567, 0x1, 10, 1}, {562, 0x0, 0, 0}, {563, 0x0, 0, 0},
+  {564, 0x0, 0, 0}, {565, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {573, 0x1, 10, 1}, {575, 0x1, 10, 1},
+  {2427, 0x0, 0, 0}, {2428, 0x0, 0, 0}, {2429, 0x0, 0, 0},
+  {2430, 0x0, 0, 0}, {579, 0x3, 12, 1}, {583, 0x3, 12, 1},
+  {525, 0x3, 10, 1}, {529, 0x3, 10, 1}, {533, 0x3, 22, 1},
+  {541, 0x3, 10, 1}, {545, 0x3, 22, 1}, {553, 0x3, 22, 1},
+  {561, 0x3, 22, 1}, {569, 0x3, 22, 1}, {0, 0x0, 0, 0},
+  {589, 0x1, 20, 1}, {591, 0x1, 11, 1}, {593, 0x1, 11, 1},
+  {468, 0x0, 0, 0}, {469, 0x0, 0, 0}, {470, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {597, 0x1, 20, 1},
+  {599, 0x1, 11, 1}, {601, 0x1, 11, 1}, {444, 0x0, 0, 0},
+  {445, 0x0, 0, 0}, {446, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {605, 0x1, 20, 1}, {611, 0x1, 20, 1}, {607, 0x1, 11, 1},
+  {609, 0x1, 11, 1}, {1142, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {1143, 0x0, 0, 0}, {0, 0x0, 0, 0}, {613, 0x1, 11, 1},
+  {615, 0x1, 11, 1}, {1144, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {1145, 0x0, 0, 0}, {0, 0x0, 0, 0}, {619, 0x1, 20, 1},
+  {623, 0x1, 20, 1}, {0, 0x0, 0, 0}, {621, 0x1, 11, 1},
+  {136, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {625, 0x1, 11, 1}, {137, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {629, 0x1, 20, 1}, {635, 0x1, 20, 1}, {631, 0x1, 11, 1},
+  {633, 0x1, 11, 1}, {2685, 0x0, 0, 0}, {2686, 0x0, 0, 0},
+  {2687, 0x0, 0, 0}, {2688, 0x0, 0, 0}, {637, 0x1, 11, 1},
+  {639, 0x1, 11, 1}, {2689, 0x0, 0, 0}, {2690, 0x0, 0, 0},
+  {2691, 0x0, 0, 0}, {2692, 0x0, 0, 0}, {643, 0x1, 20, 1},
+  {649, 0x1, 20, 1}, {645, 0x1, 11, 1}, {647, 0x1, 11, 1},
+  {1234, 0x0, 0, 0}, {1235, 0x0, 0, 0}, {1236, 0x0, 0, 0},
+  {1237, 0x0, 0, 0}, {651, 0x1, 11, 1}, {653, 0x1, 11, 1},
+  {1238, 0x0, 0, 0}, {1239, 0x0, 0, 0}, {1240, 0x0, 0, 0},
+  {1241, 0x0, 0, 0}, {657, 0x1, 20, 1}, {663, 0x1, 20, 1},
+  {659, 0x1, 11, 1}, {661, 0x1, 11, 1}, {1006, 0x0, 0, 0},
+  {1007, 0x0, 0, 0}, {1008, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {665, 0x1, 11, 1}, {667, 0x1, 11, 1}, {1009, 0x0, 0, 0},
+  {1010, 0x0, 0, 0}, {1011, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {671, 0x1, 20, 1}, {677, 0x1, 20, 1}, {673, 0x1, 11, 1},
+  {675, 0x1, 11, 1}, {501, 0x0, 0, 0}, {502, 0x0, 0, 0},
+  {503, 0x0, 0, 0}, {0, 0x0, 0, 0}, {679, 0x1, 11, 1},
+  {681, 0x1, 11, 1}, {504, 0x0, 0, 0}, {505, 0x0, 0, 0},
+  {506, 0x0, 0, 0}, {0, 0x0, 0, 0}, {685, 0x1, 20, 1},
+  {691, 0x1, 20, 1}, {687, 0x1, 11, 1}, {689, 0x1, 11, 1},
+  {2348, 0x0, 0, 0}, {0, 0x0, 0, 0}, {2349, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {693, 0x1, 11, 1}, {695, 0x1, 11, 1},
+  {2350, 0x0, 0, 0}, {0, 0x0, 0, 0}, {2351, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {699, 0x1, 20, 1}, {703, 0x1, 20, 1},
+  {0, 0x0, 0, 0}, {701, 0x1, 11, 1}, {1660, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {705, 0x1, 11, 1},
+  {1661, 0x0, 0, 0}, {0, 0x0, 0, 0}, {709, 0x1, 20, 1},
+  {715, 0x1, 20, 1}, {711, 0x1, 11, 1}, {713, 0x1, 11, 1},
+  {700, 0x0, 0, 0}, {701, 0x0, 0, 0}, {702, 0x0, 0, 0},
+  {703, 0x0, 0, 0}, {717, 0x1, 11, 1}, {719, 0x1, 11, 1},
+  {704, 0x0, 0, 0}, {705, 0x0, 0, 0}, {706, 0x0, 0, 0},
+  {707, 0x0, 0, 0}, {723, 0x1, 20, 1}, {729, 0x1, 20, 1},
+  {725, 0x1, 11, 1}, {727, 0x1, 11, 1}, {2674, 0x0, 0, 0},
+  {2675, 0x0, 0, 0}, {2676, 0x0, 0, 0}, {2677, 0x0, 0, 0},
+  {731, 0x1, 11, 1}, {733, 0x1, 11, 1}, {2678, 0x0, 0, 0},
+  {2679, 0x0, 0, 0}, {2680, 0x0, 0, 0}, {2681, 0x0, 0, 0},
+  {2621, 0x0, 0, 0}, {2622, 0x0, 0, 0}, {363, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {1877, 0x0, 0, 0}, {1878, 0x0, 0, 0},
+  {2252, 0x0, 0, 0}, {2253, 0x0, 0, 0}, {1810, 0x0, 0, 0},
+  {1811, 0x0, 0, 0}, {1831, 0x0, 0, 0}, {1832, 0x0, 0, 0},
+  {735, 0x0, 0, 0}, {736, 0x0, 0, 0}, {1552, 0x0, 0, 0},
+  {1553, 0x0, 0, 0}, {753, 0x1, 11, 1}, {755, 0x1, 11, 1},
+  {1498, 0x0, 0, 0}, {1499, 0x0, 0, 0}, {1500, 0x0, 0, 0},
+  {1501, 0x0, 0, 0}, {759, 0x1, 11, 1}, {761, 0x1, 11, 1},
+  {566, 0x0, 0, 0}, {0, 0x0, 0, 0}, {567, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {765, 0x1, 23, 1}, {787, 0x1, 23, 1},
+  {767, 0x3, 12, 1}, {777, 0x3, 12, 1}, {771, 0x1, 10, 1},
+  {0, 0x0, 0, 0}, {773, 0x1, 10, 1}, {775, 0x1, 10, 1},
+  {587, 0x1, 22, 1}, {595, 0x1, 22, 1}, {603, 0x1, 22, 1},
+  {617, 0x1, 22, 1}, {627, 0x1, 22, 1}, {641, 0x1, 22, 1},
+  {781, 0x1, 10, 1}, {0, 0x0, 0, 0}, {783, 0x1, 10, 1},
+  {785, 0x1, 10, 1}, {655, 0x1, 22, 1}, {669, 0x1, 22, 1},
+  {683, 0x1, 22, 1}, {697, 0x1, 22, 1}, {707, 0x1, 22, 1},
+  {721, 0x1, 22, 1}, {789, 0x3, 12, 1}, {795, 0x3, 12, 1},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {793, 0x1, 10, 1}, {735, 0x1, 11, 1}, {737, 0x1, 11, 1},
+  {799, 0x1, 10, 1}, {801, 0x1, 10, 1}, {803, 0x1, 10, 1},
+  {805, 0x1, 10, 1}, {739, 0x1, 22, 1}, {741, 0x1, 22, 1},
+  {743, 0x1, 22, 1}, {745, 0x1, 22, 1}, {747, 0x1, 22, 1},
+  {749, 0x1, 22, 1}, {751, 0x1, 22, 1}, {757, 0x1, 22, 1},
+  {811, 0x7, 18, 1}, {819, 0x7, 18, 1}, {827, 0x7, 18, 1},
+  {835, 0x7, 18, 1}, {319, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {2733, 0x0, 0, 0},
+  {2733, 0x0, 0, 0}, {2733, 0x0, 0, 0}, {2733, 0x0, 0, 0},
+  {320, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {2733, 0x0, 0, 0}, {2733, 0x0, 0, 0},
+  {2733, 0x0, 0, 0}, {2733, 0x0, 0, 0}, {321, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {2733, 0x0, 0, 0}, {2733, 0x0, 0, 0}, {2733, 0x0, 0, 0},
+  {2733, 0x0, 0, 0}, {322, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {2733, 0x0, 0, 0},
+  {2733, 0x0, 0, 0}, {2733, 0x0, 0, 0}, {2733, 0x0, 0, 0},
+  {860, 0x0, 0, 0}, {861, 0x0, 0, 0}, {862, 0x0, 0, 0},
+  {863, 0x0, 0, 0}, {864, 0x0, 0, 0}, {865, 0x0, 0, 0},
+  {866, 0x0, 0, 0}, {867, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {868, 0x0, 0, 0}, {869, 0x0, 0, 0}, {870, 0x0, 0, 0},
+  {871, 0x0, 0, 0}, {807, 0x3, 22, 1}, {843, 0xf, 10, 1},
+  {865, 0x7, 18, 1}, {873, 0x7, 18, 1}, {881, 0x7, 18, 1},
+  {889, 0x7, 18, 1}, {319, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {2060, 0x0, 0, 0},
+  {2060, 0x0, 0, 0}, {2060, 0x0, 0, 0}, {2060, 0x0, 0, 0},
+  {320, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {2060, 0x0, 0, 0}, {2060, 0x0, 0, 0},
+  {2060, 0x0, 0, 0}, {2060, 0x0, 0, 0}, {321, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {2060, 0x0, 0, 0}, {2060, 0x0, 0, 0}, {2060, 0x0, 0, 0},
+  {2060, 0x0, 0, 0}, {322, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {2060, 0x0, 0, 0},
+  {2060, 0x0, 0, 0}, {2060, 0x0, 0, 0}, {2060, 0x0, 0, 0},
+  {2156, 0x0, 0, 0}, {2157, 0x0, 0, 0}, {2158, 0x0, 0, 0},
+  {2159, 0x0, 0, 0}, {2160, 0x0, 0, 0}, {2161, 0x0, 0, 0},
+  {2162, 0x0, 0, 0}, {2163, 0x0, 0, 0}, {2164, 0x0, 0, 0},
+  {2165, 0x0, 0, 0}, {2166, 0x0, 0, 0}, {2167, 0x0, 0, 0},
+  {2168, 0x0, 0, 0}, {2169, 0x0, 0, 0}, {2170, 0x0, 0, 0},
+  {2171, 0x0, 0, 0}, {861, 0x3, 22, 1}, {897, 0xf, 10, 1},
+  {919, 0x7, 18, 1}, {927, 0x7, 18, 1}, {935, 0x7, 18, 1},
+  {943, 0x7, 18, 1}, {319, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {320, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {321, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {322, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {955, 0xf, 10, 1}, {971, 0xf, 10, 1}, {987, 0xf, 10, 1},
+  {1003, 0xf, 10, 1}, {2537, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {2538, 0x0, 0, 0}, {2539, 0x0, 0, 0}, {2540, 0x0, 0, 0},
+  {2541, 0x0, 0, 0}, {2530, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {2531, 0x0, 0, 0}, {2532, 0x0, 0, 0}, {2533, 0x0, 0, 0},
+  {2534, 0x0, 0, 0}, {2542, 0x0, 0, 0}, {2543, 0x0, 0, 0},
+  {2544, 0x0, 0, 0}, {0, 0x0, 0, 0}, {2537, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {2538, 0x0, 0, 0}, {2539, 0x0, 0, 0},
+  {2540, 0x0, 0, 0}, {2541, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {2531, 0x0, 0, 0}, {2532, 0x0, 0, 0},
+  {2533, 0x0, 0, 0}, {2534, 0x0, 0, 0}, {2542, 0x0, 0, 0},
+  {2543, 0x0, 0, 0}, {2544, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {2537, 0x0, 0, 0}, {0, 0x0, 0, 0}, {2538, 0x0, 0, 0},
+  {2539, 0x0, 0, 0}, {2540, 0x0, 0, 0}, {2541, 0x0, 0, 0},
+  {2535, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {2542, 0x0, 0, 0}, {2543, 0x0, 0, 0}, {2544, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {2537, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {2538, 0x0, 0, 0}, {2539, 0x0, 0, 0}, {2540, 0x0, 0, 0},
+  {2541, 0x0, 0, 0}, {2536, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {2542, 0x0, 0, 0}, {2543, 0x0, 0, 0},
+  {2544, 0x0, 0, 0}, {0, 0x0, 0, 0}, {915, 0x3, 22, 1},
+  {951, 0x3, 22, 1}, {1025, 0x7, 18, 1}, {1035, 0x7, 18, 1},
+  {1043, 0x7, 18, 1}, {1051, 0x7, 18, 1}, {319, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {1033, 0x1, 13, 1}, {1033, 0x1, 13, 1}, {1033, 0x1, 13, 1},
+  {1033, 0x1, 13, 1}, {323, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {320, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {1033, 0x1, 13, 1}, {1033, 0x1, 13, 1},
+  {1033, 0x1, 13, 1}, {1033, 0x1, 13, 1}, {321, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {1033, 0x1, 13, 1}, {1033, 0x1, 13, 1}, {1033, 0x1, 13, 1},
+  {1033, 0x1, 13, 1}, {322, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {1033, 0x1, 13, 1},
+  {1033, 0x1, 13, 1}, {1033, 0x1, 13, 1}, {1033, 0x1, 13, 1},
+  {932, 0x0, 0, 0}, {933, 0x0, 0, 0}, {738, 0x0, 0, 0},
+  {739, 0x0, 0, 0}, {1065, 0x1, 10, 1}, {1067, 0x1, 10, 1},
+  {2623, 0x0, 0, 0}, {2624, 0x0, 0, 0}, {2625, 0x0, 0, 0},
+  {2626, 0x0, 0, 0}, {106, 0x0, 0, 0}, {107, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {970, 0x0, 0, 0}, {971, 0x0, 0, 0}, {978, 0x0, 0, 0},
+  {979, 0x0, 0, 0}, {2263, 0x0, 0, 0}, {2264, 0x0, 0, 0},
+  {804, 0x0, 0, 0}, {805, 0x0, 0, 0}, {1059, 0x1, 10, 1},
+  {1061, 0x1, 10, 1}, {1063, 0x1, 23, 1}, {1069, 0x1f, 16, 1},
+  {1101, 0x1, 10, 1}, {1103, 0x1, 10, 1}, {1105, 0x1, 10, 1},
+  {1107, 0x1, 10, 1}, {1021, 0x3, 22, 1}, {1109, 0x7, 11, 1},
+  {2219, 0x0, 0, 0}, {2220, 0x0, 0, 0}, {1123, 0x7, 10, 1},
+  {0, 0x0, 0, 0}, {2221, 0x0, 0, 0}, {2222, 0x0, 0, 0},
+  {2223, 0x0, 0, 0}, {2224, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {2225, 0x0, 0, 0}, {2226, 0x0, 0, 0},
+  {2381, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {2382, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {2383, 0x0, 0, 0}, {2384, 0x0, 0, 0},
+  {2385, 0x0, 0, 0}, {2386, 0x0, 0, 0}, {2387, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {2388, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {934, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {935, 0x0, 0, 0}, {936, 0x0, 0, 0},
+  {937, 0x0, 0, 0}, {0, 0x0, 0, 0}, {1131, 0x1f, 16, 1},
+  {0, 0x0, 0, 0}, {1173, 0x7, 10, 1}, {0, 0x0, 0, 0},
+  {1755, 0x0, 0, 0}, {1756, 0x0, 0, 0}, {1757, 0x0, 0, 0},
+  {1758, 0x0, 0, 0}, {1759, 0x0, 0, 0}, {1760, 0x0, 0, 0},
+  {1761, 0x0, 0, 0}, {1762, 0x0, 0, 0}, {1183, 0x7, 10, 1},
+  {0, 0x0, 0, 0}, {2507, 0x0, 0, 0}, {2508, 0x0, 0, 0},
+  {2509, 0x0, 0, 0}, {2510, 0x0, 0, 0}, {2511, 0x0, 0, 0},
+  {2512, 0x0, 0, 0}, {2513, 0x0, 0, 0}, {2514, 0x0, 0, 0},
+  {1193, 0x1, 13, 1}, {1195, 0x1, 13, 1}, {1119, 0x3, 22, 1},
+  {1163, 0x7, 10, 1}, {1171, 0x1, 23, 1}, {1181, 0x1, 23, 1},
+  {1201, 0x1f, 16, 1}, {1233, 0x1f, 16, 1}, {1233, 0x1f, 16, 1},
+  {1233, 0x1f, 16, 1}, {110, 0x0, 0, 0}, {110, 0x0, 0, 0},
+  {110, 0x0, 0, 0}, {110, 0x0, 0, 0}, {110, 0x0, 0, 0},
+  {110, 0x0, 0, 0}, {110, 0x0, 0, 0}, {110, 0x0, 0, 0},
+  {110, 0x0, 0, 0}, {110, 0x0, 0, 0}, {110, 0x0, 0, 0},
+  {110, 0x0, 0, 0}, {110, 0x0, 0, 0}, {110, 0x0, 0, 0},
+  {110, 0x0, 0, 0}, {110, 0x0, 0, 0}, {108, 0x0, 0, 0},
+  {109, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {111, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {110, 0x0, 0, 0}, {110, 0x0, 0, 0}, {110, 0x0, 0, 0},
+  {110, 0x0, 0, 0}, {110, 0x0, 0, 0}, {110, 0x0, 0, 0},
+  {110, 0x0, 0, 0}, {110, 0x0, 0, 0}, {110, 0x0, 0, 0},
+  {110, 0x0, 0, 0}, {110, 0x0, 0, 0}, {110, 0x0, 0, 0},
+  {110, 0x0, 0, 0}, {110, 0x0, 0, 0}, {110, 0x0, 0, 0},
+  {110, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {111, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {1197, 0x3, 22, 1}, {0, 0x0, 0, 0}, {2015, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {1684, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {2409, 0x0, 0, 0}, {0, 0x0, 0, 0}, {1724, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {2673, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {814, 0x0, 0, 0}, {0, 0x0, 0, 0}, {1696, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {2020, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {120, 0x0, 0, 0}, {0, 0x0, 0, 0}, {1322, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {1502, 0x0, 0, 0}, {1291, 0xf, 10, 1},
+  {1307, 0xf, 10, 1}, {1265, 0x3, 0, 2}, {1267, 0x4, 0, 2},
+  {1269, 0x4, 0, 2}, {1271, 0x4, 0, 2}, {1273, 0x4, 0, 2},
+  {1275, 0x4, 0, 2}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {1296, 0x0, 0, 0}, {1297, 0x0, 0, 0}, {1298, 0x0, 0, 0},
+  {1299, 0x0, 0, 0}, {1300, 0x0, 0, 0}, {1301, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {1277, 0x5, 0, 2},
+  {1279, 0x5, 0, 2}, {1281, 0x5, 0, 2}, {1283, 0x5, 0, 2},
+  {1285, 0x5, 0, 2}, {1287, 0x5, 0, 2}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {1302, 0x0, 0, 0}, {1303, 0x0, 0, 0},
+  {1304, 0x0, 0, 0}, {1305, 0x0, 0, 0}, {1306, 0x0, 0, 0},
+  {1307, 0x0, 0, 0}, {1308, 0x0, 0, 0}, {1309, 0x0, 0, 0},
+  {209, 0x0, 0, 0}, {210, 0x0, 0, 0}, {211, 0x0, 0, 0},
+  {212, 0x0, 0, 0}, {213, 0x0, 0, 0}, {214, 0x0, 0, 0},
+  {215, 0x0, 0, 0}, {216, 0x0, 0, 0}, {217, 0x0, 0, 0},
+  {218, 0x0, 0, 0}, {219, 0x0, 0, 0}, {220, 0x0, 0, 0},
+  {221, 0x0, 0, 0}, {222, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {256, 0x0, 0, 0},
+  {257, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {258, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {259, 0x0, 0, 0}, {260, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {424, 0x0, 0, 0}, {425, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {2064, 0x0, 0, 0}, {1393, 0x1, 13, 1},
+  {1395, 0x1, 13, 1}, {1323, 0x1f, 16, 1}, {1355, 0x1f, 16, 1},
+  {1387, 0x1, 4, 1}, {1389, 0x6, 0, 2}, {1401, 0x1f, 5, 1},
+  {0, 0x0, 0, 0}, {2548, 0x0, 0, 0}, {2549, 0x0, 0, 0},
+  {2547, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {1397, 0x3, 16, 1}, {1437, 0x1f, 5, 1}, {1225, 0x0, 0, 0},
+  {1224, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {1435, 0x1, 17, 1}, {1473, 0x1, 10, 1}, {1475, 0x1, 10, 1},
+  {1433, 0x7, 0, 2}, {1469, 0x8, 0, 2}, {1791, 0x0, 0, 0},
+  {1792, 0x0, 0, 0}, {0, 0x0, 0, 0}, {1471, 0x1, 12, 1},
+  {2153, 0x0, 0, 0}, {1477, 0x9, 0, 2}, {2372, 0x0, 0, 0},
+  {1479, 0x1, 13, 1}, {1485, 0x3, 22, 1}, {1489, 0x3, 22, 1},
+  {2120, 0x0, 0, 0}, {2121, 0x0, 0, 0}, {2122, 0x0, 0, 0},
+  {2123, 0x0, 0, 0}, {2124, 0x0, 0, 0}, {2125, 0x0, 0, 0},
+  {2126, 0x0, 0, 0}, {2127, 0x0, 0, 0}, {1495, 0x3, 22, 1},
+  {1499, 0x3, 22, 1}, {2488, 0x0, 0, 0}, {2489, 0x0, 0, 0},
+  {2490, 0x0, 0, 0}, {2491, 0x0, 0, 0}, {2492, 0x0, 0, 0},
+  {2493, 0x0, 0, 0}, {2494, 0x0, 0, 0}, {2495, 0x0, 0, 0},
+  {1505, 0x3, 22, 1}, {1573, 0x3, 22, 1}, {1509, 0xf, 10, 1},
+  {1525, 0xf, 10, 1}, {1541, 0xf, 10, 1}, {1557, 0xf, 10, 1},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {2496, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {2497, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {2498, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {2499, 0x0, 0, 0}, {1577, 0xf, 10, 1}, {1593, 0xf, 10, 1},
+  {1609, 0xf, 10, 1}, {1625, 0xf, 10, 1}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {2500, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {2501, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {2502, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {2503, 0x0, 0, 0},
+  {1643, 0x3, 22, 1}, {1711, 0x3, 22, 1}, {1647, 0xf, 10, 1},
+  {1663, 0xf, 10, 1}, {1679, 0xf, 10, 1}, {1695, 0xf, 10, 1},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {2290, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {2291, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {2292, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {2293, 0x0, 0, 0}, {1715, 0xf, 10, 1}, {1731, 0xf, 10, 1},
+  {1747, 0xf, 10, 1}, {1763, 0xf, 10, 1}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {2294, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {2295, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {2296, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {2297, 0x0, 0, 0},
+  {2078, 0x0, 0, 0}, {2079, 0x0, 0, 0}, {1312, 0x0, 0, 0},
+  {1313, 0x0, 0, 0}, {1785, 0x3, 22, 1}, {1789, 0x3, 22, 1},
+  {1329, 0x0, 0, 0}, {1329, 0x0, 0, 0}, {1329, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {1330, 0x0, 0, 0}, {1330, 0x0, 0, 0},
+  {1330, 0x0, 0, 0}, {0, 0x0, 0, 0}, {1795, 0x3, 22, 1},
+  {1807, 0x3, 22, 1}, {1799, 0x7, 10, 1}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {1647, 0x0, 0, 0},
+  {1647, 0x0, 0, 0}, {1647, 0x0, 0, 0}, {1647, 0x0, 0, 0},
+  {1647, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {1811, 0x7, 10, 1}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {1648, 0x0, 0, 0},
+  {1648, 0x0, 0, 0}, {1648, 0x0, 0, 0}, {1648, 0x0, 0, 0},
+  {1648, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {2145, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {416, 0x0, 0, 0}, {0, 0x0, 0, 0}, {309, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {1651, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {1030, 0x0, 0, 0}, {1294, 0x0, 0, 0}, {91, 0x0, 0, 0},
+  {92, 0x0, 0, 0}, {364, 0x0, 0, 0}, {365, 0x0, 0, 0},
+  {474, 0x0, 0, 0}, {475, 0x0, 0, 0}, {1839, 0x7, 18, 1},
+  {1851, 0x7, 18, 1}, {1863, 0x7, 18, 1}, {1879, 0x7, 18, 1},
+  {1847, 0x1, 16, 1}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {1849, 0x1, 13, 1},
+  {0, 0x0, 0, 0}, {1819, 0x1, 17, 1}, {1821, 0x1, 17, 1},
+  {1859, 0x1, 16, 1}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {1861, 0x1, 13, 1},
+  {0, 0x0, 0, 0}, {1823, 0x1, 17, 1}, {1825, 0x1, 17, 1},
+  {1871, 0x1, 16, 1}, {1871, 0x1, 16, 1}, {1871, 0x1, 16, 1},
+  {1871, 0x1, 16, 1}, {1871, 0x1, 16, 1}, {1871, 0x1, 16, 1},
+  {1871, 0x1, 16, 1}, {1875, 0x1, 16, 1}, {1873, 0x1, 13, 1},
+  {1873, 0x1, 13, 1}, {1030, 0x0, 0, 0}, {91, 0x0, 0, 0},
+  {1873, 0x1, 13, 1}, {1877, 0x1, 13, 1}, {1827, 0x1, 17, 1},
+  {1829, 0x1, 17, 1}, {1887, 0x1, 16, 1}, {1887, 0x1, 16, 1},
+  {1887, 0x1, 16, 1}, {1887, 0x1, 16, 1}, {1887, 0x1, 16, 1},
+  {1887, 0x1, 16, 1}, {1887, 0x1, 16, 1}, {1891, 0x1, 16, 1},
+  {1889, 0x1, 13, 1}, {1889, 0x1, 13, 1}, {364, 0x0, 0, 0},
+  {474, 0x0, 0, 0}, {1889, 0x1, 13, 1}, {1893, 0x1, 13, 1},
+  {1831, 0x1, 17, 1}, {1833, 0x1, 17, 1}, {1835, 0x3, 22, 1},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {2628, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {2682, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {1897, 0x0, 0, 0}, {0, 0x0, 0, 0}, {507, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {1331, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {296, 0x0, 0, 0}, {1100, 0x0, 0, 0}, {1100, 0x0, 0, 0},
+  {1100, 0x0, 0, 0}, {1101, 0x0, 0, 0}, {1510, 0x0, 0, 0},
+  {1510, 0x0, 0, 0}, {1510, 0x0, 0, 0}, {1511, 0x0, 0, 0},
+  {1972, 0x0, 0, 0}, {1972, 0x0, 0, 0}, {1972, 0x0, 0, 0},
+  {1973, 0x0, 0, 0}, {2438, 0x0, 0, 0}, {2438, 0x0, 0, 0},
+  {2438, 0x0, 0, 0}, {2737, 0x0, 0, 0}, {1310, 0x0, 0, 0},
+  {1310, 0x0, 0, 0}, {1310, 0x0, 0, 0}, {1311, 0x0, 0, 0},
+  {2044, 0x0, 0, 0}, {2044, 0x0, 0, 0}, {2044, 0x0, 0, 0},
+  {2045, 0x0, 0, 0}, {1937, 0x3, 19, 1}, {1947, 0x3, 19, 1},
+  {1957, 0x3, 19, 1}, {1973, 0x3, 19, 1}, {1941, 0x1, 16, 1},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {1943, 0x3, 12, 1}, {0, 0x0, 0, 0}, {1897, 0xa, 0, 2},
+  {0, 0x0, 0, 0}, {1899, 0xa, 0, 2}, {1901, 0xa, 0, 2},
+  {1951, 0x1, 16, 1}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {1953, 0x3, 12, 1}, {0, 0x0, 0, 0},
+  {1903, 0xa, 0, 2}, {0, 0x0, 0, 0}, {1905, 0xa, 0, 2},
+  {1907, 0xa, 0, 2}, {1961, 0x1, 16, 1}, {1961, 0x1, 16, 1},
+  {1961, 0x1, 16, 1}, {1967, 0x1, 16, 1}, {1963, 0x3, 12, 1},
+  {1963, 0x3, 12, 1}, {1100, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {1510, 0x0, 0, 0}, {1972, 0x0, 0, 0}, {1963, 0x3, 12, 1},
+  {1969, 0x3, 12, 1}, {1909, 0x3, 17, 1}, {0, 0x0, 0, 0},
+  {1913, 0x3, 17, 1}, {1917, 0x3, 17, 1}, {1977, 0x1, 16, 1},
+  {1977, 0x1, 16, 1}, {1977, 0x1, 16, 1}, {1983, 0x1, 16, 1},
+  {1979, 0x3, 12, 1}, {1979, 0x3, 12, 1}, {2438, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {1310, 0x0, 0, 0}, {2044, 0x0, 0, 0},
+  {1979, 0x3, 12, 1}, {1985, 0x3, 12, 1}, {1921, 0x3, 17, 1},
+  {0, 0x0, 0, 0}, {1925, 0x3, 17, 1}, {1929, 0x3, 17, 1},
+  {465, 0x0, 0, 0}, {0, 0x0, 0, 0}, {1321, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {1554, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {1548, 0x0, 0, 0}, {0, 0x0, 0, 0}, {2016, 0x0, 0, 0},
+  {2017, 0x0, 0, 0}, {1965, 0x0, 0, 0}, {1966, 0x0, 0, 0},
+  {1228, 0x0, 0, 0}, {1229, 0x0, 0, 0}, {1685, 0x0, 0, 0},
+  {1686, 0x0, 0, 0}, {2009, 0x7, 18, 1}, {2021, 0x7, 18, 1},
+  {2033, 0x7, 18, 1}, {2049, 0x7, 18, 1}, {2017, 0x1, 16, 1},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {2019, 0x1, 13, 1}, {0, 0x0, 0, 0},
+  {1989, 0x1, 17, 1}, {1991, 0x1, 17, 1}, {2029, 0x1, 16, 1},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {2031, 0x1, 13, 1}, {0, 0x0, 0, 0},
+  {1993, 0x1, 17, 1}, {1995, 0x1, 17, 1}, {2041, 0x1, 16, 1},
+  {2041, 0x1, 16, 1}, {2041, 0x1, 16, 1}, {2041, 0x1, 16, 1},
+  {2041, 0x1, 16, 1}, {2041, 0x1, 16, 1}, {2041, 0x1, 16, 1},
+  {2045, 0x1, 16, 1}, {2043, 0x1, 13, 1}, {2043, 0x1, 13, 1},
+  {2016, 0x0, 0, 0}, {1965, 0x0, 0, 0}, {2043, 0x1, 13, 1},
+  {2047, 0x1, 13, 1}, {1997, 0x1, 17, 1}, {1999, 0x1, 17, 1},
+  {2057, 0x1, 16, 1}, {2057, 0x1, 16, 1}, {2057, 0x1, 16, 1},
+  {2057, 0x1, 16, 1}, {2057, 0x1, 16, 1}, {2057, 0x1, 16, 1},
+  {2057, 0x1, 16, 1}, {2061, 0x1, 16, 1}, {2059, 0x1, 13, 1},
+  {2059, 0x1, 13, 1}, {1228, 0x0, 0, 0}, {1685, 0x0, 0, 0},
+  {2059, 0x1, 13, 1}, {2063, 0x1, 13, 1}, {2001, 0x1, 17, 1},
+  {2003, 0x1, 17, 1}, {2005, 0x3, 22, 1}, {0, 0x0, 0, 0},
+  {2038, 0x0, 0, 0}, {0, 0x0, 0, 0}, {1749, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {2572, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {1223, 0x0, 0, 0}, {0, 0x0, 0, 0}, {1788, 0x0, 0, 0},
+  {1789, 0x0, 0, 0}, {1277, 0x0, 0, 0}, {1278, 0x0, 0, 0},
+  {1596, 0x0, 0, 0}, {1597, 0x0, 0, 0}, {88, 0x0, 0, 0},
+  {89, 0x0, 0, 0}, {2087, 0x7, 18, 1}, {2099, 0x7, 18, 1},
+  {2111, 0x7, 18, 1}, {2127, 0x7, 18, 1}, {2095, 0x1, 16, 1},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {2097, 0x1, 13, 1}, {0, 0x0, 0, 0},
+  {2067, 0x1, 17, 1}, {2069, 0x1, 17, 1}, {2107, 0x1, 16, 1},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {2109, 0x1, 13, 1}, {0, 0x0, 0, 0},
+  {2071, 0x1, 17, 1}, {2073, 0x1, 17, 1}, {2119, 0x1, 16, 1},
+  {2119, 0x1, 16, 1}, {2119, 0x1, 16, 1}, {2119, 0x1, 16, 1},
+  {2119, 0x1, 16, 1}, {2119, 0x1, 16, 1}, {2119, 0x1, 16, 1},
+  {2123, 0x1, 16, 1}, {2121, 0x1, 13, 1}, {2121, 0x1, 13, 1},
+  {1788, 0x0, 0, 0}, {1277, 0x0, 0, 0}, {2121, 0x1, 13, 1},
+  {2125, 0x1, 13, 1}, {2075, 0x1, 17, 1}, {2077, 0x1, 17, 1},
+  {2135, 0x1, 16, 1}, {2135, 0x1, 16, 1}, {2135, 0x1, 16, 1},
+  {2135, 0x1, 16, 1}, {2135, 0x1, 16, 1}, {2135, 0x1, 16, 1},
+  {2135, 0x1, 16, 1}, {2139, 0x1, 16, 1}, {2137, 0x1, 13, 1},
+  {2137, 0x1, 13, 1}, {1596, 0x0, 0, 0}, {88, 0x0, 0, 0},
+  {2137, 0x1, 13, 1}, {2141, 0x1, 13, 1}, {2079, 0x1, 17, 1},
+  {2081, 0x1, 17, 1}, {138, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {694, 0x0, 0, 0}, {0, 0x0, 0, 0}, {1158, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {601, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {754, 0x0, 0, 0}, {939, 0x0, 0, 0}, {232, 0x0, 0, 0},
+  {233, 0x0, 0, 0}, {755, 0x0, 0, 0}, {1014, 0x0, 0, 0},
+  {756, 0x0, 0, 0}, {2347, 0x0, 0, 0}, {2163, 0x7, 18, 1},
+  {2175, 0x7, 18, 1}, {2187, 0x7, 18, 1}, {2203, 0x7, 18, 1},
+  {2171, 0x1, 16, 1}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {2173, 0x1, 13, 1},
+  {0, 0x0, 0, 0}, {2143, 0x1, 17, 1}, {2145, 0x1, 17, 1},
+  {2183, 0x1, 16, 1}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {2185, 0x1, 13, 1},
+  {0, 0x0, 0, 0}, {2147, 0x1, 17, 1}, {2149, 0x1, 17, 1},
+  {2195, 0x1, 16, 1}, {2195, 0x1, 16, 1}, {2195, 0x1, 16, 1},
+  {2195, 0x1, 16, 1}, {2195, 0x1, 16, 1}, {2195, 0x1, 16, 1},
+  {2195, 0x1, 16, 1}, {2199, 0x1, 16, 1}, {2197, 0x1, 13, 1},
+  {2197, 0x1, 13, 1}, {754, 0x0, 0, 0}, {232, 0x0, 0, 0},
+  {2197, 0x1, 13, 1}, {2201, 0x1, 13, 1}, {2151, 0x1, 17, 1},
+  {2153, 0x1, 17, 1}, {2211, 0x1, 16, 1}, {2211, 0x1, 16, 1},
+  {2211, 0x1, 16, 1}, {2211, 0x1, 16, 1}, {2211, 0x1, 16, 1},
+  {2211, 0x1, 16, 1}, {2211, 0x1, 16, 1}, {2215, 0x1, 16, 1},
+  {2213, 0x1, 13, 1}, {2213, 0x1, 13, 1}, {755, 0x0, 0, 0},
+  {756, 0x0, 0, 0}, {2213, 0x1, 13, 1}, {2217, 0x1, 13, 1},
+  {2155, 0x1, 17, 1}, {2157, 0x1, 17, 1}, {2159, 0x3, 22, 1},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {497, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {2433, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {247, 0x0, 0, 0}, {0, 0x0, 0, 0}, {1823, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {1205, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {2072, 0x0, 0, 0}, {0, 0x0, 0, 0}, {954, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {818, 0x0, 0, 0}, {268, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {972, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {1000, 0x0, 0, 0}, {1000, 0x0, 0, 0}, {1000, 0x0, 0, 0},
+  {1595, 0x0, 0, 0}, {2237, 0x1, 12, 1}, {2237, 0x1, 12, 1},
+  {2237, 0x1, 12, 1}, {2249, 0x1, 12, 1}, {1971, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {1001, 0x0, 0, 0}, {1001, 0x0, 0, 0},
+  {1001, 0x0, 0, 0}, {1930, 0x0, 0, 0}, {2239, 0x1, 12, 1},
+  {2239, 0x1, 12, 1}, {2239, 0x1, 12, 1}, {2259, 0x1, 12, 1},
+  {1699, 0x0, 0, 0}, {0, 0x0, 0, 0}, {803, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {139, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {973, 0x0, 0, 0}, {973, 0x0, 0, 0}, {973, 0x0, 0, 0},
+  {974, 0x0, 0, 0}, {2261, 0x1, 12, 1}, {2261, 0x1, 12, 1},
+  {2261, 0x1, 12, 1}, {2273, 0x1, 12, 1}, {1935, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {816, 0x0, 0, 0}, {816, 0x0, 0, 0},
+  {816, 0x0, 0, 0}, {817, 0x0, 0, 0}, {2263, 0x1, 12, 1},
+  {2263, 0x1, 12, 1}, {2263, 0x1, 12, 1}, {2283, 0x1, 12, 1},
+  {687, 0x0, 0, 0}, {0, 0x0, 0, 0}, {2289, 0x3, 19, 1},
+  {2301, 0x3, 19, 1}, {2313, 0x3, 19, 1}, {2333, 0x3, 19, 1},
+  {2293, 0x1, 16, 1}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {2295, 0x1, 13, 1}, {0, 0x0, 0, 0},
+  {2297, 0x1, 10, 1}, {2299, 0x1, 10, 1}, {2221, 0xa, 0, 2},
+  {2223, 0xb, 0, 2}, {2225, 0xa, 0, 2}, {2227, 0xb, 0, 2},
+  {2305, 0x1, 16, 1}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {2307, 0x1, 13, 1}, {0, 0x0, 0, 0},
+  {2309, 0x1, 10, 1}, {2311, 0x1, 10, 1}, {2229, 0xa, 0, 2},
+  {2231, 0xb, 0, 2}, {2233, 0xa, 0, 2}, {2235, 0xb, 0, 2},
+  {2317, 0x1, 16, 1}, {2317, 0x1, 16, 1}, {2317, 0x1, 16, 1},
+  {2325, 0x1, 16, 1}, {2319, 0x1, 13, 1}, {2319, 0x1, 13, 1},
+  {2321, 0x1, 10, 1}, {2323, 0x1, 10, 1}, {1000, 0x0, 0, 0},
+  {2237, 0x1, 12, 1}, {1001, 0x0, 0, 0}, {2239, 0x1, 12, 1},
+  {2319, 0x1, 13, 1}, {2327, 0x1, 13, 1}, {2329, 0x1, 10, 1},
+  {2331, 0x1, 10, 1}, {2241, 0x3, 17, 1}, {2245, 0x3, 17, 1},
+  {2251, 0x3, 17, 1}, {2255, 0x3, 17, 1}, {2337, 0x1, 16, 1},
+  {2337, 0x1, 16, 1}, {2337, 0x1, 16, 1}, {2345, 0x1, 16, 1},
+  {2339, 0x1, 13, 1}, {2339, 0x1, 13, 1}, {2341, 0x1, 10, 1},
+  {2343, 0x1, 10, 1}, {973, 0x0, 0, 0}, {2261, 0x1, 12, 1},
+  {816, 0x0, 0, 0}, {2263, 0x1, 12, 1}, {2339, 0x1, 13, 1},
+  {2347, 0x1, 13, 1}, {2349, 0x1, 10, 1}, {2351, 0x1, 10, 1},
+  {2265, 0x3, 17, 1}, {2269, 0x3, 17, 1}, {2275, 0x3, 17, 1},
+  {2279, 0x3, 17, 1}, {2285, 0x3, 22, 1}, {0, 0x0, 0, 0},
+  {2357, 0x1f, 16, 1}, {2391, 0x1f, 16, 1}, {2389, 0x1, 13, 1},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {1136, 0x0, 0, 0}, {1137, 0x0, 0, 0},
+  {2423, 0x1, 13, 1}, {2423, 0x1, 13, 1}, {2423, 0x1, 13, 1},
+  {2423, 0x1, 13, 1}, {2423, 0x1, 13, 1}, {2423, 0x1, 13, 1},
+  {2423, 0x1, 13, 1}, {2423, 0x1, 13, 1}, {2423, 0x1, 13, 1},
+  {2423, 0x1, 13, 1}, {2423, 0x1, 13, 1}, {2423, 0x1, 13, 1},
+  {2423, 0x1, 13, 1}, {2423, 0x1, 13, 1}, {2423, 0x1, 13, 1},
+  {2423, 0x1, 13, 1}, {2423, 0x1, 13, 1}, {2423, 0x1, 13, 1},
+  {2423, 0x1, 13, 1}, {2423, 0x1, 13, 1}, {2423, 0x1, 13, 1},
+  {2423, 0x1, 13, 1}, {2423, 0x1, 13, 1}, {2423, 0x1, 13, 1},
+  {2423, 0x1, 13, 1}, {2423, 0x1, 13, 1}, {2423, 0x1, 13, 1},
+  {2423, 0x1, 13, 1}, {2423, 0x1, 13, 1}, {2423, 0x1, 13, 1},
+  {2423, 0x1, 13, 1}, {2425, 0x1, 13, 1}, {1138, 0x0, 0, 0},
+  {1139, 0x0, 0, 0}, {1140, 0x0, 0, 0}, {1141, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {2355, 0x1, 23, 1}, {2014, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {2370, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {295, 0x0, 0, 0}, {0, 0x0, 0, 0}, {746, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {1073, 0x0, 0, 0}, {1074, 0x0, 0, 0},
+  {2247, 0x0, 0, 0}, {2260, 0x0, 0, 0}, {162, 0x0, 0, 0},
+  {163, 0x0, 0, 0}, {1649, 0x0, 0, 0}, {1650, 0x0, 0, 0},
+  {2449, 0x7, 18, 1}, {2461, 0x7, 18, 1}, {2473, 0x7, 18, 1},
+  {2489, 0x7, 18, 1}, {2457, 0x1, 16, 1}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {2459, 0x1, 13, 1}, {0, 0x0, 0, 0}, {2429, 0x1, 17, 1},
+  {2431, 0x1, 17, 1}, {2469, 0x1, 16, 1}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {2471, 0x1, 13, 1}, {0, 0x0, 0, 0}, {2433, 0x1, 17, 1},
+  {2435, 0x1, 17, 1}, {2481, 0x1, 16, 1}, {2481, 0x1, 16, 1},
+  {2481, 0x1, 16, 1}, {2481, 0x1, 16, 1}, {2481, 0x1, 16, 1},
+  {2481, 0x1, 16, 1}, {2481, 0x1, 16, 1}, {2485, 0x1, 16, 1},
+  {2483, 0x1, 13, 1}, {2483, 0x1, 13, 1}, {1073, 0x0, 0, 0},
+  {2247, 0x0, 0, 0}, {2483, 0x1, 13, 1}, {2487, 0x1, 13, 1},
+  {2437, 0x1, 17, 1}, {2439, 0x1, 17, 1}, {2497, 0x1, 16, 1},
+  {2497, 0x1, 16, 1}, {2497, 0x1, 16, 1}, {2497, 0x1, 16, 1},
+  {2497, 0x1, 16, 1}, {2497, 0x1, 16, 1}, {2497, 0x1, 16, 1},
+  {2501, 0x1, 16, 1}, {2499, 0x1, 13, 1}, {2499, 0x1, 13, 1},
+  {162, 0x0, 0, 0}, {1649, 0x0, 0, 0}, {2499, 0x1, 13, 1},
+  {2503, 0x1, 13, 1}, {2441, 0x1, 17, 1}, {2443, 0x1, 17, 1},
+  {2146, 0x0, 0, 0}, {0, 0x0, 0, 0}, {146, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {135, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {2422, 0x0, 0, 0}, {0, 0x0, 0, 0}, {1002, 0x0, 0, 0},
+  {1868, 0x0, 0, 0}, {1003, 0x0, 0, 0}, {2289, 0x0, 0, 0},
+  {206, 0x0, 0, 0}, {207, 0x0, 0, 0}, {709, 0x0, 0, 0},
+  {710, 0x0, 0, 0}, {2525, 0x7, 18, 1}, {2537, 0x7, 18, 1},
+  {2549, 0x7, 18, 1}, {2565, 0x7, 18, 1}, {2533, 0x1, 16, 1},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {2535, 0x1, 13, 1}, {0, 0x0, 0, 0},
+  {2505, 0x1, 17, 1}, {2507, 0x1, 17, 1}, {2545, 0x1, 16, 1},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {2547, 0x1, 13, 1}, {0, 0x0, 0, 0},
+  {2509, 0x1, 17, 1}, {2511, 0x1, 17, 1}, {2557, 0x1, 16, 1},
+  {2557, 0x1, 16, 1}, {2557, 0x1, 16, 1}, {2557, 0x1, 16, 1},
+  {2557, 0x1, 16, 1}, {2557, 0x1, 16, 1}, {2557, 0x1, 16, 1},
+  {2561, 0x1, 16, 1}, {2559, 0x1, 13, 1}, {2559, 0x1, 13, 1},
+  {1002, 0x0, 0, 0}, {1003, 0x0, 0, 0}, {2559, 0x1, 13, 1},
+  {2563, 0x1, 13, 1}, {2513, 0x1, 17, 1}, {2515, 0x1, 17, 1},
+  {2573, 0x1, 16, 1}, {2573, 0x1, 16, 1}, {2573, 0x1, 16, 1},
+  {2573, 0x1, 16, 1}, {2573, 0x1, 16, 1}, {2573, 0x1, 16, 1},
+  {2573, 0x1, 16, 1}, {2577, 0x1, 16, 1}, {2575, 0x1, 13, 1},
+  {2575, 0x1, 13, 1}, {206, 0x0, 0, 0}, {709, 0x0, 0, 0},
+  {2575, 0x1, 13, 1}, {2579, 0x1, 13, 1}, {2517, 0x1, 17, 1},
+  {2519, 0x1, 17, 1}, {2521, 0x3, 22, 1}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {1859, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {2241, 0x0, 0, 0}, {0, 0x0, 0, 0}, {308, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {104, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {2366, 0x0, 0, 0}, {0, 0x0, 0, 0}, {2039, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {2061, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {2389, 0x0, 0, 0}, {310, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {652, 0x0, 0, 0}, {0, 0x0, 0, 0}, {418, 0x0, 0, 0},
+  {418, 0x0, 0, 0}, {418, 0x0, 0, 0}, {633, 0x0, 0, 0},
+  {2599, 0x1, 12, 1}, {2599, 0x1, 12, 1}, {2599, 0x1, 12, 1},
+  {2611, 0x1, 12, 1}, {547, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {419, 0x0, 0, 0}, {419, 0x0, 0, 0}, {419, 0x0, 0, 0},
+  {2071, 0x0, 0, 0}, {2601, 0x1, 12, 1}, {2601, 0x1, 12, 1},
+  {2601, 0x1, 12, 1}, {2621, 0x1, 12, 1}, {2374, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {400, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {230, 0x0, 0, 0}, {0, 0x0, 0, 0}, {420, 0x0, 0, 0},
+  {420, 0x0, 0, 0}, {420, 0x0, 0, 0}, {1023, 0x0, 0, 0},
+  {2623, 0x1, 12, 1}, {2623, 0x1, 12, 1}, {2623, 0x1, 12, 1},
+  {2635, 0x1, 12, 1}, {401, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {421, 0x0, 0, 0}, {421, 0x0, 0, 0}, {421, 0x0, 0, 0},
+  {1630, 0x0, 0, 0}, {2625, 0x1, 12, 1}, {2625, 0x1, 12, 1},
+  {2625, 0x1, 12, 1}, {2645, 0x1, 12, 1}, {231, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {2651, 0x3, 19, 1}, {2663, 0x3, 19, 1},
+  {2675, 0x3, 19, 1}, {2695, 0x3, 19, 1}, {2655, 0x1, 16, 1},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {2657, 0x1, 13, 1}, {0, 0x0, 0, 0}, {2659, 0x1, 10, 1},
+  {2661, 0x1, 10, 1}, {2583, 0xa, 0, 2}, {2585, 0xb, 0, 2},
+  {2587, 0xa, 0, 2}, {2589, 0xb, 0, 2}, {2667, 0x1, 16, 1},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {2669, 0x1, 13, 1}, {0, 0x0, 0, 0}, {2671, 0x1, 10, 1},
+  {2673, 0x1, 10, 1}, {2591, 0xa, 0, 2}, {2593, 0xb, 0, 2},
+  {2595, 0xa, 0, 2}, {2597, 0xb, 0, 2}, {2679, 0x1, 16, 1},
+  {2679, 0x1, 16, 1}, {2679, 0x1, 16, 1}, {2687, 0x1, 16, 1},
+  {2681, 0x1, 13, 1}, {2681, 0x1, 13, 1}, {2683, 0x1, 10, 1},
+  {2685, 0x1, 10, 1}, {418, 0x0, 0, 0}, {2599, 0x1, 12, 1},
+  {419, 0x0, 0, 0}, {2601, 0x1, 12, 1}, {2681, 0x1, 13, 1},
+  {2689, 0x1, 13, 1}, {2691, 0x1, 10, 1}, {2693, 0x1, 10, 1},
+  {2603, 0x3, 17, 1}, {2607, 0x3, 17, 1}, {2613, 0x3, 17, 1},
+  {2617, 0x3, 17, 1}, {2699, 0x1, 16, 1}, {2699, 0x1, 16, 1},
+  {2699, 0x1, 16, 1}, {2707, 0x1, 16, 1}, {2701, 0x1, 13, 1},
+  {2701, 0x1, 13, 1}, {2703, 0x1, 10, 1}, {2705, 0x1, 10, 1},
+  {420, 0x0, 0, 0}, {2623, 0x1, 12, 1}, {421, 0x0, 0, 0},
+  {2625, 0x1, 12, 1}, {2701, 0x1, 13, 1}, {2709, 0x1, 13, 1},
+  {2711, 0x1, 10, 1}, {2713, 0x1, 10, 1}, {2627, 0x3, 17, 1},
+  {2631, 0x3, 17, 1}, {2637, 0x3, 17, 1}, {2641, 0x3, 17, 1},
+  {2647, 0x3, 22, 1}, {0, 0x0, 0, 0}, {2719, 0x1f, 16, 1},
+  {2753, 0x1f, 16, 1}, {2751, 0x1, 13, 1}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {1214, 0x0, 0, 0}, {1215, 0x0, 0, 0}, {2785, 0x1, 13, 1},
+  {2785, 0x1, 13, 1}, {2785, 0x1, 13, 1}, {2785, 0x1, 13, 1},
+  {2785, 0x1, 13, 1}, {2785, 0x1, 13, 1}, {2785, 0x1, 13, 1},
+  {2785, 0x1, 13, 1}, {2785, 0x1, 13, 1}, {2785, 0x1, 13, 1},
+  {2785, 0x1, 13, 1}, {2785, 0x1, 13, 1}, {2785, 0x1, 13, 1},
+  {2785, 0x1, 13, 1}, {2785, 0x1, 13, 1}, {2785, 0x1, 13, 1},
+  {2785, 0x1, 13, 1}, {2785, 0x1, 13, 1}, {2785, 0x1, 13, 1},
+  {2785, 0x1, 13, 1}, {2785, 0x1, 13, 1}, {2785, 0x1, 13, 1},
+  {2785, 0x1, 13, 1}, {2785, 0x1, 13, 1}, {2785, 0x1, 13, 1},
+  {2785, 0x1, 13, 1}, {2785, 0x1, 13, 1}, {2785, 0x1, 13, 1},
+  {2785, 0x1, 13, 1}, {2785, 0x1, 13, 1}, {2785, 0x1, 13, 1},
+  {2787, 0x1, 13, 1}, {1216, 0x0, 0, 0}, {1217, 0x0, 0, 0},
+  {1218, 0x0, 0, 0}, {1219, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {2717, 0x1, 23, 1}, {0, 0x0, 0, 0}, {699, 0x0, 0, 0},
+  {2797, 0xf, 16, 1}, {2097, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {2098, 0x0, 0, 0}, {0, 0x0, 0, 0}, {2096, 0x0, 0, 0},
+  {2096, 0x0, 0, 0}, {2096, 0x0, 0, 0}, {2096, 0x0, 0, 0},
+  {2096, 0x0, 0, 0}, {2096, 0x0, 0, 0}, {2096, 0x0, 0, 0},
+  {2096, 0x0, 0, 0}, {2096, 0x0, 0, 0}, {2096, 0x0, 0, 0},
+  {2096, 0x0, 0, 0}, {2096, 0x0, 0, 0}, {2096, 0x0, 0, 0},
+  {2096, 0x0, 0, 0}, {2096, 0x0, 0, 0}, {2817, 0xf, 16, 1},
+  {928, 0x0, 0, 0}, {0, 0x0, 0, 0}, {929, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {927, 0x0, 0, 0}, {927, 0x0, 0, 0},
+  {927, 0x0, 0, 0}, {927, 0x0, 0, 0}, {927, 0x0, 0, 0},
+  {927, 0x0, 0, 0}, {927, 0x0, 0, 0}, {927, 0x0, 0, 0},
+  {927, 0x0, 0, 0}, {927, 0x0, 0, 0}, {927, 0x0, 0, 0},
+  {927, 0x0, 0, 0}, {927, 0x0, 0, 0}, {927, 0x0, 0, 0},
+  {927, 0x0, 0, 0}, {0, 0x0, 0, 0}, {571, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {2261, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {2262, 0x0, 0, 0}, {2841, 0x3, 22, 1}, {2845, 0x3, 22, 1},
+  {0, 0x0, 0, 0}, {1865, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {2849, 0xf, 16, 1}, {1865, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {1864, 0x0, 0, 0}, {1864, 0x0, 0, 0}, {1864, 0x0, 0, 0},
+  {1864, 0x0, 0, 0}, {1864, 0x0, 0, 0}, {1864, 0x0, 0, 0},
+  {1864, 0x0, 0, 0}, {1864, 0x0, 0, 0}, {1864, 0x0, 0, 0},
+  {1864, 0x0, 0, 0}, {1864, 0x0, 0, 0}, {1864, 0x0, 0, 0},
+  {1864, 0x0, 0, 0}, {1864, 0x0, 0, 0}, {1864, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {1937, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {496, 0x0, 0, 0}, {2871, 0x3, 22, 1}, {2891, 0x3, 22, 1},
+  {2875, 0xf, 16, 1}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {518, 0x0, 0, 0},
+  {518, 0x0, 0, 0}, {518, 0x0, 0, 0}, {518, 0x0, 0, 0},
+  {518, 0x0, 0, 0}, {518, 0x0, 0, 0}, {518, 0x0, 0, 0},
+  {518, 0x0, 0, 0}, {518, 0x0, 0, 0}, {518, 0x0, 0, 0},
+  {518, 0x0, 0, 0}, {518, 0x0, 0, 0}, {518, 0x0, 0, 0},
+  {518, 0x0, 0, 0}, {518, 0x0, 0, 0}, {2895, 0xf, 16, 1},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {519, 0x0, 0, 0}, {519, 0x0, 0, 0},
+  {519, 0x0, 0, 0}, {519, 0x0, 0, 0}, {519, 0x0, 0, 0},
+  {519, 0x0, 0, 0}, {519, 0x0, 0, 0}, {519, 0x0, 0, 0},
+  {519, 0x0, 0, 0}, {519, 0x0, 0, 0}, {519, 0x0, 0, 0},
+  {519, 0x0, 0, 0}, {519, 0x0, 0, 0}, {519, 0x0, 0, 0},
+  {519, 0x0, 0, 0}, {0, 0x0, 0, 0}, {134, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {819, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {820, 0x0, 0, 0}, {2919, 0x3, 22, 1}, {2939, 0x3, 22, 1},
+  {2923, 0xf, 16, 1}, {1960, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {1961, 0x0, 0, 0}, {0, 0x0, 0, 0}, {1958, 0x0, 0, 0},
+  {1958, 0x0, 0, 0}, {1958, 0x0, 0, 0}, {1958, 0x0, 0, 0},
+  {1958, 0x0, 0, 0}, {1958, 0x0, 0, 0}, {1958, 0x0, 0, 0},
+  {1958, 0x0, 0, 0}, {1958, 0x0, 0, 0}, {1958, 0x0, 0, 0},
+  {1958, 0x0, 0, 0}, {1958, 0x0, 0, 0}, {1958, 0x0, 0, 0},
+  {1958, 0x0, 0, 0}, {1958, 0x0, 0, 0}, {2943, 0xf, 16, 1},
+  {1960, 0x0, 0, 0}, {0, 0x0, 0, 0}, {1961, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {1959, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {2791, 0xd, 0, 2}, {2793, 0x3, 22, 1},
+  {0, 0x0, 0, 0}, {2813, 0x3, 22, 1}, {2833, 0xd, 0, 2},
+  {2835, 0x3, 22, 1}, {2256, 0x0, 0, 0}, {2839, 0x1, 30, 1},
+  {2865, 0xd, 0, 2}, {2867, 0xe, 0, 2}, {2257, 0x0, 0, 0},
+  {2869, 0x1, 30, 1}, {2911, 0xd, 0, 2}, {2913, 0x3, 22, 1},
+  {2258, 0x0, 0, 0}, {2917, 0x1, 30, 1}, {2979, 0xf, 10, 1},
+  {2995, 0xf, 10, 1}, {2995, 0xf, 10, 1}, {2995, 0xf, 10, 1},
+  {2340, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {2341, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {2344, 0x0, 0, 0}, {0, 0x0, 0, 0}, {2342, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {2345, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {2343, 0x0, 0, 0}, {0, 0x0, 0, 0}, {2346, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {2344, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {2345, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {2346, 0x0, 0, 0}, {0, 0x0, 0, 0}, {3013, 0x3, 22, 1},
+  {3049, 0x3, 22, 1}, {3017, 0xf, 10, 1}, {3017, 0xf, 10, 1},
+  {3033, 0xf, 10, 1}, {3017, 0xf, 10, 1}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {1808, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {1808, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {1807, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {3017, 0xf, 10, 1}, {3017, 0xf, 10, 1},
+  {3053, 0xf, 10, 1}, {3017, 0xf, 10, 1}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {1808, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {1807, 0x0, 0, 0}, {0, 0x0, 0, 0}, {1805, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {1806, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {1828, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {90, 0x0, 0, 0}, {1784, 0x0, 0, 0}, {1785, 0x0, 0, 0},
+  {1786, 0x0, 0, 0}, {1787, 0x0, 0, 0}, {1718, 0x0, 0, 0},
+  {1719, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {1292, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {1293, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {297, 0x0, 0, 0}, {298, 0x0, 0, 0}, {3069, 0x1, 0, 2},
+  {299, 0x0, 0, 0}, {300, 0x0, 0, 0}, {301, 0x0, 0, 0},
+  {3071, 0x1, 0, 2}, {3073, 0x3, 22, 1}, {302, 0x0, 0, 0},
+  {303, 0x0, 0, 0}, {3077, 0x1f, 16, 1}, {304, 0x0, 0, 0},
+  {305, 0x0, 0, 0}, {306, 0x0, 0, 0}, {3109, 0x1f, 16, 1},
+  {307, 0x0, 0, 0}, {3159, 0x3, 22, 1}, {3167, 0x3, 22, 1},
+  {3163, 0x1, 19, 1}, {3163, 0x1, 19, 1}, {3163, 0x1, 19, 1},
+  {3163, 0x1, 19, 1}, {3165, 0x1, 16, 1}, {0, 0x0, 0, 0},
+  {367, 0x0, 0, 0}, {368, 0x0, 0, 0}, {3171, 0x1, 19, 1},
+  {3163, 0x1, 19, 1}, {3163, 0x1, 19, 1}, {3163, 0x1, 19, 1},
+  {3165, 0x1, 16, 1}, {3173, 0x1, 16, 1}, {366, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {3157, 0x1, 30, 1},
+  {3179, 0x3, 22, 1}, {3185, 0x3, 22, 1}, {3183, 0x1, 19, 1},
+  {3183, 0x1, 19, 1}, {3183, 0x1, 19, 1}, {3183, 0x1, 19, 1},
+  {1005, 0x0, 0, 0}, {0, 0x0, 0, 0}, {3189, 0x1, 19, 1},
+  {3183, 0x1, 19, 1}, {3183, 0x1, 19, 1}, {3183, 0x1, 19, 1},
+  {1005, 0x0, 0, 0}, {1004, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {3177, 0x1, 30, 1}, {3195, 0x3, 22, 1}, {3211, 0x3, 22, 1},
+  {3199, 0x1, 19, 1}, {3199, 0x1, 19, 1}, {3203, 0x1, 19, 1},
+  {3207, 0x1, 19, 1}, {3201, 0x1, 16, 1}, {0, 0x0, 0, 0},
+  {1155, 0x0, 0, 0}, {1153, 0x0, 0, 0}, {3205, 0x1, 16, 1},
+  {0, 0x0, 0, 0}, {1155, 0x0, 0, 0}, {1154, 0x0, 0, 0},
+  {3209, 0x1, 16, 1}, {0, 0x0, 0, 0}, {1155, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {3215, 0x1, 19, 1}, {3199, 0x1, 19, 1},
+  {3203, 0x1, 19, 1}, {3207, 0x1, 19, 1}, {3201, 0x1, 16, 1},
+  {3217, 0x1, 16, 1}, {1152, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {3193, 0x1, 30, 1}, {3223, 0x3, 22, 1},
+  {3235, 0x3, 22, 1}, {3227, 0x1, 19, 1}, {3227, 0x1, 19, 1},
+  {3231, 0x1, 19, 1}, {3231, 0x1, 19, 1}, {3229, 0x1, 16, 1},
+  {0, 0x0, 0, 0}, {749, 0x0, 0, 0}, {748, 0x0, 0, 0},
+  {3233, 0x1, 16, 1}, {0, 0x0, 0, 0}, {749, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {3239, 0x1, 19, 1}, {3227, 0x1, 19, 1},
+  {3231, 0x1, 19, 1}, {3231, 0x1, 19, 1}, {3229, 0x1, 16, 1},
+  {3241, 0x1, 16, 1}, {747, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {3221, 0x1, 30, 1}, {279, 0x0, 0, 0},
+  {280, 0x0, 0, 0}, {3175, 0xf, 0, 2}, {281, 0x0, 0, 0},
+  {282, 0x0, 0, 0}, {283, 0x0, 0, 0}, {3191, 0x10, 0, 2},
+  {284, 0x0, 0, 0}, {285, 0x0, 0, 0}, {286, 0x0, 0, 0},
+  {3219, 0xf, 0, 2}, {287, 0x0, 0, 0}, {288, 0x0, 0, 0},
+  {289, 0x0, 0, 0}, {3243, 0xf, 0, 2}, {290, 0x0, 0, 0},
+  {3265, 0x1f, 16, 1}, {3297, 0x1f, 16, 1}, {3329, 0x1f, 16, 1},
+  {3361, 0x1f, 16, 1}, {1518, 0x0, 0, 0}, {1515, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {1518, 0x0, 0, 0}, {1515, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {1514, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {1518, 0x0, 0, 0},
+  {1517, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {1518, 0x0, 0, 0}, {1517, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {1516, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {3397, 0x1f, 16, 1}, {3429, 0x1f, 16, 1}, {3461, 0x1f, 16, 1},
+  {3493, 0x1f, 16, 1}, {2519, 0x0, 0, 0}, {2516, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {2519, 0x0, 0, 0}, {2516, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {2515, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {2519, 0x0, 0, 0},
+  {2518, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {2519, 0x0, 0, 0}, {2518, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {2517, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {3529, 0x1f, 16, 1}, {3561, 0x1f, 16, 1}, {3593, 0x1f, 16, 1},
+  {3625, 0x1f, 16, 1}, {984, 0x0, 0, 0}, {981, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {985, 0x0, 0, 0},
+  {986, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {984, 0x0, 0, 0}, {981, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {985, 0x0, 0, 0}, {986, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {980, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {984, 0x0, 0, 0},
+  {983, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {985, 0x0, 0, 0}, {986, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {984, 0x0, 0, 0}, {983, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {985, 0x0, 0, 0},
+  {986, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {982, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {3661, 0x1f, 16, 1}, {3693, 0x1f, 16, 1}, {3725, 0x1f, 16, 1},
+  {3757, 0x1f, 16, 1}, {594, 0x0, 0, 0}, {591, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {595, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {594, 0x0, 0, 0}, {591, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {595, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {590, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {594, 0x0, 0, 0},
+  {593, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {595, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {594, 0x0, 0, 0}, {593, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {595, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {592, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {2048, 0x0, 0, 0}, {2049, 0x0, 0, 0}, {3261, 0x3, 22, 1},
+  {2050, 0x0, 0, 0}, {2051, 0x0, 0, 0}, {2052, 0x0, 0, 0},
+  {3393, 0x3, 22, 1}, {2053, 0x0, 0, 0}, {2054, 0x0, 0, 0},
+  {2055, 0x0, 0, 0}, {3525, 0x3, 22, 1}, {2056, 0x0, 0, 0},
+  {2057, 0x0, 0, 0}, {2058, 0x0, 0, 0}, {3657, 0x3, 22, 1},
+  {2059, 0x0, 0, 0}, {2431, 0x0, 0, 0}, {2432, 0x0, 0, 0},
+  {3811, 0x1f, 16, 1}, {3843, 0x1f, 16, 1}, {3875, 0x1f, 16, 1},
+  {3907, 0x1f, 16, 1}, {0, 0x0, 0, 0}, {1854, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {1852, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {1854, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {1853, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {1857, 0x0, 0, 0},
+  {1858, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {1855, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {1857, 0x0, 0, 0}, {1858, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {1856, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {1226, 0x0, 0, 0}, {1227, 0x0, 0, 0}, {1319, 0x0, 0, 0},
+  {1320, 0x0, 0, 0}, {3947, 0x1f, 16, 1}, {3979, 0x1f, 16, 1},
+  {4011, 0x1f, 16, 1}, {4043, 0x1f, 16, 1}, {0, 0x0, 0, 0},
+  {1655, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {1655, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {1654, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {1658, 0x0, 0, 0}, {1659, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {1658, 0x0, 0, 0},
+  {1659, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {1656, 0x0, 0, 0},
+  {1657, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {208, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {1790, 0x0, 0, 0}, {0, 0x0, 0, 0}, {4083, 0x1f, 16, 1},
+  {4083, 0x1f, 16, 1}, {4115, 0x1f, 16, 1}, {4147, 0x1f, 16, 1},
+  {0, 0x0, 0, 0}, {360, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {362, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {362, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {361, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {273, 0x0, 0, 0}, {0, 0x0, 0, 0}, {274, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {102, 0x0, 0, 0}, {103, 0x0, 0, 0},
+  {4189, 0x1f, 16, 1}, {4221, 0x1f, 16, 1}, {4253, 0x1f, 16, 1},
+  {4285, 0x1f, 16, 1}, {0, 0x0, 0, 0}, {1801, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {1800, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {1801, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {1804, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {1802, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {1804, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {1803, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {2504, 0x0, 0, 0}, {2505, 0x0, 0, 0}, {1033, 0x0, 0, 0},
+  {3805, 0x1, 23, 1}, {3807, 0x3, 22, 1}, {3939, 0x1, 23, 1},
+  {1034, 0x0, 0, 0}, {3941, 0x1, 23, 1}, {3943, 0x3, 22, 1},
+  {4075, 0x1, 23, 1}, {1035, 0x0, 0, 0}, {4077, 0x1, 23, 1},
+  {4079, 0x3, 22, 1}, {4179, 0x3, 22, 1}, {0, 0x0, 0, 0},
+  {4183, 0x1, 23, 1}, {4185, 0x3, 22, 1}, {4317, 0x1, 23, 1},
+  {4339, 0x1, 13, 1}, {4339, 0x1, 13, 1}, {4341, 0x1, 13, 1},
+  {4339, 0x1, 13, 1}, {0, 0x0, 0, 0}, {586, 0x0, 0, 0},
+  {584, 0x0, 0, 0}, {586, 0x0, 0, 0}, {4347, 0x3, 19, 1},
+  {4361, 0x3, 19, 1}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {4351, 0x1, 13, 1}, {4355, 0x1, 13, 1}, {4355, 0x1, 13, 1},
+  {4355, 0x1, 13, 1}, {4353, 0x1, 11, 1}, {4353, 0x1, 11, 1},
+  {1032, 0x0, 0, 0}, {0, 0x0, 0, 0}, {4357, 0x1, 11, 1},
+  {4359, 0x1, 11, 1}, {582, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {583, 0x0, 0, 0}, {0, 0x0, 0, 0}, {4355, 0x1, 13, 1},
+  {4355, 0x1, 13, 1}, {4355, 0x1, 13, 1}, {4355, 0x1, 13, 1},
+  {4369, 0x1, 13, 1}, {4371, 0x1, 13, 1}, {4373, 0x1, 13, 1},
+  {4373, 0x1, 13, 1}, {581, 0x0, 0, 0}, {587, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {587, 0x0, 0, 0}, {585, 0x0, 0, 0},
+  {587, 0x0, 0, 0}, {4379, 0x3, 19, 1}, {4393, 0x3, 19, 1},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {4383, 0x1, 13, 1},
+  {4387, 0x1, 13, 1}, {4387, 0x1, 13, 1}, {4387, 0x1, 13, 1},
+  {4385, 0x1, 11, 1}, {4385, 0x1, 11, 1}, {568, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {4389, 0x1, 11, 1}, {4391, 0x1, 11, 1},
+  {569, 0x0, 0, 0}, {0, 0x0, 0, 0}, {570, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {4387, 0x1, 13, 1}, {4387, 0x1, 13, 1},
+  {4387, 0x1, 13, 1}, {4387, 0x1, 13, 1}, {4399, 0x1, 10, 1},
+  {4401, 0x1, 10, 1}, {4335, 0x3, 22, 1}, {4343, 0x3, 22, 1},
+  {4365, 0x3, 22, 1}, {4375, 0x3, 22, 1}, {4407, 0x1, 13, 1},
+  {4407, 0x1, 13, 1}, {4409, 0x1, 13, 1}, {4407, 0x1, 13, 1},
+  {0, 0x0, 0, 0}, {160, 0x0, 0, 0}, {158, 0x0, 0, 0},
+  {160, 0x0, 0, 0}, {0, 0x0, 0, 0}, {1032, 0x0, 0, 0},
+  {4417, 0x1, 13, 1}, {4419, 0x1, 13, 1}, {4421, 0x1, 13, 1},
+  {4421, 0x1, 13, 1}, {155, 0x0, 0, 0}, {161, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {161, 0x0, 0, 0}, {159, 0x0, 0, 0},
+  {161, 0x0, 0, 0}, {4427, 0x3, 19, 1}, {4437, 0x3, 19, 1},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {4383, 0x1, 13, 1},
+  {4431, 0x1, 13, 1}, {4431, 0x1, 13, 1}, {4431, 0x1, 13, 1},
+  {4433, 0x1, 11, 1}, {4435, 0x1, 11, 1}, {156, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {157, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {4431, 0x1, 13, 1}, {4431, 0x1, 13, 1}, {4431, 0x1, 13, 1},
+  {4431, 0x1, 13, 1}, {4443, 0x1, 10, 1}, {4445, 0x1, 10, 1},
+  {4403, 0x3, 22, 1}, {4411, 0x11, 0, 2}, {4413, 0x3, 22, 1},
+  {4423, 0x3, 22, 1}, {499, 0x0, 0, 0}, {500, 0x0, 0, 0},
+  {4453, 0x3, 19, 1}, {4467, 0x3, 19, 1}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {4457, 0x1, 13, 1}, {4461, 0x1, 13, 1},
+  {4461, 0x1, 13, 1}, {4461, 0x1, 13, 1}, {4459, 0x1, 11, 1},
+  {4459, 0x1, 11, 1}, {1750, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {4463, 0x1, 11, 1}, {4465, 0x1, 11, 1}, {946, 0x0, 0, 0},
+  {947, 0x0, 0, 0}, {948, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {4461, 0x1, 13, 1}, {4461, 0x1, 13, 1}, {4461, 0x1, 13, 1},
+  {4461, 0x1, 13, 1}, {4475, 0x1, 13, 1}, {4477, 0x1, 13, 1},
+  {4479, 0x1, 13, 1}, {4479, 0x1, 13, 1}, {945, 0x0, 0, 0},
+  {950, 0x0, 0, 0}, {0, 0x0, 0, 0}, {950, 0x0, 0, 0},
+  {949, 0x0, 0, 0}, {950, 0x0, 0, 0}, {4485, 0x3, 19, 1},
+  {4497, 0x3, 19, 1}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {4489, 0x1, 13, 1}, {4493, 0x1, 13, 1}, {4493, 0x1, 13, 1},
+  {4493, 0x1, 13, 1}, {4491, 0x1, 11, 1}, {4491, 0x1, 11, 1},
+  {757, 0x0, 0, 0}, {0, 0x0, 0, 0}, {4495, 0x1, 11, 1},
+  {0, 0x0, 0, 0}, {758, 0x0, 0, 0}, {759, 0x0, 0, 0},
+  {4493, 0x1, 13, 1}, {4493, 0x1, 13, 1}, {4493, 0x1, 13, 1},
+  {4493, 0x1, 13, 1}, {4503, 0x1, 10, 1}, {4505, 0x1, 10, 1},
+  {4447, 0x1, 13, 1}, {4449, 0x3, 22, 1}, {4471, 0x3, 22, 1},
+  {4481, 0x3, 22, 1}, {1907, 0x0, 0, 0}, {1908, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {708, 0x0, 0, 0}, {4515, 0x1, 12, 1},
+  {4517, 0x1, 12, 1}, {4519, 0x1, 12, 1}, {4521, 0x1, 12, 1},
+  {1909, 0x0, 0, 0}, {1901, 0x0, 0, 0}, {1909, 0x0, 0, 0},
+  {1902, 0x0, 0, 0}, {1909, 0x0, 0, 0}, {1905, 0x0, 0, 0},
+  {1909, 0x0, 0, 0}, {1906, 0x0, 0, 0}, {4527, 0x3, 19, 1},
+  {4539, 0x3, 19, 1}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {4531, 0x3, 11, 1}, {4535, 0x3, 11, 1}, {4535, 0x3, 11, 1},
+  {4535, 0x3, 11, 1}, {1962, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {1963, 0x0, 0, 0}, {1964, 0x0, 0, 0}, {1903, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {1904, 0x0, 0, 0},
+  {4535, 0x3, 11, 1}, {4535, 0x3, 11, 1}, {4535, 0x3, 11, 1},
+  {4535, 0x3, 11, 1}, {4545, 0x1, 10, 1}, {4547, 0x1, 10, 1},
+  {4507, 0x1, 12, 1}, {4509, 0x11, 0, 2}, {4511, 0x3, 22, 1},
+  {4523, 0x3, 22, 1}, {4553, 0xf, 10, 1}, {4569, 0xf, 10, 1},
+  {4585, 0xf, 10, 1}, {4601, 0xf, 10, 1}, {0, 0x0, 0, 0},
+  {582, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {581, 0x0, 0, 0}, {569, 0x0, 0, 0}, {581, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {586, 0x0, 0, 0}, {583, 0x0, 0, 0},
+  {586, 0x0, 0, 0}, {0, 0x0, 0, 0}, {587, 0x0, 0, 0},
+  {570, 0x0, 0, 0}, {587, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {582, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {569, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {586, 0x0, 0, 0},
+  {583, 0x0, 0, 0}, {586, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {587, 0x0, 0, 0}, {570, 0x0, 0, 0}, {587, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {584, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {584, 0x0, 0, 0}, {0, 0x0, 0, 0}, {585, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {585, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {586, 0x0, 0, 0}, {0, 0x0, 0, 0}, {586, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {587, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {587, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {585, 0x0, 0, 0}, {0, 0x0, 0, 0}, {585, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {586, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {586, 0x0, 0, 0}, {0, 0x0, 0, 0}, {587, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {587, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {4621, 0xf, 10, 1}, {4637, 0xf, 10, 1}, {4653, 0xf, 10, 1},
+  {4669, 0xf, 10, 1}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {155, 0x0, 0, 0},
+  {156, 0x0, 0, 0}, {155, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {160, 0x0, 0, 0}, {0, 0x0, 0, 0}, {160, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {161, 0x0, 0, 0}, {157, 0x0, 0, 0},
+  {161, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {156, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {160, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {160, 0x0, 0, 0}, {0, 0x0, 0, 0}, {161, 0x0, 0, 0},
+  {157, 0x0, 0, 0}, {161, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {158, 0x0, 0, 0}, {0, 0x0, 0, 0}, {158, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {159, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {159, 0x0, 0, 0}, {0, 0x0, 0, 0}, {160, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {160, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {161, 0x0, 0, 0}, {0, 0x0, 0, 0}, {161, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {159, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {159, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {160, 0x0, 0, 0}, {0, 0x0, 0, 0}, {160, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {161, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {161, 0x0, 0, 0}, {0, 0x0, 0, 0}, {4689, 0xf, 10, 1},
+  {4705, 0xf, 10, 1}, {4721, 0xf, 10, 1}, {4721, 0xf, 10, 1},
+  {499, 0x0, 0, 0}, {946, 0x0, 0, 0}, {499, 0x0, 0, 0},
+  {947, 0x0, 0, 0}, {945, 0x0, 0, 0}, {758, 0x0, 0, 0},
+  {945, 0x0, 0, 0}, {759, 0x0, 0, 0}, {500, 0x0, 0, 0},
+  {948, 0x0, 0, 0}, {500, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {950, 0x0, 0, 0}, {0, 0x0, 0, 0}, {950, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {499, 0x0, 0, 0}, {946, 0x0, 0, 0},
+  {499, 0x0, 0, 0}, {947, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {758, 0x0, 0, 0}, {0, 0x0, 0, 0}, {759, 0x0, 0, 0},
+  {500, 0x0, 0, 0}, {948, 0x0, 0, 0}, {500, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {950, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {950, 0x0, 0, 0}, {0, 0x0, 0, 0}, {499, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {499, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {949, 0x0, 0, 0}, {0, 0x0, 0, 0}, {949, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {500, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {500, 0x0, 0, 0}, {0, 0x0, 0, 0}, {950, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {950, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {4741, 0xf, 10, 1}, {4757, 0xf, 10, 1}, {4773, 0xf, 10, 1},
+  {4789, 0xf, 10, 1}, {1907, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {1907, 0x0, 0, 0}, {0, 0x0, 0, 0}, {1908, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {1908, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {1909, 0x0, 0, 0}, {1903, 0x0, 0, 0}, {1909, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {1901, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {1901, 0x0, 0, 0}, {1904, 0x0, 0, 0}, {1907, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {1907, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {1908, 0x0, 0, 0}, {0, 0x0, 0, 0}, {1908, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {1909, 0x0, 0, 0}, {1903, 0x0, 0, 0},
+  {1909, 0x0, 0, 0}, {0, 0x0, 0, 0}, {1902, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {1902, 0x0, 0, 0}, {1904, 0x0, 0, 0},
+  {1907, 0x0, 0, 0}, {0, 0x0, 0, 0}, {1907, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {1908, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {1908, 0x0, 0, 0}, {0, 0x0, 0, 0}, {1909, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {1909, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {1905, 0x0, 0, 0}, {0, 0x0, 0, 0}, {1905, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {1907, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {1907, 0x0, 0, 0}, {0, 0x0, 0, 0}, {1908, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {1908, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {1909, 0x0, 0, 0}, {0, 0x0, 0, 0}, {1909, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {1906, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {1906, 0x0, 0, 0}, {0, 0x0, 0, 0}, {4807, 0x1, 23, 1},
+  {4809, 0x1, 23, 1}, {2154, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {2155, 0x0, 0, 0}, {0, 0x0, 0, 0}, {4813, 0x3, 22, 1},
+  {4817, 0x3, 22, 1}, {1710, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {1711, 0x0, 0, 0}, {0, 0x0, 0, 0}, {1712, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {1713, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {4823, 0x3, 22, 1}, {4827, 0x3, 22, 1}, {69, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {2574, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {70, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {4833, 0x3, 22, 1}, {4827, 0x3, 22, 1},
+  {69, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {1208, 0x0, 0, 0}, {4839, 0x1, 4, 1},
+  {1209, 0x0, 0, 0}, {1210, 0x0, 0, 0}, {1208, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {1550, 0x0, 0, 0}, {1551, 0x0, 0, 0},
+  {4847, 0x3, 22, 1}, {4915, 0x3, 22, 1}, {4851, 0xf, 10, 1},
+  {4867, 0xf, 10, 1}, {4883, 0xf, 10, 1}, {4899, 0xf, 10, 1},
+  {602, 0x0, 0, 0}, {178, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {602, 0x0, 0, 0}, {179, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {602, 0x0, 0, 0},
+  {180, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {602, 0x0, 0, 0}, {181, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {603, 0x0, 0, 0}, {182, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {603, 0x0, 0, 0},
+  {183, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {603, 0x0, 0, 0}, {184, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {603, 0x0, 0, 0}, {185, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {604, 0x0, 0, 0},
+  {186, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {604, 0x0, 0, 0}, {187, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {604, 0x0, 0, 0}, {188, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {604, 0x0, 0, 0},
+  {189, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {605, 0x0, 0, 0}, {190, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {605, 0x0, 0, 0}, {191, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {605, 0x0, 0, 0},
+  {192, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {605, 0x0, 0, 0}, {193, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {4919, 0xf, 10, 1}, {4935, 0xf, 10, 1},
+  {4951, 0xf, 10, 1}, {4967, 0xf, 10, 1}, {606, 0x0, 0, 0},
+  {178, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {606, 0x0, 0, 0}, {179, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {606, 0x0, 0, 0}, {180, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {606, 0x0, 0, 0},
+  {181, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {607, 0x0, 0, 0}, {182, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {607, 0x0, 0, 0}, {183, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {607, 0x0, 0, 0},
+  {184, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {607, 0x0, 0, 0}, {185, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {608, 0x0, 0, 0}, {186, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {608, 0x0, 0, 0},
+  {187, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {608, 0x0, 0, 0}, {188, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {608, 0x0, 0, 0}, {189, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {609, 0x0, 0, 0},
+  {190, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {609, 0x0, 0, 0}, {191, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {609, 0x0, 0, 0}, {192, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {609, 0x0, 0, 0},
+  {193, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {4985, 0x3, 22, 1}, {5053, 0x3, 22, 1}, {4989, 0xf, 10, 1},
+  {5005, 0xf, 10, 1}, {5021, 0xf, 10, 1}, {5037, 0xf, 10, 1},
+  {602, 0x0, 0, 0}, {1046, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {602, 0x0, 0, 0}, {1047, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {602, 0x0, 0, 0},
+  {1048, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {602, 0x0, 0, 0}, {1049, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {603, 0x0, 0, 0}, {1050, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {603, 0x0, 0, 0},
+  {1051, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {603, 0x0, 0, 0}, {1052, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {603, 0x0, 0, 0}, {1053, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {604, 0x0, 0, 0},
+  {1054, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {604, 0x0, 0, 0}, {1055, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {604, 0x0, 0, 0}, {1056, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {604, 0x0, 0, 0},
+  {1057, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {605, 0x0, 0, 0}, {1058, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {605, 0x0, 0, 0}, {1059, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {605, 0x0, 0, 0},
+  {1060, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {605, 0x0, 0, 0}, {1061, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {5057, 0xf, 10, 1}, {5073, 0xf, 10, 1},
+  {5089, 0xf, 10, 1}, {5105, 0xf, 10, 1}, {606, 0x0, 0, 0},
+  {1046, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {606, 0x0, 0, 0}, {1047, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {606, 0x0, 0, 0}, {1048, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {606, 0x0, 0, 0},
+  {1049, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {607, 0x0, 0, 0}, {1050, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {607, 0x0, 0, 0}, {1051, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {607, 0x0, 0, 0},
+  {1052, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {607, 0x0, 0, 0}, {1053, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {608, 0x0, 0, 0}, {1054, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {608, 0x0, 0, 0},
+  {1055, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {608, 0x0, 0, 0}, {1056, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {608, 0x0, 0, 0}, {1057, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {609, 0x0, 0, 0},
+  {1058, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {609, 0x0, 0, 0}, {1059, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {609, 0x0, 0, 0}, {1060, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {609, 0x0, 0, 0},
+  {1061, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {5123, 0x3, 22, 1}, {5191, 0x3, 22, 1}, {5127, 0xf, 10, 1},
+  {5143, 0xf, 10, 1}, {5159, 0xf, 10, 1}, {5175, 0xf, 10, 1},
+  {602, 0x0, 0, 0}, {1911, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {602, 0x0, 0, 0}, {1912, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {602, 0x0, 0, 0},
+  {1913, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {602, 0x0, 0, 0}, {1914, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {603, 0x0, 0, 0}, {1915, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {603, 0x0, 0, 0},
+  {1916, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {603, 0x0, 0, 0}, {1917, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {603, 0x0, 0, 0}, {1918, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {604, 0x0, 0, 0},
+  {1919, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {604, 0x0, 0, 0}, {1920, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {604, 0x0, 0, 0}, {1921, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {604, 0x0, 0, 0},
+  {1922, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {605, 0x0, 0, 0}, {1923, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {605, 0x0, 0, 0}, {1924, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {605, 0x0, 0, 0},
+  {1925, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {605, 0x0, 0, 0}, {1926, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {5195, 0xf, 10, 1}, {5211, 0xf, 10, 1},
+  {5227, 0xf, 10, 1}, {5243, 0xf, 10, 1}, {606, 0x0, 0, 0},
+  {1911, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {606, 0x0, 0, 0}, {1912, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {606, 0x0, 0, 0}, {1913, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {606, 0x0, 0, 0},
+  {1914, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {607, 0x0, 0, 0}, {1915, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {607, 0x0, 0, 0}, {1916, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {607, 0x0, 0, 0},
+  {1917, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {607, 0x0, 0, 0}, {1918, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {608, 0x0, 0, 0}, {1919, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {608, 0x0, 0, 0},
+  {1920, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {608, 0x0, 0, 0}, {1921, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {608, 0x0, 0, 0}, {1922, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {609, 0x0, 0, 0},
+  {1923, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {609, 0x0, 0, 0}, {1924, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {609, 0x0, 0, 0}, {1925, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {609, 0x0, 0, 0},
+  {1926, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {5261, 0x3, 22, 1}, {5329, 0x3, 22, 1}, {5265, 0xf, 10, 1},
+  {5281, 0xf, 10, 1}, {5297, 0xf, 10, 1}, {5313, 0xf, 10, 1},
+  {602, 0x0, 0, 0}, {610, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {602, 0x0, 0, 0}, {611, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {602, 0x0, 0, 0},
+  {612, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {602, 0x0, 0, 0}, {613, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {603, 0x0, 0, 0}, {614, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {603, 0x0, 0, 0},
+  {615, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {603, 0x0, 0, 0}, {616, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {603, 0x0, 0, 0}, {617, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {604, 0x0, 0, 0},
+  {618, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {604, 0x0, 0, 0}, {619, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {604, 0x0, 0, 0}, {620, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {604, 0x0, 0, 0},
+  {621, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {605, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {605, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {605, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {605, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {5333, 0xf, 10, 1}, {5349, 0xf, 10, 1},
+  {5365, 0xf, 10, 1}, {5381, 0xf, 10, 1}, {606, 0x0, 0, 0},
+  {610, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {606, 0x0, 0, 0}, {611, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {606, 0x0, 0, 0}, {612, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {606, 0x0, 0, 0},
+  {613, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {607, 0x0, 0, 0}, {614, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {607, 0x0, 0, 0}, {615, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {607, 0x0, 0, 0},
+  {616, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {607, 0x0, 0, 0}, {617, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {608, 0x0, 0, 0}, {618, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {608, 0x0, 0, 0},
+  {619, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {608, 0x0, 0, 0}, {620, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {608, 0x0, 0, 0}, {621, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {609, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {609, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {609, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {609, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {2365, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {246, 0x0, 0, 0}, {0, 0x0, 0, 0}, {1887, 0x0, 0, 0},
+  {943, 0x0, 0, 0}, {0, 0x0, 0, 0}, {944, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {740, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {741, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {2672, 0x0, 0, 0}, {5445, 0x3, 12, 1}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {7, 0x0, 0, 0}, {8, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {5481, 0x3, 12, 1}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {112, 0x0, 0, 0}, {113, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {977, 0x0, 0, 0},
+  {5489, 0x3, 22, 1}, {5505, 0x3, 22, 1}, {5493, 0x3, 10, 1},
+  {0, 0x0, 0, 0}, {5497, 0x3, 10, 1}, {5501, 0x3, 10, 1},
+  {5397, 0x12, 0, 2}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {1635, 0x0, 0, 0}, {1636, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {5399, 0x13, 0, 2},
+  {5401, 0x13, 0, 2}, {5403, 0x3, 12, 1}, {5407, 0x3, 12, 1},
+  {5509, 0x3, 10, 1}, {0, 0x0, 0, 0}, {5513, 0x3, 10, 1},
+  {5517, 0x3, 10, 1}, {5411, 0x12, 0, 2}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {1643, 0x0, 0, 0},
+  {1644, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {5413, 0x1f, 16, 1}, {5449, 0x1f, 16, 1}, {5485, 0x14, 0, 2},
+  {0, 0x0, 0, 0}, {5523, 0x3, 22, 1}, {5559, 0x3, 22, 1},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {5527, 0xf, 10, 1},
+  {5543, 0xf, 10, 1}, {1635, 0x0, 0, 0}, {1636, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {1635, 0x0, 0, 0},
+  {1636, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {1635, 0x0, 0, 0}, {1636, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {1635, 0x0, 0, 0}, {1636, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {1637, 0x0, 0, 0},
+  {1638, 0x0, 0, 0}, {1639, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {1640, 0x0, 0, 0}, {1641, 0x0, 0, 0}, {1642, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {5563, 0xf, 10, 1},
+  {0, 0x0, 0, 0}, {1643, 0x0, 0, 0}, {1644, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {1643, 0x0, 0, 0},
+  {1644, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {1643, 0x0, 0, 0}, {1644, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {1643, 0x0, 0, 0}, {1644, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {5581, 0x3, 22, 1},
+  {5585, 0x3, 22, 1}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {5497, 0x3, 10, 1}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {5513, 0x3, 10, 1}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {1327, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {2475, 0x0, 0, 0}, {1931, 0x0, 0, 0}, {1932, 0x0, 0, 0},
+  {5599, 0xf, 10, 1}, {5615, 0xf, 10, 1}, {5631, 0xf, 10, 1},
+  {5647, 0xf, 10, 1}, {0, 0x0, 0, 0}, {1768, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {1769, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {1770, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {1771, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {1772, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {1773, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {1774, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {1775, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {1776, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {1777, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {1778, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {1779, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {1780, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {1781, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {1782, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {1783, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {5667, 0xf, 10, 1},
+  {5683, 0xf, 10, 1}, {5699, 0xf, 10, 1}, {5715, 0xf, 10, 1},
+  {0, 0x0, 0, 0}, {1998, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {1999, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {2000, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {2001, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {2002, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {2003, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {2004, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {2005, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {2006, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {2007, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {2008, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {2009, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {2010, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {2011, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {2012, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {2013, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {5735, 0xf, 10, 1}, {5751, 0xf, 10, 1},
+  {5767, 0xf, 10, 1}, {5783, 0xf, 10, 1}, {0, 0x0, 0, 0},
+  {841, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {842, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {843, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {844, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {845, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {846, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {847, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {848, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {849, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {850, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {851, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {852, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {853, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {854, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {855, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {856, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {5803, 0xf, 10, 1}, {5819, 0xf, 10, 1}, {5835, 0xf, 10, 1},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {234, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {235, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {236, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {237, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {238, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {239, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {240, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {241, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {242, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {243, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {244, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {245, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {5853, 0x3, 22, 1},
+  {5857, 0xf, 10, 1}, {5873, 0xf, 10, 1}, {0, 0x0, 0, 0},
+  {5889, 0xf, 10, 1}, {2738, 0x0, 0, 0}, {2739, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {2740, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {2741, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {2742, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {2743, 0x0, 0, 0}, {0, 0x0, 0, 0}, {2744, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {2745, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {2746, 0x0, 0, 0}, {0, 0x0, 0, 0}, {5907, 0x3, 22, 1},
+  {5911, 0xf, 10, 1}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {2694, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {2695, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {2696, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {5931, 0x3, 19, 1},
+  {5943, 0x3, 19, 1}, {0, 0x0, 0, 0}, {5955, 0x3, 19, 1},
+  {5935, 0x3, 16, 1}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {5939, 0x3, 16, 1}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {194, 0x0, 0, 0}, {195, 0x0, 0, 0}, {196, 0x0, 0, 0},
+  {197, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {5947, 0x3, 16, 1}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {5951, 0x3, 16, 1}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {198, 0x0, 0, 0}, {199, 0x0, 0, 0}, {200, 0x0, 0, 0},
+  {201, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {5959, 0x3, 16, 1}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {5963, 0x3, 16, 1}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {202, 0x0, 0, 0}, {203, 0x0, 0, 0}, {204, 0x0, 0, 0},
+  {205, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {5927, 0x3, 22, 1}, {2172, 0x0, 0, 0},
+  {2173, 0x0, 0, 0}, {2174, 0x0, 0, 0}, {2175, 0x0, 0, 0},
+  {2176, 0x0, 0, 0}, {2177, 0x0, 0, 0}, {2178, 0x0, 0, 0},
+  {2179, 0x0, 0, 0}, {2180, 0x0, 0, 0}, {2181, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {2182, 0x0, 0, 0}, {2183, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {2184, 0x0, 0, 0},
+  {2185, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {827, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {828, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {829, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {830, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {5969, 0x1f, 16, 1}, {6001, 0x1f, 0, 1}, {0, 0x0, 0, 0},
+  {294, 0x0, 0, 0}, {2448, 0x0, 0, 0}, {2449, 0x0, 0, 0},
+  {2450, 0x0, 0, 0}, {2451, 0x0, 0, 0}, {2452, 0x0, 0, 0},
+  {2453, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {2454, 0x0, 0, 0}, {2455, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {2456, 0x0, 0, 0},
+  {2457, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {2458, 0x0, 0, 0}, {2459, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {2460, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {1323, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {1324, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {1325, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {1326, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {6037, 0x1f, 16, 1},
+  {6069, 0x1f, 0, 1}, {0, 0x0, 0, 0}, {698, 0x0, 0, 0},
+  {55, 0x0, 0, 0}, {56, 0x0, 0, 0}, {57, 0x0, 0, 0},
+  {58, 0x0, 0, 0}, {59, 0x0, 0, 0}, {60, 0x0, 0, 0},
+  {61, 0x0, 0, 0}, {62, 0x0, 0, 0}, {63, 0x0, 0, 0},
+  {64, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {65, 0x0, 0, 0}, {66, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {67, 0x0, 0, 0}, {68, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {2361, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {2362, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {2363, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {2364, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {6105, 0x1f, 16, 1}, {6137, 0x1f, 0, 1},
+  {0, 0x0, 0, 0}, {1555, 0x0, 0, 0}, {6177, 0x1, 12, 1},
+  {6179, 0x1, 12, 1}, {0, 0x0, 0, 0}, {6181, 0x1, 12, 1},
+  {6033, 0x1, 13, 1}, {6035, 0x17, 0, 2}, {6101, 0x1, 13, 1},
+  {6103, 0x17, 0, 2}, {6169, 0x1, 13, 1}, {6171, 0x17, 0, 2},
+  {6187, 0x1, 4, 1}, {6189, 0x1, 4, 1}, {0, 0x0, 0, 0},
+  {6191, 0x1, 4, 1}, {1817, 0x0, 0, 0}, {1818, 0x0, 0, 0},
+  {1819, 0x0, 0, 0}, {1820, 0x0, 0, 0}, {1821, 0x0, 0, 0},
+  {1822, 0x0, 0, 0}, {6197, 0x3, 12, 1}, {6201, 0x3, 12, 1},
+  {0, 0x0, 0, 0}, {6205, 0x3, 12, 1}, {1105, 0x0, 0, 0},
+  {1106, 0x0, 0, 0}, {1107, 0x0, 0, 0}, {1108, 0x0, 0, 0},
+  {1109, 0x0, 0, 0}, {1110, 0x0, 0, 0}, {1111, 0x0, 0, 0},
+  {1112, 0x0, 0, 0}, {1113, 0x0, 0, 0}, {1114, 0x0, 0, 0},
+  {1115, 0x0, 0, 0}, {1116, 0x0, 0, 0}, {526, 0x0, 0, 0},
+  {527, 0x0, 0, 0}, {0, 0x0, 0, 0}, {528, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {140, 0x0, 0, 0}, {6219, 0x1, 19, 1},
+  {6229, 0x1, 19, 1}, {6229, 0x1, 19, 1}, {6229, 0x1, 19, 1},
+  {6221, 0x3, 12, 1}, {6225, 0x3, 12, 1}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {824, 0x0, 0, 0},
+  {821, 0x0, 0, 0}, {822, 0x0, 0, 0}, {823, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {6221, 0x3, 12, 1}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {6215, 0x3, 22, 1}, {515, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {516, 0x0, 0, 0}, {517, 0x0, 0, 0},
+  {6239, 0x3, 10, 1}, {6243, 0x3, 10, 1}, {6173, 0x3, 22, 1},
+  {6183, 0x3, 22, 1}, {6193, 0x3, 22, 1}, {6209, 0x3, 22, 1},
+  {0, 0x0, 0, 0}, {6213, 0x18, 0, 2}, {6231, 0x10, 0, 2},
+  {6233, 0x3, 12, 1}, {6279, 0x1, 13, 1}, {6281, 0x1, 13, 1},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {6283, 0x1, 13, 1},
+  {6285, 0x1, 13, 1}, {6287, 0x1, 13, 1}, {6289, 0x1, 13, 1},
+  {6291, 0x1, 13, 1}, {6293, 0x1, 13, 1}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {1731, 0x0, 0, 0}, {0, 0x0, 0, 0}, {1732, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {1733, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {1734, 0x0, 0, 0}, {0, 0x0, 0, 0}, {1735, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {1736, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {1737, 0x0, 0, 0}, {0, 0x0, 0, 0}, {1738, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {6327, 0x1, 13, 1}, {6329, 0x1, 13, 1},
+  {6331, 0x1, 13, 1}, {6333, 0x1, 13, 1}, {6335, 0x1, 13, 1},
+  {6337, 0x1, 13, 1}, {6339, 0x1, 13, 1}, {6341, 0x1, 13, 1},
+  {6343, 0x1, 13, 1}, {6345, 0x1, 13, 1}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {325, 0x0, 0, 0}, {0, 0x0, 0, 0}, {326, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {327, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {328, 0x0, 0, 0}, {0, 0x0, 0, 0}, {329, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {330, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {331, 0x0, 0, 0}, {0, 0x0, 0, 0}, {332, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {333, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {334, 0x0, 0, 0}, {0, 0x0, 0, 0}, {6379, 0x1, 13, 1},
+  {6381, 0x1, 13, 1}, {6383, 0x1, 13, 1}, {0, 0x0, 0, 0},
+  {6385, 0x1, 13, 1}, {6387, 0x1, 13, 1}, {6389, 0x1, 13, 1},
+  {6391, 0x1, 13, 1}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {1063, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {1064, 0x0, 0, 0}, {0, 0x0, 0, 0}, {1065, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {1066, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {1067, 0x0, 0, 0}, {0, 0x0, 0, 0}, {1068, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {1069, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {6397, 0x1, 12, 1}, {6399, 0x1, 12, 1}, {0, 0x0, 0, 0},
+  {6401, 0x1, 12, 1}, {6247, 0x1f, 16, 1}, {6035, 0x17, 0, 2},
+  {6295, 0x1f, 16, 1}, {6103, 0x17, 0, 2}, {6347, 0x1f, 16, 1},
+  {6171, 0x17, 0, 2}, {6407, 0x3, 12, 1}, {6411, 0x3, 12, 1},
+  {0, 0x0, 0, 0}, {6415, 0x3, 12, 1}, {1974, 0x0, 0, 0},
+  {1975, 0x0, 0, 0}, {1976, 0x0, 0, 0}, {1977, 0x0, 0, 0},
+  {1978, 0x0, 0, 0}, {1979, 0x0, 0, 0}, {1980, 0x0, 0, 0},
+  {1981, 0x0, 0, 0}, {1982, 0x0, 0, 0}, {1983, 0x0, 0, 0},
+  {1984, 0x0, 0, 0}, {1985, 0x0, 0, 0}, {2445, 0x0, 0, 0},
+  {2446, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {6455, 0x3, 12, 1}, {6459, 0x3, 12, 1}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {262, 0x0, 0, 0},
+  {263, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {2269, 0x0, 0, 0}, {2270, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {6469, 0x3, 10, 1},
+  {6473, 0x3, 10, 1}, {6393, 0x3, 22, 1}, {6183, 0x3, 22, 1},
+  {6403, 0x3, 22, 1}, {6209, 0x3, 22, 1}, {0, 0x0, 0, 0},
+  {6419, 0x3, 12, 1}, {6423, 0x1f, 16, 1}, {6463, 0x3, 12, 1},
+  {294, 0x0, 0, 0}, {698, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {1555, 0x0, 0, 0}, {0, 0x0, 0, 0}, {6477, 0x3, 22, 1},
+  {6487, 0x3, 12, 1}, {6491, 0x3, 12, 1}, {0, 0x0, 0, 0},
+  {6495, 0x3, 12, 1}, {2073, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {2074, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {2075, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {2062, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {2063, 0x0, 0, 0}, {995, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {996, 0x0, 0, 0},
+  {6511, 0x3, 19, 1}, {6531, 0x3, 19, 1}, {6541, 0x3, 19, 1},
+  {6551, 0x3, 19, 1}, {6515, 0x1, 16, 1}, {0, 0x0, 0, 0},
+  {6525, 0x1, 16, 1}, {0, 0x0, 0, 0}, {6517, 0x3, 12, 1},
+  {6521, 0x3, 12, 1}, {1841, 0x0, 0, 0}, {1842, 0x0, 0, 0},
+  {1843, 0x0, 0, 0}, {1844, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {1835, 0x0, 0, 0}, {1836, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {6527, 0x3, 12, 1}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {1845, 0x0, 0, 0},
+  {6515, 0x1, 16, 1}, {0, 0x0, 0, 0}, {6525, 0x1, 16, 1},
+  {6535, 0x1, 16, 1}, {0, 0x0, 0, 0}, {6537, 0x3, 12, 1},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {1833, 0x0, 0, 0},
+  {1834, 0x0, 0, 0}, {6545, 0x1, 16, 1}, {0, 0x0, 0, 0},
+  {6525, 0x1, 16, 1}, {0, 0x0, 0, 0}, {6517, 0x3, 12, 1},
+  {6547, 0x3, 12, 1}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {1839, 0x0, 0, 0}, {1840, 0x0, 0, 0}, {6545, 0x1, 16, 1},
+  {0, 0x0, 0, 0}, {6525, 0x1, 16, 1}, {6555, 0x1, 16, 1},
+  {0, 0x0, 0, 0}, {6557, 0x3, 12, 1}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {1837, 0x0, 0, 0}, {1838, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {6507, 0x3, 22, 1}, {0, 0x0, 0, 0},
+  {1242, 0x0, 0, 0}, {6567, 0x3, 10, 1}, {6571, 0x3, 10, 1},
+  {6481, 0x19, 0, 2}, {6183, 0x3, 22, 1}, {6483, 0x3, 22, 1},
+  {6209, 0x3, 22, 1}, {6499, 0x3, 12, 1}, {6503, 0x3, 12, 1},
+  {6561, 0xa, 0, 2}, {6563, 0x12, 0, 2}, {6607, 0x1, 13, 1},
+  {6609, 0x1, 13, 1}, {6611, 0x1, 13, 1}, {6613, 0x1, 13, 1},
+  {6615, 0x1, 13, 1}, {6617, 0x1, 13, 1}, {0, 0x0, 0, 0},
+  {6619, 0x1, 13, 1}, {6621, 0x1, 13, 1}, {6623, 0x1, 13, 1},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {2352, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {2353, 0x0, 0, 0}, {0, 0x0, 0, 0}, {2354, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {2355, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {2356, 0x0, 0, 0}, {0, 0x0, 0, 0}, {2357, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {2358, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {2359, 0x0, 0, 0}, {0, 0x0, 0, 0}, {2360, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {6657, 0x1, 13, 1}, {6659, 0x1, 13, 1},
+  {0, 0x0, 0, 0}, {6661, 0x1, 13, 1}, {6663, 0x1, 13, 1},
+  {6665, 0x1, 13, 1}, {0, 0x0, 0, 0}, {6667, 0x1, 13, 1},
+  {6669, 0x1, 13, 1}, {6671, 0x1, 13, 1}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {1558, 0x0, 0, 0}, {0, 0x0, 0, 0}, {1559, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {1560, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {1561, 0x0, 0, 0}, {0, 0x0, 0, 0}, {1562, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {1563, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {1564, 0x0, 0, 0}, {0, 0x0, 0, 0}, {1565, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {6705, 0x1, 13, 1}, {6707, 0x1, 13, 1},
+  {6709, 0x1, 13, 1}, {0, 0x0, 0, 0}, {6711, 0x1, 13, 1},
+  {6713, 0x1, 13, 1}, {0, 0x0, 0, 0}, {6715, 0x1, 13, 1},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {2228, 0x0, 0, 0}, {0, 0x0, 0, 0}, {2229, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {2230, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {2231, 0x0, 0, 0}, {0, 0x0, 0, 0}, {2232, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {2233, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {6721, 0x1, 12, 1}, {6723, 0x1, 12, 1}, {0, 0x0, 0, 0},
+  {6725, 0x1, 12, 1}, {6575, 0x1f, 16, 1}, {6035, 0x17, 0, 2},
+  {6625, 0x1f, 16, 1}, {6103, 0x17, 0, 2}, {6673, 0x1f, 16, 1},
+  {6171, 0x17, 0, 2}, {0, 0x0, 0, 0}, {1809, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {2693, 0x0, 0, 0}, {6735, 0x3, 19, 1},
+  {6751, 0x3, 19, 1}, {6761, 0x3, 19, 1}, {6781, 0x3, 19, 1},
+  {6739, 0x1, 16, 1}, {0, 0x0, 0, 0}, {6745, 0x1, 16, 1},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {6741, 0x3, 12, 1},
+  {479, 0x0, 0, 0}, {480, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {6747, 0x3, 12, 1}, {0, 0x0, 0, 0},
+  {481, 0x0, 0, 0}, {482, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {483, 0x0, 0, 0}, {6739, 0x1, 16, 1}, {0, 0x0, 0, 0},
+  {6745, 0x1, 16, 1}, {6755, 0x1, 16, 1}, {0, 0x0, 0, 0},
+  {6757, 0x3, 12, 1}, {477, 0x0, 0, 0}, {478, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {6765, 0x1, 16, 1},
+  {0, 0x0, 0, 0}, {6775, 0x1, 16, 1}, {0, 0x0, 0, 0},
+  {6767, 0x3, 12, 1}, {6771, 0x3, 12, 1}, {489, 0x0, 0, 0},
+  {490, 0x0, 0, 0}, {491, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {492, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {493, 0x0, 0, 0}, {6777, 0x3, 12, 1}, {0, 0x0, 0, 0},
+  {494, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {495, 0x0, 0, 0}, {6765, 0x1, 16, 1}, {0, 0x0, 0, 0},
+  {6775, 0x1, 16, 1}, {6785, 0x1, 16, 1}, {6787, 0x3, 12, 1},
+  {6791, 0x3, 12, 1}, {484, 0x0, 0, 0}, {485, 0x0, 0, 0},
+  {486, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {487, 0x0, 0, 0}, {0, 0x0, 0, 0}, {488, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {6731, 0x3, 22, 1}, {6799, 0x3, 12, 1},
+  {6803, 0x3, 12, 1}, {0, 0x0, 0, 0}, {1149, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {1150, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {1151, 0x0, 0, 0},
+  {6809, 0x3, 10, 1}, {6813, 0x3, 10, 1}, {6717, 0x3, 22, 1},
+  {6183, 0x3, 22, 1}, {0, 0x0, 0, 0}, {6209, 0x3, 22, 1},
+  {6727, 0x1a, 0, 2}, {6729, 0x1b, 0, 2}, {6795, 0xa, 0, 2},
+  {6797, 0x1, 23, 1}, {1120, 0x0, 0, 0}, {1121, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {1122, 0x0, 0, 0}, {6825, 0x3, 19, 1},
+  {6831, 0x3, 19, 1}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {6829, 0x1, 11, 1}, {6829, 0x1, 11, 1},
+  {6829, 0x1, 11, 1}, {128, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {6829, 0x1, 11, 1}, {6829, 0x1, 11, 1}, {6829, 0x1, 11, 1},
+  {6829, 0x1, 11, 1}, {127, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {132, 0x0, 0, 0}, {132, 0x0, 0, 0}, {6843, 0x3, 19, 1},
+  {6849, 0x3, 19, 1}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {6847, 0x1, 11, 1}, {6847, 0x1, 11, 1},
+  {6847, 0x1, 11, 1}, {129, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {6847, 0x1, 11, 1}, {6847, 0x1, 11, 1}, {6847, 0x1, 11, 1},
+  {6847, 0x1, 11, 1}, {6857, 0x3, 19, 1}, {6863, 0x3, 19, 1},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {6861, 0x1, 11, 1}, {6861, 0x1, 11, 1}, {6861, 0x1, 11, 1},
+  {130, 0x0, 0, 0}, {0, 0x0, 0, 0}, {6861, 0x1, 11, 1},
+  {6861, 0x1, 11, 1}, {6861, 0x1, 11, 1}, {6861, 0x1, 11, 1},
+  {6871, 0x3, 19, 1}, {6877, 0x3, 19, 1}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {6875, 0x1, 11, 1},
+  {6875, 0x1, 11, 1}, {6875, 0x1, 11, 1}, {131, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {6875, 0x1, 11, 1}, {6875, 0x1, 11, 1},
+  {6875, 0x1, 11, 1}, {6875, 0x1, 11, 1}, {6885, 0x1, 10, 1},
+  {6887, 0x1, 10, 1}, {6889, 0x1, 10, 1}, {6891, 0x1, 10, 1},
+  {0, 0x0, 0, 0}, {6821, 0x3, 22, 1}, {6835, 0x3, 22, 1},
+  {6839, 0x3, 22, 1}, {0, 0x0, 0, 0}, {6853, 0x3, 22, 1},
+  {133, 0x0, 0, 0}, {6867, 0x3, 22, 1}, {6817, 0x3, 22, 1},
+  {6881, 0x3, 12, 1}, {6899, 0x3, 19, 1}, {6923, 0x3, 19, 1},
+  {6933, 0x3, 19, 1}, {6933, 0x3, 19, 1}, {6903, 0x1, 13, 1},
+  {6913, 0x1, 13, 1}, {6913, 0x1, 13, 1}, {6913, 0x1, 13, 1},
+  {6905, 0x3, 10, 1}, {6909, 0x3, 10, 1}, {689, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {689, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {693, 0x0, 0, 0}, {0, 0x0, 0, 0}, {693, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {6915, 0x3, 10, 1}, {6919, 0x3, 10, 1},
+  {689, 0x0, 0, 0}, {690, 0x0, 0, 0}, {689, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {693, 0x0, 0, 0}, {691, 0x0, 0, 0},
+  {693, 0x0, 0, 0}, {0, 0x0, 0, 0}, {6927, 0x1, 13, 1},
+  {6927, 0x1, 13, 1}, {6927, 0x1, 13, 1}, {6927, 0x1, 13, 1},
+  {6929, 0x3, 10, 1}, {6919, 0x3, 10, 1}, {0, 0x0, 0, 0},
+  {690, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {6937, 0x1, 13, 1}, {6937, 0x1, 13, 1}, {6937, 0x1, 13, 1},
+  {6937, 0x1, 13, 1}, {6939, 0x3, 10, 1}, {6909, 0x3, 10, 1},
+  {692, 0x0, 0, 0}, {0, 0x0, 0, 0}, {692, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {6895, 0x3, 22, 1},
+  {6817, 0x3, 22, 1}, {6943, 0x1, 12, 1}, {448, 0x0, 0, 0},
+  {449, 0x0, 0, 0}, {0, 0x0, 0, 0}, {450, 0x0, 0, 0},
+  {6955, 0x3, 19, 1}, {6975, 0x3, 19, 1}, {6985, 0x3, 19, 1},
+  {6985, 0x3, 19, 1}, {6959, 0x1, 13, 1}, {6969, 0x1, 13, 1},
+  {6969, 0x1, 13, 1}, {6969, 0x1, 13, 1}, {6961, 0x3, 10, 1},
+  {6965, 0x3, 10, 1}, {81, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {81, 0x0, 0, 0}, {0, 0x0, 0, 0}, {85, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {85, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {6971, 0x3, 10, 1}, {6965, 0x3, 10, 1}, {81, 0x0, 0, 0},
+  {82, 0x0, 0, 0}, {81, 0x0, 0, 0}, {83, 0x0, 0, 0},
+  {6979, 0x1, 13, 1}, {6979, 0x1, 13, 1}, {6979, 0x1, 13, 1},
+  {6979, 0x1, 13, 1}, {6981, 0x3, 10, 1}, {6965, 0x3, 10, 1},
+  {0, 0x0, 0, 0}, {82, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {83, 0x0, 0, 0}, {6989, 0x1, 13, 1}, {6989, 0x1, 13, 1},
+  {6989, 0x1, 13, 1}, {6989, 0x1, 13, 1}, {6991, 0x3, 10, 1},
+  {6965, 0x3, 10, 1}, {84, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {84, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {6951, 0x3, 22, 1}, {6947, 0x3, 22, 1}, {6995, 0x1, 12, 1},
+  {7003, 0x3, 19, 1}, {7009, 0x3, 19, 1}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {7007, 0x1, 11, 1},
+  {7007, 0x1, 11, 1}, {7007, 0x1, 11, 1}, {998, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {7007, 0x1, 11, 1}, {7007, 0x1, 11, 1},
+  {7007, 0x1, 11, 1}, {7007, 0x1, 11, 1}, {7017, 0x3, 19, 1},
+  {7023, 0x3, 19, 1}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {7021, 0x1, 11, 1}, {7021, 0x1, 11, 1},
+  {7021, 0x1, 11, 1}, {0, 0x0, 0, 0}, {999, 0x0, 0, 0},
+  {7021, 0x1, 11, 1}, {7021, 0x1, 11, 1}, {7021, 0x1, 11, 1},
+  {7021, 0x1, 11, 1}, {7031, 0x1, 10, 1}, {7033, 0x1, 10, 1},
+  {7035, 0x1, 10, 1}, {7037, 0x1, 10, 1}, {752, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {753, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {6999, 0x3, 22, 1}, {0, 0x0, 0, 0},
+  {7013, 0x3, 22, 1}, {6947, 0x3, 22, 1}, {7027, 0x3, 12, 1},
+  {7043, 0x3, 22, 1}, {7047, 0x3, 22, 1}, {124, 0x0, 0, 0},
+  {125, 0x0, 0, 0}, {0, 0x0, 0, 0}, {126, 0x0, 0, 0},
+  {7051, 0xf, 10, 1}, {7067, 0xf, 10, 1}, {7083, 0xf, 10, 1},
+  {7083, 0xf, 10, 1}, {0, 0x0, 0, 0}, {128, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {127, 0x0, 0, 0},
+  {129, 0x0, 0, 0}, {127, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {130, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {133, 0x0, 0, 0}, {131, 0x0, 0, 0},
+  {133, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {128, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {129, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {130, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {133, 0x0, 0, 0},
+  {131, 0x0, 0, 0}, {133, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {132, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {132, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {133, 0x0, 0, 0}, {0, 0x0, 0, 0}, {133, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {7043, 0x3, 22, 1}, {7101, 0x3, 22, 1},
+  {7105, 0xf, 10, 1}, {7121, 0xf, 10, 1}, {7137, 0xf, 10, 1},
+  {7137, 0xf, 10, 1}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {689, 0x0, 0, 0},
+  {690, 0x0, 0, 0}, {689, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {693, 0x0, 0, 0}, {691, 0x0, 0, 0},
+  {693, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {690, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {693, 0x0, 0, 0},
+  {691, 0x0, 0, 0}, {693, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {692, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {692, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {693, 0x0, 0, 0}, {0, 0x0, 0, 0}, {693, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {7155, 0x3, 22, 1}, {7159, 0x3, 22, 1},
+  {78, 0x0, 0, 0}, {79, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {80, 0x0, 0, 0}, {7163, 0xf, 10, 1}, {7179, 0xf, 10, 1},
+  {7195, 0xf, 10, 1}, {7195, 0xf, 10, 1}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {81, 0x0, 0, 0}, {82, 0x0, 0, 0}, {81, 0x0, 0, 0},
+  {83, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {85, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {85, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {82, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {83, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {85, 0x0, 0, 0}, {0, 0x0, 0, 0}, {85, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {84, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {84, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {85, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {85, 0x0, 0, 0}, {0, 0x0, 0, 0}, {7155, 0x3, 22, 1},
+  {7213, 0x3, 22, 1}, {7217, 0xf, 10, 1}, {7217, 0xf, 10, 1},
+  {7233, 0xf, 10, 1}, {7233, 0xf, 10, 1}, {752, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {752, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {753, 0x0, 0, 0}, {0, 0x0, 0, 0}, {753, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {998, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {999, 0x0, 0, 0},
+  {752, 0x0, 0, 0}, {0, 0x0, 0, 0}, {752, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {753, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {753, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {7251, 0x1, 13, 1}, {1079, 0x0, 0, 0},
+  {7253, 0x1, 4, 1}, {7255, 0x1, 4, 1}, {2562, 0x0, 0, 0},
+  {2563, 0x0, 0, 0}, {2564, 0x0, 0, 0}, {2565, 0x0, 0, 0},
+  {7259, 0x1, 13, 1}, {1079, 0x0, 0, 0}, {7261, 0x1, 4, 1},
+  {7263, 0x1, 4, 1}, {1075, 0x0, 0, 0}, {1076, 0x0, 0, 0},
+  {1077, 0x0, 0, 0}, {1078, 0x0, 0, 0}, {426, 0x0, 0, 0},
+  {427, 0x0, 0, 0}, {341, 0x0, 0, 0}, {342, 0x0, 0, 0},
+  {1846, 0x0, 0, 0}, {1846, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {1847, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {1848, 0x0, 0, 0},
+  {1849, 0x0, 0, 0}, {1850, 0x0, 0, 0}, {1851, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {7305, 0x1f, 16, 1},
+  {0, 0x0, 0, 0}, {7337, 0x1f, 16, 1}, {7369, 0x1f, 16, 1},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {2065, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {2066, 0x0, 0, 0}, {2067, 0x0, 0, 0},
+  {2068, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {2069, 0x0, 0, 0},
+  {2070, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {7403, 0x1, 13, 1}, {7405, 0x1, 13, 1}, {7265, 0x1, 4, 1},
+  {7267, 0x1, 4, 1}, {7269, 0x1f, 16, 1}, {7301, 0x3, 22, 1},
+  {7409, 0x1, 13, 1}, {0, 0x0, 0, 0}, {7411, 0x1, 4, 1},
+  {7413, 0x1, 4, 1}, {1720, 0x0, 0, 0}, {1721, 0x0, 0, 0},
+  {1722, 0x0, 0, 0}, {1723, 0x0, 0, 0}, {572, 0x0, 0, 0},
+  {573, 0x0, 0, 0}, {292, 0x0, 0, 0}, {293, 0x0, 0, 0},
+  {7423, 0x7, 10, 1}, {7423, 0x7, 10, 1}, {7431, 0x7, 10, 1},
+  {7439, 0x7, 10, 1}, {1279, 0x0, 0, 0}, {1280, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {1281, 0x0, 0, 0}, {1282, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {1283, 0x0, 0, 0}, {1283, 0x0, 0, 0},
+  {1283, 0x0, 0, 0}, {1283, 0x0, 0, 0}, {1284, 0x0, 0, 0},
+  {1285, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {1286, 0x0, 0, 0}, {1286, 0x0, 0, 0}, {1286, 0x0, 0, 0},
+  {1286, 0x0, 0, 0}, {7451, 0x7, 10, 1}, {7451, 0x7, 10, 1},
+  {7459, 0x7, 10, 1}, {7467, 0x7, 10, 1}, {2520, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {2521, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {2522, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {7477, 0x1, 13, 1},
+  {7479, 0x1, 13, 1}, {7415, 0x1, 4, 1}, {7417, 0x1, 4, 1},
+  {7419, 0x3, 22, 1}, {7447, 0x3, 22, 1}, {0, 0x0, 0, 0},
+  {7485, 0x7, 10, 1}, {7493, 0x7, 10, 1}, {7501, 0x7, 10, 1},
+  {539, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {540, 0x0, 0, 0},
+  {541, 0x0, 0, 0}, {540, 0x0, 0, 0}, {541, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {542, 0x0, 0, 0}, {543, 0x0, 0, 0},
+  {542, 0x0, 0, 0}, {543, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {7513, 0x1, 12, 1},
+  {0, 0x0, 0, 0}, {7515, 0x1, 10, 1}, {0, 0x0, 0, 0},
+  {1345, 0x0, 0, 0}, {1346, 0x0, 0, 0}, {7477, 0x1, 13, 1},
+  {7519, 0x1, 13, 1}, {7481, 0x3, 22, 1}, {7509, 0x3, 22, 1},
+  {0, 0x0, 0, 0}, {7525, 0x7, 10, 1}, {7533, 0x7, 10, 1},
+  {7541, 0x7, 10, 1}, {1812, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {1813, 0x0, 0, 0}, {1814, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {1815, 0x0, 0, 0},
+  {1816, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {7553, 0x7, 10, 1}, {0, 0x0, 0, 0}, {545, 0x0, 0, 0},
+  {546, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {7477, 0x1, 13, 1}, {7563, 0x1, 13, 1},
+  {7521, 0x3, 22, 1}, {7549, 0x3, 22, 1}, {0, 0x0, 0, 0},
+  {7569, 0x7, 10, 1}, {7577, 0x7, 10, 1}, {7585, 0x7, 10, 1},
+  {0, 0x0, 0, 0}, {2244, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {2245, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {2246, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {7477, 0x1, 13, 1}, {7595, 0x1, 13, 1}, {0, 0x0, 0, 0},
+  {7565, 0x3, 22, 1}, {1739, 0x0, 0, 0}, {1740, 0x0, 0, 0},
+  {1083, 0x0, 0, 0}, {1084, 0x0, 0, 0}, {2305, 0x0, 0, 0},
+  {2306, 0x0, 0, 0}, {2307, 0x0, 0, 0}, {2308, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {2309, 0x0, 0, 0},
+  {2310, 0x0, 0, 0}, {2627, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {2018, 0x0, 0, 0}, {2019, 0x0, 0, 0}, {2036, 0x0, 0, 0},
+  {2037, 0x0, 0, 0}, {0, 0x0, 0, 0}, {1328, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {2268, 0x0, 0, 0}, {7621, 0x1, 4, 1},
+  {7623, 0x1, 4, 1}, {1378, 0x0, 0, 0}, {1379, 0x0, 0, 0},
+  {1380, 0x0, 0, 0}, {0, 0x0, 0, 0}, {7627, 0x1, 4, 1},
+  {7629, 0x1, 4, 1}, {1314, 0x0, 0, 0}, {1315, 0x0, 0, 0},
+  {1316, 0x0, 0, 0}, {0, 0x0, 0, 0}, {2203, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {7641, 0x1, 16, 1}, {7643, 0x1, 16, 1},
+  {0, 0x0, 0, 0}, {7645, 0x1, 16, 1}, {7663, 0x1, 16, 1},
+  {0, 0x0, 0, 0}, {7665, 0x1, 16, 1}, {0, 0x0, 0, 0},
+  {7609, 0x1, 17, 1}, {0, 0x0, 0, 0}, {7611, 0x1, 17, 1},
+  {7613, 0x1, 17, 1}, {7647, 0x7, 10, 1}, {7655, 0x7, 10, 1},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {7615, 0x1, 17, 1}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {7617, 0x1, 17, 1}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {7619, 0x1, 17, 1}, {7625, 0x1, 17, 1},
+  {7631, 0x1, 17, 1}, {0, 0x0, 0, 0}, {7669, 0x1, 13, 1},
+  {7671, 0x1, 13, 1}, {7597, 0x1, 4, 1}, {7599, 0x1, 4, 1},
+  {7601, 0x7, 10, 1}, {7633, 0x7, 18, 1}, {2254, 0x0, 0, 0},
+  {2255, 0x0, 0, 0}, {1556, 0x0, 0, 0}, {1557, 0x0, 0, 0},
+  {1206, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {7693, 0x1, 4, 1},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {1207, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {2217, 0x0, 0, 0}, {2218, 0x0, 0, 0}, {2566, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {7715, 0x1, 4, 1}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {7717, 0x1, 4, 1}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {952, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {953, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {2303, 0x0, 0, 0}, {2304, 0x0, 0, 0}, {276, 0x0, 0, 0},
+  {277, 0x0, 0, 0}, {0, 0x0, 0, 0}, {2299, 0x0, 0, 0},
+  {2545, 0x0, 0, 0}, {2546, 0x0, 0, 0}, {1866, 0x0, 0, 0},
+  {1867, 0x0, 0, 0}, {0, 0x0, 0, 0}, {544, 0x0, 0, 0},
+  {7735, 0x1, 20, 1}, {7741, 0x1, 20, 1}, {7747, 0x1, 20, 1},
+  {7753, 0x1, 20, 1}, {7737, 0x1, 9, 1}, {7739, 0x1, 9, 1},
+  {7673, 0x1, 4, 1}, {7675, 0x1, 4, 1}, {7677, 0xf, 16, 1},
+  {0, 0x0, 0, 0}, {7743, 0x1, 9, 1}, {7745, 0x1, 9, 1},
+  {7695, 0x1, 4, 1}, {7697, 0x1, 4, 1}, {7699, 0xf, 16, 1},
+  {0, 0x0, 0, 0}, {7749, 0x1, 9, 1}, {7751, 0x1, 9, 1},
+  {7719, 0x1, 4, 1}, {7721, 0x1, 4, 1}, {7723, 0x1c, 0, 2},
+  {0, 0x0, 0, 0}, {7755, 0x1, 9, 1}, {7757, 0x1, 9, 1},
+  {7725, 0x1, 4, 1}, {7727, 0x1, 4, 1}, {7729, 0x1d, 0, 2},
+  {0, 0x0, 0, 0}, {7761, 0x1, 4, 1}, {7763, 0x1, 4, 1},
+  {1751, 0x0, 0, 0}, {1752, 0x0, 0, 0}, {1753, 0x0, 0, 0},
+  {1754, 0x0, 0, 0}, {7731, 0x3, 22, 1}, {7759, 0x1, 13, 1},
+  {2271, 0x0, 0, 0}, {2272, 0x0, 0, 0}, {311, 0x0, 0, 0},
+  {312, 0x0, 0, 0}, {313, 0x0, 0, 0}, {314, 0x0, 0, 0},
+  {315, 0x0, 0, 0}, {316, 0x0, 0, 0}, {317, 0x0, 0, 0},
+  {318, 0x0, 0, 0}, {657, 0x0, 0, 0}, {658, 0x0, 0, 0},
+  {659, 0x0, 0, 0}, {0, 0x0, 0, 0}, {660, 0x0, 0, 0},
+  {661, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {926, 0x0, 0, 0}, {7795, 0xf, 6, 1},
+  {7811, 0xf, 6, 1}, {7827, 0xf, 6, 1}, {7843, 0xf, 6, 1},
+  {7859, 0xf, 6, 1}, {7875, 0xf, 6, 1}, {7891, 0xf, 6, 1},
+  {7907, 0xf, 6, 1}, {1741, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {1742, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {1743, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {1744, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {1745, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {1746, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {1747, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {1748, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {7769, 0x7, 16, 1}, {7777, 0x7, 16, 1}, {7785, 0x6, 0, 2},
+  {7787, 0x7, 16, 1}, {7931, 0x1f, 16, 1}, {7963, 0x1f, 16, 1},
+  {7995, 0x1f, 16, 1}, {8027, 0x1f, 16, 1}, {2612, 0x0, 0, 0},
+  {2613, 0x0, 0, 0}, {2614, 0x0, 0, 0}, {2615, 0x0, 0, 0},
+  {2616, 0x0, 0, 0}, {0, 0x0, 0, 0}, {2617, 0x0, 0, 0},
+  {2618, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {2575, 0x0, 0, 0}, {0, 0x0, 0, 0}, {2619, 0x0, 0, 0},
+  {2620, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {2576, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {2576, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {2576, 0x0, 0, 0}, {0, 0x0, 0, 0}, {2576, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {2612, 0x0, 0, 0}, {2613, 0x0, 0, 0},
+  {2614, 0x0, 0, 0}, {2615, 0x0, 0, 0}, {2616, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {2617, 0x0, 0, 0}, {2618, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {2619, 0x0, 0, 0}, {2620, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {2577, 0x0, 0, 0}, {2578, 0x0, 0, 0},
+  {2579, 0x0, 0, 0}, {2580, 0x0, 0, 0}, {2581, 0x0, 0, 0},
+  {2582, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {2583, 0x0, 0, 0}, {2584, 0x0, 0, 0}, {2585, 0x0, 0, 0},
+  {2586, 0x0, 0, 0}, {2587, 0x0, 0, 0}, {2588, 0x0, 0, 0},
+  {2612, 0x0, 0, 0}, {2613, 0x0, 0, 0}, {2614, 0x0, 0, 0},
+  {2615, 0x0, 0, 0}, {2616, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {2617, 0x0, 0, 0}, {2618, 0x0, 0, 0}, {2589, 0x0, 0, 0},
+  {2590, 0x0, 0, 0}, {2591, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {2619, 0x0, 0, 0}, {2620, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {2592, 0x0, 0, 0},
+  {2593, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {2594, 0x0, 0, 0}, {2595, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {2612, 0x0, 0, 0},
+  {2613, 0x0, 0, 0}, {2614, 0x0, 0, 0}, {2615, 0x0, 0, 0},
+  {2616, 0x0, 0, 0}, {0, 0x0, 0, 0}, {2617, 0x0, 0, 0},
+  {2618, 0x0, 0, 0}, {2596, 0x0, 0, 0}, {2597, 0x0, 0, 0},
+  {2598, 0x0, 0, 0}, {2599, 0x0, 0, 0}, {2619, 0x0, 0, 0},
+  {2620, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {2600, 0x0, 0, 0}, {2601, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {2602, 0x0, 0, 0}, {2603, 0x0, 0, 0},
+  {2604, 0x0, 0, 0}, {2605, 0x0, 0, 0}, {2606, 0x0, 0, 0},
+  {2607, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {2608, 0x0, 0, 0}, {2609, 0x0, 0, 0}, {2610, 0x0, 0, 0},
+  {2611, 0x0, 0, 0}, {8061, 0x1, 13, 1}, {8063, 0x1, 13, 1},
+  {7767, 0x1, 4, 1}, {0, 0x0, 0, 0}, {7923, 0x3, 19, 1},
+  {7927, 0x3, 22, 1}, {8069, 0x1, 9, 1}, {8071, 0x1, 9, 1},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {1371, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {1372, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {1119, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {339, 0x0, 0, 0}, {0, 0x0, 0, 0}, {589, 0x0, 0, 0},
+  {8083, 0x1, 9, 1}, {8085, 0x1, 9, 1}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {2337, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {2338, 0x0, 0, 0}, {0, 0x0, 0, 0}, {8091, 0x1, 10, 1},
+  {0, 0x0, 0, 0}, {8093, 0x1, 10, 1}, {8095, 0x1, 10, 1},
+  {8075, 0x1f, 0, 2}, {0, 0x0, 0, 0}, {275, 0x0, 0, 0},
+  {8077, 0x20, 0, 2}, {8079, 0x3, 22, 1}, {0, 0x0, 0, 0},
+  {8087, 0x3, 12, 1}, {0, 0x0, 0, 0}, {2573, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {1128, 0x0, 0, 0},
+  {8107, 0x1, 10, 1}, {0, 0x0, 0, 0}, {8109, 0x1, 10, 1},
+  {8111, 0x1, 10, 1}, {0, 0x0, 0, 0}, {8099, 0x1, 9, 1},
+  {813, 0x0, 0, 0}, {0, 0x0, 0, 0}, {8101, 0x20, 0, 2},
+  {0, 0x0, 0, 0}, {8103, 0x3, 12, 1}, {0, 0x0, 0, 0},
+  {8117, 0x1, 16, 1}, {8119, 0x1, 16, 1}, {8073, 0x1e, 0, 2},
+  {0, 0x0, 0, 0}, {8097, 0x1, 11, 1}, {8113, 0x1, 11, 1},
+  {0, 0x0, 0, 0}, {8115, 0x1, 19, 1}, {8065, 0x3, 22, 1},
+  {8121, 0xa, 0, 2}, {8129, 0x1, 20, 1}, {8133, 0x1, 20, 1},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {8131, 0x1, 9, 1},
+  {0, 0x0, 0, 0}, {1012, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {8135, 0x1, 9, 1}, {0, 0x0, 0, 0}, {1013, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {1381, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {1793, 0x0, 0, 0}, {1794, 0x0, 0, 0}, {8143, 0x1, 4, 1},
+  {8145, 0x1, 4, 1}, {8123, 0x1, 20, 1}, {8125, 0x3, 22, 1},
+  {8137, 0x1, 13, 1}, {8139, 0x1, 13, 1}, {8151, 0x1, 4, 1},
+  {8153, 0x1, 4, 1}, {8155, 0x1, 4, 1}, {8157, 0x1, 4, 1},
+  {457, 0x0, 0, 0}, {458, 0x0, 0, 0}, {459, 0x0, 0, 0},
+  {460, 0x0, 0, 0}, {461, 0x0, 0, 0}, {462, 0x0, 0, 0},
+  {463, 0x0, 0, 0}, {464, 0x0, 0, 0}, {8161, 0x1, 12, 1},
+  {8195, 0x1, 12, 1}, {0, 0x0, 0, 0}, {8163, 0x1f, 0, 1},
+  {228, 0x0, 0, 0}, {228, 0x0, 0, 0}, {228, 0x0, 0, 0},
+  {228, 0x0, 0, 0}, {228, 0x0, 0, 0}, {228, 0x0, 0, 0},
+  {228, 0x0, 0, 0}, {228, 0x0, 0, 0}, {228, 0x0, 0, 0},
+  {228, 0x0, 0, 0}, {228, 0x0, 0, 0}, {228, 0x0, 0, 0},
+  {228, 0x0, 0, 0}, {228, 0x0, 0, 0}, {228, 0x0, 0, 0},
+  {228, 0x0, 0, 0}, {229, 0x0, 0, 0}, {229, 0x0, 0, 0},
+  {229, 0x0, 0, 0}, {229, 0x0, 0, 0}, {229, 0x0, 0, 0},
+  {229, 0x0, 0, 0}, {229, 0x0, 0, 0}, {229, 0x0, 0, 0},
+  {229, 0x0, 0, 0}, {229, 0x0, 0, 0}, {229, 0x0, 0, 0},
+  {229, 0x0, 0, 0}, {229, 0x0, 0, 0}, {229, 0x0, 0, 0},
+  {229, 0x0, 0, 0}, {229, 0x0, 0, 0}, {8197, 0x1f, 0, 1},
+  {8163, 0x1f, 0, 1}, {226, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {227, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {8159, 0x1, 23, 1}, {8233, 0x1, 13, 1},
+  {8235, 0x1, 13, 1}, {8147, 0x3, 10, 1}, {8229, 0x21, 0, 2},
+  {831, 0x0, 0, 0}, {832, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {8239, 0x1, 13, 1}, {1212, 0x0, 0, 0}, {1213, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {2669, 0x0, 0, 0}, {2040, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {2041, 0x0, 0, 0}, {2042, 0x0, 0, 0},
+  {8241, 0x22, 0, 2}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {8243, 0x7, 10, 1}, {0, 0x0, 0, 0},
+  {535, 0x0, 0, 0}, {0, 0x0, 0, 0}, {536, 0x0, 0, 0},
+  {537, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {471, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {472, 0x0, 0, 0}, {473, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {2375, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {2376, 0x0, 0, 0}, {2377, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {997, 0x0, 0, 0}, {1725, 0x0, 0, 0},
+  {1726, 0x0, 0, 0}, {8301, 0x23, 0, 2}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {8303, 0x3, 11, 1}, {2368, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {2369, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {1062, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {8251, 0x1, 13, 1},
+  {8253, 0xf, 10, 1}, {8269, 0xf, 10, 1}, {8285, 0xf, 10, 1},
+  {8307, 0x24, 0, 2}, {8309, 0xf, 10, 1}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {8325, 0xf, 16, 1},
+  {2683, 0x0, 0, 0}, {2684, 0x0, 0, 0}, {8341, 0x25, 0, 2},
+  {8343, 0x1, 13, 1}, {8349, 0x1f, 16, 1}, {8393, 0x1f, 16, 1},
+  {344, 0x0, 0, 0}, {345, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {346, 0x0, 0, 0}, {347, 0x0, 0, 0}, {348, 0x0, 0, 0},
+  {349, 0x0, 0, 0}, {350, 0x0, 0, 0}, {8381, 0x1, 13, 1},
+  {8383, 0x1, 13, 1}, {8385, 0x1, 13, 1}, {8387, 0x1, 13, 1},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {8389, 0x1, 13, 1}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {356, 0x0, 0, 0}, {8391, 0x1, 13, 1}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {351, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {352, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {353, 0x0, 0, 0}, {0, 0x0, 0, 0}, {354, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {355, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {357, 0x0, 0, 0}, {0, 0x0, 0, 0}, {8425, 0x1, 13, 1},
+  {8425, 0x1, 13, 1}, {8425, 0x1, 13, 1}, {8425, 0x1, 13, 1},
+  {8425, 0x1, 13, 1}, {8425, 0x1, 13, 1}, {8425, 0x1, 13, 1},
+  {8425, 0x1, 13, 1}, {8425, 0x1, 13, 1}, {8425, 0x1, 13, 1},
+  {8425, 0x1, 13, 1}, {8425, 0x1, 13, 1}, {8425, 0x1, 13, 1},
+  {8425, 0x1, 13, 1}, {8425, 0x1, 13, 1}, {8425, 0x1, 13, 1},
+  {8425, 0x1, 13, 1}, {8425, 0x1, 13, 1}, {8425, 0x1, 13, 1},
+  {8425, 0x1, 13, 1}, {8425, 0x1, 13, 1}, {8425, 0x1, 13, 1},
+  {8425, 0x1, 13, 1}, {8425, 0x1, 13, 1}, {8425, 0x1, 13, 1},
+  {8425, 0x1, 13, 1}, {8425, 0x1, 13, 1}, {8425, 0x1, 13, 1},
+  {8425, 0x1, 13, 1}, {8425, 0x1, 13, 1}, {8425, 0x1, 13, 1},
+  {8425, 0x1, 13, 1}, {358, 0x0, 0, 0}, {359, 0x0, 0, 0},
+  {8429, 0x3, 22, 1}, {8433, 0x3, 22, 1}, {2147, 0x0, 0, 0},
+  {2148, 0x0, 0, 0}, {2149, 0x0, 0, 0}, {2150, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {2151, 0x0, 0, 0},
+  {2152, 0x0, 0, 0}, {8439, 0x3, 22, 1}, {8443, 0x3, 22, 1},
+  {2128, 0x0, 0, 0}, {2129, 0x0, 0, 0}, {2130, 0x0, 0, 0},
+  {2131, 0x0, 0, 0}, {2132, 0x0, 0, 0}, {2133, 0x0, 0, 0},
+  {2134, 0x0, 0, 0}, {2135, 0x0, 0, 0}, {93, 0x0, 0, 0},
+  {94, 0x0, 0, 0}, {466, 0x0, 0, 0}, {467, 0x0, 0, 0},
+  {8453, 0x3, 22, 1}, {8457, 0x3, 22, 1}, {1512, 0x0, 0, 0},
+  {1512, 0x0, 0, 0}, {1512, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {1513, 0x0, 0, 0}, {1513, 0x0, 0, 0}, {1513, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {8463, 0x3, 22, 1}, {8475, 0x3, 22, 1},
+  {8467, 0x7, 10, 1}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {1826, 0x0, 0, 0}, {1826, 0x0, 0, 0},
+  {1826, 0x0, 0, 0}, {1826, 0x0, 0, 0}, {1826, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {8479, 0x7, 10, 1}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {1827, 0x0, 0, 0}, {1827, 0x0, 0, 0},
+  {1827, 0x0, 0, 0}, {1827, 0x0, 0, 0}, {1827, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {8489, 0x3, 22, 1}, {8493, 0x3, 22, 1}, {1519, 0x0, 0, 0},
+  {1520, 0x0, 0, 0}, {1521, 0x0, 0, 0}, {1522, 0x0, 0, 0},
+  {1523, 0x0, 0, 0}, {1524, 0x0, 0, 0}, {1525, 0x0, 0, 0},
+  {1526, 0x0, 0, 0}, {8499, 0x3, 22, 1}, {8503, 0x3, 22, 1},
+  {2137, 0x0, 0, 0}, {2138, 0x0, 0, 0}, {2139, 0x0, 0, 0},
+  {2140, 0x0, 0, 0}, {2141, 0x0, 0, 0}, {2142, 0x0, 0, 0},
+  {2143, 0x0, 0, 0}, {2144, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {8509, 0xf, 16, 1}, {0, 0x0, 0, 0}, {476, 0x0, 0, 0},
+  {476, 0x0, 0, 0}, {476, 0x0, 0, 0}, {476, 0x0, 0, 0},
+  {476, 0x0, 0, 0}, {476, 0x0, 0, 0}, {476, 0x0, 0, 0},
+  {476, 0x0, 0, 0}, {476, 0x0, 0, 0}, {476, 0x0, 0, 0},
+  {476, 0x0, 0, 0}, {476, 0x0, 0, 0}, {476, 0x0, 0, 0},
+  {476, 0x0, 0, 0}, {476, 0x0, 0, 0}, {2234, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {2235, 0x0, 0, 0}, {2236, 0x0, 0, 0},
+  {2237, 0x0, 0, 0}, {2238, 0x0, 0, 0}, {2239, 0x0, 0, 0},
+  {2240, 0x0, 0, 0}, {508, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {509, 0x0, 0, 0}, {0, 0x0, 0, 0}, {510, 0x0, 0, 0},
+  {511, 0x0, 0, 0}, {512, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {8545, 0x1, 10, 1}, {8547, 0x1, 10, 1}, {0, 0x0, 0, 0},
+  {8549, 0x1, 10, 1}, {1910, 0x0, 0, 0}, {8507, 0x1, 30, 1},
+  {0, 0x0, 0, 0}, {8525, 0x7, 11, 1}, {0, 0x0, 0, 0},
+  {8533, 0x7, 11, 1}, {8553, 0xf, 16, 1}, {8571, 0xf, 16, 1},
+  {8569, 0x1, 10, 1}, {8569, 0x1, 10, 1}, {8569, 0x1, 10, 1},
+  {8569, 0x1, 10, 1}, {8569, 0x1, 10, 1}, {8569, 0x1, 10, 1},
+  {8569, 0x1, 10, 1}, {8569, 0x1, 10, 1}, {8569, 0x1, 10, 1},
+  {8569, 0x1, 10, 1}, {8569, 0x1, 10, 1}, {8569, 0x1, 10, 1},
+  {8569, 0x1, 10, 1}, {8569, 0x1, 10, 1}, {8569, 0x1, 10, 1},
+  {8569, 0x1, 10, 1}, {1910, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {8569, 0x1, 10, 1}, {8587, 0x1, 10, 1}, {8587, 0x1, 10, 1},
+  {8587, 0x1, 10, 1}, {8587, 0x1, 10, 1}, {8587, 0x1, 10, 1},
+  {8587, 0x1, 10, 1}, {8587, 0x1, 10, 1}, {8587, 0x1, 10, 1},
+  {8587, 0x1, 10, 1}, {8587, 0x1, 10, 1}, {8587, 0x1, 10, 1},
+  {8587, 0x1, 10, 1}, {8587, 0x1, 10, 1}, {8587, 0x1, 10, 1},
+  {8587, 0x1, 10, 1}, {1910, 0x0, 0, 0}, {476, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {8551, 0x1, 30, 1}, {8593, 0x3, 22, 1},
+  {8613, 0x3, 22, 1}, {8597, 0xf, 10, 1}, {8597, 0xf, 10, 1},
+  {8597, 0xf, 10, 1}, {8597, 0xf, 10, 1}, {0, 0x0, 0, 0},
+  {2569, 0x0, 0, 0}, {0, 0x0, 0, 0}, {2570, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {2571, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {8597, 0xf, 10, 1}, {8597, 0xf, 10, 1}, {8617, 0xf, 10, 1},
+  {8597, 0xf, 10, 1}, {0, 0x0, 0, 0}, {2569, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {2570, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {2571, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {2568, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {8635, 0x3, 22, 1},
+  {8687, 0x3, 22, 1}, {8639, 0xf, 10, 1}, {8655, 0xf, 10, 1},
+  {8639, 0xf, 10, 1}, {8671, 0xf, 10, 1}, {0, 0x0, 0, 0},
+  {144, 0x0, 0, 0}, {0, 0x0, 0, 0}, {144, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {144, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {144, 0x0, 0, 0}, {0, 0x0, 0, 0}, {145, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {145, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {144, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {144, 0x0, 0, 0}, {0, 0x0, 0, 0}, {144, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {144, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {145, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {145, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {142, 0x0, 0, 0}, {0, 0x0, 0, 0}, {144, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {144, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {144, 0x0, 0, 0}, {0, 0x0, 0, 0}, {144, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {145, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {145, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {143, 0x0, 0, 0}, {8639, 0xf, 10, 1},
+  {8691, 0xf, 10, 1}, {8639, 0xf, 10, 1}, {8671, 0xf, 10, 1},
+  {0, 0x0, 0, 0}, {144, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {144, 0x0, 0, 0}, {0, 0x0, 0, 0}, {144, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {144, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {145, 0x0, 0, 0}, {0, 0x0, 0, 0}, {141, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {145, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {142, 0x0, 0, 0}, {0, 0x0, 0, 0}, {1295, 0x0, 0, 0},
+  {1230, 0x0, 0, 0}, {1231, 0x0, 0, 0}, {1232, 0x0, 0, 0},
+  {1233, 0x0, 0, 0}, {1933, 0x0, 0, 0}, {1934, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {1041, 0x0, 0, 0}, {1042, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {1043, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {1566, 0x0, 0, 0},
+  {1567, 0x0, 0, 0}, {8707, 0x1, 0, 2}, {1568, 0x0, 0, 0},
+  {1569, 0x0, 0, 0}, {1570, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {8709, 0x3, 22, 1}, {1571, 0x0, 0, 0}, {1572, 0x0, 0, 0},
+  {8713, 0x1f, 16, 1}, {1573, 0x0, 0, 0}, {1574, 0x0, 0, 0},
+  {1575, 0x0, 0, 0}, {8745, 0x1f, 16, 1}, {1576, 0x0, 0, 0},
+  {975, 0x0, 0, 0}, {976, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {8829, 0x1f, 16, 1},
+  {8861, 0x1f, 16, 1}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {86, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {87, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {8895, 0x1f, 16, 1}, {8927, 0x1f, 16, 1},
+  {1495, 0x0, 0, 0}, {1494, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {1495, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {447, 0x0, 0, 0},
+  {711, 0x0, 0, 0}, {712, 0x0, 0, 0}, {8793, 0x1f, 16, 1},
+  {713, 0x0, 0, 0}, {714, 0x0, 0, 0}, {715, 0x0, 0, 0},
+  {8825, 0x3, 22, 1}, {716, 0x0, 0, 0}, {717, 0x0, 0, 0},
+  {718, 0x0, 0, 0}, {8893, 0x1, 23, 1}, {719, 0x0, 0, 0},
+  {720, 0x0, 0, 0}, {721, 0x0, 0, 0}, {8959, 0x1, 0, 2},
+  {722, 0x0, 0, 0}, {8981, 0x1f, 16, 1}, {9013, 0x1f, 16, 1},
+  {9045, 0x1f, 16, 1}, {9045, 0x1f, 16, 1}, {225, 0x0, 0, 0},
+  {224, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {225, 0x0, 0, 0}, {224, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {223, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {225, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {9081, 0x1f, 16, 1},
+  {9113, 0x1f, 16, 1}, {9145, 0x1f, 16, 1}, {9177, 0x1f, 16, 1},
+  {2200, 0x0, 0, 0}, {2197, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {2200, 0x0, 0, 0},
+  {2197, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {2196, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {2200, 0x0, 0, 0}, {2199, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {2200, 0x0, 0, 0}, {2199, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {2198, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {9213, 0x1f, 16, 1},
+  {9245, 0x1f, 16, 1}, {9277, 0x1f, 16, 1}, {9309, 0x1f, 16, 1},
+  {0, 0x0, 0, 0}, {2, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {5, 0x0, 0, 0}, {6, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {2, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {5, 0x0, 0, 0}, {6, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {1, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {4, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {5, 0x0, 0, 0},
+  {6, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {4, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {5, 0x0, 0, 0}, {6, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {3, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {9345, 0x1f, 16, 1},
+  {9377, 0x1f, 16, 1}, {9409, 0x1f, 16, 1}, {9441, 0x1f, 16, 1},
+  {1892, 0x0, 0, 0}, {1889, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {1892, 0x0, 0, 0},
+  {1889, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {1888, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {1892, 0x0, 0, 0}, {1891, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {1892, 0x0, 0, 0}, {1891, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {1890, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {1687, 0x0, 0, 0},
+  {1688, 0x0, 0, 0}, {8977, 0x3, 22, 1}, {1689, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {1690, 0x0, 0, 0}, {9077, 0x3, 22, 1},
+  {1691, 0x0, 0, 0}, {1692, 0x0, 0, 0}, {1693, 0x0, 0, 0},
+  {9209, 0x3, 22, 1}, {1694, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {1695, 0x0, 0, 0}, {9341, 0x3, 22, 1}, {0, 0x0, 0, 0},
+  {1578, 0x0, 0, 0}, {1579, 0x0, 0, 0}, {9495, 0x1f, 16, 1},
+  {9527, 0x1f, 16, 1}, {9559, 0x1f, 16, 1}, {9591, 0x1f, 16, 1},
+  {0, 0x0, 0, 0}, {1608, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {1609, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {1608, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {1609, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {1607, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {1611, 0x0, 0, 0}, {1612, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {1613, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {1611, 0x0, 0, 0}, {1612, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {1613, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {1610, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {2525, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {2526, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {2201, 0x0, 0, 0}, {2202, 0x0, 0, 0}, {9633, 0x1f, 16, 1},
+  {9665, 0x1f, 16, 1}, {9697, 0x1f, 16, 1}, {9729, 0x1f, 16, 1},
+  {0, 0x0, 0, 0}, {575, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {575, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {574, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {578, 0x0, 0, 0}, {579, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {578, 0x0, 0, 0}, {579, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {576, 0x0, 0, 0}, {577, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {1577, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {524, 0x0, 0, 0}, {525, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {2736, 0x0, 0, 0}, {1885, 0x0, 0, 0},
+  {1886, 0x0, 0, 0}, {940, 0x0, 0, 0}, {941, 0x0, 0, 0},
+  {9775, 0x1f, 16, 1}, {9775, 0x1f, 16, 1}, {9807, 0x1f, 16, 1},
+  {9839, 0x1f, 16, 1}, {0, 0x0, 0, 0}, {1662, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {1663, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {1666, 0x0, 0, 0}, {1667, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {1668, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {1666, 0x0, 0, 0},
+  {1667, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {1668, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {1664, 0x0, 0, 0},
+  {1665, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {1652, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {1029, 0x0, 0, 0}, {9489, 0x1, 23, 1}, {9491, 0x3, 22, 1},
+  {9623, 0x3, 22, 1}, {0, 0x0, 0, 0}, {9627, 0x1, 23, 1},
+  {9629, 0x3, 22, 1}, {9761, 0x1, 23, 1}, {0, 0x0, 0, 0},
+  {9763, 0x1, 23, 1}, {9765, 0x26, 0, 2}, {9767, 0x1, 23, 1},
+  {0, 0x0, 0, 0}, {9769, 0x1, 23, 1}, {9771, 0x3, 22, 1},
+  {9871, 0x1, 23, 1}, {1287, 0x0, 0, 0}, {1288, 0x0, 0, 0},
+  {9895, 0x3, 19, 1}, {9909, 0x3, 19, 1}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {9899, 0x1, 13, 1}, {9903, 0x1, 13, 1},
+  {9903, 0x1, 13, 1}, {9903, 0x1, 13, 1}, {9901, 0x1, 11, 1},
+  {9901, 0x1, 11, 1}, {1882, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {9905, 0x1, 11, 1}, {9907, 0x1, 11, 1}, {1883, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {1884, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {9903, 0x1, 13, 1}, {9903, 0x1, 13, 1}, {9903, 0x1, 13, 1},
+  {9903, 0x1, 13, 1}, {0, 0x0, 0, 0}, {1363, 0x0, 0, 0},
+  {1368, 0x0, 0, 0}, {0, 0x0, 0, 0}, {9921, 0x3, 19, 1},
+  {9935, 0x3, 19, 1}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {9925, 0x1, 13, 1}, {9929, 0x1, 13, 1}, {9929, 0x1, 13, 1},
+  {9929, 0x1, 13, 1}, {9927, 0x1, 11, 1}, {9927, 0x1, 11, 1},
+  {1492, 0x0, 0, 0}, {0, 0x0, 0, 0}, {9931, 0x1, 11, 1},
+  {9933, 0x1, 11, 1}, {1708, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {1709, 0x0, 0, 0}, {0, 0x0, 0, 0}, {9929, 0x1, 13, 1},
+  {9929, 0x1, 13, 1}, {9929, 0x1, 13, 1}, {9929, 0x1, 13, 1},
+  {9941, 0x1, 10, 1}, {9943, 0x1, 10, 1}, {9889, 0x1, 13, 1},
+  {9891, 0x3, 22, 1}, {9913, 0x3, 22, 1}, {9917, 0x3, 22, 1},
+  {1369, 0x0, 0, 0}, {1370, 0x0, 0, 0}, {9951, 0x3, 19, 1},
+  {9961, 0x3, 19, 1}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {9899, 0x1, 13, 1}, {9955, 0x1, 13, 1}, {9955, 0x1, 13, 1},
+  {9955, 0x1, 13, 1}, {9957, 0x1, 11, 1}, {9959, 0x1, 11, 1},
+  {1364, 0x0, 0, 0}, {0, 0x0, 0, 0}, {1366, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {9955, 0x1, 13, 1}, {9955, 0x1, 13, 1},
+  {9955, 0x1, 13, 1}, {9955, 0x1, 13, 1}, {9969, 0x3, 19, 1},
+  {9979, 0x3, 19, 1}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {9925, 0x1, 13, 1}, {9973, 0x1, 13, 1}, {9973, 0x1, 13, 1},
+  {9973, 0x1, 13, 1}, {9975, 0x1, 11, 1}, {9977, 0x1, 11, 1},
+  {1365, 0x0, 0, 0}, {0, 0x0, 0, 0}, {1367, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {9973, 0x1, 13, 1}, {9973, 0x1, 13, 1},
+  {9973, 0x1, 13, 1}, {9973, 0x1, 13, 1}, {9985, 0x1, 10, 1},
+  {9987, 0x1, 10, 1}, {9945, 0x1, 13, 1}, {9947, 0x3, 22, 1},
+  {9913, 0x3, 22, 1}, {9965, 0x3, 22, 1}, {9993, 0x1, 13, 1},
+  {9993, 0x1, 13, 1}, {9995, 0x1, 13, 1}, {9993, 0x1, 13, 1},
+  {0, 0x0, 0, 0}, {1087, 0x0, 0, 0}, {1086, 0x0, 0, 0},
+  {1087, 0x0, 0, 0}, {10001, 0x3, 19, 1}, {10015, 0x3, 19, 1},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {10005, 0x1, 13, 1},
+  {10009, 0x1, 13, 1}, {10009, 0x1, 13, 1}, {10009, 0x1, 13, 1},
+  {10007, 0x1, 11, 1}, {10007, 0x1, 11, 1}, {1037, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {10011, 0x1, 11, 1}, {10013, 0x1, 11, 1},
+  {1038, 0x0, 0, 0}, {1039, 0x0, 0, 0}, {1040, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {10009, 0x1, 13, 1}, {10009, 0x1, 13, 1},
+  {10009, 0x1, 13, 1}, {10009, 0x1, 13, 1}, {10023, 0x1, 13, 1},
+  {0, 0x0, 0, 0}, {10025, 0x1, 13, 1}, {10025, 0x1, 13, 1},
+  {1899, 0x0, 0, 0}, {0, 0x0, 0, 0}, {1900, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {10031, 0x3, 19, 1}, {10043, 0x3, 19, 1},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {10035, 0x1, 13, 1},
+  {10039, 0x1, 13, 1}, {10039, 0x1, 13, 1}, {10039, 0x1, 13, 1},
+  {10037, 0x1, 11, 1}, {10037, 0x1, 11, 1}, {857, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {10041, 0x1, 11, 1}, {0, 0x0, 0, 0},
+  {858, 0x0, 0, 0}, {859, 0x0, 0, 0}, {10039, 0x1, 13, 1},
+  {10039, 0x1, 13, 1}, {10039, 0x1, 13, 1}, {10039, 0x1, 13, 1},
+  {10049, 0x1, 10, 1}, {10051, 0x1, 10, 1}, {9989, 0x3, 22, 1},
+  {9997, 0x3, 22, 1}, {10019, 0x3, 22, 1}, {10027, 0x3, 22, 1},
+  {10057, 0x1, 12, 1}, {10057, 0x1, 12, 1}, {10059, 0x1, 12, 1},
+  {10057, 0x1, 12, 1}, {0, 0x0, 0, 0}, {931, 0x0, 0, 0},
+  {930, 0x0, 0, 0}, {931, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {1085, 0x0, 0, 0}, {1081, 0x0, 0, 0}, {1082, 0x0, 0, 0},
+  {10067, 0x3, 22, 1}, {10087, 0x3, 22, 1}, {10071, 0x3, 19, 1},
+  {10083, 0x3, 19, 1}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {10075, 0x3, 11, 1}, {10079, 0x3, 11, 1}, {10079, 0x3, 11, 1},
+  {10079, 0x3, 11, 1}, {1373, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {1376, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {1377, 0x0, 0, 0},
+  {10079, 0x3, 11, 1}, {10079, 0x3, 11, 1}, {10079, 0x3, 11, 1},
+  {10079, 0x3, 11, 1}, {10091, 0x3, 19, 1}, {10083, 0x3, 19, 1},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {10095, 0x3, 11, 1},
+  {10079, 0x3, 11, 1}, {10079, 0x3, 11, 1}, {10079, 0x3, 11, 1},
+  {1374, 0x0, 0, 0}, {0, 0x0, 0, 0}, {1375, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {10101, 0x1, 10, 1}, {10103, 0x1, 10, 1},
+  {10053, 0x3, 22, 1}, {10061, 0x11, 0, 2}, {10063, 0x1, 12, 1},
+  {10065, 0x1, 30, 1}, {10109, 0xf, 10, 1}, {10125, 0xf, 10, 1},
+  {10141, 0xf, 10, 1}, {10157, 0xf, 10, 1}, {1287, 0x0, 0, 0},
+  {1883, 0x0, 0, 0}, {1287, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {1708, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {1288, 0x0, 0, 0}, {1884, 0x0, 0, 0},
+  {1288, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {1709, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {1287, 0x0, 0, 0}, {1883, 0x0, 0, 0}, {1287, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {1363, 0x0, 0, 0}, {1708, 0x0, 0, 0},
+  {1363, 0x0, 0, 0}, {0, 0x0, 0, 0}, {1288, 0x0, 0, 0},
+  {1884, 0x0, 0, 0}, {1288, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {1363, 0x0, 0, 0}, {1709, 0x0, 0, 0}, {1363, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {1287, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {1287, 0x0, 0, 0}, {0, 0x0, 0, 0}, {1368, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {1368, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {1288, 0x0, 0, 0}, {0, 0x0, 0, 0}, {1288, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {1368, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {1368, 0x0, 0, 0}, {0, 0x0, 0, 0}, {1287, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {1287, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {1288, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {1288, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {10177, 0xf, 10, 1}, {10193, 0xf, 10, 1}, {10209, 0xf, 10, 1},
+  {10225, 0xf, 10, 1}, {1369, 0x0, 0, 0}, {1364, 0x0, 0, 0},
+  {1369, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {1365, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {1370, 0x0, 0, 0}, {1366, 0x0, 0, 0}, {1370, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {1367, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {1369, 0x0, 0, 0},
+  {1364, 0x0, 0, 0}, {1369, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {1363, 0x0, 0, 0}, {1365, 0x0, 0, 0}, {1363, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {1370, 0x0, 0, 0}, {1366, 0x0, 0, 0},
+  {1370, 0x0, 0, 0}, {0, 0x0, 0, 0}, {1363, 0x0, 0, 0},
+  {1367, 0x0, 0, 0}, {1363, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {1369, 0x0, 0, 0}, {0, 0x0, 0, 0}, {1369, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {1368, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {1368, 0x0, 0, 0}, {0, 0x0, 0, 0}, {1370, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {1370, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {1368, 0x0, 0, 0}, {0, 0x0, 0, 0}, {1368, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {1369, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {1369, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {1370, 0x0, 0, 0}, {0, 0x0, 0, 0}, {1370, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {10245, 0xf, 10, 1},
+  {10261, 0xf, 10, 1}, {10277, 0xf, 10, 1}, {10293, 0xf, 10, 1},
+  {0, 0x0, 0, 0}, {1038, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {1039, 0x0, 0, 0}, {1899, 0x0, 0, 0}, {858, 0x0, 0, 0},
+  {1899, 0x0, 0, 0}, {859, 0x0, 0, 0}, {1087, 0x0, 0, 0},
+  {1040, 0x0, 0, 0}, {1087, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {1038, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {1039, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {858, 0x0, 0, 0}, {0, 0x0, 0, 0}, {859, 0x0, 0, 0},
+  {1087, 0x0, 0, 0}, {1040, 0x0, 0, 0}, {1087, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {1086, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {1086, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {1900, 0x0, 0, 0}, {0, 0x0, 0, 0}, {1900, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {1087, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {1087, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {1900, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {1900, 0x0, 0, 0}, {0, 0x0, 0, 0}, {1087, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {1087, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {10313, 0xf, 10, 1}, {10313, 0xf, 10, 1},
+  {10329, 0xf, 10, 1}, {10345, 0xf, 10, 1}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {931, 0x0, 0, 0}, {0, 0x0, 0, 0}, {931, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {1081, 0x0, 0, 0}, {1376, 0x0, 0, 0},
+  {1081, 0x0, 0, 0}, {0, 0x0, 0, 0}, {1082, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {1082, 0x0, 0, 0}, {1377, 0x0, 0, 0},
+  {930, 0x0, 0, 0}, {0, 0x0, 0, 0}, {930, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {931, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {931, 0x0, 0, 0}, {0, 0x0, 0, 0}, {1081, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {1081, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {1082, 0x0, 0, 0}, {0, 0x0, 0, 0}, {1082, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {931, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {931, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {1081, 0x0, 0, 0}, {0, 0x0, 0, 0}, {1081, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {1082, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {1082, 0x0, 0, 0}, {0, 0x0, 0, 0}, {10363, 0x1, 23, 1},
+  {10365, 0x1, 23, 1}, {1317, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {1318, 0x0, 0, 0}, {0, 0x0, 0, 0}, {10369, 0x3, 22, 1},
+  {10373, 0x3, 22, 1}, {2300, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {2301, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {2302, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {938, 0x0, 0, 0}, {1036, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {2043, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {2735, 0x0, 0, 0}, {0, 0x0, 0, 0}, {723, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {10389, 0x3, 22, 1}, {10409, 0x3, 22, 1},
+  {10393, 0x3, 10, 1}, {10397, 0x3, 10, 1}, {10401, 0x3, 10, 1},
+  {10405, 0x3, 10, 1}, {2697, 0x0, 0, 0}, {2698, 0x0, 0, 0},
+  {2699, 0x0, 0, 0}, {2700, 0x0, 0, 0}, {2701, 0x0, 0, 0},
+  {2702, 0x0, 0, 0}, {2703, 0x0, 0, 0}, {2704, 0x0, 0, 0},
+  {2705, 0x0, 0, 0}, {2706, 0x0, 0, 0}, {2707, 0x0, 0, 0},
+  {2708, 0x0, 0, 0}, {2709, 0x0, 0, 0}, {2710, 0x0, 0, 0},
+  {2711, 0x0, 0, 0}, {2712, 0x0, 0, 0}, {10413, 0x3, 10, 1},
+  {10417, 0x3, 10, 1}, {10421, 0x3, 10, 1}, {10425, 0x3, 10, 1},
+  {2713, 0x0, 0, 0}, {2714, 0x0, 0, 0}, {2715, 0x0, 0, 0},
+  {2716, 0x0, 0, 0}, {2717, 0x0, 0, 0}, {2718, 0x0, 0, 0},
+  {2719, 0x0, 0, 0}, {2720, 0x0, 0, 0}, {2721, 0x0, 0, 0},
+  {2722, 0x0, 0, 0}, {2723, 0x0, 0, 0}, {2724, 0x0, 0, 0},
+  {2725, 0x0, 0, 0}, {2726, 0x0, 0, 0}, {2727, 0x0, 0, 0},
+  {2728, 0x0, 0, 0}, {10431, 0x3, 22, 1}, {10499, 0x3, 22, 1},
+  {10435, 0xf, 10, 1}, {10451, 0xf, 10, 1}, {10467, 0xf, 10, 1},
+  {10483, 0xf, 10, 1}, {2637, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {1161, 0x0, 0, 0}, {0, 0x0, 0, 0}, {2638, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {1161, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {2639, 0x0, 0, 0}, {0, 0x0, 0, 0}, {1161, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {2640, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {1161, 0x0, 0, 0}, {0, 0x0, 0, 0}, {2641, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {1167, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {2642, 0x0, 0, 0}, {0, 0x0, 0, 0}, {1167, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {2643, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {1167, 0x0, 0, 0}, {0, 0x0, 0, 0}, {2644, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {1167, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {2645, 0x0, 0, 0}, {0, 0x0, 0, 0}, {1173, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {2646, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {1173, 0x0, 0, 0}, {0, 0x0, 0, 0}, {2647, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {1173, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {2648, 0x0, 0, 0}, {0, 0x0, 0, 0}, {1173, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {2649, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {1179, 0x0, 0, 0}, {0, 0x0, 0, 0}, {2650, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {1179, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {2651, 0x0, 0, 0}, {0, 0x0, 0, 0}, {1179, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {2652, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {1179, 0x0, 0, 0}, {0, 0x0, 0, 0}, {10503, 0xf, 10, 1},
+  {10519, 0xf, 10, 1}, {10535, 0xf, 10, 1}, {10551, 0xf, 10, 1},
+  {2653, 0x0, 0, 0}, {0, 0x0, 0, 0}, {1187, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {2654, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {1187, 0x0, 0, 0}, {0, 0x0, 0, 0}, {2655, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {1187, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {2656, 0x0, 0, 0}, {0, 0x0, 0, 0}, {1187, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {2657, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {1192, 0x0, 0, 0}, {0, 0x0, 0, 0}, {2658, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {1192, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {2659, 0x0, 0, 0}, {0, 0x0, 0, 0}, {1192, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {2660, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {1192, 0x0, 0, 0}, {0, 0x0, 0, 0}, {2661, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {1197, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {2662, 0x0, 0, 0}, {0, 0x0, 0, 0}, {1197, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {2663, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {1197, 0x0, 0, 0}, {0, 0x0, 0, 0}, {2664, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {1197, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {2665, 0x0, 0, 0}, {0, 0x0, 0, 0}, {1202, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {2666, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {1202, 0x0, 0, 0}, {0, 0x0, 0, 0}, {2667, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {1202, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {2668, 0x0, 0, 0}, {0, 0x0, 0, 0}, {1202, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {10569, 0x3, 22, 1}, {10637, 0x3, 22, 1},
+  {10573, 0xf, 10, 1}, {10589, 0xf, 10, 1}, {10605, 0xf, 10, 1},
+  {10621, 0xf, 10, 1}, {1159, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {1161, 0x0, 0, 0}, {0, 0x0, 0, 0}, {1160, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {1161, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {1162, 0x0, 0, 0}, {0, 0x0, 0, 0}, {1164, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {1163, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {1164, 0x0, 0, 0}, {0, 0x0, 0, 0}, {1165, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {1167, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {1166, 0x0, 0, 0}, {0, 0x0, 0, 0}, {1167, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {1168, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {1170, 0x0, 0, 0}, {0, 0x0, 0, 0}, {1169, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {1170, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {1171, 0x0, 0, 0}, {0, 0x0, 0, 0}, {1173, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {1172, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {1173, 0x0, 0, 0}, {0, 0x0, 0, 0}, {1174, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {1176, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {1175, 0x0, 0, 0}, {0, 0x0, 0, 0}, {1176, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {1177, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {1179, 0x0, 0, 0}, {0, 0x0, 0, 0}, {1178, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {1179, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {1180, 0x0, 0, 0}, {0, 0x0, 0, 0}, {1182, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {1181, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {1182, 0x0, 0, 0}, {0, 0x0, 0, 0}, {10641, 0xf, 10, 1},
+  {10657, 0xf, 10, 1}, {10673, 0xf, 10, 1}, {10689, 0xf, 10, 1},
+  {1183, 0x0, 0, 0}, {0, 0x0, 0, 0}, {1187, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {1184, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {1187, 0x0, 0, 0}, {0, 0x0, 0, 0}, {1185, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {1187, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {1186, 0x0, 0, 0}, {0, 0x0, 0, 0}, {1187, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {1188, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {1192, 0x0, 0, 0}, {0, 0x0, 0, 0}, {1189, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {1192, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {1190, 0x0, 0, 0}, {0, 0x0, 0, 0}, {1192, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {1191, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {1192, 0x0, 0, 0}, {0, 0x0, 0, 0}, {1193, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {1197, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {1194, 0x0, 0, 0}, {0, 0x0, 0, 0}, {1197, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {1195, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {1197, 0x0, 0, 0}, {0, 0x0, 0, 0}, {1196, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {1197, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {1198, 0x0, 0, 0}, {0, 0x0, 0, 0}, {1202, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {1199, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {1202, 0x0, 0, 0}, {0, 0x0, 0, 0}, {1200, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {1202, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {1201, 0x0, 0, 0}, {0, 0x0, 0, 0}, {1202, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {10707, 0x3, 22, 1}, {10775, 0x3, 22, 1},
+  {10711, 0xf, 10, 1}, {10727, 0xf, 10, 1}, {10743, 0xf, 10, 1},
+  {10759, 0xf, 10, 1}, {2208, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {1161, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {1161, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {1161, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {1161, 0x0, 0, 0}, {0, 0x0, 0, 0}, {2209, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {1167, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {1167, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {1167, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {1167, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {2210, 0x0, 0, 0}, {0, 0x0, 0, 0}, {1173, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {1173, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {1173, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {1173, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {2211, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {1179, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {1179, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {1179, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {1179, 0x0, 0, 0}, {0, 0x0, 0, 0}, {10779, 0xf, 10, 1},
+  {10795, 0xf, 10, 1}, {10811, 0xf, 10, 1}, {10827, 0xf, 10, 1},
+  {2212, 0x0, 0, 0}, {0, 0x0, 0, 0}, {1187, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {1187, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {1187, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {1187, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {2213, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {1192, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {1192, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {1192, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {1192, 0x0, 0, 0}, {0, 0x0, 0, 0}, {2214, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {1197, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {1197, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {1197, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {1197, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {2215, 0x0, 0, 0}, {0, 0x0, 0, 0}, {1202, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {1202, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {1202, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {1202, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {10845, 0x3, 22, 1}, {10913, 0x3, 22, 1},
+  {10849, 0xf, 10, 1}, {10865, 0xf, 10, 1}, {10881, 0xf, 10, 1},
+  {10897, 0xf, 10, 1}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {1161, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {1161, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {1161, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {1161, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {1167, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {1167, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {1167, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {1167, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {1893, 0x0, 0, 0}, {0, 0x0, 0, 0}, {1173, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {1173, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {1173, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {1173, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {1179, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {1179, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {1179, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {1179, 0x0, 0, 0}, {0, 0x0, 0, 0}, {10917, 0xf, 10, 1},
+  {10933, 0xf, 10, 1}, {10949, 0xf, 10, 1}, {10965, 0xf, 10, 1},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {1187, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {1187, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {1187, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {1187, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {1192, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {1192, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {1192, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {1192, 0x0, 0, 0}, {0, 0x0, 0, 0}, {1894, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {1197, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {1197, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {1197, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {1197, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {1202, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {1202, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {1202, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {1202, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {10983, 0x3, 22, 1}, {10987, 0x3, 22, 1},
+  {1700, 0x0, 0, 0}, {1701, 0x0, 0, 0}, {1702, 0x0, 0, 0},
+  {1703, 0x0, 0, 0}, {1704, 0x0, 0, 0}, {1705, 0x0, 0, 0},
+  {1706, 0x0, 0, 0}, {1707, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {1938, 0x0, 0, 0}, {0, 0x0, 0, 0}, {1646, 0x0, 0, 0},
+  {1133, 0x0, 0, 0}, {0, 0x0, 0, 0}, {1080, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {1898, 0x0, 0, 0},
+  {1134, 0x0, 0, 0}, {0, 0x0, 0, 0}, {1135, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {11007, 0x1, 22, 1}, {11013, 0x1, 22, 1},
+  {11009, 0x1, 11, 1}, {11011, 0x1, 11, 1}, {10991, 0x12, 0, 2},
+  {10993, 0x27, 0, 2}, {10995, 0x1, 4, 1}, {10997, 0x1, 4, 1},
+  {11015, 0x1, 11, 1}, {11017, 0x1, 11, 1}, {10999, 0x12, 0, 2},
+  {0, 0x0, 0, 0}, {11001, 0x1, 4, 1}, {11003, 0x1, 4, 1},
+  {0, 0x0, 0, 0}, {11005, 0x1, 30, 1}, {0, 0x0, 0, 0},
+  {1496, 0x0, 0, 0}, {11025, 0x1, 22, 1}, {11031, 0x1, 22, 1},
+  {11027, 0x1, 11, 1}, {11029, 0x1, 11, 1}, {0, 0x0, 0, 0},
+  {11021, 0x29, 0, 2}, {1133, 0x0, 0, 0}, {1080, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {11033, 0x1, 11, 1}, {1134, 0x0, 0, 0},
+  {1135, 0x0, 0, 0}, {0, 0x0, 0, 0}, {11023, 0x1, 30, 1},
+  {11039, 0x3, 22, 1}, {11047, 0x3, 22, 1}, {0, 0x0, 0, 0},
+  {11043, 0x3, 10, 1}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {10995, 0x1, 4, 1}, {0, 0x0, 0, 0}, {10997, 0x1, 4, 1},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {11051, 0x3, 10, 1},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {11001, 0x1, 4, 1},
+  {0, 0x0, 0, 0}, {11003, 0x1, 4, 1}, {0, 0x0, 0, 0},
+  {11057, 0x3, 22, 1}, {11077, 0x3, 22, 1}, {11061, 0x3, 10, 1},
+  {11065, 0x3, 10, 1}, {11069, 0x3, 10, 1}, {11073, 0x3, 10, 1},
+  {634, 0x0, 0, 0}, {635, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {636, 0x0, 0, 0}, {637, 0x0, 0, 0}, {638, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {639, 0x0, 0, 0}, {640, 0x0, 0, 0},
+  {641, 0x0, 0, 0}, {0, 0x0, 0, 0}, {642, 0x0, 0, 0},
+  {643, 0x0, 0, 0}, {644, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {645, 0x0, 0, 0}, {11081, 0x3, 10, 1}, {11085, 0x3, 10, 1},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {646, 0x0, 0, 0},
+  {647, 0x0, 0, 0}, {0, 0x0, 0, 0}, {648, 0x0, 0, 0},
+  {649, 0x0, 0, 0}, {650, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {651, 0x0, 0, 0}, {11091, 0x3, 22, 1}, {11111, 0x3, 22, 1},
+  {11095, 0x3, 10, 1}, {11099, 0x3, 10, 1}, {11103, 0x3, 10, 1},
+  {11107, 0x3, 10, 1}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {436, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {438, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {440, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {441, 0x0, 0, 0}, {0, 0x0, 0, 0}, {11115, 0x3, 10, 1},
+  {11119, 0x3, 10, 1}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {442, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {443, 0x0, 0, 0}, {0, 0x0, 0, 0}, {11125, 0x3, 22, 1},
+  {11145, 0x3, 22, 1}, {11129, 0x1, 13, 1}, {11135, 0x1, 13, 1},
+  {11141, 0x1, 13, 1}, {11143, 0x1, 13, 1}, {11095, 0x3, 10, 1},
+  {11131, 0x3, 10, 1}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {437, 0x0, 0, 0}, {0, 0x0, 0, 0}, {11099, 0x3, 10, 1},
+  {11137, 0x3, 10, 1}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {439, 0x0, 0, 0}, {0, 0x0, 0, 0}, {11103, 0x3, 10, 1},
+  {11103, 0x3, 10, 1}, {11107, 0x3, 10, 1}, {11107, 0x3, 10, 1},
+  {11149, 0x1, 13, 1}, {11151, 0x1, 13, 1}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {11115, 0x3, 10, 1}, {11115, 0x3, 10, 1},
+  {11119, 0x3, 10, 1}, {11119, 0x3, 10, 1}, {11155, 0x3, 22, 1},
+  {11159, 0x3, 22, 1}, {529, 0x0, 0, 0}, {530, 0x0, 0, 0},
+  {531, 0x0, 0, 0}, {532, 0x0, 0, 0}, {533, 0x0, 0, 0},
+  {534, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {11165, 0x3, 22, 1}, {0, 0x0, 0, 0},
+  {11169, 0xf, 10, 1}, {0, 0x0, 0, 0}, {11185, 0xf, 10, 1},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {2021, 0x0, 0, 0}, {0, 0x0, 0, 0}, {2022, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {2023, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {2024, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {2025, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {11203, 0xf, 10, 1}, {0, 0x0, 0, 0}, {1928, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {1929, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {2567, 0x0, 0, 0}, {0, 0x0, 0, 0}, {538, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {2390, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {11219, 0x2b, 0, 2}, {2391, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {2392, 0x0, 0, 0}, {11221, 0x1, 0, 2},
+  {2393, 0x0, 0, 0}, {0, 0x0, 0, 0}, {11223, 0xf, 10, 1},
+  {0, 0x0, 0, 0}, {172, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {1024, 0x0, 0, 0}, {0, 0x0, 0, 0}, {812, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {1796, 0x0, 0, 0}, {11241, 0x2b, 0, 2},
+  {1797, 0x0, 0, 0}, {0, 0x0, 0, 0}, {1798, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {1799, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {11243, 0x26, 0, 2}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {11245, 0x1, 0, 2},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {11247, 0xf, 10, 1},
+  {0, 0x0, 0, 0}, {815, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {1493, 0x0, 0, 0}, {11273, 0x1f, 16, 1}, {11305, 0x1f, 16, 1},
+  {11337, 0x1f, 16, 1}, {11369, 0x1f, 16, 1}, {0, 0x0, 0, 0},
+  {1728, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {1728, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {1727, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {1730, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {1730, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {1729, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {11405, 0x1f, 16, 1}, {11437, 0x1f, 16, 1},
+  {11469, 0x1f, 16, 1}, {11501, 0x1f, 16, 1}, {75, 0x0, 0, 0},
+  {72, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {75, 0x0, 0, 0}, {72, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {71, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {75, 0x0, 0, 0}, {74, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {75, 0x0, 0, 0},
+  {74, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {73, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {2424, 0x0, 0, 0},
+  {11265, 0x1, 0, 2}, {2425, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {11267, 0x1, 0, 2}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {11269, 0x3, 22, 1},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {2426, 0x0, 0, 0},
+  {11401, 0x3, 22, 1}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {11533, 0xf, 10, 1}, {11553, 0x1f, 16, 1}, {11585, 0x1f, 16, 1},
+  {0, 0x0, 0, 0}, {122, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {123, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {122, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {123, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {121, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {11619, 0x1f, 16, 1}, {11651, 0x1f, 16, 1},
+  {0, 0x0, 0, 0}, {2395, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {2396, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {2395, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {2396, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {2394, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {580, 0x0, 0, 0},
+  {11687, 0x1f, 16, 1}, {11719, 0x1f, 16, 1}, {1071, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {1072, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {1071, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {1072, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {1070, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {11753, 0x1f, 16, 1}, {11785, 0x1f, 16, 1}, {2118, 0x0, 0, 0},
+  {2119, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {2118, 0x0, 0, 0}, {2119, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {2116, 0x0, 0, 0}, {2117, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {1497, 0x0, 0, 0}, {11821, 0xf, 10, 1},
+  {11837, 0xf, 10, 1}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {11551, 0x1, 22, 1}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {11617, 0x1, 22, 1}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {114, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {115, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {11683, 0x2c, 0, 2}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {11685, 0x1, 22, 1}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {116, 0x0, 0, 0}, {11751, 0x1, 22, 1},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {117, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {118, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {11817, 0x2c, 0, 2}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {11819, 0x1, 23, 1}, {11857, 0x3, 19, 1},
+  {11865, 0x3, 19, 1}, {0, 0x0, 0, 0}, {11861, 0x3, 12, 1},
+  {11861, 0x3, 12, 1}, {11861, 0x3, 12, 1}, {806, 0x0, 0, 0},
+  {807, 0x0, 0, 0}, {808, 0x0, 0, 0}, {809, 0x0, 0, 0},
+  {11861, 0x3, 12, 1}, {11861, 0x3, 12, 1}, {11861, 0x3, 12, 1},
+  {11861, 0x3, 12, 1}, {0, 0x0, 0, 0}, {11855, 0x1, 22, 1},
+  {11873, 0x3, 19, 1}, {11881, 0x3, 19, 1}, {0, 0x0, 0, 0},
+  {11877, 0x3, 12, 1}, {11877, 0x3, 12, 1}, {11877, 0x3, 12, 1},
+  {451, 0x0, 0, 0}, {452, 0x0, 0, 0}, {453, 0x0, 0, 0},
+  {454, 0x0, 0, 0}, {11877, 0x3, 12, 1}, {11877, 0x3, 12, 1},
+  {11877, 0x3, 12, 1}, {11877, 0x3, 12, 1}, {0, 0x0, 0, 0},
+  {11871, 0x1, 22, 1}, {11891, 0x3, 19, 1}, {11911, 0x3, 19, 1},
+  {11923, 0x3, 19, 1}, {11923, 0x3, 19, 1}, {11895, 0x7, 10, 1},
+  {11903, 0x7, 10, 1}, {11903, 0x7, 10, 1}, {11903, 0x7, 10, 1},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {164, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {164, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {165, 0x0, 0, 0}, {0, 0x0, 0, 0}, {166, 0x0, 0, 0},
+  {164, 0x0, 0, 0}, {167, 0x0, 0, 0}, {164, 0x0, 0, 0},
+  {168, 0x0, 0, 0}, {11915, 0x7, 10, 1}, {11915, 0x7, 10, 1},
+  {11915, 0x7, 10, 1}, {11915, 0x7, 10, 1}, {0, 0x0, 0, 0},
+  {165, 0x0, 0, 0}, {0, 0x0, 0, 0}, {166, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {167, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {168, 0x0, 0, 0}, {11927, 0x7, 10, 1}, {11927, 0x7, 10, 1},
+  {11927, 0x7, 10, 1}, {11927, 0x7, 10, 1}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {169, 0x0, 0, 0}, {0, 0x0, 0, 0}, {169, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {11887, 0x3, 22, 1},
+  {11941, 0x3, 19, 1}, {11947, 0x3, 19, 1}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {11945, 0x1, 11, 1},
+  {11945, 0x1, 11, 1}, {11945, 0x1, 11, 1}, {498, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {11945, 0x1, 11, 1}, {11945, 0x1, 11, 1},
+  {11945, 0x1, 11, 1}, {11945, 0x1, 11, 1}, {11955, 0x3, 19, 1},
+  {11961, 0x3, 19, 1}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {11959, 0x1, 11, 1}, {11959, 0x1, 11, 1},
+  {11959, 0x1, 11, 1}, {0, 0x0, 0, 0}, {1879, 0x0, 0, 0},
+  {11959, 0x1, 11, 1}, {11959, 0x1, 11, 1}, {11959, 0x1, 11, 1},
+  {11959, 0x1, 11, 1}, {0, 0x0, 0, 0}, {11969, 0x1, 10, 1},
+  {11971, 0x1, 10, 1}, {11973, 0x1, 10, 1}, {1880, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {11937, 0x3, 22, 1},
+  {1881, 0x0, 0, 0}, {11951, 0x3, 22, 1}, {0, 0x0, 0, 0},
+  {11965, 0x3, 12, 1}, {0, 0x0, 0, 0}, {11979, 0x1, 23, 1},
+  {11981, 0xf, 10, 1}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {806, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {807, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {808, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {809, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {11999, 0x1, 23, 1}, {12001, 0xf, 10, 1},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {451, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {452, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {453, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {454, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {12019, 0x3, 22, 1}, {12023, 0xf, 10, 1}, {12039, 0xf, 10, 1},
+  {12055, 0xf, 10, 1}, {12055, 0xf, 10, 1}, {0, 0x0, 0, 0},
+  {165, 0x0, 0, 0}, {0, 0x0, 0, 0}, {166, 0x0, 0, 0},
+  {164, 0x0, 0, 0}, {167, 0x0, 0, 0}, {164, 0x0, 0, 0},
+  {168, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {165, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {166, 0x0, 0, 0}, {0, 0x0, 0, 0}, {167, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {168, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {169, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {169, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {12073, 0x1, 23, 1}, {12075, 0xf, 10, 1}, {12091, 0xf, 10, 1},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {1880, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {1880, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {498, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {1881, 0x0, 0, 0}, {0, 0x0, 0, 0}, {1881, 0x0, 0, 0},
+  {1879, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {1880, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {1880, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {1881, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {1881, 0x0, 0, 0}, {0, 0x0, 0, 0}, {12109, 0x1, 23, 1},
+  {12115, 0x1, 23, 1}, {12111, 0x1, 13, 1}, {12113, 0x1, 13, 1},
+  {910, 0x0, 0, 0}, {911, 0x0, 0, 0}, {912, 0x0, 0, 0},
+  {913, 0x0, 0, 0}, {12117, 0x1, 13, 1}, {12119, 0x1, 13, 1},
+  {914, 0x0, 0, 0}, {915, 0x0, 0, 0}, {916, 0x0, 0, 0},
+  {917, 0x0, 0, 0}, {12123, 0x1, 23, 1}, {12129, 0x1, 23, 1},
+  {12125, 0x1, 13, 1}, {12127, 0x1, 13, 1}, {724, 0x0, 0, 0},
+  {725, 0x0, 0, 0}, {726, 0x0, 0, 0}, {727, 0x0, 0, 0},
+  {12131, 0x1, 13, 1}, {12133, 0x1, 13, 1}, {728, 0x0, 0, 0},
+  {729, 0x0, 0, 0}, {730, 0x0, 0, 0}, {731, 0x0, 0, 0},
+  {12137, 0x3, 22, 1}, {12149, 0x3, 22, 1}, {12141, 0x1, 13, 1},
+  {12143, 0x1, 13, 1}, {12145, 0x1, 13, 1}, {12147, 0x1, 13, 1},
+  {1942, 0x0, 0, 0}, {1943, 0x0, 0, 0}, {1944, 0x0, 0, 0},
+  {1945, 0x0, 0, 0}, {1946, 0x0, 0, 0}, {1947, 0x0, 0, 0},
+  {1948, 0x0, 0, 0}, {1949, 0x0, 0, 0}, {12153, 0x1, 13, 1},
+  {12155, 0x1, 13, 1}, {12157, 0x1, 13, 1}, {12159, 0x1, 13, 1},
+  {1950, 0x0, 0, 0}, {0, 0x0, 0, 0}, {1951, 0x0, 0, 0},
+  {1952, 0x0, 0, 0}, {1953, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {1954, 0x0, 0, 0}, {1955, 0x0, 0, 0}, {12163, 0x3, 22, 1},
+  {12183, 0x3, 22, 1}, {12167, 0x1, 13, 1}, {12173, 0x1, 13, 1},
+  {12175, 0x1, 13, 1}, {12181, 0x1, 13, 1}, {12169, 0x1, 4, 1},
+  {12171, 0x1, 4, 1}, {2080, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {2081, 0x0, 0, 0}, {0, 0x0, 0, 0}, {2082, 0x0, 0, 0},
+  {2083, 0x0, 0, 0}, {12177, 0x1, 4, 1}, {12179, 0x1, 4, 1},
+  {2084, 0x0, 0, 0}, {0, 0x0, 0, 0}, {2085, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {2086, 0x0, 0, 0}, {2087, 0x0, 0, 0},
+  {12187, 0x1, 13, 1}, {12191, 0x1, 13, 1}, {12193, 0x1, 13, 1},
+  {12197, 0x1, 13, 1}, {2088, 0x0, 0, 0}, {12189, 0x1, 4, 1},
+  {2089, 0x0, 0, 0}, {0, 0x0, 0, 0}, {2090, 0x0, 0, 0},
+  {2091, 0x0, 0, 0}, {2092, 0x0, 0, 0}, {12195, 0x1, 4, 1},
+  {2093, 0x0, 0, 0}, {0, 0x0, 0, 0}, {2094, 0x0, 0, 0},
+  {2095, 0x0, 0, 0}, {12201, 0x1, 23, 1}, {12211, 0x1, 23, 1},
+  {12203, 0x1, 13, 1}, {12209, 0x1, 13, 1}, {12205, 0x1, 4, 1},
+  {12207, 0x1, 4, 1}, {2312, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {2313, 0x0, 0, 0}, {0, 0x0, 0, 0}, {2314, 0x0, 0, 0},
+  {2315, 0x0, 0, 0}, {12213, 0x1, 13, 1}, {12219, 0x1, 13, 1},
+  {12215, 0x1, 4, 1}, {12217, 0x1, 4, 1}, {2316, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {2317, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {2318, 0x0, 0, 0}, {2319, 0x0, 0, 0}, {12223, 0x1, 23, 1},
+  {12233, 0x1, 23, 1}, {12225, 0x1, 13, 1}, {12231, 0x1, 13, 1},
+  {12227, 0x1, 4, 1}, {12229, 0x1, 4, 1}, {147, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {148, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {149, 0x0, 0, 0}, {150, 0x0, 0, 0}, {12235, 0x1, 13, 1},
+  {12241, 0x1, 13, 1}, {12237, 0x1, 4, 1}, {12239, 0x1, 4, 1},
+  {151, 0x0, 0, 0}, {0, 0x0, 0, 0}, {152, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {153, 0x0, 0, 0}, {154, 0x0, 0, 0},
+  {12245, 0x3, 22, 1}, {12257, 0x3, 22, 1}, {12249, 0x1, 13, 1},
+  {12251, 0x1, 13, 1}, {12253, 0x1, 13, 1}, {12255, 0x1, 13, 1},
+  {2103, 0x0, 0, 0}, {2104, 0x0, 0, 0}, {1944, 0x0, 0, 0},
+  {1945, 0x0, 0, 0}, {2105, 0x0, 0, 0}, {2106, 0x0, 0, 0},
+  {1948, 0x0, 0, 0}, {1949, 0x0, 0, 0}, {12261, 0x1, 13, 1},
+  {12263, 0x1, 13, 1}, {12269, 0x1, 13, 1}, {12271, 0x1, 13, 1},
+  {2107, 0x0, 0, 0}, {2108, 0x0, 0, 0}, {12265, 0x1, 4, 1},
+  {12267, 0x1, 4, 1}, {2109, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {2110, 0x0, 0, 0}, {0, 0x0, 0, 0}, {2111, 0x0, 0, 0},
+  {2112, 0x0, 0, 0}, {2113, 0x0, 0, 0}, {2114, 0x0, 0, 0},
+  {12275, 0x3, 22, 1}, {12283, 0x3, 22, 1}, {12279, 0x1, 13, 1},
+  {12173, 0x1, 13, 1}, {12281, 0x1, 13, 1}, {12181, 0x1, 13, 1},
+  {2397, 0x0, 0, 0}, {2398, 0x0, 0, 0}, {2399, 0x0, 0, 0},
+  {2400, 0x0, 0, 0}, {12287, 0x1, 13, 1}, {12289, 0x1, 13, 1},
+  {12295, 0x1, 13, 1}, {12297, 0x1, 13, 1}, {2401, 0x0, 0, 0},
+  {2402, 0x0, 0, 0}, {12291, 0x1, 4, 1}, {12293, 0x1, 4, 1},
+  {2403, 0x0, 0, 0}, {0, 0x0, 0, 0}, {2404, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {2405, 0x0, 0, 0}, {2406, 0x0, 0, 0},
+  {2407, 0x0, 0, 0}, {2408, 0x0, 0, 0}, {12301, 0x3, 22, 1},
+  {12315, 0x3, 22, 1}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {12305, 0x1, 13, 1}, {12309, 0x1, 13, 1}, {12307, 0x1, 4, 1},
+  {0, 0x0, 0, 0}, {1454, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {12311, 0x1, 4, 1}, {12313, 0x1, 4, 1}, {1455, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {1456, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {12319, 0x1, 13, 1}, {12319, 0x1, 13, 1}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {2670, 0x0, 0, 0}, {2671, 0x0, 0, 0},
+  {12323, 0x3, 22, 1}, {12337, 0x3, 22, 1}, {12327, 0x1, 13, 1},
+  {12327, 0x1, 13, 1}, {12329, 0x1, 13, 1}, {12331, 0x1, 13, 1},
+  {1598, 0x0, 0, 0}, {1599, 0x0, 0, 0}, {1600, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {12333, 0x1, 4, 1}, {12335, 0x1, 4, 1},
+  {1601, 0x0, 0, 0}, {0, 0x0, 0, 0}, {1602, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {12341, 0x1, 13, 1}, {12341, 0x1, 13, 1},
+  {12343, 0x1, 13, 1}, {12343, 0x1, 13, 1}, {1603, 0x0, 0, 0},
+  {1604, 0x0, 0, 0}, {1605, 0x0, 0, 0}, {1606, 0x0, 0, 0},
+  {12347, 0x3, 22, 1}, {12357, 0x3, 22, 1}, {12351, 0x1, 13, 1},
+  {12353, 0x1, 13, 1}, {0, 0x0, 0, 0}, {12355, 0x1, 13, 1},
+  {0, 0x0, 0, 0}, {248, 0x0, 0, 0}, {249, 0x0, 0, 0},
+  {250, 0x0, 0, 0}, {251, 0x0, 0, 0}, {252, 0x0, 0, 0},
+  {12361, 0x1, 13, 1}, {12363, 0x1, 13, 1}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {253, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {254, 0x0, 0, 0}, {255, 0x0, 0, 0}, {12367, 0x3, 22, 1},
+  {12387, 0x3, 22, 1}, {12371, 0x1, 13, 1}, {12377, 0x1, 13, 1},
+  {12379, 0x1, 13, 1}, {12385, 0x1, 13, 1}, {12373, 0x1, 4, 1},
+  {12375, 0x1, 4, 1}, {2550, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {2551, 0x0, 0, 0}, {0, 0x0, 0, 0}, {550, 0x0, 0, 0},
+  {551, 0x0, 0, 0}, {12381, 0x1, 4, 1}, {12383, 0x1, 4, 1},
+  {2552, 0x0, 0, 0}, {0, 0x0, 0, 0}, {2553, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {552, 0x0, 0, 0}, {553, 0x0, 0, 0},
+  {12391, 0x1, 13, 1}, {12395, 0x1, 13, 1}, {12397, 0x1, 13, 1},
+  {12401, 0x1, 13, 1}, {2554, 0x0, 0, 0}, {12393, 0x1, 4, 1},
+  {2555, 0x0, 0, 0}, {0, 0x0, 0, 0}, {2556, 0x0, 0, 0},
+  {2557, 0x0, 0, 0}, {2558, 0x0, 0, 0}, {12399, 0x1, 4, 1},
+  {2559, 0x0, 0, 0}, {0, 0x0, 0, 0}, {2560, 0x0, 0, 0},
+  {2561, 0x0, 0, 0}, {12301, 0x3, 22, 1}, {12405, 0x3, 22, 1},
+  {12409, 0x1, 13, 1}, {12409, 0x1, 13, 1}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {1457, 0x0, 0, 0}, {1458, 0x0, 0, 0},
+  {12413, 0x3, 22, 1}, {12419, 0x3, 22, 1}, {12417, 0x1, 13, 1},
+  {12417, 0x1, 13, 1}, {12329, 0x1, 13, 1}, {12331, 0x1, 13, 1},
+  {2469, 0x0, 0, 0}, {2470, 0x0, 0, 0}, {12423, 0x1, 13, 1},
+  {12423, 0x1, 13, 1}, {12425, 0x1, 13, 1}, {12425, 0x1, 13, 1},
+  {2471, 0x0, 0, 0}, {2472, 0x0, 0, 0}, {2473, 0x0, 0, 0},
+  {2474, 0x0, 0, 0}, {12429, 0x3, 22, 1}, {12433, 0x3, 22, 1},
+  {0, 0x0, 0, 0}, {12353, 0x1, 13, 1}, {0, 0x0, 0, 0},
+  {12355, 0x1, 13, 1}, {12437, 0x1, 13, 1}, {12439, 0x1, 13, 1},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {2729, 0x0, 0, 0},
+  {2730, 0x0, 0, 0}, {2731, 0x0, 0, 0}, {2732, 0x0, 0, 0},
+  {12443, 0x3, 22, 1}, {12453, 0x3, 22, 1}, {12447, 0x1, 13, 1},
+  {12449, 0x1, 13, 1}, {0, 0x0, 0, 0}, {12451, 0x1, 13, 1},
+  {548, 0x0, 0, 0}, {549, 0x0, 0, 0}, {550, 0x0, 0, 0},
+  {551, 0x0, 0, 0}, {552, 0x0, 0, 0}, {553, 0x0, 0, 0},
+  {12457, 0x1, 13, 1}, {12459, 0x1, 13, 1}, {12461, 0x1, 13, 1},
+  {12463, 0x1, 13, 1}, {554, 0x0, 0, 0}, {555, 0x0, 0, 0},
+  {556, 0x0, 0, 0}, {557, 0x0, 0, 0}, {558, 0x0, 0, 0},
+  {559, 0x0, 0, 0}, {560, 0x0, 0, 0}, {561, 0x0, 0, 0},
+  {12467, 0x3, 22, 1}, {12471, 0x3, 22, 1}, {428, 0x0, 0, 0},
+  {429, 0x0, 0, 0}, {430, 0x0, 0, 0}, {431, 0x0, 0, 0},
+  {432, 0x0, 0, 0}, {433, 0x0, 0, 0}, {434, 0x0, 0, 0},
+  {435, 0x0, 0, 0}, {12477, 0x3, 22, 1}, {12481, 0x3, 22, 1},
+  {918, 0x0, 0, 0}, {919, 0x0, 0, 0}, {920, 0x0, 0, 0},
+  {921, 0x0, 0, 0}, {922, 0x0, 0, 0}, {923, 0x0, 0, 0},
+  {924, 0x0, 0, 0}, {925, 0x0, 0, 0}, {12487, 0x3, 22, 1},
+  {12491, 0x3, 22, 1}, {386, 0x0, 0, 0}, {387, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {388, 0x0, 0, 0},
+  {389, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {12497, 0x3, 22, 1}, {12533, 0x3, 22, 1}, {386, 0x0, 0, 0},
+  {387, 0x0, 0, 0}, {12501, 0xf, 10, 1}, {12517, 0xf, 10, 1},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {2099, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {2100, 0x0, 0, 0}, {388, 0x0, 0, 0},
+  {389, 0x0, 0, 0}, {12537, 0xf, 10, 1}, {12553, 0xf, 10, 1},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {2101, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {2102, 0x0, 0, 0}, {12571, 0x3, 22, 1},
+  {12575, 0x3, 22, 1}, {1015, 0x0, 0, 0}, {1016, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {1019, 0x0, 0, 0},
+  {1020, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {12581, 0x3, 22, 1}, {12617, 0x3, 22, 1}, {1015, 0x0, 0, 0},
+  {1016, 0x0, 0, 0}, {12585, 0xf, 10, 1}, {12601, 0xf, 10, 1},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {1017, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {1018, 0x0, 0, 0}, {1019, 0x0, 0, 0},
+  {1020, 0x0, 0, 0}, {12621, 0xf, 10, 1}, {12637, 0xf, 10, 1},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {1021, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {1022, 0x0, 0, 0}, {1829, 0x0, 0, 0},
+  {1830, 0x0, 0, 0}, {422, 0x0, 0, 0}, {423, 0x0, 0, 0},
+  {12659, 0x3, 22, 1}, {12663, 0x3, 22, 1}, {1117, 0x0, 0, 0},
+  {1117, 0x0, 0, 0}, {1117, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {1118, 0x0, 0, 0}, {1118, 0x0, 0, 0}, {1118, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {12669, 0x3, 22, 1}, {12681, 0x3, 22, 1},
+  {12673, 0x7, 10, 1}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {520, 0x0, 0, 0}, {520, 0x0, 0, 0},
+  {520, 0x0, 0, 0}, {520, 0x0, 0, 0}, {520, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {12685, 0x7, 10, 1}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {521, 0x0, 0, 0}, {521, 0x0, 0, 0},
+  {521, 0x0, 0, 0}, {521, 0x0, 0, 0}, {521, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {12695, 0x3, 22, 1}, {99, 0x0, 0, 0},
+  {100, 0x0, 0, 0}, {101, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {991, 0x0, 0, 0}, {992, 0x0, 0, 0}, {993, 0x0, 0, 0},
+  {994, 0x0, 0, 0}, {2523, 0x0, 0, 0}, {2524, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {12703, 0x1, 10, 1}, {0, 0x0, 0, 0},
+  {12699, 0x3, 10, 1}, {101, 0x0, 0, 0}, {12705, 0x2f, 0, 2},
+  {0, 0x0, 0, 0}, {12707, 0x3, 22, 1}, {0, 0x0, 0, 0},
+  {101, 0x0, 0, 0}, {0, 0x0, 0, 0}, {1697, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {12719, 0x3, 22, 1}, {0, 0x0, 0, 0},
+  {12723, 0xf, 10, 1}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {1631, 0x0, 0, 0}, {1632, 0x0, 0, 0}, {1633, 0x0, 0, 0},
+  {1634, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {12741, 0x3, 22, 1},
+  {0, 0x0, 0, 0}, {12745, 0xf, 10, 1}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {732, 0x0, 0, 0}, {733, 0x0, 0, 0},
+  {734, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {12763, 0x3, 22, 1},
+  {12767, 0x3, 22, 1}, {2204, 0x0, 0, 0}, {2204, 0x0, 0, 0},
+  {2205, 0x0, 0, 0}, {0, 0x0, 0, 0}, {2206, 0x0, 0, 0},
+  {2206, 0x0, 0, 0}, {2207, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {12773, 0x1, 23, 1}, {12775, 0x1, 23, 1}, {2192, 0x0, 0, 0},
+  {2193, 0x0, 0, 0}, {2194, 0x0, 0, 0}, {2195, 0x0, 0, 0},
+  {12779, 0x3, 22, 1}, {12783, 0x3, 22, 1}, {0, 0x0, 0, 0},
+  {1716, 0x0, 0, 0}, {0, 0x0, 0, 0}, {2339, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {1717, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {12789, 0x3, 22, 1}, {12783, 0x3, 22, 1},
+  {0, 0x0, 0, 0}, {1716, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {12797, 0x1f, 0, 1}, {12829, 0x1f, 0, 1},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {335, 0x0, 0, 0}, {336, 0x0, 0, 0}, {337, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {338, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {324, 0x0, 0, 0}, {12793, 0x3, 22, 1}, {12867, 0x1f, 0, 1},
+  {12899, 0x1f, 0, 1}, {12931, 0x1f, 0, 1}, {0, 0x0, 0, 0},
+  {1123, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {1124, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {1125, 0x0, 0, 0},
+  {1126, 0x0, 0, 0}, {1127, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {324, 0x0, 0, 0}, {12863, 0x3, 22, 1}, {0, 0x0, 0, 0},
+  {2028, 0x0, 0, 0}, {0, 0x0, 0, 0}, {2136, 0x0, 0, 0},
+  {1347, 0x0, 0, 0}, {1348, 0x0, 0, 0}, {1349, 0x0, 0, 0},
+  {1350, 0x0, 0, 0}, {1351, 0x0, 0, 0}, {1352, 0x0, 0, 0},
+  {1353, 0x0, 0, 0}, {1354, 0x0, 0, 0}, {1355, 0x0, 0, 0},
+  {1356, 0x0, 0, 0}, {1357, 0x0, 0, 0}, {1248, 0x0, 0, 0},
+  {1358, 0x0, 0, 0}, {1359, 0x0, 0, 0}, {1360, 0x0, 0, 0},
+  {1361, 0x0, 0, 0}, {1362, 0x0, 0, 0}, {1362, 0x0, 0, 0},
+  {1362, 0x0, 0, 0}, {1362, 0x0, 0, 0}, {1248, 0x0, 0, 0},
+  {1248, 0x0, 0, 0}, {1248, 0x0, 0, 0}, {1248, 0x0, 0, 0},
+  {1248, 0x0, 0, 0}, {1248, 0x0, 0, 0}, {1248, 0x0, 0, 0},
+  {1248, 0x0, 0, 0}, {1248, 0x0, 0, 0}, {1248, 0x0, 0, 0},
+  {1248, 0x0, 0, 0}, {1248, 0x0, 0, 0}, {1248, 0x0, 0, 0},
+  {1248, 0x0, 0, 0}, {1248, 0x0, 0, 0}, {1248, 0x0, 0, 0},
+  {1248, 0x0, 0, 0}, {1248, 0x0, 0, 0}, {1248, 0x0, 0, 0},
+  {1248, 0x0, 0, 0}, {1248, 0x0, 0, 0}, {1248, 0x0, 0, 0},
+  {1248, 0x0, 0, 0}, {1248, 0x0, 0, 0}, {1248, 0x0, 0, 0},
+  {1248, 0x0, 0, 0}, {1248, 0x0, 0, 0}, {1248, 0x0, 0, 0},
+  {1248, 0x0, 0, 0}, {1248, 0x0, 0, 0}, {1248, 0x0, 0, 0},
+  {1248, 0x0, 0, 0}, {1248, 0x0, 0, 0}, {1248, 0x0, 0, 0},
+  {1248, 0x0, 0, 0}, {1248, 0x0, 0, 0}, {1248, 0x0, 0, 0},
+  {1248, 0x0, 0, 0}, {1248, 0x0, 0, 0}, {1248, 0x0, 0, 0},
+  {1248, 0x0, 0, 0}, {1248, 0x0, 0, 0}, {1248, 0x0, 0, 0},
+  {1248, 0x0, 0, 0}, {0, 0x0, 0, 0}, {12969, 0x3f, 6, 1},
+  {1243, 0x0, 0, 0}, {1244, 0x0, 0, 0}, {1245, 0x0, 0, 0},
+  {1246, 0x0, 0, 0}, {1248, 0x0, 0, 0}, {1248, 0x0, 0, 0},
+  {1248, 0x0, 0, 0}, {1248, 0x0, 0, 0}, {1247, 0x0, 0, 0},
+  {1248, 0x0, 0, 0}, {1248, 0x0, 0, 0}, {1248, 0x0, 0, 0},
+  {1249, 0x0, 0, 0}, {1250, 0x0, 0, 0}, {1251, 0x0, 0, 0},
+  {1252, 0x0, 0, 0}, {1248, 0x0, 0, 0}, {1248, 0x0, 0, 0},
+  {1248, 0x0, 0, 0}, {1248, 0x0, 0, 0}, {1248, 0x0, 0, 0},
+  {1248, 0x0, 0, 0}, {1248, 0x0, 0, 0}, {1248, 0x0, 0, 0},
+  {1248, 0x0, 0, 0}, {1248, 0x0, 0, 0}, {1248, 0x0, 0, 0},
+  {1248, 0x0, 0, 0}, {1248, 0x0, 0, 0}, {1248, 0x0, 0, 0},
+  {1248, 0x0, 0, 0}, {1248, 0x0, 0, 0}, {1248, 0x0, 0, 0},
+  {1248, 0x0, 0, 0}, {1248, 0x0, 0, 0}, {1248, 0x0, 0, 0},
+  {1248, 0x0, 0, 0}, {1248, 0x0, 0, 0}, {1248, 0x0, 0, 0},
+  {1248, 0x0, 0, 0}, {1248, 0x0, 0, 0}, {1248, 0x0, 0, 0},
+  {1248, 0x0, 0, 0}, {1248, 0x0, 0, 0}, {1248, 0x0, 0, 0},
+  {1248, 0x0, 0, 0}, {1248, 0x0, 0, 0}, {1248, 0x0, 0, 0},
+  {1248, 0x0, 0, 0}, {1248, 0x0, 0, 0}, {1248, 0x0, 0, 0},
+  {1248, 0x0, 0, 0}, {1248, 0x0, 0, 0}, {1248, 0x0, 0, 0},
+  {1248, 0x0, 0, 0}, {1248, 0x0, 0, 0}, {1248, 0x0, 0, 0},
+  {1248, 0x0, 0, 0}, {1248, 0x0, 0, 0}, {1248, 0x0, 0, 0},
+  {1248, 0x0, 0, 0}, {1248, 0x0, 0, 0}, {1248, 0x0, 0, 0},
+  {1248, 0x0, 0, 0}, {0, 0x0, 0, 0}, {13035, 0x3f, 6, 1},
+  {0, 0x0, 0, 0}, {13105, 0x1f, 0, 1}, {13137, 0x1f, 0, 1},
+  {13169, 0x1f, 0, 1}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {1146, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {1147, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {1148, 0x0, 0, 0}, {0, 0x0, 0, 0}, {2434, 0x0, 0, 0},
+  {2436, 0x0, 0, 0}, {2437, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {2436, 0x0, 0, 0}, {2437, 0x0, 0, 0},
+  {2435, 0x0, 0, 0}, {0, 0x0, 0, 0}, {2436, 0x0, 0, 0},
+  {2437, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {2436, 0x0, 0, 0}, {2437, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {2436, 0x0, 0, 0}, {2437, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {2436, 0x0, 0, 0},
+  {2437, 0x0, 0, 0}, {2435, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {2436, 0x0, 0, 0}, {2437, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {2436, 0x0, 0, 0}, {2437, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {2436, 0x0, 0, 0},
+  {2437, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {2436, 0x0, 0, 0}, {2437, 0x0, 0, 0}, {2435, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {2436, 0x0, 0, 0}, {2437, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {2436, 0x0, 0, 0},
+  {2437, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {2436, 0x0, 0, 0}, {2437, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {2436, 0x0, 0, 0}, {2437, 0x0, 0, 0},
+  {2435, 0x0, 0, 0}, {0, 0x0, 0, 0}, {2436, 0x0, 0, 0},
+  {2437, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {2436, 0x0, 0, 0}, {2437, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {13201, 0x3f, 6, 1}, {0, 0x0, 0, 0}, {13271, 0x1, 5, 1},
+  {13273, 0x1, 5, 1}, {13275, 0x1, 5, 1}, {12965, 0x32, 0, 2},
+  {12967, 0x32, 0, 2}, {13033, 0x33, 0, 2}, {13099, 0x33, 0, 2},
+  {13101, 0x3, 6, 1}, {13265, 0x33, 0, 2}, {0, 0x0, 0, 0},
+  {13267, 0x3, 12, 1}, {13277, 0x34, 0, 2}, {417, 0x0, 0, 0},
+  {13279, 0x1, 19, 1}, {1211, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {13281, 0x1, 20, 1}, {324, 0x0, 0, 0}, {13283, 0xd, 0, 2},
+  {653, 0x0, 0, 0}, {654, 0x0, 0, 0}, {655, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {13287, 0x3, 5, 1},
+  {13291, 0x35, 0, 2}, {417, 0x0, 0, 0}, {13293, 0x1, 19, 1},
+  {1211, 0x0, 0, 0}, {0, 0x0, 0, 0}, {13295, 0x1, 20, 1},
+  {324, 0x0, 0, 0}, {13297, 0xd, 0, 2}, {324, 0x0, 0, 0},
+  {13303, 0x3, 22, 1}, {13307, 0x3, 19, 1}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {417, 0x0, 0, 0}, {1211, 0x0, 0, 0}, {1211, 0x0, 0, 0},
+  {2242, 0x0, 0, 0}, {2243, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {13311, 0x1, 8, 1}, {13313, 0x36, 0, 2}, {750, 0x0, 0, 0},
+  {13315, 0x1, 19, 1}, {751, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {13317, 0x1, 20, 1}, {324, 0x0, 0, 0}, {13319, 0xd, 0, 2},
+  {324, 0x0, 0, 0}, {13325, 0x3, 22, 1}, {13329, 0x3, 19, 1},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {750, 0x0, 0, 0}, {751, 0x0, 0, 0},
+  {751, 0x0, 0, 0}, {0, 0x0, 0, 0}, {291, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {119, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {2259, 0x0, 0, 0}, {0, 0x0, 0, 0}, {1203, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {278, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {1653, 0x0, 0, 0}, {0, 0x0, 0, 0}, {1763, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {1594, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {596, 0x0, 0, 0}, {13355, 0x3, 10, 1}, {13383, 0x3, 10, 1},
+  {13411, 0x3, 10, 1}, {0, 0x0, 0, 0}, {13359, 0x7, 2, 1},
+  {0, 0x0, 0, 0}, {13367, 0x7, 2, 1}, {13375, 0x7, 2, 1},
+  {13333, 0x37, 0, 2}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {13335, 0x38, 0, 2}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {13337, 0x38, 0, 2},
+  {13387, 0x7, 2, 1}, {0, 0x0, 0, 0}, {13395, 0x7, 2, 1},
+  {13403, 0x7, 2, 1}, {13339, 0x37, 0, 2}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {13341, 0x39, 0, 2}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {13343, 0x39, 0, 2}, {13415, 0x7, 2, 1}, {0, 0x0, 0, 0},
+  {13423, 0x7, 2, 1}, {13431, 0x7, 2, 1}, {13345, 0x3a, 0, 2},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {13347, 0x39, 0, 2},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {13349, 0x39, 0, 2}, {0, 0x0, 0, 0},
+  {13351, 0x3, 22, 1}, {324, 0x0, 0, 0}, {13439, 0x3b, 0, 2},
+  {324, 0x0, 0, 0}, {0, 0x0, 0, 0}, {2216, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {1220, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {588, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {2423, 0x0, 0, 0}, {13455, 0x3, 10, 1}, {13507, 0x3, 10, 1},
+  {13459, 0xf, 1, 1}, {0, 0x0, 0, 0}, {13475, 0xf, 1, 1},
+  {13491, 0xf, 1, 1}, {13445, 0x1, 0, 1}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {13447, 0x1, 0, 1},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {13449, 0x1, 0, 1}, {13511, 0xf, 1, 1}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {13451, 0x3c, 0, 2},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {13453, 0x1, 23, 1}, {324, 0x0, 0, 0},
+  {13527, 0x3d, 0, 2}, {1895, 0x0, 0, 0}, {1896, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {13531, 0x1, 10, 1}, {324, 0x0, 0, 0},
+  {13533, 0x3e, 0, 2}, {76, 0x0, 0, 0}, {77, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {13537, 0x1, 10, 1}, {324, 0x0, 0, 0},
+  {13539, 0x3e, 0, 2}, {2379, 0x0, 0, 0}, {2380, 0x0, 0, 0},
+  {13547, 0x3, 22, 1}, {13615, 0x3, 22, 1}, {13551, 0xf, 10, 1},
+  {13567, 0xf, 10, 1}, {13583, 0xf, 10, 1}, {13599, 0xf, 10, 1},
+  {173, 0x0, 0, 0}, {178, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {173, 0x0, 0, 0}, {179, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {173, 0x0, 0, 0},
+  {180, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {173, 0x0, 0, 0}, {181, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {174, 0x0, 0, 0}, {182, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {174, 0x0, 0, 0},
+  {183, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {174, 0x0, 0, 0}, {184, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {174, 0x0, 0, 0}, {185, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {175, 0x0, 0, 0},
+  {186, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {175, 0x0, 0, 0}, {187, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {175, 0x0, 0, 0}, {188, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {175, 0x0, 0, 0},
+  {189, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {190, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {191, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {192, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {193, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {13619, 0xf, 10, 1}, {13635, 0xf, 10, 1},
+  {13651, 0xf, 10, 1}, {13599, 0xf, 10, 1}, {176, 0x0, 0, 0},
+  {178, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {176, 0x0, 0, 0}, {179, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {176, 0x0, 0, 0}, {180, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {176, 0x0, 0, 0},
+  {181, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {177, 0x0, 0, 0}, {182, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {177, 0x0, 0, 0}, {183, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {177, 0x0, 0, 0},
+  {184, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {177, 0x0, 0, 0}, {185, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {186, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {187, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {188, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {189, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {13669, 0x3, 22, 1},
+  {13737, 0x3, 22, 1}, {13673, 0xf, 10, 1}, {13689, 0xf, 10, 1},
+  {13705, 0xf, 10, 1}, {13721, 0xf, 10, 1}, {173, 0x0, 0, 0},
+  {1046, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {173, 0x0, 0, 0}, {1047, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {173, 0x0, 0, 0}, {1048, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {173, 0x0, 0, 0},
+  {1049, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {174, 0x0, 0, 0}, {1050, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {174, 0x0, 0, 0}, {1051, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {174, 0x0, 0, 0},
+  {1052, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {174, 0x0, 0, 0}, {1053, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {175, 0x0, 0, 0}, {1054, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {175, 0x0, 0, 0},
+  {1055, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {175, 0x0, 0, 0}, {1056, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {175, 0x0, 0, 0}, {1057, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {1058, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {1059, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {1060, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {1061, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {13741, 0xf, 10, 1}, {13757, 0xf, 10, 1}, {13773, 0xf, 10, 1},
+  {13721, 0xf, 10, 1}, {176, 0x0, 0, 0}, {1046, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {176, 0x0, 0, 0},
+  {1047, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {176, 0x0, 0, 0}, {1048, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {176, 0x0, 0, 0}, {1049, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {177, 0x0, 0, 0},
+  {1050, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {177, 0x0, 0, 0}, {1051, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {177, 0x0, 0, 0}, {1052, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {177, 0x0, 0, 0},
+  {1053, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {1054, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {1055, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {1056, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {1057, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {13791, 0x3, 22, 1}, {13859, 0x3, 22, 1},
+  {13795, 0xf, 10, 1}, {13811, 0xf, 10, 1}, {13827, 0xf, 10, 1},
+  {13843, 0xf, 10, 1}, {173, 0x0, 0, 0}, {1911, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {173, 0x0, 0, 0},
+  {1912, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {173, 0x0, 0, 0}, {1913, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {173, 0x0, 0, 0}, {1914, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {174, 0x0, 0, 0},
+  {1915, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {174, 0x0, 0, 0}, {1916, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {174, 0x0, 0, 0}, {1917, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {174, 0x0, 0, 0},
+  {1918, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {175, 0x0, 0, 0}, {1919, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {175, 0x0, 0, 0}, {1920, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {175, 0x0, 0, 0},
+  {1921, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {175, 0x0, 0, 0}, {1922, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {1923, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {1924, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {1925, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {1926, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {13863, 0xf, 10, 1},
+  {13879, 0xf, 10, 1}, {13895, 0xf, 10, 1}, {13843, 0xf, 10, 1},
+  {176, 0x0, 0, 0}, {1911, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {176, 0x0, 0, 0}, {1912, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {176, 0x0, 0, 0},
+  {1913, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {176, 0x0, 0, 0}, {1914, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {177, 0x0, 0, 0}, {1915, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {177, 0x0, 0, 0},
+  {1916, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {177, 0x0, 0, 0}, {1917, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {177, 0x0, 0, 0}, {1918, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {1919, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {1920, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {1921, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {1922, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {13913, 0x3, 22, 1}, {13965, 0x3, 22, 1}, {13917, 0xf, 10, 1},
+  {13933, 0xf, 10, 1}, {13949, 0xf, 10, 1}, {0, 0x0, 0, 0},
+  {173, 0x0, 0, 0}, {610, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {173, 0x0, 0, 0}, {611, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {173, 0x0, 0, 0},
+  {612, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {173, 0x0, 0, 0}, {613, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {174, 0x0, 0, 0}, {614, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {174, 0x0, 0, 0},
+  {615, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {174, 0x0, 0, 0}, {616, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {174, 0x0, 0, 0}, {617, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {175, 0x0, 0, 0},
+  {618, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {175, 0x0, 0, 0}, {619, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {175, 0x0, 0, 0}, {620, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {175, 0x0, 0, 0},
+  {621, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {13969, 0xf, 10, 1}, {13985, 0xf, 10, 1}, {14001, 0xf, 10, 1},
+  {0, 0x0, 0, 0}, {176, 0x0, 0, 0}, {610, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {176, 0x0, 0, 0},
+  {611, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {176, 0x0, 0, 0}, {612, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {176, 0x0, 0, 0}, {613, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {177, 0x0, 0, 0},
+  {614, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {177, 0x0, 0, 0}, {615, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {177, 0x0, 0, 0}, {616, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {177, 0x0, 0, 0},
+  {617, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {618, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {619, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {620, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {621, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {1645, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {737, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {1936, 0x0, 0, 0}, {14027, 0x3, 10, 1}, {14031, 0x3, 10, 1},
+  {14035, 0x3, 10, 1}, {14039, 0x3, 10, 1}, {14017, 0x14, 0, 2},
+  {1332, 0x0, 0, 0}, {1333, 0x0, 0, 0}, {1334, 0x0, 0, 0},
+  {1335, 0x0, 0, 0}, {1336, 0x0, 0, 0}, {1337, 0x0, 0, 0},
+  {1338, 0x0, 0, 0}, {14019, 0x14, 0, 2}, {1339, 0x0, 0, 0},
+  {1340, 0x0, 0, 0}, {1341, 0x0, 0, 0}, {14021, 0x14, 0, 2},
+  {1342, 0x0, 0, 0}, {1343, 0x0, 0, 0}, {1344, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {14023, 0x3, 22, 1}, {0, 0x0, 0, 0},
+  {14047, 0x3, 22, 1}, {14051, 0x3, 10, 1}, {14031, 0x3, 10, 1},
+  {14055, 0x3, 10, 1}, {14059, 0x3, 10, 1}, {0, 0x0, 0, 0},
+  {1332, 0x0, 0, 0}, {1333, 0x0, 0, 0}, {1334, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {1339, 0x0, 0, 0}, {1340, 0x0, 0, 0},
+  {1341, 0x0, 0, 0}, {0, 0x0, 0, 0}, {1342, 0x0, 0, 0},
+  {1343, 0x0, 0, 0}, {1344, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {2373, 0x0, 0, 0}, {1503, 0x0, 0, 0}, {1504, 0x0, 0, 0},
+  {1505, 0x0, 0, 0}, {1506, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {1714, 0x0, 0, 0}, {1715, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {1956, 0x0, 0, 0}, {0, 0x0, 0, 0}, {1957, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {269, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {270, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {1491, 0x0, 0, 0}, {0, 0x0, 0, 0}, {1927, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {656, 0x0, 0, 0}, {14089, 0x3, 12, 1},
+  {14093, 0x3, 12, 1}, {1025, 0x0, 0, 0}, {1026, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {1027, 0x0, 0, 0},
+  {1028, 0x0, 0, 0}, {14083, 0x3f, 0, 2}, {14085, 0x3f, 0, 2},
+  {0, 0x0, 0, 0}, {14087, 0x1, 16, 1}, {0, 0x0, 0, 0},
+  {688, 0x0, 0, 0}, {0, 0x0, 0, 0}, {2298, 0x0, 0, 0},
+  {14105, 0x3, 12, 1}, {14109, 0x3, 12, 1}, {51, 0x0, 0, 0},
+  {52, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {53, 0x0, 0, 0}, {54, 0x0, 0, 0}, {14099, 0x3f, 0, 2},
+  {14101, 0x3f, 0, 2}, {0, 0x0, 0, 0}, {14103, 0x1, 16, 1},
+  {0, 0x0, 0, 0}, {942, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {2311, 0x0, 0, 0}, {14121, 0x3, 12, 1}, {14125, 0x3, 12, 1},
+  {1289, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {1290, 0x0, 0, 0}, {1291, 0x0, 0, 0},
+  {14115, 0x3f, 0, 2}, {14117, 0x3f, 0, 2}, {0, 0x0, 0, 0},
+  {14119, 0x1, 16, 1}, {0, 0x0, 0, 0}, {261, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {2506, 0x0, 0, 0}, {14137, 0x3, 12, 1},
+  {14141, 0x3, 12, 1}, {1253, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {1254, 0x0, 0, 0},
+  {1255, 0x0, 0, 0}, {14131, 0x3f, 0, 2}, {14133, 0x3f, 0, 2},
+  {0, 0x0, 0, 0}, {14135, 0x1, 16, 1}, {14149, 0x3, 22, 1},
+  {14165, 0x3, 22, 1}, {14153, 0x3, 10, 1}, {0, 0x0, 0, 0},
+  {14157, 0x3, 10, 1}, {14161, 0x3, 10, 1}, {14063, 0x12, 0, 2},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {597, 0x0, 0, 0}, {598, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {14065, 0x3, 12, 1}, {14069, 0x3, 12, 1},
+  {14073, 0x3, 12, 1}, {14077, 0x3, 12, 1}, {14169, 0x3, 10, 1},
+  {0, 0x0, 0, 0}, {14173, 0x3, 10, 1}, {14177, 0x3, 10, 1},
+  {14081, 0x12, 0, 2}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {599, 0x0, 0, 0}, {600, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {14097, 0x40, 0, 2},
+  {14113, 0x40, 0, 2}, {14129, 0x40, 0, 2}, {14145, 0x40, 0, 2},
+  {2026, 0x0, 0, 0}, {2027, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {1549, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {1256, 0x0, 0, 0}, {14191, 0x1, 22, 1},
+  {14197, 0x1, 22, 1}, {14157, 0x3, 10, 1}, {14193, 0x3, 10, 1},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {14181, 0x3, 12, 1}, {14173, 0x3, 10, 1}, {14199, 0x3, 10, 1},
+  {14185, 0x41, 0, 2}, {14187, 0x41, 0, 2}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {14189, 0x1, 30, 1},
+  {14207, 0x3, 22, 1}, {14211, 0x3, 22, 1}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {14157, 0x3, 10, 1}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {14173, 0x3, 10, 1},
+  {0, 0x0, 0, 0}, {14217, 0x3, 22, 1}, {0, 0x0, 0, 0},
+  {2265, 0x0, 0, 0}, {2266, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {2267, 0x0, 0, 0}, {0, 0x0, 0, 0}, {343, 0x0, 0, 0},
+  {14225, 0x3, 22, 1}, {0, 0x0, 0, 0}, {1764, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {1765, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {14231, 0x3, 22, 1}, {0, 0x0, 0, 0}, {2046, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {2047, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {105, 0x0, 0, 0}, {0, 0x0, 0, 0}, {14241, 0x3, 19, 1},
+  {14253, 0x3, 19, 1}, {0, 0x0, 0, 0}, {14265, 0x3, 19, 1},
+  {14245, 0x3, 16, 1}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {14249, 0x3, 16, 1}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {675, 0x0, 0, 0}, {676, 0x0, 0, 0}, {677, 0x0, 0, 0},
+  {678, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {14257, 0x3, 16, 1}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {14261, 0x3, 16, 1}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {679, 0x0, 0, 0}, {680, 0x0, 0, 0}, {681, 0x0, 0, 0},
+  {682, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {14269, 0x3, 16, 1}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {14273, 0x3, 16, 1}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {683, 0x0, 0, 0}, {684, 0x0, 0, 0}, {685, 0x0, 0, 0},
+  {686, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {14237, 0x3, 22, 1}, {14283, 0x1f, 16, 1},
+  {14315, 0x1f, 16, 1}, {14347, 0x1f, 16, 1}, {14379, 0x1f, 16, 1},
+  {9, 0x0, 0, 0}, {10, 0x0, 0, 0}, {11, 0x0, 0, 0},
+  {12, 0x0, 0, 0}, {13, 0x0, 0, 0}, {14, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {15, 0x0, 0, 0},
+  {16, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {17, 0x0, 0, 0}, {18, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {19, 0x0, 0, 0}, {20, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {21, 0x0, 0, 0},
+  {22, 0x0, 0, 0}, {23, 0x0, 0, 0}, {24, 0x0, 0, 0},
+  {25, 0x0, 0, 0}, {26, 0x0, 0, 0}, {27, 0x0, 0, 0},
+  {28, 0x0, 0, 0}, {29, 0x0, 0, 0}, {30, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {31, 0x0, 0, 0}, {32, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {33, 0x0, 0, 0},
+  {34, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {35, 0x0, 0, 0}, {36, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {37, 0x0, 0, 0}, {38, 0x0, 0, 0}, {39, 0x0, 0, 0},
+  {40, 0x0, 0, 0}, {41, 0x0, 0, 0}, {42, 0x0, 0, 0},
+  {43, 0x0, 0, 0}, {44, 0x0, 0, 0}, {45, 0x0, 0, 0},
+  {46, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {47, 0x0, 0, 0}, {48, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {49, 0x0, 0, 0}, {50, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {14279, 0x3, 22, 1}, {14415, 0x3, 22, 1}, {14431, 0x3, 22, 1},
+  {14419, 0x1, 20, 1}, {0, 0x0, 0, 0}, {14425, 0x1, 20, 1},
+  {0, 0x0, 0, 0}, {14421, 0x1, 13, 1}, {14423, 0x1, 13, 1},
+  {1870, 0x0, 0, 0}, {1869, 0x0, 0, 0}, {1870, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {14427, 0x1, 13, 1}, {14429, 0x1, 13, 1},
+  {1872, 0x0, 0, 0}, {1871, 0x0, 0, 0}, {1872, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {14435, 0x1, 20, 1}, {14439, 0x1, 20, 1},
+  {14443, 0x1, 20, 1}, {14447, 0x1, 20, 1}, {14437, 0x1, 13, 1},
+  {14437, 0x1, 13, 1}, {0, 0x0, 0, 0}, {1873, 0x0, 0, 0},
+  {14441, 0x1, 13, 1}, {14441, 0x1, 13, 1}, {0, 0x0, 0, 0},
+  {1874, 0x0, 0, 0}, {14445, 0x1, 13, 1}, {14445, 0x1, 13, 1},
+  {0, 0x0, 0, 0}, {1875, 0x0, 0, 0}, {14449, 0x1, 13, 1},
+  {14449, 0x1, 13, 1}, {0, 0x0, 0, 0}, {1876, 0x0, 0, 0},
+  {14453, 0x3, 22, 1}, {14465, 0x3, 22, 1}, {14457, 0x1, 13, 1},
+  {14459, 0x1, 13, 1}, {14461, 0x1, 13, 1}, {14463, 0x1, 13, 1},
+  {402, 0x0, 0, 0}, {403, 0x0, 0, 0}, {404, 0x0, 0, 0},
+  {405, 0x0, 0, 0}, {406, 0x0, 0, 0}, {407, 0x0, 0, 0},
+  {408, 0x0, 0, 0}, {409, 0x0, 0, 0}, {14469, 0x1, 13, 1},
+  {14471, 0x1, 13, 1}, {14473, 0x1, 13, 1}, {14475, 0x1, 13, 1},
+  {412, 0x0, 0, 0}, {410, 0x0, 0, 0}, {412, 0x0, 0, 0},
+  {411, 0x0, 0, 0}, {415, 0x0, 0, 0}, {413, 0x0, 0, 0},
+  {415, 0x0, 0, 0}, {414, 0x0, 0, 0}, {14479, 0x3, 22, 1},
+  {14507, 0x3, 22, 1}, {14483, 0x1, 20, 1}, {14489, 0x1, 20, 1},
+  {14495, 0x1, 20, 1}, {14501, 0x1, 20, 1}, {14485, 0x1, 13, 1},
+  {14487, 0x1, 13, 1}, {0, 0x0, 0, 0}, {1614, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {1615, 0x0, 0, 0}, {14491, 0x1, 13, 1},
+  {14493, 0x1, 13, 1}, {0, 0x0, 0, 0}, {1616, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {1617, 0x0, 0, 0}, {14497, 0x1, 13, 1},
+  {14499, 0x1, 13, 1}, {0, 0x0, 0, 0}, {1618, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {1619, 0x0, 0, 0}, {14503, 0x1, 13, 1},
+  {14505, 0x1, 13, 1}, {0, 0x0, 0, 0}, {1620, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {1621, 0x0, 0, 0}, {14511, 0x1, 20, 1},
+  {14515, 0x1, 20, 1}, {14519, 0x1, 20, 1}, {14523, 0x1, 20, 1},
+  {14513, 0x1, 13, 1}, {14513, 0x1, 13, 1}, {1622, 0x0, 0, 0},
+  {1623, 0x0, 0, 0}, {14517, 0x1, 13, 1}, {14517, 0x1, 13, 1},
+  {1624, 0x0, 0, 0}, {1625, 0x0, 0, 0}, {14521, 0x1, 13, 1},
+  {14521, 0x1, 13, 1}, {1626, 0x0, 0, 0}, {1627, 0x0, 0, 0},
+  {14525, 0x1, 13, 1}, {14525, 0x1, 13, 1}, {1628, 0x0, 0, 0},
+  {1629, 0x0, 0, 0}, {14529, 0x3, 22, 1}, {14557, 0x3, 22, 1},
+  {14533, 0x1, 20, 1}, {14539, 0x1, 20, 1}, {14545, 0x1, 20, 1},
+  {14551, 0x1, 20, 1}, {14535, 0x1, 13, 1}, {14537, 0x1, 13, 1},
+  {1987, 0x0, 0, 0}, {1986, 0x0, 0, 0}, {1987, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {14541, 0x1, 13, 1}, {14543, 0x1, 13, 1},
+  {1989, 0x0, 0, 0}, {1988, 0x0, 0, 0}, {1989, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {14547, 0x1, 13, 1}, {14549, 0x1, 13, 1},
+  {1991, 0x0, 0, 0}, {1990, 0x0, 0, 0}, {1991, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {14553, 0x1, 13, 1}, {14555, 0x1, 13, 1},
+  {1993, 0x0, 0, 0}, {1992, 0x0, 0, 0}, {1993, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {14561, 0x1, 20, 1}, {14567, 0x1, 20, 1},
+  {14573, 0x1, 20, 1}, {14579, 0x1, 20, 1}, {14563, 0x1, 13, 1},
+  {14565, 0x1, 13, 1}, {1622, 0x0, 0, 0}, {1590, 0x0, 0, 0},
+  {1622, 0x0, 0, 0}, {1994, 0x0, 0, 0}, {14569, 0x1, 13, 1},
+  {14571, 0x1, 13, 1}, {1624, 0x0, 0, 0}, {1590, 0x0, 0, 0},
+  {1624, 0x0, 0, 0}, {1995, 0x0, 0, 0}, {14575, 0x1, 13, 1},
+  {14577, 0x1, 13, 1}, {1626, 0x0, 0, 0}, {1593, 0x0, 0, 0},
+  {1626, 0x0, 0, 0}, {1996, 0x0, 0, 0}, {14581, 0x1, 13, 1},
+  {14583, 0x1, 13, 1}, {1628, 0x0, 0, 0}, {1593, 0x0, 0, 0},
+  {1628, 0x0, 0, 0}, {1997, 0x0, 0, 0}, {14587, 0x3, 22, 1},
+  {0, 0x0, 0, 0}, {14591, 0x1, 20, 1}, {0, 0x0, 0, 0},
+  {14597, 0x1, 20, 1}, {0, 0x0, 0, 0}, {14593, 0x1, 13, 1},
+  {14595, 0x1, 13, 1}, {2440, 0x0, 0, 0}, {2439, 0x0, 0, 0},
+  {2440, 0x0, 0, 0}, {0, 0x0, 0, 0}, {14599, 0x1, 13, 1},
+  {14601, 0x1, 13, 1}, {2442, 0x0, 0, 0}, {2441, 0x0, 0, 0},
+  {2442, 0x0, 0, 0}, {0, 0x0, 0, 0}, {14605, 0x3, 22, 1},
+  {14617, 0x3, 22, 1}, {14609, 0x1, 13, 1}, {14611, 0x1, 13, 1},
+  {14613, 0x1, 13, 1}, {14615, 0x1, 13, 1}, {1088, 0x0, 0, 0},
+  {1089, 0x0, 0, 0}, {1090, 0x0, 0, 0}, {1091, 0x0, 0, 0},
+  {1092, 0x0, 0, 0}, {1093, 0x0, 0, 0}, {1094, 0x0, 0, 0},
+  {1095, 0x0, 0, 0}, {14621, 0x1, 13, 1}, {14623, 0x1, 13, 1},
+  {14625, 0x1, 13, 1}, {14627, 0x1, 13, 1}, {412, 0x0, 0, 0},
+  {1096, 0x0, 0, 0}, {412, 0x0, 0, 0}, {1097, 0x0, 0, 0},
+  {415, 0x0, 0, 0}, {1098, 0x0, 0, 0}, {415, 0x0, 0, 0},
+  {1099, 0x0, 0, 0}, {14631, 0x3, 22, 1}, {14659, 0x3, 22, 1},
+  {14635, 0x1, 20, 1}, {14641, 0x1, 20, 1}, {14647, 0x1, 20, 1},
+  {14653, 0x1, 20, 1}, {14637, 0x1, 13, 1}, {14639, 0x1, 13, 1},
+  {0, 0x0, 0, 0}, {662, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {663, 0x0, 0, 0}, {14643, 0x1, 13, 1}, {14645, 0x1, 13, 1},
+  {0, 0x0, 0, 0}, {664, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {665, 0x0, 0, 0}, {14649, 0x1, 13, 1}, {14651, 0x1, 13, 1},
+  {0, 0x0, 0, 0}, {666, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {667, 0x0, 0, 0}, {14655, 0x1, 13, 1}, {14657, 0x1, 13, 1},
+  {0, 0x0, 0, 0}, {668, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {669, 0x0, 0, 0}, {0, 0x0, 0, 0}, {14663, 0x1, 20, 1},
+  {14667, 0x1, 20, 1}, {14671, 0x1, 20, 1}, {14665, 0x1, 13, 1},
+  {14665, 0x1, 13, 1}, {0, 0x0, 0, 0}, {670, 0x0, 0, 0},
+  {14669, 0x1, 13, 1}, {14669, 0x1, 13, 1}, {671, 0x0, 0, 0},
+  {672, 0x0, 0, 0}, {14673, 0x1, 13, 1}, {14673, 0x1, 13, 1},
+  {673, 0x0, 0, 0}, {674, 0x0, 0, 0}, {14677, 0x3, 22, 1},
+  {14705, 0x3, 22, 1}, {14681, 0x1, 20, 1}, {14687, 0x1, 20, 1},
+  {14693, 0x1, 20, 1}, {14699, 0x1, 20, 1}, {14683, 0x1, 13, 1},
+  {14685, 0x1, 13, 1}, {1581, 0x0, 0, 0}, {1580, 0x0, 0, 0},
+  {1581, 0x0, 0, 0}, {0, 0x0, 0, 0}, {14689, 0x1, 13, 1},
+  {14691, 0x1, 13, 1}, {1583, 0x0, 0, 0}, {1582, 0x0, 0, 0},
+  {1583, 0x0, 0, 0}, {0, 0x0, 0, 0}, {14695, 0x1, 13, 1},
+  {14697, 0x1, 13, 1}, {1585, 0x0, 0, 0}, {1584, 0x0, 0, 0},
+  {1585, 0x0, 0, 0}, {0, 0x0, 0, 0}, {14701, 0x1, 13, 1},
+  {14703, 0x1, 13, 1}, {1587, 0x0, 0, 0}, {1586, 0x0, 0, 0},
+  {1587, 0x0, 0, 0}, {0, 0x0, 0, 0}, {14709, 0x1, 20, 1},
+  {14715, 0x1, 20, 1}, {14719, 0x1, 20, 1}, {14725, 0x1, 20, 1},
+  {14711, 0x1, 13, 1}, {14713, 0x1, 13, 1}, {0, 0x0, 0, 0},
+  {1590, 0x0, 0, 0}, {0, 0x0, 0, 0}, {1588, 0x0, 0, 0},
+  {14711, 0x1, 13, 1}, {14717, 0x1, 13, 1}, {0, 0x0, 0, 0},
+  {1589, 0x0, 0, 0}, {14721, 0x1, 13, 1}, {14723, 0x1, 13, 1},
+  {671, 0x0, 0, 0}, {1593, 0x0, 0, 0}, {671, 0x0, 0, 0},
+  {1591, 0x0, 0, 0}, {14727, 0x1, 13, 1}, {14729, 0x1, 13, 1},
+  {673, 0x0, 0, 0}, {1593, 0x0, 0, 0}, {673, 0x0, 0, 0},
+  {1592, 0x0, 0, 0}, {14733, 0x3, 22, 1}, {14749, 0x3, 22, 1},
+  {14737, 0x1, 20, 1}, {0, 0x0, 0, 0}, {14743, 0x1, 20, 1},
+  {0, 0x0, 0, 0}, {14739, 0x1, 13, 1}, {14741, 0x1, 13, 1},
+  {2030, 0x0, 0, 0}, {2029, 0x0, 0, 0}, {2030, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {14745, 0x1, 13, 1}, {14747, 0x1, 13, 1},
+  {2032, 0x0, 0, 0}, {2031, 0x0, 0, 0}, {2032, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {14753, 0x1, 20, 1}, {14757, 0x1, 20, 1},
+  {14761, 0x1, 20, 1}, {0, 0x0, 0, 0}, {14755, 0x1, 13, 1},
+  {14755, 0x1, 13, 1}, {0, 0x0, 0, 0}, {2033, 0x0, 0, 0},
+  {14759, 0x1, 13, 1}, {14759, 0x1, 13, 1}, {0, 0x0, 0, 0},
+  {2034, 0x0, 0, 0}, {14763, 0x1, 13, 1}, {14763, 0x1, 13, 1},
+  {14765, 0x1, 4, 1}, {2035, 0x0, 0, 0}, {838, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {14769, 0x3, 22, 1}, {14781, 0x3, 22, 1},
+  {14773, 0x1, 13, 1}, {14775, 0x1, 13, 1}, {14777, 0x1, 13, 1},
+  {14779, 0x1, 13, 1}, {2410, 0x0, 0, 0}, {2411, 0x0, 0, 0},
+  {2412, 0x0, 0, 0}, {2413, 0x0, 0, 0}, {2414, 0x0, 0, 0},
+  {2415, 0x0, 0, 0}, {2416, 0x0, 0, 0}, {2417, 0x0, 0, 0},
+  {14785, 0x1, 13, 1}, {14787, 0x1, 13, 1}, {14789, 0x1, 13, 1},
+  {14791, 0x1, 13, 1}, {965, 0x0, 0, 0}, {2418, 0x0, 0, 0},
+  {965, 0x0, 0, 0}, {2419, 0x0, 0, 0}, {966, 0x0, 0, 0},
+  {2420, 0x0, 0, 0}, {0, 0x0, 0, 0}, {2421, 0x0, 0, 0},
+  {14795, 0x3, 22, 1}, {14823, 0x3, 22, 1}, {14799, 0x1, 20, 1},
+  {14805, 0x1, 20, 1}, {14811, 0x1, 20, 1}, {14817, 0x1, 20, 1},
+  {14801, 0x1, 13, 1}, {14803, 0x1, 13, 1}, {0, 0x0, 0, 0},
+  {2476, 0x0, 0, 0}, {0, 0x0, 0, 0}, {2477, 0x0, 0, 0},
+  {14807, 0x1, 13, 1}, {14809, 0x1, 13, 1}, {0, 0x0, 0, 0},
+  {2478, 0x0, 0, 0}, {0, 0x0, 0, 0}, {2479, 0x0, 0, 0},
+  {14813, 0x1, 13, 1}, {14815, 0x1, 13, 1}, {0, 0x0, 0, 0},
+  {2480, 0x0, 0, 0}, {0, 0x0, 0, 0}, {2481, 0x0, 0, 0},
+  {14819, 0x1, 13, 1}, {14821, 0x1, 13, 1}, {0, 0x0, 0, 0},
+  {2482, 0x0, 0, 0}, {0, 0x0, 0, 0}, {2483, 0x0, 0, 0},
+  {14827, 0x1, 20, 1}, {14831, 0x1, 20, 1}, {14835, 0x1, 20, 1},
+  {14839, 0x1, 20, 1}, {14829, 0x1, 13, 1}, {14829, 0x1, 13, 1},
+  {1678, 0x0, 0, 0}, {2484, 0x0, 0, 0}, {14833, 0x1, 13, 1},
+  {14833, 0x1, 13, 1}, {1680, 0x0, 0, 0}, {2485, 0x0, 0, 0},
+  {14837, 0x1, 13, 1}, {14837, 0x1, 13, 1}, {1682, 0x0, 0, 0},
+  {2486, 0x0, 0, 0}, {14841, 0x1, 13, 1}, {14841, 0x1, 13, 1},
+  {0, 0x0, 0, 0}, {2487, 0x0, 0, 0}, {14845, 0x3, 22, 1},
+  {14873, 0x3, 22, 1}, {14849, 0x1, 20, 1}, {14855, 0x1, 20, 1},
+  {14861, 0x1, 20, 1}, {14867, 0x1, 20, 1}, {14851, 0x1, 13, 1},
+  {14853, 0x1, 13, 1}, {1670, 0x0, 0, 0}, {1669, 0x0, 0, 0},
+  {1670, 0x0, 0, 0}, {0, 0x0, 0, 0}, {14857, 0x1, 13, 1},
+  {14859, 0x1, 13, 1}, {1672, 0x0, 0, 0}, {1671, 0x0, 0, 0},
+  {1672, 0x0, 0, 0}, {0, 0x0, 0, 0}, {14863, 0x1, 13, 1},
+  {14865, 0x1, 13, 1}, {1674, 0x0, 0, 0}, {1673, 0x0, 0, 0},
+  {1674, 0x0, 0, 0}, {0, 0x0, 0, 0}, {14869, 0x1, 13, 1},
+  {14871, 0x1, 13, 1}, {1676, 0x0, 0, 0}, {1675, 0x0, 0, 0},
+  {1676, 0x0, 0, 0}, {0, 0x0, 0, 0}, {14877, 0x1, 20, 1},
+  {14883, 0x1, 20, 1}, {14889, 0x1, 20, 1}, {14895, 0x1, 20, 1},
+  {14879, 0x1, 13, 1}, {14881, 0x1, 13, 1}, {1678, 0x0, 0, 0},
+  {381, 0x0, 0, 0}, {1678, 0x0, 0, 0}, {1677, 0x0, 0, 0},
+  {14885, 0x1, 13, 1}, {14887, 0x1, 13, 1}, {1680, 0x0, 0, 0},
+  {381, 0x0, 0, 0}, {1680, 0x0, 0, 0}, {1679, 0x0, 0, 0},
+  {14891, 0x1, 13, 1}, {14893, 0x1, 13, 1}, {1682, 0x0, 0, 0},
+  {385, 0x0, 0, 0}, {1682, 0x0, 0, 0}, {1681, 0x0, 0, 0},
+  {14897, 0x1, 13, 1}, {14899, 0x1, 13, 1}, {0, 0x0, 0, 0},
+  {385, 0x0, 0, 0}, {0, 0x0, 0, 0}, {1683, 0x0, 0, 0},
+  {14903, 0x3, 22, 1}, {14919, 0x3, 22, 1}, {14907, 0x1, 20, 1},
+  {0, 0x0, 0, 0}, {14913, 0x1, 20, 1}, {0, 0x0, 0, 0},
+  {14909, 0x1, 13, 1}, {14911, 0x1, 13, 1}, {835, 0x0, 0, 0},
+  {834, 0x0, 0, 0}, {835, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {14915, 0x1, 13, 1}, {14917, 0x1, 13, 1}, {837, 0x0, 0, 0},
+  {836, 0x0, 0, 0}, {837, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {14923, 0x1, 20, 1},
+  {0, 0x0, 0, 0}, {14925, 0x1, 13, 1}, {14925, 0x1, 13, 1},
+  {14765, 0x1, 4, 1}, {0, 0x0, 0, 0}, {14929, 0x3, 22, 1},
+  {14941, 0x3, 22, 1}, {14933, 0x1, 13, 1}, {14935, 0x1, 13, 1},
+  {14937, 0x1, 13, 1}, {14939, 0x1, 13, 1}, {955, 0x0, 0, 0},
+  {956, 0x0, 0, 0}, {957, 0x0, 0, 0}, {958, 0x0, 0, 0},
+  {959, 0x0, 0, 0}, {960, 0x0, 0, 0}, {961, 0x0, 0, 0},
+  {962, 0x0, 0, 0}, {14945, 0x1, 13, 1}, {14947, 0x1, 13, 1},
+  {14949, 0x1, 13, 1}, {14951, 0x1, 13, 1}, {965, 0x0, 0, 0},
+  {963, 0x0, 0, 0}, {965, 0x0, 0, 0}, {964, 0x0, 0, 0},
+  {966, 0x0, 0, 0}, {967, 0x0, 0, 0}, {968, 0x0, 0, 0},
+  {969, 0x0, 0, 0}, {14955, 0x3, 22, 1}, {14983, 0x3, 22, 1},
+  {14959, 0x1, 20, 1}, {14965, 0x1, 20, 1}, {14971, 0x1, 20, 1},
+  {14977, 0x1, 20, 1}, {14961, 0x1, 13, 1}, {14963, 0x1, 13, 1},
+  {0, 0x0, 0, 0}, {622, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {623, 0x0, 0, 0}, {14967, 0x1, 13, 1}, {14969, 0x1, 13, 1},
+  {0, 0x0, 0, 0}, {624, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {625, 0x0, 0, 0}, {14973, 0x1, 13, 1}, {14975, 0x1, 13, 1},
+  {0, 0x0, 0, 0}, {626, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {627, 0x0, 0, 0}, {14979, 0x1, 13, 1}, {14981, 0x1, 13, 1},
+  {0, 0x0, 0, 0}, {628, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {629, 0x0, 0, 0}, {14987, 0x1, 20, 1}, {14991, 0x1, 20, 1},
+  {14995, 0x1, 20, 1}, {0, 0x0, 0, 0}, {14989, 0x1, 13, 1},
+  {14989, 0x1, 13, 1}, {378, 0x0, 0, 0}, {630, 0x0, 0, 0},
+  {14993, 0x1, 13, 1}, {14993, 0x1, 13, 1}, {380, 0x0, 0, 0},
+  {631, 0x0, 0, 0}, {14997, 0x1, 13, 1}, {14997, 0x1, 13, 1},
+  {383, 0x0, 0, 0}, {632, 0x0, 0, 0}, {15001, 0x3, 22, 1},
+  {15029, 0x3, 22, 1}, {15005, 0x1, 20, 1}, {15011, 0x1, 20, 1},
+  {15017, 0x1, 20, 1}, {15023, 0x1, 20, 1}, {15007, 0x1, 13, 1},
+  {15009, 0x1, 13, 1}, {370, 0x0, 0, 0}, {369, 0x0, 0, 0},
+  {370, 0x0, 0, 0}, {0, 0x0, 0, 0}, {15013, 0x1, 13, 1},
+  {15015, 0x1, 13, 1}, {372, 0x0, 0, 0}, {371, 0x0, 0, 0},
+  {372, 0x0, 0, 0}, {0, 0x0, 0, 0}, {15019, 0x1, 13, 1},
+  {15021, 0x1, 13, 1}, {374, 0x0, 0, 0}, {373, 0x0, 0, 0},
+  {374, 0x0, 0, 0}, {0, 0x0, 0, 0}, {15025, 0x1, 13, 1},
+  {15027, 0x1, 13, 1}, {376, 0x0, 0, 0}, {375, 0x0, 0, 0},
+  {376, 0x0, 0, 0}, {0, 0x0, 0, 0}, {15033, 0x1, 20, 1},
+  {15039, 0x1, 20, 1}, {15045, 0x1, 20, 1}, {15051, 0x1, 20, 1},
+  {15035, 0x1, 13, 1}, {15037, 0x1, 13, 1}, {378, 0x0, 0, 0},
+  {381, 0x0, 0, 0}, {378, 0x0, 0, 0}, {377, 0x0, 0, 0},
+  {15041, 0x1, 13, 1}, {15043, 0x1, 13, 1}, {380, 0x0, 0, 0},
+  {381, 0x0, 0, 0}, {380, 0x0, 0, 0}, {379, 0x0, 0, 0},
+  {15047, 0x1, 13, 1}, {15049, 0x1, 13, 1}, {383, 0x0, 0, 0},
+  {385, 0x0, 0, 0}, {383, 0x0, 0, 0}, {382, 0x0, 0, 0},
+  {14897, 0x1, 13, 1}, {15053, 0x1, 13, 1}, {0, 0x0, 0, 0},
+  {384, 0x0, 0, 0}, {15057, 0x3, 22, 1}, {0, 0x0, 0, 0},
+  {1860, 0x0, 0, 0}, {1861, 0x0, 0, 0}, {1862, 0x0, 0, 0},
+  {1863, 0x0, 0, 0}, {15063, 0x3, 22, 1}, {0, 0x0, 0, 0},
+  {2248, 0x0, 0, 0}, {2249, 0x0, 0, 0}, {2250, 0x0, 0, 0},
+  {2251, 0x0, 0, 0}, {1766, 0x0, 0, 0}, {1767, 0x0, 0, 0},
+  {1044, 0x0, 0, 0}, {1045, 0x0, 0, 0}, {15073, 0x3, 22, 1},
+  {15077, 0x3, 22, 1}, {2461, 0x0, 0, 0}, {2461, 0x0, 0, 0},
+  {2461, 0x0, 0, 0}, {0, 0x0, 0, 0}, {2462, 0x0, 0, 0},
+  {2462, 0x0, 0, 0}, {2462, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {15083, 0x3, 22, 1}, {15095, 0x3, 22, 1}, {15087, 0x7, 10, 1},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {825, 0x0, 0, 0}, {825, 0x0, 0, 0}, {825, 0x0, 0, 0},
+  {825, 0x0, 0, 0}, {825, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {15099, 0x7, 10, 1},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {826, 0x0, 0, 0}, {826, 0x0, 0, 0}, {826, 0x0, 0, 0},
+  {826, 0x0, 0, 0}, {826, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {15109, 0x3, 22, 1},
+  {0, 0x0, 0, 0}, {2633, 0x0, 0, 0}, {2634, 0x0, 0, 0},
+  {2635, 0x0, 0, 0}, {2636, 0x0, 0, 0}, {15115, 0x3, 22, 1},
+  {0, 0x0, 0, 0}, {95, 0x0, 0, 0}, {96, 0x0, 0, 0},
+  {97, 0x0, 0, 0}, {98, 0x0, 0, 0}, {15121, 0x1, 23, 1},
+  {15123, 0x1, 23, 1}, {455, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {456, 0x0, 0, 0}, {0, 0x0, 0, 0}, {15127, 0x1, 23, 1},
+  {15129, 0x1, 23, 1}, {1507, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {1508, 0x0, 0, 0}, {1509, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {2115, 0x0, 0, 0}, {2734, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {2371, 0x0, 0, 0}, {0, 0x0, 0, 0}, {15139, 0x3, 22, 1},
+  {15155, 0x3, 22, 1}, {15143, 0x3, 10, 1}, {15147, 0x3, 10, 1},
+  {15151, 0x3, 10, 1}, {0, 0x0, 0, 0}, {1527, 0x0, 0, 0},
+  {1528, 0x0, 0, 0}, {1529, 0x0, 0, 0}, {1530, 0x0, 0, 0},
+  {1531, 0x0, 0, 0}, {1532, 0x0, 0, 0}, {1533, 0x0, 0, 0},
+  {1534, 0x0, 0, 0}, {1535, 0x0, 0, 0}, {1536, 0x0, 0, 0},
+  {1537, 0x0, 0, 0}, {1538, 0x0, 0, 0}, {15159, 0x3, 10, 1},
+  {15163, 0x3, 10, 1}, {15167, 0x3, 10, 1}, {0, 0x0, 0, 0},
+  {1539, 0x0, 0, 0}, {1540, 0x0, 0, 0}, {1541, 0x0, 0, 0},
+  {1542, 0x0, 0, 0}, {1543, 0x0, 0, 0}, {1544, 0x0, 0, 0},
+  {1545, 0x0, 0, 0}, {1546, 0x0, 0, 0}, {1547, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {15173, 0x3, 22, 1}, {15241, 0x3, 22, 1}, {15177, 0xf, 10, 1},
+  {15193, 0xf, 10, 1}, {15209, 0xf, 10, 1}, {15225, 0xf, 10, 1},
+  {872, 0x0, 0, 0}, {0, 0x0, 0, 0}, {271, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {873, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {271, 0x0, 0, 0}, {0, 0x0, 0, 0}, {874, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {271, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {875, 0x0, 0, 0}, {0, 0x0, 0, 0}, {271, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {876, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {272, 0x0, 0, 0}, {0, 0x0, 0, 0}, {877, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {272, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {878, 0x0, 0, 0}, {0, 0x0, 0, 0}, {272, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {879, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {272, 0x0, 0, 0}, {0, 0x0, 0, 0}, {880, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {884, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {881, 0x0, 0, 0}, {0, 0x0, 0, 0}, {884, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {882, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {884, 0x0, 0, 0}, {0, 0x0, 0, 0}, {883, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {884, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {885, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {886, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {887, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {888, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {15245, 0xf, 10, 1}, {15261, 0xf, 10, 1},
+  {15277, 0xf, 10, 1}, {15293, 0xf, 10, 1}, {889, 0x0, 0, 0},
+  {897, 0x0, 0, 0}, {522, 0x0, 0, 0}, {898, 0x0, 0, 0},
+  {890, 0x0, 0, 0}, {897, 0x0, 0, 0}, {522, 0x0, 0, 0},
+  {898, 0x0, 0, 0}, {891, 0x0, 0, 0}, {897, 0x0, 0, 0},
+  {522, 0x0, 0, 0}, {898, 0x0, 0, 0}, {892, 0x0, 0, 0},
+  {897, 0x0, 0, 0}, {522, 0x0, 0, 0}, {898, 0x0, 0, 0},
+  {893, 0x0, 0, 0}, {897, 0x0, 0, 0}, {523, 0x0, 0, 0},
+  {898, 0x0, 0, 0}, {894, 0x0, 0, 0}, {897, 0x0, 0, 0},
+  {523, 0x0, 0, 0}, {898, 0x0, 0, 0}, {895, 0x0, 0, 0},
+  {897, 0x0, 0, 0}, {523, 0x0, 0, 0}, {898, 0x0, 0, 0},
+  {896, 0x0, 0, 0}, {897, 0x0, 0, 0}, {523, 0x0, 0, 0},
+  {898, 0x0, 0, 0}, {899, 0x0, 0, 0}, {908, 0x0, 0, 0},
+  {903, 0x0, 0, 0}, {909, 0x0, 0, 0}, {900, 0x0, 0, 0},
+  {908, 0x0, 0, 0}, {903, 0x0, 0, 0}, {909, 0x0, 0, 0},
+  {901, 0x0, 0, 0}, {908, 0x0, 0, 0}, {903, 0x0, 0, 0},
+  {909, 0x0, 0, 0}, {902, 0x0, 0, 0}, {908, 0x0, 0, 0},
+  {903, 0x0, 0, 0}, {909, 0x0, 0, 0}, {904, 0x0, 0, 0},
+  {908, 0x0, 0, 0}, {0, 0x0, 0, 0}, {909, 0x0, 0, 0},
+  {905, 0x0, 0, 0}, {908, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {909, 0x0, 0, 0}, {906, 0x0, 0, 0}, {908, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {909, 0x0, 0, 0}, {907, 0x0, 0, 0},
+  {908, 0x0, 0, 0}, {0, 0x0, 0, 0}, {909, 0x0, 0, 0},
+  {15311, 0x3, 22, 1}, {15379, 0x3, 22, 1}, {15315, 0xf, 10, 1},
+  {15331, 0xf, 10, 1}, {15347, 0xf, 10, 1}, {15363, 0xf, 10, 1},
+  {1459, 0x0, 0, 0}, {0, 0x0, 0, 0}, {271, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {1460, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {271, 0x0, 0, 0}, {0, 0x0, 0, 0}, {1461, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {271, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {1462, 0x0, 0, 0}, {0, 0x0, 0, 0}, {271, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {1463, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {272, 0x0, 0, 0}, {0, 0x0, 0, 0}, {1464, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {272, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {1465, 0x0, 0, 0}, {0, 0x0, 0, 0}, {272, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {1466, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {272, 0x0, 0, 0}, {0, 0x0, 0, 0}, {1467, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {884, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {1468, 0x0, 0, 0}, {0, 0x0, 0, 0}, {884, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {1469, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {884, 0x0, 0, 0}, {0, 0x0, 0, 0}, {1470, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {884, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {1471, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {1472, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {1473, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {1474, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {15383, 0xf, 10, 1}, {15399, 0xf, 10, 1},
+  {15415, 0xf, 10, 1}, {15431, 0xf, 10, 1}, {1475, 0x0, 0, 0},
+  {897, 0x0, 0, 0}, {522, 0x0, 0, 0}, {898, 0x0, 0, 0},
+  {1476, 0x0, 0, 0}, {897, 0x0, 0, 0}, {522, 0x0, 0, 0},
+  {898, 0x0, 0, 0}, {1477, 0x0, 0, 0}, {897, 0x0, 0, 0},
+  {522, 0x0, 0, 0}, {898, 0x0, 0, 0}, {1478, 0x0, 0, 0},
+  {897, 0x0, 0, 0}, {522, 0x0, 0, 0}, {898, 0x0, 0, 0},
+  {1479, 0x0, 0, 0}, {897, 0x0, 0, 0}, {523, 0x0, 0, 0},
+  {898, 0x0, 0, 0}, {1480, 0x0, 0, 0}, {897, 0x0, 0, 0},
+  {523, 0x0, 0, 0}, {898, 0x0, 0, 0}, {1481, 0x0, 0, 0},
+  {897, 0x0, 0, 0}, {523, 0x0, 0, 0}, {898, 0x0, 0, 0},
+  {1482, 0x0, 0, 0}, {897, 0x0, 0, 0}, {523, 0x0, 0, 0},
+  {898, 0x0, 0, 0}, {1483, 0x0, 0, 0}, {908, 0x0, 0, 0},
+  {903, 0x0, 0, 0}, {909, 0x0, 0, 0}, {1484, 0x0, 0, 0},
+  {908, 0x0, 0, 0}, {903, 0x0, 0, 0}, {909, 0x0, 0, 0},
+  {1485, 0x0, 0, 0}, {908, 0x0, 0, 0}, {903, 0x0, 0, 0},
+  {909, 0x0, 0, 0}, {1486, 0x0, 0, 0}, {908, 0x0, 0, 0},
+  {903, 0x0, 0, 0}, {909, 0x0, 0, 0}, {1487, 0x0, 0, 0},
+  {908, 0x0, 0, 0}, {0, 0x0, 0, 0}, {909, 0x0, 0, 0},
+  {1488, 0x0, 0, 0}, {908, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {909, 0x0, 0, 0}, {1489, 0x0, 0, 0}, {908, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {909, 0x0, 0, 0}, {1490, 0x0, 0, 0},
+  {908, 0x0, 0, 0}, {0, 0x0, 0, 0}, {909, 0x0, 0, 0},
+  {15449, 0x3, 12, 1}, {15453, 0x3, 12, 1}, {839, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {840, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {271, 0x0, 0, 0}, {272, 0x0, 0, 0},
+  {15461, 0x3, 12, 1}, {15465, 0x3, 12, 1}, {1824, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {1825, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {884, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {2378, 0x0, 0, 0}, {15475, 0x3, 12, 1},
+  {15479, 0x3, 12, 1}, {2629, 0x0, 0, 0}, {15471, 0x44, 0, 2},
+  {2630, 0x0, 0, 0}, {2631, 0x0, 0, 0}, {2632, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {522, 0x0, 0, 0}, {523, 0x0, 0, 0}, {15487, 0x3, 12, 1},
+  {15491, 0x3, 12, 1}, {1221, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {1222, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {903, 0x0, 0, 0}, {0, 0x0, 0, 0}, {15499, 0x1, 23, 1},
+  {15509, 0x1, 23, 1}, {15501, 0x3, 10, 1}, {15505, 0x3, 10, 1},
+  {15447, 0x1, 22, 1}, {0, 0x0, 0, 0}, {15457, 0x1, 22, 1},
+  {0, 0x0, 0, 0}, {15459, 0x1, 22, 1}, {0, 0x0, 0, 0},
+  {15469, 0x1, 22, 1}, {0, 0x0, 0, 0}, {15511, 0x3, 10, 1},
+  {15515, 0x3, 10, 1}, {15473, 0x1, 22, 1}, {897, 0x0, 0, 0},
+  {15483, 0x1, 22, 1}, {898, 0x0, 0, 0}, {15485, 0x1, 22, 1},
+  {908, 0x0, 0, 0}, {15495, 0x1, 22, 1}, {909, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {340, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {833, 0x0, 0, 0}, {0, 0x0, 0, 0}, {2447, 0x0, 0, 0},
+  {15527, 0x1, 23, 1}, {15537, 0x1, 23, 1}, {15529, 0x3, 10, 1},
+  {15533, 0x3, 10, 1}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {15457, 0x1, 22, 1}, {0, 0x0, 0, 0}, {15519, 0x45, 0, 2},
+  {0, 0x0, 0, 0}, {15469, 0x1, 22, 1}, {0, 0x0, 0, 0},
+  {15539, 0x3, 10, 1}, {15543, 0x3, 10, 1}, {15521, 0x46, 0, 2},
+  {897, 0x0, 0, 0}, {15483, 0x1, 22, 1}, {898, 0x0, 0, 0},
+  {15523, 0x45, 0, 2}, {908, 0x0, 0, 0}, {15495, 0x1, 22, 1},
+  {909, 0x0, 0, 0}, {15549, 0x3, 22, 1}, {15553, 0x3, 22, 1},
+  {2186, 0x0, 0, 0}, {2187, 0x0, 0, 0}, {2188, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {2189, 0x0, 0, 0}, {2190, 0x0, 0, 0},
+  {2191, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {2227, 0x0, 0, 0}, {0, 0x0, 0, 0}, {987, 0x0, 0, 0},
+  {988, 0x0, 0, 0}, {0, 0x0, 0, 0}, {989, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {1031, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {2463, 0x0, 0, 0}, {951, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {990, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {15575, 0x3, 22, 1}, {15591, 0x3, 22, 1}, {15579, 0x3, 10, 1},
+  {15583, 0x3, 10, 1}, {0, 0x0, 0, 0}, {15587, 0x3, 10, 1},
+  {15557, 0x12, 0, 2}, {15559, 0x47, 0, 2}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {15561, 0x1, 4, 1}, {0, 0x0, 0, 0},
+  {15563, 0x1, 4, 1}, {0, 0x0, 0, 0}, {15565, 0x12, 0, 2},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {15595, 0x3, 10, 1}, {15599, 0x3, 10, 1}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {15567, 0x12, 0, 2}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {15569, 0x1, 4, 1},
+  {0, 0x0, 0, 0}, {15571, 0x1, 4, 1}, {0, 0x0, 0, 0},
+  {15605, 0x3, 22, 1}, {15613, 0x3, 22, 1}, {0, 0x0, 0, 0},
+  {15609, 0x3, 10, 1}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {15561, 0x1, 4, 1}, {0, 0x0, 0, 0}, {15563, 0x1, 4, 1},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {15617, 0x3, 10, 1},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {15569, 0x1, 4, 1},
+  {0, 0x0, 0, 0}, {15571, 0x1, 4, 1}, {0, 0x0, 0, 0},
+  {15623, 0x1, 22, 1}, {15657, 0x1, 22, 1}, {15625, 0xf, 10, 1},
+  {15641, 0xf, 10, 1}, {0, 0x0, 0, 0}, {987, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {988, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {989, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {988, 0x0, 0, 0}, {0, 0x0, 0, 0}, {989, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {988, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {989, 0x0, 0, 0}, {0, 0x0, 0, 0}, {988, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {989, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {15659, 0xf, 10, 1}, {951, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {990, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {951, 0x0, 0, 0}, {0, 0x0, 0, 0}, {990, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {951, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {990, 0x0, 0, 0}, {0, 0x0, 0, 0}, {951, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {990, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {15621, 0x1, 30, 1}, {15679, 0x3, 22, 1},
+  {15691, 0x3, 22, 1}, {15683, 0x3, 10, 1}, {15687, 0x3, 10, 1},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {2277, 0x0, 0, 0},
+  {2278, 0x0, 0, 0}, {0, 0x0, 0, 0}, {2279, 0x0, 0, 0},
+  {2280, 0x0, 0, 0}, {2281, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {2282, 0x0, 0, 0}, {15695, 0x3, 10, 1}, {15699, 0x3, 10, 1},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {2283, 0x0, 0, 0},
+  {2284, 0x0, 0, 0}, {0, 0x0, 0, 0}, {2285, 0x0, 0, 0},
+  {2286, 0x0, 0, 0}, {2287, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {2288, 0x0, 0, 0}, {15705, 0x3, 22, 1}, {15717, 0x3, 22, 1},
+  {15709, 0x3, 10, 1}, {15713, 0x3, 10, 1}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {2273, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {2274, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {15721, 0x3, 10, 1}, {15725, 0x3, 10, 1}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {2275, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {2276, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {15731, 0x3, 22, 1}, {15735, 0x3, 22, 1}, {264, 0x0, 0, 0},
+  {265, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {266, 0x0, 0, 0}, {267, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {15741, 0x3f, 24, 1}, {16033, 0x3f, 24, 1},
+  {15805, 0x1, 21, 1}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {15807, 0x1, 21, 1}, {15817, 0x1, 21, 1},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {15827, 0x1, 21, 1},
+  {0, 0x0, 0, 0}, {15837, 0x1, 21, 1}, {15847, 0x1, 21, 1},
+  {15853, 0x1, 21, 1}, {15859, 0x1, 21, 1}, {15869, 0x1, 21, 1},
+  {15879, 0x1, 21, 1}, {2751, 0x0, 0, 0}, {4805, 0x1, 30, 1},
+  {4811, 0x1, 30, 1}, {15889, 0x1, 21, 1}, {4837, 0x1, 30, 1},
+  {4841, 0x1, 30, 1}, {4841, 0x1, 30, 1}, {4841, 0x1, 30, 1},
+  {4843, 0x1, 30, 1}, {15895, 0x1, 21, 1}, {15901, 0x1, 21, 1},
+  {15907, 0x1, 21, 1}, {5593, 0x1, 30, 1}, {15913, 0x1, 21, 1},
+  {15919, 0x1, 21, 1}, {15929, 0x1, 21, 1}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {15939, 0x1, 21, 1}, {15949, 0x1, 21, 1}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {8427, 0x1, 30, 1}, {8437, 0x1, 30, 1},
+  {15959, 0x1, 21, 1}, {15969, 0x1, 21, 1}, {8487, 0x1, 30, 1},
+  {8497, 0x1, 30, 1}, {15975, 0x1, 21, 1}, {15985, 0x1, 21, 1},
+  {2751, 0x0, 0, 0}, {10361, 0x1, 30, 1}, {10367, 0x1, 30, 1},
+  {10377, 0x15, 0, 2}, {10379, 0x1, 30, 1}, {10381, 0x1, 30, 1},
+  {10383, 0x1, 30, 1}, {10385, 0x1, 30, 1}, {15995, 0x1, 21, 1},
+  {10981, 0x1, 30, 1}, {16001, 0x1, 21, 1}, {0, 0x0, 0, 0},
+  {16007, 0x1, 21, 1}, {11153, 0x1, 30, 1}, {16013, 0x1, 21, 1},
+  {16023, 0x1, 21, 1}, {1, 0x0, 0, 2}, {0, 0x0, 0, 0},
+  {15809, 0x3, 14, 1}, {15813, 0x3, 14, 1}, {77, 0x1, 30, 1},
+  {83, 0x1, 30, 1}, {141, 0x1, 30, 1}, {319, 0x1, 30, 1},
+  {323, 0x1, 30, 1}, {515, 0x1, 30, 1}, {577, 0x1, 30, 1},
+  {763, 0x1, 30, 1}, {15819, 0x3, 14, 1}, {15823, 0x3, 14, 1},
+  {859, 0x1, 30, 1}, {913, 0x1, 30, 1}, {1019, 0x1, 30, 1},
+  {1117, 0x1, 30, 1}, {1191, 0x1, 30, 1}, {1289, 0x1, 30, 1},
+  {1391, 0x1, 30, 1}, {1481, 0x1, 30, 1}, {15829, 0x3, 14, 1},
+  {15833, 0x3, 14, 1}, {1483, 0x1, 30, 1}, {1483, 0x1, 30, 1},
+  {1493, 0x1, 30, 1}, {1493, 0x1, 30, 1}, {0, 0x0, 0, 0},
+  {1503, 0x1, 30, 1}, {0, 0x0, 0, 0}, {1641, 0x1, 30, 1},
+  {15839, 0x3, 14, 1}, {15843, 0x3, 14, 1}, {1779, 0x1, 30, 1},
+  {1779, 0x1, 30, 1}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {1781, 0x1, 30, 1}, {1781, 0x1, 30, 1}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {15849, 0x3, 14, 1}, {1793, 0x1, 30, 1},
+  {1783, 0x1, 30, 1}, {1783, 0x1, 30, 1}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {15855, 0x3, 14, 1}, {0, 0x0, 0, 0},
+  {1895, 0x1, 12, 1}, {1933, 0x3, 22, 1}, {2065, 0x1, 12, 1},
+  {0, 0x0, 0, 0}, {15861, 0x3, 14, 1}, {15865, 0x3, 14, 1},
+  {2083, 0x3, 22, 1}, {2219, 0x1, 10, 1}, {2353, 0x1, 11, 1},
+  {2427, 0xc, 0, 2}, {2445, 0x3, 22, 1}, {2581, 0x1, 10, 1},
+  {2715, 0x1, 11, 1}, {2789, 0xc, 0, 2}, {15871, 0x3, 14, 1},
+  {15875, 0x3, 14, 1}, {2959, 0xf, 10, 1}, {2975, 0x3, 22, 1},
+  {3011, 0x1, 30, 1}, {0, 0x0, 0, 0}, {3141, 0xf, 10, 1},
+  {3245, 0xf, 10, 1}, {3789, 0xf, 10, 1}, {4319, 0xf, 10, 1},
+  {15881, 0x3, 14, 1}, {15885, 0x3, 14, 1}, {4397, 0x1, 12, 1},
+  {4441, 0x1, 12, 1}, {4501, 0x1, 12, 1}, {4543, 0x1, 13, 1},
+  {4549, 0x3, 22, 1}, {4617, 0x3, 22, 1}, {4685, 0x3, 22, 1},
+  {4737, 0x3, 22, 1}, {15891, 0x3, 14, 1}, {4831, 0x1, 30, 1},
+  {4821, 0x1, 30, 1}, {4821, 0x1, 30, 1}, {4831, 0x1, 30, 1},
+  {4831, 0x1, 30, 1}, {15897, 0x3, 14, 1}, {0, 0x0, 0, 0},
+  {4845, 0x1, 30, 1}, {4983, 0x1, 30, 1}, {5121, 0x1, 30, 1},
+  {5259, 0x1, 30, 1}, {15903, 0x3, 14, 1}, {0, 0x0, 0, 0},
+  {5487, 0x1, 30, 1}, {5521, 0x1, 30, 1}, {5579, 0x1, 30, 1},
+  {5579, 0x1, 30, 1}, {15909, 0x3, 14, 1}, {0, 0x0, 0, 0},
+  {5589, 0x15, 0, 2}, {5589, 0x15, 0, 2}, {5591, 0x15, 0, 2},
+  {5591, 0x15, 0, 2}, {15915, 0x3, 14, 1}, {0, 0x0, 0, 0},
+  {5595, 0x3, 22, 1}, {5663, 0x3, 22, 1}, {5731, 0x3, 22, 1},
+  {5799, 0x3, 22, 1}, {15921, 0x3, 14, 1}, {15925, 0x3, 14, 1},
+  {5851, 0x1, 30, 1}, {5905, 0x1, 30, 1}, {5967, 0x16, 0, 2},
+  {5967, 0x16, 0, 2}, {6237, 0x1, 30, 1}, {6467, 0x1, 30, 1},
+  {6565, 0x1, 30, 1}, {6807, 0x1, 30, 1}, {15931, 0x3, 14, 1},
+  {15935, 0x3, 14, 1}, {6893, 0x1, 30, 1}, {6945, 0x1, 30, 1},
+  {6997, 0x1, 30, 1}, {7039, 0x1, 30, 1}, {7041, 0x1, 30, 1},
+  {7099, 0x1, 30, 1}, {7153, 0x1, 30, 1}, {7211, 0x1, 30, 1},
+  {15941, 0x3, 14, 1}, {15945, 0x3, 14, 1}, {7249, 0x1, 30, 1},
+  {7257, 0x1, 30, 1}, {7401, 0x1, 30, 1}, {7407, 0x1, 30, 1},
+  {7475, 0x1, 30, 1}, {7517, 0x1, 30, 1}, {7561, 0x1, 30, 1},
+  {7593, 0x1, 30, 1}, {15951, 0x3, 14, 1}, {15955, 0x3, 14, 1},
+  {7667, 0x1, 30, 1}, {7765, 0x1, 30, 1}, {8059, 0x1, 30, 1},
+  {8141, 0x1, 30, 1}, {8231, 0x1, 30, 1}, {8237, 0x1, 30, 1},
+  {8345, 0x1, 30, 1}, {8347, 0x1, 30, 1}, {15961, 0x3, 14, 1},
+  {15965, 0x3, 14, 1}, {8447, 0x1, 30, 1}, {8447, 0x1, 30, 1},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {8449, 0x1, 30, 1},
+  {8449, 0x1, 30, 1}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {15971, 0x3, 14, 1}, {8461, 0x1, 30, 1}, {8451, 0x1, 30, 1},
+  {8451, 0x1, 30, 1}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {15977, 0x3, 14, 1}, {15981, 0x3, 14, 1}, {8541, 0x3, 22, 1},
+  {8589, 0xd, 0, 2}, {8591, 0x1, 30, 1}, {8633, 0x1, 30, 1},
+  {8777, 0xf, 10, 1}, {8961, 0xf, 10, 1}, {9473, 0xf, 10, 1},
+  {9873, 0xf, 10, 1}, {15987, 0x3, 14, 1}, {15991, 0x3, 14, 1},
+  {9939, 0x1, 12, 1}, {9983, 0x1, 12, 1}, {10047, 0x1, 12, 1},
+  {10099, 0x1, 13, 1}, {10105, 0x3, 22, 1}, {10173, 0x3, 22, 1},
+  {10241, 0x3, 22, 1}, {10309, 0x3, 22, 1}, {10387, 0x1, 30, 1},
+  {15997, 0x3, 14, 1}, {10429, 0x1, 30, 1}, {10567, 0x1, 30, 1},
+  {10705, 0x1, 30, 1}, {10843, 0x1, 30, 1}, {16003, 0x3, 14, 1},
+  {0, 0x0, 0, 0}, {11019, 0x28, 0, 2}, {11035, 0x2a, 0, 2},
+  {11037, 0x1, 30, 1}, {11037, 0x1, 30, 1}, {11055, 0x1, 30, 1},
+  {16009, 0x3, 14, 1}, {11089, 0x1, 30, 1}, {11123, 0x1, 30, 1},
+  {11089, 0x1, 30, 1}, {11089, 0x1, 30, 1}, {16015, 0x3, 14, 1},
+  {16019, 0x3, 14, 1}, {11163, 0x1, 30, 1}, {0, 0x0, 0, 0},
+  {11201, 0x1, 30, 1}, {0, 0x0, 0, 0}, {11239, 0x1, 30, 1},
+  {11263, 0x1, 30, 1}, {11549, 0x1, 30, 1}, {11853, 0x1, 30, 1},
+  {16025, 0x3, 14, 1}, {16029, 0x3, 14, 1}, {11869, 0x2d, 0, 2},
+  {11885, 0x2d, 0, 2}, {11935, 0x2e, 0, 2}, {11975, 0x1, 30, 1},
+  {11977, 0x1, 30, 1}, {11997, 0x1, 30, 1}, {12017, 0x1, 30, 1},
+  {12071, 0x1, 30, 1}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {16097, 0x1, 21, 1},
+  {16107, 0x1, 21, 1}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {16117, 0x1, 21, 1}, {0, 0x0, 0, 0}, {16127, 0x1, 21, 1},
+  {16129, 0x1, 21, 1}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {16131, 0x1, 21, 1}, {0, 0x0, 0, 0}, {2752, 0x0, 0, 0},
+  {12761, 0x1, 30, 1}, {12771, 0x1, 30, 1}, {16141, 0x1, 21, 1},
+  {16143, 0x1, 21, 1}, {16145, 0x1, 21, 1}, {16155, 0x1, 21, 1},
+  {16165, 0x1, 21, 1}, {13543, 0x1, 30, 1}, {16175, 0x1, 21, 1},
+  {16185, 0x1, 21, 1}, {16191, 0x1, 21, 1}, {14235, 0x1, 30, 1},
+  {15913, 0x1, 21, 1}, {16201, 0x1, 21, 1}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {16207, 0x1, 21, 1}, {16217, 0x1, 21, 1},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {15055, 0x1, 30, 1},
+  {15061, 0x1, 30, 1}, {16227, 0x1, 21, 1}, {16229, 0x1, 21, 1},
+  {15107, 0x1, 30, 1}, {15113, 0x1, 30, 1}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {2752, 0x0, 0, 0}, {15119, 0x1, 30, 1},
+  {15125, 0x1, 30, 1}, {15131, 0x43, 0, 2}, {15133, 0x1, 30, 1},
+  {15135, 0x1, 30, 1}, {10383, 0x1, 30, 1}, {10385, 0x1, 30, 1},
+  {16231, 0x1, 21, 1}, {15547, 0x1, 30, 1}, {16237, 0x1, 21, 1},
+  {0, 0x0, 0, 0}, {16243, 0x1, 21, 1}, {15729, 0x1, 30, 1},
+  {0, 0x0, 0, 0}, {0, 0x0, 0, 0}, {16099, 0x3, 14, 1},
+  {16103, 0x3, 14, 1}, {12107, 0x1, 30, 1}, {12121, 0x1, 30, 1},
+  {12135, 0x1, 30, 1}, {12161, 0x1, 30, 1}, {12199, 0x1, 30, 1},
+  {12221, 0x1, 30, 1}, {12243, 0x1, 30, 1}, {12273, 0x1, 30, 1},
+  {16109, 0x3, 14, 1}, {16113, 0x3, 14, 1}, {12299, 0x1, 30, 1},
+  {12321, 0x1, 30, 1}, {12345, 0x1, 30, 1}, {12365, 0x1, 30, 1},
+  {12403, 0x1, 30, 1}, {12411, 0x1, 30, 1}, {12427, 0x1, 30, 1},
+  {12441, 0x1, 30, 1}, {16119, 0x3, 14, 1}, {16123, 0x3, 14, 1},
+  {12465, 0x1, 30, 1}, {12465, 0x1, 30, 1}, {12475, 0x1, 30, 1},
+  {12475, 0x1, 30, 1}, {12485, 0x1, 30, 1}, {12495, 0x1, 30, 1},
+  {12569, 0x1, 30, 1}, {12579, 0x1, 30, 1}, {12653, 0x1, 30, 1},
+  {12655, 0x1, 30, 1}, {12657, 0x1, 30, 1}, {12667, 0x1, 30, 1},
+  {16133, 0x3, 14, 1}, {16137, 0x3, 14, 1}, {12693, 0x1, 30, 1},
+  {12693, 0x1, 30, 1}, {12711, 0x1, 30, 1}, {12713, 0x30, 0, 2},
+  {12715, 0x31, 0, 2}, {12715, 0x31, 0, 2}, {12717, 0x1, 30, 1},
+  {12739, 0x1, 30, 1}, {12777, 0x1, 30, 1}, {12787, 0x1, 30, 1},
+  {12861, 0x1, 30, 1}, {12963, 0x1, 30, 1}, {16147, 0x3, 14, 1},
+  {16151, 0x3, 14, 1}, {13285, 0x1, 30, 1}, {13299, 0x1, 30, 1},
+  {13301, 0x1, 30, 1}, {13301, 0x1, 30, 1}, {13321, 0x1, 30, 1},
+  {13323, 0x1, 30, 1}, {13323, 0x1, 30, 1}, {13323, 0x1, 30, 1},
+  {16157, 0x3, 14, 1}, {16161, 0x3, 14, 1}, {13441, 0x1, 30, 1},
+  {13443, 0x1, 30, 1}, {13443, 0x1, 30, 1}, {13443, 0x1, 30, 1},
+  {13529, 0x1, 30, 1}, {13443, 0x1, 30, 1}, {13443, 0x1, 30, 1},
+  {13443, 0x1, 30, 1}, {16167, 0x3, 14, 1}, {16171, 0x3, 14, 1},
+  {13535, 0x1, 30, 1}, {13443, 0x1, 30, 1}, {13443, 0x1, 30, 1},
+  {13443, 0x1, 30, 1}, {13541, 0x1, 30, 1}, {13443, 0x1, 30, 1},
+  {13443, 0x1, 30, 1}, {13443, 0x1, 30, 1}, {16177, 0x3, 14, 1},
+  {16181, 0x3, 14, 1}, {13545, 0x1, 30, 1}, {13667, 0x1, 30, 1},
+  {13789, 0x1, 30, 1}, {13911, 0x1, 30, 1}, {14043, 0x1, 30, 1},
+  {14045, 0x1, 30, 1}, {14045, 0x1, 30, 1}, {14045, 0x1, 30, 1},
+  {16187, 0x3, 14, 1}, {0, 0x0, 0, 0}, {14147, 0x1, 30, 1},
+  {14203, 0x1, 23, 1}, {14205, 0x1, 30, 1}, {14205, 0x1, 30, 1},
+  {16193, 0x3, 14, 1}, {16197, 0x3, 14, 1}, {14215, 0x1, 30, 1},
+  {14215, 0x1, 30, 1}, {14221, 0x15, 0, 2}, {14221, 0x15, 0, 2},
+  {14223, 0x1, 30, 1}, {14223, 0x1, 30, 1}, {14229, 0x1, 30, 1},
+  {14229, 0x1, 30, 1}, {14277, 0x16, 0, 2}, {16203, 0x3, 14, 1},
+  {14411, 0x42, 0, 2}, {0, 0x0, 0, 0}, {0, 0x0, 0, 0},
+  {0, 0x0, 0, 0}, {16209, 0x3, 14, 1}, {16213, 0x3, 14, 1},
+  {14413, 0x1, 30, 1}, {14451, 0x1, 30, 1}, {14477, 0x1, 30, 1},
+  {14527, 0x1, 30, 1}, {14585, 0x1, 30, 1}, {14603, 0x1, 30, 1},
+  {14629, 0x1, 30, 1}, {14675, 0x1, 30, 1}, {16219, 0x3, 14, 1},
+  {16223, 0x3, 14, 1}, {14731, 0x1, 30, 1}, {14767, 0x1, 30, 1},
+  {14793, 0x1, 30, 1}, {14843, 0x1, 30, 1}, {14901, 0x1, 30, 1},
+  {14927, 0x1, 30, 1}, {14953, 0x1, 30, 1}, {14999, 0x1, 30, 1},
+  {15067, 0x1, 30, 1}, {15069, 0x1, 30, 1}, {15071, 0x1, 30, 1},
+  {15081, 0x1, 30, 1}, {15137, 0x1, 30, 1}, {16233, 0x3, 14, 1},
+  {15171, 0x1, 30, 1}, {15309, 0x1, 30, 1}, {15497, 0x1, 30, 1},
+  {15525, 0x1, 30, 1}, {16239, 0x3, 14, 1}, {0, 0x0, 0, 0},
+  {15573, 0x1, 30, 1}, {15603, 0x1, 30, 1}, {15675, 0x48, 0, 2},
+  {15603, 0x1, 30, 1}, {15677, 0x1, 30, 1}, {15703, 0x1, 30, 1},
+};
+
+// The {mask, value} pairs used by kTestEntry entries.
+static const DecodeTableTest kDecodeTableTests[] = {
+  {0x40df0000, 0x00000000}, {0x001f0000, 0x00000000}, {0x00df0000, 0x00000000},
+  {0x00000210, 0x00000000}, {0x00100210, 0x00000000}, {0x00870000, 0x00000000},
+  {0x00001c00, 0x00000000}, {0x001c0000, 0x00000000}, {0x001d0000, 0x00000000},
+  {0x00c00800, 0x00000000}, {0x00060000, 0x00000000}, {0x00061000, 0x00000000},
+  {0x00401000, 0x00400000}, {0x00c00000, 0x00000000}, {0x00c00000, 0x00400000},
+  {0x00160000, 0x00000000}, {0x00170000, 0x00000000}, {0x00d80800, 0x00000000},
+  {0x00003000, 0x00000000}, {0x00003000, 0x00002000}, {0x001f3000, 0x00000000},
+  {0x40c00000, 0x00000000}, {0x40040000, 0x00000000}, {0x000003e0, 0x00000000},
+  {0x00003000, 0x00003000}, {0x000013e0, 0x00001000}, {0x00003000, 0x00001000},
+  {0x00803000, 0x00002000}, {0x000f0000, 0x00000000}, {0x000f0010, 0x00000000},
+  {0x00c0020f, 0x00400000}, {0x00c00200, 0x00400000}, {0x00c003e0, 0x00000000},
+  {0x00000c00, 0x00000000}, {0x00c0001f, 0x00000000}, {0x00c001ff, 0x00000000},
+  {0x00002400, 0x00000000}, {0x00100200, 0x00000000}, {0x009f0000, 0x00010000},
+  {0x001f301f, 0x0000000d}, {0x00800400, 0x00000000}, {0x001f300f, 0x0000000d},
+  {0x00800410, 0x00000000}, {0x001f0000, 0x00010000}, {0x001f0000, 0x00100000},
+  {0x40800c00, 0x40000400}, {0x40002000, 0x40000000}, {0x001f3800, 0x00000000},
+  {0x40c00000, 0x40800000}, {0x40c00000, 0x40000000}, {0x00000fc0, 0x00000000},
+  {0x0000001f, 0x0000001f}, {0x00070000, 0x00030000}, {0x0007309f, 0x0000001f},
+  {0x00073ee0, 0x00033060}, {0x00000003, 0x00000000}, {0x00000003, 0x00000003},
+  {0x000003e3, 0x000003e3}, {0x000003e3, 0x000003e0}, {0x001f3000, 0x001f0000},
+  {0x000003e1, 0x000003e0}, {0x005f3000, 0x001f0000}, {0x00df3800, 0x001f0800},
+  {0x000003e0, 0x000003e0}, {0x001e0000, 0x00000000}, {0x001f33e0, 0x000103e0},
+  {0x40003c00, 0x00000000}, {0x40c00000, 0x00400000}, {0x001f0000, 0x001f0000},
+  {0x00403000, 0x00000000}, {0x005f3000, 0x001f1000}, {0x00003010, 0x00000000},
+  {0x00800010, 0x00000000},
+};
+// clang-format on
+
+}  // namespace aarch64
+}  // namespace vixl
+
+#endif  // VIXL_AARCH64_DECODER_TABLES_AARCH64_H_
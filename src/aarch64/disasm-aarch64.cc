@@ -24,9 +24,11 @@
 // OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
 // OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
-#include <bitset>
 #include <cstdlib>
 #include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
 
 #include "disasm-aarch64.h"
 
@@ -742,6 +744,12 @@ Disassembler::Disassembler() {
   code_address_offset_ = 0;
 }
 
+const Disassembler::FormToVisitorFnTable *
+Disassembler::GetFormToVisitorFnTable() {
+  static const FormToVisitorFnTable form_to_visitor(*GetFormToVisitorFnMap());
+  return &form_to_visitor;
+}
+
 Disassembler::Disassembler(char *text_buffer, int buffer_size) {
   buffer_size_ = buffer_size;
   buffer_ = text_buffer;
@@ -763,7 +771,7 @@ void Disassembler::VisitAddSubImmediate(const Instruction *instr) {
   bool stack_op =
       (rd_is_zr || RnIsZROrSP(instr)) && (instr->GetImmAddSub() == 0) ? true
                                                                       : false;
-  const char *mnemonic = mnemonic_.c_str();
+  const char *mnemonic = mnemonic_;
   const char *form = "'Rds, 'Rns, 'IAddSub";
   const char *form_cmp = "'Rns, 'IAddSub";
   const char *form_mov = "'Rds, 'Rns";
@@ -798,7 +806,7 @@ void Disassembler::VisitAddSubImmediate(const Instruction *instr) {
 void Disassembler::VisitAddSubShifted(const Instruction *instr) {
   bool rd_is_zr = RdIsZROrSP(instr);
   bool rn_is_zr = RnIsZROrSP(instr);
-  const char *mnemonic = mnemonic_.c_str();
+  const char *mnemonic = mnemonic_;
   const char *form = "'Rd, 'Rn, 'Rm'NDP";
   const char *form_cmp = "'Rn, 'Rm'NDP";
   const char *form_neg = "'Rd, 'Rm'NDP";
@@ -1004,7 +1012,7 @@ bool Disassembler::IsMovzMovnImm(unsigned reg_size, uint64_t value) {
 void Disassembler::VisitLogicalShifted(const Instruction *instr) {
   bool rd_is_zr = RdIsZROrSP(instr);
   bool rn_is_zr = RnIsZROrSP(instr);
-  const char *mnemonic = mnemonic_.c_str();
+  const char *mnemonic = mnemonic_;
   const char *form = "'Rd, 'Rn, 'Rm'NLo";
 
   switch (form_hash_) {
@@ -1304,7 +1312,8 @@ void Disassembler::VisitDataProcessing1Source(const Instruction *instr) {
 
 
 void Disassembler::VisitDataProcessing2Source(const Instruction *instr) {
-  std::string mnemonic = mnemonic_;
+  char mnemonic[kMaxMnemonicLength + 1];
+  strcpy(mnemonic, mnemonic_);
   const char *form = "'Rd, 'Rn, 'Rm";
 
   switch (form_hash_) {
@@ -1318,7 +1327,7 @@ void Disassembler::VisitDataProcessing2Source(const Instruction *instr) {
     case "rorv_64_dp_2src"_h:
       // Drop the last 'v' character.
       VIXL_ASSERT(mnemonic[3] == 'v');
-      mnemonic.pop_back();
+      mnemonic[3] = '\0';
       break;
     case "pacga_64p_dp_2src"_h:
       form = "'Xd, 'Xn, 'Xms";
@@ -1328,7 +1337,7 @@ void Disassembler::VisitDataProcessing2Source(const Instruction *instr) {
       form = "'Wd, 'Wn, 'Xm";
       break;
   }
-  Format(instr, mnemonic.c_str(), form);
+  Format(instr, mnemonic, form);
 }
 
 
@@ -1542,7 +1551,7 @@ void Disassembler::VisitLoadStoreUnsignedOffset(const Instruction *instr) {
 
 
 void Disassembler::VisitLoadStoreRCpcUnscaledOffset(const Instruction *instr) {
-  const char *mnemonic = mnemonic_.c_str();
+  const char *mnemonic = mnemonic_;
   const char *form = "'Wt, ['Xns'ILS]";
   const char *form_x = "'Xt, ['Xns'ILS]";
 
@@ -1826,7 +1835,8 @@ void Disassembler::VisitAtomicMemory(const Instruction *instr) {
   const char *form = is_x ? "'Xs, 'Xt" : "'Ws, 'Wt";
   const char *suffix = ", ['Xns]";
 
-  std::string mnemonic = mnemonic_;
+  char mnemonic[kMaxMnemonicLength + 1];
+  strcpy(mnemonic, mnemonic_);
 
   switch (form_hash_) {
     case "ldaprb_32l_memop"_h:
@@ -1840,11 +1850,12 @@ void Disassembler::VisitAtomicMemory(const Instruction *instr) {
     default:
       // Zero register implies a store instruction.
       if (instr->GetRt() == kZeroRegCode) {
-        mnemonic.replace(0, 2, "st");
+        mnemonic[0] = 's';
+        mnemonic[1] = 't';
         form = is_x ? "'Xs" : "'Ws";
       }
   }
-  Format(instr, mnemonic.c_str(), form, suffix);
+  Format(instr, mnemonic, form, suffix);
 }
 
 
@@ -1980,11 +1991,11 @@ void Disassembler::VisitFPFixedPointConvert(const Instruction *instr) {
 }
 
 void Disassembler::DisassembleNoArgs(const Instruction *instr) {
-  Format(instr, mnemonic_.c_str(), "");
+  Format(instr, mnemonic_, "");
 }
 
 void Disassembler::VisitSystem(const Instruction *instr) {
-  const char *mnemonic = mnemonic_.c_str();
+  const char *mnemonic = mnemonic_;
   const char *form = "(System)";
   const char *suffix = NULL;
 
@@ -2130,7 +2141,7 @@ void Disassembler::VisitCryptoAES(const Instruction *instr) {
 }
 
 void Disassembler::DisassembleNEON2RegAddlp(const Instruction *instr) {
-  const char *mnemonic = mnemonic_.c_str();
+  const char *mnemonic = mnemonic_;
   const char *form = "'Vd.%s, 'Vn.%s";
 
   static const NEONFormatMap map_lp_ta =
@@ -2141,21 +2152,21 @@ void Disassembler::DisassembleNEON2RegAddlp(const Instruction *instr) {
 }
 
 void Disassembler::DisassembleNEON2RegCompare(const Instruction *instr) {
-  const char *mnemonic = mnemonic_.c_str();
+  const char *mnemonic = mnemonic_;
   const char *form = "'Vd.%s, 'Vn.%s, #0";
   NEONFormatDecoder nfd(instr);
   Format(instr, mnemonic, nfd.Substitute(form));
 }
 
 void Disassembler::DisassembleNEON2RegFPCompare(const Instruction *instr) {
-  const char *mnemonic = mnemonic_.c_str();
+  const char *mnemonic = mnemonic_;
   const char *form = "'Vd.%s, 'Vn.%s, #0.0";
   NEONFormatDecoder nfd(instr, NEONFormatDecoder::FPFormatMap());
   Format(instr, mnemonic, nfd.Substitute(form));
 }
 
 void Disassembler::DisassembleNEON2RegFPConvert(const Instruction *instr) {
-  const char *mnemonic = mnemonic_.c_str();
+  const char *mnemonic = mnemonic_;
   const char *form = "'Vd.%s, 'Vn.%s";
   static const NEONFormatMap map_cvt_ta = {{22}, {NF_4S, NF_2D}};
 
@@ -2178,14 +2189,14 @@ void Disassembler::DisassembleNEON2RegFPConvert(const Instruction *instr) {
 }
 
 void Disassembler::DisassembleNEON2RegFP(const Instruction *instr) {
-  const char *mnemonic = mnemonic_.c_str();
+  const char *mnemonic = mnemonic_;
   const char *form = "'Vd.%s, 'Vn.%s";
   NEONFormatDecoder nfd(instr, NEONFormatDecoder::FPFormatMap());
   Format(instr, mnemonic, nfd.Substitute(form));
 }
 
 void Disassembler::DisassembleNEON2RegLogical(const Instruction *instr) {
-  const char *mnemonic = mnemonic_.c_str();
+  const char *mnemonic = mnemonic_;
   const char *form = "'Vd.%s, 'Vn.%s";
   NEONFormatDecoder nfd(instr, NEONFormatDecoder::LogicalFormatMap());
   if (form_hash_ == "not_asimdmisc_r"_h) {
@@ -2195,7 +2206,7 @@ void Disassembler::DisassembleNEON2RegLogical(const Instruction *instr) {
 }
 
 void Disassembler::DisassembleNEON2RegExtract(const Instruction *instr) {
-  const char *mnemonic = mnemonic_.c_str();
+  const char *mnemonic = mnemonic_;
   const char *form = "'Vd.%s, 'Vn.%s";
   const char *suffix = NULL;
   NEONFormatDecoder nfd(instr,
@@ -2220,7 +2231,7 @@ void Disassembler::DisassembleNEON2RegExtract(const Instruction *instr) {
 }
 
 void Disassembler::VisitNEON2RegMisc(const Instruction *instr) {
-  const char *mnemonic = mnemonic_.c_str();
+  const char *mnemonic = mnemonic_;
   const char *form = "'Vd.%s, 'Vn.%s";
   NEONFormatDecoder nfd(instr);
 
@@ -2260,7 +2271,7 @@ void Disassembler::VisitNEON2RegMisc(const Instruction *instr) {
 }
 
 void Disassembler::VisitNEON2RegMiscFP16(const Instruction *instr) {
-  const char *mnemonic = mnemonic_.c_str();
+  const char *mnemonic = mnemonic_;
   const char *form = "'Vd.'?30:84h, 'Vn.'?30:84h";
   const char *suffix = NULL;
 
@@ -2276,7 +2287,7 @@ void Disassembler::VisitNEON2RegMiscFP16(const Instruction *instr) {
 }
 
 void Disassembler::DisassembleNEON3SameLogical(const Instruction *instr) {
-  const char *mnemonic = mnemonic_.c_str();
+  const char *mnemonic = mnemonic_;
   const char *form = "'Vd.%s, 'Vn.%s, 'Vm.%s";
   NEONFormatDecoder nfd(instr, NEONFormatDecoder::LogicalFormatMap());
 
@@ -2300,7 +2311,7 @@ void Disassembler::DisassembleNEON3SameFHM(const Instruction *instr) {
 }
 
 void Disassembler::DisassembleNEON3SameNoD(const Instruction *instr) {
-  const char *mnemonic = mnemonic_.c_str();
+  const char *mnemonic = mnemonic_;
   const char *form = "'Vd.%s, 'Vn.%s, 'Vm.%s";
   static const NEONFormatMap map =
       {{23, 22, 30},
@@ -2310,7 +2321,7 @@ void Disassembler::DisassembleNEON3SameNoD(const Instruction *instr) {
 }
 
 void Disassembler::VisitNEON3Same(const Instruction *instr) {
-  const char *mnemonic = mnemonic_.c_str();
+  const char *mnemonic = mnemonic_;
   const char *form = "'Vd.%s, 'Vn.%s, 'Vm.%s";
   NEONFormatDecoder nfd(instr);
 
@@ -2334,7 +2345,7 @@ void Disassembler::VisitNEON3Same(const Instruction *instr) {
 }
 
 void Disassembler::VisitNEON3SameFP16(const Instruction *instr) {
-  const char *mnemonic = mnemonic_.c_str();
+  const char *mnemonic = mnemonic_;
   const char *form = "'Vd.%s, 'Vn.%s, 'Vm.%s";
   NEONFormatDecoder nfd(instr);
   nfd.SetFormatMaps(nfd.FP16FormatMap());
@@ -2344,7 +2355,7 @@ void Disassembler::VisitNEON3SameFP16(const Instruction *instr) {
 void Disassembler::VisitNEON3SameExtra(const Instruction *instr) {
   static const NEONFormatMap map_usdot = {{30}, {NF_8B, NF_16B}};
 
-  const char *mnemonic = mnemonic_.c_str();
+  const char *mnemonic = mnemonic_;
   const char *form = "'Vd.%s, 'Vn.%s, 'Vm.%s";
   const char *suffix = NULL;
 
@@ -2374,7 +2385,7 @@ void Disassembler::VisitNEON3SameExtra(const Instruction *instr) {
 
 
 void Disassembler::VisitNEON3Different(const Instruction *instr) {
-  const char *mnemonic = mnemonic_.c_str();
+  const char *mnemonic = mnemonic_;
   const char *form = "'Vd.%s, 'Vn.%s, 'Vm.%s";
 
   NEONFormatDecoder nfd(instr);
@@ -2411,7 +2422,7 @@ void Disassembler::VisitNEON3Different(const Instruction *instr) {
 }
 
 void Disassembler::DisassembleNEONFPAcrossLanes(const Instruction *instr) {
-  const char *mnemonic = mnemonic_.c_str();
+  const char *mnemonic = mnemonic_;
   const char *form = "'Sd, 'Vn.4s";
   if ((instr->GetNEONQ() == 0) || (instr->ExtractBit(22) == 1)) {
     mnemonic = NULL;
@@ -2424,7 +2435,7 @@ void Disassembler::DisassembleNEONFP16AcrossLanes(const Instruction *instr) {
 }
 
 void Disassembler::VisitNEONAcrossLanes(const Instruction *instr) {
-  const char *mnemonic = mnemonic_.c_str();
+  const char *mnemonic = mnemonic_;
   const char *form = "%sd, 'Vn.%s";
 
   NEONFormatDecoder nfd(instr,
@@ -2457,7 +2468,7 @@ void Disassembler::VisitNEONByIndexedElement(const Instruction *instr) {
   static const NEONFormatMap map_s = {{23, 22},
                                       {NF_UNDEF, NF_H, NF_S, NF_UNDEF}};
   NEONFormatDecoder nfd(instr, &map_v, &map_v, &map_s);
-  Format(instr, mnemonic_.c_str(), nfd.Substitute(form));
+  Format(instr, mnemonic_, nfd.Substitute(form));
 }
 
 void Disassembler::DisassembleNEONMulByElementLong(const Instruction *instr) {
@@ -2468,13 +2479,13 @@ void Disassembler::DisassembleNEONMulByElementLong(const Instruction *instr) {
                         &map_ta,
                         NEONFormatDecoder::IntegerFormatMap(),
                         NEONFormatDecoder::ScalarFormatMap());
-  Format(instr, nfd.Mnemonic(mnemonic_.c_str()), nfd.Substitute(form));
+  Format(instr, nfd.Mnemonic(mnemonic_), nfd.Substitute(form));
 }
 
 void Disassembler::DisassembleNEONDotProdByElement(const Instruction *instr) {
   const char *form = instr->ExtractBit(30) ? "'Vd.4s, 'Vn.16" : "'Vd.2s, 'Vn.8";
   const char *suffix = "b, 'Vm.4b['u1111:2121]";
-  Format(instr, mnemonic_.c_str(), form, suffix);
+  Format(instr, mnemonic_, form, suffix);
 }
 
 void Disassembler::DisassembleNEONFPMulByElement(const Instruction *instr) {
@@ -2483,7 +2494,7 @@ void Disassembler::DisassembleNEONFPMulByElement(const Instruction *instr) {
                         NEONFormatDecoder::FPFormatMap(),
                         NEONFormatDecoder::FPFormatMap(),
                         NEONFormatDecoder::FPScalarFormatMap());
-  Format(instr, mnemonic_.c_str(), nfd.Substitute(form));
+  Format(instr, mnemonic_, nfd.Substitute(form));
 }
 
 void Disassembler::DisassembleNEONHalfFPMulByElement(const Instruction *instr) {
@@ -2509,11 +2520,11 @@ void Disassembler::DisassembleNEONComplexMulByElement(
                         &map_cn,
                         &map_cn,
                         NEONFormatDecoder::ScalarFormatMap());
-  Format(instr, mnemonic_.c_str(), nfd.Substitute(form));
+  Format(instr, mnemonic_, nfd.Substitute(form));
 }
 
 void Disassembler::VisitNEONCopy(const Instruction *instr) {
-  const char *mnemonic = mnemonic_.c_str();
+  const char *mnemonic = mnemonic_;
   const char *form = "(NEONCopy)";
 
   NEONFormatDecoder nfd(instr,
@@ -2573,7 +2584,7 @@ void Disassembler::VisitNEONCopy(const Instruction *instr) {
 
 
 void Disassembler::VisitNEONExtract(const Instruction *instr) {
-  const char *mnemonic = mnemonic_.c_str();
+  const char *mnemonic = mnemonic_;
   const char *form = "'Vd.%s, 'Vn.%s, 'Vm.%s, 'IVExtract";
   NEONFormatDecoder nfd(instr, NEONFormatDecoder::LogicalFormatMap());
   if ((instr->GetImmNEONExt() > 7) && (instr->GetNEONQ() == 0)) {
@@ -3106,7 +3117,7 @@ void Disassembler::VisitNEONLoadStoreSingleStructPostIndex(
 
 
 void Disassembler::VisitNEONModifiedImmediate(const Instruction *instr) {
-  const char *mnemonic = mnemonic_.c_str();
+  const char *mnemonic = mnemonic_;
   const char *form = "'Vt.%s, 'IVMIImm8, lsl 'IVMIShiftAmt1";
 
   static const NEONFormatMap map_h = {{30}, {NF_4H, NF_8H}};
@@ -3157,7 +3168,7 @@ void Disassembler::VisitNEONModifiedImmediate(const Instruction *instr) {
 
 void Disassembler::DisassembleNEONScalar2RegMiscOnlyD(
     const Instruction *instr) {
-  const char *mnemonic = mnemonic_.c_str();
+  const char *mnemonic = mnemonic_;
   const char *form = "'Dd, 'Dn";
   const char *suffix = ", #0";
   if (instr->GetNEONSize() != 3) {
@@ -3172,7 +3183,7 @@ void Disassembler::DisassembleNEONScalar2RegMiscOnlyD(
 }
 
 void Disassembler::DisassembleNEONFPScalar2RegMisc(const Instruction *instr) {
-  const char *mnemonic = mnemonic_.c_str();
+  const char *mnemonic = mnemonic_;
   const char *form = "%sd, %sn";
   const char *suffix = NULL;
   NEONFormatDecoder nfd(instr, NEONFormatDecoder::FPScalarFormatMap());
@@ -3194,7 +3205,7 @@ void Disassembler::DisassembleNEONFPScalar2RegMisc(const Instruction *instr) {
 }
 
 void Disassembler::VisitNEONScalar2RegMisc(const Instruction *instr) {
-  const char *mnemonic = mnemonic_.c_str();
+  const char *mnemonic = mnemonic_;
   const char *form = "%sd, %sn";
   NEONFormatDecoder nfd(instr, NEONFormatDecoder::ScalarFormatMap());
   switch (form_hash_) {
@@ -3207,7 +3218,7 @@ void Disassembler::VisitNEONScalar2RegMisc(const Instruction *instr) {
 }
 
 void Disassembler::VisitNEONScalar2RegMiscFP16(const Instruction *instr) {
-  const char *mnemonic = mnemonic_.c_str();
+  const char *mnemonic = mnemonic_;
   const char *form = "'Hd, 'Hn";
   const char *suffix = NULL;
 
@@ -3224,7 +3235,7 @@ void Disassembler::VisitNEONScalar2RegMiscFP16(const Instruction *instr) {
 
 
 void Disassembler::VisitNEONScalar3Diff(const Instruction *instr) {
-  const char *mnemonic = mnemonic_.c_str();
+  const char *mnemonic = mnemonic_;
   const char *form = "%sd, %sn, %sm";
   NEONFormatDecoder nfd(instr,
                         NEONFormatDecoder::LongScalarFormatMap(),
@@ -3236,14 +3247,14 @@ void Disassembler::VisitNEONScalar3Diff(const Instruction *instr) {
 }
 
 void Disassembler::DisassembleNEONFPScalar3Same(const Instruction *instr) {
-  const char *mnemonic = mnemonic_.c_str();
+  const char *mnemonic = mnemonic_;
   const char *form = "%sd, %sn, %sm";
   NEONFormatDecoder nfd(instr, NEONFormatDecoder::FPScalarFormatMap());
   Format(instr, mnemonic, nfd.SubstitutePlaceholders(form));
 }
 
 void Disassembler::DisassembleNEONScalar3SameOnlyD(const Instruction *instr) {
-  const char *mnemonic = mnemonic_.c_str();
+  const char *mnemonic = mnemonic_;
   const char *form = "'Dd, 'Dn, 'Dm";
   if (instr->GetNEONSize() != 3) {
     mnemonic = NULL;
@@ -3252,7 +3263,7 @@ void Disassembler::DisassembleNEONScalar3SameOnlyD(const Instruction *instr) {
 }
 
 void Disassembler::VisitNEONScalar3Same(const Instruction *instr) {
-  const char *mnemonic = mnemonic_.c_str();
+  const char *mnemonic = mnemonic_;
   const char *form = "%sd, %sn, %sm";
   NEONFormatDecoder nfd(instr, NEONFormatDecoder::ScalarFormatMap());
   VectorFormat vform = nfd.GetVectorFormat(0);
@@ -3286,7 +3297,7 @@ void Disassembler::VisitNEONScalar3SameExtra(const Instruction *instr) {
 
 void Disassembler::DisassembleNEONScalarSatMulLongIndex(
     const Instruction *instr) {
-  const char *mnemonic = mnemonic_.c_str();
+  const char *mnemonic = mnemonic_;
   const char *form = "%sd, %sn, 'Vf.%s['IVByElemIndex]";
   NEONFormatDecoder nfd(instr,
                         NEONFormatDecoder::LongScalarFormatMap(),
@@ -3300,7 +3311,7 @@ void Disassembler::DisassembleNEONScalarSatMulLongIndex(
 }
 
 void Disassembler::DisassembleNEONFPScalarMulIndex(const Instruction *instr) {
-  const char *mnemonic = mnemonic_.c_str();
+  const char *mnemonic = mnemonic_;
   const char *form = "%sd, %sn, 'Vf.%s['IVByElemIndex]";
   static const NEONFormatMap map = {{23, 22}, {NF_H, NF_UNDEF, NF_S, NF_D}};
   NEONFormatDecoder nfd(instr, &map);
@@ -3310,7 +3321,7 @@ void Disassembler::DisassembleNEONFPScalarMulIndex(const Instruction *instr) {
 }
 
 void Disassembler::VisitNEONScalarByIndexedElement(const Instruction *instr) {
-  const char *mnemonic = mnemonic_.c_str();
+  const char *mnemonic = mnemonic_;
   const char *form = "%sd, %sn, 'Vf.%s['IVByElemIndex]";
   NEONFormatDecoder nfd(instr, NEONFormatDecoder::ScalarFormatMap());
   VectorFormat vform_dst = nfd.GetVectorFormat(0);
@@ -3339,7 +3350,7 @@ void Disassembler::VisitNEONScalarCopy(const Instruction *instr) {
 
 
 void Disassembler::VisitNEONScalarPairwise(const Instruction *instr) {
-  const char *mnemonic = mnemonic_.c_str();
+  const char *mnemonic = mnemonic_;
   if (form_hash_ == "addp_asisdpair_only"_h) {
     // All pairwise operations except ADDP use bit U to differentiate FP16
     // from FP32/FP64 variations.
@@ -3362,7 +3373,7 @@ void Disassembler::VisitNEONScalarPairwise(const Instruction *instr) {
 
 void Disassembler::DisassembleNEONScalarShiftImmOnlyD(
     const Instruction *instr) {
-  const char *mnemonic = mnemonic_.c_str();
+  const char *mnemonic = mnemonic_;
   const char *form = "'Dd, 'Dn, ";
   const char *suffix = "'IsR";
 
@@ -3382,7 +3393,7 @@ void Disassembler::DisassembleNEONScalarShiftImmOnlyD(
 
 void Disassembler::DisassembleNEONScalarShiftRightNarrowImm(
     const Instruction *instr) {
-  const char *mnemonic = mnemonic_.c_str();
+  const char *mnemonic = mnemonic_;
   const char *form = "%sd, %sn, 'IsR";
   static const NEONFormatMap map_dst =
       {{22, 21, 20, 19}, {NF_UNDEF, NF_B, NF_H, NF_H, NF_S, NF_S, NF_S, NF_S}};
@@ -3393,7 +3404,7 @@ void Disassembler::DisassembleNEONScalarShiftRightNarrowImm(
 }
 
 void Disassembler::VisitNEONScalarShiftImmediate(const Instruction *instr) {
-  const char *mnemonic = mnemonic_.c_str();
+  const char *mnemonic = mnemonic_;
   const char *form = "%sd, %sn, ";
   const char *suffix = "'IsR";
 
@@ -3420,7 +3431,7 @@ void Disassembler::VisitNEONScalarShiftImmediate(const Instruction *instr) {
 }
 
 void Disassembler::DisassembleNEONShiftLeftLongImm(const Instruction *instr) {
-  const char *mnemonic = mnemonic_.c_str();
+  const char *mnemonic = mnemonic_;
   const char *form = "'Vd.%s, 'Vn.%s";
   const char *suffix = ", 'IsL";
 
@@ -3439,7 +3450,7 @@ void Disassembler::DisassembleNEONShiftLeftLongImm(const Instruction *instr) {
 }
 
 void Disassembler::DisassembleNEONShiftRightImm(const Instruction *instr) {
-  const char *mnemonic = mnemonic_.c_str();
+  const char *mnemonic = mnemonic_;
   const char *form = "'Vd.%s, 'Vn.%s, 'IsR";
   NEONFormatDecoder nfd(instr, NEONFormatDecoder::ShiftImmFormatMap());
 
@@ -3462,7 +3473,7 @@ void Disassembler::DisassembleNEONShiftRightImm(const Instruction *instr) {
 
 void Disassembler::DisassembleNEONShiftRightNarrowImm(
     const Instruction *instr) {
-  const char *mnemonic = mnemonic_.c_str();
+  const char *mnemonic = mnemonic_;
   const char *form = "'Vd.%s, 'Vn.%s, 'IsR";
 
   NEONFormatDecoder nfd(instr,
@@ -3472,7 +3483,7 @@ void Disassembler::DisassembleNEONShiftRightNarrowImm(
 }
 
 void Disassembler::VisitNEONShiftImmediate(const Instruction *instr) {
-  const char *mnemonic = mnemonic_.c_str();
+  const char *mnemonic = mnemonic_;
   const char *form = "'Vd.%s, 'Vn.%s, 'IsL";
   NEONFormatDecoder nfd(instr, NEONFormatDecoder::ShiftImmFormatMap());
   Format(instr, mnemonic, nfd.Substitute(form));
@@ -3480,7 +3491,7 @@ void Disassembler::VisitNEONShiftImmediate(const Instruction *instr) {
 
 
 void Disassembler::VisitNEONTable(const Instruction *instr) {
-  const char *mnemonic = mnemonic_.c_str();
+  const char *mnemonic = mnemonic_;
   const char form_1v[] = "'Vd.%%s, {'Vn.16b}, 'Vm.%%s";
   const char form_2v[] = "'Vd.%%s, {'Vn.16b, v%d.16b}, 'Vm.%%s";
   const char form_3v[] = "'Vd.%%s, {'Vn.16b, v%d.16b, v%d.16b}, 'Vm.%%s";
@@ -3554,7 +3565,7 @@ void Disassembler::VisitSVE32BitGatherLoad_VectorPlusImm(
   const char *form_imm_h = "{'Zt.s}, 'Pgl/z, ['Zn.s, #'u2016*2]";
   const char *form_imm_w = "{'Zt.s}, 'Pgl/z, ['Zn.s, #'u2016*4]";
 
-  const char *mnemonic = mnemonic_.c_str();
+  const char *mnemonic = mnemonic_;
   switch (form_hash_) {
     case "ld1h_z_p_ai_s"_h:
     case "ld1sh_z_p_ai_s"_h:
@@ -3808,7 +3819,7 @@ void Disassembler::VisitSVEBitwiseLogical_Predicated(const Instruction *instr) {
 
 void Disassembler::VisitSVEBitwiseShiftByImm_Predicated(
     const Instruction *instr) {
-  const char *mnemonic = mnemonic_.c_str();
+  const char *mnemonic = mnemonic_;
   const char *form = "'Zd.'tszp, 'Pgl/m, 'Zd.'tszp, ";
   const char *suffix = NULL;
   unsigned tsize = (instr->ExtractBits(23, 22) << 2) | instr->ExtractBits(9, 8);
@@ -5076,7 +5087,7 @@ void Disassembler::VisitSVEBitwiseShiftUnpredicated(const Instruction *instr) {
     case "usra_z_zi"_h:
       if (tsize != 0) {
         // The tsz field must not be zero.
-        mnemonic = mnemonic_.c_str();
+        mnemonic = mnemonic_;
         form = form_i;
         suffix = "'ITriSves";
       }
@@ -5085,7 +5096,7 @@ void Disassembler::VisitSVEBitwiseShiftUnpredicated(const Instruction *instr) {
     case "sli_z_zzi"_h:
       if (tsize != 0) {
         // The tsz field must not be zero.
-        mnemonic = mnemonic_.c_str();
+        mnemonic = mnemonic_;
         form = form_i;
         suffix = "'ITriSver";
       }
@@ -5094,7 +5105,7 @@ void Disassembler::VisitSVEBitwiseShiftUnpredicated(const Instruction *instr) {
     case "lsl_z_zw"_h:
     case "lsr_z_zw"_h:
       if (lane_size <= kSRegSizeInBytesLog2) {
-        mnemonic = mnemonic_.c_str();
+        mnemonic = mnemonic_;
         form = "'Zd.'t, 'Zn.'t, 'Zm.d";
       }
       break;
@@ -5395,7 +5406,7 @@ void Disassembler::VisitSVEPredicateCount(const Instruction *instr) {
 }
 
 void Disassembler::VisitSVEPredicateLogical(const Instruction *instr) {
-  const char *mnemonic = mnemonic_.c_str();
+  const char *mnemonic = mnemonic_;
   const char *form = "'Pd.b, p'u1310/z, 'Pn.b, 'Pm.b";
 
   int pd = instr->GetPd();
@@ -5481,7 +5492,7 @@ void Disassembler::VisitSVEStackFrameSize(const Instruction *instr) {
 }
 
 void Disassembler::VisitSVEVectorSelect(const Instruction *instr) {
-  const char *mnemonic = mnemonic_.c_str();
+  const char *mnemonic = mnemonic_;
   const char *form = "'Zd.'t, p'u1310, 'Zn.'t, 'Zm.'t";
 
   if (instr->GetRd() == instr->GetRm()) {
@@ -5542,16 +5553,30 @@ void Disassembler::VisitUnallocated(const Instruction *instr) {
 }
 
 void Disassembler::Visit(Metadata *metadata, const Instruction *instr) {
-  VIXL_ASSERT(metadata->count("form") > 0);
-  const std::string &form = (*metadata)["form"];
-  form_hash_ = Hash(form.c_str());
-  const FormToVisitorFnMap *fv = Disassembler::GetFormToVisitorFnMap();
-  FormToVisitorFnMap::const_iterator it = fv->find(form_hash_);
-  if (it == fv->end()) {
+  form_hash_ = metadata->GetFormHash();
+  const FormToVisitorFn *fn =
+      Disassembler::GetFormToVisitorFnTable()->Get(metadata->GetFormId());
+  if (fn == NULL) {
     VisitUnimplemented(instr);
   } else {
-    SetMnemonicFromForm(form);
-    (it->second)(this, instr);
+    SetMnemonicFromForm(metadata->GetFormName());
+    (*fn)(this, instr);
+  }
+}
+
+void Disassembler::VisitBatch(const DecodedInstruction *batch, size_t count) {
+  const FormToVisitorFnTable *table = Disassembler::GetFormToVisitorFnTable();
+  for (size_t i = 0; i < count; i++) {
+    FormId form_id = batch[i].form_id;
+    const Instruction *instr = batch[i].instr;
+    form_hash_ = Decoder::GetFormHash(form_id);
+    const FormToVisitorFn *fn = table->Get(form_id);
+    if (fn == NULL) {
+      VisitUnimplemented(instr);
+    } else {
+      SetMnemonicFromForm(Decoder::GetFormName(form_id));
+      (*fn)(this, instr);
+    }
   }
 }
 
@@ -5562,19 +5587,19 @@ void Disassembler::Disassemble_PdT_PgZ_ZnT_ZmT(const Instruction *instr) {
   if ((vform == kFormatVnS) || (vform == kFormatVnD)) {
     Format(instr, "unimplemented", "(PdT_PgZ_ZnT_ZmT)");
   } else {
-    Format(instr, mnemonic_.c_str(), form);
+    Format(instr, mnemonic_, form);
   }
 }
 
 void Disassembler::Disassemble_ZdB_Zn1B_Zn2B_imm(const Instruction *instr) {
   const char *form = "'Zd.b, {'Zn.b, 'Zn2.b}, #'u2016:1210";
-  Format(instr, mnemonic_.c_str(), form);
+  Format(instr, mnemonic_, form);
 }
 
 void Disassembler::Disassemble_ZdB_ZnB_ZmB(const Instruction *instr) {
   const char *form = "'Zd.b, 'Zn.b, 'Zm.b";
   if (instr->GetSVEVectorFormat() == kFormatVnB) {
-    Format(instr, mnemonic_.c_str(), form);
+    Format(instr, mnemonic_, form);
   } else {
     Format(instr, "unimplemented", "(ZdB_ZnB_ZmB)");
   }
@@ -5582,48 +5607,48 @@ void Disassembler::Disassemble_ZdB_ZnB_ZmB(const Instruction *instr) {
 
 void Disassembler::Disassemble_ZdD_PgM_ZnS(const Instruction *instr) {
   const char *form = "'Zd.d, 'Pgl/m, 'Zn.s";
-  Format(instr, mnemonic_.c_str(), form);
+  Format(instr, mnemonic_, form);
 }
 
 void Disassembler::Disassemble_ZdD_ZnD_ZmD(const Instruction *instr) {
   const char *form = "'Zd.d, 'Zn.d, 'Zm.d";
-  Format(instr, mnemonic_.c_str(), form);
+  Format(instr, mnemonic_, form);
 }
 
 void Disassembler::Disassemble_ZdD_ZnD_ZmD_imm(const Instruction *instr) {
   const char *form = "'Zd.d, 'Zn.d, z'u1916.d['u2020]";
-  Format(instr, mnemonic_.c_str(), form);
+  Format(instr, mnemonic_, form);
 }
 
 void Disassembler::Disassemble_ZdD_ZnS_ZmS_imm(const Instruction *instr) {
   const char *form = "'Zd.d, 'Zn.s, z'u1916.s['u2020:1111]";
-  Format(instr, mnemonic_.c_str(), form);
+  Format(instr, mnemonic_, form);
 }
 
 void Disassembler::Disassemble_ZdH_PgM_ZnS(const Instruction *instr) {
   const char *form = "'Zd.h, 'Pgl/m, 'Zn.s";
-  Format(instr, mnemonic_.c_str(), form);
+  Format(instr, mnemonic_, form);
 }
 
 void Disassembler::Disassemble_ZdH_ZnH_ZmH_imm(const Instruction *instr) {
   const char *form = "'Zd.h, 'Zn.h, z'u1816.h['u2222:2019]";
-  Format(instr, mnemonic_.c_str(), form);
+  Format(instr, mnemonic_, form);
 }
 
 void Disassembler::Disassemble_ZdS_PgM_ZnD(const Instruction *instr) {
   const char *form = "'Zd.s, 'Pgl/m, 'Zn.d";
-  Format(instr, mnemonic_.c_str(), form);
+  Format(instr, mnemonic_, form);
 }
 
 void Disassembler::Disassemble_ZdS_PgM_ZnH(const Instruction *instr) {
   const char *form = "'Zd.s, 'Pgl/m, 'Zn.h";
-  Format(instr, mnemonic_.c_str(), form);
+  Format(instr, mnemonic_, form);
 }
 
 void Disassembler::Disassemble_ZdS_PgM_ZnS(const Instruction *instr) {
   const char *form = "'Zd.s, 'Pgl/m, 'Zn.s";
   if (instr->GetSVEVectorFormat() == kFormatVnS) {
-    Format(instr, mnemonic_.c_str(), form);
+    Format(instr, mnemonic_, form);
   } else {
     Format(instr, "unimplemented", "(ZdS_PgM_ZnS)");
   }
@@ -5631,17 +5656,17 @@ void Disassembler::Disassemble_ZdS_PgM_ZnS(const Instruction *instr) {
 
 void Disassembler::Disassemble_ZdS_ZnH_ZmH_imm(const Instruction *instr) {
   const char *form = "'Zd.s, 'Zn.h, z'u1816.h['u2019:1111]";
-  Format(instr, mnemonic_.c_str(), form);
+  Format(instr, mnemonic_, form);
 }
 
 void Disassembler::Disassemble_ZdS_ZnS_ZmS(const Instruction *instr) {
   const char *form = "'Zd.s, 'Zn.s, 'Zm.s";
-  Format(instr, mnemonic_.c_str(), form);
+  Format(instr, mnemonic_, form);
 }
 
 void Disassembler::Disassemble_ZdS_ZnS_ZmS_imm(const Instruction *instr) {
   const char *form = "'Zd.s, 'Zn.s, z'u1816.s['u2019]";
-  Format(instr, mnemonic_.c_str(), form);
+  Format(instr, mnemonic_, form);
 }
 
 void Disassembler::DisassembleSVEFlogb(const Instruction *instr) {
@@ -5649,20 +5674,20 @@ void Disassembler::DisassembleSVEFlogb(const Instruction *instr) {
   if (instr->GetSVEVectorFormat(17) == kFormatVnB) {
     Format(instr, "unimplemented", "(SVEFlogb)");
   } else {
-    Format(instr, mnemonic_.c_str(), form);
+    Format(instr, mnemonic_, form);
   }
 }
 
 void Disassembler::Disassemble_ZdT_PgM_ZnT(const Instruction *instr) {
   const char *form = "'Zd.'t, 'Pgl/m, 'Zn.'t";
-  Format(instr, mnemonic_.c_str(), form);
+  Format(instr, mnemonic_, form);
 }
 
 void Disassembler::Disassemble_ZdT_PgZ_ZnT_ZmT(const Instruction *instr) {
   const char *form = "'Zd.'t, 'Pgl/z, 'Zn.'t, 'Zm.'t";
   VectorFormat vform = instr->GetSVEVectorFormat();
   if ((vform == kFormatVnS) || (vform == kFormatVnD)) {
-    Format(instr, mnemonic_.c_str(), form);
+    Format(instr, mnemonic_, form);
   } else {
     Format(instr, "unimplemented", "(ZdT_PgZ_ZnT_ZmT)");
   }
@@ -5670,17 +5695,17 @@ void Disassembler::Disassemble_ZdT_PgZ_ZnT_ZmT(const Instruction *instr) {
 
 void Disassembler::Disassemble_ZdT_Pg_Zn1T_Zn2T(const Instruction *instr) {
   const char *form = "'Zd.'t, 'Pgl, {'Zn.'t, 'Zn2.'t}";
-  Format(instr, mnemonic_.c_str(), form);
+  Format(instr, mnemonic_, form);
 }
 
 void Disassembler::Disassemble_ZdT_Zn1T_Zn2T_ZmT(const Instruction *instr) {
   const char *form = "'Zd.'t, {'Zn.'t, 'Zn2.'t}, 'Zm.'t";
-  Format(instr, mnemonic_.c_str(), form);
+  Format(instr, mnemonic_, form);
 }
 
 void Disassembler::Disassemble_ZdT_ZnT_ZmT(const Instruction *instr) {
   const char *form = "'Zd.'t, 'Zn.'t, 'Zm.'t";
-  Format(instr, mnemonic_.c_str(), form);
+  Format(instr, mnemonic_, form);
 }
 
 void Disassembler::Disassemble_ZdT_ZnT_ZmTb(const Instruction *instr) {
@@ -5688,7 +5713,7 @@ void Disassembler::Disassemble_ZdT_ZnT_ZmTb(const Instruction *instr) {
   if (instr->GetSVEVectorFormat() == kFormatVnB) {
     Format(instr, "unimplemented", "(ZdT_ZnT_ZmTb)");
   } else {
-    Format(instr, mnemonic_.c_str(), form);
+    Format(instr, mnemonic_, form);
   }
 }
 
@@ -5704,7 +5729,7 @@ void Disassembler::Disassemble_ZdT_ZnTb(const Instruction *instr) {
   if ((lane_size >= static_cast<int>(kBRegSizeInBytesLog2)) &&
       (lane_size <= static_cast<int>(kSRegSizeInBytesLog2)) &&
       (shift_dist == 0)) {
-    Format(instr, mnemonic_.c_str(), form);
+    Format(instr, mnemonic_, form);
   } else {
     Format(instr, "unimplemented", "(ZdT_ZnTb)");
   }
@@ -5718,7 +5743,7 @@ void Disassembler::Disassemble_ZdT_ZnTb_ZmTb(const Instruction *instr) {
     // supported, but may need changes for other instructions reaching here.
     Format(instr, "unimplemented", "(ZdT_ZnTb_ZmTb)");
   } else {
-    Format(instr, mnemonic_.c_str(), form);
+    Format(instr, mnemonic_, form);
   }
 }
 
@@ -5727,7 +5752,7 @@ void Disassembler::DisassembleSVEAddSubHigh(const Instruction *instr) {
   if (instr->GetSVEVectorFormat() == kFormatVnB) {
     Format(instr, "unimplemented", "(SVEAddSubHigh)");
   } else {
-    Format(instr, mnemonic_.c_str(), form);
+    Format(instr, mnemonic_, form);
   }
 }
 
@@ -5738,7 +5763,7 @@ void Disassembler::DisassembleSVEShiftLeftImm(const Instruction *instr) {
   int lane_size = shift_and_lane_size.second;
   if ((lane_size >= static_cast<int>(kBRegSizeInBytesLog2)) &&
       (lane_size <= static_cast<int>(kSRegSizeInBytesLog2))) {
-    Format(instr, mnemonic_.c_str(), form);
+    Format(instr, mnemonic_, form);
   } else {
     Format(instr, "unimplemented", "(SVEShiftLeftImm)");
   }
@@ -5751,7 +5776,7 @@ void Disassembler::DisassembleSVEShiftRightImm(const Instruction *instr) {
   int lane_size = shift_and_lane_size.second;
   if ((lane_size >= static_cast<int>(kBRegSizeInBytesLog2)) &&
       (lane_size <= static_cast<int>(kSRegSizeInBytesLog2))) {
-    Format(instr, mnemonic_.c_str(), form);
+    Format(instr, mnemonic_, form);
   } else {
     Format(instr, "unimplemented", "(SVEShiftRightImm)");
   }
@@ -5759,61 +5784,61 @@ void Disassembler::DisassembleSVEShiftRightImm(const Instruction *instr) {
 
 void Disassembler::Disassemble_ZdaD_ZnD_ZmD_imm(const Instruction *instr) {
   const char *form = "'Zd.d, 'Zn.d, z'u1916.d['u2020]";
-  Format(instr, mnemonic_.c_str(), form);
+  Format(instr, mnemonic_, form);
 }
 
 void Disassembler::Disassemble_ZdaD_ZnH_ZmH_imm_const(
     const Instruction *instr) {
   const char *form = "'Zd.d, 'Zn.h, z'u1916.h['u2020], #'u1110*90";
-  Format(instr, mnemonic_.c_str(), form);
+  Format(instr, mnemonic_, form);
 }
 
 void Disassembler::Disassemble_ZdaD_ZnS_ZmS_imm(const Instruction *instr) {
   const char *form = "'Zd.d, 'Zn.s, z'u1916.s['u2020:1111]";
-  Format(instr, mnemonic_.c_str(), form);
+  Format(instr, mnemonic_, form);
 }
 
 void Disassembler::Disassemble_ZdaH_ZnH_ZmH_imm(const Instruction *instr) {
   const char *form = "'Zd.h, 'Zn.h, z'u1816.h['u2222:2019]";
-  Format(instr, mnemonic_.c_str(), form);
+  Format(instr, mnemonic_, form);
 }
 
 void Disassembler::Disassemble_ZdaH_ZnH_ZmH_imm_const(
     const Instruction *instr) {
   const char *form = "'Zd.h, 'Zn.h, z'u1816.h['u2019], #'u1110*90";
-  Format(instr, mnemonic_.c_str(), form);
+  Format(instr, mnemonic_, form);
 }
 
 void Disassembler::Disassemble_ZdaS_ZnB_ZmB(const Instruction *instr) {
   const char *form = "'Zd.s, 'Zn.b, 'Zm.b";
-  Format(instr, mnemonic_.c_str(), form);
+  Format(instr, mnemonic_, form);
 }
 
 void Disassembler::Disassemble_ZdaS_ZnB_ZmB_imm_const(
     const Instruction *instr) {
   const char *form = "'Zd.s, 'Zn.b, z'u1816.b['u2019], #'u1110*90";
-  Format(instr, mnemonic_.c_str(), form);
+  Format(instr, mnemonic_, form);
 }
 
 void Disassembler::Disassemble_ZdaS_ZnH_ZmH(const Instruction *instr) {
   const char *form = "'Zd.s, 'Zn.h, 'Zm.h";
-  Format(instr, mnemonic_.c_str(), form);
+  Format(instr, mnemonic_, form);
 }
 
 void Disassembler::Disassemble_ZdaS_ZnH_ZmH_imm(const Instruction *instr) {
   const char *form = "'Zd.s, 'Zn.h, z'u1816.h['u2019:1111]";
-  Format(instr, mnemonic_.c_str(), form);
+  Format(instr, mnemonic_, form);
 }
 
 void Disassembler::Disassemble_ZdaS_ZnS_ZmS_imm(const Instruction *instr) {
   const char *form = "'Zd.s, 'Zn.s, z'u1816.s['u2019]";
-  Format(instr, mnemonic_.c_str(), form);
+  Format(instr, mnemonic_, form);
 }
 
 void Disassembler::Disassemble_ZdaS_ZnS_ZmS_imm_const(
     const Instruction *instr) {
   const char *form = "'Zd.s, 'Zn.s, z'u1916.s['u2020], #'u1110*90";
-  Format(instr, mnemonic_.c_str(), form);
+  Format(instr, mnemonic_, form);
 }
 
 void Disassembler::Disassemble_ZdaT_PgM_ZnTb(const Instruction *instr) {
@@ -5825,22 +5850,22 @@ void Disassembler::Disassemble_ZdaT_PgM_ZnTb(const Instruction *instr) {
     return;
   }
 
-  Format(instr, mnemonic_.c_str(), form);
+  Format(instr, mnemonic_, form);
 }
 
 void Disassembler::DisassembleSVEAddSubCarry(const Instruction *instr) {
   const char *form = "'Zd.'?22:ds, 'Zn.'?22:ds, 'Zm.'?22:ds";
-  Format(instr, mnemonic_.c_str(), form);
+  Format(instr, mnemonic_, form);
 }
 
 void Disassembler::Disassemble_ZdaT_ZnT_ZmT(const Instruction *instr) {
   const char *form = "'Zd.'t, 'Zn.'t, 'Zm.'t";
-  Format(instr, mnemonic_.c_str(), form);
+  Format(instr, mnemonic_, form);
 }
 
 void Disassembler::Disassemble_ZdaT_ZnT_ZmT_const(const Instruction *instr) {
   const char *form = "'Zd.'t, 'Zn.'t, 'Zm.'t, #'u1110*90";
-  Format(instr, mnemonic_.c_str(), form);
+  Format(instr, mnemonic_, form);
 }
 
 void Disassembler::Disassemble_ZdaT_ZnTb_ZmTb(const Instruction *instr) {
@@ -5848,7 +5873,7 @@ void Disassembler::Disassemble_ZdaT_ZnTb_ZmTb(const Instruction *instr) {
   if (instr->GetSVEVectorFormat() == kFormatVnB) {
     Format(instr, "unimplemented", "(ZdaT_ZnTb_ZmTb)");
   } else {
-    Format(instr, mnemonic_.c_str(), form);
+    Format(instr, mnemonic_, form);
   }
 }
 
@@ -5859,28 +5884,28 @@ void Disassembler::Disassemble_ZdaT_ZnTb_ZmTb_const(const Instruction *instr) {
   if ((vform == kFormatVnB) || (vform == kFormatVnH)) {
     Format(instr, "unimplemented", "(ZdaT_ZnTb_ZmTb_const)");
   } else {
-    Format(instr, mnemonic_.c_str(), form);
+    Format(instr, mnemonic_, form);
   }
 }
 
 void Disassembler::Disassemble_ZdnB_ZdnB(const Instruction *instr) {
   const char *form = "'Zd.b, 'Zd.b";
-  Format(instr, mnemonic_.c_str(), form);
+  Format(instr, mnemonic_, form);
 }
 
 void Disassembler::Disassemble_ZdnB_ZdnB_ZmB(const Instruction *instr) {
   const char *form = "'Zd.b, 'Zd.b, 'Zn.b";
-  Format(instr, mnemonic_.c_str(), form);
+  Format(instr, mnemonic_, form);
 }
 
 void Disassembler::DisassembleSVEBitwiseTernary(const Instruction *instr) {
   const char *form = "'Zd.d, 'Zd.d, 'Zm.d, 'Zn.d";
-  Format(instr, mnemonic_.c_str(), form);
+  Format(instr, mnemonic_, form);
 }
 
 void Disassembler::Disassemble_ZdnS_ZdnS_ZmS(const Instruction *instr) {
   const char *form = "'Zd.s, 'Zd.s, 'Zn.s";
-  Format(instr, mnemonic_.c_str(), form);
+  Format(instr, mnemonic_, form);
 }
 
 void Disassembler::DisassembleSVEFPPair(const Instruction *instr) {
@@ -5888,19 +5913,19 @@ void Disassembler::DisassembleSVEFPPair(const Instruction *instr) {
   if (instr->GetSVEVectorFormat() == kFormatVnB) {
     Format(instr, "unimplemented", "(SVEFPPair)");
   } else {
-    Format(instr, mnemonic_.c_str(), form);
+    Format(instr, mnemonic_, form);
   }
 }
 
 void Disassembler::Disassemble_ZdnT_PgM_ZdnT_ZmT(const Instruction *instr) {
   const char *form = "'Zd.'t, 'Pgl/m, 'Zd.'t, 'Zn.'t";
-  Format(instr, mnemonic_.c_str(), form);
+  Format(instr, mnemonic_, form);
 }
 
 void Disassembler::DisassembleSVEComplexIntAddition(const Instruction *instr) {
   const char *form = "'Zd.'t, 'Zd.'t, 'Zn.'t, #";
   const char *suffix = (instr->ExtractBit(10) == 0) ? "90" : "270";
-  Format(instr, mnemonic_.c_str(), form, suffix);
+  Format(instr, mnemonic_, form, suffix);
 }
 
 void Disassembler::Disassemble_ZdnT_ZdnT_ZmT_const(const Instruction *instr) {
@@ -5911,49 +5936,49 @@ void Disassembler::Disassemble_ZdnT_ZdnT_ZmT_const(const Instruction *instr) {
   if (tsize == 0) {
     Format(instr, "unimplemented", "(ZdnT_ZdnT_ZmT_const)");
   } else {
-    Format(instr, mnemonic_.c_str(), form);
+    Format(instr, mnemonic_, form);
   }
 }
 
 void Disassembler::Disassemble_ZtD_PgZ_ZnD_Xm(const Instruction *instr) {
   const char *form = "{'Zt.d}, 'Pgl/z, ['Zn.d";
   const char *suffix = instr->GetRm() == 31 ? "]" : ", 'Xm]";
-  Format(instr, mnemonic_.c_str(), form, suffix);
+  Format(instr, mnemonic_, form, suffix);
 }
 
 void Disassembler::Disassemble_ZtD_Pg_ZnD_Xm(const Instruction *instr) {
   const char *form = "{'Zt.d}, 'Pgl, ['Zn.d";
   const char *suffix = instr->GetRm() == 31 ? "]" : ", 'Xm]";
-  Format(instr, mnemonic_.c_str(), form, suffix);
+  Format(instr, mnemonic_, form, suffix);
 }
 
 void Disassembler::Disassemble_ZtS_PgZ_ZnS_Xm(const Instruction *instr) {
   const char *form = "{'Zt.s}, 'Pgl/z, ['Zn.s";
   const char *suffix = instr->GetRm() == 31 ? "]" : ", 'Xm]";
-  Format(instr, mnemonic_.c_str(), form, suffix);
+  Format(instr, mnemonic_, form, suffix);
 }
 
 void Disassembler::Disassemble_ZtS_Pg_ZnS_Xm(const Instruction *instr) {
   const char *form = "{'Zt.s}, 'Pgl, ['Zn.s";
   const char *suffix = instr->GetRm() == 31 ? "]" : ", 'Xm]";
-  Format(instr, mnemonic_.c_str(), form, suffix);
+  Format(instr, mnemonic_, form, suffix);
 }
 
 void Disassembler::Disassemble_XdSP_XnSP_Xm(const Instruction *instr) {
   const char *form = "'Xds, 'Xns";
   const char *suffix = instr->GetRm() == 31 ? "" : ", 'Xm";
-  Format(instr, mnemonic_.c_str(), form, suffix);
+  Format(instr, mnemonic_, form, suffix);
 }
 
 void Disassembler::Disassemble_XdSP_XnSP_uimm6_uimm4(const Instruction *instr) {
   VIXL_STATIC_ASSERT(kMTETagGranuleInBytes == 16);
   const char *form = "'Xds, 'Xns, #'u2116*16, #'u1310";
-  Format(instr, mnemonic_.c_str(), form);
+  Format(instr, mnemonic_, form);
 }
 
 void Disassembler::Disassemble_Xd_XnSP_Xm(const Instruction *instr) {
   const char *form = "'Rd, 'Xns, 'Rm";
-  Format(instr, mnemonic_.c_str(), form);
+  Format(instr, mnemonic_, form);
 }
 
 void Disassembler::Disassemble_Xd_XnSP_XmSP(const Instruction *instr) {
@@ -5961,7 +5986,7 @@ void Disassembler::Disassemble_Xd_XnSP_XmSP(const Instruction *instr) {
     Format(instr, "cmpp", "'Xns, 'Xms");
   } else {
     const char *form = "'Xd, 'Xns, 'Xms";
-    Format(instr, mnemonic_.c_str(), form);
+    Format(instr, mnemonic_, form);
   }
 }
 
@@ -5979,7 +6004,7 @@ void Disassembler::DisassembleMTEStoreTagPair(const Instruction *instr) {
       suffix = ", #'s2115*16]!";
       break;
     default:
-      mnemonic_ = "unimplemented";
+      SetMnemonic("unimplemented");
       break;
   }
 
@@ -5987,7 +6012,7 @@ void Disassembler::DisassembleMTEStoreTagPair(const Instruction *instr) {
     suffix = "]";
   }
 
-  Format(instr, mnemonic_.c_str(), form, suffix);
+  Format(instr, mnemonic_, form, suffix);
 }
 
 void Disassembler::DisassembleMTEStoreTag(const Instruction *instr) {
@@ -6013,7 +6038,7 @@ void Disassembler::DisassembleMTEStoreTag(const Instruction *instr) {
       suffix = ", #'s2012*16]!";
       break;
     default:
-      mnemonic_ = "unimplemented";
+      SetMnemonic("unimplemented");
       break;
   }
 
@@ -6021,13 +6046,13 @@ void Disassembler::DisassembleMTEStoreTag(const Instruction *instr) {
     suffix = "]";
   }
 
-  Format(instr, mnemonic_.c_str(), form, suffix);
+  Format(instr, mnemonic_, form, suffix);
 }
 
 void Disassembler::DisassembleMTELoadTag(const Instruction *instr) {
   const char *form =
       (instr->GetImmLS() == 0) ? "'Xt, ['Xns]" : "'Xt, ['Xns, #'s2012*16]";
-  Format(instr, mnemonic_.c_str(), form);
+  Format(instr, mnemonic_, form);
 }
 
 void Disassembler::DisassembleCpy(const Instruction *instr) {
@@ -6047,7 +6072,7 @@ void Disassembler::DisassembleCpy(const Instruction *instr) {
     form = NULL;
   }
 
-  Format(instr, mnemonic_.c_str(), form);
+  Format(instr, mnemonic_, form);
 }
 
 void Disassembler::DisassembleSet(const Instruction *instr) {
@@ -6067,7 +6092,7 @@ void Disassembler::DisassembleSet(const Instruction *instr) {
     form = NULL;
   }
 
-  Format(instr, mnemonic_.c_str(), form);
+  Format(instr, mnemonic_, form);
 }
 
 void Disassembler::ProcessOutput(const Instruction * /*instr*/) {
@@ -6106,13 +6131,15 @@ void Disassembler::AppendRegisterNameToOutput(const Instruction *instr,
 
   if (reg.IsVRegister() || !(reg.Aliases(sp) || reg.Aliases(xzr))) {
     // A core or scalar/vector register: [wx]0 - 30, [bhsdq]0 - 31.
-    AppendToOutput("%c%d", reg_char, reg.GetCode());
+    AppendCharToOutput(reg_char);
+    AppendDecimalToOutput(reg.GetCode());
   } else if (reg.Aliases(sp)) {
     // Disassemble w31/x31 as stack pointer wsp/sp.
-    AppendToOutput("%s", reg.Is64Bits() ? "sp" : "wsp");
+    AppendStringToOutput(reg.Is64Bits() ? "sp" : "wsp");
   } else {
     // Disassemble w31/x31 as zero register wzr/xzr.
-    AppendToOutput("%czr", reg_char);
+    AppendCharToOutput(reg_char);
+    AppendStringToOutput("zr");
   }
 }
 
@@ -6123,9 +6150,11 @@ void Disassembler::AppendPCRelativeOffsetToOutput(const Instruction *instr,
   if (offset < 0) {
     // Cast to uint64_t so that INT64_MIN is handled in a well-defined way.
     uint64_t abs_offset = UnsignedNegate(static_cast<uint64_t>(offset));
-    AppendToOutput("#-0x%" PRIx64, abs_offset);
+    AppendStringToOutput("#-");
+    AppendHexToOutput(abs_offset);
   } else {
-    AppendToOutput("#+0x%" PRIx64, offset);
+    AppendStringToOutput("#+");
+    AppendHexToOutput(offset);
   }
 }
 
@@ -6133,7 +6162,9 @@ void Disassembler::AppendPCRelativeOffsetToOutput(const Instruction *instr,
 void Disassembler::AppendAddressToOutput(const Instruction *instr,
                                          const void *addr) {
   USE(instr);
-  AppendToOutput("(addr 0x%" PRIxPTR ")", reinterpret_cast<uintptr_t>(addr));
+  AppendStringToOutput("(addr ");
+  AppendHexToOutput(reinterpret_cast<uintptr_t>(addr));
+  AppendCharToOutput(')');
 }
 
 
@@ -6153,11 +6184,14 @@ void Disassembler::AppendCodeRelativeAddressToOutput(const Instruction *instr,
                                                      const void *addr) {
   USE(instr);
   int64_t rel_addr = CodeRelativeAddress(addr);
+  AppendStringToOutput("(addr ");
   if (rel_addr >= 0) {
-    AppendToOutput("(addr 0x%" PRIx64 ")", rel_addr);
+    AppendHexToOutput(rel_addr);
   } else {
-    AppendToOutput("(addr -0x%" PRIx64 ")", -rel_addr);
+    AppendCharToOutput('-');
+    AppendHexToOutput(UnsignedNegate(static_cast<uint64_t>(rel_addr)));
   }
+  AppendCharToOutput(')');
 }
 
 
@@ -6210,19 +6244,19 @@ void Disassembler::Format(const Instruction *instr,
 void Disassembler::FormatWithDecodedMnemonic(const Instruction *instr,
                                              const char *format0,
                                              const char *format1) {
-  Format(instr, mnemonic_.c_str(), format0, format1);
+  Format(instr, mnemonic_, format0, format1);
 }
 
 void Disassembler::Substitute(const Instruction *instr, const char *string) {
-  char chr = *string++;
-  while (chr != '\0') {
-    if (chr == '\'') {
+  while (*string != '\0') {
+    // Copy everything up to the next field in one go.
+    size_t length = strcspn(string, "'");
+    AppendStringToOutput(string, length);
+    string += length;
+    if (*string == '\'') {
+      string++;
       string += SubstituteField(instr, string);
-    } else {
-      VIXL_ASSERT(buffer_pos_ < buffer_size_);
-      buffer_[buffer_pos_++] = chr;
     }
-    chr = *string++;
   }
 }
 
@@ -6395,8 +6429,11 @@ int Disassembler::SubstituteRegisterField(const Instruction *instr,
       case 'z': {
         VIXL_ASSERT(reg_prefix == 'X');
         field_len = 3;
-        char *eimm;
-        int imm = static_cast<int>(strtol(&reg_field[2], &eimm, 10));
+        const char *eimm = &reg_field[2];
+        int imm = 0;
+        while ((*eimm >= '0') && (*eimm <= '9')) {
+          imm = (imm * 10) + (*eimm++ - '0');
+        }
         field_len += static_cast<unsigned>(eimm - &reg_field[2]);
         if (reg_num == 31) {
           switch (reg_field[1]) {
@@ -6410,7 +6447,8 @@ int Disassembler::SubstituteRegisterField(const Instruction *instr,
             case 'b':
               break;
           }
-          AppendToOutput("#%d", imm);
+          AppendCharToOutput('#');
+          AppendDecimalToOutput(imm);
           return field_len;
         }
         break;
@@ -6470,10 +6508,12 @@ int Disassembler::SubstituteRegisterField(const Instruction *instr,
         field_len++;
         break;
       }
-      AppendToOutput("v%d", reg_num);
+      AppendCharToOutput('v');
+      AppendDecimalToOutput(reg_num);
       return field_len;
     case 'Z':
-      AppendToOutput("z%d", reg_num);
+      AppendCharToOutput('z');
+      AppendDecimalToOutput(reg_num);
       return field_len;
     default:
       VIXL_UNREACHABLE();
@@ -6492,17 +6532,21 @@ int Disassembler::SubstitutePredicateRegisterField(const Instruction *instr,
     // position.
     case 'd':
     case 't':
-      AppendToOutput("p%u", instr->GetPt());
+      AppendCharToOutput('p');
+      AppendDecimalToOutput(instr->GetPt());
       break;
     case 'n':
-      AppendToOutput("p%u", instr->GetPn());
+      AppendCharToOutput('p');
+      AppendDecimalToOutput(instr->GetPn());
       break;
     case 'm':
-      AppendToOutput("p%u", instr->GetPm());
+      AppendCharToOutput('p');
+      AppendDecimalToOutput(instr->GetPm());
       break;
     case 'g':
       VIXL_ASSERT(format[2] == 'l');
-      AppendToOutput("p%u", instr->GetPgLow8());
+      AppendCharToOutput('p');
+      AppendDecimalToOutput(instr->GetPgLow8());
       return 3;
     default:
       VIXL_UNREACHABLE();
@@ -6517,9 +6561,11 @@ int Disassembler::SubstituteImmediateField(const Instruction *instr,
   switch (format[1]) {
     case 'M': {  // IMoveImm, IMoveNeg or IMoveLSL.
       if (format[5] == 'L') {
-        AppendToOutput("#0x%" PRIx32, instr->GetImmMoveWide());
+        AppendCharToOutput('#');
+        AppendHexToOutput(instr->GetImmMoveWide());
         if (instr->GetShiftMoveWide() > 0) {
-          AppendToOutput(", lsl #%" PRId32, 16 * instr->GetShiftMoveWide());
+          AppendStringToOutput(", lsl #");
+          AppendDecimalToOutput(16 * instr->GetShiftMoveWide());
         }
       } else {
         VIXL_ASSERT((format[5] == 'I') || (format[5] == 'N'));
@@ -6527,16 +6573,18 @@ int Disassembler::SubstituteImmediateField(const Instruction *instr,
                        << (16 * instr->GetShiftMoveWide());
         if (format[5] == 'N') imm = ~imm;
         if (!instr->GetSixtyFourBits()) imm &= UINT64_C(0xffffffff);
-        AppendToOutput("#0x%" PRIx64, imm);
+        AppendCharToOutput('#');
+        AppendHexToOutput(imm);
       }
       return 8;
     }
     case 'L': {
       switch (format[2]) {
         case 'L': {  // ILLiteral - Immediate Load Literal.
-          AppendToOutput("pc%+" PRId32,
-                         instr->GetImmLLiteral() *
-                             static_cast<int>(kLiteralEntrySize));
+          int offset =
+              instr->GetImmLLiteral() * static_cast<int>(kLiteralEntrySize);
+          AppendStringToOutput((offset < 0) ? "pc" : "pc+");
+          AppendDecimalToOutput(offset);
           return 9;
         }
         case 'S': {  // ILS - Immediate Load/Store.
@@ -6544,7 +6592,8 @@ int Disassembler::SubstituteImmediateField(const Instruction *instr,
                      // omitted even if it is zero.
           bool is_index = format[3] == 'i';
           if (is_index || (instr->GetImmLS() != 0)) {
-            AppendToOutput(", #%" PRId32, instr->GetImmLS());
+            AppendStringToOutput(", #");
+            AppendDecimalToOutput(instr->GetImmLS());
           }
           return is_index ? 4 : 3;
         }
@@ -6556,20 +6605,23 @@ int Disassembler::SubstituteImmediateField(const Instruction *instr,
           if (is_index || (instr->GetImmLSPair() != 0)) {
             // format[3] is the scale value. Convert to a number.
             int scale = 1 << (format[3] - '0');
-            AppendToOutput(", #%" PRId32, instr->GetImmLSPair() * scale);
+            AppendStringToOutput(", #");
+            AppendDecimalToOutput(instr->GetImmLSPair() * scale);
           }
           return is_index ? 5 : 4;
         }
         case 'U': {  // ILU - Immediate Load/Store Unsigned.
           if (instr->GetImmLSUnsigned() != 0) {
             int shift = instr->GetSizeLS();
-            AppendToOutput(", #%" PRId32, instr->GetImmLSUnsigned() << shift);
+            AppendStringToOutput(", #");
+            AppendDecimalToOutput(instr->GetImmLSUnsigned() << shift);
           }
           return 3;
         }
         case 'A': {  // ILA - Immediate Load with pointer authentication.
           if (instr->GetImmLSPAC() != 0) {
-            AppendToOutput(", #%" PRId32, instr->GetImmLSPAC());
+            AppendStringToOutput(", #");
+            AppendDecimalToOutput(instr->GetImmLSPAC());
           }
           return 3;
         }
@@ -6586,7 +6638,11 @@ int Disassembler::SubstituteImmediateField(const Instruction *instr,
     }
     case 'A': {  // IAddSub.
       int64_t imm = instr->GetImmAddSub() << (12 * instr->GetImmAddSubShift());
-      AppendToOutput("#0x%" PRIx64 " (%" PRId64 ")", imm, imm);
+      AppendCharToOutput('#');
+      AppendHexToOutput(imm);
+      AppendStringToOutput(" (");
+      AppendDecimalToOutput(imm);
+      AppendCharToOutput(')');
       return 7;
     }
     case 'F': {  // IFP, IFPNeon, IFPSve or IFPFBits.
@@ -6595,7 +6651,8 @@ int Disassembler::SubstituteImmediateField(const Instruction *instr,
       switch (format[3]) {
         case 'F':
           VIXL_ASSERT(strncmp(format, "IFPFBits", strlen("IFPFBits")) == 0);
-          AppendToOutput("#%" PRId32, 64 - instr->GetFPScale());
+          AppendCharToOutput('#');
+          AppendDecimalToOutput(64 - instr->GetFPScale());
           return static_cast<int>(strlen("IFPFBits"));
         case 'N':
           VIXL_ASSERT(strncmp(format, "IFPNeon", strlen("IFPNeon")) == 0);
@@ -6618,7 +6675,8 @@ int Disassembler::SubstituteImmediateField(const Instruction *instr,
       return static_cast<int>(len);
     }
     case 'H': {  // IH - ImmHint
-      AppendToOutput("#%" PRId32, instr->GetImmHint());
+      AppendCharToOutput('#');
+      AppendDecimalToOutput(instr->GetImmHint());
       return 2;
     }
     case 'T': {  // ITri - Immediate Triangular Encoded.
@@ -6627,7 +6685,8 @@ int Disassembler::SubstituteImmediateField(const Instruction *instr,
         switch (format[7]) {
           case 'l':
             // SVE logical immediate encoding.
-            AppendToOutput("#0x%" PRIx64, instr->GetSVEImmLogical());
+            AppendCharToOutput('#');
+            AppendHexToOutput(instr->GetSVEImmLogical());
             return 8;
           case 'p': {
             // SVE predicated shift immediate encoding, lsl.
@@ -6635,7 +6694,8 @@ int Disassembler::SubstituteImmediateField(const Instruction *instr,
                 instr->GetSVEImmShiftAndLaneSizeLog2(
                     /* is_predicated = */ true);
             int lane_bits = 8 << shift_and_lane_size.second;
-            AppendToOutput("#%" PRId32, lane_bits - shift_and_lane_size.first);
+            AppendCharToOutput('#');
+            AppendDecimalToOutput(lane_bits - shift_and_lane_size.first);
             return 8;
           }
           case 'q': {
@@ -6643,7 +6703,8 @@ int Disassembler::SubstituteImmediateField(const Instruction *instr,
             std::pair<int, int> shift_and_lane_size =
                 instr->GetSVEImmShiftAndLaneSizeLog2(
                     /* is_predicated = */ true);
-            AppendToOutput("#%" PRId32, shift_and_lane_size.first);
+            AppendCharToOutput('#');
+            AppendDecimalToOutput(shift_and_lane_size.first);
             return 8;
           }
           case 'r': {
@@ -6652,7 +6713,8 @@ int Disassembler::SubstituteImmediateField(const Instruction *instr,
                 instr->GetSVEImmShiftAndLaneSizeLog2(
                     /* is_predicated = */ false);
             int lane_bits = 8 << shift_and_lane_size.second;
-            AppendToOutput("#%" PRId32, lane_bits - shift_and_lane_size.first);
+            AppendCharToOutput('#');
+            AppendDecimalToOutput(lane_bits - shift_and_lane_size.first);
             return 8;
           }
           case 's': {
@@ -6660,7 +6722,8 @@ int Disassembler::SubstituteImmediateField(const Instruction *instr,
             std::pair<int, int> shift_and_lane_size =
                 instr->GetSVEImmShiftAndLaneSizeLog2(
                     /* is_predicated = */ false);
-            AppendToOutput("#%" PRId32, shift_and_lane_size.first);
+            AppendCharToOutput('#');
+            AppendDecimalToOutput(shift_and_lane_size.first);
             return 8;
           }
           default:
@@ -6668,34 +6731,38 @@ int Disassembler::SubstituteImmediateField(const Instruction *instr,
             return 0;
         }
       } else {
-        AppendToOutput("#0x%" PRIx64, instr->GetImmLogical());
+        AppendCharToOutput('#');
+        AppendHexToOutput(instr->GetImmLogical());
         return 4;
       }
     }
     case 'N': {  // INzcv.
       int nzcv = (instr->GetNzcv() << Flags_offset);
-      AppendToOutput("#%c%c%c%c",
-                     ((nzcv & NFlag) == 0) ? 'n' : 'N',
-                     ((nzcv & ZFlag) == 0) ? 'z' : 'Z',
-                     ((nzcv & CFlag) == 0) ? 'c' : 'C',
-                     ((nzcv & VFlag) == 0) ? 'v' : 'V');
+      char flags[] = {'#',
+                      ((nzcv & NFlag) == 0) ? 'n' : 'N',
+                      ((nzcv & ZFlag) == 0) ? 'z' : 'Z',
+                      ((nzcv & CFlag) == 0) ? 'c' : 'C',
+                      ((nzcv & VFlag) == 0) ? 'v' : 'V'};
+      AppendStringToOutput(flags, sizeof(flags));
       return 5;
     }
     case 'P': {  // IP - Conditional compare.
-      AppendToOutput("#%" PRId32, instr->GetImmCondCmp());
+      AppendCharToOutput('#');
+      AppendDecimalToOutput(instr->GetImmCondCmp());
       return 2;
     }
     case 'B': {  // Bitfields.
       return SubstituteBitfieldImmediateField(instr, format);
     }
     case 'E': {  // IExtract.
-      AppendToOutput("#%" PRId32, instr->GetImmS());
+      AppendCharToOutput('#');
+      AppendDecimalToOutput(instr->GetImmS());
       return 8;
     }
     case 't': {  // It - Test and branch bit.
-      AppendToOutput("#%" PRId32,
-                     (instr->GetImmTestBranchBit5() << 5) |
-                         instr->GetImmTestBranchBit40());
+      AppendCharToOutput('#');
+      AppendDecimalToOutput((instr->GetImmTestBranchBit5() << 5) |
+                            instr->GetImmTestBranchBit40());
       return 2;
     }
     case 'S': {  // ISveSvl - SVE 'mul vl' immediate for structured ld/st.
@@ -6703,7 +6770,9 @@ int Disassembler::SubstituteImmediateField(const Instruction *instr,
       int imm = instr->ExtractSignedBits(19, 16);
       if (imm != 0) {
         int reg_count = instr->ExtractBits(22, 21) + 1;
-        AppendToOutput(", #%d, mul vl", imm * reg_count);
+        AppendStringToOutput(", #");
+        AppendDecimalToOutput(imm * reg_count);
+        AppendStringToOutput(", mul vl");
       }
       return 7;
     }
@@ -6712,13 +6781,15 @@ int Disassembler::SubstituteImmediateField(const Instruction *instr,
         case 'R': {  // IsR - right shifts.
           int shift = 16 << HighestSetBitPosition(instr->GetImmNEONImmh());
           shift -= instr->GetImmNEONImmhImmb();
-          AppendToOutput("#%d", shift);
+          AppendCharToOutput('#');
+          AppendDecimalToOutput(shift);
           return 3;
         }
         case 'L': {  // IsL - left shifts.
           int shift = instr->GetImmNEONImmhImmb();
           shift -= 8 << HighestSetBitPosition(instr->GetImmNEONImmh());
-          AppendToOutput("#%d", shift);
+          AppendCharToOutput('#');
+          AppendDecimalToOutput(shift);
           return 3;
         }
         default: {
@@ -6728,17 +6799,20 @@ int Disassembler::SubstituteImmediateField(const Instruction *instr,
       }
     }
     case 'D': {  // IDebug - HLT and BRK instructions.
-      AppendToOutput("#0x%" PRIx32, instr->GetImmException());
+      AppendCharToOutput('#');
+      AppendHexToOutput(instr->GetImmException());
       return 6;
     }
     case 'U': {  // IUdf - UDF immediate.
-      AppendToOutput("#0x%" PRIx32, instr->GetImmUdf());
+      AppendCharToOutput('#');
+      AppendHexToOutput(instr->GetImmUdf());
       return 4;
     }
     case 'V': {  // Immediate Vector.
       switch (format[2]) {
         case 'E': {  // IVExtract.
-          AppendToOutput("#%" PRId32, instr->GetImmNEONExt());
+          AppendCharToOutput('#');
+          AppendDecimalToOutput(instr->GetImmNEONExt());
           return 9;
         }
         case 'B': {  // IVByElemIndex.
@@ -6767,7 +6841,7 @@ int Disassembler::SubstituteImmediateField(const Instruction *instr,
               vm_index >>= 2;
             }
           }
-          AppendToOutput("%d", vm_index);
+          AppendDecimalToOutput(vm_index);
           return ret;
         }
         case 'I': {  // INS element.
@@ -6780,12 +6854,12 @@ int Disassembler::SubstituteImmediateField(const Instruction *instr,
               rd_index = imm5 >> (tz + 1);
               rn_index = imm4 >> tz;
               if (strncmp(format, "IVInsIndex1", strlen("IVInsIndex1")) == 0) {
-                AppendToOutput("%d", rd_index);
+                AppendDecimalToOutput(rd_index);
                 return static_cast<int>(strlen("IVInsIndex1"));
               } else if (strncmp(format,
                                  "IVInsIndex2",
                                  strlen("IVInsIndex2")) == 0) {
-                AppendToOutput("%d", rn_index);
+                AppendDecimalToOutput(rn_index);
                 return static_cast<int>(strlen("IVInsIndex2"));
               }
             }
@@ -6795,19 +6869,20 @@ int Disassembler::SubstituteImmediateField(const Instruction *instr,
                              strlen("IVInsSVEIndex")) == 0) {
             std::pair<int, int> index_and_lane_size =
                 instr->GetSVEPermuteIndexAndLaneSizeLog2();
-            AppendToOutput("%d", index_and_lane_size.first);
+            AppendDecimalToOutput(index_and_lane_size.first);
             return static_cast<int>(strlen("IVInsSVEIndex"));
           }
           VIXL_FALLTHROUGH();
         }
         case 'L': {  // IVLSLane[0123] - suffix indicates access size shift.
-          AppendToOutput("%d", instr->GetNEONLSIndex(format[8] - '0'));
+          AppendDecimalToOutput(instr->GetNEONLSIndex(format[8] - '0'));
           return 9;
         }
         case 'M': {  // Modified Immediate cases.
           if (strncmp(format, "IVMIImm8", strlen("IVMIImm8")) == 0) {
             uint64_t imm8 = instr->GetImmNEONabcdefgh();
-            AppendToOutput("#0x%" PRIx64, imm8);
+            AppendCharToOutput('#');
+            AppendHexToOutput(imm8);
             return static_cast<int>(strlen("IVMIImm8"));
           } else if (strncmp(format, "IVMIImm", strlen("IVMIImm")) == 0) {
             uint64_t imm8 = instr->GetImmNEONabcdefgh();
@@ -6817,21 +6892,24 @@ int Disassembler::SubstituteImmediateField(const Instruction *instr,
                 imm |= (UINT64_C(0xff) << (8 * i));
               }
             }
-            AppendToOutput("#0x%" PRIx64, imm);
+            AppendCharToOutput('#');
+            AppendHexToOutput(imm);
             return static_cast<int>(strlen("IVMIImm"));
           } else if (strncmp(format,
                              "IVMIShiftAmt1",
                              strlen("IVMIShiftAmt1")) == 0) {
             int cmode = instr->GetNEONCmode();
             int shift_amount = 8 * ((cmode >> 1) & 3);
-            AppendToOutput("#%d", shift_amount);
+            AppendCharToOutput('#');
+            AppendDecimalToOutput(shift_amount);
             return static_cast<int>(strlen("IVMIShiftAmt1"));
           } else if (strncmp(format,
                              "IVMIShiftAmt2",
                              strlen("IVMIShiftAmt2")) == 0) {
             int cmode = instr->GetNEONCmode();
             int shift_amount = 8 << (cmode & 1);
-            AppendToOutput("#%d", shift_amount);
+            AppendCharToOutput('#');
+            AppendDecimalToOutput(shift_amount);
             return static_cast<int>(strlen("IVMIShiftAmt2"));
           } else {
             VIXL_UNIMPLEMENTED();
@@ -6845,30 +6923,35 @@ int Disassembler::SubstituteImmediateField(const Instruction *instr,
       }
     }
     case 'X': {  // IX - CLREX instruction.
-      AppendToOutput("#0x%" PRIx32, instr->GetCRm());
+      AppendCharToOutput('#');
+      AppendHexToOutput(instr->GetCRm());
       return 2;
     }
     case 'Y': {  // IY - system register immediate.
       switch (instr->GetImmSystemRegister()) {
         case NZCV:
-          AppendToOutput("nzcv");
+          AppendStringToOutput("nzcv");
           break;
         case FPCR:
-          AppendToOutput("fpcr");
+          AppendStringToOutput("fpcr");
           break;
         case RNDR:
-          AppendToOutput("rndr");
+          AppendStringToOutput("rndr");
           break;
         case RNDRRS:
-          AppendToOutput("rndrrs");
+          AppendStringToOutput("rndrrs");
           break;
         default:
-          AppendToOutput("S%d_%d_c%d_c%d_%d",
-                         instr->GetSysOp0(),
-                         instr->GetSysOp1(),
-                         instr->GetCRn(),
-                         instr->GetCRm(),
-                         instr->GetSysOp2());
+          AppendCharToOutput('S');
+          AppendDecimalToOutput(instr->GetSysOp0());
+          AppendCharToOutput('_');
+          AppendDecimalToOutput(instr->GetSysOp1());
+          AppendStringToOutput("_c");
+          AppendDecimalToOutput(instr->GetCRn());
+          AppendStringToOutput("_c");
+          AppendDecimalToOutput(instr->GetCRm());
+          AppendCharToOutput('_');
+          AppendDecimalToOutput(instr->GetSysOp2());
           break;
       }
       return 2;
@@ -6876,7 +6959,8 @@ int Disassembler::SubstituteImmediateField(const Instruction *instr,
     case 'R': {  // IR - Rotate right into flags.
       switch (format[2]) {
         case 'r': {  // IRr - Rotate amount.
-          AppendToOutput("#%d", instr->GetImmRMIFRotation());
+          AppendCharToOutput('#');
+          AppendDecimalToOutput(instr->GetImmRMIFRotation());
           return 3;
         }
         default: {
@@ -6898,7 +6982,8 @@ int Disassembler::SubstituteImmediateField(const Instruction *instr,
         case SVE_VL6:
         case SVE_VL7:
         case SVE_VL8:
-          AppendToOutput("vl%u", pattern);
+          AppendStringToOutput("vl");
+          AppendDecimalToOutput(pattern);
           break;
         // VL16-VL256 are encoded as log2(N) + c.
         case SVE_VL16:
@@ -6906,23 +6991,25 @@ int Disassembler::SubstituteImmediateField(const Instruction *instr,
         case SVE_VL64:
         case SVE_VL128:
         case SVE_VL256:
-          AppendToOutput("vl%u", 16 << (pattern - SVE_VL16));
+          AppendStringToOutput("vl");
+          AppendDecimalToOutput(16 << (pattern - SVE_VL16));
           break;
         // Special cases.
         case SVE_POW2:
-          AppendToOutput("pow2");
+          AppendStringToOutput("pow2");
           break;
         case SVE_MUL4:
-          AppendToOutput("mul4");
+          AppendStringToOutput("mul4");
           break;
         case SVE_MUL3:
-          AppendToOutput("mul3");
+          AppendStringToOutput("mul3");
           break;
         case SVE_ALL:
-          AppendToOutput("all");
+          AppendStringToOutput("all");
           break;
         default:
-          AppendToOutput("#0x%x", pattern);
+          AppendCharToOutput('#');
+          AppendHexToOutput(pattern);
           break;
       }
       return 3;
@@ -6943,16 +7030,19 @@ int Disassembler::SubstituteBitfieldImmediateField(const Instruction *instr,
 
   switch (format[2]) {
     case 'r': {  // IBr.
-      AppendToOutput("#%d", r);
+      AppendCharToOutput('#');
+      AppendDecimalToOutput(r);
       return 3;
     }
     case 's': {  // IBs+1 or IBs-r+1.
       if (format[3] == '+') {
-        AppendToOutput("#%d", s + 1);
+        AppendCharToOutput('#');
+        AppendDecimalToOutput(s + 1);
         return 5;
       } else {
         VIXL_ASSERT(format[3] == '-');
-        AppendToOutput("#%d", s - r + 1);
+        AppendCharToOutput('#');
+        AppendDecimalToOutput(static_cast<int>(s - r + 1));
         return 7;
       }
     }
@@ -6960,7 +7050,8 @@ int Disassembler::SubstituteBitfieldImmediateField(const Instruction *instr,
       VIXL_ASSERT((format[3] == '-') && (format[4] == 'r'));
       unsigned reg_size =
           (instr->GetSixtyFourBits() == 1) ? kXRegSize : kWRegSize;
-      AppendToOutput("#%d", reg_size - r);
+      AppendCharToOutput('#');
+      AppendDecimalToOutput(static_cast<int>(reg_size - r));
       return 5;
     }
     default: {
@@ -7023,9 +7114,10 @@ int Disassembler::SubstituteShiftField(const Instruction *instr,
     case 'L': {  // NLo.
       if (instr->GetImmDPShift() != 0) {
         const char *shift_type[] = {"lsl", "lsr", "asr", "ror"};
-        AppendToOutput(", %s #%" PRId32,
-                       shift_type[instr->GetShiftDP()],
-                       instr->GetImmDPShift());
+        AppendStringToOutput(", ");
+        AppendStringToOutput(shift_type[instr->GetShiftDP()]);
+        AppendStringToOutput(" #");
+        AppendDecimalToOutput(instr->GetImmDPShift());
       }
       return 3;
     }
@@ -7033,7 +7125,8 @@ int Disassembler::SubstituteShiftField(const Instruction *instr,
       VIXL_ASSERT(strncmp(format, "NSveS", 5) == 0);
       int msz = instr->ExtractBits(24, 23);
       if (msz > 0) {
-        AppendToOutput(", lsl #%d", msz);
+        AppendStringToOutput(", lsl #");
+        AppendDecimalToOutput(msz);
       }
       return 5;
     }
@@ -7075,7 +7168,7 @@ int Disassembler::SubstituteConditionField(const Instruction *instr,
     default:
       cond = instr->GetCondition();
   }
-  AppendToOutput("%s", condition_code[cond]);
+  AppendStringToOutput(condition_code[cond]);
   return 4;
 }
 
@@ -7100,7 +7193,7 @@ int Disassembler::SubstitutePCRelAddressField(const Instruction *instr,
       reinterpret_cast<const void *>(base + offset - code_address_offset());
 
   AppendPCRelativeOffsetToOutput(instr, offset);
-  AppendToOutput(" ");
+  AppendCharToOutput(' ');
   AppendCodeRelativeAddressToOutput(instr, target);
   return 13;
 }
@@ -7136,7 +7229,7 @@ int Disassembler::SubstituteBranchTargetField(const Instruction *instr,
   VIXL_STATIC_ASSERT(sizeof(*instr) == 1);
 
   AppendPCRelativeOffsetToOutput(instr, offset);
-  AppendToOutput(" ");
+  AppendCharToOutput(' ');
   AppendCodeRelativeCodeAddressToOutput(instr, target_address);
 
   return 8;
@@ -7158,12 +7251,15 @@ int Disassembler::SubstituteExtendField(const Instruction *instr,
       (((instr->GetExtendMode() == UXTW) && (instr->GetSixtyFourBits() == 0)) ||
        (instr->GetExtendMode() == UXTX))) {
     if (instr->GetImmExtendShift() > 0) {
-      AppendToOutput(", lsl #%" PRId32, instr->GetImmExtendShift());
+      AppendStringToOutput(", lsl #");
+      AppendDecimalToOutput(instr->GetImmExtendShift());
     }
   } else {
-    AppendToOutput(", %s", extend_mode[instr->GetExtendMode()]);
+    AppendStringToOutput(", ");
+    AppendStringToOutput(extend_mode[instr->GetExtendMode()]);
     if (instr->GetImmExtendShift() > 0) {
-      AppendToOutput(" #%" PRId32, instr->GetImmExtendShift());
+      AppendStringToOutput(" #");
+      AppendDecimalToOutput(instr->GetImmExtendShift());
     }
   }
   return 3;
@@ -7188,17 +7284,20 @@ int Disassembler::SubstituteLSRegOffsetField(const Instruction *instr,
   char reg_type = ((ext == UXTW) || (ext == SXTW)) ? 'w' : 'x';
 
   unsigned rm = instr->GetRm();
+  AppendCharToOutput(reg_type);
   if (rm == kZeroRegCode) {
-    AppendToOutput("%czr", reg_type);
+    AppendStringToOutput("zr");
   } else {
-    AppendToOutput("%c%d", reg_type, rm);
+    AppendDecimalToOutput(rm);
   }
 
   // Extend mode UXTX is an alias for shift mode LSL here.
   if (!((ext == UXTX) && (shift == 0))) {
-    AppendToOutput(", %s", extend_mode[ext]);
+    AppendStringToOutput(", ");
+    AppendStringToOutput(extend_mode[ext]);
     if (shift != 0) {
-      AppendToOutput(" #%d", instr->GetSizeLS());
+      AppendStringToOutput(" #");
+      AppendDecimalToOutput(instr->GetSizeLS());
     }
   }
   return 9;
@@ -7215,33 +7314,32 @@ int Disassembler::SubstitutePrefetchField(const Instruction *instr,
   int placeholder_length = is_sve ? 9 : 6;
   static const char *stream_options[] = {"keep", "strm"};
 
-  auto get_hints = [](bool want_sve_hint) -> std::vector<std::string> {
-    static const std::vector<std::string> sve_hints = {"ld", "st"};
-    static const std::vector<std::string> core_hints = {"ld", "li", "st"};
-    return (want_sve_hint) ? sve_hints : core_hints;
-  };
-
-  std::vector<std::string> hints = get_hints(is_sve);
+  static const char *sve_hints[] = {"ld", "st"};
+  static const char *core_hints[] = {"ld", "li", "st"};
+  const char **hints = is_sve ? sve_hints : core_hints;
+  size_t hint_count =
+      is_sve ? ArrayLength(sve_hints) : ArrayLength(core_hints);
   unsigned hint =
       is_sve ? instr->GetSVEPrefetchHint() : instr->GetPrefetchHint();
   unsigned target = instr->GetPrefetchTarget() + 1;
   unsigned stream = instr->GetPrefetchStream();
 
-  if ((hint >= hints.size()) || (target > 3)) {
+  if ((hint >= hint_count) || (target > 3)) {
     // Unallocated prefetch operations.
-    if (is_sve) {
-      std::bitset<4> prefetch_mode(instr->GetSVEImmPrefetchOperation());
-      AppendToOutput("#0b%s", prefetch_mode.to_string().c_str());
-    } else {
-      std::bitset<5> prefetch_mode(instr->GetImmPrefetchOperation());
-      AppendToOutput("#0b%s", prefetch_mode.to_string().c_str());
+    int width = is_sve ? 4 : 5;
+    int op = is_sve ? instr->GetSVEImmPrefetchOperation()
+                    : instr->GetImmPrefetchOperation();
+    AppendStringToOutput("#0b");
+    for (int i = width - 1; i >= 0; i--) {
+      AppendCharToOutput(((op >> i) & 1) ? '1' : '0');
     }
   } else {
     VIXL_ASSERT(stream < ArrayLength(stream_options));
-    AppendToOutput("p%sl%d%s",
-                   hints[hint].c_str(),
-                   target,
-                   stream_options[stream]);
+    AppendCharToOutput('p');
+    AppendStringToOutput(hints[hint]);
+    AppendCharToOutput('l');
+    AppendDecimalToOutput(target);
+    AppendStringToOutput(stream_options[stream]);
   }
   return placeholder_length;
 }
@@ -7258,7 +7356,7 @@ int Disassembler::SubstituteBarrierField(const Instruction *instr,
   int domain = instr->GetImmBarrierDomain();
   int type = instr->GetImmBarrierType();
 
-  AppendToOutput("%s", options[domain][type]);
+  AppendStringToOutput(options[domain][type]);
   return 1;
 }
 
@@ -7276,7 +7374,8 @@ int Disassembler::SubstituteSysOpField(const Instruction *instr,
     default:
       VIXL_UNREACHABLE();
   }
-  AppendToOutput("#%d", op);
+  AppendCharToOutput('#');
+  AppendDecimalToOutput(op);
   return 2;
 }
 
@@ -7294,7 +7393,8 @@ int Disassembler::SubstituteCrField(const Instruction *instr,
     default:
       VIXL_UNREACHABLE();
   }
-  AppendToOutput("C%d", cr);
+  AppendCharToOutput('C');
+  AppendDecimalToOutput(cr);
   return 2;
 }
 
@@ -7351,7 +7451,7 @@ int Disassembler::SubstituteIntField(const Instruction *instr,
     bits = static_cast<int32_t>(bits * value);
   }
 
-  AppendToOutput("%d", bits);
+  AppendDecimalToOutput(bits);
 
   return static_cast<int>(c - format);
 }
@@ -7427,7 +7527,7 @@ int Disassembler::SubstituteSVESize(const Instruction *instr,
   }
 
   VIXL_ASSERT(size_in_bytes_log2 < ArrayLength(sizes));
-  AppendToOutput("%c", sizes[size_in_bytes_log2]);
+  AppendCharToOutput(sizes[size_in_bytes_log2]);
 
   return placeholder_length;
 }
@@ -7446,7 +7546,7 @@ int Disassembler::SubstituteTernary(const Instruction *instr,
   VIXL_ASSERT(value < (kInstructionSize * kBitsPerByte));
   VIXL_ASSERT((*c == ':') && (strlen(c) >= 3));  // Minimum of ":TF"
   c++;
-  AppendToOutput("%c", c[1 - instr->ExtractBit(static_cast<int>(value))]);
+  AppendCharToOutput(c[1 - instr->ExtractBit(static_cast<int>(value))]);
   return 6;
 }
 
@@ -7456,6 +7556,46 @@ void Disassembler::ResetOutput() {
 }
 
 
+void Disassembler::AppendStringToOutput(const char *string, size_t length) {
+  VIXL_ASSERT(buffer_pos_ < buffer_size_);
+  // Truncate the output if necessary, leaving space for the terminator.
+  size_t space = buffer_size_ - buffer_pos_ - 1;
+  if (length > space) length = space;
+  memcpy(&buffer_[buffer_pos_], string, length);
+  buffer_pos_ += static_cast<uint32_t>(length);
+  buffer_[buffer_pos_] = 0;
+}
+
+
+void Disassembler::AppendDecimalToOutput(int64_t value) {
+  char digits[20];
+  size_t pos = sizeof(digits);
+  // Cast to uint64_t so that INT64_MIN is handled in a well-defined way.
+  uint64_t abs_value = static_cast<uint64_t>(value);
+  if (value < 0) abs_value = UnsignedNegate(abs_value);
+  do {
+    digits[--pos] = static_cast<char>('0' + (abs_value % 10));
+    abs_value /= 10;
+  } while (abs_value != 0);
+  if (value < 0) digits[--pos] = '-';
+  AppendStringToOutput(&digits[pos], sizeof(digits) - pos);
+}
+
+
+void Disassembler::AppendHexToOutput(uint64_t value) {
+  static const char hex_digits[] = "0123456789abcdef";
+  char digits[18];
+  size_t pos = sizeof(digits);
+  do {
+    digits[--pos] = hex_digits[value & 0xf];
+    value >>= 4;
+  } while (value != 0);
+  digits[--pos] = 'x';
+  digits[--pos] = '0';
+  AppendStringToOutput(&digits[pos], sizeof(digits) - pos);
+}
+
+
 void Disassembler::AppendToOutput(const char *format, ...) {
   va_list args;
   va_start(args, format);
@@ -7483,7 +7623,13 @@ void PrintDisassembler::DisassembleBuffer(const Instruction *start,
     decoder.AppendVisitor(cpu_features_auditor_);
   }
   decoder.AppendVisitor(this);
-  decoder.Decode(start, end);
+  if (cpu_features_auditor_ == NULL) {
+    decoder.DecodeBatch(start, end);
+  } else {
+    // The auditor must visit each instruction immediately before it is
+    // printed, so it cannot be used with DecodeBatch().
+    decoder.Decode(start, end);
+  }
 }
 
 void PrintDisassembler::DisassembleBuffer(const Instruction *start,
@@ -7492,24 +7638,28 @@ void PrintDisassembler::DisassembleBuffer(const Instruction *start,
 }
 
 
-void PrintDisassembler::ProcessOutput(const Instruction *instr) {
-  int64_t address = CodeRelativeAddress(instr);
-
-  uint64_t abs_address;
-  const char *sign;
-  if (signed_addresses_) {
+// Split a code address into a sign and an absolute value, for printing.
+static const char *GetPrintableAddress(int64_t address,
+                                       bool signed_addresses,
+                                       uint64_t *abs_address) {
+  if (signed_addresses) {
     if (address < 0) {
-      sign = "-";
-      abs_address = UnsignedNegate(static_cast<uint64_t>(address));
-    } else {
-      // Leave a leading space, to maintain alignment.
-      sign = " ";
-      abs_address = address;
+      *abs_address = UnsignedNegate(static_cast<uint64_t>(address));
+      return "-";
     }
-  } else {
-    sign = "";
-    abs_address = address;
+    // Leave a leading space, to maintain alignment.
+    *abs_address = address;
+    return " ";
   }
+  *abs_address = address;
+  return "";
+}
+
+void PrintDisassembler::ProcessOutput(const Instruction *instr) {
+  uint64_t abs_address;
+  const char *sign = GetPrintableAddress(CodeRelativeAddress(instr),
+                                         signed_addresses_,
+                                         &abs_address);
 
   int bytes_printed = fprintf(stream_,
                               "%s0x%016" PRIx64 "  %08" PRIx32 "\t\t%s",
@@ -7546,5 +7696,113 @@ void PrintDisassembler::ProcessOutput(const Instruction *instr) {
   fprintf(stream_, "\n");
 }
 
+// A Disassembler that appends its output to a string, in the same format as
+// PrintDisassembler. ParallelDisassembler uses one of these for each chunk.
+class StringPrintDisassembler : public Disassembler {
+ public:
+  StringPrintDisassembler(std::string *output,
+                          bool signed_addresses,
+                          int64_t code_address_offset)
+      : output_(output), signed_addresses_(signed_addresses) {
+    set_code_address_offset(code_address_offset);
+  }
+
+ protected:
+  virtual void ProcessOutput(const Instruction *instr) VIXL_OVERRIDE {
+    uint64_t abs_address;
+    const char *sign = GetPrintableAddress(CodeRelativeAddress(instr),
+                                           signed_addresses_,
+                                           &abs_address);
+    char prefix[64];
+    snprintf(prefix,
+             sizeof(prefix),
+             "%s0x%016" PRIx64 "  %08" PRIx32 "\t\t",
+             sign,
+             abs_address,
+             instr->GetInstructionBits());
+    output_->append(prefix);
+    output_->append(GetOutput());
+    output_->push_back('\n');
+  }
+
+ private:
+  std::string *output_;
+  bool signed_addresses_;
+};
+
+static void DisassembleChunk(const Instruction *start,
+                             const Instruction *end,
+                             bool signed_addresses,
+                             int64_t code_address_offset,
+                             std::string *output) {
+  // Lines are typically around 50 characters.
+  output->reserve(((end - start) / kInstructionSize) * 64);
+  Decoder decoder;
+  StringPrintDisassembler disasm(output, signed_addresses, code_address_offset);
+  decoder.AppendVisitor(&disasm);
+  decoder.DecodeBatch(start, end);
+}
+
+ParallelDisassembler::ParallelDisassembler(FILE *stream, unsigned thread_count)
+    : stream_(stream),
+      thread_count_(thread_count),
+      signed_addresses_(false),
+      code_address_offset_(0) {
+  if (thread_count_ == 0) thread_count_ = std::thread::hardware_concurrency();
+  // hardware_concurrency() returns zero if the value is not computable.
+  if (thread_count_ == 0) thread_count_ = 1;
+}
+
+void ParallelDisassembler::MapCodeAddress(int64_t base_address,
+                                          const Instruction *instr_address) {
+  code_address_offset_ =
+      base_address - reinterpret_cast<intptr_t>(instr_address);
+}
+
+void ParallelDisassembler::DisassembleBuffer(const Instruction *start,
+                                             uint64_t size) {
+  DisassembleBuffer(start, start + size);
+}
+
+void ParallelDisassembler::DisassembleBuffer(const Instruction *start,
+                                             const Instruction *end) {
+  VIXL_ASSERT(start <= end);
+  VIXL_ASSERT(((end - start) % kInstructionSize) == 0);
+  size_t instr_count = (end - start) / kInstructionSize;
+  size_t chunk_count =
+      std::max<size_t>(1, std::min<size_t>(thread_count_,
+                                           instr_count / kMinChunkInstructions));
+
+  // Each chunk is disassembled into its own string. The last chunk is handled
+  // by this thread.
+  std::vector<std::string> output(chunk_count);
+  std::vector<std::thread> workers;
+  for (size_t i = 0; i < chunk_count; i++) {
+    const Instruction *chunk_start =
+        start + (((instr_count * i) / chunk_count) * kInstructionSize);
+    const Instruction *chunk_end =
+        start + (((instr_count * (i + 1)) / chunk_count) * kInstructionSize);
+    if (i == (chunk_count - 1)) {
+      DisassembleChunk(chunk_start,
+                       chunk_end,
+                       signed_addresses_,
+                       code_address_offset_,
+                       &output[i]);
+    } else {
+      workers.emplace_back(DisassembleChunk,
+                           chunk_start,
+                           chunk_end,
+                           signed_addresses_,
+                           code_address_offset_,
+                           &output[i]);
+    }
+  }
+
+  for (size_t i = 0; i < chunk_count; i++) {
+    if (i < workers.size()) workers[i].join();
+    fwrite(output[i].data(), 1, output[i].size(), stream_);
+  }
+}
+
 }  // namespace aarch64
 }  // namespace vixl
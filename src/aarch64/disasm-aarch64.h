@@ -54,6 +54,13 @@ class Disassembler : public DecoderVisitor {
   virtual void Visit(Metadata* metadata,
                      const Instruction* instr) VIXL_OVERRIDE;
 
+  // Disassemble a batch of instructions, looking up each handler directly from
+  // the form id. ProcessOutput() is called once per instruction, so only
+  // subclasses that override it (such as PrintDisassembler) observe more than
+  // the last instruction of the batch.
+  virtual void VisitBatch(const DecodedInstruction* batch,
+                          size_t count) VIXL_OVERRIDE;
+
  protected:
   virtual void ProcessOutput(const Instruction* instr);
 
@@ -117,18 +124,32 @@ class Disassembler : public DecoderVisitor {
   VISITOR_LIST(DECLARE)
 #undef DECLARE
 
-  using FormToVisitorFnMap = std::unordered_map<
-      uint32_t,
-      std::function<void(Disassembler*, const Instruction*)>>;
+  using FormToVisitorFn =
+      std::function<void(Disassembler*, const Instruction*)>;
+  using FormToVisitorFnMap = std::unordered_map<uint32_t, FormToVisitorFn>;
+  using FormToVisitorFnTable = FormIdTable<FormToVisitorFn>;
   static const FormToVisitorFnMap* GetFormToVisitorFnMap();
+  static const FormToVisitorFnTable* GetFormToVisitorFnTable();
 
-  std::string mnemonic_;
+  // The mnemonic is held in a fixed-size buffer, to avoid allocating memory
+  // for each instruction.
+  static const size_t kMaxMnemonicLength = 15;
+  char mnemonic_[kMaxMnemonicLength + 1];
   uint32_t form_hash_;
 
-  void SetMnemonicFromForm(const std::string& form) {
-    if (form != "unallocated") {
-      VIXL_ASSERT(form.find_first_of('_') != std::string::npos);
-      mnemonic_ = form.substr(0, form.find_first_of('_'));
+  void SetMnemonic(const char* mnemonic, size_t length) {
+    VIXL_ASSERT(length <= kMaxMnemonicLength);
+    memcpy(mnemonic_, mnemonic, length);
+    mnemonic_[length] = '\0';
+  }
+  void SetMnemonic(const char* mnemonic) {
+    SetMnemonic(mnemonic, strlen(mnemonic));
+  }
+
+  void SetMnemonicFromForm(const char* form) {
+    if (strcmp(form, "unallocated") != 0) {
+      VIXL_ASSERT(strchr(form, '_') != NULL);
+      SetMnemonic(form, strcspn(form, "_"));
     }
   }
 
@@ -296,6 +317,19 @@ class Disassembler : public DecoderVisitor {
   void ResetOutput();
   void AppendToOutput(const char* string, ...) PRINTF_CHECK(2, 3);
 
+  // Faster alternatives to AppendToOutput(), which do not parse a format
+  // string. Like AppendToOutput(), these truncate the output if the buffer is
+  // full, and leave it null-terminated.
+  void AppendStringToOutput(const char* string, size_t length);
+  void AppendStringToOutput(const char* string) {
+    AppendStringToOutput(string, strlen(string));
+  }
+  void AppendCharToOutput(char c) { AppendStringToOutput(&c, 1); }
+  // Append a signed decimal value, such as "-42".
+  void AppendDecimalToOutput(int64_t value);
+  // Append an unsigned hexadecimal value, with a "0x" prefix, such as "0x2a".
+  void AppendHexToOutput(uint64_t value);
+
   void set_code_address_offset(int64_t code_address_offset) {
     code_address_offset_ = code_address_offset;
   }
@@ -365,6 +399,39 @@ class PrintDisassembler : public Disassembler {
  private:
   FILE* stream_;
 };
+
+// Disassemble large code regions using several threads. The region is split
+// into contiguous chunks, and each chunk is disassembled by its own Decoder and
+// Disassembler. The output is then written to the stream in address order, in
+// the same format as PrintDisassembler (without CPU feature annotations).
+//
+// Code addresses are mapped in the same way for every chunk, so branch targets
+// and other code-relative addresses are consistent across chunk boundaries.
+class ParallelDisassembler {
+ public:
+  // If `thread_count` is zero, one thread is used for each hardware thread.
+  explicit ParallelDisassembler(FILE* stream, unsigned thread_count = 0);
+
+  void DisassembleBuffer(const Instruction* start, uint64_t size);
+  void DisassembleBuffer(const Instruction* start, const Instruction* end);
+
+  // These behave like the Disassembler and PrintDisassembler methods of the
+  // same names.
+  void MapCodeAddress(int64_t base_address, const Instruction* instr_address);
+  void PrintSignedAddresses(bool s) { signed_addresses_ = s; }
+
+  unsigned GetThreadCount() const { return thread_count_; }
+
+  // Regions are not split into chunks smaller than this, to avoid starting
+  // threads for trivial amounts of work.
+  static const size_t kMinChunkInstructions = 4096;
+
+ private:
+  FILE* stream_;
+  unsigned thread_count_;
+  bool signed_addresses_;
+  int64_t code_address_offset_;
+};
 }  // namespace aarch64
 }  // namespace vixl
 
@@ -27,6 +27,8 @@
 #ifndef VIXL_AARCH64_INSTRUCTIONS_AARCH64_H_
 #define VIXL_AARCH64_INSTRUCTIONS_AARCH64_H_
 
+#include <algorithm>
+
 #include "../globals-vixl.h"
 #include "../utils-vixl.h"
 
@@ -886,19 +888,46 @@ class NEONFormatDecoder {
       return NULL;
     }
 
-    snprintf(form_buffer_,
-             sizeof(form_buffer_),
-             string,
-             subst0,
-             subst1,
-             subst2);
+    // The input string uses printf-style "%s" and "%1$s" conversions, but
+    // they are expanded directly, since this is used for every NEON
+    // instruction that is disassembled. Like snprintf, the result is truncated
+    // if it does not fit in the buffer.
+    const char* substs[] = {subst0, subst1, subst2};
+    int next_subst = 0;
+    size_t pos = 0;
+    const size_t max_pos = sizeof(form_buffer_) - 1;
+    while (*string != '\0') {
+      if (*string != '%') {
+        if (pos < max_pos) form_buffer_[pos++] = *string;
+        string++;
+        continue;
+      }
+      int index;
+      if (string[1] == 's') {
+        index = next_subst++;
+        string += 2;
+      } else {
+        VIXL_ASSERT((string[1] >= '1') && (string[1] <= '3'));
+        VIXL_ASSERT((string[2] == '$') && (string[3] == 's'));
+        index = string[1] - '1';
+        string += 4;
+      }
+      VIXL_ASSERT((index >= 0) && (index < 3));
+      for (const char* c = substs[index]; *c != '\0'; c++) {
+        if (pos < max_pos) form_buffer_[pos++] = *c;
+      }
+    }
+    form_buffer_[pos] = '\0';
     return form_buffer_;
   }
 
   // Append a "2" to a mnemonic string based on the state of the Q bit.
   const char* Mnemonic(const char* mnemonic) {
     if ((mnemonic != NULL) && (instrbits_ & NEON_Q) != 0) {
-      snprintf(mne_buffer_, sizeof(mne_buffer_), "%s2", mnemonic);
+      size_t length = std::min(strlen(mnemonic), sizeof(mne_buffer_) - 2);
+      memcpy(mne_buffer_, mnemonic, length);
+      mne_buffer_[length] = '2';
+      mne_buffer_[length + 1] = '\0';
       return mne_buffer_;
     }
     return mnemonic;
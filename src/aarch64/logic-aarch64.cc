@@ -27,6 +27,8 @@
 #ifdef VIXL_INCLUDE_SIMULATOR_AARCH64
 
 #include <cmath>
+#include <functional>
+#include <type_traits>
 
 #include "simulator-aarch64.h"
 
@@ -66,6 +68,220 @@ bool IsFloat16<SimFloat16>() {
   return true;
 }
 
+// Arithmetic on lanes narrower than `int` would be promoted to (signed) `int`,
+// where multiplication can overflow, so use at least `unsigned` instead.
+template <typename T>
+using LaneArithmeticType =
+    typename std::conditional<(sizeof(T) < sizeof(unsigned)), unsigned, T>::
+        type;
+
+// Call `f` with a std::integral_constant holding `size_in_bytes`, for the
+// register sizes used by NEON (8 and 16 bytes) and the most common SVE vector
+// lengths (128, 256, 512 and 2048 bits), so that loops over those registers
+// have a fixed trip count that the compiler can unroll and vectorise. Other
+// sizes are passed as zero, meaning that the size is only known at run time.
+template <typename F>
+static void DispatchOnRegisterSize(unsigned size_in_bytes, F f) {
+  switch (size_in_bytes) {
+    case 8:
+      f(std::integral_constant<unsigned, 8>());
+      break;
+    case 16:
+      f(std::integral_constant<unsigned, 16>());
+      break;
+    case 32:
+      f(std::integral_constant<unsigned, 32>());
+      break;
+    case 64:
+      f(std::integral_constant<unsigned, 64>());
+      break;
+    case 256:
+      f(std::integral_constant<unsigned, 256>());
+      break;
+    default:
+      f(std::integral_constant<unsigned, 0>());
+      break;
+  }
+}
+
+// Apply `op` to each pair of lanes in `src1` and `src2`, writing the results to
+// `dst`. The lanes are copied into plain arrays of T, so that the host compiler
+// can vectorise the loop, instead of going through LogicVRegister's per-lane
+// accessors. The registers may alias.
+//
+// If `kSizeInBytes` is non-zero, it must match `size`, and is used in its
+// place.
+//
+// This is only suitable for operations that don't record saturation or
+// rounding state. The results are identical to the equivalent lane-by-lane
+// loops.
+template <unsigned kSizeInBytes, typename T, typename Op>
+static void LanewiseKernel(VectorFormat vform,
+                           unsigned size,
+                           const LogicVRegister& dst,
+                           const LogicVRegister& src1,
+                           const LogicVRegister& src2,
+                           Op op) {
+  VIXL_ASSERT((kSizeInBytes == 0) || (kSizeInBytes == size));
+  if (kSizeInBytes != 0) size = kSizeInBytes;
+  T a[kZRegMaxSizeInBytes / sizeof(T)];
+  T b[kZRegMaxSizeInBytes / sizeof(T)];
+  memcpy(a, src1.GetLaneBytes(vform), size);
+  memcpy(b, src2.GetLaneBytes(vform), size);
+  for (unsigned i = 0; i < (size / sizeof(T)); i++) {
+    a[i] = op(a[i], b[i]);
+  }
+  dst.ClearForWrite(vform);
+  memcpy(dst.GetLaneBytesForWrite(vform), a, size);
+}
+
+template <typename T, typename Op>
+static void LanewiseKernel(VectorFormat vform,
+                           const LogicVRegister& dst,
+                           const LogicVRegister& src1,
+                           const LogicVRegister& src2,
+                           Op op) {
+  unsigned size = dst.LaneCountFromFormat(vform) * sizeof(T);
+  DispatchOnRegisterSize(size, [&](auto size_in_bytes) {
+    LanewiseKernel<decltype(size_in_bytes)::value, T>(vform,
+                                                      size,
+                                                      dst,
+                                                      src1,
+                                                      src2,
+                                                      op);
+  });
+}
+
+// Select each lane from `src1` if it is active in `pg`, or from `src2`
+// otherwise, and write the result to `dst`. If `src2` is NULL, inactive lanes
+// are zeroed. The registers may alias.
+//
+// The predicate is read as 64-bit words, rather than lane by lane. Like
+// LanewiseKernel, a non-zero `kSizeInBytes` fixes the register size.
+template <unsigned kSizeInBytes, typename T>
+static void SelectKernel(VectorFormat vform,
+                         unsigned size,
+                         const LogicVRegister& dst,
+                         const SimPRegister& pg,
+                         const LogicVRegister& src1,
+                         const LogicVRegister* src2) {
+  VIXL_ASSERT((kSizeInBytes == 0) || (kSizeInBytes == size));
+  if (kSizeInBytes != 0) size = kSizeInBytes;
+  // Each byte of a Z register is governed by one predicate bit.
+  static const unsigned kWordBits = 64;
+  uint64_t words[kZRegMaxSizeInBytes / kWordBits] = {};
+  memcpy(words, pg.GetBytes(), size / kZRegBitsPerPRegBit);
+
+  T a[kZRegMaxSizeInBytes / sizeof(T)];
+  T b[kZRegMaxSizeInBytes / sizeof(T)] = {};
+  memcpy(a, src1.GetLaneBytes(vform), size);
+  if (src2 != NULL) memcpy(b, src2->GetLaneBytes(vform), size);
+  for (unsigned i = 0; i < (size / sizeof(T)); i++) {
+    unsigned bit = i * sizeof(T);
+    T active = static_cast<T>((words[bit / kWordBits] >> (bit % kWordBits)) & 1);
+    T mask = static_cast<T>(-active);
+    a[i] = static_cast<T>((a[i] & mask) | (b[i] & ~mask));
+  }
+  memcpy(dst.GetLaneBytesForWrite(vform), a, size);
+}
+
+static void SelectLanes(VectorFormat vform,
+                        const LogicVRegister& dst,
+                        const SimPRegister& pg,
+                        const LogicVRegister& src1,
+                        const LogicVRegister* src2) {
+  VIXL_ASSERT(IsSVEFormat(vform));
+  unsigned size =
+      dst.LaneCountFromFormat(vform) * LaneSizeInBytesFromFormat(vform);
+  DispatchOnRegisterSize(size, [&](auto size_in_bytes) {
+    const unsigned kSize = decltype(size_in_bytes)::value;
+    switch (LaneSizeInBitsFromFormat(vform)) {
+      case 8:
+        SelectKernel<kSize, uint8_t>(vform, size, dst, pg, src1, src2);
+        break;
+      case 16:
+        SelectKernel<kSize, uint16_t>(vform, size, dst, pg, src1, src2);
+        break;
+      case 32:
+        SelectKernel<kSize, uint32_t>(vform, size, dst, pg, src1, src2);
+        break;
+      case 64:
+        SelectKernel<kSize, uint64_t>(vform, size, dst, pg, src1, src2);
+        break;
+      default:
+        VIXL_UNREACHABLE();
+    }
+  });
+}
+
+// Call LanewiseKernel with an unsigned lane type of the size used by `vform`.
+// `op` must accept any unsigned lane type.
+template <typename Op>
+static void LanewiseBinaryOp(VectorFormat vform,
+                             const LogicVRegister& dst,
+                             const LogicVRegister& src1,
+                             const LogicVRegister& src2,
+                             Op op) {
+  switch (LaneSizeInBitsFromFormat(vform)) {
+    case 8:
+      LanewiseKernel<uint8_t>(vform, dst, src1, src2, op);
+      break;
+    case 16:
+      LanewiseKernel<uint16_t>(vform, dst, src1, src2, op);
+      break;
+    case 32:
+      LanewiseKernel<uint32_t>(vform, dst, src1, src2, op);
+      break;
+    case 64:
+      LanewiseKernel<uint64_t>(vform, dst, src1, src2, op);
+      break;
+    default:
+      VIXL_UNREACHABLE();
+  }
+}
+
+// Lane operations for LanewiseBinaryOp.
+struct LaneAdd {
+  template <typename T>
+  T operator()(T a, T b) const {
+    using W = LaneArithmeticType<T>;
+    return static_cast<T>(static_cast<W>(a) + static_cast<W>(b));
+  }
+};
+
+struct LaneSub {
+  template <typename T>
+  T operator()(T a, T b) const {
+    using W = LaneArithmeticType<T>;
+    return static_cast<T>(static_cast<W>(a) - static_cast<W>(b));
+  }
+};
+
+struct LaneMul {
+  template <typename T>
+  T operator()(T a, T b) const {
+    using W = LaneArithmeticType<T>;
+    return static_cast<T>(static_cast<W>(a) * static_cast<W>(b));
+  }
+};
+
+// Set every bit of the lane if `Compare` is true for the lanes, interpreted as
+// signed values if `kSigned` is set.
+template <bool kSigned, typename Compare>
+struct LaneCompare {
+  template <typename T>
+  T operator()(T a, T b) const {
+    bool result;
+    if (kSigned) {
+      using S = typename std::make_signed<T>::type;
+      result = Compare()(static_cast<S>(a), static_cast<S>(b));
+    } else {
+      result = Compare()(a, b);
+    }
+    return result ? static_cast<T>(~T(0)) : T(0);
+  }
+};
+
 template <>
 double Simulator::FPDefaultNaN<double>() {
   return kFP64DefaultNaN;
@@ -509,6 +725,63 @@ LogicVRegister Simulator::cmp(VectorFormat vform,
                               const LogicVRegister& src1,
                               const LogicVRegister& src2,
                               Condition cond) {
+  if (AreVectorKernelsEnabled()) {
+    switch (cond) {
+      case eq:
+        LanewiseBinaryOp(vform,
+                         dst,
+                         src1,
+                         src2,
+                         LaneCompare<false, std::equal_to<>>());
+        return dst;
+      case ge:
+        LanewiseBinaryOp(vform,
+                         dst,
+                         src1,
+                         src2,
+                         LaneCompare<true, std::greater_equal<>>());
+        return dst;
+      case gt:
+        LanewiseBinaryOp(vform,
+                         dst,
+                         src1,
+                         src2,
+                         LaneCompare<true, std::greater<>>());
+        return dst;
+      case hi:
+        LanewiseBinaryOp(vform,
+                         dst,
+                         src1,
+                         src2,
+                         LaneCompare<false, std::greater<>>());
+        return dst;
+      case hs:
+        LanewiseBinaryOp(vform,
+                         dst,
+                         src1,
+                         src2,
+                         LaneCompare<false, std::greater_equal<>>());
+        return dst;
+      case lt:
+        LanewiseBinaryOp(vform,
+                         dst,
+                         src1,
+                         src2,
+                         LaneCompare<true, std::less<>>());
+        return dst;
+      case le:
+        LanewiseBinaryOp(vform,
+                         dst,
+                         src1,
+                         src2,
+                         LaneCompare<true, std::less_equal<>>());
+        return dst;
+      default:
+        VIXL_UNREACHABLE();
+        break;
+    }
+  }
+
   dst.ClearForWrite(vform);
   for (int i = 0; i < LaneCountFromFormat(vform); i++) {
     int64_t sa = src1.Int(vform, i);
@@ -573,6 +846,26 @@ LogicVRegister Simulator::cmptst(VectorFormat vform,
 }
 
 
+LogicVRegister Simulator::add_nosat(VectorFormat vform,
+                                    LogicVRegister dst,
+                                    const LogicVRegister& src1,
+                                    const LogicVRegister& src2) {
+  if (!AreVectorKernelsEnabled()) return add(vform, dst, src1, src2);
+  LanewiseBinaryOp(vform, dst, src1, src2, LaneAdd());
+  return dst;
+}
+
+
+LogicVRegister Simulator::sub_nosat(VectorFormat vform,
+                                    LogicVRegister dst,
+                                    const LogicVRegister& src1,
+                                    const LogicVRegister& src2) {
+  if (!AreVectorKernelsEnabled()) return sub(vform, dst, src1, src2);
+  LanewiseBinaryOp(vform, dst, src1, src2, LaneSub());
+  return dst;
+}
+
+
 LogicVRegister Simulator::add(VectorFormat vform,
                               LogicVRegister dst,
                               const LogicVRegister& src1,
@@ -695,7 +988,7 @@ LogicVRegister Simulator::mla(VectorFormat vform,
                               const LogicVRegister& src2) {
   SimVRegister temp;
   mul(vform, temp, src1, src2);
-  add(vform, dst, srca, temp);
+  add_nosat(vform, dst, srca, temp);
   return dst;
 }
 
@@ -707,7 +1000,7 @@ LogicVRegister Simulator::mls(VectorFormat vform,
                               const LogicVRegister& src2) {
   SimVRegister temp;
   mul(vform, temp, src1, src2);
-  sub(vform, dst, srca, temp);
+  sub_nosat(vform, dst, srca, temp);
   return dst;
 }
 
@@ -716,8 +1009,12 @@ LogicVRegister Simulator::mul(VectorFormat vform,
                               LogicVRegister dst,
                               const LogicVRegister& src1,
                               const LogicVRegister& src2) {
-  dst.ClearForWrite(vform);
+  if (AreVectorKernelsEnabled()) {
+    LanewiseBinaryOp(vform, dst, src1, src2, LaneMul());
+    return dst;
+  }
 
+  dst.ClearForWrite(vform);
   for (int i = 0; i < LaneCountFromFormat(vform); i++) {
     dst.SetUint(vform, i, src1.Uint(vform, i) * src2.Uint(vform, i));
   }
@@ -1028,6 +1325,11 @@ LogicVRegister Simulator::and_(VectorFormat vform,
                                LogicVRegister dst,
                                const LogicVRegister& src1,
                                const LogicVRegister& src2) {
+  if (AreVectorKernelsEnabled()) {
+    LanewiseBinaryOp(vform, dst, src1, src2, std::bit_and<>());
+    return dst;
+  }
+
   dst.ClearForWrite(vform);
   for (int i = 0; i < LaneCountFromFormat(vform); i++) {
     dst.SetUint(vform, i, src1.Uint(vform, i) & src2.Uint(vform, i));
@@ -1040,6 +1342,11 @@ LogicVRegister Simulator::orr(VectorFormat vform,
                               LogicVRegister dst,
                               const LogicVRegister& src1,
                               const LogicVRegister& src2) {
+  if (AreVectorKernelsEnabled()) {
+    LanewiseBinaryOp(vform, dst, src1, src2, std::bit_or<>());
+    return dst;
+  }
+
   dst.ClearForWrite(vform);
   for (int i = 0; i < LaneCountFromFormat(vform); i++) {
     dst.SetUint(vform, i, src1.Uint(vform, i) | src2.Uint(vform, i));
@@ -1064,6 +1371,11 @@ LogicVRegister Simulator::eor(VectorFormat vform,
                               LogicVRegister dst,
                               const LogicVRegister& src1,
                               const LogicVRegister& src2) {
+  if (AreVectorKernelsEnabled()) {
+    LanewiseBinaryOp(vform, dst, src1, src2, std::bit_xor<>());
+    return dst;
+  }
+
   dst.ClearForWrite(vform);
   for (int i = 0; i < LaneCountFromFormat(vform); i++) {
     dst.SetUint(vform, i, src1.Uint(vform, i) ^ src2.Uint(vform, i));
@@ -1636,6 +1948,10 @@ LogicVRegister Simulator::sel(VectorFormat vform,
                               const SimPRegister& pg,
                               const LogicVRegister& src1,
                               const LogicVRegister& src2) {
+  if (AreVectorKernelsEnabled() && IsSVEFormat(vform)) {
+    SelectLanes(vform, dst, pg, src1, &src2);
+    return dst;
+  }
   int p_reg_bits_per_lane =
       LaneSizeInBitsFromFormat(vform) / kZRegBitsPerPRegBit;
   for (int lane = 0; lane < LaneCountFromFormat(vform); lane++) {
@@ -1652,12 +1968,17 @@ LogicPRegister Simulator::sel(LogicPRegister dst,
                               const LogicPRegister& pg,
                               const LogicPRegister& src1,
                               const LogicPRegister& src2) {
-  for (int i = 0; i < dst.GetChunkCount(); i++) {
-    LogicPRegister::ChunkType mask = pg.GetChunk(i);
-    LogicPRegister::ChunkType result =
-        (mask & src1.GetChunk(i)) | (~mask & src2.GetChunk(i));
-    dst.SetChunk(i, result);
+  unsigned size = dst.GetSizeInBytes();
+  uint64_t mask[LogicPRegister::kMaxWordCount];
+  uint64_t words1[LogicPRegister::kMaxWordCount];
+  uint64_t words2[LogicPRegister::kMaxWordCount];
+  pg.GetWords(mask, size);
+  src1.GetWords(words1, size);
+  src2.GetWords(words2, size);
+  for (int i = 0; i < LogicPRegister::GetWordCount(size); i++) {
+    words1[i] = (mask[i] & words1[i]) | (~mask[i] & words2[i]);
   }
+  dst.SetWords(words1, size);
   return dst;
 }
 
@@ -3046,6 +3367,10 @@ LogicVRegister Simulator::mov_zeroing(VectorFormat vform,
                                       LogicVRegister dst,
                                       const SimPRegister& pg,
                                       const LogicVRegister& src) {
+  if (AreVectorKernelsEnabled() && IsSVEFormat(vform)) {
+    SelectLanes(vform, dst, pg, src, NULL);
+    return dst;
+  }
   SimVRegister zero;
   dup_immediate(vform, zero, 0);
   return sel(vform, dst, pg, src, zero);
@@ -6400,6 +6725,44 @@ LogicVRegister Simulator::urecpe(VectorFormat vform,
   return dst;
 }
 
+// Return a word with the predicate bit that governs each lane of `vform` set.
+static uint64_t GetPredicateLaneMask(VectorFormat vform) {
+  switch (LaneSizeInBytesFromFormat(vform)) {
+    case 1:
+      return UINT64_C(0xffffffffffffffff);
+    case 2:
+      return UINT64_C(0x5555555555555555);
+    case 4:
+      return UINT64_C(0x1111111111111111);
+    case 8:
+      return UINT64_C(0x0101010101010101);
+    case 16:
+      return UINT64_C(0x0001000100010001);
+    default:
+      VIXL_UNREACHABLE();
+      return 0;
+  }
+}
+
+// Return the bits of predicate word `index` that fall within predicate bits
+// [begin, end).
+static uint64_t GetWordBitRange(int index, int begin, int end) {
+  const int kWordBits = 64;
+  int base = index * kWordBits;
+  int low = std::min(std::max(begin - base, 0), kWordBits);
+  int high = std::min(std::max(end - base, 0), kWordBits);
+  return GetUintMask(high) & ~GetUintMask(low);
+}
+
+// Return the index of the lowest set bit in `words`, or the number of bits in
+// `words` if none are set.
+static int GetFirstSetBit(const uint64_t* words, int word_count) {
+  for (int i = 0; i < word_count; i++) {
+    if (words[i] != 0) return (i * 64) + CountTrailingZeros(words[i]);
+  }
+  return word_count * 64;
+}
+
 LogicPRegister Simulator::pfalse(LogicPRegister dst) {
   dst.Clear();
   return dst;
@@ -6419,9 +6782,7 @@ LogicPRegister Simulator::ptrue(VectorFormat vform,
                                 LogicPRegister dst,
                                 int pattern) {
   int count = GetPredicateConstraintLaneCount(vform, pattern);
-  for (int i = 0; i < LaneCountFromFormat(vform); i++) {
-    dst.SetActive(vform, i, i < count);
-  }
+  SetActiveLaneRange(vform, dst, 0, count);
   return dst;
 }
 
@@ -6429,15 +6790,22 @@ LogicPRegister Simulator::pnext(VectorFormat vform,
                                 LogicPRegister dst,
                                 const LogicPRegister& pg,
                                 const LogicPRegister& src) {
+  int lane_size = LaneSizeInBytesFromFormat(vform);
+  int lane_count = LaneCountFromFormat(vform);
   int next = GetLastActive(vform, src) + 1;
-  while (next < LaneCountFromFormat(vform)) {
-    if (pg.IsActive(vform, next)) break;
-    next++;
-  }
 
-  for (int i = 0; i < LaneCountFromFormat(vform); i++) {
-    dst.SetActive(vform, i, (i == next));
+  // Find the first active lane in `pg` at or after `next`.
+  uint64_t words[LogicPRegister::kMaxWordCount];
+  int word_count = GetPredicateLaneWords(vform, pg, words);
+  for (int i = 0; i < word_count; i++) {
+    words[i] &= ~GetWordBitRange(i, 0, next * lane_size);
   }
+  next = GetFirstSetBit(words, word_count) / lane_size;
+
+  SetActiveLaneRange(vform,
+                     dst,
+                     std::min(next, lane_count),
+                     std::min(next + 1, lane_count));
   return dst;
 }
 
@@ -7165,10 +7533,15 @@ LogicPRegister Simulator::SVEPredicateLogicalHelper(SVEPredicateLogicalOp op,
                                                     LogicPRegister pd,
                                                     const LogicPRegister& pn,
                                                     const LogicPRegister& pm) {
-  for (int i = 0; i < pn.GetChunkCount(); i++) {
-    LogicPRegister::ChunkType op1 = pn.GetChunk(i);
-    LogicPRegister::ChunkType op2 = pm.GetChunk(i);
-    LogicPRegister::ChunkType result = 0;
+  unsigned size = pn.GetSizeInBytes();
+  uint64_t words1[LogicPRegister::kMaxWordCount];
+  uint64_t words2[LogicPRegister::kMaxWordCount];
+  pn.GetWords(words1, size);
+  pm.GetWords(words2, size);
+  for (int i = 0; i < LogicPRegister::GetWordCount(size); i++) {
+    uint64_t op1 = words1[i];
+    uint64_t op2 = words2[i];
+    uint64_t result = 0;
     switch (op) {
       case ANDS_p_p_pp_z:
       case AND_p_p_pp_z:
@@ -7201,8 +7574,9 @@ LogicPRegister Simulator::SVEPredicateLogicalHelper(SVEPredicateLogicalOp op,
       default:
         VIXL_UNIMPLEMENTED();
     }
-    pd.SetChunk(i, result);
+    words1[i] = result;
   }
+  pd.SetWords(words1, size);
   return pd;
 }
 
@@ -7356,28 +7730,18 @@ void Simulator::SVEStructuredLoadHelper(VectorFormat vform,
 LogicPRegister Simulator::brka(LogicPRegister pd,
                                const LogicPRegister& pg,
                                const LogicPRegister& pn) {
-  bool break_ = false;
-  for (int i = 0; i < LaneCountFromFormat(kFormatVnB); i++) {
-    if (pg.IsActive(kFormatVnB, i)) {
-      pd.SetActive(kFormatVnB, i, !break_);
-      break_ |= pn.IsActive(kFormatVnB, i);
-    }
-  }
-
+  // Active lanes up to and including the first active lane that is true in
+  // `pn` are set. The remaining active lanes are cleared.
+  PartitionBreak(pd, pg, pn, true);
   return pd;
 }
 
 LogicPRegister Simulator::brkb(LogicPRegister pd,
                                const LogicPRegister& pg,
                                const LogicPRegister& pn) {
-  bool break_ = false;
-  for (int i = 0; i < LaneCountFromFormat(kFormatVnB); i++) {
-    if (pg.IsActive(kFormatVnB, i)) {
-      break_ |= pn.IsActive(kFormatVnB, i);
-      pd.SetActive(kFormatVnB, i, !break_);
-    }
-  }
-
+  // Active lanes before the first active lane that is true in `pn` are set.
+  // The remaining active lanes are cleared.
+  PartitionBreak(pd, pg, pn, false);
   return pd;
 }
 
@@ -7394,36 +7758,24 @@ LogicPRegister Simulator::brkpa(LogicPRegister pd,
                                 const LogicPRegister& pg,
                                 const LogicPRegister& pn,
                                 const LogicPRegister& pm) {
-  bool last_active = IsLastActive(kFormatVnB, pg, pn);
-
-  for (int i = 0; i < LaneCountFromFormat(kFormatVnB); i++) {
-    bool active = false;
-    if (pg.IsActive(kFormatVnB, i)) {
-      active = last_active;
-      last_active = last_active && !pm.IsActive(kFormatVnB, i);
-    }
-    pd.SetActive(kFormatVnB, i, active);
+  SimPRegister result;
+  if (IsLastActive(kFormatVnB, pg, pn)) {
+    PartitionBreak(result, pg, pm, true);
   }
-
-  return pd;
+  // Inactive lanes are always cleared.
+  return mov_zeroing(pd, pg, result);
 }
 
 LogicPRegister Simulator::brkpb(LogicPRegister pd,
                                 const LogicPRegister& pg,
                                 const LogicPRegister& pn,
                                 const LogicPRegister& pm) {
-  bool last_active = IsLastActive(kFormatVnB, pg, pn);
-
-  for (int i = 0; i < LaneCountFromFormat(kFormatVnB); i++) {
-    bool active = false;
-    if (pg.IsActive(kFormatVnB, i)) {
-      last_active = last_active && !pm.IsActive(kFormatVnB, i);
-      active = last_active;
-    }
-    pd.SetActive(kFormatVnB, i, active);
+  SimPRegister result;
+  if (IsLastActive(kFormatVnB, pg, pn)) {
+    PartitionBreak(result, pg, pm, false);
   }
-
-  return pd;
+  // Inactive lanes are always cleared.
+  return mov_zeroing(pd, pg, result);
 }
 
 void Simulator::SVEFaultTolerantLoadHelper(VectorFormat vform,
@@ -7542,27 +7894,87 @@ void Simulator::SVEGatherLoadScalarPlusVectorHelper(const Instruction* instr,
   }
 }
 
+int Simulator::GetPredicateLaneWords(VectorFormat vform,
+                                     const LogicPRegister& pg,
+                                     uint64_t* words) const {
+  unsigned size = GetPredicateLengthInBytes();
+  pg.GetWords(words, size);
+  uint64_t lane_mask = GetPredicateLaneMask(vform);
+  int word_count = LogicPRegister::GetWordCount(size);
+  for (int i = 0; i < word_count; i++) {
+    words[i] &= lane_mask;
+  }
+  return word_count;
+}
+
+void Simulator::SetActiveLaneRange(VectorFormat vform,
+                                   LogicPRegister pd,
+                                   int begin,
+                                   int end) {
+  VIXL_ASSERT((0 <= begin) && (begin <= end));
+  VIXL_ASSERT(end <= LaneCountFromFormat(vform));
+  int lane_size = LaneSizeInBytesFromFormat(vform);
+  uint64_t lane_mask = GetPredicateLaneMask(vform);
+  unsigned size = GetPredicateLengthInBytes();
+  uint64_t words[LogicPRegister::kMaxWordCount];
+  for (int i = 0; i < LogicPRegister::GetWordCount(size); i++) {
+    words[i] =
+        GetWordBitRange(i, begin * lane_size, end * lane_size) & lane_mask;
+  }
+  pd.SetWords(words, size);
+}
+
+void Simulator::PartitionBreak(LogicPRegister pd,
+                               const LogicPRegister& pg,
+                               const LogicPRegister& pn,
+                               bool include_break) {
+  uint64_t active[LogicPRegister::kMaxWordCount];
+  uint64_t breaks[LogicPRegister::kMaxWordCount];
+  uint64_t result[LogicPRegister::kMaxWordCount];
+  int word_count = GetPredicateLaneWords(kFormatVnB, pg, active);
+  GetPredicateLaneWords(kFormatVnB, pn, breaks);
+  GetPredicateLaneWords(kFormatVnB, pd, result);
+  for (int i = 0; i < word_count; i++) {
+    breaks[i] &= active[i];
+  }
+
+  int end = GetFirstSetBit(breaks, word_count) + (include_break ? 1 : 0);
+  for (int i = 0; i < word_count; i++) {
+    result[i] =
+        (result[i] & ~active[i]) | (active[i] & GetWordBitRange(i, 0, end));
+  }
+  pd.SetWords(result, GetPredicateLengthInBytes());
+}
+
 int Simulator::GetFirstActive(VectorFormat vform,
                               const LogicPRegister& pg) const {
-  for (int i = 0; i < LaneCountFromFormat(vform); i++) {
-    if (pg.IsActive(vform, i)) return i;
-  }
-  return -1;
+  uint64_t words[LogicPRegister::kMaxWordCount];
+  int word_count = GetPredicateLaneWords(vform, pg, words);
+  int first = GetFirstSetBit(words, word_count);
+  if (first == (word_count * 64)) return -1;
+  return first / LaneSizeInBytesFromFormat(vform);
 }
 
 int Simulator::GetLastActive(VectorFormat vform,
                              const LogicPRegister& pg) const {
-  for (int i = LaneCountFromFormat(vform) - 1; i >= 0; i--) {
-    if (pg.IsActive(vform, i)) return i;
+  uint64_t words[LogicPRegister::kMaxWordCount];
+  int word_count = GetPredicateLaneWords(vform, pg, words);
+  for (int i = word_count - 1; i >= 0; i--) {
+    if (words[i] != 0) {
+      int last = (i * 64) + 63 - CountLeadingZeros(words[i]);
+      return last / LaneSizeInBytesFromFormat(vform);
+    }
   }
   return -1;
 }
 
 int Simulator::CountActiveLanes(VectorFormat vform,
                                 const LogicPRegister& pg) const {
+  uint64_t words[LogicPRegister::kMaxWordCount];
+  int word_count = GetPredicateLaneWords(vform, pg, words);
   int count = 0;
-  for (int i = 0; i < LaneCountFromFormat(vform); i++) {
-    count += pg.IsActive(vform, i) ? 1 : 0;
+  for (int i = 0; i < word_count; i++) {
+    count += CountSetBits(words[i]);
   }
   return count;
 }
@@ -7570,9 +7982,13 @@ int Simulator::CountActiveLanes(VectorFormat vform,
 int Simulator::CountActiveAndTrueLanes(VectorFormat vform,
                                        const LogicPRegister& pg,
                                        const LogicPRegister& pn) const {
+  uint64_t active[LogicPRegister::kMaxWordCount];
+  uint64_t bits[LogicPRegister::kMaxWordCount];
+  int word_count = GetPredicateLaneWords(vform, pg, active);
+  GetPredicateLaneWords(vform, pn, bits);
   int count = 0;
-  for (int i = 0; i < LaneCountFromFormat(vform); i++) {
-    count += (pg.IsActive(vform, i) && pn.IsActive(vform, i)) ? 1 : 0;
+  for (int i = 0; i < word_count; i++) {
+    count += CountSetBits(active[i] & bits[i]);
   }
   return count;
 }
@@ -69,10 +69,16 @@ void LiteralPool::Reset() {
   for (it = entries_.begin(), end = entries_.end(); it != end; ++it) {
     RawLiteral* literal = *it;
     if (literal->deletion_policy_ == RawLiteral::kDeletedOnPlacementByPool) {
-      delete literal;
+      if (masm_->GetArena()->Contains(literal)) {
+        // Literals created by GetSharedLiteral() live in the arena.
+        literal->~RawLiteral();
+      } else {
+        delete literal;
+      }
     }
   }
   entries_.clear();
+  shared_literals_.clear();
   size_ = 0;
   first_use_ = -1;
   Pool::Reset();
@@ -174,6 +180,41 @@ void LiteralPool::AddEntry(RawLiteral* literal) {
 }
 
 
+RawLiteral* LiteralPool::GetSharedLiteral(size_t size,
+                                          uint64_t high64,
+                                          uint64_t low64) {
+  SharedLiteralKey key = {size, high64, low64};
+  std::unordered_map<SharedLiteralKey, RawLiteral*, SharedLiteralKeyHash>::
+      const_iterator it = shared_literals_.find(key);
+  if (it != shared_literals_.end()) {
+    // The literal has already been used, so it is in the pool.
+    VIXL_ASSERT(it->second->IsUsed());
+    return it->second;
+  }
+
+  Arena* arena = masm_->GetArena();
+  RawLiteral::DeletionPolicy policy = RawLiteral::kDeletedOnPlacementByPool;
+  RawLiteral* literal;
+  switch (size) {
+    case kWRegSizeInBytes:
+      VIXL_ASSERT(high64 == 0);
+      literal = arena->New<Literal<uint32_t> >(static_cast<uint32_t>(low64),
+                                               this,
+                                               policy);
+      break;
+    case kXRegSizeInBytes:
+      VIXL_ASSERT(high64 == 0);
+      literal = arena->New<Literal<uint64_t> >(low64, this, policy);
+      break;
+    default:
+      VIXL_ASSERT(size == kQRegSizeInBytes);
+      literal = arena->New<Literal<uint64_t> >(high64, low64, this, policy);
+  }
+  shared_literals_[key] = literal;
+  return literal;
+}
+
+
 void LiteralPool::UpdateFirstUse(ptrdiff_t use_position) {
   first_use_ = std::min(first_use_, use_position);
   if (first_use_ == -1) {
@@ -324,6 +365,7 @@ MacroAssembler::MacroAssembler(PositionIndependentCodeOption pic)
       v_tmp_list_(d31),
       p_tmp_list_(CPURegList::Empty(CPURegister::kPRegister)),
       current_scratch_scope_(NULL),
+      arena_(),
       literal_pool_(this),
       veneer_pool_(this),
       recommended_checkpoint_(Pool::kNoCheckpointRequired),
@@ -347,6 +389,7 @@ MacroAssembler::MacroAssembler(size_t capacity,
       v_tmp_list_(d31),
       p_tmp_list_(CPURegList::Empty(CPURegister::kPRegister)),
       current_scratch_scope_(NULL),
+      arena_(),
       literal_pool_(this),
       veneer_pool_(this),
       recommended_checkpoint_(Pool::kNoCheckpointRequired),
@@ -368,6 +411,29 @@ MacroAssembler::MacroAssembler(byte* buffer,
       v_tmp_list_(d31),
       p_tmp_list_(CPURegList::Empty(CPURegister::kPRegister)),
       current_scratch_scope_(NULL),
+      arena_(),
+      literal_pool_(this),
+      veneer_pool_(this),
+      recommended_checkpoint_(Pool::kNoCheckpointRequired),
+      fp_nan_propagation_(NoFPMacroNaNPropagationSelected) {
+  checkpoint_ = GetNextCheckPoint();
+}
+
+
+MacroAssembler::MacroAssembler(CodeSpace* space,
+                               size_t capacity,
+                               PositionIndependentCodeOption pic)
+    : Assembler(space, capacity, pic),
+#ifdef VIXL_DEBUG
+      allow_macro_instructions_(true),
+#endif
+      generate_simulator_code_(VIXL_AARCH64_GENERATE_SIMULATOR_CODE),
+      sp_(sp),
+      tmp_list_(ip0, ip1),
+      v_tmp_list_(d31),
+      p_tmp_list_(CPURegList::Empty(CPURegister::kPRegister)),
+      current_scratch_scope_(NULL),
+      arena_(),
       literal_pool_(this),
       veneer_pool_(this),
       recommended_checkpoint_(Pool::kNoCheckpointRequired),
@@ -385,6 +451,7 @@ void MacroAssembler::Reset() {
   VIXL_ASSERT(!literal_pool_.IsBlocked());
   literal_pool_.Reset();
   veneer_pool_.Reset();
+  arena_.Reset();
 
   checkpoint_ = GetNextCheckPoint();
 }
@@ -398,6 +465,8 @@ void MacroAssembler::FinalizeCode(FinalizeOption option) {
                                               : Pool::kBranchRequired);
   }
   VIXL_ASSERT(veneer_pool_.IsEmpty());
+  // The literal pool has been emitted, so nothing in the arena is live.
+  arena_.Reset();
 
   Assembler::FinalizeCode();
 }
@@ -1531,10 +1600,7 @@ void MacroAssembler::Fmov(VRegister vd, double imm) {
       if (rawbits == 0) {
         fmov(vd, xzr);
       } else {
-        ldr(vd,
-            new Literal<double>(imm,
-                                &literal_pool_,
-                                RawLiteral::kDeletedOnPlacementByPool));
+        ldr(vd, literal_pool_.GetSharedLiteral(imm));
       }
     } else {
       // TODO: consider NEON support for load literal.
@@ -1568,10 +1634,7 @@ void MacroAssembler::Fmov(VRegister vd, float imm) {
       if (rawbits == 0) {
         fmov(vd, wzr);
       } else {
-        ldr(vd,
-            new Literal<float>(imm,
-                               &literal_pool_,
-                               RawLiteral::kDeletedOnPlacementByPool));
+        ldr(vd, literal_pool_.GetSharedLiteral(imm));
       }
     } else {
       // TODO: consider NEON support for load literal.
@@ -29,7 +29,10 @@
 
 #include <algorithm>
 #include <limits>
+#include <unordered_map>
+#include <vector>
 
+#include "../arena-vixl.h"
 #include "../code-generation-scopes-vixl.h"
 #include "../globals-vixl.h"
 #include "../macro-assembler-interface.h"
@@ -143,10 +146,46 @@ class LiteralPool : public Pool {
     deleted_on_destruction_.push_back(literal);
   }
 
+  // Return a literal holding `value`, owned by the pool. Until the pool is
+  // next emitted, every request for the same bit pattern (of the same size)
+  // returns the same literal, so repeated constants share one pool entry. The
+  // literal must be used by a load emitted immediately afterwards.
+  template <typename T>
+  RawLiteral* GetSharedLiteral(T value) {
+    VIXL_STATIC_ASSERT((sizeof(value) == kWRegSizeInBytes) ||
+                       (sizeof(value) == kXRegSizeInBytes));
+    uint64_t raw = 0;
+    memcpy(&raw, &value, sizeof(value));
+    return GetSharedLiteral(sizeof(value), 0, raw);
+  }
+  RawLiteral* GetSharedLiteral(uint64_t high64, uint64_t low64) {
+    return GetSharedLiteral(kQRegSizeInBytes, high64, low64);
+  }
+
   // Recommended not exact since the pool can be blocked for short periods.
   static const ptrdiff_t kRecommendedLiteralPoolRange = 128 * KBytes;
 
  private:
+  RawLiteral* GetSharedLiteral(size_t size, uint64_t high64, uint64_t low64);
+
+  struct SharedLiteralKey {
+    bool operator==(const SharedLiteralKey& other) const {
+      return (size == other.size) && (high64 == other.high64) &&
+             (low64 == other.low64);
+    }
+
+    size_t size;
+    uint64_t high64;
+    uint64_t low64;
+  };
+
+  struct SharedLiteralKeyHash {
+    size_t operator()(const SharedLiteralKey& key) const {
+      uint64_t hash = key.low64 ^ (key.high64 * UINT64_C(0x9e3779b97f4a7c15));
+      return std::hash<uint64_t>()(hash) ^ key.size;
+    }
+  };
+
   std::vector<RawLiteral*> entries_;
   size_t size_;
   ptrdiff_t first_use_;
@@ -158,6 +197,11 @@ class LiteralPool : public Pool {
   ptrdiff_t recommended_checkpoint_;
 
   std::vector<RawLiteral*> deleted_on_destruction_;
+
+  // The literals returned by GetSharedLiteral() since the pool was last
+  // emitted, indexed by their size and value.
+  std::unordered_map<SharedLiteralKey, RawLiteral*, SharedLiteralKeyHash>
+      shared_literals_;
 };
 
 
@@ -202,41 +246,6 @@ class VeneerPool : public Pool {
           pc_offset_ + Instruction::GetImmBranchForwardRange(branch_type_);
     }
 
-    static bool IsValidComparison(const BranchInfo& branch_1,
-                                  const BranchInfo& branch_2) {
-      // BranchInfo are always compared against against other objects with
-      // the same branch type.
-      if (branch_1.branch_type_ != branch_2.branch_type_) {
-        return false;
-      }
-      // Since we should never have two branch infos with the same offsets, it
-      // first looks like we should check that offsets are different. However
-      // the operators may also be used to *search* for a branch info in the
-      // set.
-      bool same_offsets = (branch_1.pc_offset_ == branch_2.pc_offset_);
-      return (!same_offsets || ((branch_1.label_ == branch_2.label_) &&
-                                (branch_1.first_unreacheable_pc_ ==
-                                 branch_2.first_unreacheable_pc_)));
-    }
-
-    // We must provide comparison operators to work with InvalSet.
-    bool operator==(const BranchInfo& other) const {
-      VIXL_ASSERT(IsValidComparison(*this, other));
-      return pc_offset_ == other.pc_offset_;
-    }
-    bool operator<(const BranchInfo& other) const {
-      VIXL_ASSERT(IsValidComparison(*this, other));
-      return pc_offset_ < other.pc_offset_;
-    }
-    bool operator<=(const BranchInfo& other) const {
-      VIXL_ASSERT(IsValidComparison(*this, other));
-      return pc_offset_ <= other.pc_offset_;
-    }
-    bool operator>(const BranchInfo& other) const {
-      VIXL_ASSERT(IsValidComparison(*this, other));
-      return pc_offset_ > other.pc_offset_;
-    }
-
     // First instruction position that is not reachable by the branch using a
     // positive branch offset.
     ptrdiff_t first_unreacheable_pc_;
@@ -294,45 +303,130 @@ class VeneerPool : public Pool {
     return GetOtherPoolsMaxSize();
   }
 
-  static const int kNPreallocatedInfos = 4;
   static const ptrdiff_t kInvalidOffset = PTRDIFF_MAX;
-  static const size_t kReclaimFrom = 128;
-  static const size_t kReclaimFactor = 16;
 
  private:
-  typedef InvalSet<BranchInfo,
-                   kNPreallocatedInfos,
-                   ptrdiff_t,
-                   kInvalidOffset,
-                   kReclaimFrom,
-                   kReclaimFactor>
-      BranchInfoTypedSetBase;
-  typedef InvalSetIterator<BranchInfoTypedSetBase> BranchInfoTypedSetIterBase;
-
-  class BranchInfoTypedSet : public BranchInfoTypedSetBase {
+  class BranchInfoSetIterator;
+
+  // The unresolved branches of a single type.
+  //
+  // All branches of a given type have the same forward range, and they are
+  // registered in the order in which they are emitted, so sorting them by
+  // offset also sorts them by limit. This means that a plain vector, appended
+  // to in order, can serve as a priority queue: the first limit is always at
+  // the head, and a branch can be found with a binary search.
+  //
+  // Deleted branches are marked as such and skipped. They are dropped when
+  // they reach the head of the queue, or all at once when they make up most of
+  // it.
+  class BranchInfoQueue {
    public:
-    BranchInfoTypedSet() : BranchInfoTypedSetBase() {}
+    BranchInfoQueue() : head_(0), size_(0) {}
+
+    void insert(const BranchInfo& branch_info) {
+      VIXL_ASSERT(branch_info.label_ != NULL);
+      MaybeReclaim();
+      if (infos_.empty() ||
+          (infos_.back().pc_offset_ < branch_info.pc_offset_)) {
+        // This is the common case.
+        infos_.push_back(branch_info);
+      } else {
+        std::vector<BranchInfo>::iterator it = Find(branch_info.pc_offset_);
+        VIXL_ASSERT((it == infos_.end()) ||
+                    (it->pc_offset_ != branch_info.pc_offset_) ||
+                    IsDeleted(*it));
+        infos_.insert(it, branch_info);
+      }
+      size_++;
+    }
 
-    ptrdiff_t GetFirstLimit() {
-      if (empty()) {
-        return kInvalidOffset;
+    // Erase the branch at `pc_offset`, if it is present.
+    void erase(ptrdiff_t pc_offset) {
+      std::vector<BranchInfo>::iterator it = Find(pc_offset);
+      if ((it == infos_.end()) || (it->pc_offset_ != pc_offset) ||
+          IsDeleted(*it)) {
+        return;
       }
-      return GetMinElementKey();
+      Delete(static_cast<size_t>(it - infos_.begin()));
+      MaybeReclaim();
     }
-    VIXL_DEPRECATED("GetFirstLimit", ptrdiff_t FirstLimit()) {
-      return GetFirstLimit();
+
+    size_t GetSize() const { return size_; }
+    bool IsEmpty() const { return size_ == 0; }
+
+    ptrdiff_t GetFirstLimit() const {
+      if (IsEmpty()) return kInvalidOffset;
+      VIXL_ASSERT(!IsDeleted(infos_[head_]));
+      return infos_[head_].first_unreacheable_pc_;
     }
-  };
 
-  class BranchInfoTypedSetIterator : public BranchInfoTypedSetIterBase {
-   public:
-    BranchInfoTypedSetIterator() : BranchInfoTypedSetIterBase(NULL) {}
-    explicit BranchInfoTypedSetIterator(BranchInfoTypedSet* typed_set)
-        : BranchInfoTypedSetIterBase(typed_set) {}
+    void clear() {
+      infos_.clear();
+      head_ = 0;
+      size_ = 0;
+    }
+
+   private:
+    static bool IsDeleted(const BranchInfo& branch_info) {
+      return branch_info.label_ == NULL;
+    }
+
+    static bool IsBefore(const BranchInfo& branch_info, ptrdiff_t pc_offset) {
+      return branch_info.pc_offset_ < pc_offset;
+    }
+
+    // Return the first entry at or after `pc_offset`.
+    std::vector<BranchInfo>::iterator Find(ptrdiff_t pc_offset) {
+      return std::lower_bound(infos_.begin() + head_,
+                              infos_.end(),
+                              pc_offset,
+                              IsBefore);
+    }
 
-    // TODO: Remove these and use the STL-like interface instead.
-    using BranchInfoTypedSetIterBase::Advance;
-    using BranchInfoTypedSetIterBase::Current;
+    // Return the index of the first live entry at or after `index`.
+    size_t Skip(size_t index) const {
+      while ((index < infos_.size()) && IsDeleted(infos_[index])) index++;
+      return index;
+    }
+
+    // Delete the entry at `index`. Deleted entries are dropped straight away
+    // from either end of the queue.
+    void Delete(size_t index) {
+      VIXL_ASSERT(!IsDeleted(infos_[index]));
+      infos_[index].label_ = NULL;
+      size_--;
+
+      if (IsEmpty()) {
+        clear();
+        return;
+      }
+      if (index == head_) head_ = Skip(head_ + 1);
+      while (IsDeleted(infos_.back())) infos_.pop_back();
+    }
+
+    // Reclaim the space used by deleted entries once they make up most of the
+    // queue. This keeps every operation amortised O(1), or O(log n) for
+    // searches.
+    void MaybeReclaim() {
+      size_t dead = infos_.size() - size_;
+      if ((dead > kReclaimFrom) && (dead > (size_ * kReclaimFactor))) {
+        infos_.erase(std::remove_if(infos_.begin(), infos_.end(), IsDeleted),
+                     infos_.end());
+        head_ = 0;
+      }
+    }
+
+    static const size_t kReclaimFrom = 128;
+    static const size_t kReclaimFactor = 2;
+
+    // The branches, sorted by offset.
+    std::vector<BranchInfo> infos_;
+    // The index of the first live entry, or `infos_.size()`.
+    size_t head_;
+    // The number of live entries.
+    size_t size_;
+
+    friend class BranchInfoSetIterator;
   };
 
   class BranchInfoSet {
@@ -340,21 +434,21 @@ class VeneerPool : public Pool {
     void insert(BranchInfo branch_info) {
       ImmBranchType type = branch_info.branch_type_;
       VIXL_ASSERT(IsValidBranchType(type));
-      typed_set_[BranchIndexFromType(type)].insert(branch_info);
+      queues_[BranchIndexFromType(type)].insert(branch_info);
     }
 
     void erase(BranchInfo branch_info) {
       if (IsValidBranchType(branch_info.branch_type_)) {
         int index =
             BranchInfoSet::BranchIndexFromType(branch_info.branch_type_);
-        typed_set_[index].erase(branch_info);
+        queues_[index].erase(branch_info.pc_offset_);
       }
     }
 
     size_t GetSize() const {
       size_t res = 0;
       for (int i = 0; i < kNumberOfTrackedBranchTypes; i++) {
-        res += typed_set_[i].size();
+        res += queues_[i].GetSize();
       }
       return res;
     }
@@ -362,7 +456,7 @@ class VeneerPool : public Pool {
 
     bool IsEmpty() const {
       for (int i = 0; i < kNumberOfTrackedBranchTypes; i++) {
-        if (!typed_set_[i].empty()) {
+        if (!queues_[i].IsEmpty()) {
           return false;
         }
       }
@@ -370,20 +464,20 @@ class VeneerPool : public Pool {
     }
     VIXL_DEPRECATED("IsEmpty", bool empty() const) { return IsEmpty(); }
 
-    ptrdiff_t GetFirstLimit() {
+    ptrdiff_t GetFirstLimit() const {
       ptrdiff_t res = kInvalidOffset;
       for (int i = 0; i < kNumberOfTrackedBranchTypes; i++) {
-        res = std::min(res, typed_set_[i].GetFirstLimit());
+        res = std::min(res, queues_[i].GetFirstLimit());
       }
       return res;
     }
-    VIXL_DEPRECATED("GetFirstLimit", ptrdiff_t FirstLimit()) {
+    VIXL_DEPRECATED("GetFirstLimit", ptrdiff_t FirstLimit() const) {
       return GetFirstLimit();
     }
 
     void Reset() {
       for (int i = 0; i < kNumberOfTrackedBranchTypes; i++) {
-        typed_set_[i].clear();
+        queues_[i].clear();
       }
     }
 
@@ -421,73 +515,67 @@ class VeneerPool : public Pool {
 
    private:
     static const int kNumberOfTrackedBranchTypes = 3;
-    BranchInfoTypedSet typed_set_[kNumberOfTrackedBranchTypes];
+    BranchInfoQueue queues_[kNumberOfTrackedBranchTypes];
 
     friend class VeneerPool;
     friend class BranchInfoSetIterator;
   };
 
+  // Iterate through the branches, type by type, in increasing limit order.
   class BranchInfoSetIterator {
    public:
-    explicit BranchInfoSetIterator(BranchInfoSet* set) : set_(set) {
-      for (int i = 0; i < BranchInfoSet::kNumberOfTrackedBranchTypes; i++) {
-        new (&sub_iterator_[i])
-            BranchInfoTypedSetIterator(&(set_->typed_set_[i]));
-      }
+    explicit BranchInfoSetIterator(BranchInfoSet* set) : set_(set), type_(0) {
+      index_ = GetQueue()->head_;
+      SkipFinishedTypes();
     }
 
     VeneerPool::BranchInfo* Current() {
-      for (int i = 0; i < BranchInfoSet::kNumberOfTrackedBranchTypes; i++) {
-        if (!sub_iterator_[i].Done()) {
-          return sub_iterator_[i].Current();
-        }
-      }
-      VIXL_UNREACHABLE();
-      return NULL;
+      VIXL_ASSERT(!Done());
+      return &GetQueue()->infos_[index_];
     }
 
     void Advance() {
       VIXL_ASSERT(!Done());
-      for (int i = 0; i < BranchInfoSet::kNumberOfTrackedBranchTypes; i++) {
-        if (!sub_iterator_[i].Done()) {
-          sub_iterator_[i].Advance();
-          return;
-        }
-      }
-      VIXL_UNREACHABLE();
+      index_ = GetQueue()->Skip(index_ + 1);
+      SkipFinishedTypes();
     }
 
     bool Done() const {
-      for (int i = 0; i < BranchInfoSet::kNumberOfTrackedBranchTypes; i++) {
-        if (!sub_iterator_[i].Done()) return false;
-      }
-      return true;
+      return type_ == BranchInfoSet::kNumberOfTrackedBranchTypes;
     }
 
     void AdvanceToNextType() {
       VIXL_ASSERT(!Done());
-      for (int i = 0; i < BranchInfoSet::kNumberOfTrackedBranchTypes; i++) {
-        if (!sub_iterator_[i].Done()) {
-          sub_iterator_[i].Finish();
-          return;
-        }
-      }
-      VIXL_UNREACHABLE();
+      index_ = GetQueue()->infos_.size();
+      SkipFinishedTypes();
     }
 
     void DeleteCurrentAndAdvance() {
-      for (int i = 0; i < BranchInfoSet::kNumberOfTrackedBranchTypes; i++) {
-        if (!sub_iterator_[i].Done()) {
-          sub_iterator_[i].DeleteCurrentAndAdvance();
-          return;
-        }
-      }
+      VIXL_ASSERT(!Done());
+      BranchInfoQueue* queue = GetQueue();
+      queue->Delete(index_);
+      // This never reclaims space, so the indices stay valid.
+      index_ = queue->Skip(index_ + 1);
+      SkipFinishedTypes();
     }
 
    private:
+    BranchInfoQueue* GetQueue() const {
+      VIXL_ASSERT(!Done());
+      return &set_->queues_[type_];
+    }
+
+    void SkipFinishedTypes() {
+      while (index_ >= GetQueue()->infos_.size()) {
+        type_++;
+        if (Done()) return;
+        index_ = GetQueue()->head_;
+      }
+    }
+
     BranchInfoSet* set_;
-    BranchInfoTypedSetIterator
-        sub_iterator_[BranchInfoSet::kNumberOfTrackedBranchTypes];
+    int type_;
+    size_t index_;
   };
 
   ptrdiff_t GetNextCheckPoint() {
@@ -671,6 +759,9 @@ class MacroAssembler : public Assembler, public MacroAssemblerInterface {
   MacroAssembler(byte* buffer,
                  size_t capacity,
                  PositionIndependentCodeOption pic = PositionIndependentCode);
+  MacroAssembler(CodeSpace* space,
+                 size_t capacity,
+                 PositionIndependentCodeOption pic = PositionIndependentCode);
   ~MacroAssembler();
 
   enum FinalizeOption {
@@ -1921,13 +2012,9 @@ class MacroAssembler : public Assembler, public MacroAssemblerInterface {
     SingleEmissionCheckScope guard(this);
     RawLiteral* literal;
     if (vt.IsD()) {
-      literal = new Literal<double>(imm,
-                                    &literal_pool_,
-                                    RawLiteral::kDeletedOnPlacementByPool);
+      literal = literal_pool_.GetSharedLiteral(imm);
     } else {
-      literal = new Literal<float>(static_cast<float>(imm),
-                                   &literal_pool_,
-                                   RawLiteral::kDeletedOnPlacementByPool);
+      literal = literal_pool_.GetSharedLiteral(static_cast<float>(imm));
     }
     ldr(vt, literal);
   }
@@ -1936,13 +2023,9 @@ class MacroAssembler : public Assembler, public MacroAssemblerInterface {
     SingleEmissionCheckScope guard(this);
     RawLiteral* literal;
     if (vt.IsS()) {
-      literal = new Literal<float>(imm,
-                                   &literal_pool_,
-                                   RawLiteral::kDeletedOnPlacementByPool);
+      literal = literal_pool_.GetSharedLiteral(imm);
     } else {
-      literal = new Literal<double>(static_cast<double>(imm),
-                                    &literal_pool_,
-                                    RawLiteral::kDeletedOnPlacementByPool);
+      literal = literal_pool_.GetSharedLiteral(static_cast<double>(imm));
     }
     ldr(vt, literal);
   }
@@ -1950,11 +2033,7 @@ class MacroAssembler : public Assembler, public MacroAssemblerInterface {
     VIXL_ASSERT(allow_macro_instructions_);
     VIXL_ASSERT(vt.IsQ());
     SingleEmissionCheckScope guard(this);
-    ldr(vt,
-        new Literal<uint64_t>(high64,
-                              low64,
-                              &literal_pool_,
-                              RawLiteral::kDeletedOnPlacementByPool));
+    ldr(vt, literal_pool_.GetSharedLiteral(high64, low64));
   }
   void Ldr(const Register& rt, uint64_t imm) {
     VIXL_ASSERT(allow_macro_instructions_);
@@ -1962,15 +2041,11 @@ class MacroAssembler : public Assembler, public MacroAssemblerInterface {
     SingleEmissionCheckScope guard(this);
     RawLiteral* literal;
     if (rt.Is64Bits()) {
-      literal = new Literal<uint64_t>(imm,
-                                      &literal_pool_,
-                                      RawLiteral::kDeletedOnPlacementByPool);
+      literal = literal_pool_.GetSharedLiteral(imm);
     } else {
       VIXL_ASSERT(rt.Is32Bits());
       VIXL_ASSERT(IsUint32(imm) || IsInt32(imm));
-      literal = new Literal<uint32_t>(static_cast<uint32_t>(imm),
-                                      &literal_pool_,
-                                      RawLiteral::kDeletedOnPlacementByPool);
+      literal = literal_pool_.GetSharedLiteral(static_cast<uint32_t>(imm));
     }
     ldr(rt, literal);
   }
@@ -1978,10 +2053,7 @@ class MacroAssembler : public Assembler, public MacroAssemblerInterface {
     VIXL_ASSERT(allow_macro_instructions_);
     VIXL_ASSERT(!rt.IsZero());
     SingleEmissionCheckScope guard(this);
-    ldrsw(rt,
-          new Literal<uint32_t>(imm,
-                                &literal_pool_,
-                                RawLiteral::kDeletedOnPlacementByPool));
+    ldrsw(rt, literal_pool_.GetSharedLiteral(imm));
   }
   void Ldr(const CPURegister& rt, RawLiteral* literal) {
     VIXL_ASSERT(allow_macro_instructions_);
@@ -7818,6 +7890,12 @@ class MacroAssembler : public Assembler, public MacroAssemblerInterface {
 
   bool GenerateSimulatorCode() const { return generate_simulator_code_; }
 
+  // The arena used for objects that the MacroAssembler creates for its own
+  // use, such as the literals of Ldr and Fmov with immediate operands. It is
+  // reset by Reset() and FinalizeCode(), so anything allocated in it must be
+  // dead by then.
+  Arena* GetArena() { return &arena_; }
+
   size_t GetLiteralPoolSize() const { return literal_pool_.GetSize(); }
   VIXL_DEPRECATED("GetLiteralPoolSize", size_t LiteralPoolSize() const) {
     return GetLiteralPoolSize();
@@ -8377,6 +8455,10 @@ class MacroAssembler : public Assembler, public MacroAssemblerInterface {
 
   UseScratchRegisterScope* current_scratch_scope_;
 
+  // Short-lived objects owned by the MacroAssembler. This is declared before
+  // the pools, so that it outlives them.
+  Arena arena_;
+
   LiteralPool literal_pool_;
   VeneerPool veneer_pool_;
 
@@ -8756,32 +8838,6 @@ void MacroAssembler::CallRuntimeHelper(R (*function)(P...),
 #endif  // #ifdef VIXL_HAS_MACROASSEMBLER_RUNTIME_CALL_SUPPORT
 
 }  // namespace aarch64
-
-// Required InvalSet template specialisations.
-// TODO: These template specialisations should not live in this file.  Move
-// VeneerPool out of the aarch64 namespace in order to share its implementation
-// later.
-template <>
-inline ptrdiff_t InvalSet<aarch64::VeneerPool::BranchInfo,
-                          aarch64::VeneerPool::kNPreallocatedInfos,
-                          ptrdiff_t,
-                          aarch64::VeneerPool::kInvalidOffset,
-                          aarch64::VeneerPool::kReclaimFrom,
-                          aarch64::VeneerPool::kReclaimFactor>::
-    GetKey(const aarch64::VeneerPool::BranchInfo& branch_info) {
-  return branch_info.first_unreacheable_pc_;
-}
-template <>
-inline void InvalSet<aarch64::VeneerPool::BranchInfo,
-                     aarch64::VeneerPool::kNPreallocatedInfos,
-                     ptrdiff_t,
-                     aarch64::VeneerPool::kInvalidOffset,
-                     aarch64::VeneerPool::kReclaimFrom,
-                     aarch64::VeneerPool::kReclaimFactor>::
-    SetKey(aarch64::VeneerPool::BranchInfo* branch_info, ptrdiff_t key) {
-  branch_info->first_unreacheable_pc_ = key;
-}
-
 }  // namespace vixl
 
 #endif  // VIXL_AARCH64_MACRO_ASSEMBLER_AARCH64_H_
@@ -31,6 +31,7 @@
 #include <errno.h>
 #include <unistd.h>
 
+#include <algorithm>
 #include <cmath>
 #include <cstring>
 #include <limits>
@@ -46,6 +47,127 @@ const Instruction* Simulator::kEndOfSimAddress = NULL;
 
 bool MetaDataDepot::MetaDataMTE::is_active = false;
 
+SimAddressSpace::RegionId SimAddressSpace::AddRegion(uint64_t base,
+                                                     uint64_t size,
+                                                     int permissions) {
+  VIXL_ASSERT(size > 0);
+  VIXL_ASSERT((base + size) > base);
+  VIXL_ASSERT((permissions & ~(kRead | kWrite | kExecute)) == 0);
+
+  Region region = {base, size, permissions, next_region_id_++};
+  std::vector<Region>::iterator next =
+      std::upper_bound(regions_.begin(),
+                       regions_.end(),
+                       base,
+                       [](uint64_t address, const Region& r) {
+                         return address < r.base;
+                       });
+  // Check that the new region doesn't overlap its neighbours.
+  VIXL_CHECK((next == regions_.end()) || (region.GetEnd() <= next->base));
+  VIXL_CHECK((next == regions_.begin()) || ((next - 1)->GetEnd() <= base));
+  regions_.insert(next, region);
+  FlushTLB();
+  return region.id;
+}
+
+
+void SimAddressSpace::RemoveRegion(uint64_t base) {
+  regions_.erase(FindRegionStartingAt(base));
+  FlushTLB();
+}
+
+
+bool SimAddressSpace::RemoveRegionWithId(RegionId id) {
+  for (std::vector<Region>::iterator it = regions_.begin();
+       it != regions_.end();
+       ++it) {
+    if (it->id == id) {
+      regions_.erase(it);
+      FlushTLB();
+      return true;
+    }
+  }
+  return false;
+}
+
+
+void SimAddressSpace::SetPermissions(uint64_t base, int permissions) {
+  VIXL_ASSERT((permissions & ~(kRead | kWrite | kExecute)) == 0);
+  FindRegionStartingAt(base)->permissions = permissions;
+  FlushTLB();
+}
+
+
+std::vector<SimAddressSpace::Region>::iterator
+SimAddressSpace::FindRegionStartingAt(uint64_t base) {
+  std::vector<Region>::iterator it =
+      std::lower_bound(regions_.begin(),
+                       regions_.end(),
+                       base,
+                       [](const Region& r, uint64_t address) {
+                         return r.base < address;
+                       });
+  VIXL_CHECK((it != regions_.end()) && (it->base == base));
+  return it;
+}
+
+
+const SimAddressSpace::Region* SimAddressSpace::FindRegion(
+    uint64_t address) const {
+  // Find the last region starting at or before `address`.
+  std::vector<Region>::const_iterator next =
+      std::upper_bound(regions_.begin(),
+                       regions_.end(),
+                       address,
+                       [](uint64_t a, const Region& r) { return a < r.base; });
+  if (next == regions_.begin()) return nullptr;
+  const Region* region = &*(next - 1);
+  return (address < region->GetEnd()) ? region : nullptr;
+}
+
+
+void SimAddressSpace::Refill(TLBEntry* entry, uint64_t page) const {
+  uint64_t start = page << kPageSizeLog2;
+  uint64_t last = start + (kPageSize - 1);
+
+  const Region* region = FindRegion(start);
+  if (region != nullptr) {
+    // The page is uniform only if the region covers all of it.
+    if (last >= region->GetEnd()) return;
+    entry->page = page;
+    entry->permissions = region->permissions;
+    return;
+  }
+
+  // The start of the page is unmapped, so the page is uniform only if no
+  // region starts inside it.
+  std::vector<Region>::const_iterator next =
+      std::upper_bound(regions_.begin(),
+                       regions_.end(),
+                       start,
+                       [](uint64_t a, const Region& r) { return a < r.base; });
+  if ((next != regions_.end()) && (next->base <= last)) return;
+  entry->page = page;
+  entry->permissions = kNoAccess;
+}
+
+
+bool SimAddressSpace::IsAccessAllowedSlow(uint64_t address,
+                                          size_t size,
+                                          int access) const {
+  // The access may span several adjacent regions.
+  uint64_t end = address + size;
+  while (address < end) {
+    const Region* region = FindRegion(address);
+    if ((region == nullptr) || ((region->permissions & access) != access)) {
+      return false;
+    }
+    address = region->GetEnd();
+  }
+  return true;
+}
+
+
 void SimSystemRegister::SetBits(int msb, int lsb, uint32_t bits) {
   int width = msb - lsb + 1;
   VIXL_ASSERT(IsUintN(width, bits) || IsIntN(width, bits));
@@ -472,8 +594,14 @@ const Simulator::FormToVisitorFnMap* Simulator::GetFormToVisitorFnMap() {
   return &form_to_visitor;
 }
 
+const Simulator::FormToVisitorFnTable* Simulator::GetFormToVisitorFnTable() {
+  static const FormToVisitorFnTable form_to_visitor(*GetFormToVisitorFnMap());
+  return &form_to_visitor;
+}
+
 Simulator::Simulator(Decoder* decoder, FILE* stream, SimStack::Allocated stack)
     : memory_(std::move(stack)),
+      stack_region_(SimAddressSpace::kNoRegion),
       last_instr_(NULL),
       cpu_features_auditor_(decoder, CPUFeatures::All()) {
   // Ensure that shift operations act as the simulator expects.
@@ -505,6 +633,9 @@ Simulator::Simulator(Decoder* decoder, FILE* stream, SimStack::Allocated stack)
   SetColouredTrace(false);
   trace_parameters_ = LOG_NONE;
 
+  decode_block_generation_ = 0;
+  vector_kernels_enabled_ = true;
+
   // We have to configure the SVE vector register length before calling
   // ResetState().
   SetVectorLengthInBits(kZRegMinSize);
@@ -600,6 +731,82 @@ void Simulator::ResetState() {
   next_btype_ = DefaultBType;
 }
 
+void Simulator::TakeSnapshot(Snapshot* snapshot) const {
+  snapshot->simulator_ = this;
+
+  for (unsigned i = 0; i < kNumberOfRegisters; i++) {
+    snapshot->registers_[i] = registers_[i];
+  }
+  for (unsigned i = 0; i < kNumberOfVRegisters; i++) {
+    snapshot->vregisters_[i] = vregisters_[i];
+  }
+  for (unsigned i = 0; i < kNumberOfPRegisters; i++) {
+    snapshot->pregisters_[i] = pregisters_[i];
+  }
+  snapshot->ffr_register_ = ffr_register_;
+  snapshot->nzcv_ = nzcv_;
+  snapshot->fpcr_ = fpcr_;
+  snapshot->vector_length_ = vector_length_;
+
+  snapshot->local_monitor_ = local_monitor_;
+  snapshot->global_monitor_ = global_monitor_;
+
+  snapshot->pc_ = pc_;
+  snapshot->last_instr_ = last_instr_;
+  snapshot->form_hash_ = form_hash_;
+  snapshot->btype_ = btype_;
+  snapshot->next_btype_ = next_btype_;
+  memcpy(snapshot->rand_state_, rand_state_, sizeof(rand_state_));
+
+  // The guard regions can't be accessed by simulated code, so they don't need
+  // to be saved.
+  const SimStack::Allocated& stack = memory_.GetStack();
+  const char* limit = stack.GetLimit() + 1;
+  const char* base = stack.GetBase();
+  snapshot->stack_.assign(limit, base);
+
+  // This shares the tag pages, rather than copying them.
+  snapshot->meta_data_ = meta_data_;
+}
+
+void Simulator::RestoreSnapshot(const Snapshot& snapshot) {
+  VIXL_CHECK(snapshot.simulator_ == this);
+
+  for (unsigned i = 0; i < kNumberOfRegisters; i++) {
+    registers_[i] = snapshot.registers_[i];
+  }
+  for (unsigned i = 0; i < kNumberOfVRegisters; i++) {
+    vregisters_[i] = snapshot.vregisters_[i];
+  }
+  for (unsigned i = 0; i < kNumberOfPRegisters; i++) {
+    pregisters_[i] = snapshot.pregisters_[i];
+  }
+  ffr_register_ = snapshot.ffr_register_;
+  nzcv_ = snapshot.nzcv_;
+  fpcr_ = snapshot.fpcr_;
+  vector_length_ = snapshot.vector_length_;
+
+  local_monitor_ = snapshot.local_monitor_;
+  global_monitor_ = snapshot.global_monitor_;
+
+  pc_ = snapshot.pc_;
+  pc_modified_ = false;
+  last_instr_ = snapshot.last_instr_;
+  form_hash_ = snapshot.form_hash_;
+  btype_ = snapshot.btype_;
+  next_btype_ = snapshot.next_btype_;
+  memcpy(rand_state_, snapshot.rand_state_, sizeof(rand_state_));
+
+  const SimStack::Allocated& stack = memory_.GetStack();
+  VIXL_ASSERT(snapshot.stack_.size() ==
+              static_cast<size_t>(stack.GetBase() - (stack.GetLimit() + 1)));
+  std::copy(snapshot.stack_.begin(),
+            snapshot.stack_.end(),
+            stack.GetLimit() + 1);
+
+  meta_data_ = snapshot.meta_data_;
+}
+
 void Simulator::SetVectorLengthInBits(unsigned vector_length) {
   VIXL_ASSERT((vector_length >= kZRegMinSize) &&
               (vector_length <= kZRegMaxSize));
@@ -635,7 +842,11 @@ void Simulator::Run() {
   LogAllWrittenRegisters();
 
   while (pc_ != kEndOfSimAddress) {
-    ExecuteInstruction();
+    if (IsBlockExecutionEnabled() && CanUseBlockExecution()) {
+      ExecuteBlock();
+    } else {
+      ExecuteInstruction();
+    }
   }
 }
 
@@ -646,6 +857,28 @@ void Simulator::RunFrom(const Instruction* first) {
 }
 
 
+void Simulator::SetAddressSpace(SimAddressSpace* address_space) {
+  // The usable stack lies between the guard regions.
+  const SimStack::Allocated& stack = memory_.GetStack();
+  uint64_t limit = reinterpret_cast<uint64_t>(stack.GetLimit()) + 1;
+  uint64_t base = reinterpret_cast<uint64_t>(stack.GetBase());
+
+  // Only remove the region that we added, even if the embedder has since
+  // replaced it with one of their own.
+  SimAddressSpace* previous = memory_.GetAddressSpace();
+  if (previous != nullptr) {
+    previous->RemoveRegionWithId(stack_region_);
+  }
+  stack_region_ = SimAddressSpace::kNoRegion;
+  if (address_space != nullptr) {
+    stack_region_ = address_space->AddRegion(limit,
+                                             base - limit,
+                                             SimAddressSpace::kReadWrite);
+  }
+  memory_.SetAddressSpace(address_space);
+}
+
+
 // clang-format off
 const char* Simulator::xreg_names[] = {"x0",  "x1",  "x2",  "x3",  "x4",  "x5",
                                        "x6",  "x7",  "x8",  "x9",  "x10", "x11",
@@ -2058,15 +2291,218 @@ void Simulator::PrintTakenBranch(const Instruction* target) {
 
 
 void Simulator::Visit(Metadata* metadata, const Instruction* instr) {
-  VIXL_ASSERT(metadata->count("form") > 0);
-  std::string form = (*metadata)["form"];
-  form_hash_ = Hash(form.c_str());
-  const FormToVisitorFnMap* fv = Simulator::GetFormToVisitorFnMap();
-  FormToVisitorFnMap::const_iterator it = fv->find(form_hash_);
-  if (it == fv->end()) {
+  form_hash_ = metadata->GetFormHash();
+  const FormToVisitorFn* fn =
+      Simulator::GetFormToVisitorFnTable()->Get(metadata->GetFormId());
+  if (fn == NULL) {
     VisitUnimplemented(instr);
   } else {
-    (it->second)(this, instr);
+    (*fn)(this, instr);
+  }
+}
+
+void Simulator::EnableDecodeCache(size_t entries) {
+  VIXL_ASSERT(IsPowerOf2(entries));
+  decode_cache_.assign(entries, DecodeCacheEntry());
+}
+
+void Simulator::EnableBlockExecution(size_t blocks) {
+  VIXL_ASSERT(IsPowerOf2(blocks));
+  DecodeBlock empty = {NULL, 0};
+  decode_blocks_.assign(blocks, empty);
+  decode_block_entries_.assign(blocks * kMaxDecodeBlockLength,
+                               DecodeCacheEntry());
+  decode_block_generation_++;
+}
+
+void Simulator::DisableBlockExecution() {
+  decode_blocks_.clear();
+  decode_block_entries_.clear();
+  decode_block_generation_++;
+}
+
+void Simulator::FlushDecodeCache() {
+  decode_cache_.assign(decode_cache_.size(), DecodeCacheEntry());
+  for (DecodeBlock& block : decode_blocks_) {
+    block.start = NULL;
+  }
+  decode_block_generation_++;
+}
+
+void Simulator::FlushDecodeCache(const void* address, size_t size) {
+  uintptr_t start =
+      AlignDown(reinterpret_cast<uintptr_t>(address), kInstructionSize);
+  uintptr_t end = reinterpret_cast<uintptr_t>(address) + size;
+
+  if (((end - start) / kInstructionSize) >= decode_cache_.size()) {
+    decode_cache_.assign(decode_cache_.size(), DecodeCacheEntry());
+  } else {
+    for (uintptr_t addr = start; addr < end; addr += kInstructionSize) {
+      DecodeCacheEntry* entry =
+          &decode_cache_[(addr >> kInstructionSizeLog2) &
+                         (decode_cache_.size() - 1)];
+      if (reinterpret_cast<uintptr_t>(entry->address) == addr) {
+        *entry = DecodeCacheEntry();
+      }
+    }
+  }
+
+  for (DecodeBlock& block : decode_blocks_) {
+    uintptr_t block_start = reinterpret_cast<uintptr_t>(block.start);
+    uintptr_t block_end = block_start + (block.length * kInstructionSize);
+    if ((block.start != NULL) && (block_start < end) && (start < block_end)) {
+      block.start = NULL;
+    }
+  }
+  decode_block_generation_++;
+}
+
+bool Simulator::CanUseDecodeCache() {
+  // The decode cache calls the CPUFeaturesAuditor and the Simulator directly,
+  // so it can only be used if they are the only registered visitors, in the
+  // order that the Simulator registered them.
+  std::list<DecoderVisitor*>* visitors = decoder_->visitors();
+  return (visitors->size() == 2) &&
+         (visitors->front() == &cpu_features_auditor_) &&
+         (visitors->back() == this);
+}
+
+void Simulator::FillDecodeCacheEntry(DecodeCacheEntry* entry,
+                                     const Instruction* instr) {
+  FormId form_id = decoder_->IdentifyForm(instr);
+  entry->address = instr;
+  entry->encoding = instr->GetInstructionBits();
+  entry->form_id = form_id;
+  entry->form_hash = Decoder::GetFormHash(form_id);
+  entry->handler = GetFormToVisitorFnTable()->Get(form_id);
+}
+
+void Simulator::VisitDecodeCacheEntry(const DecodeCacheEntry* entry) {
+  Metadata metadata(entry->form_id);
+  cpu_features_auditor_.Visit(&metadata, pc_);
+
+  form_hash_ = entry->form_hash;
+  if (entry->handler == NULL) {
+    VisitUnimplemented(pc_);
+  } else {
+    (*entry->handler)(this, pc_);
+  }
+}
+
+void Simulator::VisitUsingDecodeCache() {
+  uintptr_t address = reinterpret_cast<uintptr_t>(pc_);
+  DecodeCacheEntry* entry = &decode_cache_[(address >> kInstructionSizeLog2) &
+                                           (decode_cache_.size() - 1)];
+  if ((entry->address != pc_) ||
+      (entry->encoding != pc_->GetInstructionBits())) {
+    FillDecodeCacheEntry(entry, pc_);
+  }
+  VisitDecodeCacheEntry(entry);
+}
+
+bool Simulator::CanUseBlockExecution() {
+  // ExecuteBlock() doesn't check BType or log written registers, so fall back
+  // to ExecuteInstruction() if either might be needed.
+  return !PcIsInGuardedPage() && (GetTraceParameters() == LOG_NONE) &&
+         CanUseDecodeCache();
+}
+
+// Return true if `instr` is the last instruction in a translated block: a
+// branch, an exception-generating instruction (including the Simulator's
+// pseudo-instructions, which may be followed by data), or something that the
+// Simulator can't execute.
+static bool EndsDecodeBlock(const Instruction* instr, FormId form_id) {
+  return instr->IsImmBranch() ||
+         (instr->Mask(UnconditionalBranchToRegisterFMask) ==
+          UnconditionalBranchToRegisterFixed) ||
+         instr->IsException() || (form_id == Decoder::kUnallocatedFormId);
+}
+
+void Simulator::TranslateBlock(DecodeBlock* block) {
+  size_t index = block - decode_blocks_.data();
+  DecodeCacheEntry* entries =
+      &decode_block_entries_[index * kMaxDecodeBlockLength];
+
+  const Instruction* instr = pc_;
+  size_t length = 0;
+  while (length < kMaxDecodeBlockLength) {
+    DecodeCacheEntry* entry = &entries[length++];
+    FillDecodeCacheEntry(entry, instr);
+    if ((entry->handler == NULL) || EndsDecodeBlock(instr, entry->form_id)) {
+      break;
+    }
+    instr = instr->GetNextInstruction();
+    // With an address space, blocks end at page boundaries and before the
+    // first instruction that can't be fetched. ExecuteBlock() then checks the
+    // whole block at once, which usually needs a single TLB lookup.
+    if ((GetAddressSpace() != nullptr) &&
+        (IsAligned(reinterpret_cast<uintptr_t>(instr),
+                   SimAddressSpace::kPageSize) ||
+         !IsFetchAllowed(instr))) {
+      break;
+    }
+  }
+
+  block->start = pc_;
+  block->length = length;
+  decode_block_generation_++;
+}
+
+void Simulator::ExecuteBlock() {
+  uintptr_t address = reinterpret_cast<uintptr_t>(pc_);
+  size_t index =
+      (address >> kInstructionSizeLog2) & (decode_blocks_.size() - 1);
+  DecodeBlock* block = &decode_blocks_[index];
+  if (block->start != pc_) TranslateBlock(block);
+
+  const DecodeCacheEntry* entries =
+      &decode_block_entries_[index * kMaxDecodeBlockLength];
+  size_t length = block->length;
+  if (!memory_.IsAccessAllowed(pc_,
+                               length * kInstructionSize,
+                               SimAddressSpace::kExecute)) {
+    // Either `pc_` isn't executable, or the permissions have changed since the
+    // block was translated. Fall back to checking each instruction as it is
+    // fetched.
+    ExecuteInstruction();
+    return;
+  }
+  uint64_t generation = decode_block_generation_;
+
+  // This is equivalent to calling ExecuteInstruction() for each instruction in
+  // the block, except that the BType check and register logging are omitted
+  // (see CanUseBlockExecution()), and the instructions are already decoded.
+  for (size_t i = 0; i < length; i++) {
+    const DecodeCacheEntry* entry = &entries[i];
+    VIXL_ASSERT(entry->address == pc_);
+    if (entry->encoding != pc_->GetInstructionBits()) {
+      // The code has been modified since the block was translated. Discard the
+      // block, and let Run() translate a new one from here.
+      block->start = NULL;
+      decode_block_generation_++;
+      return;
+    }
+
+    pc_modified_ = false;
+    bool last_instr_was_movprfx =
+        (form_hash_ == "movprfx_z_z"_h) || (form_hash_ == "movprfx_z_p_z"_h);
+
+    VisitDecodeCacheEntry(entry);
+
+    if (last_instr_was_movprfx) {
+      VIXL_ASSERT(last_instr_ != NULL);
+      VIXL_CHECK(pc_->CanTakeSVEMovprfx(form_hash_, last_instr_));
+    }
+
+    last_instr_ = ReadPc();
+    IncrementPc();
+    UpdateBType();
+
+    VIXL_CHECK(cpu_features_auditor_.InstructionIsAvailable());
+
+    // Stop if the instruction branched, or if the block was discarded (for
+    // example, by `ic ivau`, or by a nested call to Run() from a runtime call).
+    if (pc_modified_ || (generation != decode_block_generation_)) return;
   }
 }
 
@@ -4568,6 +5004,12 @@ bool Simulator::CanReadMemory(uintptr_t address, size_t size) {
   //
   // [1]: https://stackoverflow.com/questions/7134590
 
+  // Addresses that the guest may not read behave as if they would fault.
+  if ((size > 0) &&
+      !memory_.IsAccessAllowed(address, size, SimAddressSpace::kRead)) {
+    return false;
+  }
+
   size_t written = 0;
   bool can_read = true;
   // `write` will normally return after one invocation, but it is allowed to
@@ -5320,34 +5762,83 @@ void Simulator::VisitDataProcessing1Source(const Instruction* instr) {
 }
 
 
-uint32_t Simulator::Poly32Mod2(unsigned n, uint64_t data, uint32_t poly) {
-  VIXL_ASSERT((n > 32) && (n <= 64));
-  for (unsigned i = (n - 1); i >= 32; i--) {
-    if (((data >> i) & 1) != 0) {
-      uint64_t polysh32 = (uint64_t)poly << (i - 32);
-      uint64_t mask = (UINT64_C(1) << i) - 1;
-      data = ((data & mask) ^ polysh32);
+// Lookup tables for computing CRC32 and CRC32C checksums up to eight bytes at
+// a time ("slicing-by-8"). The A64 CRC instructions use the bit-reflected form
+// of the polynomial, so `table[0][b]` is the checksum contribution of byte
+// `b`, and `table[k][b]` is the contribution of byte `b` followed by k zero
+// bytes.
+class Crc32Tables {
+ public:
+  explicit Crc32Tables(uint32_t poly) {
+    uint32_t reflected_poly = ReverseBits(poly);
+    for (uint32_t b = 0; b < 256; b++) {
+      uint32_t crc = b;
+      for (int i = 0; i < 8; i++) {
+        crc = (crc >> 1) ^ ((crc & 1) ? reflected_poly : 0);
+      }
+      table_[0][b] = crc;
+    }
+    for (int k = 1; k < kSlices; k++) {
+      for (int b = 0; b < 256; b++) {
+        uint32_t prev = table_[k - 1][b];
+        table_[k][b] = (prev >> 8) ^ table_[0][prev & 0xff];
+      }
     }
   }
-  return data & 0xffffffff;
-}
+
+  // Accumulate the low `size` bytes of `val`, least-significant byte first.
+  uint32_t Update(uint32_t acc, uint64_t val, int size) const {
+    uint32_t lo = acc ^ static_cast<uint32_t>(val);
+    switch (size) {
+      case 1:
+        return (acc >> 8) ^ Lookup(0, lo, 0);
+      case 2:
+        return (acc >> 16) ^ Lookup(1, lo, 0) ^ Lookup(0, lo, 1);
+      case 4:
+        return Lookup(3, lo, 0) ^ Lookup(2, lo, 1) ^ Lookup(1, lo, 2) ^
+               Lookup(0, lo, 3);
+      case 8: {
+        uint32_t hi = static_cast<uint32_t>(val >> 32);
+        return Lookup(7, lo, 0) ^ Lookup(6, lo, 1) ^ Lookup(5, lo, 2) ^
+               Lookup(4, lo, 3) ^ Lookup(3, hi, 0) ^ Lookup(2, hi, 1) ^
+               Lookup(1, hi, 2) ^ Lookup(0, hi, 3);
+      }
+      default:
+        VIXL_UNREACHABLE();
+        return 0;
+    }
+  }
+
+ private:
+  static const int kSlices = 8;
+
+  uint32_t Lookup(int slice, uint32_t word, int byte) const {
+    return table_[slice][(word >> (byte * 8)) & 0xff];
+  }
+
+  uint32_t table_[kSlices][256];
+};
 
 
 template <typename T>
 uint32_t Simulator::Crc32Checksum(uint32_t acc, T val, uint32_t poly) {
-  unsigned size = sizeof(val) * 8;  // Number of bits in type T.
-  VIXL_ASSERT((size == 8) || (size == 16) || (size == 32));
-  uint64_t tempacc = static_cast<uint64_t>(ReverseBits(acc)) << size;
-  uint64_t tempval = static_cast<uint64_t>(ReverseBits(val)) << 32;
-  return ReverseBits(Poly32Mod2(32 + size, tempacc ^ tempval, poly));
+  int size = sizeof(val);  // Number of bytes in type T.
+  VIXL_ASSERT((size == 1) || (size == 2) || (size == 4) || (size == 8));
+  return Crc32Checksum(acc, val, size, poly);
 }
 
 
-uint32_t Simulator::Crc32Checksum(uint32_t acc, uint64_t val, uint32_t poly) {
-  // Poly32Mod2 cannot handle inputs with more than 32 bits, so compute
-  // the CRC of each 32-bit word sequentially.
-  acc = Crc32Checksum(acc, (uint32_t)(val & 0xffffffff), poly);
-  return Crc32Checksum(acc, (uint32_t)(val >> 32), poly);
+uint32_t Simulator::Crc32Checksum(uint32_t acc,
+                                  uint64_t val,
+                                  int size,
+                                  uint32_t poly) {
+  // The tables are built on first use, which is thread-safe.
+  static const Crc32Tables crc32_tables(CRC32_POLY);
+  static const Crc32Tables crc32c_tables(CRC32C_POLY);
+  VIXL_ASSERT((poly == CRC32_POLY) || (poly == CRC32C_POLY));
+  const Crc32Tables& tables =
+      (poly == CRC32_POLY) ? crc32_tables : crc32c_tables;
+  return tables.Update(acc, val, size);
 }
 
 
@@ -6509,6 +7000,13 @@ bool Simulator::FPProcessNaNs(const Instruction* instr) {
 
 
 void Simulator::SysOp_W(int op, int64_t val) {
+  if ((op == IVAU) &&
+      (IsDecodeCacheEnabled() || IsBlockExecutionEnabled())) {
+    uint64_t line = AlignDown(AddressUntag(static_cast<uint64_t>(val)),
+                              kDecodeCacheFlushGranule);
+    FlushDecodeCache(reinterpret_cast<void*>(line), kDecodeCacheFlushGranule);
+  }
+
   switch (op) {
     case IVAU:
     case CVAC:
@@ -7298,7 +7796,7 @@ void Simulator::VisitNEON3Same(const Instruction* instr) {
     VectorFormat vf = nfd.GetVectorFormat();
     switch (instr->Mask(NEON3SameMask)) {
       case NEON_ADD:
-        add(vf, rd, rn, rm);
+        add_nosat(vf, rd, rn, rm);
         break;
       case NEON_ADDP:
         addp(vf, rd, rn, rm);
@@ -7346,7 +7844,7 @@ void Simulator::VisitNEON3Same(const Instruction* instr) {
         sminp(vf, rd, rn, rm);
         break;
       case NEON_SUB:
-        sub(vf, rd, rn, rm);
+        sub_nosat(vf, rd, rn, rm);
         break;
       case NEON_UMAX:
         umax(vf, rd, rn, rm);
@@ -8854,10 +9352,10 @@ void Simulator::VisitNEONScalar3Same(const Instruction* instr) {
   } else {
     switch (instr->Mask(NEONScalar3SameMask)) {
       case NEON_ADD_scalar:
-        add(vf, rd, rn, rm);
+        add_nosat(vf, rd, rn, rm);
         break;
       case NEON_SUB_scalar:
-        sub(vf, rd, rn, rm);
+        sub_nosat(vf, rd, rn, rm);
         break;
       case NEON_CMEQ_scalar:
         cmp(vf, rd, rn, rm, eq);
@@ -10906,7 +11404,7 @@ void Simulator::VisitSVEIntArithmeticUnpredicated(const Instruction* instr) {
   SimVRegister& zm = ReadVRegister(instr->GetRm());
   switch (instr->Mask(SVEIntArithmeticUnpredicatedMask)) {
     case ADD_z_zz:
-      add(vform, zd, zn, zm);
+      add_nosat(vform, zd, zn, zm);
       break;
     case SQADD_z_zz:
       add(vform, zd, zn, zm).SignedSaturate(vform);
@@ -10915,7 +11413,7 @@ void Simulator::VisitSVEIntArithmeticUnpredicated(const Instruction* instr) {
       sub(vform, zd, zn, zm).SignedSaturate(vform);
       break;
     case SUB_z_zz:
-      sub(vform, zd, zn, zm);
+      sub_nosat(vform, zd, zn, zm);
       break;
     case UQADD_z_zz:
       add(vform, zd, zn, zm).UnsignedSaturate(vform);
@@ -10939,13 +11437,13 @@ void Simulator::VisitSVEIntAddSubtractVectors_Predicated(
 
   switch (instr->Mask(SVEIntAddSubtractVectors_PredicatedMask)) {
     case ADD_z_p_zz:
-      add(vform, result, zdn, zm);
+      add_nosat(vform, result, zdn, zm);
       break;
     case SUBR_z_p_zz:
-      sub(vform, result, zm, zdn);
+      sub_nosat(vform, result, zm, zdn);
       break;
     case SUB_z_p_zz:
-      sub(vform, result, zdn, zm);
+      sub_nosat(vform, result, zdn, zm);
       break;
     default:
       VIXL_UNIMPLEMENTED();
@@ -11136,6 +11634,79 @@ void Simulator::VisitSVEIntCompareScalarCountAndLimit(
                  (form_hash_ == "whilehs_p_p_rr"_h);
 
   int lane_count = LaneCountFromFormat(vform);
+  if (AreVectorKernelsEnabled()) {
+    // The active lanes always form a single run, starting at the first lane
+    // (or the last, for the decrementing forms), so its length can be computed
+    // directly instead of testing each lane in turn.
+    usrc1 &= mask;
+    int64_t ssrc1 = ExtractSignedBitfield64(rsize - 1, 0, usrc1);
+    int64_t smax = static_cast<int64_t>(mask >> 1);
+    int64_t smin = -smax - 1;
+    // The signed differences are computed as unsigned values, since they can
+    // overflow int64_t.
+    uint64_t sdiff =
+        static_cast<uint64_t>(ssrc2) - static_cast<uint64_t>(ssrc1);
+    uint64_t sdiff_reverse = -sdiff;
+    // The number of lanes that pass the test, or UINT64_MAX if the test passes
+    // for every value of the counter.
+    uint64_t active = 0;
+    switch (form_hash_) {
+      case "whilele_p_p_rr"_h:
+        if (ssrc2 == smax) {
+          active = UINT64_MAX;
+        } else if (ssrc1 <= ssrc2) {
+          active = sdiff + 1;
+        }
+        break;
+      case "whilelo_p_p_rr"_h:
+        if (usrc1 < usrc2) active = usrc2 - usrc1;
+        break;
+      case "whilels_p_p_rr"_h:
+        if (usrc2 == mask) {
+          active = UINT64_MAX;
+        } else if (usrc1 <= usrc2) {
+          active = usrc2 - usrc1 + 1;
+        }
+        break;
+      case "whilelt_p_p_rr"_h:
+        if (ssrc1 < ssrc2) active = sdiff;
+        break;
+      case "whilege_p_p_rr"_h:
+        if (ssrc2 == smin) {
+          active = UINT64_MAX;
+        } else if (ssrc1 >= ssrc2) {
+          active = sdiff_reverse + 1;
+        }
+        break;
+      case "whilegt_p_p_rr"_h:
+        if (ssrc1 > ssrc2) active = sdiff_reverse;
+        break;
+      case "whilehi_p_p_rr"_h:
+        if (usrc1 > usrc2) active = usrc1 - usrc2;
+        break;
+      case "whilehs_p_p_rr"_h:
+        if (usrc2 == 0) {
+          active = UINT64_MAX;
+        } else if (usrc1 >= usrc2) {
+          active = usrc1 - usrc2 + 1;
+        }
+        break;
+      default:
+        VIXL_UNIMPLEMENTED();
+        break;
+    }
+    int count = static_cast<int>(
+        std::min(active, static_cast<uint64_t>(lane_count)));
+    if (reverse) {
+      SetActiveLaneRange(vform, pd, lane_count - count, lane_count);
+    } else {
+      SetActiveLaneRange(vform, pd, 0, count);
+    }
+    PredTest(vform, GetPTrue(), pd);
+    LogSystemRegister(NZCV);
+    return;
+  }
+
   bool last = true;
   for (int i = 0; i < lane_count; i++) {
     usrc1 &= mask;
@@ -14101,10 +14672,11 @@ void Simulator::SimulateMTEStoreTag(const Instruction* instr) {
   }
 
   int tag = GetAllocationTagFromAddress(rt);
-  meta_data_.SetMTETag(address, tag, instr);
+  size_t tag_size = kMTETagGranuleInBytes;
   if (is_pair) {
-    meta_data_.SetMTETag(address + kMTETagGranuleInBytes, tag, instr);
+    tag_size += kMTETagGranuleInBytes;
   }
+  meta_data_.SetMTETagRange(address, tag_size, tag, instr);
 }
 
 void Simulator::SimulateMTELoadTag(const Instruction* instr) {
@@ -14255,11 +14827,7 @@ void Simulator::SimulateSetGM(const Instruction* instr) {
   uint64_t xn = ReadXRegister(instr->GetRn());
 
   int tag = GetAllocationTagFromAddress(xd);
-  while (xn) {
-    meta_data_.SetMTETag(xd, tag);
-    xd += 16;
-    xn -= 16;
-  }
+  meta_data_.SetMTETagRange(xd, xn, tag);
   SimulateSetM(instr);
 }
 
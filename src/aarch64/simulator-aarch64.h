@@ -27,6 +27,7 @@
 #ifndef VIXL_AARCH64_SIMULATOR_AARCH64_H_
 #define VIXL_AARCH64_SIMULATOR_AARCH64_H_
 
+#include <algorithm>
 #include <memory>
 #include <unordered_map>
 #include <vector>
@@ -178,45 +179,42 @@ class MetaDataDepot {
  public:
   class MetaDataMTE {
    public:
-    explicit MetaDataMTE(int tag) : tag_(tag) {}
-
-    int GetTag() const { return tag_; }
-    void SetTag(int tag) {
-      VIXL_ASSERT(IsUint4(tag));
-      tag_ = tag;
-    }
-
     static bool IsActive() { return is_active; }
     static void SetActive(bool value) { is_active = value; }
 
    private:
     static bool is_active;
-    int16_t tag_;
-
-    friend class MetaDataDepot;
   };
 
-  // Generate a key for metadata recording from a untagged address.
-  template <typename T>
-  uint64_t GenerateMTEkey(T address) const {
-    // Cast the address using a C-style cast. A reinterpret_cast would be
-    // appropriate, but it can't cast one integral type to another.
-    return (uint64_t)(AddressUntag(address)) >> kMTETagGranuleInBytesLog2;
-  }
-
-  template <typename R, typename T>
-  R GetAttribute(T map, uint64_t key) {
-    auto pair = map->find(key);
-    R value = (pair == map->end()) ? nullptr : &pair->second;
-    return value;
+  MetaDataDepot()
+      : total_count_mte_(0),
+        last_page_number_(kNoPage),
+        last_page_(nullptr) {}
+
+  // Copies share their tag pages with the original. A shared page is only
+  // copied when one of the depots modifies it, so copying a depot (for
+  // example, in a Simulator::Snapshot) is cheap.
+  MetaDataDepot(const MetaDataDepot& other)
+      : pages_mte_(other.pages_mte_),
+        total_count_mte_(other.total_count_mte_),
+        last_page_number_(kNoPage),
+        last_page_(nullptr) {}
+
+  MetaDataDepot& operator=(const MetaDataDepot& other) {
+    pages_mte_ = other.pages_mte_;
+    total_count_mte_ = other.total_count_mte_;
+    last_page_number_ = kNoPage;
+    last_page_ = nullptr;
+    return *this;
   }
 
   template <typename T>
   int GetMTETag(T address, Instruction const* pc = nullptr) {
-    uint64_t key = GenerateMTEkey(address);
-    MetaDataMTE* m = GetAttribute<MetaDataMTE*>(&metadata_mte_, key);
+    uint64_t granule = GetGranuleIndex(address);
+    const MTETagPage* page = FindPage(granule);
+    size_t index = granule % MTETagPage::kGranules;
 
-    if (!m) {
+    if ((page == nullptr) || !page->IsTagged(index)) {
       std::stringstream sstream;
       sstream << std::hex << "MTE ERROR : instruction at 0x"
               << reinterpret_cast<uint64_t>(pc)
@@ -225,44 +223,315 @@ class MetaDataDepot {
       VIXL_ABORT_WITH_MSG(sstream.str().c_str());
     }
 
-    return m->GetTag();
+    return page->GetTag(index);
   }
 
   template <typename T>
   void SetMTETag(T address, int tag, Instruction const* pc = nullptr) {
-    VIXL_ASSERT(IsAligned((uintptr_t)address, kMTETagGranuleInBytes));
-    uint64_t key = GenerateMTEkey(address);
-    MetaDataMTE* m = GetAttribute<MetaDataMTE*>(&metadata_mte_, key);
+    SetMTETagRange(address, kMTETagGranuleInBytes, tag, pc);
+  }
 
-    if (!m) {
-      metadata_mte_.insert({key, MetaDataMTE(tag)});
-    } else {
-      // Overwrite
-      if (m->GetTag() == tag) {
-        std::stringstream sstream;
-        sstream << std::hex << "MTE WARNING : instruction at 0x"
-                << reinterpret_cast<uint64_t>(pc)
-                << ", the same tag is assigned to the address 0x"
-                << (uint64_t)(address) << ".\n";
-        VIXL_WARNING(sstream.str().c_str());
+  // Tag every granule in [address, address + length). Granules that are
+  // already tagged are overwritten.
+  template <typename T>
+  void SetMTETagRange(T address,
+                      size_t length,
+                      int tag,
+                      Instruction const* pc = nullptr) {
+    VIXL_ASSERT(IsAligned((uintptr_t)address, kMTETagGranuleInBytes));
+    VIXL_ASSERT(IsUint4(tag));
+    uint64_t granule = GetGranuleIndex(address);
+    uint64_t end = granule + GetGranuleCount(length);
+    bool same_tag = false;
+    while (granule < end) {
+      MTETagPage* page = GetOrCreatePage(granule);
+      size_t index = granule % MTETagPage::kGranules;
+      size_t count = std::min<uint64_t>(MTETagPage::kGranules - index,
+                                        end - granule);
+      for (size_t i = index; i < (index + count); i++) {
+        if (page->IsTagged(i)) {
+          same_tag |= (page->GetTag(i) == tag);
+        } else {
+          total_count_mte_++;
+        }
+        page->SetTag(i, tag);
       }
-      m->SetTag(tag);
+      granule += count;
+    }
+
+    if (same_tag) {
+      std::stringstream sstream;
+      sstream << std::hex << "MTE WARNING : instruction at 0x"
+              << reinterpret_cast<uint64_t>(pc)
+              << ", the same tag is assigned to the address 0x"
+              << (uint64_t)(address) << ".\n";
+      VIXL_WARNING(sstream.str().c_str());
     }
   }
 
   template <typename T>
   size_t CleanMTETag(T address) {
+    return CleanMTETagRange(address, kMTETagGranuleInBytes);
+  }
+
+  // Remove the tags of every granule in [address, address + length), and
+  // return the number of granules that were tagged.
+  template <typename T>
+  size_t CleanMTETagRange(T address, size_t length) {
     VIXL_ASSERT(
         IsAligned(reinterpret_cast<uintptr_t>(address), kMTETagGranuleInBytes));
-    uint64_t key = GenerateMTEkey(address);
-    return metadata_mte_.erase(key);
+    uint64_t granule = GetGranuleIndex(address);
+    uint64_t end = granule + GetGranuleCount(length);
+    size_t cleaned = 0;
+    while (granule < end) {
+      uint64_t page_number = granule / MTETagPage::kGranules;
+      size_t index = granule % MTETagPage::kGranules;
+      size_t count = std::min<uint64_t>(MTETagPage::kGranules - index,
+                                        end - granule);
+      MTETagPage* page = FindWritablePage(granule);
+      if (page != nullptr) {
+        for (size_t i = index; i < (index + count); i++) {
+          if (page->Clean(i)) cleaned++;
+        }
+        if (page->IsEmpty()) {
+          if (page_number == last_page_number_) {
+            last_page_number_ = kNoPage;
+            last_page_ = nullptr;
+          }
+          pages_mte_.erase(page_number);
+        }
+      }
+      granule += count;
+    }
+    total_count_mte_ -= cleaned;
+    return cleaned;
+  }
+
+  size_t GetTotalCountMTE() const { return total_count_mte_; }
+
+ private:
+  // The tags for a page (kPageSize bytes) of memory: a dense 4-bit tag for each
+  // granule, and a bit recording whether the granule is tagged at all.
+  class MTETagPage {
+   public:
+    static const size_t kGranules = kPageSize / kMTETagGranuleInBytes;
+
+    MTETagPage() : count_(0) {
+      memset(tags_, 0, sizeof(tags_));
+      memset(tagged_, 0, sizeof(tagged_));
+    }
+
+    bool IsTagged(size_t index) const {
+      return ((tagged_[index / 64] >> (index % 64)) & 1) != 0;
+    }
+    int GetTag(size_t index) const {
+      VIXL_ASSERT(IsTagged(index));
+      return (tags_[index / 2] >> ((index % 2) * 4)) & 0xf;
+    }
+    void SetTag(size_t index, int tag) {
+      int shift = (index % 2) * 4;
+      uint8_t byte = tags_[index / 2] & ~(0xf << shift);
+      tags_[index / 2] = static_cast<uint8_t>(byte | (tag << shift));
+      if (!IsTagged(index)) {
+        tagged_[index / 64] |= UINT64_C(1) << (index % 64);
+        count_++;
+      }
+    }
+    // Returns true if the granule was tagged.
+    bool Clean(size_t index) {
+      if (!IsTagged(index)) return false;
+      tagged_[index / 64] &= ~(UINT64_C(1) << (index % 64));
+      count_--;
+      return true;
+    }
+    bool IsEmpty() const { return count_ == 0; }
+
+   private:
+    VIXL_STATIC_ASSERT((kGranules % 64) == 0);
+    uint8_t tags_[kGranules / 2];
+    uint64_t tagged_[kGranules / 64];
+    size_t count_;
+  };
+
+  static const uint64_t kNoPage = UINT64_MAX;
+
+  template <typename T>
+  static uint64_t GetGranuleIndex(T address) {
+    // Cast the address using a C-style cast. A reinterpret_cast would be
+    // appropriate, but it can't cast one integral type to another.
+    return (uint64_t)(AddressUntag(address)) >> kMTETagGranuleInBytesLog2;
+  }
+
+  // Partial granules at the end of a range are included.
+  static uint64_t GetGranuleCount(size_t length) {
+    return (length + kMTETagGranuleInBytes - 1) >> kMTETagGranuleInBytesLog2;
   }
 
-  size_t GetTotalCountMTE() { return metadata_mte_.size(); }
+  MTETagPage* FindPage(uint64_t granule) {
+    std::shared_ptr<MTETagPage>* entry = FindEntry(granule);
+    return (entry == nullptr) ? nullptr : entry->get();
+  }
+
+  // Like FindPage(), but first make a private copy of the page if it is shared
+  // with another depot.
+  MTETagPage* FindWritablePage(uint64_t granule) {
+    std::shared_ptr<MTETagPage>* entry = FindEntry(granule);
+    if (entry == nullptr) return nullptr;
+    if (entry->use_count() > 1) {
+      *entry = std::make_shared<MTETagPage>(**entry);
+    }
+    return entry->get();
+  }
+
+  std::shared_ptr<MTETagPage>* FindEntry(uint64_t granule) {
+    uint64_t page_number = granule / MTETagPage::kGranules;
+    // Accesses tend to be local, so most lookups hit the same page.
+    if (page_number == last_page_number_) return last_page_;
+    auto it = pages_mte_.find(page_number);
+    if (it == pages_mte_.end()) return nullptr;
+    last_page_number_ = page_number;
+    last_page_ = &it->second;
+    return last_page_;
+  }
+
+  MTETagPage* GetOrCreatePage(uint64_t granule) {
+    MTETagPage* page = FindWritablePage(granule);
+    if (page != nullptr) return page;
+    uint64_t page_number = granule / MTETagPage::kGranules;
+    std::shared_ptr<MTETagPage>& entry = pages_mte_[page_number];
+    entry = std::make_shared<MTETagPage>();
+    last_page_number_ = page_number;
+    last_page_ = &entry;
+    return entry.get();
+  }
+
+  // The tag pages, indexed by page number. Pages are allocated when the first
+  // granule in them is tagged, and freed when the last one is cleaned. Pages
+  // may be shared with copies of this depot.
+  std::unordered_map<uint64_t, std::shared_ptr<MTETagPage>> pages_mte_;
+  // The number of tagged granules.
+  size_t total_count_mte_;
+
+  // A cache of the most recently used entry in `pages_mte_`. Elements of an
+  // unordered_map are not moved by insertions, so this remains valid until the
+  // entry is erased.
+  uint64_t last_page_number_;
+  std::shared_ptr<MTETagPage>* last_page_;
+};
+
+
+// An optional description of the simulated guest address space.
+//
+// When an address space is attached to the Simulator (see
+// Simulator::SetAddressSpace()), every simulated load, store and instruction
+// fetch is checked against the registered regions. Accesses outside them, or
+// without the required permission, abort the simulation rather than touching
+// host memory, so that untrusted (for example, fuzzed) code can be simulated
+// in-process.
+//
+// Guest addresses are the same as host addresses; the regions only restrict
+// which of them the guest may use. Permissions are cached per page in a small
+// direct-mapped TLB, so only the first access to a page after the regions have
+// changed needs to search the region list. Pages that are only partly covered
+// by a region are not cached, and are always checked against the regions.
+class SimAddressSpace {
+ public:
+  enum Permission {
+    kNoAccess = 0,
+    kRead = 1 << 0,
+    kWrite = 1 << 1,
+    kExecute = 1 << 2,
+    kReadWrite = kRead | kWrite,
+    kReadExecute = kRead | kExecute
+  };
+
+  static const int kPageSizeLog2 = 12;
+  static const uint64_t kPageSize = UINT64_C(1) << kPageSizeLog2;
+
+  // Identifies a region for as long as it is registered. Identifiers are never
+  // reused by the same address space.
+  using RegionId = uint64_t;
+  static const RegionId kNoRegion = 0;
+
+  SimAddressSpace() : next_region_id_(kNoRegion + 1) { FlushTLB(); }
+
+  // Register [base, base + size) with the given permissions (a combination of
+  // `Permission` values). The region must not overlap an existing one.
+  RegionId AddRegion(uint64_t base, uint64_t size, int permissions);
+
+  // Remove the region starting at `base`, which must have been registered.
+  void RemoveRegion(uint64_t base);
+
+  // Remove the region returned by AddRegion() as `id`, if it is still
+  // registered. Return true if it was.
+  bool RemoveRegionWithId(RegionId id);
+
+  // Change the permissions of the region starting at `base`.
+  void SetPermissions(uint64_t base, int permissions);
+
+  // Remove all regions.
+  void Clear() {
+    regions_.clear();
+    FlushTLB();
+  }
+
+  size_t GetRegionCount() const { return regions_.size(); }
+
+  // Return true if every byte in [address, address + size) may be accessed
+  // with all of the permissions in `access`.
+  bool IsAccessAllowed(uint64_t address, size_t size, int access) {
+    VIXL_ASSERT(size > 0);
+    uint64_t page = address >> kPageSizeLog2;
+    if ((page == ((address + size - 1) >> kPageSizeLog2)) &&
+        (page != kInvalidPage)) {
+      TLBEntry* entry = &tlb_[page % kTLBEntries];
+      if (entry->page != page) Refill(entry, page);
+      if (entry->page == page) {
+        return (entry->permissions & access) == access;
+      }
+    }
+    // The access crosses a page boundary, or the page isn't uniform.
+    return IsAccessAllowedSlow(address, size, access);
+  }
 
  private:
-  // Tag recording of each allocated memory in the tag-granule.
-  std::unordered_map<uint64_t, class MetaDataMTE> metadata_mte_;
+  struct Region {
+    uint64_t base;
+    uint64_t size;
+    int permissions;
+    RegionId id;
+
+    uint64_t GetEnd() const { return base + size; }
+  };
+
+  struct TLBEntry {
+    uint64_t page;
+    int permissions;
+  };
+
+  static const size_t kTLBEntries = 64;
+  static const uint64_t kInvalidPage = ~UINT64_C(0);
+
+  void FlushTLB() {
+    for (size_t i = 0; i < kTLBEntries; i++) {
+      tlb_[i].page = kInvalidPage;
+      tlb_[i].permissions = kNoAccess;
+    }
+  }
+
+  // Return the region containing `address`, or nullptr if there is none.
+  const Region* FindRegion(uint64_t address) const;
+  std::vector<Region>::iterator FindRegionStartingAt(uint64_t base);
+
+  // Fill `entry` with the permissions of `page`, if they are the same for the
+  // whole page. Otherwise, leave `entry` untouched.
+  void Refill(TLBEntry* entry, uint64_t page) const;
+  bool IsAccessAllowedSlow(uint64_t address, size_t size, int access) const;
+
+  // Sorted by base address.
+  std::vector<Region> regions_;
+  RegionId next_region_id_;
+  TLBEntry tlb_[kTLBEntries];
 };
 
 
@@ -271,9 +540,10 @@ class Memory {
  public:
   explicit Memory(SimStack::Allocated stack) : stack_(std::move(stack)) {
     metadata_depot_ = nullptr;
+    address_space_ = nullptr;
   }
 
-  const SimStack::Allocated& GetStack() { return stack_; }
+  const SimStack::Allocated& GetStack() const { return stack_; }
 
   template <typename A>
   bool IsMTETagsMatched(A address, Instruction const* pc = nullptr) const {
@@ -298,6 +568,9 @@ class Memory {
     if (stack_.IsAccessInGuardRegion(base, sizeof(value))) {
       VIXL_ABORT_WITH_MSG("Attempt to read from stack guard region");
     }
+    if (!IsAccessAllowed(base, sizeof(value), SimAddressSpace::kRead)) {
+      VIXL_ABORT_WITH_MSG("Attempt to read from an unreadable address");
+    }
     if (!IsMTETagsMatched(address, pc)) {
       VIXL_ABORT_WITH_MSG("Tag mismatch.");
     }
@@ -314,6 +587,9 @@ class Memory {
     if (stack_.IsAccessInGuardRegion(base, sizeof(value))) {
       VIXL_ABORT_WITH_MSG("Attempt to write to stack guard region");
     }
+    if (!IsAccessAllowed(base, sizeof(value), SimAddressSpace::kWrite)) {
+      VIXL_ABORT_WITH_MSG("Attempt to write to an unwritable address");
+    }
     if (!IsMTETagsMatched(address, pc)) {
       VIXL_ABORT_WITH_MSG("Tag mismatch.");
     }
@@ -373,9 +649,27 @@ class Memory {
     metadata_depot_ = metadata_depot;
   }
 
+  SimAddressSpace* GetAddressSpace() const { return address_space_; }
+  void SetAddressSpace(SimAddressSpace* address_space) {
+    address_space_ = address_space;
+  }
+
+  // Return true if the access is permitted by the address space, or if there
+  // is no address space.
+  template <typename A>
+  bool IsAccessAllowed(A address, size_t size, int access) const {
+    if (address_space_ == nullptr) return true;
+    // Cast the address using a C-style cast. A reinterpret_cast would be
+    // appropriate, but it can't cast one integral type to another.
+    uint64_t addr = (uint64_t)AddressUntag(address);
+    return address_space_->IsAccessAllowed(addr, size, access);
+  }
+
  private:
   SimStack::Allocated stack_;
   MetaDataDepot* metadata_depot_;
+  // If set, all accesses are checked against this address space.
+  SimAddressSpace* address_space_;
 };
 
 // Represent a register (r0-r31, v0-v31, z0-z31, p0-p15).
@@ -458,6 +752,13 @@ class SimRegisterBase {
   // Return a pointer to the raw, underlying byte array.
   const uint8_t* GetBytes() const { return value_; }
 
+  // Return a writable pointer to the raw, underlying byte array, and treat the
+  // register as written.
+  uint8_t* GetBytesForWrite() {
+    NotifyRegisterWrite();
+    return value_;
+  }
+
   // TODO: Make this return a map of updated bytes, so that we can highlight
   // updated lanes for load-and-insert. (That never happens for scalar code, but
   // NEON has some instructions that can update individual lanes.)
@@ -581,6 +882,29 @@ class LogicPRegister {
     }
   }
 
+  // The accessors for word-parallel processing. The first `size_in_bytes`
+  // bytes of the predicate are accessed as 64-bit words, with the bit for the
+  // first byte lane in the least significant bit of the first word. Bits beyond
+  // `size_in_bytes` read as zero, and are not written.
+  static const int kMaxWordCount = kPRegMaxSizeInBytes / sizeof(uint64_t);
+
+  static int GetWordCount(unsigned size_in_bytes) {
+    return (size_in_bytes + sizeof(uint64_t) - 1) / sizeof(uint64_t);
+  }
+
+  void GetWords(uint64_t* words, unsigned size_in_bytes) const {
+    VIXL_ASSERT(size_in_bytes <= kPRegMaxSizeInBytes);
+    memset(words, 0, GetWordCount(size_in_bytes) * sizeof(uint64_t));
+    memcpy(words, register_.GetBytes(), size_in_bytes);
+  }
+
+  void SetWords(const uint64_t* words, unsigned size_in_bytes) {
+    VIXL_ASSERT(size_in_bytes <= register_.GetSizeInBytes());
+    memcpy(register_.GetBytesForWrite(), words, size_in_bytes);
+  }
+
+  unsigned GetSizeInBytes() const { return register_.GetSizeInBytes(); }
+
   template <typename T>
   T GetActiveMask(int lane) const {
     return register_.GetLane<T>(lane);
@@ -632,13 +956,16 @@ class LogicVRegister {
  public:
   inline LogicVRegister(
       SimVRegister& other)  // NOLINT(runtime/references)(runtime/explicit)
-      : register_(other) {
-    for (size_t i = 0; i < ArrayLength(saturated_); i++) {
-      saturated_[i] = kNotSaturated;
-    }
-    for (size_t i = 0; i < ArrayLength(round_); i++) {
-      round_[i] = 0;
-    }
+      : register_(other), saturated_lanes_(0), round_lanes_(0) {}
+
+  LogicVRegister(const LogicVRegister& other)
+      : register_(other.register_),
+        saturated_lanes_(other.saturated_lanes_),
+        round_lanes_(other.round_lanes_) {
+    std::copy(other.saturated_,
+              other.saturated_ + saturated_lanes_,
+              saturated_);
+    std::copy(other.round_, other.round_ + round_lanes_, round_);
   }
 
   int64_t Int(VectorFormat vform, int index) const {
@@ -761,6 +1088,18 @@ class LogicVRegister {
     }
   }
 
+  // Access the lanes as a contiguous byte array, lane 0 first, for helpers
+  // that process a whole vector at once.
+  const uint8_t* GetLaneBytes(VectorFormat vform) const {
+    if (IsSVEFormat(vform)) register_.NotifyAccessAsZ();
+    return register_.GetBytes();
+  }
+
+  uint8_t* GetLaneBytesForWrite(VectorFormat vform) const {
+    if (IsSVEFormat(vform)) register_.NotifyAccessAsZ();
+    return register_.GetBytesForWrite();
+  }
+
   template <typename T>
   T Float(int index) const {
     return register_.GetLane<T>(index);
@@ -806,15 +1145,17 @@ class LogicVRegister {
 
   // Getters for saturation state.
   Saturation GetSignedSaturation(int index) {
-    return static_cast<Saturation>(saturated_[index] & kSignedSatMask);
+    return static_cast<Saturation>(GetSat(index) & kSignedSatMask);
   }
 
   Saturation GetUnsignedSaturation(int index) {
-    return static_cast<Saturation>(saturated_[index] & kUnsignedSatMask);
+    return static_cast<Saturation>(GetSat(index) & kUnsignedSatMask);
   }
 
   // Setters for saturation state.
-  void ClearSat(int index) { saturated_[index] = kNotSaturated; }
+  void ClearSat(int index) {
+    if (index < saturated_lanes_) saturated_[index] = kNotSaturated;
+  }
 
   void SetSignedSat(int index, bool positive) {
     SetSatFlag(index, positive ? kSignedSatPositive : kSignedSatNegative);
@@ -825,6 +1166,10 @@ class LogicVRegister {
   }
 
   void SetSatFlag(int index, Saturation sat) {
+    VIXL_ASSERT(static_cast<size_t>(index) < ArrayLength(saturated_));
+    while (saturated_lanes_ <= index) {
+      saturated_[saturated_lanes_++] = kNotSaturated;
+    }
     saturated_[index] = static_cast<Saturation>(saturated_[index] | sat);
     VIXL_ASSERT((sat & kUnsignedSatMask) != kUnsignedSatUndefined);
     VIXL_ASSERT((sat & kSignedSatMask) != kSignedSatUndefined);
@@ -856,10 +1201,21 @@ class LogicVRegister {
   }
 
   // Getter for rounding state.
-  bool GetRounding(int index) { return round_[index]; }
+  bool GetRounding(int index) {
+    return (index < round_lanes_) ? round_[index] : false;
+  }
 
   // Setter for rounding state.
-  void SetRounding(int index, bool round) { round_[index] = round; }
+  void SetRounding(int index, bool round) {
+    VIXL_ASSERT(static_cast<size_t>(index) < ArrayLength(round_));
+    if (index >= round_lanes_) {
+      // Lanes that have not been written are implicitly not rounded.
+      if (!round) return;
+      while (round_lanes_ < index) round_[round_lanes_++] = false;
+      round_lanes_++;
+    }
+    round_[index] = round;
+  }
 
   // Round lanes of a vector based on rounding state.
   LogicVRegister& Round(VectorFormat vform) {
@@ -915,12 +1271,23 @@ class LogicVRegister {
  private:
   SimVRegister& register_;
 
+  Saturation GetSat(int index) const {
+    return (index < saturated_lanes_) ? saturated_[index] : kNotSaturated;
+  }
+
   // Allocate one saturation state entry per lane; largest register is type Q,
   // and lanes can be a minimum of one byte wide.
+  //
+  // Most operations never touch the saturation or rounding state, so it is
+  // not initialised on construction. Only the first `saturated_lanes_` and
+  // `round_lanes_` entries are valid; the remaining lanes are implicitly not
+  // saturated and not rounded.
   Saturation saturated_[kZRegMaxSizeInBytes];
+  int saturated_lanes_;
 
   // Allocate one rounding state entry per lane.
   bool round_[kZRegMaxSizeInBytes];
+  int round_lanes_;
 };
 
 // Represent an SVE addressing mode and abstract per-lane address generation to
@@ -1093,9 +1460,7 @@ class SimSystemRegister {
 
 class SimExclusiveLocalMonitor {
  public:
-  SimExclusiveLocalMonitor() : kSkipClearProbability(8), seed_(0x87654321) {
-    Clear();
-  }
+  SimExclusiveLocalMonitor() : seed_(0x87654321) { Clear(); }
 
   // Clear the exclusive monitor (like clrex).
   void Clear() {
@@ -1131,7 +1496,7 @@ class SimExclusiveLocalMonitor {
   uint64_t address_;
   size_t size_;
 
-  const int kSkipClearProbability;
+  static const int kSkipClearProbability = 8;
   uint32_t seed_;
 };
 
@@ -1141,7 +1506,7 @@ class SimExclusiveLocalMonitor {
 // fail, according to kPassProbability.
 class SimExclusiveGlobalMonitor {
  public:
-  SimExclusiveGlobalMonitor() : kPassProbability(8), seed_(0x87654321) {}
+  SimExclusiveGlobalMonitor() : seed_(0x87654321) {}
 
   bool IsExclusive(uint64_t address, size_t size) {
     USE(address, size);
@@ -1153,7 +1518,7 @@ class SimExclusiveGlobalMonitor {
   }
 
  private:
-  const int kPassProbability;
+  static const int kPassProbability = 8;
   uint32_t seed_;
 };
 
@@ -1166,6 +1531,64 @@ class Simulator : public DecoderVisitor {
 
   void ResetState();
 
+  // A copy of the simulated architectural state: the general-purpose, vector,
+  // predicate and FFR registers, NZCV and FPCR, the exclusive monitors, the pc
+  // and BType, the contents of the Simulator's stack, and the MTE tags.
+  //
+  // Snapshots allow many runs to start from a common prefix without
+  // simulating the prefix each time:
+  //
+  //   simulator.RunFrom(prefix);
+  //   Simulator::Snapshot snapshot;
+  //   simulator.TakeSnapshot(&snapshot);
+  //   for (...) {
+  //     simulator.RestoreSnapshot(snapshot);
+  //     simulator.RunFrom(variant);
+  //   }
+  //
+  // MTE tag pages are shared between the Simulator and its snapshots, and are
+  // only copied when they are modified. Memory other than the stack, such as
+  // the code buffer or heap data used by the simulated code, is not captured.
+  //
+  // A snapshot can only be restored into the Simulator that took it. It can
+  // be restored any number of times, and reused for later snapshots.
+  class Snapshot {
+   public:
+    Snapshot() : simulator_(nullptr) {}
+
+    bool IsValid() const { return simulator_ != nullptr; }
+
+   private:
+    friend class Simulator;
+
+    const Simulator* simulator_;
+
+    SimRegister registers_[kNumberOfRegisters];
+    SimVRegister vregisters_[kNumberOfVRegisters];
+    SimPRegister pregisters_[kNumberOfPRegisters];
+    SimFFRRegister ffr_register_;
+    SimSystemRegister nzcv_;
+    SimSystemRegister fpcr_;
+    unsigned vector_length_;
+
+    SimExclusiveLocalMonitor local_monitor_;
+    SimExclusiveGlobalMonitor global_monitor_;
+
+    const Instruction* pc_;
+    const Instruction* last_instr_;
+    uint32_t form_hash_;
+    BType btype_;
+    BType next_btype_;
+    uint16_t rand_state_[3];
+
+    // The usable part of the stack, from the limit to the base.
+    std::vector<char> stack_;
+    MetaDataDepot meta_data_;
+  };
+
+  void TakeSnapshot(Snapshot* snapshot) const;
+  void RestoreSnapshot(const Snapshot& snapshot);
+
   // Run the simulator.
   virtual void Run();
   void RunFrom(const Instruction* first);
@@ -1266,13 +1689,82 @@ class Simulator : public DecoderVisitor {
   bool PcIsInGuardedPage() const { return guard_pages_; }
   void SetGuardedPages(bool guard_pages) { guard_pages_ = guard_pages; }
 
+  // Check all simulated memory accesses and instruction fetches against
+  // `address_space`, or stop checking them if it is nullptr. The Simulator's
+  // stack is registered in the address space as readable and writable, and
+  // that region (and only that region) is removed from it again when it is
+  // detached or replaced.
+  //
+  // The address space is not owned by the Simulator, and must outlive it (or
+  // be detached first).
+  void SetAddressSpace(SimAddressSpace* address_space);
+  SimAddressSpace* GetAddressSpace() const {
+    return memory_.GetAddressSpace();
+  }
+
+  bool IsFetchAllowed(const Instruction* pc) const {
+    return memory_.IsAccessAllowed(pc,
+                                   kInstructionSize,
+                                   SimAddressSpace::kExecute);
+  }
+
   const Instruction* GetLastExecutedInstruction() const { return last_instr_; }
 
+  // The Simulator can cache the decoded form of each instruction that it
+  // executes, keyed by address, so that instructions executed repeatedly (for
+  // example in loops) don't walk the decode graph every time. The cache is
+  // direct-mapped, with `entries` entries, which must be a power of two.
+  //
+  // Each entry is checked against the instruction's encoding when it is used,
+  // so code that is patched in place is always re-decoded. Entries can also be
+  // discarded explicitly using FlushDecodeCache(), and simulated `ic ivau`
+  // instructions flush the entries for the cache line that they operate on.
+  //
+  // The cache is only used when the Simulator and its CPUFeaturesAuditor are
+  // the only visitors registered with the decoder. Other visitors, such as the
+  // disassembler used for tracing, cause instructions to be decoded normally.
+  void EnableDecodeCache(size_t entries = kDefaultDecodeCacheEntries);
+  void DisableDecodeCache() { decode_cache_.clear(); }
+  bool IsDecodeCacheEnabled() const { return !decode_cache_.empty(); }
+  void FlushDecodeCache();
+  void FlushDecodeCache(const void* address, size_t size);
+
+  // In block execution mode, Run() translates each straight-line sequence of
+  // instructions (up to and including the next branch or exception-generating
+  // instruction) into an array of decoded handlers, and executes the whole
+  // block without returning to the interpreter loop. Up to `blocks`
+  // translations are kept, in a direct-mapped cache keyed by the address of
+  // the first instruction. `blocks` must be a power of two.
+  //
+  // Like the decode cache, each instruction is checked against its encoding
+  // before it is executed, and FlushDecodeCache() discards translated blocks.
+  //
+  // Block execution has the same restrictions as the decode cache. In
+  // addition, the Simulator falls back to ExecuteInstruction() whenever
+  // tracing is enabled, or when BTI guarded pages are in use.
+  void EnableBlockExecution(size_t blocks = kDefaultDecodeBlockCount);
+  void DisableBlockExecution();
+  bool IsBlockExecutionEnabled() const { return !decode_blocks_.empty(); }
+
+  // Common integer vector operations without saturation or predication (such
+  // as add, sub, mul, the bitwise operations and comparisons) normally use
+  // kernels that process the whole vector as an array of lanes, which the host
+  // compiler can vectorise. These can be disabled, so that the lane-by-lane
+  // reference implementations are used instead, for example to check that the
+  // two agree.
+  void EnableVectorKernels() { vector_kernels_enabled_ = true; }
+  void DisableVectorKernels() { vector_kernels_enabled_ = false; }
+  bool AreVectorKernelsEnabled() const { return vector_kernels_enabled_; }
+
   void ExecuteInstruction() {
     // The program counter should always be aligned.
     VIXL_ASSERT(IsWordAligned(pc_));
     pc_modified_ = false;
 
+    if (!IsFetchAllowed(pc_)) {
+      VIXL_ABORT_WITH_MSG("Attempt to execute from a non-executable address");
+    }
+
     // On guarded pages, if BType is not zero, take an exception on any
     // instruction other than BTI, PACI[AB]SP, HLT or BRK.
     if (PcIsInGuardedPage() && (ReadBType() != DefaultBType)) {
@@ -1296,7 +1788,11 @@ class Simulator : public DecoderVisitor {
     //  3. The Simulator (`this`).
     // User can add additional visitors at any point, but the Simulator requires
     // that the ordering above is preserved.
-    decoder_->Decode(pc_);
+    if (IsDecodeCacheEnabled() && CanUseDecodeCache()) {
+      VisitUsingDecodeCache();
+    } else {
+      decoder_->Decode(pc_);
+    }
 
     if (last_instr_was_movprfx) {
       VIXL_ASSERT(last_instr_ != NULL);
@@ -2941,34 +3437,21 @@ class Simulator : public DecoderVisitor {
   bool IsFirstActive(VectorFormat vform,
                      const LogicPRegister& mask,
                      const LogicPRegister& bits) {
-    for (int i = 0; i < LaneCountFromFormat(vform); i++) {
-      if (mask.IsActive(vform, i)) {
-        return bits.IsActive(vform, i);
-      }
-    }
-    return false;
+    int first = GetFirstActive(vform, mask);
+    return (first >= 0) && bits.IsActive(vform, first);
   }
 
   bool AreNoneActive(VectorFormat vform,
                      const LogicPRegister& mask,
                      const LogicPRegister& bits) {
-    for (int i = 0; i < LaneCountFromFormat(vform); i++) {
-      if (mask.IsActive(vform, i) && bits.IsActive(vform, i)) {
-        return false;
-      }
-    }
-    return true;
+    return CountActiveAndTrueLanes(vform, mask, bits) == 0;
   }
 
   bool IsLastActive(VectorFormat vform,
                     const LogicPRegister& mask,
                     const LogicPRegister& bits) {
-    for (int i = LaneCountFromFormat(vform) - 1; i >= 0; i--) {
-      if (mask.IsActive(vform, i)) {
-        return bits.IsActive(vform, i);
-      }
-    }
-    return false;
+    int last = GetLastActive(vform, mask);
+    return (last >= 0) && bits.IsActive(vform, last);
   }
 
   void PredTest(VectorFormat vform,
@@ -2985,11 +3468,9 @@ class Simulator : public DecoderVisitor {
 
   template <typename T>
   size_t CleanGranuleTag(T address, size_t length = kMTETagGranuleInBytes) {
-    size_t count = 0;
-    for (size_t offset = 0; offset < length; offset += kMTETagGranuleInBytes) {
-      count +=
-          meta_data_.CleanMTETag(reinterpret_cast<uintptr_t>(address) + offset);
-    }
+    size_t count =
+        meta_data_.CleanMTETagRange(reinterpret_cast<uintptr_t>(address),
+                                    length);
     size_t expected =
         length / kMTETagGranuleInBytes + (length % kMTETagGranuleInBytes != 0);
 
@@ -3010,9 +3491,7 @@ class Simulator : public DecoderVisitor {
   void SetGranuleTag(T address,
                      int tag,
                      size_t length = kMTETagGranuleInBytes) {
-    for (size_t offset = 0; offset < length; offset += kMTETagGranuleInBytes) {
-      meta_data_.SetMTETag((uintptr_t)(address) + offset, tag);
-    }
+    meta_data_.SetMTETagRange((uintptr_t)(address), length, tag);
   }
 
   template <typename T>
@@ -3297,6 +3776,16 @@ class Simulator : public DecoderVisitor {
                      LogicVRegister dst,
                      const LogicVRegister& src1,
                      const LogicVRegister& src2);
+  // Like add() and sub(), but without recording saturation state, so the
+  // result can't be saturated or halved afterwards.
+  LogicVRegister add_nosat(VectorFormat vform,
+                           LogicVRegister dst,
+                           const LogicVRegister& src1,
+                           const LogicVRegister& src2);
+  LogicVRegister sub_nosat(VectorFormat vform,
+                           LogicVRegister dst,
+                           const LogicVRegister& src1,
+                           const LogicVRegister& src2);
   // Add `value` to each lane of `src1`, treating `value` as unsigned for the
   // purposes of setting the saturation flags.
   LogicVRegister add_uint(VectorFormat vform,
@@ -4690,10 +5179,13 @@ class Simulator : public DecoderVisitor {
 
   static const uint32_t CRC32_POLY = 0x04C11DB7;
   static const uint32_t CRC32C_POLY = 0x1EDC6F41;
-  uint32_t Poly32Mod2(unsigned n, uint64_t data, uint32_t poly);
   template <typename T>
   uint32_t Crc32Checksum(uint32_t acc, T val, uint32_t poly);
-  uint32_t Crc32Checksum(uint32_t acc, uint64_t val, uint32_t poly);
+  // Accumulate the low `size` bytes of `val` into the checksum `acc`.
+  uint32_t Crc32Checksum(uint32_t acc,
+                         uint64_t val,
+                         int size,
+                         uint32_t poly);
 
   void SysOp_W(int op, int64_t val);
 
@@ -4929,6 +5421,28 @@ class Simulator : public DecoderVisitor {
                               const LogicPRegister& pg,
                               const LogicPRegister& pn) const;
 
+  // Read the predicate bits of `pg` for the current vector length into
+  // `words`, keeping only the bit that governs each lane of `vform`. Return the
+  // number of words read.
+  int GetPredicateLaneWords(VectorFormat vform,
+                            const LogicPRegister& pg,
+                            uint64_t* words) const;
+
+  // Make lanes [begin, end) of `vform` active in `pd`, and clear every other
+  // predicate bit within the current vector length.
+  void SetActiveLaneRange(VectorFormat vform,
+                          LogicPRegister pd,
+                          int begin,
+                          int end);
+
+  // Set each active lane of `pd` that comes before the first active lane that
+  // is true in `pn`, or at it if `include_break` is set. Clear the other active
+  // lanes, and leave inactive lanes unchanged. Only B-sized lanes are used.
+  void PartitionBreak(LogicPRegister pd,
+                      const LogicPRegister& pg,
+                      const LogicPRegister& pn,
+                      bool include_break);
+
   // Count the number of lanes referred to by `pattern`, given the vector
   // length. If `pattern` is not a recognised SVEPredicateConstraint, this
   // returns zero.
@@ -4996,6 +5510,9 @@ class Simulator : public DecoderVisitor {
 
   Memory memory_;
 
+  // The region registered for the stack in memory_'s address space, if any.
+  SimAddressSpace::RegionId stack_region_;
+
   static const size_t kDefaultStackGuardStartSize = 0;
   static const size_t kDefaultStackGuardEndSize = 4 * 1024;
   static const size_t kDefaultStackUsableSize = 8 * 1024;
@@ -5032,13 +5549,58 @@ class Simulator : public DecoderVisitor {
   static const char* preg_names[];
 
  private:
-  using FormToVisitorFnMap =
-      std::unordered_map<uint32_t,
-                         std::function<void(Simulator*, const Instruction*)>>;
+  using FormToVisitorFn = std::function<void(Simulator*, const Instruction*)>;
+  using FormToVisitorFnMap = std::unordered_map<uint32_t, FormToVisitorFn>;
+  using FormToVisitorFnTable = FormIdTable<FormToVisitorFn>;
   static const FormToVisitorFnMap* GetFormToVisitorFnMap();
+  static const FormToVisitorFnTable* GetFormToVisitorFnTable();
 
   uint32_t form_hash_;
 
+  // An entry in the decode cache. See EnableDecodeCache().
+  struct DecodeCacheEntry {
+    const Instruction* address;
+    Instr encoding;
+    FormId form_id;
+    uint32_t form_hash;
+    const FormToVisitorFn* handler;
+  };
+
+  static const size_t kDefaultDecodeCacheEntries = 4096;
+
+  // The size of the region flushed from the decode cache by `ic ivau`.
+  static const size_t kDecodeCacheFlushGranule = 64;
+
+  // A block of consecutive instructions, translated for block execution. The
+  // entries for each block are held in `decode_block_entries_`, at
+  // `kMaxDecodeBlockLength * <index of the block>`. See EnableBlockExecution().
+  struct DecodeBlock {
+    const Instruction* start;
+    size_t length;
+  };
+
+  static const size_t kDefaultDecodeBlockCount = 1024;
+  static const size_t kMaxDecodeBlockLength = 32;
+
+  bool CanUseDecodeCache();
+  void VisitUsingDecodeCache();
+  void FillDecodeCacheEntry(DecodeCacheEntry* entry, const Instruction* instr);
+  void VisitDecodeCacheEntry(const DecodeCacheEntry* entry);
+
+  bool CanUseBlockExecution();
+  void TranslateBlock(DecodeBlock* block);
+  void ExecuteBlock();
+
+  std::vector<DecodeCacheEntry> decode_cache_;
+  std::vector<DecodeBlock> decode_blocks_;
+  std::vector<DecodeCacheEntry> decode_block_entries_;
+
+  // This is incremented whenever translated blocks are created or discarded,
+  // so that ExecuteBlock() can tell when its block is no longer valid.
+  uint64_t decode_block_generation_;
+
+  bool vector_kernels_enabled_;
+
   static const PACKey kPACKeyIA;
   static const PACKey kPACKeyIB;
   static const PACKey kPACKeyDA;
@@ -0,0 +1,115 @@
+// Copyright 2026, VIXL authors
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//   * Redistributions of source code must retain the above copyright notice,
+//     this list of conditions and the following disclaimer.
+//   * Redistributions in binary form must reproduce the above copyright notice,
+//     this list of conditions and the following disclaimer in the documentation
+//     and/or other materials provided with the distribution.
+//   * Neither the name of ARM Limited nor the names of its contributors may be
+//     used to endorse or promote products derived from this software without
+//     specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS CONTRIBUTORS "AS IS" AND
+// ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+// WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include <algorithm>
+#include <cstdlib>
+
+#include "arena-vixl.h"
+
+namespace vixl {
+
+const size_t Arena::kDefaultChunkSize;
+const size_t Arena::kMaxChunkSize;
+
+Arena::Arena(size_t chunk_size, ArenaChunkAllocator* allocator)
+    : allocator_(allocator),
+      chunks_(NULL),
+      cursor_(0),
+      limit_(0),
+      next_chunk_size_(chunk_size),
+      allocated_size_(0) {}
+
+
+Arena::~Arena() { FreeChunks(chunks_); }
+
+
+void* Arena::AllocateInNewChunk(size_t size) {
+  // Grow the chunks geometrically, so that large or busy arenas need few of
+  // them. Every chunk must also be large enough for the allocation.
+  size_t header_size = GetChunkStart(NULL);
+  size_t chunk_size = std::max(next_chunk_size_, header_size + size);
+  next_chunk_size_ = std::min(2 * next_chunk_size_, kMaxChunkSize);
+
+  void* memory = (allocator_ == NULL) ? malloc(chunk_size)
+                                      : allocator_->AllocateChunk(chunk_size);
+  Chunk* chunk = reinterpret_cast<Chunk*>(memory);
+  VIXL_CHECK(chunk != NULL);
+  chunk->previous = chunks_;
+  chunk->size = chunk_size;
+  chunks_ = chunk;
+
+  uintptr_t start = GetChunkStart(chunk);
+  cursor_ = start + size;
+  limit_ = reinterpret_cast<uintptr_t>(chunk) + chunk_size;
+  allocated_size_ += size;
+  return reinterpret_cast<void*>(start);
+}
+
+
+void Arena::FreeChunks(Chunk* chunk) {
+  while (chunk != NULL) {
+    Chunk* previous = chunk->previous;
+    if (allocator_ == NULL) {
+      free(chunk);
+    } else {
+      allocator_->FreeChunk(chunk, chunk->size);
+    }
+    chunk = previous;
+  }
+}
+
+
+void Arena::Reset() {
+  if (chunks_ != NULL) {
+    // Keep the most recent chunk, which is also the largest.
+    FreeChunks(chunks_->previous);
+    chunks_->previous = NULL;
+    cursor_ = GetChunkStart(chunks_);
+  }
+  allocated_size_ = 0;
+}
+
+
+void Arena::SetChunkAllocator(ArenaChunkAllocator* allocator) {
+  VIXL_ASSERT(allocated_size_ == 0);
+  FreeChunks(chunks_);
+  chunks_ = NULL;
+  cursor_ = 0;
+  limit_ = 0;
+  allocator_ = allocator;
+}
+
+
+bool Arena::Contains(const void* address) const {
+  uintptr_t value = reinterpret_cast<uintptr_t>(address);
+  for (const Chunk* chunk = chunks_; chunk != NULL; chunk = chunk->previous) {
+    uintptr_t start = reinterpret_cast<uintptr_t>(chunk);
+    if ((value >= start) && (value < (start + chunk->size))) return true;
+  }
+  return false;
+}
+
+}  // namespace vixl
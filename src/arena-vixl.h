@@ -0,0 +1,136 @@
+// Copyright 2026, VIXL authors
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//   * Redistributions of source code must retain the above copyright notice,
+//     this list of conditions and the following disclaimer.
+//   * Redistributions in binary form must reproduce the above copyright notice,
+//     this list of conditions and the following disclaimer in the documentation
+//     and/or other materials provided with the distribution.
+//   * Neither the name of ARM Limited nor the names of its contributors may be
+//     used to endorse or promote products derived from this software without
+//     specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS CONTRIBUTORS "AS IS" AND
+// ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+// WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef VIXL_ARENA_H
+#define VIXL_ARENA_H
+
+#include <cstddef>
+#include <new>
+#include <utility>
+
+#include "globals-vixl.h"
+#include "utils-vixl.h"
+
+namespace vixl {
+
+// The source of an Arena's chunks. By default, arenas use malloc and free;
+// embedders that manage their own memory can supply an implementation of this
+// interface instead.
+class ArenaChunkAllocator {
+ public:
+  virtual ~ArenaChunkAllocator() {}
+
+  // Return a block of at least `size` bytes, aligned for any type, or NULL.
+  virtual void* AllocateChunk(size_t size) = 0;
+  // Release a block returned by AllocateChunk(size).
+  virtual void FreeChunk(void* chunk, size_t size) = 0;
+};
+
+// A bump allocator for short-lived objects, such as the literals that a
+// MacroAssembler creates for its own use.
+//
+// Memory is taken from large chunks, and is only returned when the whole
+// arena is reset, so allocation is cheap and nothing is freed individually.
+// Destructors are not called by the arena: owners of objects with non-trivial
+// destructors must call them before the arena is reset. After a reset, the
+// arena keeps its most recent chunk, so an arena that is reset regularly (for
+// example, once per generated function) stops allocating chunks altogether.
+class Arena {
+ public:
+  static const size_t kDefaultChunkSize = 4 * KBytes;
+  static const size_t kMaxChunkSize = 256 * KBytes;
+
+  // If `allocator` is NULL, chunks are allocated with malloc. Otherwise,
+  // `allocator` must outlive the arena.
+  explicit Arena(size_t chunk_size = kDefaultChunkSize,
+                 ArenaChunkAllocator* allocator = NULL);
+  ~Arena();
+
+  // Change the source of the arena's chunks. This releases every chunk, so
+  // nothing may be allocated in the arena; call it before first use, or just
+  // after Reset().
+  void SetChunkAllocator(ArenaChunkAllocator* allocator);
+
+  // Allocate `size` bytes, aligned to `alignment`, which must be a power of
+  // two no larger than the alignment of std::max_align_t.
+  void* Allocate(size_t size, size_t alignment = alignof(std::max_align_t)) {
+    VIXL_ASSERT(IsPowerOf2(alignment));
+    VIXL_ASSERT(alignment <= alignof(std::max_align_t));
+    uintptr_t start = (cursor_ + (alignment - 1)) & ~(alignment - 1);
+    if ((start < cursor_) || (start > limit_) || ((limit_ - start) < size)) {
+      return AllocateInNewChunk(size);
+    }
+    cursor_ = start + size;
+    allocated_size_ += size;
+    return reinterpret_cast<void*>(start);
+  }
+
+  // Allocate and construct a T.
+  template <typename T, typename... Args>
+  T* New(Args&&... args) {
+    return new (Allocate(sizeof(T), alignof(T)))
+        T(std::forward<Args>(args)...);
+  }
+
+  // Release everything allocated so far.
+  void Reset();
+
+  // Return true if `address` points into memory allocated by this arena.
+  bool Contains(const void* address) const;
+
+  // The number of bytes allocated since the last reset.
+  size_t GetAllocatedSize() const { return allocated_size_; }
+
+ private:
+  struct Chunk {
+    Chunk* previous;
+    size_t size;
+  };
+
+  static uintptr_t GetChunkStart(const Chunk* chunk) {
+    return AlignUp(reinterpret_cast<uintptr_t>(chunk) + sizeof(Chunk),
+                   alignof(std::max_align_t));
+  }
+
+  void* AllocateInNewChunk(size_t size);
+  void FreeChunks(Chunk* chunk);
+
+  // The source of the chunks, or NULL to use malloc.
+  ArenaChunkAllocator* allocator_;
+  // The chunks, most recent first.
+  Chunk* chunks_;
+  uintptr_t cursor_;
+  uintptr_t limit_;
+  size_t next_chunk_size_;
+  size_t allocated_size_;
+
+  Arena(const Arena&) = delete;
+  Arena& operator=(const Arena&) = delete;
+};
+
+}  // namespace vixl
+
+#endif  // VIXL_ARENA_H
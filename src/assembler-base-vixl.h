@@ -28,6 +28,7 @@
 #define VIXL_ASSEMBLER_BASE_H
 
 #include "code-buffer-vixl.h"
+#include "code-space-vixl.h"
 
 // Microsoft Visual C++ defines a `mvn` macro that conflicts with our own
 // definition.
@@ -48,6 +49,8 @@ class AssemblerBase {
       : buffer_(capacity), allow_assembler_(false) {}
   AssemblerBase(byte* buffer, size_t capacity)
       : buffer_(buffer, capacity), allow_assembler_(false) {}
+  AssemblerBase(CodeSpace* space, size_t capacity)
+      : buffer_(space, capacity), allow_assembler_(false) {}
 
   virtual ~AssemblerBase() {}
 
@@ -27,10 +27,14 @@
 #ifdef VIXL_CODE_BUFFER_MMAP
 extern "C" {
 #include <sys/mman.h>
+#include <unistd.h>
 }
 #endif
 
+#include <algorithm>
+
 #include "code-buffer-vixl.h"
+#include "code-space-vixl.h"
 #include "utils-vixl.h"
 
 namespace vixl {
@@ -47,7 +51,10 @@ CodeBuffer::CodeBuffer(size_t capacity)
       managed_(true),
       cursor_(NULL),
       dirty_(false),
-      capacity_(capacity) {
+      capacity_(capacity),
+      space_(NULL),
+      reserved_size_(0),
+      executable_offset_(0) {
   if (capacity_ == 0) {
     return;
   }
@@ -77,14 +84,35 @@ CodeBuffer::CodeBuffer(byte* buffer, size_t capacity)
       managed_(false),
       cursor_(reinterpret_cast<byte*>(buffer)),
       dirty_(false),
-      capacity_(capacity) {
+      capacity_(capacity),
+      space_(NULL),
+      reserved_size_(0),
+      executable_offset_(0) {
   VIXL_ASSERT(buffer_ != NULL);
 }
 
 
+CodeBuffer::CodeBuffer(CodeSpace* space, size_t capacity, size_t reservation)
+    : buffer_(NULL),
+      managed_(true),
+      cursor_(NULL),
+      dirty_(false),
+      capacity_(AlignUp(std::max<size_t>(capacity, 1), space->GetPageSize())),
+      space_(space),
+      reserved_size_(std::max(capacity_, reservation)),
+      executable_offset_(space->GetExecutableOffset()) {
+  buffer_ = space_->Allocate(&reserved_size_);
+  VIXL_ASSERT(IsWordAligned(buffer_));
+  VIXL_ASSERT(capacity_ <= reserved_size_);
+  cursor_ = buffer_;
+}
+
+
 CodeBuffer::~CodeBuffer() VIXL_NEGATIVE_TESTING_ALLOW_EXCEPTION {
   VIXL_ASSERT(!IsDirty());
-  if (managed_) {
+  if (space_ != NULL) {
+    space_->Free(buffer_, reserved_size_);
+  } else if (managed_) {
 #ifdef VIXL_CODE_BUFFER_MALLOC
     free(buffer_);
 #elif defined(VIXL_CODE_BUFFER_MMAP)
@@ -97,6 +125,10 @@ CodeBuffer::~CodeBuffer() VIXL_NEGATIVE_TESTING_ALLOW_EXCEPTION {
 
 
 void CodeBuffer::SetExecutable() {
+  if (space_ != NULL) {
+    space_->SetExecutable(buffer_, GetSizeInBytes());
+    return;
+  }
 #ifdef VIXL_CODE_BUFFER_MMAP
   int ret = mprotect(buffer_, capacity_, PROT_READ | PROT_EXEC);
   VIXL_CHECK(ret == 0);
@@ -109,6 +141,10 @@ void CodeBuffer::SetExecutable() {
 
 
 void CodeBuffer::SetWritable() {
+  if (space_ != NULL) {
+    space_->SetWritable(buffer_, capacity_);
+    return;
+  }
 #ifdef VIXL_CODE_BUFFER_MMAP
   int ret = mprotect(buffer_, capacity_, PROT_READ | PROT_WRITE);
   VIXL_CHECK(ret == 0);
@@ -120,6 +156,58 @@ void CodeBuffer::SetWritable() {
 }
 
 
+void CodeBuffer::SetExecutable(ptrdiff_t offset, size_t size) {
+  SetProtection(offset, size, true);
+}
+
+
+void CodeBuffer::SetWritable(ptrdiff_t offset, size_t size) {
+  SetProtection(offset, size, false);
+}
+
+
+void CodeBuffer::SetProtection(ptrdiff_t offset,
+                               size_t size,
+                               bool executable) {
+  VIXL_ASSERT((offset >= 0) && ((offset + size) <= capacity_));
+  if (size == 0) return;
+  if (space_ != NULL) {
+    if (executable) {
+      space_->SetExecutable(buffer_ + offset, size);
+    } else {
+      space_->SetWritable(buffer_ + offset, size);
+    }
+    return;
+  }
+#ifdef VIXL_CODE_BUFFER_MMAP
+  // The backing store is page-aligned, so the pages covering the range are
+  // all within it.
+  size_t page_size = GetPageSize();
+  byte* start = AlignDown(buffer_ + offset, page_size);
+  byte* end = AlignUp(buffer_ + offset + size, page_size);
+  int prot = executable ? (PROT_READ | PROT_EXEC) : (PROT_READ | PROT_WRITE);
+  int ret = mprotect(start, end - start, prot);
+  VIXL_CHECK(ret == 0);
+#else
+  // This requires page-aligned memory blocks, which we can only guarantee with
+  // mmap.
+  USE(executable);
+  VIXL_UNIMPLEMENTED();
+#endif
+}
+
+
+size_t CodeBuffer::GetPageSize() {
+#ifdef VIXL_CODE_BUFFER_MMAP
+  static const size_t page_size = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+  return page_size;
+#else
+  // Protections cannot be changed, so any granularity will do.
+  return 4 * KBytes;
+#endif
+}
+
+
 void CodeBuffer::EmitString(const char* string) {
   const auto len = strlen(string) + 1;
   VIXL_ASSERT(HasSpaceFor(len));
@@ -175,6 +263,13 @@ void CodeBuffer::Reset() {
 void CodeBuffer::Grow(size_t new_capacity) {
   VIXL_ASSERT(managed_);
   VIXL_ASSERT(new_capacity > capacity_);
+  if (space_ != NULL) {
+    new_capacity = AlignUp(new_capacity, space_->GetPageSize());
+    if (new_capacity > reserved_size_) GrowReservation(new_capacity);
+    capacity_ = new_capacity;
+    return;
+  }
+
   ptrdiff_t cursor_offset = GetCursorOffset();
 #ifdef VIXL_CODE_BUFFER_MALLOC
   buffer_ = static_cast<byte*>(realloc(buffer_, new_capacity));
@@ -199,4 +294,20 @@ void CodeBuffer::Grow(size_t new_capacity) {
 }
 
 
+void CodeBuffer::GrowReservation(size_t new_size) {
+  VIXL_ASSERT(space_ != NULL);
+  size_t new_reserved_size = new_size;
+  if (space_->TryExtend(buffer_, reserved_size_, &new_reserved_size)) {
+    reserved_size_ = new_reserved_size;
+    return;
+  }
+
+  // Code allocated from a CodeSpace never moves, since addresses in it may
+  // already have been handed out, or the code may be running.
+  VIXL_ABORT_WITH_MSG(
+      "Cannot grow a CodeBuffer beyond its reservation in a CodeSpace; the "
+      "following pages are in use.\n");
+}
+
+
 }  // namespace vixl
@@ -34,12 +34,29 @@
 
 namespace vixl {
 
+class CodeSpace;
+
 class CodeBuffer {
  public:
   static const size_t kDefaultCapacity = 4 * KBytes;
+  // The default size of the block that a buffer reserves in a CodeSpace.
+  static const size_t kDefaultSpaceReservation = 256 * KBytes;
 
   explicit CodeBuffer(size_t capacity = kDefaultCapacity);
   CodeBuffer(byte* buffer, size_t capacity);
+  // Allocate the backing store from `space`. The capacity is rounded up to a
+  // whole number of pages. The buffer reserves a block of at least
+  // `reservation` bytes, and grows within it without moving. Pages are only
+  // committed when they are first written, so the unused part of the block
+  // costs nothing but address space.
+  //
+  // Code allocated from a CodeSpace never moves. Growing beyond the reserved
+  // block extends it in place if the following pages are free, and aborts
+  // otherwise, so `reservation` should cover the largest size the buffer may
+  // reach.
+  CodeBuffer(CodeSpace* space,
+             size_t capacity,
+             size_t reservation = kDefaultSpaceReservation);
   ~CodeBuffer() VIXL_NEGATIVE_TESTING_ALLOW_EXCEPTION;
 
   void Reset();
@@ -48,9 +65,22 @@ class CodeBuffer {
   // exclusive.
   // Note that these require page-aligned memory blocks, which we can only
   // guarantee with VIXL_CODE_BUFFER_MMAP.
+  // For buffers allocated from a CodeSpace, only the pages holding emitted
+  // code are made executable, and only pages whose protection changes are
+  // touched. If the space is dual-mapped, these do nothing; the code must be
+  // run from GetExecutableStartAddress() instead.
   void SetExecutable();
   void SetWritable();
 
+  // As above, but only change the protection of the pages covering
+  // [offset, offset + size). This is useful when patching a few words of code
+  // that has already been made executable.
+  void SetExecutable(ptrdiff_t offset, size_t size);
+  void SetWritable(ptrdiff_t offset, size_t size);
+
+  // Return the granularity at which the protection of the buffer can change.
+  static size_t GetPageSize();
+
   ptrdiff_t GetOffsetFrom(ptrdiff_t offset) const {
     ptrdiff_t cursor_offset = cursor_ - buffer_;
     VIXL_ASSERT((offset >= 0) && (offset <= cursor_offset));
@@ -91,6 +121,22 @@ class CodeBuffer {
     return GetOffsetAddress<T>(GetSizeInBytes());
   }
 
+  // Return the address at which the code at `offset` can be executed. This is
+  // the same as GetOffsetAddress() unless the buffer is allocated from a
+  // dual-mapped CodeSpace.
+  template <typename T>
+  T GetExecutableOffsetAddress(ptrdiff_t offset) const {
+    VIXL_STATIC_ASSERT(sizeof(T) >= sizeof(uintptr_t));
+    VIXL_ASSERT((offset >= 0) && (offset <= (cursor_ - buffer_)));
+    return reinterpret_cast<T>(reinterpret_cast<uintptr_t>(buffer_ + offset) +
+                               executable_offset_);
+  }
+  template <typename T>
+  T GetExecutableStartAddress() const {
+    VIXL_STATIC_ASSERT(sizeof(T) >= sizeof(uintptr_t));
+    return GetExecutableOffsetAddress<T>(0);
+  }
+
   size_t GetRemainingBytes() const {
     VIXL_ASSERT((cursor_ >= buffer_) && (cursor_ <= (buffer_ + capacity_)));
     return (buffer_ + capacity_) - cursor_;
@@ -147,6 +193,9 @@ class CodeBuffer {
 
   bool IsManaged() const { return managed_; }
 
+  // Return the CodeSpace the buffer was allocated from, or NULL.
+  CodeSpace* GetCodeSpace() const { return space_; }
+
   void Grow(size_t new_capacity);
 
   bool IsDirty() const { return dirty_; }
@@ -169,6 +218,11 @@ class CodeBuffer {
   }
 
  private:
+  void SetProtection(ptrdiff_t offset, size_t size, bool executable);
+  // Grow the block allocated from space_ to at least `new_size` bytes, in
+  // place.
+  void GrowReservation(size_t new_size);
+
   // Backing store of the buffer.
   byte* buffer_;
   // If true the backing store is allocated and deallocated by the buffer. The
@@ -181,6 +235,13 @@ class CodeBuffer {
   bool dirty_;
   // Capacity in bytes of the backing store.
   size_t capacity_;
+  // The space the backing store is allocated from, if any.
+  CodeSpace* space_;
+  // The size of the block allocated from space_. The buffer can grow up to
+  // this size without moving.
+  size_t reserved_size_;
+  // The distance from the backing store to its executable alias.
+  ptrdiff_t executable_offset_;
 };
 
 }  // namespace vixl
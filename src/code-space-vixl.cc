@@ -0,0 +1,238 @@
+// Copyright 2026, VIXL authors
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//   * Redistributions of source code must retain the above copyright notice,
+//     this list of conditions and the following disclaimer.
+//   * Redistributions in binary form must reproduce the above copyright notice,
+//     this list of conditions and the following disclaimer in the documentation
+//     and/or other materials provided with the distribution.
+//   * Neither the name of ARM Limited nor the names of its contributors may be
+//     used to endorse or promote products derived from this software without
+//     specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS CONTRIBUTORS "AS IS" AND
+// ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+// WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#ifdef VIXL_CODE_BUFFER_MMAP
+extern "C" {
+#include <sys/mman.h>
+#include <unistd.h>
+}
+#endif
+
+#include <algorithm>
+
+#include "code-space-vixl.h"
+
+namespace vixl {
+
+// BSD uses `MAP_ANON` instead of the Linux `MAP_ANONYMOUS`.
+#if !defined(MAP_ANONYMOUS) && defined(MAP_ANON)
+#define MAP_ANONYMOUS MAP_ANON
+#endif
+
+#if !defined(MAP_NORESERVE)
+#define MAP_NORESERVE 0
+#endif
+
+CodeSpace::CodeSpace(size_t size, MappingMode mode)
+    : mode_(mode),
+      size_(0),
+      page_size_(0),
+      base_(NULL),
+      executable_base_(NULL),
+      protection_change_count_(0) {
+#ifdef VIXL_CODE_BUFFER_MMAP
+  long page_size = sysconf(_SC_PAGESIZE);
+  VIXL_CHECK(page_size > 0);
+  page_size_ = static_cast<size_t>(page_size);
+  size_ = AlignUp(size, page_size_);
+  VIXL_CHECK(size_ > 0);
+
+  if (mode_ == kSingleMapping) {
+    void* base = mmap(NULL,
+                      size_,
+                      PROT_READ | PROT_WRITE,
+                      MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE,
+                      -1,
+                      0);
+    VIXL_CHECK(base != MAP_FAILED);
+    base_ = static_cast<byte*>(base);
+    executable_base_ = base_;
+  } else {
+#ifdef __linux__
+    int fd = memfd_create("vixl-code-space", MFD_CLOEXEC);
+    VIXL_CHECK(fd >= 0);
+    VIXL_CHECK(ftruncate(fd, size_) == 0);
+    void* base =
+        mmap(NULL, size_, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    void* executable_base =
+        mmap(NULL, size_, PROT_READ | PROT_EXEC, MAP_SHARED, fd, 0);
+    // The mappings keep the file alive.
+    close(fd);
+    VIXL_CHECK((base != MAP_FAILED) && (executable_base != MAP_FAILED));
+    base_ = static_cast<byte*>(base);
+    executable_base_ = static_cast<byte*>(executable_base);
+#else
+    VIXL_ABORT_WITH_MSG("Dual-mapped code spaces require memfd_create.\n");
+#endif
+  }
+
+  free_ranges_[0] = size_;
+  page_protection_.resize(size_ / page_size_, kWritable);
+#else
+  USE(size);
+  // This requires page-aligned memory blocks, which we can only guarantee with
+  // mmap.
+  VIXL_UNIMPLEMENTED();
+#endif
+}
+
+
+CodeSpace::~CodeSpace() {
+#ifdef VIXL_CODE_BUFFER_MMAP
+  if (base_ != NULL) munmap(base_, size_);
+  if (executable_base_ != base_) munmap(executable_base_, size_);
+#endif
+}
+
+
+byte* CodeSpace::Allocate(size_t* size) {
+  VIXL_ASSERT(size != NULL);
+  size_t aligned_size = AlignUp(std::max<size_t>(*size, 1), page_size_);
+
+  // First fit, so that freed blocks are quickly reused and the rest of the
+  // space is left untouched.
+  std::map<size_t, size_t>::iterator it;
+  for (it = free_ranges_.begin(); it != free_ranges_.end(); ++it) {
+    if (it->second >= aligned_size) break;
+  }
+  VIXL_CHECK(it != free_ranges_.end());
+
+  size_t offset = it->first;
+  size_t remaining = it->second - aligned_size;
+  free_ranges_.erase(it);
+  if (remaining > 0) free_ranges_[offset + aligned_size] = remaining;
+
+  byte* block = base_ + offset;
+  SetWritable(block, aligned_size);
+  *size = aligned_size;
+  return block;
+}
+
+
+bool CodeSpace::TryExtend(byte* block, size_t size, size_t* new_size) {
+  VIXL_ASSERT(Contains(block));
+  VIXL_ASSERT(IsMultiple(size, static_cast<unsigned>(page_size_)));
+  VIXL_ASSERT((new_size != NULL) && (*new_size > size));
+
+  size_t end = (block - base_) + size;
+  size_t extra = AlignUp(*new_size - size, page_size_);
+  std::map<size_t, size_t>::iterator it = free_ranges_.find(end);
+  if ((it == free_ranges_.end()) || (it->second < extra)) return false;
+
+  size_t remaining = it->second - extra;
+  free_ranges_.erase(it);
+  if (remaining > 0) free_ranges_[end + extra] = remaining;
+
+  SetWritable(block + size, extra);
+  *new_size = size + extra;
+  return true;
+}
+
+
+void CodeSpace::Free(byte* block, size_t size) {
+  VIXL_ASSERT(Contains(block));
+  VIXL_ASSERT(IsMultiple(size, static_cast<unsigned>(page_size_)));
+
+  size_t offset = block - base_;
+  VIXL_ASSERT(free_ranges_.count(offset) == 0);
+
+  // Coalesce with the following range, if it is free.
+  std::map<size_t, size_t>::iterator next = free_ranges_.find(offset + size);
+  if (next != free_ranges_.end()) {
+    size += next->second;
+    free_ranges_.erase(next);
+  }
+
+  // Coalesce with the preceding range, if it is free.
+  std::map<size_t, size_t>::iterator it = free_ranges_.lower_bound(offset);
+  if (it != free_ranges_.begin()) {
+    --it;
+    VIXL_ASSERT((it->first + it->second) <= offset);
+    if ((it->first + it->second) == offset) {
+      it->second += size;
+      return;
+    }
+  }
+  free_ranges_[offset] = size;
+}
+
+
+void CodeSpace::SetExecutable(byte* address, size_t size) {
+  SetProtection(address, size, kExecutable);
+}
+
+
+void CodeSpace::SetWritable(byte* address, size_t size) {
+  SetProtection(address, size, kWritable);
+}
+
+
+bool CodeSpace::IsExecutable(const void* address) const {
+  if (IsDualMapped()) return false;
+  const byte* a = static_cast<const byte*>(address);
+  return page_protection_[GetPageIndex(a)] == kExecutable;
+}
+
+
+void CodeSpace::SetProtection(byte* address,
+                              size_t size,
+                              PageProtection protection) {
+  if (IsDualMapped() || (size == 0)) return;
+
+  size_t first = GetPageIndex(address);
+  size_t last = GetPageIndex(address + size - 1);
+  VIXL_ASSERT(last < page_protection_.size());
+
+  // Find each run of pages that needs to change and update it with a single
+  // call.
+  size_t page = first;
+  while (page <= last) {
+    if (page_protection_[page] == protection) {
+      page++;
+      continue;
+    }
+    size_t run_start = page;
+    while ((page <= last) && (page_protection_[page] != protection)) {
+      page_protection_[page] = protection;
+      page++;
+    }
+#ifdef VIXL_CODE_BUFFER_MMAP
+    int prot = (protection == kExecutable) ? (PROT_READ | PROT_EXEC)
+                                           : (PROT_READ | PROT_WRITE);
+    int ret = mprotect(base_ + (run_start * page_size_),
+                       (page - run_start) * page_size_,
+                       prot);
+    VIXL_CHECK(ret == 0);
+#else
+    USE(run_start);
+    VIXL_UNIMPLEMENTED();
+#endif
+    protection_change_count_++;
+  }
+}
+
+
+}  // namespace vixl
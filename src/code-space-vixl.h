@@ -0,0 +1,144 @@
+// Copyright 2026, VIXL authors
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//   * Redistributions of source code must retain the above copyright notice,
+//     this list of conditions and the following disclaimer.
+//   * Redistributions in binary form must reproduce the above copyright notice,
+//     this list of conditions and the following disclaimer in the documentation
+//     and/or other materials provided with the distribution.
+//   * Neither the name of ARM Limited nor the names of its contributors may be
+//     used to endorse or promote products derived from this software without
+//     specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS CONTRIBUTORS "AS IS" AND
+// ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+// WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef VIXL_CODE_SPACE_H
+#define VIXL_CODE_SPACE_H
+
+#include <map>
+#include <vector>
+
+#include "globals-vixl.h"
+#include "utils-vixl.h"
+
+namespace vixl {
+
+// A CodeSpace reserves a single large range of virtual memory up front and
+// hands out page-aligned blocks of it, typically to back CodeBuffers. This
+// avoids an mmap/munmap pair for every buffer. Blocks never move: since pages
+// are only committed when they are first touched, they can be handed out with
+// plenty of headroom to grow into.
+//
+// Page protections are tracked individually, so that making a block
+// executable or writable only issues mprotect calls for the pages whose
+// protection actually changes.
+//
+// With kDualMapping, the space is backed by an anonymous file mapped twice:
+// once read-write and once read-execute. Code is written through the
+// writable view and executed through the executable alias, so no page is
+// ever both writable and executable and no protection changes are needed at
+// all.
+//
+// A CodeSpace is not thread-safe, and must outlive every block allocated
+// from it.
+class CodeSpace {
+ public:
+  enum MappingMode { kSingleMapping, kDualMapping };
+
+  static const size_t kDefaultSize = 64 * MBytes;
+
+  explicit CodeSpace(size_t size = kDefaultSize,
+                     MappingMode mode = kSingleMapping);
+  ~CodeSpace();
+
+  // Allocate a writable block of at least `size` bytes. The size is rounded
+  // up to a whole number of pages and written to `size`. The block is not
+  // zeroed. Pages are only committed by the OS when they are first touched,
+  // so over-sized blocks are cheap.
+  byte* Allocate(size_t* size);
+
+  // Try to grow the block at `block` from `size` to at least `new_size` bytes
+  // without moving it. On success, the new (page-rounded) size is written to
+  // `new_size`. This fails if the pages following the block are in use.
+  bool TryExtend(byte* block, size_t size, size_t* new_size);
+
+  // Return a block to the space.
+  void Free(byte* block, size_t size);
+
+  // Change the protection of the pages covering [address, address + size).
+  // Pages that already have the requested protection are left untouched.
+  // These are no-ops with kDualMapping.
+  void SetExecutable(byte* address, size_t size);
+  void SetWritable(byte* address, size_t size);
+
+  // Return the address at which code written at `address` can be executed.
+  // This is `address` itself unless the space is dual-mapped.
+  template <typename T>
+  T GetExecutableAddress(const byte* address) const {
+    VIXL_STATIC_ASSERT(sizeof(T) >= sizeof(uintptr_t));
+    VIXL_ASSERT(Contains(address));
+    return reinterpret_cast<T>(reinterpret_cast<uintptr_t>(address) +
+                               GetExecutableOffset());
+  }
+
+  // The distance from the writable view to the executable view.
+  ptrdiff_t GetExecutableOffset() const {
+    return reinterpret_cast<uintptr_t>(executable_base_) -
+           reinterpret_cast<uintptr_t>(base_);
+  }
+
+  bool Contains(const void* address) const {
+    uintptr_t a = reinterpret_cast<uintptr_t>(address);
+    uintptr_t base = reinterpret_cast<uintptr_t>(base_);
+    return (a >= base) && ((a - base) < size_);
+  }
+
+  bool IsDualMapped() const { return mode_ == kDualMapping; }
+  bool IsExecutable(const void* address) const;
+  size_t GetSize() const { return size_; }
+  size_t GetPageSize() const { return page_size_; }
+
+  // The number of mprotect calls issued so far.
+  uint64_t GetProtectionChangeCount() const {
+    return protection_change_count_;
+  }
+
+ private:
+  enum PageProtection { kWritable, kExecutable };
+
+  void SetProtection(byte* address, size_t size, PageProtection protection);
+  size_t GetPageIndex(const byte* address) const {
+    VIXL_ASSERT(Contains(address));
+    return (address - base_) / page_size_;
+  }
+
+  MappingMode mode_;
+  size_t size_;
+  size_t page_size_;
+  // The writable view of the space, and its executable alias. These are the
+  // same unless the space is dual-mapped.
+  byte* base_;
+  byte* executable_base_;
+  // Free page ranges, indexed by their offset from base_ and mapping to their
+  // size. Adjacent ranges are always coalesced.
+  std::map<size_t, size_t> free_ranges_;
+  // The current protection of each page.
+  std::vector<uint8_t> page_protection_;
+  uint64_t protection_change_count_;
+};
+
+}  // namespace vixl
+
+#endif  // VIXL_CODE_SPACE_H
@@ -0,0 +1,118 @@
+// Copyright 2026, VIXL authors
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//   * Redistributions of source code must retain the above copyright notice,
+//     this list of conditions and the following disclaimer.
+//   * Redistributions in binary form must reproduce the above copyright notice,
+//     this list of conditions and the following disclaimer in the documentation
+//     and/or other materials provided with the distribution.
+//   * Neither the name of ARM Limited nor the names of its contributors may be
+//     used to endorse or promote products derived from this software without
+//     specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS CONTRIBUTORS "AS IS" AND
+// ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+// WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef VIXL_DECODE_TABLE_H
+#define VIXL_DECODE_TABLE_H
+
+#include <vector>
+
+#include "globals-vixl.h"
+
+namespace vixl {
+
+// The AArch64 and AArch32 decoders are compiled by
+// tools/generate_decoder_tables.py into arrays of DecodeTableEntry values.
+// Each entry either identifies an instruction form or encoding, or samples
+// some bits of the instruction to find the next entry to look at:
+//  - kLeafEntry: `base` is the form or encoding ID.
+//  - kExtractEntry: the next entry is at `base + ((instr >> shift) & mask)`.
+//  - kTestEntry: `mask` is the index of a DecodeTableTest. The next entry is at
+//    `base + 1` if the instruction bits selected by the test's mask match its
+//    value, and at `base` otherwise.
+// Decoding starts at the first entry in the table, and continues until a leaf
+// entry is reached.
+//
+// The fields are packed into 32 bits to keep the tables small. The generator
+// checks that every entry fits, and splits wider extractions into several
+// levels.
+struct DecodeTableEntry {
+  enum Type { kLeafEntry, kExtractEntry, kTestEntry };
+
+  uint32_t base : 15;
+  uint32_t mask : 10;
+  uint32_t shift : 5;
+  uint32_t type : 2;
+};
+
+struct DecodeTableTest {
+  uint32_t mask;
+  uint32_t value;
+};
+
+// Walk a decode table from its first entry, and return the `base` of the leaf
+// entry that `instr` reaches.
+inline uint32_t LookUpDecodeTable(const DecodeTableEntry* table,
+                                  size_t table_size,
+                                  const DecodeTableTest* tests,
+                                  size_t test_count,
+                                  uint32_t instr) {
+  USE(table_size, test_count);
+  DecodeTableEntry entry = table[0];
+  while (entry.type != DecodeTableEntry::kLeafEntry) {
+    uint32_t index;
+    if (entry.type == DecodeTableEntry::kExtractEntry) {
+      index = (instr >> entry.shift) & entry.mask;
+    } else {
+      VIXL_ASSERT(entry.type == DecodeTableEntry::kTestEntry);
+      VIXL_ASSERT(entry.mask < test_count);
+      const DecodeTableTest& test = tests[entry.mask];
+      index = ((instr & test.mask) == test.value) ? 1 : 0;
+    }
+    VIXL_ASSERT((entry.base + index) < table_size);
+    entry = table[entry.base + index];
+  }
+  return entry.base;
+}
+
+// DecodePattern and DecodeMapping represent the input data to the decoder
+// compilation stage, tools/generate_decoder_tables.py. After compilation, each
+// decoder is embodied in a static table of DecodeTableEntries.
+
+// A DecodePattern maps a pattern of set/unset/don't care (1, 0, x) bits encoded
+// as uint32_t to its handler.
+// The encoding uses two bits per symbol: 0 => 0b00, 1 => 0b01, x => 0b10.
+// 0b11 marks the edge of the most-significant bits of the pattern, which is
+// required to determine the length. For example, the pattern "1x01"_b is
+// encoded in a uint32_t as 0b11_01_10_00_01.
+struct DecodePattern {
+  static const uint32_t kEndOfPattern = 3;
+
+  uint32_t pattern;
+  const char* handler;
+};
+
+// A DecodeMapping consists of the name of a handler, the bits sampled in the
+// instruction by that handler, and a mapping from the pattern that those
+// sampled bits match to the corresponding name of a node.
+struct DecodeMapping {
+  const char* name;
+  const std::vector<uint8_t> sampled_bits;
+  const std::vector<DecodePattern> mapping;
+};
+
+}  // namespace vixl
+
+#endif  // VIXL_DECODE_TABLE_H
@@ -92,6 +92,12 @@ T PoolManager<T>::Emit(MacroAssemblerInterface* masm,
     }
     LocationBase<T>* label_base = current.label_base_;
     T aligned_pc = AlignUp(pc, current.alignment_);
+    if (aligned_pc != pc) {
+      size_t next = std::distance(objects_.begin(), iter) + 1;
+      pc = EmitIntoPadding(masm, pc, aligned_pc, next);
+      // EmitIntoPadding() only removes objects after this one, so 'iter' and
+      // 'current' are still valid.
+    }
     masm->EmitPaddingBytes(aligned_pc - pc);
     pc = aligned_pc;
     VIXL_ASSERT(pc >= current.min_location_);
@@ -124,6 +130,40 @@ T PoolManager<T>::Emit(MacroAssemblerInterface* masm,
   return pc;
 }
 
+template <typename T>
+T PoolManager<T>::EmitIntoPadding(MacroAssemblerInterface* masm,
+                                  T pc,
+                                  T end,
+                                  size_t first) {
+  // Moving an object earlier never invalidates the placement of the other
+  // objects: it only uses space that would otherwise be padding, and the
+  // objects after it can only move earlier too. Limit the search, since
+  // padding is usually small and objects that fit are usually nearby.
+  static const size_t kMaxCandidates = 16;
+  size_t last = std::min(objects_.size(), first + kMaxCandidates);
+  for (size_t i = first; (i < last) && (pc < end);) {
+    PoolObject<T>& candidate = objects_[i];
+    LocationBase<T>* label_base = candidate.label_base_;
+    T location = AlignUp(pc, candidate.alignment_);
+    if (!label_base->ShouldDeletePoolObjectOnPlacement() ||
+        label_base->UsePoolObjectEmissionMargin() ||
+        (location + label_base->GetPoolObjectSizeInBytes() > end) ||
+        (location < candidate.min_location_) ||
+        (location > candidate.max_location_)) {
+      i++;
+      continue;
+    }
+    masm->EmitPaddingBytes(location - pc);
+    label_base->SetLocation(masm->AsAssemblerBase(), location);
+    label_base->EmitPoolObject(masm);
+    label_base->MarkBound();
+    pc = location + label_base->GetPoolObjectSizeInBytes();
+    RemoveAndDelete(objects_.begin() + i);
+    last--;
+  }
+  return pc;
+}
+
 template <typename T>
 bool PoolManager<T>::ShouldSkipObject(PoolObject<T>* pool_object,
                                       T pc,
@@ -431,7 +471,12 @@ typename PoolManager<T>::objects_iter PoolManager<T>::RemoveAndDelete(
   }
   if (label_base->ShouldBeDeletedOnPlacementByPoolManager()) {
     VIXL_ASSERT(!label_base->ShouldBeDeletedOnPoolManagerDestruction());
-    delete label_base;
+    if ((arena_ != NULL) && arena_->Contains(label_base)) {
+      // The arena's memory is reclaimed when the arena is reset.
+      label_base->~LocationBase<T>();
+    } else {
+      delete label_base;
+    }
   }
 
   return objects_.erase(iter);
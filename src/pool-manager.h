@@ -34,6 +34,7 @@
 #include <map>
 #include <vector>
 
+#include "arena-vixl.h"
 #include "globals-vixl.h"
 #include "macro-assembler-interface.h"
 #include "utils-vixl.h"
@@ -389,13 +390,20 @@ class ForwardReference {
 template <typename T>
 class PoolManager {
  public:
-  PoolManager(int header_size, int alignment, int buffer_alignment)
+  // Objects that the pool manager deletes on placement may have been
+  // allocated in `arena`, in which case they are destroyed in place instead.
+  PoolManager(int header_size,
+              int alignment,
+              int buffer_alignment,
+              Arena* arena = NULL)
       : header_size_(header_size),
         alignment_(alignment),
         buffer_alignment_(buffer_alignment),
         checkpoint_(std::numeric_limits<T>::max()),
         max_pool_size_(0),
-        monitor_(0) {}
+        barrier_window_(0),
+        monitor_(0),
+        arena_(arena) {}
 
   ~PoolManager() VIXL_NEGATIVE_TESTING_ALLOW_EXCEPTION;
 
@@ -426,6 +434,27 @@ class PoolManager {
          LocationBase<T>* new_object = NULL,
          EmitOption option = kBranchRequired);
 
+  // By default, the pool is only emitted when it must be, typically with a
+  // branch over it. A MacroAssembler can also offer natural barriers, such as
+  // the location right after an unconditional branch or a return, where the
+  // pool can be emitted without a branch. This returns true if a barrier at
+  // 'pc' is within the barrier window of the checkpoint, in which case the
+  // pool should be emitted there, with kNoBranchRequired.
+  bool ShouldEmitAtBarrier(T pc) const {
+    if ((barrier_window_ == 0) || objects_.empty() || IsBlocked()) return false;
+    return pc >= (checkpoint_ - barrier_window_);
+  }
+
+  // Set how far ahead of the checkpoint, in bytes, the pool may be emitted at a
+  // barrier. A larger window makes it more likely that a barrier is found, but
+  // emits the pool earlier than necessary. Zero (the default) disables
+  // emission at barriers.
+  void SetBarrierWindow(T window) {
+    VIXL_ASSERT(window >= 0);
+    barrier_window_ = window;
+  }
+  T GetBarrierWindow() const { return barrier_window_; }
+
   // Add 'reference' to 'object'. Should not be preceded by a call to MustEmit()
   // that returned true, unless Emit() has been successfully afterwards.
   void AddObjectReference(const ForwardReference<T>* reference,
@@ -444,6 +473,9 @@ class PoolManager {
   void Release(T pc);
   bool IsBlocked() const { return monitor_ != 0; }
 
+  // Return true if the pool manager is not tracking any objects.
+  bool IsEmpty() const { return objects_.empty(); }
+
  private:
   typedef typename std::vector<PoolObject<T> >::iterator objects_iter;
   typedef
@@ -488,6 +520,12 @@ class PoolManager {
   void RemoveAndDelete(PoolObject<T>* object);
   objects_iter RemoveAndDelete(objects_iter iter);
 
+  // Emit objects from objects_[first] onwards into the padding between 'pc'
+  // and 'end', as long as they fit and can be placed there. Only objects that
+  // are removed on placement are considered, and they are removed from
+  // objects_. Returns the new pc, which is at most 'end'.
+  T EmitIntoPadding(MacroAssemblerInterface* masm, T pc, T end, size_t first);
+
   // Helper function to check if we should skip emitting an object.
   bool ShouldSkipObject(PoolObject<T>* pool_object,
                         T pc,
@@ -543,9 +581,16 @@ class PoolManager {
   // RecalculateCheckpoint.
   T max_pool_size_;
 
+  // How far ahead of the checkpoint the pool may be emitted at a barrier. See
+  // ShouldEmitAtBarrier().
+  T barrier_window_;
+
   // Indicates whether the emission of this pool is blocked.
   int monitor_;
 
+  // The arena used by the owner of the pool manager, if any.
+  Arena* arena_;
+
   friend class vixl::TestPoolManager;
 };
 
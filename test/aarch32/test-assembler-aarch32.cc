@@ -1418,6 +1418,55 @@ TEST_T32(literal_pool_generated_by_macro_instruction) {
   ASSERT_EQUAL_32(0x12345678, r2);
 }
 
+TEST(literal_pool_emitted_at_barrier) {
+  SETUP();
+
+  START();
+
+  const int32_t kWindow = 256;
+  masm.SetPoolBarrierWindow(kWindow);
+
+  Literal<uint32_t> literal(0x12345678);
+  __ Ldr(r0, &literal);
+  VIXL_CHECK(!test.PoolIsEmpty());
+
+  // A barrier outside of the window does not cause the pool to be emitted.
+  Label before_window;
+  int32_t branch_start = masm.GetCursorOffset();
+  __ B(&before_window);
+  int32_t branch_size = masm.GetCursorOffset() - branch_start;
+  __ Bind(&before_window);
+  VIXL_CHECK(!literal.IsBound());
+
+  // Generate code until the barrier window is reached.
+  int32_t space = test.GetPoolCheckpoint() - kWindow - masm.GetCursorOffset();
+  {
+    ExactAssemblyScope scope(&masm, space, ExactAssemblyScope::kExactSize);
+    while (space > 0) {
+      __ nop();
+      space -= masm.IsUsingT32() ? k16BitT32InstructionSizeInBytes
+                                 : kA32InstructionSizeInBytes;
+    }
+  }
+  VIXL_CHECK(!literal.IsBound());
+
+  // The pool is emitted right after the next unconditional branch, without a
+  // branch over it.
+  Label done;
+  branch_start = masm.GetCursorOffset();
+  __ B(&done);
+  VIXL_CHECK(literal.IsBound());
+  VIXL_CHECK(literal.GetLocation() == AlignUp(branch_start + branch_size, 4));
+  __ Bind(&done);
+
+  END();
+
+  RUN();
+
+  ASSERT_EQUAL_32(0x12345678, r0);
+}
+
+
 TEST(emit_single_literal) {
   SETUP();
 
@@ -0,0 +1,126 @@
+// Copyright 2026, VIXL authors
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//   * Redistributions of source code must retain the above copyright notice,
+//     this list of conditions and the following disclaimer.
+//   * Redistributions in binary form must reproduce the above copyright notice,
+//     this list of conditions and the following disclaimer in the documentation
+//     and/or other materials provided with the distribution.
+//   * Neither the name of ARM Limited nor the names of its contributors may be
+//     used to endorse or promote products derived from this software without
+//     specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS CONTRIBUTORS "AS IS" AND
+// ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+// WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include <map>
+#include <string>
+
+#include "test-runner.h"
+
+#include "aarch32/decoder-aarch32.h"
+#include "aarch32/decoder-constants-aarch32.h"
+
+#define TEST(name) TEST_(AARCH32_DECODER_##name)
+
+
+namespace vixl {
+namespace aarch32 {
+
+// Identify an instruction's encoding by interpreting a decode graph directly,
+// rather than using the compiled decode table.
+typedef std::map<std::string, const DecodeMapping*> DecodeMappingMap;
+
+template <size_t kNodeCount>
+static DecodeMappingMap GetNodes(const DecodeMapping (&mapping)[kNodeCount]) {
+  DecodeMappingMap nodes;
+  for (size_t i = 0; i < kNodeCount; i++) {
+    nodes[mapping[i].name] = &mapping[i];
+  }
+  return nodes;
+}
+
+static const char* IdentifyEncodingFromMapping(const DecodeMappingMap& nodes,
+                                               uint32_t bits) {
+  const char* name = "Root";
+  while (nodes.count(name) != 0) {
+    const DecodeMapping* node = nodes.at(name);
+    size_t length = node->sampled_bits.size();
+    name = "unallocated";
+    for (const DecodePattern& p : node->mapping) {
+      bool match = true;
+      for (size_t i = 0; (i < length) && match; i++) {
+        uint32_t symbol = (p.pattern >> (2 * (length - i - 1))) & 3;
+        uint32_t bit = (bits >> node->sampled_bits[i]) & 1;
+        match = (symbol == 2) || (symbol == bit);
+      }
+      if (match) {
+        name = p.handler;
+        break;
+      }
+    }
+  }
+  return name;
+}
+
+TEST(encoding_names) {
+  VIXL_CHECK(strcmp(GetA32EncodingName(kA32_unallocated), "unallocated") == 0);
+  VIXL_CHECK(strcmp(GetT32EncodingName(kT32_unallocated), "unallocated") == 0);
+  VIXL_CHECK(strcmp(GetA32EncodingName(kA32_blx_a2), "blx_a2") == 0);
+
+  // Instructions with the same encoding have the same ID, whatever their
+  // operands.
+  A32Encoding add = IdentifyA32Encoding(0xe0810002);  // add r0, r1, r2
+  VIXL_CHECK(add == kA32_add_reg_a1);
+  VIXL_CHECK(strcmp(GetA32EncodingName(add), "add_reg_a1") == 0);
+  VIXL_CHECK(IdentifyA32Encoding(0x10843005) == add);  // addne r3, r4, r5
+  VIXL_CHECK(IdentifyA32Encoding(0xe0410002) != add);  // sub r0, r1, r2
+
+  T32Encoding adds = IdentifyT32Encoding(0x18880000);  // adds r0, r1, r2
+  VIXL_CHECK(adds == kT32_add_reg_t1);
+  VIXL_CHECK(IdentifyT32Encoding(0x19630000) == adds);  // adds r3, r4, r5
+  VIXL_CHECK(IdentifyT32Encoding(0xbf000000) != adds);  // nop
+
+  // Aliases with their own encoding in the architecture have their own ID.
+  VIXL_CHECK(IdentifyA32Encoding(0xe52d0004) ==  // push {r0}
+             kA32_push_single_a1);
+  VIXL_CHECK(IdentifyA32Encoding(0xe5210004) ==  // str r0, [r1, #-4]!
+             kA32_str_imm_pre_a1);
+  VIXL_CHECK(IdentifyA32Encoding(0xe92d0003) ==  // push {r0, r1}
+             kA32_push_list_a1);
+  VIXL_CHECK(IdentifyA32Encoding(0xe28f0004) == kA32_adr_a1);  // adr r0, #4
+  VIXL_CHECK(IdentifyA32Encoding(0xe24f0004) == kA32_adr_a2);  // adr r0, #-4
+  VIXL_CHECK(IdentifyT32Encoding(0xb4010000) == kT32_push_t1);  // push {r0}
+
+  VIXL_CHECK(IdentifyA32Encoding(0xe7f000f0) == kA32_udf_a1);  // udf #0
+  VIXL_CHECK(IdentifyA32Encoding(0xffffffff) == kA32_unallocated);
+}
+
+TEST(decode_table) {
+  DecodeMappingMap a32_nodes = GetNodes(kA32DecodeMapping);
+  DecodeMappingMap t32_nodes = GetNodes(kT32DecodeMapping);
+
+  // Use a simple linear congruential generator to sample encodings.
+  uint32_t bits = 0;
+  for (int i = 0; i < (1 << 16); i++) {
+    bits = (bits * 1103515245) + 12345;
+    VIXL_CHECK(strcmp(GetA32EncodingName(IdentifyA32Encoding(bits)),
+                      IdentifyEncodingFromMapping(a32_nodes, bits)) == 0);
+    VIXL_CHECK(strcmp(GetT32EncodingName(IdentifyT32Encoding(bits)),
+                      IdentifyEncodingFromMapping(t32_nodes, bits)) == 0);
+  }
+}
+
+}  // namespace aarch32
+}  // namespace vixl
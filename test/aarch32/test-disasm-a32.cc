@@ -4259,6 +4259,50 @@ TEST(nop_code) {
 }
 
 
+TEST(disassembler_stream) {
+  // add r0, r1
+  // cmp r1, #20
+  // bx lr
+  const uint32_t kCode[] = {0xe0800001, 0xe3510014, 0xe12fff1e};
+
+  // Write to a caller-provided buffer.
+  char buffer[128];
+  Disassembler::DisassemblerStream stream(buffer, sizeof(buffer));
+  PrintDisassembler disasm(&stream, 0x1000);
+  disasm.DisassembleA32Buffer(kCode, sizeof(kCode));
+  VIXL_CHECK(strcmp(stream.GetOutput(),
+                    "0x00001000\te0800001\tadd r0, r1\n"
+                    "0x00001004\te3510014\tcmp r1, #20\n"
+                    "0x00001008\te12fff1e\tbx lr\n") == 0);
+  VIXL_CHECK(stream.GetOutputLength() == strlen(buffer));
+
+  // Output which does not fit in the buffer is dropped.
+  char small_buffer[8];
+  Disassembler::DisassemblerStream small_stream(small_buffer,
+                                                sizeof(small_buffer));
+  Disassembler small_disasm(&small_stream);
+  small_disasm.DecodeA32(kCode[0]);
+  VIXL_CHECK(strcmp(small_buffer, "add r0,") == 0);
+
+  // Use a different buffer for each instruction.
+  char ring[2][32];
+  Disassembler::DisassemblerStream ring_stream(ring[0], sizeof(ring[0]));
+  Disassembler ring_disasm(&ring_stream);
+  for (size_t i = 0; i < ArrayLength(kCode); i++) {
+    ring_stream.SetOutputBuffer(ring[i % 2], sizeof(ring[i % 2]));
+    ring_disasm.DecodeA32(kCode[i]);
+  }
+  VIXL_CHECK(strcmp(ring[0], "bx lr") == 0);
+  VIXL_CHECK(strcmp(ring[1], "cmp r1, #20") == 0);
+
+  // Streams built on a std::ostream write each instruction as soon as it has
+  // been disassembled.
+  std::ostringstream ss;
+  Disassembler ostream_disasm(ss);
+  ostream_disasm.DecodeA32(kCode[1]);
+  VIXL_CHECK(ss.str() == "cmp r1, #20");
+}
+
 TEST(minus_zero_offsets) {
   SETUP();
 
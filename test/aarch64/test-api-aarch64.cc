@@ -1763,6 +1763,127 @@ TEST(sim_stack) {
   VIXL_CHECK(s.IsAccessInGuardRegion(s.GetLimit() - 1280, 2048));
   VIXL_CHECK(s.IsAccessInGuardRegion(s.GetLimit() - 1280, 10000));
 }
+
+TEST(sim_address_space) {
+  const uint64_t kPage = SimAddressSpace::kPageSize;
+  SimAddressSpace space;
+
+  // Nothing is accessible until it is registered.
+  VIXL_CHECK(!space.IsAccessAllowed(0x10000, 1, SimAddressSpace::kRead));
+
+  space.AddRegion(0x10000, 2 * kPage, SimAddressSpace::kReadWrite);
+  space.AddRegion(0x10000 + 2 * kPage, kPage, SimAddressSpace::kReadExecute);
+  VIXL_CHECK(space.GetRegionCount() == 2);
+
+  VIXL_CHECK(space.IsAccessAllowed(0x10000, 8, SimAddressSpace::kReadWrite));
+  VIXL_CHECK(space.IsAccessAllowed(0x10000 + 2 * kPage - 16,
+                                   16,
+                                   SimAddressSpace::kWrite));
+  VIXL_CHECK(!space.IsAccessAllowed(0x10000, 4, SimAddressSpace::kExecute));
+  VIXL_CHECK(!space.IsAccessAllowed(0x10000 + 2 * kPage,
+                                    4,
+                                    SimAddressSpace::kWrite));
+  VIXL_CHECK(space.IsAccessAllowed(0x10000 + 2 * kPage,
+                                   4,
+                                   SimAddressSpace::kExecute));
+
+  // Accesses spanning two regions need the permission in both.
+  VIXL_CHECK(space.IsAccessAllowed(0x10000 + 2 * kPage - 8,
+                                   16,
+                                   SimAddressSpace::kRead));
+  VIXL_CHECK(!space.IsAccessAllowed(0x10000 + 2 * kPage - 8,
+                                    16,
+                                    SimAddressSpace::kWrite));
+
+  // Off-by-one at either end.
+  VIXL_CHECK(!space.IsAccessAllowed(0x10000 - 1, 2, SimAddressSpace::kRead));
+  VIXL_CHECK(!space.IsAccessAllowed(0x10000 + 3 * kPage - 1,
+                                    2,
+                                    SimAddressSpace::kRead));
+
+  // Changing the permissions invalidates any cached page.
+  space.SetPermissions(0x10000, SimAddressSpace::kRead);
+  VIXL_CHECK(!space.IsAccessAllowed(0x10000, 8, SimAddressSpace::kWrite));
+  VIXL_CHECK(space.IsAccessAllowed(0x10000, 8, SimAddressSpace::kRead));
+
+  space.RemoveRegion(0x10000);
+  VIXL_CHECK(space.GetRegionCount() == 1);
+  VIXL_CHECK(!space.IsAccessAllowed(0x10000, 8, SimAddressSpace::kRead));
+
+  // Regions don't have to be page-aligned. Partly-covered pages are checked
+  // precisely.
+  space.AddRegion(0x20010, 0x20, SimAddressSpace::kReadWrite);
+  VIXL_CHECK(space.IsAccessAllowed(0x20010, 0x20, SimAddressSpace::kWrite));
+  VIXL_CHECK(!space.IsAccessAllowed(0x2000f, 1, SimAddressSpace::kRead));
+  VIXL_CHECK(!space.IsAccessAllowed(0x20030, 1, SimAddressSpace::kRead));
+  VIXL_CHECK(!space.IsAccessAllowed(0x20028, 16, SimAddressSpace::kRead));
+
+  // Pages that alias in the TLB don't interfere with each other.
+  space.AddRegion(0x10000 + 64 * kPage, kPage, SimAddressSpace::kReadWrite);
+  for (int i = 0; i < 4; i++) {
+    VIXL_CHECK(space.IsAccessAllowed(0x10000 + 64 * kPage,
+                                     8,
+                                     SimAddressSpace::kWrite));
+    VIXL_CHECK(!space.IsAccessAllowed(0x10000, 8, SimAddressSpace::kRead));
+  }
+
+  // Regions can also be removed using the identifier returned by AddRegion(),
+  // which is not reused if another region is added at the same address.
+  SimAddressSpace::RegionId id =
+      space.AddRegion(0x40000, kPage, SimAddressSpace::kRead);
+  VIXL_CHECK(id != SimAddressSpace::kNoRegion);
+  VIXL_CHECK(space.RemoveRegionWithId(id));
+  VIXL_CHECK(!space.IsAccessAllowed(0x40000, 1, SimAddressSpace::kRead));
+  VIXL_CHECK(space.AddRegion(0x40000, kPage, SimAddressSpace::kRead) != id);
+  VIXL_CHECK(!space.RemoveRegionWithId(id));
+  VIXL_CHECK(space.IsAccessAllowed(0x40000, 1, SimAddressSpace::kRead));
+
+  space.Clear();
+  VIXL_CHECK(space.GetRegionCount() == 0);
+  VIXL_CHECK(!space.IsAccessAllowed(0x20010, 1, SimAddressSpace::kRead));
+}
+
+TEST(sim_logic_vregister_state) {
+  SimVRegister reg;
+  LogicVRegister logic(reg);
+  const int kLanes = kZRegMaxSizeInBytes;
+
+  // Lanes start out neither saturated nor rounded.
+  for (int i = 0; i < kLanes; i++) {
+    VIXL_CHECK(logic.GetSignedSaturation(i) == LogicVRegister::kNotSaturated);
+    VIXL_CHECK(logic.GetUnsignedSaturation(i) ==
+               LogicVRegister::kNotSaturated);
+    VIXL_CHECK(!logic.GetRounding(i));
+  }
+
+  // Setting state in a high lane must not affect the lanes below it.
+  logic.SetSignedSat(200, true);
+  logic.SetUnsignedSat(3, false);
+  logic.SetRounding(100, true);
+  logic.SetRounding(150, false);
+  for (int i = 0; i < kLanes; i++) {
+    VIXL_CHECK(logic.GetSignedSaturation(i) ==
+               ((i == 200) ? LogicVRegister::kSignedSatPositive
+                           : LogicVRegister::kNotSaturated));
+    VIXL_CHECK(logic.GetUnsignedSaturation(i) ==
+               ((i == 3) ? LogicVRegister::kUnsignedSatNegative
+                         : LogicVRegister::kNotSaturated));
+    VIXL_CHECK(logic.GetRounding(i) == (i == 100));
+  }
+
+  // Copies carry the state with them.
+  LogicVRegister copy(logic);
+  VIXL_CHECK(copy.GetSignedSaturation(200) ==
+             LogicVRegister::kSignedSatPositive);
+  VIXL_CHECK(copy.GetRounding(100));
+  VIXL_CHECK(!copy.GetRounding(255));
+
+  logic.ClearSat(200);
+  logic.ClearSat(255);
+  VIXL_CHECK(logic.GetSignedSaturation(200) == LogicVRegister::kNotSaturated);
+  VIXL_CHECK(copy.GetSignedSaturation(200) ==
+             LogicVRegister::kSignedSatPositive);
+}
 #endif
 
 }  // namespace aarch64
@@ -36,6 +36,7 @@
 #include "test-utils.h"
 #include "aarch64/test-utils-aarch64.h"
 
+#include "aarch64/code-patching-aarch64.h"
 #include "aarch64/cpu-aarch64.h"
 #include "aarch64/disasm-aarch64.h"
 #include "aarch64/macro-assembler-aarch64.h"
@@ -4251,6 +4252,59 @@ TEST(ldr_literal_range) {
 }
 
 
+TEST(ldr_literal_shared) {
+  SETUP_WITH_FEATURES(CPUFeatures::kNEON, CPUFeatures::kFP);
+
+  START();
+  // Make sure the pool is empty;
+  masm.EmitLiteralPool(LiteralPool::kBranchRequired);
+  ASSERT_LITERAL_POOL_SIZE(0);
+
+  // Loads of the same value and size share a pool entry.
+  __ Ldr(x0, 0x1234567890abcdef);
+  __ Ldr(x1, 0x1234567890abcdef);
+  __ Ldr(d0, 1.234);
+  __ Ldr(d1, 1.234);
+  __ Fmov(d2, 1.234);
+  __ Ldr(w2, 0x80000000);
+  __ Ldrsw(x3, 0x80000000);
+  __ Ldr(q3, 0x1234000056780000, 0xabcd0000ef000000);
+  __ Ldr(q4, 0x1234000056780000, 0xabcd0000ef000000);
+  ASSERT_LITERAL_POOL_SIZE(36);
+
+  // The same value in a different size needs a new entry.
+  __ Ldr(w5, 0x90abcdef);
+  __ Ldr(x6, 0x90abcdef);
+  ASSERT_LITERAL_POOL_SIZE(48);
+
+  // Values are only shared until the pool is emitted.
+  masm.EmitLiteralPool(LiteralPool::kBranchRequired);
+  ASSERT_LITERAL_POOL_SIZE(0);
+  __ Ldr(x7, 0x1234567890abcdef);
+  __ Ldr(d7, 1.234);
+  ASSERT_LITERAL_POOL_SIZE(16);
+  END();
+
+  if (CAN_RUN()) {
+    RUN();
+
+    ASSERT_EQUAL_64(0x1234567890abcdef, x0);
+    ASSERT_EQUAL_64(0x1234567890abcdef, x1);
+    ASSERT_EQUAL_FP64(1.234, d0);
+    ASSERT_EQUAL_FP64(1.234, d1);
+    ASSERT_EQUAL_FP64(1.234, d2);
+    ASSERT_EQUAL_64(0x80000000, x2);
+    ASSERT_EQUAL_64(0xffffffff80000000, x3);
+    ASSERT_EQUAL_128(0x1234000056780000, 0xabcd0000ef000000, q3);
+    ASSERT_EQUAL_128(0x1234000056780000, 0xabcd0000ef000000, q4);
+    ASSERT_EQUAL_64(0x90abcdef, x5);
+    ASSERT_EQUAL_64(0x90abcdef, x6);
+    ASSERT_EQUAL_64(0x1234567890abcdef, x7);
+    ASSERT_EQUAL_FP64(1.234, d7);
+  }
+}
+
+
 template <typename T>
 void LoadIntValueHelper(T values[], int card) {
   SETUP();
@@ -12861,6 +12915,95 @@ TEST(crc32cx) {
   }
 }
 
+// A bit-by-bit reference implementation of the CRC32 instructions, following
+// the Arm ARM pseudocode.
+static uint32_t ReferenceCrc32(uint32_t acc,
+                               uint64_t val,
+                               int size_in_bits,
+                               uint32_t poly) {
+  if (size_in_bits == 64) {
+    acc = ReferenceCrc32(acc, val & 0xffffffff, 32, poly);
+    return ReferenceCrc32(acc, val >> 32, 32, poly);
+  }
+  uint64_t data = static_cast<uint64_t>(ReverseBits(acc)) << size_in_bits;
+  data ^= static_cast<uint64_t>(
+              ReverseBits(static_cast<uint32_t>(val)) >> (32 - size_in_bits))
+          << 32;
+  for (int i = 32 + size_in_bits - 1; i >= 32; i--) {
+    if (((data >> i) & 1) != 0) {
+      uint64_t mask = (UINT64_C(1) << i) - 1;
+      data = (data & mask) ^ (static_cast<uint64_t>(poly) << (i - 32));
+    }
+  }
+  return ReverseBits(static_cast<uint32_t>(data));
+}
+
+TEST(crc32_random) {
+  SETUP_WITH_FEATURES(CPUFeatures::kCRC32);
+
+  typedef void (MacroAssembler::*CrcFn)(const Register& rd,
+                                        const Register& rn,
+                                        const Register& rm);
+  struct {
+    CrcFn fn;
+    int size_in_bits;
+    uint32_t poly;
+  } const kInstructions[] = {{&MacroAssembler::Crc32b, 8, 0x04c11db7},
+                             {&MacroAssembler::Crc32h, 16, 0x04c11db7},
+                             {&MacroAssembler::Crc32w, 32, 0x04c11db7},
+                             {&MacroAssembler::Crc32x, 64, 0x04c11db7},
+                             {&MacroAssembler::Crc32cb, 8, 0x1edc6f41},
+                             {&MacroAssembler::Crc32ch, 16, 0x1edc6f41},
+                             {&MacroAssembler::Crc32cw, 32, 0x1edc6f41},
+                             {&MacroAssembler::Crc32cx, 64, 0x1edc6f41}};
+  const int kInstructionCount = static_cast<int>(ArrayLength(kInstructions));
+  const int kInputsPerInstruction = 64;
+  const int kInputCount = kInstructionCount * kInputsPerInstruction;
+
+  uint64_t accs[kInputCount];
+  uint64_t vals[kInputCount];
+  uint64_t results[kInputCount];
+  // A simple xorshift generator, with a fixed seed so that failures are
+  // reproducible.
+  uint64_t state = 0x2545f4914f6cdd1d;
+  for (int i = 0; i < kInputCount; i++) {
+    state ^= state << 13;
+    state ^= state >> 7;
+    state ^= state << 17;
+    accs[i] = state & 0xffffffff;
+    vals[i] = state ^ (state << 32);
+  }
+
+  START();
+  __ Mov(x20, reinterpret_cast<uintptr_t>(accs));
+  __ Mov(x21, reinterpret_cast<uintptr_t>(vals));
+  __ Mov(x22, reinterpret_cast<uintptr_t>(results));
+  for (int i = 0; i < kInstructionCount; i++) {
+    for (int j = 0; j < kInputsPerInstruction; j++) {
+      __ Ldr(w0, MemOperand(x20, 8, PostIndex));
+      __ Ldr(x1, MemOperand(x21, 8, PostIndex));
+      Register rm = (kInstructions[i].size_in_bits == 64) ? x1 : w1;
+      (masm.*kInstructions[i].fn)(w2, w0, rm);
+      __ Str(x2, MemOperand(x22, 8, PostIndex));
+    }
+  }
+  END();
+
+  if (CAN_RUN()) {
+    RUN();
+
+    for (int i = 0; i < kInputCount; i++) {
+      int insn = i / kInputsPerInstruction;
+      uint32_t expected =
+          ReferenceCrc32(static_cast<uint32_t>(accs[i]),
+                         vals[i],
+                         kInstructions[insn].size_in_bits,
+                         kInstructions[insn].poly);
+      VIXL_CHECK(results[i] == expected);
+    }
+  }
+}
+
 TEST(regress_cmp_shift_imm) {
   SETUP();
 
@@ -13137,6 +13280,53 @@ TEST(veneers_stress) {
 }
 
 
+TEST(veneers_many_labels) {
+  SETUP();
+  START();
+
+  // This is a code generation test stressing the tracking of many unresolved
+  // branches, resolved in an order unrelated to their emission. The code
+  // generated is not executed.
+
+  const int kLabelCount = 1024;
+  std::vector<Label> labels(kLabelCount);
+  for (int i = 0; i < kLabelCount; i++) {
+    switch (i % 3) {
+      case 0:
+        __ Tbz(x0, i % kXRegSize, &labels[i]);
+        break;
+      case 1:
+        __ Cbz(x1, &labels[i]);
+        break;
+      default:
+        __ B(ne, &labels[i]);
+    }
+  }
+  VIXL_CHECK(masm.GetNumberOfPotentialVeneers() == kLabelCount);
+
+  // Bind every other label, in a scattered order.
+  for (int i = 0; i < kLabelCount; i += 2) {
+    __ Bind(&labels[(i * 37) % kLabelCount]);
+  }
+  VIXL_CHECK(masm.GetNumberOfPotentialVeneers() == (kLabelCount / 2));
+
+  // Force veneers to be emitted for the remaining tbz branches.
+  int range_tbz = Instruction::GetImmBranchForwardRange(TestBranchType);
+  int max_target = static_cast<int>(masm.GetCursorOffset()) + range_tbz;
+  while (masm.GetCursorOffset() < max_target) {
+    __ Nop();
+  }
+  VIXL_CHECK(masm.GetNumberOfPotentialVeneers() < (kLabelCount / 2));
+
+  for (int i = 1; i < kLabelCount; i += 2) {
+    __ Bind(&labels[i]);
+  }
+  VIXL_CHECK(masm.GetNumberOfPotentialVeneers() == 0);
+
+  END();
+}
+
+
 TEST(veneers_two_out_of_range) {
   SETUP();
   START();
@@ -13444,6 +13634,85 @@ TEST(literal_update_overwrite) {
 }
 
 
+#ifdef VIXL_CODE_BUFFER_MMAP
+TEST(patching_session) {
+  SETUP();
+
+  START();
+
+  LiteralPool* literal_pool = masm.GetLiteralPool();
+  Literal<int64_t> lit(0xbad, literal_pool);
+
+  Label target_a, target_b, done;
+  __ Mov(x2, 0);
+  __ Mov(x3, 0);
+  __ Ldr(x1, &lit);
+  ptrdiff_t mov_offset;
+  ptrdiff_t branch_offset;
+  {
+    ExactAssemblyScope scope(&masm, 2 * kInstructionSize);
+    mov_offset = masm.GetCursorOffset();
+    __ movz(x3, 1);
+    branch_offset = masm.GetCursorOffset();
+    __ b(&target_a);
+  }
+  __ Bind(&target_a);
+  __ Mov(x2, 1);
+  __ B(&done);
+  __ Bind(&target_b);
+  __ Mov(x2, 2);
+  __ Bind(&done);
+
+  masm.EmitLiteralPool(LiteralPool::kBranchRequired);
+
+  END();
+
+  if (CAN_RUN()) {
+    VIXL_ASSERT(lit.IsPlaced());
+    masm.GetBuffer()->SetExecutable();
+    {
+      PatchingSession session(masm.GetBuffer());
+      session.UpdateLiteral(&lit, INT64_C(0x0123456789abcdef));
+      session.PatchInstruction(mov_offset, HINT | Assembler::ImmHint(NOP));
+      session.RetargetBranch(branch_offset, target_b.GetLocation());
+    }
+    masm.GetBuffer()->SetWritable();
+
+    RUN();
+
+    ASSERT_EQUAL_64(0x0123456789abcdef, x1);
+    ASSERT_EQUAL_64(2, x2);
+    ASSERT_EQUAL_64(0, x3);
+  }
+}
+
+
+TEST(patching_session_partial_page) {
+  // The capacity of the buffer is not a whole number of pages.
+  const size_t capacity = 1024;
+  VIXL_ASSERT(!IsMultiple(capacity, CodeBuffer::GetPageSize()));
+  MacroAssembler masm(capacity);
+  {
+    ExactAssemblyScope scope(&masm, 2 * kInstructionSize);
+    __ movz(x0, 1);
+    __ ret();
+  }
+  masm.FinalizeCode();
+  CodeBuffer* buffer = masm.GetBuffer();
+  buffer->SetExecutable();
+  {
+    PatchingSession session(buffer);
+    session.PatchInstruction(0, HINT | Assembler::ImmHint(NOP));
+  }
+  buffer->SetWritable();
+
+  VIXL_CHECK(buffer->GetCapacity() == capacity);
+  VIXL_CHECK(buffer->GetStartAddress<Instruction*>()->GetInstructionBits() ==
+             (HINT | Assembler::ImmHint(NOP)));
+}
+#endif
+
+
 TEST(literal_deletion_policies) {
   SETUP();
 
@@ -14523,6 +14792,365 @@ TEST(large_sim_stack) {
   }
 }
 
+TEST(decode_cache) {
+  SETUP();
+  simulator.EnableDecodeCache();
+  START();
+
+  Label loop;
+  __ Mov(x0, 0);
+  __ Mov(x1, 100);
+  __ Bind(&loop);
+  __ Add(x0, x0, 3);
+  __ Subs(x1, x1, 1);
+  __ B(ne, &loop);
+
+  END();
+  if (CAN_RUN()) {
+    RUN();
+    ASSERT_EQUAL_64(300, x0);
+    ASSERT_EQUAL_64(0, x1);
+  }
+}
+
+TEST(decode_cache_patched_code) {
+  SETUP();
+  // Use a small cache, so that some entries are evicted.
+  simulator.EnableDecodeCache(4);
+  START();
+
+  Label loop;
+  __ Mov(x0, 0);
+  __ Mov(x1, 100);
+  __ Bind(&loop);
+  ptrdiff_t add_offset = masm.GetCursorOffset();
+  {
+    ExactAssemblyScope scope(&masm, kInstructionSize);
+    __ add(x0, x0, 3);
+  }
+  __ Subs(x1, x1, 1);
+  __ B(ne, &loop);
+
+  END();
+  if (CAN_RUN()) {
+    RUN();
+    ASSERT_EQUAL_64(300, x0);
+
+    // Patch the add instruction without flushing the decode cache. The
+    // Simulator should notice that the encoding has changed.
+    Instruction* add =
+        masm.GetBuffer()->GetOffsetAddress<Instruction*>(add_offset);
+    masm.GetBuffer()->SetWritable();
+    add->SetInstructionBits((add->GetInstructionBits() & ~ImmAddSub_mask) |
+                            (5 << ImmAddSub_offset));
+    masm.GetBuffer()->SetExecutable();
+    RUN();
+    ASSERT_EQUAL_64(500, x0);
+
+    // Flushing the cache explicitly is also allowed.
+    simulator.FlushDecodeCache(add, kInstructionSize);
+    RUN();
+    ASSERT_EQUAL_64(500, x0);
+    simulator.FlushDecodeCache();
+    RUN();
+    ASSERT_EQUAL_64(500, x0);
+
+    simulator.DisableDecodeCache();
+    VIXL_CHECK(!simulator.IsDecodeCacheEnabled());
+    RUN();
+    ASSERT_EQUAL_64(500, x0);
+  }
+}
+
+TEST(block_execution) {
+  SETUP();
+  simulator.EnableBlockExecution();
+  START();
+
+  Label loop, subroutine, done;
+  __ Mov(x0, 0);
+  __ Mov(x1, 100);
+  __ Mov(x2, 0);
+  __ Mov(x19, lr);
+  __ Bind(&loop);
+  __ Add(x0, x0, 3);
+  __ Bl(&subroutine);
+  __ Subs(x1, x1, 1);
+  __ B(ne, &loop);
+  __ Mov(lr, x19);
+  __ B(&done);
+
+  __ Bind(&subroutine);
+  __ Add(x2, x2, 1);
+  __ Add(x2, x2, 1);
+  __ Ret();
+
+  __ Bind(&done);
+  END();
+  if (CAN_RUN()) {
+    RUN();
+    ASSERT_EQUAL_64(300, x0);
+    ASSERT_EQUAL_64(0, x1);
+    ASSERT_EQUAL_64(200, x2);
+  }
+}
+
+TEST(block_execution_patched_code) {
+  SETUP();
+  // Use a small number of blocks, so that some blocks are evicted.
+  simulator.EnableBlockExecution(2);
+  START();
+
+  Label loop;
+  __ Mov(x0, 0);
+  __ Mov(x1, 100);
+  __ Bind(&loop);
+  __ Sub(x1, x1, 1);
+  ptrdiff_t add_offset = masm.GetCursorOffset();
+  {
+    ExactAssemblyScope scope(&masm, kInstructionSize);
+    __ add(x0, x0, 3);
+  }
+  __ Cbnz(x1, &loop);
+
+  END();
+  if (CAN_RUN()) {
+    RUN();
+    ASSERT_EQUAL_64(300, x0);
+
+    // Patch an instruction in the middle of the loop's block without flushing
+    // anything. The Simulator should notice that the encoding has changed.
+    Instruction* add =
+        masm.GetBuffer()->GetOffsetAddress<Instruction*>(add_offset);
+    masm.GetBuffer()->SetWritable();
+    add->SetInstructionBits((add->GetInstructionBits() & ~ImmAddSub_mask) |
+                            (5 << ImmAddSub_offset));
+    masm.GetBuffer()->SetExecutable();
+    RUN();
+    ASSERT_EQUAL_64(500, x0);
+
+    simulator.FlushDecodeCache(add, kInstructionSize);
+    RUN();
+    ASSERT_EQUAL_64(500, x0);
+
+    // Block execution and the decode cache can be used together.
+    simulator.EnableDecodeCache();
+    RUN();
+    ASSERT_EQUAL_64(500, x0);
+
+    simulator.DisableBlockExecution();
+    VIXL_CHECK(!simulator.IsBlockExecutionEnabled());
+    RUN();
+    ASSERT_EQUAL_64(500, x0);
+  }
+}
+
+// Register the code, the register dump and `data` in `space`, and attach it to
+// the Simulator.
+#define SETUP_ADDRESS_SPACE(space, data, data_permissions)                 \
+  space.AddRegion(masm.GetBuffer()->GetStartAddress<uintptr_t>(),         \
+                  masm.GetBuffer()->GetCapacity(),                        \
+                  SimAddressSpace::kReadExecute);                         \
+  space.AddRegion(reinterpret_cast<uintptr_t>(&core),                     \
+                  sizeof(core),                                           \
+                  SimAddressSpace::kReadWrite);                           \
+  space.AddRegion(reinterpret_cast<uintptr_t>(data),                      \
+                  sizeof(data),                                           \
+                  data_permissions);                                      \
+  simulator.SetAddressSpace(&space)
+
+TEST(sim_address_space) {
+  SETUP();
+
+  uint64_t data[] = {0x0123456789abcdef, 0};
+  uint64_t readonly[] = {42};
+
+  START();
+  __ Mov(x0, reinterpret_cast<uintptr_t>(data));
+  __ Ldr(x10, MemOperand(x0));
+  __ Str(x10, MemOperand(x0, 8));
+  // The Simulator's stack is accessible.
+  __ Push(x10, xzr);
+  __ Pop(xzr, x11);
+  END();
+
+  if (CAN_RUN()) {
+    SimAddressSpace space;
+    SETUP_ADDRESS_SPACE(space, data, SimAddressSpace::kReadWrite);
+    space.AddRegion(reinterpret_cast<uintptr_t>(readonly),
+                    sizeof(readonly),
+                    SimAddressSpace::kRead);
+    RUN();
+    simulator.SetAddressSpace(nullptr);
+
+    ASSERT_EQUAL_64(0x0123456789abcdef, x10);
+    ASSERT_EQUAL_64(0x0123456789abcdef, x11);
+    VIXL_CHECK(data[1] == 0x0123456789abcdef);
+
+    // Detaching the address space removes the stack from it, so it can be
+    // attached again.
+    VIXL_CHECK(space.GetRegionCount() == 4);
+    simulator.SetAddressSpace(&space);
+    VIXL_CHECK(space.GetRegionCount() == 5);
+    RUN();
+    simulator.SetAddressSpace(&space);
+    VIXL_CHECK(space.GetRegionCount() == 5);
+
+    // Find the bottom of the stack region.
+    uint64_t limit = simulator.ReadXRegister(31, Reg31IsStackPointer);
+    while (space.IsAccessAllowed(limit - 1, 1, SimAddressSpace::kReadWrite)) {
+      limit--;
+    }
+
+    // If the embedder replaces the stack region with one of their own, it is
+    // left alone when the address space is detached.
+    space.RemoveRegion(limit);
+    space.AddRegion(limit, 16, SimAddressSpace::kRead);
+    simulator.SetAddressSpace(nullptr);
+    VIXL_CHECK(space.GetRegionCount() == 5);
+    VIXL_CHECK(space.IsAccessAllowed(limit, 16, SimAddressSpace::kRead));
+    space.RemoveRegion(limit);
+    VIXL_CHECK(space.GetRegionCount() == 4);
+  }
+}
+
+TEST(sim_snapshot) {
+  SETUP_WITH_FEATURES(CPUFeatures::kFP);
+
+  // Use a buffer to hold MTE tags.
+  alignas(kMTETagGranuleInBytes) uint8_t tagged[2 * kMTETagGranuleInBytes];
+
+  START();
+  __ Mov(x0, 0x1234);
+  __ Cmp(x0, 0x1234);
+  __ Fmov(d0, 1.5);
+  __ Push(x0, xzr);
+  __ Pop(xzr, x1);
+  END();
+
+  if (CAN_RUN()) {
+    simulator.SetGranuleTag(tagged, 3, sizeof(tagged));
+
+    Simulator::Snapshot snapshot;
+    VIXL_CHECK(!snapshot.IsValid());
+    simulator.TakeSnapshot(&snapshot);
+    VIXL_CHECK(snapshot.IsValid());
+
+    int64_t saved_x0 = simulator.ReadXRegister(0);
+    uint64_t saved_d0 = simulator.ReadDRegisterBits(0);
+    uint32_t saved_nzcv = simulator.ReadNzcv().GetRawValue();
+    const char* stack_pointer = reinterpret_cast<const char*>(
+        simulator.ReadXRegister(31, Reg31IsStackPointer));
+    char stack[64];
+    memcpy(stack, stack_pointer - sizeof(stack), sizeof(stack));
+
+    RUN();
+    ASSERT_EQUAL_64(0x1234, x1);
+    VIXL_CHECK(memcmp(stack, stack_pointer - sizeof(stack), sizeof(stack)) != 0);
+
+    // Modify the tags after the snapshot. The snapshot shares the tag pages,
+    // so this must not affect it.
+    simulator.SetGranuleTag(tagged, 5);
+    simulator.CleanGranuleTag(tagged + kMTETagGranuleInBytes);
+
+    simulator.RestoreSnapshot(snapshot);
+    VIXL_CHECK(simulator.ReadXRegister(0) == saved_x0);
+    VIXL_CHECK(simulator.ReadDRegisterBits(0) == saved_d0);
+    VIXL_CHECK(simulator.ReadNzcv().GetRawValue() == saved_nzcv);
+    VIXL_CHECK(memcmp(stack, stack_pointer - sizeof(stack), sizeof(stack)) == 0);
+    VIXL_CHECK(simulator.GetGranuleTag(tagged) == 3);
+    VIXL_CHECK(simulator.GetGranuleTag(tagged + kMTETagGranuleInBytes) == 3);
+
+    // The snapshot can be restored again after another run.
+    RUN();
+    ASSERT_EQUAL_64(0x1234, x1);
+    simulator.RestoreSnapshot(snapshot);
+    VIXL_CHECK(simulator.ReadXRegister(0) == saved_x0);
+
+    simulator.CleanGranuleTag(tagged, sizeof(tagged));
+  }
+}
+
+TEST(sim_vector_kernels) {
+  SETUP_WITH_FEATURES(CPUFeatures::kNEON);
+
+  // The inputs share some lanes, so that the comparisons produce a mixture of
+  // results.
+  const uint64_t inputs[] = {0x0123456789abcdef,
+                             0xfedcba9876543210,
+                             0x0123ffff8000abcd,
+                             0x7fdcba9800003210};
+  const int kOutputRegs = 41;
+  uint64_t results[kOutputRegs * 2];
+  uint64_t reference[kOutputRegs * 2];
+
+  START();
+  __ Mov(x0, reinterpret_cast<uintptr_t>(inputs));
+  __ Mov(x1, reinterpret_cast<uintptr_t>(results));
+  __ Ldp(q0, q1, MemOperand(x0));
+
+  VectorFormat formats[] = {kFormat8B,
+                            kFormat16B,
+                            kFormat4H,
+                            kFormat8H,
+                            kFormat2S,
+                            kFormat4S,
+                            kFormat2D};
+  for (size_t i = 0; i < ArrayLength(formats); i++) {
+    VRegister vn = VRegister(0, formats[i]);
+    VRegister vm = VRegister(1, formats[i]);
+    VRegister vd = VRegister(2, formats[i]);
+    VRegister vt = VRegister(3, formats[i]);
+    __ Add(vd, vn, vm);
+    __ St1(v2.V16B(), MemOperand(x1, 16, PostIndex));
+    __ Sub(vd, vn, vm);
+    __ St1(v2.V16B(), MemOperand(x1, 16, PostIndex));
+    __ Cmeq(vd, vn, vm);
+    __ Cmge(vd, vn, vm);
+    __ Cmgt(vt, vn, vm);
+    __ Orr(v2.V16B(), v2.V16B(), v3.V16B());
+    __ St1(v2.V16B(), MemOperand(x1, 16, PostIndex));
+    __ Cmhi(vd, vn, vm);
+    __ Cmhs(vt, vm, vn);
+    __ Eor(v2.V16B(), v2.V16B(), v3.V16B());
+    __ St1(v2.V16B(), MemOperand(x1, 16, PostIndex));
+    __ Cmle(vd, vn, 0);
+    __ Cmlt(vt, vm, 0);
+    __ And(v2.V16B(), v2.V16B(), v3.V16B());
+    __ St1(v2.V16B(), MemOperand(x1, 16, PostIndex));
+  }
+  __ Mul(v2.V16B(), v0.V16B(), v1.V16B());
+  __ St1(v2.V16B(), MemOperand(x1, 16, PostIndex));
+  __ Mul(v2.V4H(), v0.V4H(), v1.V4H());
+  __ St1(v2.V16B(), MemOperand(x1, 16, PostIndex));
+  __ Mul(v2.V4S(), v0.V4S(), v1.V4S());
+  __ St1(v2.V16B(), MemOperand(x1, 16, PostIndex));
+  __ Mla(v2.V8H(), v0.V8H(), v1.V8H());
+  __ Mls(v2.V4S(), v0.V4S(), v1.V4S());
+  __ St1(v2.V16B(), MemOperand(x1, 16, PostIndex));
+  __ Add(d2, d0, d1);
+  __ Sub(d3, d0, d1);
+  __ St1(v2.V16B(), v3.V16B(), MemOperand(x1));
+  END();
+
+  if (CAN_RUN()) {
+    VIXL_CHECK(simulator.AreVectorKernelsEnabled());
+    RUN();
+    memcpy(reference, results, sizeof(results));
+
+    // Run the reference implementation, and check that it gives the same
+    // results.
+    memset(results, 0, sizeof(results));
+    simulator.DisableVectorKernels();
+    RUN();
+    VIXL_CHECK(memcmp(reference, results, sizeof(results)) == 0);
+
+    // Spot-check some results.
+    VIXL_CHECK(reference[0] == 0x0246446609ab78bc);   // Add 8B
+    VIXL_CHECK(reference[60] == 0x0247456709ac79bc);  // Add 2D
+  }
+}
+
 #ifdef VIXL_NEGATIVE_TESTING
 TEST(sim_stack_limit_guard_read) {
   SimStack builder;
@@ -14607,6 +15235,107 @@ TEST(sim_stack_base_guard_write) {
     MUST_FAIL_WITH_MESSAGE(RUN(), "Attempt to write to stack guard region");
   }
 }
+
+TEST(sim_address_space_read) {
+  SETUP();
+
+  uint64_t data[] = {42};
+
+  START();
+  __ Mov(x0, reinterpret_cast<uintptr_t>(data));
+  __ Ldr(x10, MemOperand(x0));
+  END();
+
+  if (CAN_RUN()) {
+    SimAddressSpace space;
+    SETUP_ADDRESS_SPACE(space, data, SimAddressSpace::kWrite);
+    MUST_FAIL_WITH_MESSAGE(RUN(), "Attempt to read from an unreadable address");
+    simulator.SetAddressSpace(nullptr);
+  }
+}
+
+TEST(sim_address_space_write) {
+  SETUP();
+
+  uint64_t data[] = {42};
+
+  START();
+  __ Mov(x0, reinterpret_cast<uintptr_t>(data));
+  __ Mov(x10, 0);
+  // The last byte of this access is outside `data`.
+  __ Str(x10, MemOperand(x0, 1));
+  END();
+
+  if (CAN_RUN()) {
+    SimAddressSpace space;
+    SETUP_ADDRESS_SPACE(space, data, SimAddressSpace::kReadWrite);
+    MUST_FAIL_WITH_MESSAGE(RUN(), "Attempt to write to an unwritable address");
+    simulator.SetAddressSpace(nullptr);
+    VIXL_CHECK(data[0] == 42);
+  }
+}
+
+TEST(sim_address_space_execute) {
+  SETUP();
+
+  // Branching to `data` must not execute it.
+  uint32_t data[] = {0};
+
+  START();
+  __ Mov(x0, reinterpret_cast<uintptr_t>(data));
+  __ Blr(x0);
+  END();
+
+  if (CAN_RUN()) {
+    SimAddressSpace space;
+    SETUP_ADDRESS_SPACE(space, data, SimAddressSpace::kReadWrite);
+    MUST_FAIL_WITH_MESSAGE(RUN(),
+                           "Attempt to execute from a non-executable address");
+    simulator.SetAddressSpace(nullptr);
+  }
+}
+
+TEST(sim_address_space_execute_partial_page) {
+  SETUP();
+  simulator.EnableBlockExecution();
+
+  uint64_t data[] = {0};
+
+  START();
+  ptrdiff_t end_offset;
+  {
+    // Straight-line code, so that the executable region ends in the middle of
+    // a translated block.
+    ExactAssemblyScope scope(&masm, 4 * kInstructionSize);
+    __ movz(x1, 1);
+    __ movz(x2, 2);
+    end_offset = masm.GetCursorOffset();
+    __ movz(x3, 3);
+    __ movz(x4, 4);
+  }
+  END();
+
+  if (CAN_RUN()) {
+    SimAddressSpace space;
+    SETUP_ADDRESS_SPACE(space, data, SimAddressSpace::kReadWrite);
+
+    // Only the code before `end_offset` is executable. The region ends in the
+    // middle of a page.
+    uintptr_t code = masm.GetBuffer()->GetStartAddress<uintptr_t>();
+    VIXL_ASSERT(!IsAligned(code + end_offset, SimAddressSpace::kPageSize));
+    space.RemoveRegion(code);
+    space.AddRegion(code, end_offset, SimAddressSpace::kReadExecute);
+    space.AddRegion(code + end_offset,
+                    masm.GetBuffer()->GetCapacity() - end_offset,
+                    SimAddressSpace::kRead);
+
+    MUST_FAIL_WITH_MESSAGE(RUN(),
+                           "Attempt to execute from a non-executable address");
+    VIXL_CHECK(simulator.ReadXRegister(2) == 2);
+    VIXL_CHECK(simulator.ReadXRegister(3) != 3);
+    simulator.SetAddressSpace(nullptr);
+  }
+}
 #endif
 #endif
 
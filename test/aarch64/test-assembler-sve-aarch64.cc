@@ -19980,5 +19980,144 @@ Test* test_sve_ld1ro_list[] =
      Test::MakeSVETest(2048, "AARCH64_ASM_sve_ld1ro_vl2048", &Test_sve_ld1ro)};
 #endif
 
+#ifdef VIXL_INCLUDE_SIMULATOR_AARCH64
+TEST_SVE(sve_vector_kernels) {
+  SVE_SETUP_WITH_FEATURES(CPUFeatures::kSVE);
+
+  const int kResultsPerLaneSize = 8;
+  const int kResultCount = 4 * kResultsPerLaneSize;
+  uint8_t results[kResultCount * kZRegMaxSizeInBytes];
+  uint8_t reference[kResultCount * kZRegMaxSizeInBytes];
+
+  START();
+  __ Mov(x0, reinterpret_cast<uintptr_t>(results));
+  __ Index(z0.VnB(), 3, 7);
+  __ Index(z1.VnB(), -100, 13);
+
+  // Make an irregular predicate that covers the whole vector.
+  __ Ptrue(p0.VnB());
+  __ Index(z2.VnB(), 0, 37);
+  __ Cmplt(p1.VnB(), p0.Zeroing(), z2.VnB(), 0);
+
+  int index = 0;
+  for (unsigned lane_size = kBRegSize; lane_size <= kDRegSize;
+       lane_size *= 2) {
+    ZRegister zn = z0.WithLaneSize(lane_size);
+    ZRegister zm = z1.WithLaneSize(lane_size);
+    ZRegister zd = z3.WithLaneSize(lane_size);
+
+    __ Sel(zd, p1, zn, zm);
+    __ Str(zd, SVEMemOperand(x0, index++, SVE_MUL_VL));
+    {
+      ExactAssemblyScope guard(&masm, 2 * kInstructionSize);
+      __ movprfx(zd, p1.Zeroing(), zn);
+      __ add(zd, p1.Merging(), zd, zm);
+    }
+    __ Str(zd, SVEMemOperand(x0, index++, SVE_MUL_VL));
+    __ Add(zd, p1.Merging(), zn, zm);
+    __ Str(zd, SVEMemOperand(x0, index++, SVE_MUL_VL));
+    __ Mul(zd, p1.Merging(), zn, zm);
+    __ Str(zd, SVEMemOperand(x0, index++, SVE_MUL_VL));
+    __ Add(zd, zn, zm);
+    __ Str(zd, SVEMemOperand(x0, index++, SVE_MUL_VL));
+    __ Sub(zd, zn, zm);
+    __ Str(zd, SVEMemOperand(x0, index++, SVE_MUL_VL));
+    __ And(zd, zn, zm);
+    __ Str(zd, SVEMemOperand(x0, index++, SVE_MUL_VL));
+    __ Eor(zd, zn, zm);
+    __ Str(zd, SVEMemOperand(x0, index++, SVE_MUL_VL));
+  }
+  VIXL_ASSERT(index == kResultCount);
+  END();
+
+  if (CAN_RUN()) {
+    memset(results, 0, sizeof(results));
+    RUN();
+    memcpy(reference, results, sizeof(results));
+
+    // The specialised kernels must match the generic lane-by-lane code.
+    memset(results, 0, sizeof(results));
+    simulator.DisableVectorKernels();
+    RUN();
+    VIXL_CHECK(memcmp(reference, results, sizeof(results)) == 0);
+  }
+}
+
+TEST_SVE(sve_while_kernels) {
+  SVE_SETUP_WITH_FEATURES(CPUFeatures::kSVE, CPUFeatures::kSVE2);
+
+  typedef void (MacroAssembler::*WhileFn)(const PRegisterWithLaneSize& pd,
+                                          const Register& rn,
+                                          const Register& rm);
+  const WhileFn fns[] = {&MacroAssembler::Whilele,
+                         &MacroAssembler::Whilelo,
+                         &MacroAssembler::Whilels,
+                         &MacroAssembler::Whilelt,
+                         &MacroAssembler::Whilege,
+                         &MacroAssembler::Whilegt,
+                         &MacroAssembler::Whilehi,
+                         &MacroAssembler::Whilehs};
+  // Include values around the signed and unsigned limits, for both W and X
+  // registers, and some that are close together.
+  const uint64_t values[] = {0,
+                             1,
+                             5,
+                             40,
+                             0x7ffffffd,
+                             0x7fffffff,
+                             0x80000000,
+                             0xfffffffe,
+                             0xffffffff,
+                             0x7fffffffffffffff,
+                             0x8000000000000001,
+                             0xffffffffffffffff};
+  const int kValueCount = static_cast<int>(ArrayLength(values));
+  const int kFnCount = static_cast<int>(ArrayLength(fns));
+  const int kResultCount = kFnCount * 4 * 2 * kValueCount * kValueCount;
+  // Store each predicate followed by NZCV.
+  const int kResultSize = kPRegMaxSizeInBytes + kXRegSizeInBytes;
+  std::vector<uint8_t> results(kResultCount * kResultSize);
+  std::vector<uint8_t> reference;
+
+  START();
+  __ Mov(x0, reinterpret_cast<uintptr_t>(results.data()));
+  for (int fn = 0; fn < kFnCount; fn++) {
+    for (unsigned lane_size = kBRegSize; lane_size <= kDRegSize;
+         lane_size *= 2) {
+      PRegisterWithLaneSize pd = p0.WithLaneSize(lane_size);
+      for (int is_x = 0; is_x < 2; is_x++) {
+        for (int i = 0; i < kValueCount; i++) {
+          for (int j = 0; j < kValueCount; j++) {
+            __ Mov(x1, values[i]);
+            __ Mov(x2, values[j]);
+            if (is_x) {
+              (masm.*fns[fn])(pd, x1, x2);
+            } else {
+              (masm.*fns[fn])(pd, w1, w2);
+            }
+            __ Str(p0, SVEMemOperand(x0));
+            __ Mrs(x3, NZCV);
+            __ Str(x3, MemOperand(x0, kPRegMaxSizeInBytes));
+            __ Add(x0, x0, kResultSize);
+          }
+        }
+      }
+    }
+  }
+  END();
+
+  if (CAN_RUN()) {
+    RUN();
+    reference = results;
+
+    // The directly computed predicates must match the lane-by-lane loop.
+    std::fill(results.begin(), results.end(), 0);
+    simulator.DisableVectorKernels();
+    RUN();
+    VIXL_CHECK(results == reference);
+  }
+}
+#endif
+
 }  // namespace aarch64
 }  // namespace vixl
@@ -0,0 +1,236 @@
+// Copyright 2026, VIXL authors
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//   * Redistributions of source code must retain the above copyright notice,
+//     this list of conditions and the following disclaimer.
+//   * Redistributions in binary form must reproduce the above copyright notice,
+//     this list of conditions and the following disclaimer in the documentation
+//     and/or other materials provided with the distribution.
+//   * Neither the name of ARM Limited nor the names of its contributors may be
+//     used to endorse or promote products derived from this software without
+//     specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS CONTRIBUTORS "AS IS" AND
+// ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+// WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include <string>
+
+#include "test-runner.h"
+
+#include "aarch64/decoder-aarch64.h"
+#include "aarch64/decoder-constants-aarch64.h"
+
+#define TEST(name) TEST_(AARCH64_DECODER_##name)
+
+
+namespace vixl {
+namespace aarch64 {
+
+class FormRecorder : public DecoderVisitor {
+ public:
+  FormRecorder() : form_id_(Decoder::kUnallocatedFormId), form_hash_(0) {}
+
+  void Visit(Metadata* metadata, const Instruction* instr) VIXL_OVERRIDE {
+    USE(instr);
+    form_id_ = metadata->GetFormId();
+    form_hash_ = metadata->GetFormHash();
+    form_name_ = metadata->GetFormName();
+  }
+
+  FormId GetFormId() const { return form_id_; }
+  uint32_t GetFormHash() const { return form_hash_; }
+  const std::string& GetFormName() const { return form_name_; }
+
+ private:
+  FormId form_id_;
+  uint32_t form_hash_;
+  std::string form_name_;
+};
+
+// A visitor written against the string-keyed Metadata interface.
+class LegacyFormRecorder : public DecoderVisitor {
+ public:
+  void Visit(Metadata* metadata, const Instruction* instr) VIXL_OVERRIDE {
+    USE(instr);
+    VIXL_CHECK(metadata->count("form") == 1);
+    form_ = (*metadata)["form"];
+  }
+
+  const std::string& GetForm() const { return form_; }
+
+ private:
+  std::string form_;
+};
+
+// A visitor that records every instruction and form it sees.
+class SequenceRecorder : public DecoderVisitor {
+ public:
+  SequenceRecorder() : batch_count_(0) {}
+
+  void Visit(Metadata* metadata, const Instruction* instr) VIXL_OVERRIDE {
+    DecodedInstruction decoded = {instr, metadata->GetFormId()};
+    sequence_.push_back(decoded);
+  }
+
+  void VisitBatch(const DecodedInstruction* batch,
+                  size_t count) VIXL_OVERRIDE {
+    VIXL_CHECK(count > 0);
+    VIXL_CHECK(count <= Decoder::kDecodeBatchSize);
+    batch_count_++;
+    DecoderVisitor::VisitBatch(batch, count);
+  }
+
+  const std::vector<DecodedInstruction>& GetSequence() const {
+    return sequence_;
+  }
+  int GetBatchCount() const { return batch_count_; }
+
+ private:
+  std::vector<DecodedInstruction> sequence_;
+  int batch_count_;
+};
+
+TEST(form_ids) {
+  VIXL_CHECK(Decoder::GetFormCount() > 1);
+  VIXL_CHECK(strcmp(Decoder::GetFormName(Decoder::kUnallocatedFormId),
+                    "unallocated") == 0);
+
+  for (FormId id = 0; id < Decoder::GetFormCount(); id++) {
+    const char* name = Decoder::GetFormName(id);
+    VIXL_CHECK(Decoder::GetFormId(name) == id);
+    VIXL_CHECK(Decoder::GetFormHash(id) == Hash(name));
+  }
+
+  // Form IDs are shared by all decoders.
+  FormId add = Decoder::GetFormId("add_64_addsub_shift");
+  Decoder decoder;
+  VIXL_CHECK(Decoder::GetFormId("add_64_addsub_shift") == add);
+}
+
+TEST(metadata) {
+  Decoder decoder;
+  FormRecorder recorder;
+  LegacyFormRecorder legacy_recorder;
+  decoder.AppendVisitor(&recorder);
+  decoder.AppendVisitor(&legacy_recorder);
+
+  struct {
+    Instr encoding;
+    const char* form;
+  } kTests[] = {{0x8b020020, "add_64_addsub_shift"},  // add x0, x1, x2
+                {0x1e222820, "fadd_s_floatdp2"},      // fadd s0, s1, s2
+                {0x04a20020, "add_z_zz"},             // add z0.s, z1.s, z2.s
+                {0x00000000, "udf_only_perm_undef"},  // udf #0
+                {0xffffffff, "unallocated"}};
+
+  for (size_t i = 0; i < ArrayLength(kTests); i++) {
+    Instr encoding = kTests[i].encoding;
+    decoder.Decode(reinterpret_cast<Instruction*>(&encoding));
+
+    VIXL_CHECK(recorder.GetFormId() == Decoder::GetFormId(kTests[i].form));
+    VIXL_CHECK(recorder.GetFormHash() == Hash(kTests[i].form));
+    VIXL_CHECK(recorder.GetFormName() == kTests[i].form);
+    VIXL_CHECK(legacy_recorder.GetForm() == kTests[i].form);
+  }
+}
+
+// Identify an instruction's form by interpreting kDecodeMapping directly,
+// rather than using the compiled decode table.
+typedef std::map<std::string, const DecodeMapping*> DecodeMappingMap;
+
+static const char* IdentifyFormFromMapping(const DecodeMappingMap& nodes,
+                                           Instr bits) {
+  const char* name = "Root";
+  while (nodes.count(name) != 0) {
+    const DecodeMapping* node = nodes.at(name);
+    size_t length = node->sampled_bits.size();
+    name = "unallocated";
+    for (const DecodePattern& p : node->mapping) {
+      bool match = true;
+      for (size_t i = 0; (i < length) && match; i++) {
+        uint32_t symbol = (p.pattern >> (2 * (length - i - 1))) & 3;
+        uint32_t bit = (bits >> node->sampled_bits[i]) & 1;
+        match = (symbol == 2) || (symbol == bit);
+      }
+      if (match) {
+        name = p.handler;
+        break;
+      }
+    }
+  }
+  return name;
+}
+
+TEST(decode_table) {
+  DecodeMappingMap nodes;
+  for (size_t i = 0; i < ArrayLength(kDecodeMapping); i++) {
+    nodes[kDecodeMapping[i].name] = &kDecodeMapping[i];
+  }
+
+  Decoder decoder;
+
+  // Use a simple linear congruential generator to sample encodings.
+  Instr bits = 0;
+  for (int i = 0; i < (1 << 16); i++) {
+    bits = (bits * 1103515245) + 12345;
+    FormId form_id =
+        decoder.IdentifyForm(reinterpret_cast<const Instruction*>(&bits));
+    VIXL_CHECK(strcmp(Decoder::GetFormName(form_id),
+                      IdentifyFormFromMapping(nodes, bits)) == 0);
+  }
+}
+
+TEST(decode_batch) {
+  // Use a simple linear congruential generator to make some encodings,
+  // spanning several batches.
+  const size_t kCount = (3 * Decoder::kDecodeBatchSize) + 42;
+  std::vector<Instr> code(kCount);
+  Instr bits = 0;
+  for (size_t i = 0; i < kCount; i++) {
+    bits = (bits * 1103515245) + 12345;
+    code[i] = bits;
+  }
+  const Instruction* start = reinterpret_cast<const Instruction*>(code.data());
+  const Instruction* end = start + (kCount * kInstructionSize);
+
+  Decoder decoder;
+  SequenceRecorder expected;
+  decoder.AppendVisitor(&expected);
+  decoder.Decode(start, end);
+  decoder.RemoveVisitor(&expected);
+
+  SequenceRecorder first;
+  SequenceRecorder second;
+  decoder.AppendVisitor(&first);
+  decoder.AppendVisitor(&second);
+  decoder.DecodeBatch(start, end);
+
+  VIXL_CHECK(expected.GetSequence().size() == kCount);
+  VIXL_CHECK(first.GetBatchCount() == 4);
+  VIXL_CHECK(second.GetBatchCount() == 4);
+  for (size_t i = 0; i < kCount; i++) {
+    const DecodedInstruction& e = expected.GetSequence()[i];
+    VIXL_CHECK(first.GetSequence()[i].instr == e.instr);
+    VIXL_CHECK(first.GetSequence()[i].form_id == e.form_id);
+    VIXL_CHECK(second.GetSequence()[i].instr == e.instr);
+    VIXL_CHECK(second.GetSequence()[i].form_id == e.form_id);
+  }
+
+  // An empty range visits nothing.
+  decoder.DecodeBatch(start, start);
+  VIXL_CHECK(first.GetBatchCount() == 4);
+}
+
+}  // namespace aarch64
+}  // namespace vixl
@@ -3110,6 +3110,137 @@ TEST(address_map) {
   CLEANUP();
 }
 
+static std::string ReadWholeFile(FILE* file) {
+  std::string result;
+  rewind(file);
+  char buffer[4096];
+  size_t count;
+  while ((count = fread(buffer, 1, sizeof(buffer), file)) > 0) {
+    result.append(buffer, count);
+  }
+  return result;
+}
+
+TEST(parallel_disassembler) {
+  // Generate enough code to be split into several chunks, with branches and
+  // other code-relative addresses that cross chunk boundaries.
+  const int kInstructions =
+      (4 * ParallelDisassembler::kMinChunkInstructions) + 7;
+  MacroAssembler masm;
+  {
+    ExactAssemblyScope scope(&masm, kInstructions * kInstructionSize);
+    for (int i = 0; i < kInstructions; i++) {
+      switch (i % 5) {
+        case 0:
+          masm.b(kInstructions - (2 * i));
+          break;
+        case 1:
+          masm.adr(x0, (i * 37) - kInstructions);
+          break;
+        case 2:
+          masm.ldr(x1, -i);
+          break;
+        case 3:
+          masm.bl(i);
+          break;
+        default:
+          masm.add(x2, x3, Operand(x4, LSL, i % 64));
+          break;
+      }
+    }
+  }
+  masm.FinalizeCode();
+
+  const Instruction* start = masm.GetBuffer()->GetStartAddress<Instruction*>();
+  const Instruction* end = masm.GetBuffer()->GetEndAddress<Instruction*>();
+
+  for (int mapped = 0; mapped <= 1; mapped++) {
+    FILE* expected_file = tmpfile();
+    FILE* parallel_file = tmpfile();
+    VIXL_CHECK((expected_file != NULL) && (parallel_file != NULL));
+
+    PrintDisassembler expected(expected_file);
+    ParallelDisassembler parallel(parallel_file, 4);
+    VIXL_CHECK(parallel.GetThreadCount() == 4);
+    if (mapped) {
+      expected.MapCodeAddress(-0x100, start);
+      parallel.MapCodeAddress(-0x100, start);
+      expected.PrintSignedAddresses(true);
+      parallel.PrintSignedAddresses(true);
+    }
+    expected.DisassembleBuffer(start, end);
+    parallel.DisassembleBuffer(start, end);
+
+    std::string expected_output = ReadWholeFile(expected_file);
+    std::string parallel_output = ReadWholeFile(parallel_file);
+    fclose(expected_file);
+    fclose(parallel_file);
+
+    VIXL_CHECK(!expected_output.empty());
+    if (expected_output != parallel_output) {
+      printf("Expected:\n%s\nFound:\n%s\n",
+             expected_output.c_str(),
+             parallel_output.c_str());
+      VIXL_ABORT();
+    }
+  }
+}
+
+TEST(batch_disassembler) {
+  // PrintDisassembler::DisassembleBuffer() uses Disassembler::VisitBatch(),
+  // which must produce the same output as disassembling one at a time.
+  MacroAssembler masm;
+  {
+    const int kInstructions = 300;
+    ExactAssemblyScope scope(&masm, kInstructions * kInstructionSize);
+    for (int i = 0; i < kInstructions; i++) {
+      switch (i % 4) {
+        case 0:
+          masm.b(kInstructions - (2 * i));
+          break;
+        case 1:
+          masm.add(x2, x3, Operand(x4, LSL, i % 64));
+          break;
+        case 2:
+          masm.dci(0);  // Unallocated.
+          break;
+        default:
+          masm.ld1(v0.V16B(), MemOperand(x0));
+          break;
+      }
+    }
+  }
+  masm.FinalizeCode();
+
+  const Instruction* start = masm.GetBuffer()->GetStartAddress<Instruction*>();
+  const Instruction* end = masm.GetBuffer()->GetEndAddress<Instruction*>();
+
+  FILE* expected_file = tmpfile();
+  FILE* batch_file = tmpfile();
+  VIXL_CHECK((expected_file != NULL) && (batch_file != NULL));
+
+  PrintDisassembler expected(expected_file);
+  PrintDisassembler batch(batch_file);
+  for (const Instruction* instr = start; instr < end;
+       instr = instr->GetNextInstruction()) {
+    expected.Disassemble(instr);
+  }
+  batch.DisassembleBuffer(start, end);
+
+  std::string expected_output = ReadWholeFile(expected_file);
+  std::string batch_output = ReadWholeFile(batch_file);
+  fclose(expected_file);
+  fclose(batch_file);
+
+  VIXL_CHECK(!expected_output.empty());
+  if (expected_output != batch_output) {
+    printf("Expected:\n%s\nFound:\n%s\n",
+           expected_output.c_str(),
+           batch_output.c_str());
+    VIXL_ABORT();
+  }
+}
+
 TEST(hint) {
   SETUP();
 
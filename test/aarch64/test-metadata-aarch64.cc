@@ -76,6 +76,75 @@ TEST(test_metadata_mte) {
   simulator.Munmap(tagged_address, data_size, PROT_MTE);
 }
 
+TEST(test_metadata_mte_depot) {
+  MetaDataDepot depot;
+
+  // Tag a range that is not page-aligned, and spans three pages.
+  uint64_t base = 0x10000 - (4 * kMTETagGranuleInBytes);
+  size_t length = 2 * kPageSize;
+  depot.SetMTETagRange(base, length, 0x3);
+  size_t granules = length / kMTETagGranuleInBytes;
+  VIXL_CHECK(depot.GetTotalCountMTE() == granules);
+  for (size_t offset = 0; offset < length; offset += kMTETagGranuleInBytes) {
+    VIXL_CHECK(depot.GetMTETag(base + offset) == 0x3);
+  }
+
+  // Address tags are ignored.
+  uint64_t tagged_base = base | (UINT64_C(0xa) << kAddressTagOffset);
+  VIXL_CHECK(depot.GetMTETag(tagged_base) == 0x3);
+
+  // Overwrite single granules, including neighbouring ones.
+  depot.SetMTETag(base + kMTETagGranuleInBytes, 0xf);
+  depot.SetMTETag(base + (2 * kMTETagGranuleInBytes), 0x0);
+  VIXL_CHECK(depot.GetMTETag(base) == 0x3);
+  VIXL_CHECK(depot.GetMTETag(base + kMTETagGranuleInBytes) == 0xf);
+  VIXL_CHECK(depot.GetMTETag(base + (2 * kMTETagGranuleInBytes)) == 0x0);
+  VIXL_CHECK(depot.GetMTETag(base + (3 * kMTETagGranuleInBytes)) == 0x3);
+  VIXL_CHECK(depot.GetTotalCountMTE() == granules);
+
+  // Clean the middle page, and part of the others. Only tagged granules are
+  // counted.
+  uint64_t clean_base = base + (2 * kMTETagGranuleInBytes);
+  size_t clean_length = kPageSize + (4 * kMTETagGranuleInBytes);
+  VIXL_CHECK(depot.CleanMTETagRange(clean_base, clean_length) ==
+             (clean_length / kMTETagGranuleInBytes));
+  VIXL_CHECK(depot.CleanMTETagRange(clean_base, clean_length) == 0);
+  VIXL_CHECK(depot.GetTotalCountMTE() ==
+             (granules - (clean_length / kMTETagGranuleInBytes)));
+  VIXL_CHECK(depot.GetMTETag(clean_base - kMTETagGranuleInBytes) == 0xf);
+  VIXL_CHECK(depot.GetMTETag(clean_base + clean_length) == 0x3);
+
+  // Partial granules at the end of a range are included.
+  VIXL_CHECK(depot.CleanMTETagRange(base, length - 1) ==
+             (granules - (clean_length / kMTETagGranuleInBytes)));
+  VIXL_CHECK(depot.GetTotalCountMTE() == 0);
+}
+
+TEST(test_metadata_mte_depot_copy) {
+  MetaDataDepot depot;
+  uint64_t base = 0x10000;
+  depot.SetMTETagRange(base, 2 * kPageSize, 0x3);
+
+  // Copies share pages until one side modifies them.
+  MetaDataDepot copy(depot);
+  copy.SetMTETag(base, 0x5);
+  copy.CleanMTETagRange(base + kPageSize, kPageSize);
+  VIXL_CHECK(copy.GetMTETag(base) == 0x5);
+  VIXL_CHECK(copy.GetTotalCountMTE() ==
+             (depot.GetTotalCountMTE() - (kPageSize / kMTETagGranuleInBytes)));
+  VIXL_CHECK(depot.GetMTETag(base) == 0x3);
+  VIXL_CHECK(depot.GetMTETag(base + kPageSize) == 0x3);
+
+  // Assignment discards the modified pages.
+  copy = depot;
+  VIXL_CHECK(copy.GetMTETag(base) == 0x3);
+  VIXL_CHECK(copy.GetMTETag(base + kPageSize) == 0x3);
+  VIXL_CHECK(copy.GetTotalCountMTE() == depot.GetTotalCountMTE());
+
+  depot.SetMTETag(base + kPageSize, 0x7);
+  VIXL_CHECK(copy.GetMTETag(base + kPageSize) == 0x3);
+}
+
 #ifdef VIXL_NEGATIVE_TESTING
 TEST(test_metadata_mte_neg) {
   CPUFeatures features(CPUFeatures::kMTE);
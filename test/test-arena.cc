@@ -0,0 +1,144 @@
+// Copyright 2026, VIXL authors
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//   * Redistributions of source code must retain the above copyright notice,
+//     this list of conditions and the following disclaimer.
+//   * Redistributions in binary form must reproduce the above copyright notice,
+//     this list of conditions and the following disclaimer in the documentation
+//     and/or other materials provided with the distribution.
+//   * Neither the name of ARM Limited nor the names of its contributors may be
+//     used to endorse or promote products derived from this software without
+//     specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS CONTRIBUTORS "AS IS" AND
+// ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+// WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include <stdlib.h>
+
+#include "arena-vixl.h"
+#include "test-runner.h"
+
+namespace vixl {
+
+// This file contains tests for the `Arena` class.
+
+#define TEST(name) TEST_(ARENA_##name)
+
+struct Pair {
+  Pair(int first_in, double second_in) : first(first_in), second(second_in) {}
+  int first;
+  double second;
+};
+
+TEST(allocate) {
+  Arena arena(64);
+  VIXL_CHECK(arena.GetAllocatedSize() == 0);
+
+  // Allocations are aligned, and do not overlap.
+  uint8_t* a = static_cast<uint8_t*>(arena.Allocate(3, 1));
+  uint8_t* b = static_cast<uint8_t*>(arena.Allocate(8, 8));
+  VIXL_CHECK(IsAligned(reinterpret_cast<uintptr_t>(b), 8));
+  VIXL_CHECK(b >= (a + 3));
+  VIXL_CHECK(arena.Contains(a));
+  VIXL_CHECK(arena.Contains(b + 7));
+  VIXL_CHECK(arena.GetAllocatedSize() == 11);
+
+  Pair* pair = arena.New<Pair>(42, 1.5);
+  VIXL_CHECK(IsAligned(reinterpret_cast<uintptr_t>(pair), alignof(Pair)));
+  VIXL_CHECK((pair->first == 42) && (pair->second == 1.5));
+
+  // Fill several chunks, including with allocations bigger than a chunk.
+  for (int i = 0; i < 100; i++) {
+    uint8_t* p = static_cast<uint8_t*>(arena.Allocate(i * 10));
+    memset(p, i, i * 10);
+    VIXL_CHECK(arena.Contains(p));
+  }
+  VIXL_CHECK((pair->first == 42) && (pair->second == 1.5));
+
+  int local = 0;
+  VIXL_CHECK(!arena.Contains(&local));
+}
+
+TEST(reset) {
+  Arena arena(64);
+  void* first[4];
+  for (int i = 0; i < 4; i++) {
+    first[i] = arena.Allocate(16);
+    for (int j = 1; j < 1000; j++) {
+      arena.Allocate(16);
+    }
+    VIXL_CHECK(arena.GetAllocatedSize() == 16000);
+    arena.Reset();
+    VIXL_CHECK(arena.GetAllocatedSize() == 0);
+  }
+  // Once the arena has grown enough, it reuses the same memory after each
+  // reset.
+  VIXL_CHECK(first[2] == first[3]);
+}
+
+class CountingChunkAllocator : public ArenaChunkAllocator {
+ public:
+  CountingChunkAllocator() : chunks_(0), bytes_(0) {}
+
+  virtual void* AllocateChunk(size_t size) VIXL_OVERRIDE {
+    chunks_++;
+    bytes_ += size;
+    return malloc(size);
+  }
+  virtual void FreeChunk(void* chunk, size_t size) VIXL_OVERRIDE {
+    VIXL_CHECK(chunks_ > 0);
+    chunks_--;
+    bytes_ -= size;
+    free(chunk);
+  }
+
+  size_t GetChunkCount() const { return chunks_; }
+  size_t GetBytes() const { return bytes_; }
+
+ private:
+  size_t chunks_;
+  size_t bytes_;
+};
+
+TEST(chunk_allocator) {
+  CountingChunkAllocator allocator;
+  {
+    Arena arena(64, &allocator);
+    for (int i = 0; i < 100; i++) {
+      VIXL_CHECK(arena.Contains(arena.Allocate(16)));
+    }
+    VIXL_CHECK(allocator.GetChunkCount() > 1);
+    VIXL_CHECK(allocator.GetBytes() >= (100 * 16));
+
+    // Only the most recent chunk is kept after a reset.
+    arena.Reset();
+    VIXL_CHECK(allocator.GetChunkCount() == 1);
+  }
+  VIXL_CHECK(allocator.GetChunkCount() == 0);
+  VIXL_CHECK(allocator.GetBytes() == 0);
+
+  // The allocator can be changed once nothing is allocated.
+  Arena arena(64);
+  arena.Allocate(16);
+  arena.Reset();
+  arena.SetChunkAllocator(&allocator);
+  VIXL_CHECK(allocator.GetChunkCount() == 0);
+  arena.Allocate(16);
+  VIXL_CHECK(allocator.GetChunkCount() == 1);
+  arena.Reset();
+  arena.SetChunkAllocator(NULL);
+  VIXL_CHECK(allocator.GetChunkCount() == 0);
+}
+
+}  // namespace vixl
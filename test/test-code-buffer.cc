@@ -25,7 +25,12 @@
 // OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 
+#ifdef VIXL_NEGATIVE_TESTING
+#include <stdexcept>
+#endif
+
 #include "code-buffer-vixl.h"
+#include "code-space-vixl.h"
 #include "test-runner.h"
 
 namespace vixl {
@@ -163,4 +168,178 @@ TEST(emit) {
                     expected_size) == 0);
 }
 
+#ifdef VIXL_CODE_BUFFER_MMAP
+TEST(code_space_reuse) {
+  CodeSpace space(1 * MBytes);
+  size_t page_size = space.GetPageSize();
+
+  byte* first;
+  {
+    CodeBuffer buffer(&space, 1);
+    VIXL_CHECK(buffer.GetCapacity() == page_size);
+    VIXL_CHECK(buffer.GetCodeSpace() == &space);
+    VIXL_CHECK(space.Contains(buffer.GetStartAddress<void*>()));
+    first = buffer.GetStartAddress<byte*>();
+  }
+
+  // Freed blocks are reused, and blocks never overlap.
+  CodeBuffer a(&space, page_size);
+  CodeBuffer b(&space, 2 * page_size);
+  VIXL_CHECK(a.GetStartAddress<byte*>() == first);
+  VIXL_CHECK(b.GetStartAddress<byte*>() ==
+             (first + CodeBuffer::kDefaultSpaceReservation));
+}
+
+TEST(code_space_grow_in_place) {
+  CodeSpace space(1 * MBytes);
+  size_t page_size = space.GetPageSize();
+
+  // Without any headroom, the block is extended in place.
+  CodeBuffer buffer(&space, page_size, page_size);
+  uintptr_t start = buffer.GetStartAddress<uintptr_t>();
+  for (size_t i = 0; i < (4 * page_size); i += sizeof(uint32_t)) {
+    buffer.EnsureSpaceFor(sizeof(uint32_t));
+    buffer.Emit32(static_cast<uint32_t>(i));
+  }
+  VIXL_CHECK(buffer.GetCapacity() >= (4 * page_size));
+  VIXL_CHECK(buffer.GetStartAddress<uintptr_t>() == start);
+  for (size_t i = 0; i < (4 * page_size); i += sizeof(uint32_t)) {
+    uint32_t value;
+    memcpy(&value, buffer.GetOffsetAddress<byte*>(i), sizeof(value));
+    VIXL_CHECK(value == i);
+  }
+
+  // The next block starts after the grown one.
+  CodeBuffer next(&space, page_size);
+  VIXL_CHECK(next.GetStartAddress<uintptr_t>() ==
+             (start + buffer.GetCapacity()));
+
+  buffer.SetClean();
+}
+
+TEST(code_space_grow_within_reservation) {
+  CodeSpace space(1 * MBytes);
+  size_t page_size = space.GetPageSize();
+
+  // Buffers allocated back to back grow into their own headroom.
+  CodeBuffer a(&space, page_size);
+  CodeBuffer b(&space, page_size);
+  uintptr_t start = a.GetStartAddress<uintptr_t>();
+  for (size_t i = 0; i < (4 * page_size); i += sizeof(uint32_t)) {
+    a.EnsureSpaceFor(sizeof(uint32_t));
+    a.Emit32(static_cast<uint32_t>(i));
+  }
+  VIXL_CHECK(a.GetCapacity() >= (4 * page_size));
+  VIXL_CHECK(a.GetStartAddress<uintptr_t>() == start);
+  VIXL_CHECK(b.GetStartAddress<uintptr_t>() >= (start + a.GetCapacity()));
+
+  a.SetClean();
+}
+
+#ifdef VIXL_NEGATIVE_TESTING
+TEST(code_space_grow_blocked) {
+  CodeSpace space(1 * MBytes);
+  size_t page_size = space.GetPageSize();
+
+  // Neither buffer has any headroom, and `b` stops `a` from growing in place.
+  // Code allocated from a CodeSpace never moves, so growing `a` must fail.
+  CodeBuffer a(&space, page_size, page_size);
+  CodeBuffer b(&space, page_size, page_size);
+  uintptr_t a_start = a.GetStartAddress<uintptr_t>();
+  VIXL_CHECK(b.GetStartAddress<uintptr_t>() == (a_start + page_size));
+  bool aborted = false;
+  try {
+    for (size_t i = 0; i < (2 * page_size); i += sizeof(uint32_t)) {
+      a.EnsureSpaceFor(sizeof(uint32_t));
+      a.Emit32(static_cast<uint32_t>(i));
+    }
+  } catch (const std::runtime_error&) {
+    aborted = true;
+  }
+  VIXL_CHECK(aborted);
+  VIXL_CHECK(a.GetStartAddress<uintptr_t>() == a_start);
+  VIXL_CHECK(a.GetCapacity() == page_size);
+
+  a.SetClean();
+}
+#endif
+
+TEST(code_space_protection) {
+  CodeSpace space(1 * MBytes);
+  size_t page_size = space.GetPageSize();
+
+  CodeBuffer buffer(&space, 4 * page_size);
+  VIXL_CHECK(space.GetProtectionChangeCount() == 0);
+
+  // Only the pages holding code become executable.
+  buffer.EmitZeroedBytes(static_cast<int>(page_size + 4));
+  buffer.SetExecutable();
+  byte* start = buffer.GetStartAddress<byte*>();
+  VIXL_CHECK(space.IsExecutable(start));
+  VIXL_CHECK(space.IsExecutable(start + page_size));
+  VIXL_CHECK(!space.IsExecutable(start + (2 * page_size)));
+  VIXL_CHECK(space.GetProtectionChangeCount() == 1);
+
+  // Changing to the current protection is free.
+  buffer.SetExecutable();
+  VIXL_CHECK(space.GetProtectionChangeCount() == 1);
+
+  buffer.SetWritable();
+  VIXL_CHECK(!space.IsExecutable(start));
+  VIXL_CHECK(space.GetProtectionChangeCount() == 2);
+  buffer.SetWritable();
+  VIXL_CHECK(space.GetProtectionChangeCount() == 2);
+
+  buffer.SetClean();
+}
+
+TEST(code_space_partial_protection) {
+  CodeSpace space(1 * MBytes);
+  size_t page_size = space.GetPageSize();
+
+  CodeBuffer buffer(&space, 4 * page_size);
+  buffer.EmitZeroedBytes(static_cast<int>(4 * page_size));
+  buffer.SetExecutable();
+  VIXL_CHECK(space.GetProtectionChangeCount() == 1);
+
+  // Only the pages covering the range change.
+  byte* start = buffer.GetStartAddress<byte*>();
+  buffer.SetWritable(page_size + 8, page_size);
+  VIXL_CHECK(space.IsExecutable(start));
+  VIXL_CHECK(!space.IsExecutable(start + page_size));
+  VIXL_CHECK(!space.IsExecutable(start + (2 * page_size)));
+  VIXL_CHECK(space.IsExecutable(start + (3 * page_size)));
+  VIXL_CHECK(space.GetProtectionChangeCount() == 2);
+
+  buffer.SetExecutable(page_size, 2 * page_size);
+  VIXL_CHECK(space.IsExecutable(start + page_size));
+  VIXL_CHECK(space.IsExecutable(start + (2 * page_size)));
+  VIXL_CHECK(space.GetProtectionChangeCount() == 3);
+
+  buffer.SetWritable();
+  buffer.SetClean();
+}
+
+#ifdef __linux__
+TEST(code_space_dual_mapping) {
+  CodeSpace space(1 * MBytes, CodeSpace::kDualMapping);
+  VIXL_CHECK(space.IsDualMapped());
+
+  CodeBuffer buffer(&space, 1 * KBytes);
+  const char* test_string = "test string";
+  buffer.EmitString(test_string);
+  buffer.SetExecutable();
+  VIXL_CHECK(space.GetProtectionChangeCount() == 0);
+
+  // The code is visible through the executable alias.
+  const char* alias = buffer.GetExecutableStartAddress<const char*>();
+  VIXL_CHECK(alias != buffer.GetStartAddress<const char*>());
+  VIXL_CHECK(!space.Contains(alias));
+  VIXL_CHECK(strcmp(alias, test_string) == 0);
+
+  buffer.SetClean();
+}
+#endif  // __linux__
+#endif  // VIXL_CODE_BUFFER_MMAP
+
 }  // namespace vixl
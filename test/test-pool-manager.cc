@@ -649,6 +649,80 @@ TEST(PoolWithoutHeaderAlignment) {
   VIXL_ASSERT(new_pc == AlignUp(pc, object_alignment) + object_size);
 }
 
+// This test checks that objects are moved into the padding needed to align
+// earlier objects, when they fit.
+TEST(PackObjectsIntoPadding) {
+  TestMacroAssembler masm;
+
+  PoolManager<int32_t> pool_manager(4 /*header_size*/,
+                                    2 /*header_alignment*/,
+                                    BUFFER_ALIGNMENT);
+  // Sorted by maximum location, the objects are emitted as a, b and c. Placing
+  // b needs four bytes of padding after a, which c can use instead.
+  TestObject a(4 /*size*/, 4 /*alignment*/);
+  TestObject b(8 /*size*/, 8 /*alignment*/);
+  TestObject c(4 /*size*/, 4 /*alignment*/);
+  ForwardReference<int32_t> *ref_a =
+      new ForwardReference<int32_t>(0 /*location*/, 4 /*size*/, 0, 100);
+  ForwardReference<int32_t> *ref_b =
+      new ForwardReference<int32_t>(0 /*location*/, 4 /*size*/, 0, 200);
+  ForwardReference<int32_t> *ref_c =
+      new ForwardReference<int32_t>(0 /*location*/, 4 /*size*/, 0, 300);
+  a.AddReference(ref_a);
+  b.AddReference(ref_b);
+  c.AddReference(ref_c);
+  pool_manager.AddObjectReference(ref_a, &a);
+  pool_manager.AddObjectReference(ref_b, &b);
+  pool_manager.AddObjectReference(ref_c, &c);
+
+  int32_t new_pc = pool_manager.Emit(&masm,
+                                     0,
+                                     0, /* no new code added */
+                                     NULL,
+                                     NULL,
+                                     PoolManager<int32_t>::kNoBranchRequired);
+  USE(new_pc);
+  VIXL_CHECK(a.GetLocation() == 0);
+  VIXL_CHECK(c.GetLocation() == 4);
+  VIXL_CHECK(b.GetLocation() == 8);
+  VIXL_CHECK(new_pc == 16);
+}
+
+// This test checks that the pool manager only asks for emission at a barrier
+// once the barrier window is reached.
+TEST(EmitAtBarrier) {
+  TestMacroAssembler masm;
+
+  PoolManager<int32_t> pool_manager(4 /*header_size*/,
+                                    2 /*header_alignment*/,
+                                    BUFFER_ALIGNMENT);
+  TestObject object(4 /*size*/, 4 /*alignment*/);
+  ForwardReference<int32_t> *ref =
+      new ForwardReference<int32_t>(0 /*location*/, 4 /*size*/, 0, 1000);
+  object.AddReference(ref);
+  pool_manager.AddObjectReference(ref, &object);
+
+  // Barriers are ignored by default.
+  TestPoolManager test(&pool_manager);
+  int32_t checkpoint = test.GetPoolCheckpoint();
+  VIXL_CHECK(!pool_manager.ShouldEmitAtBarrier(checkpoint - 4));
+
+  const int32_t kWindow = 256;
+  pool_manager.SetBarrierWindow(kWindow);
+  VIXL_CHECK(!pool_manager.ShouldEmitAtBarrier(checkpoint - kWindow - 4));
+  VIXL_CHECK(pool_manager.ShouldEmitAtBarrier(checkpoint - kWindow));
+
+  int32_t pc = checkpoint - kWindow;
+  pool_manager.Emit(&masm,
+                    pc,
+                    0, /* no new code added */
+                    NULL,
+                    NULL,
+                    PoolManager<int32_t>::kNoBranchRequired);
+  VIXL_CHECK(object.GetLocation() == pc);
+  VIXL_CHECK(!pool_manager.ShouldEmitAtBarrier(pc + 4));
+}
+
 static int32_t AddNBranches(PoolManager<int32_t> *pool_manager,
                             int32_t pc,
                             TestBranchObject *labels[],
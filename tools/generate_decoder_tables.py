@@ -0,0 +1,417 @@
+#!/usr/bin/env python3
+
+# Copyright 2026, VIXL authors
+# All rights reserved.
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are met:
+#
+#   * Redistributions of source code must retain the above copyright notice,
+#     this list of conditions and the following disclaimer.
+#   * Redistributions in binary form must reproduce the above copyright notice,
+#     this list of conditions and the following disclaimer in the documentation
+#     and/or other materials provided with the distribution.
+#   * Neither the name of ARM Limited nor the names of its contributors may be
+#     used to endorse or promote products derived from this software without
+#     specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS CONTRIBUTORS "AS IS" AND
+# ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+# WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+# DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE
+# FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+# DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+# SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+# CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+# OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+# OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+"""
+Generate the AArch64 and AArch32 decoder tables from their decode graphs.
+
+The AArch64 decode graph is described by `kDecodeMapping`, in
+`src/aarch64/decoder-constants-aarch64.h`. Each node in the graph samples some
+bits of the instruction, and uses them to choose the next node. Eventually, a
+node naming an instruction form is reached.
+
+This script compiles that graph into the flat table of `DecodeTableEntry`
+values used by the `Decoder` (see `src/decode-table-vixl.h`), and writes
+it to `src/aarch64/decoder-tables-aarch64.h`, along with the list of instruction
+forms. Constructing a `Decoder` therefore requires no work at run time.
+
+The A32 and T32 decode graphs, `kA32DecodeMapping` and `kT32DecodeMapping` in
+`src/aarch32/decoder-constants-aarch32.h`, are compiled in the same way. Their
+encodings are listed as enums in `src/aarch32/decoder-encodings-aarch32.h`, and
+the tables are written to `src/aarch32/decoder-tables-aarch32.h`.
+
+Run this script from VIXL's top-level directory whenever a decode graph is
+modified. With `--check`, the script reports whether the checked-in files are
+up to date instead of writing them.
+"""
+
+import argparse
+import re
+import sys
+
+A64_INPUT = 'src/aarch64/decoder-constants-aarch64.h'
+A64_OUTPUT = 'src/aarch64/decoder-tables-aarch64.h'
+AARCH32_INPUT = 'src/aarch32/decoder-constants-aarch32.h'
+AARCH32_ENCODINGS_OUTPUT = 'src/aarch32/decoder-encodings-aarch32.h'
+AARCH32_TABLES_OUTPUT = 'src/aarch32/decoder-tables-aarch32.h'
+
+# These must match DecodeTableEntry::Type.
+LEAF_ENTRY = 0
+EXTRACT_ENTRY = 1
+TEST_ENTRY = 2
+
+# These must match the widths of the DecodeTableEntry fields.
+BASE_BITS = 15
+MASK_BITS = 10
+SHIFT_BITS = 5
+
+LICENCE = """\
+// Copyright 2026, VIXL authors
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//   * Redistributions of source code must retain the above copyright notice,
+//     this list of conditions and the following disclaimer.
+//   * Redistributions in binary form must reproduce the above copyright notice,
+//     this list of conditions and the following disclaimer in the documentation
+//     and/or other materials provided with the distribution.
+//   * Neither the name of ARM Limited nor the names of its contributors may be
+//     used to endorse or promote products derived from this software without
+//     specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS CONTRIBUTORS "AS IS" AND
+// ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+// WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+"""
+
+
+def Header(source, guard, isa):
+  return (LICENCE + '\n'
+          '// This file is auto generated from {} using\n'
+          '// tools/generate_decoder_tables.py. Do not edit it by hand.\n'
+          '\n'
+          '#ifndef {}\n'
+          '#define {}\n'
+          '\n'
+          'namespace vixl {{\n'
+          'namespace {} {{\n'
+          '\n'
+          '// clang-format off\n').format(source, guard, guard, isa)
+
+
+def Footer(guard, isa):
+  return ('// clang-format on\n'
+          '\n'
+          '}}  // namespace {}\n'
+          '}}  // namespace vixl\n'
+          '\n'
+          '#endif  // {}\n').format(isa, guard)
+
+
+def BuildOptions():
+  result = argparse.ArgumentParser(
+      description = 'Generate the AArch64 and AArch32 decoder tables.',
+      formatter_class = argparse.ArgumentDefaultsHelpFormatter)
+  result.add_argument('--check', action = 'store_true',
+                      help = 'Check that the outputs are up to date, rather '
+                             'than writing them.')
+  return result.parse_args()
+
+
+class DecodeNode(object):
+  def __init__(self, name, sampled_bits, patterns):
+    self.name = name
+    self.sampled_bits = sampled_bits
+    # A list of (pattern string, handler name) tuples.
+    self.patterns = patterns
+
+
+def ParseDecodeMapping(filename, array = 'kDecodeMapping'):
+  """
+  Parse the named DecodeMapping array, and return a list of DecodeNodes, in the
+  order that they appear.
+  """
+  with open(filename) as f:
+    text = f.read()
+  start = text.index(' ' + array + '[] = {')
+  text = text[start:text.index('\n};\n', start)]
+  pattern = r'\{"([01x]+)"_b,\s*"(\w+)"\}'
+  pattern_re = re.compile(pattern)
+  node_re = re.compile(r'\{\s*"(\w+)",\s*\{([\d,\s]*)\},'
+                       r'\s*\{((?:\s*' + pattern + r',)*)\s*\},\s*\},')
+  nodes = []
+  for match in node_re.finditer(text):
+    sampled_bits = [int(b) for b in match.group(2).split(',') if b.strip()]
+    patterns = pattern_re.findall(match.group(3))
+    for pattern, _ in patterns:
+      if len(pattern) != len(sampled_bits):
+        raise Exception('Pattern "{}" in node "{}" does not match its sampled '
+                        'bits.'.format(pattern, match.group(1)))
+    nodes.append(DecodeNode(match.group(1), sampled_bits, patterns))
+  if not nodes:
+    raise Exception('Could not find {} in {}'.format(array, filename))
+  return nodes
+
+
+def GetForms(nodes):
+  """
+  Return the list of instruction forms. Forms are numbered in the order that
+  they first appear in the decode graph, after "unallocated". Handlers with a
+  '_' prefix name other decode nodes, rather than forms.
+  """
+  forms = ['unallocated']
+  seen = set(forms)
+  for node in nodes:
+    for _, handler in node.patterns:
+      if not handler.startswith('_') and handler not in seen:
+        seen.add(handler)
+        forms.append(handler)
+  return forms
+
+
+def CountSetBits(value):
+  return bin(value).count('1')
+
+
+class TableCompiler(object):
+  """
+  Compile the decode graph into a list of (base, mask, shift, type) entries,
+  following the description of DecodeTableEntry in decode-table-vixl.h.
+  """
+  def __init__(self, nodes, forms):
+    self.nodes = dict((node.name, node) for node in nodes)
+    self.form_ids = dict((form, i) for i, form in enumerate(forms))
+    self.compiled = {}
+    # Maps (mask, children) to the entry sampling those bits, so that
+    # identical subtables are only emitted once.
+    self.subtables = {}
+    self.test_ids = {}
+    self.entries = []
+    self.tests = []
+
+  def Compile(self):
+    # The root's entry is always first.
+    self.Allocate(1)
+    self.entries[0] = self.CompileNode('Root')
+    for base, mask, shift, _ in self.entries:
+      if ((base >= (1 << BASE_BITS)) or (mask >= (1 << MASK_BITS)) or
+          (shift >= (1 << SHIFT_BITS))):
+        raise Exception('Entry ({}, 0x{:x}, {}) does not fit in a '
+                        'DecodeTableEntry.'.format(base, mask, shift))
+    return self.entries, self.tests
+
+  def Allocate(self, count):
+    base = len(self.entries)
+    self.entries.extend([None] * count)
+    return base
+
+  def CompileNode(self, name):
+    if name not in self.compiled:
+      if name in self.nodes:
+        self.compiled[name] = self.CompileDecodeNode(self.nodes[name])
+      else:
+        self.compiled[name] = (self.form_ids[name], 0, 0, LEAF_ENTRY)
+    return self.compiled[name]
+
+  def CompileDecodeNode(self, node):
+    bits = node.sampled_bits
+    patterns = node.patterns
+
+    # A single pattern with no 'x' symbols, optionally followed by a pattern
+    # matching anything, is compiled to a test of the instruction against a
+    # mask and value.
+    if self.IsTest(bits, patterns):
+      mask = 0
+      value = 0
+      for bit, symbol in zip(bits, patterns[0][0]):
+        mask |= 1 << bit
+        if symbol == '1':
+          value |= 1 << bit
+      if len(patterns) == 1:
+        no_match = self.CompileNode('unallocated')
+      else:
+        no_match = self.CompileNode(patterns[1][1])
+      match = self.CompileNode(patterns[0][1])
+      if (mask, value) not in self.test_ids:
+        self.test_ids[(mask, value)] = len(self.tests)
+        self.tests.append((mask, value))
+      test = self.test_ids[(mask, value)]
+      key = (test, no_match, match)
+      if key not in self.subtables:
+        base = self.Allocate(2)
+        self.entries[base] = no_match
+        self.entries[base + 1] = match
+        self.subtables[key] = (base, test, 0, TEST_ENTRY)
+      return self.subtables[key]
+
+    # Otherwise, find the next node for every value of the sampled bits, with
+    # the values ordered as if the bits had been compressed into a contiguous
+    # field, and the lowest sampled bit in the least-significant position.
+    ordered_bits = sorted(bits)
+    children = []
+    for index in range(1 << len(bits)):
+      handler = 'unallocated'
+      for pattern, candidate in patterns:
+        if all((symbol == 'x') or
+               (int(symbol) == ((index >> ordered_bits.index(bit)) & 1))
+               for bit, symbol in zip(bits, pattern)):
+          handler = candidate
+          break
+      children.append(self.CompileNode(handler))
+
+    mask = 0
+    for bit in bits:
+      mask |= 1 << bit
+    return self.CompileSampledBits(mask, children)
+
+  @staticmethod
+  def IsTest(bits, patterns):
+    if (len(bits) < 2) or ('x' in patterns[0][0]):
+      return False
+    if len(patterns) == 1:
+      return True
+    return (len(patterns) == 2) and (patterns[1][0] == 'x' * len(bits))
+
+  def CompileSampledBits(self, mask, children):
+    # If every child is the same, there is no need to sample any bits.
+    if all(child == children[0] for child in children):
+      return children[0]
+
+    key = (mask, tuple(children))
+    if key not in self.subtables:
+      self.subtables[key] = self.CompileSampledBitsUncached(mask, children)
+    return self.subtables[key]
+
+  def CompileSampledBitsUncached(self, mask, children):
+    # Sample the most-significant run of set bits in the mask, up to the width
+    # of DecodeTableEntry::mask. Any remaining bits are sampled by the entries
+    # at the next level.
+    msb = mask.bit_length() - 1
+    lsb = msb
+    while ((lsb > 0) and (mask & (1 << (lsb - 1))) and
+           (msb - lsb + 1 < MASK_BITS)):
+      lsb -= 1
+    run_mask = (1 << (msb - lsb + 1)) - 1
+    remaining_mask = mask & ~(run_mask << lsb)
+    remaining_count = 1 << CountSetBits(remaining_mask)
+
+    base = self.Allocate(run_mask + 1)
+    for i in range(run_mask + 1):
+      if remaining_mask == 0:
+        entry = children[i]
+      else:
+        start = i * remaining_count
+        entry = self.CompileSampledBits(
+            remaining_mask, children[start:start + remaining_count])
+      self.entries[base + i] = entry
+    return (base, run_mask, lsb, EXTRACT_ENTRY)
+
+
+def FormatRows(items, per_line):
+  lines = []
+  for i in range(0, len(items), per_line):
+    lines.append('  ' + ' '.join(items[i:i + per_line]))
+  return '\n'.join(lines) + '\n'
+
+
+def FormatTables(nodes, prefix):
+  """
+  Return the decode table and tests for a graph, as C++ arrays called
+  k<prefix>DecodeTable and k<prefix>DecodeTableTests.
+  """
+  entries, tests = TableCompiler(nodes, GetForms(nodes)).Compile()
+  out = ('// The decode table, as {base, mask, shift, type}. See '
+         'DecodeTableEntry.\n')
+  out += 'static const DecodeTableEntry k{}DecodeTable[] = {{\n'.format(prefix)
+  out += FormatRows(['{{{}, 0x{:x}, {}, {}}},'.format(*e) for e in entries], 3)
+  out += '};\n\n'
+
+  out += '// The {mask, value} pairs used by kTestEntry entries.\n'
+  out += 'static const DecodeTableTest k{}DecodeTableTests[] = {{\n'.format(
+      prefix)
+  out += FormatRows(['{{0x{:08x}, 0x{:08x}}},'.format(*t) for t in tests], 3)
+  out += '};\n'
+  return out
+
+
+def GenerateA64(nodes):
+  guard = 'VIXL_AARCH64_DECODER_TABLES_AARCH64_H_'
+  out = Header('decoder-constants-aarch64.h', guard, 'aarch64')
+  out += '// The instruction forms, indexed by FormId.\n'
+  out += 'static const char* const kDecodeFormNames[] = {\n'
+  out += ''.join('  "{}",\n'.format(form) for form in GetForms(nodes))
+  out += '};\n\n'
+  out += FormatTables(nodes, '')
+  out += Footer(guard, 'aarch64')
+  return out
+
+
+def GenerateAArch32Encodings(graphs):
+  guard = 'VIXL_AARCH32_DECODER_ENCODINGS_AARCH32_H_'
+  out = Header('decoder-constants-aarch32.h', guard, 'aarch32')
+  for isa, nodes in graphs:
+    out += ('// The {} encodings, in the order that they first appear in '
+            'k{}DecodeMapping.\n').format(isa, isa)
+    out += 'enum {}Encoding {{\n'.format(isa)
+    forms = GetForms(nodes)
+    out += ''.join('  k{}_{},\n'.format(isa, form) for form in forms)
+    out += '}};\n\nconst unsigned k{}EncodingCount = {};\n\n'.format(isa,
+                                                                  len(forms))
+  out = out[:-1] + Footer(guard, 'aarch32')
+  return out
+
+
+def GenerateAArch32Tables(graphs):
+  guard = 'VIXL_AARCH32_DECODER_TABLES_AARCH32_H_'
+  out = Header('decoder-constants-aarch32.h', guard, 'aarch32')
+  for isa, nodes in graphs:
+    out += '// The names of the {} encodings, indexed by {}Encoding.\n'.format(
+        isa, isa)
+    out += 'static const char* const k{}EncodingNames[] = {{\n'.format(isa)
+    out += ''.join('  "{}",\n'.format(form) for form in GetForms(nodes))
+    out += '};\n\n'
+    out += FormatTables(nodes, isa)
+    out += '\n'
+  out = out[:-1] + Footer(guard, 'aarch32')
+  return out
+
+
+def GenerateAll():
+  """Return a list of (filename, contents) tuples."""
+  aarch32_graphs = [(isa, ParseDecodeMapping(AARCH32_INPUT,
+                                             'k{}DecodeMapping'.format(isa)))
+                    for isa in ('A32', 'T32')]
+  return [(A64_OUTPUT, GenerateA64(ParseDecodeMapping(A64_INPUT))),
+          (AARCH32_ENCODINGS_OUTPUT, GenerateAArch32Encodings(aarch32_graphs)),
+          (AARCH32_TABLES_OUTPUT, GenerateAArch32Tables(aarch32_graphs))]
+
+
+if __name__ == '__main__':
+  args = BuildOptions()
+  up_to_date = True
+  for filename, output in GenerateAll():
+    if args.check:
+      with open(filename) as f:
+        if f.read() != output:
+          print(filename + ' is out of date. Run ' + sys.argv[0] + '.')
+          up_to_date = False
+          continue
+      print(filename + ' is up to date.')
+    else:
+      with open(filename, 'w') as f:
+        f.write(output)
+  if not up_to_date:
+    sys.exit(1)